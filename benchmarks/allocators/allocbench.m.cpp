@@ -0,0 +1,936 @@
+// allocbench.m.cpp                                                   -*-C++-*-
+
+// This program drives the BDE allocators through workloads modeled on those
+// described in "On Quantifying Memory-Allocation Strategies" (N4468), and
+// writes its results as comma-separated values suitable for loading into a
+// spreadsheet or a data-analysis tool.  See 'README.md' in this directory for
+// instructions on building and running it.
+//
+// Three benchmarks are provided:
+//
+//: 'churn':     Repeatedly create, populate, and destroy a container using a
+//:              newly-constructed allocator.  Allocators that reclaim memory
+//:              on destruction are also measured with the container being
+//:              "winked out" (i.e., never destroyed, its memory being
+//:              reclaimed by the destruction of its allocator).
+//:
+//: 'diffusion': Populate many independent lists ("subsystems"), each using
+//:              its own allocator, then repeatedly remove and add elements to
+//:              randomly-chosen subsystems, so that the nodes of each list
+//:              become scattered in memory, and finally measure the time
+//:              taken to traverse every list.
+//:
+//: 'threads':   Run the 'churn' workloads concurrently in several threads,
+//:              either with every thread using a single thread-safe
+//:              allocator ("shared" mode), or with every thread constructing
+//:              its own allocators ("local" mode).
+//
+// Every measurement is preceded by an untimed warm-up run, is repeated a
+// configurable number of times, and is reported as the minimum and the median
+// of the elapsed (wall-clock) times of the repetitions.  All random choices
+// are made by a generator seeded from the command line, so that successive
+// runs perform exactly the same sequence of operations.
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+//=============================================================================
+//                        GLOBAL CONSTANTS AND VARIABLES
+//-----------------------------------------------------------------------------
+
+const char k_TEXT[] = "a string long enough to require an allocation";
+    // Value assigned to strings created by the workloads.  Note that the
+    // length of this string exceeds the short-string buffer of 'bsl::string'.
+
+volatile bsls::Types::Int64 g_sink = 0;
+    // Accumulator for values computed by the workloads, which prevents the
+    // compiler from optimizing the workloads away.
+
+//=============================================================================
+//                                HELPER TYPES
+//-----------------------------------------------------------------------------
+
+                                // =========
+                                // class Rng
+                                // =========
+
+class Rng {
+    // This class implements a linear congruential pseudo-random number
+    // generator, producing the same sequence of numbers on every platform.
+
+    // DATA
+    unsigned int d_state;  // current state
+
+  public:
+    // CREATORS
+    explicit Rng(unsigned int seed)
+        // Create a generator having the specified 'seed'.
+    : d_state(seed)
+    {
+    }
+
+    // MANIPULATORS
+    int next(int limit)
+        // Return the next pseudo-random number in the range '[0 .. limit)'.
+        // The behavior is undefined unless '0 < limit'.
+    {
+        d_state = d_state * 1103515245U + 12345U;
+        return static_cast<int>((d_state >> 8) % static_cast<unsigned>(limit));
+    }
+};
+
+                            // ===================
+                            // enum AllocatorKind
+                            // ===================
+
+enum AllocatorKind {
+    // Enumerate the allocators measured by this program.
+
+    e_NEW_DELETE,
+    e_SEQUENTIAL,
+    e_BUFFERED_SEQUENTIAL,
+    e_MULTIPOOL,
+    e_CONCURRENT_MULTIPOOL
+};
+
+const int k_NUM_ALLOCATOR_KINDS = e_CONCURRENT_MULTIPOOL + 1;
+
+const char *allocatorName(AllocatorKind kind)
+    // Return the name, as accepted on the command line and written to the
+    // results, of the allocator of the specified 'kind'.
+{
+    switch (kind) {
+      case e_NEW_DELETE:           return "newdelete";                // RETURN
+      case e_SEQUENTIAL:           return "sequential";               // RETURN
+      case e_BUFFERED_SEQUENTIAL:  return "bufferedsequential";       // RETURN
+      case e_MULTIPOOL:            return "multipool";                // RETURN
+      case e_CONCURRENT_MULTIPOOL: return "concurrentmultipool";      // RETURN
+    }
+    return "unknown";
+}
+
+bool isThreadSafe(AllocatorKind kind)
+    // Return 'true' if an allocator of the specified 'kind' may be used
+    // concurrently by several threads, and 'false' otherwise.
+{
+    return e_NEW_DELETE == kind || e_CONCURRENT_MULTIPOOL == kind;
+}
+
+bool reclaimsOnDestruction(AllocatorKind kind)
+    // Return 'true' if destroying an allocator of the specified 'kind'
+    // reclaims all memory allocated from it, so that the objects allocated
+    // from it need not be destroyed, and 'false' otherwise.
+{
+    return e_NEW_DELETE != kind;
+}
+
+                           // =====================
+                           // class TestedAllocator
+                           // =====================
+
+class TestedAllocator {
+    // This class owns an allocator of a kind selected at construction, and
+    // provides access to it through the 'bslma::Allocator' protocol.  Every
+    // allocator obtains its memory from the 'bslma::NewDeleteAllocator', so
+    // that the measurements do not depend on the default allocator.
+
+    // PRIVATE TYPES
+    enum { k_BUFFER_SIZE = 16 * 1024 };  // size of the buffer supplied to
+                                         // a buffered sequential allocator
+
+    // DATA
+    bslma::Allocator                                      *d_allocator_p;
+    AllocatorKind                                          d_kind;
+    bsls::ObjectBuffer<bdlma::SequentialAllocator>         d_sequential;
+    bsls::ObjectBuffer<bdlma::BufferedSequentialAllocator> d_buffered;
+    bsls::ObjectBuffer<bdlma::MultipoolAllocator>          d_multipool;
+    bsls::ObjectBuffer<bdlma::ConcurrentMultipoolAllocator>
+                                                           d_concurrent;
+    bsls::AlignedBuffer<k_BUFFER_SIZE>                     d_buffer;
+
+  private:
+    // NOT IMPLEMENTED
+    TestedAllocator(const TestedAllocator&);
+    TestedAllocator& operator=(const TestedAllocator&);
+
+  public:
+    // CREATORS
+    explicit TestedAllocator(AllocatorKind kind);
+        // Create an allocator of the specified 'kind'.
+
+    ~TestedAllocator();
+        // Destroy this object, and the allocator it owns.
+
+    // MANIPULATORS
+    bslma::Allocator *allocator();
+        // Return the address of the allocator owned by this object.
+};
+
+                           // ---------------------
+                           // class TestedAllocator
+                           // ---------------------
+
+// CREATORS
+TestedAllocator::TestedAllocator(AllocatorKind kind)
+: d_allocator_p(0)
+, d_kind(kind)
+{
+    bslma::Allocator *upstream = &bslma::NewDeleteAllocator::singleton();
+
+    switch (kind) {
+      case e_NEW_DELETE: {
+        d_allocator_p = upstream;
+      } break;
+      case e_SEQUENTIAL: {
+        d_allocator_p = new (d_sequential.buffer())
+                                          bdlma::SequentialAllocator(upstream);
+      } break;
+      case e_BUFFERED_SEQUENTIAL: {
+        d_allocator_p = new (d_buffered.buffer())
+                        bdlma::BufferedSequentialAllocator(d_buffer.buffer(),
+                                                           k_BUFFER_SIZE,
+                                                           upstream);
+      } break;
+      case e_MULTIPOOL: {
+        d_allocator_p = new (d_multipool.buffer())
+                                           bdlma::MultipoolAllocator(upstream);
+      } break;
+      case e_CONCURRENT_MULTIPOOL: {
+        d_allocator_p = new (d_concurrent.buffer())
+                                 bdlma::ConcurrentMultipoolAllocator(upstream);
+      } break;
+    }
+}
+
+TestedAllocator::~TestedAllocator()
+{
+    switch (d_kind) {
+      case e_NEW_DELETE: {
+      } break;
+      case e_SEQUENTIAL: {
+        d_sequential.object().~SequentialAllocator();
+      } break;
+      case e_BUFFERED_SEQUENTIAL: {
+        d_buffered.object().~BufferedSequentialAllocator();
+      } break;
+      case e_MULTIPOOL: {
+        d_multipool.object().~MultipoolAllocator();
+      } break;
+      case e_CONCURRENT_MULTIPOOL: {
+        d_concurrent.object().~ConcurrentMultipoolAllocator();
+      } break;
+    }
+}
+
+// MANIPULATORS
+inline
+bslma::Allocator *TestedAllocator::allocator()
+{
+    return d_allocator_p;
+}
+
+//=============================================================================
+//                              CHURN WORKLOADS
+//-----------------------------------------------------------------------------
+// Each workload creates a container using the specified 'allocator', performs
+// operations involving the specified 'numElements' elements on it, and then,
+// unless the specified 'winkOut' flag is 'true', destroys it.  The specified
+// 'rng' supplies the values of the elements where they matter.
+
+typedef void (*WorkloadFunction)(bslma::Allocator *allocator,
+                                 int               numElements,
+                                 bool              winkOut,
+                                 Rng              *rng);
+
+template <class TYPE>
+void dispose(TYPE *object, bslma::Allocator *allocator, bool winkOut)
+    // Destroy the specified 'object' and deallocate its footprint using the
+    // specified 'allocator', unless the specified 'winkOut' flag is 'true'.
+{
+    if (!winkOut) {
+        allocator->deleteObject(object);
+    }
+}
+
+void churnVectorInt(bslma::Allocator *allocator,
+                    int               numElements,
+                    bool              winkOut,
+                    Rng              *)
+{
+    typedef bsl::vector<int> Container;
+
+    Container *container = new (*allocator) Container(allocator);
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+    g_sink += container->back();
+    dispose(container, allocator, winkOut);
+}
+
+void churnVectorString(bslma::Allocator *allocator,
+                       int               numElements,
+                       bool              winkOut,
+                       Rng              *)
+{
+    typedef bsl::vector<bsl::string> Container;
+
+    Container *container = new (*allocator) Container(allocator);
+    container->resize(numElements);
+    for (int i = 0; i < numElements; ++i) {
+        (*container)[i].assign(k_TEXT);
+    }
+    g_sink += container->back().size();
+    dispose(container, allocator, winkOut);
+}
+
+void churnListInt(bslma::Allocator *allocator,
+                  int               numElements,
+                  bool              winkOut,
+                  Rng              *)
+{
+    typedef bsl::list<int> Container;
+
+    Container *container = new (*allocator) Container(allocator);
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+
+    // Erase every other element, and replace them at the end of the list.
+
+    Container::iterator it = container->begin();
+    while (it != container->end()) {
+        it = container->erase(it);
+        if (it != container->end()) {
+            ++it;
+        }
+    }
+    for (int i = 0; i < numElements / 2; ++i) {
+        container->push_back(i);
+    }
+    g_sink += container->size();
+    dispose(container, allocator, winkOut);
+}
+
+void churnSetInt(bslma::Allocator *allocator,
+                 int               numElements,
+                 bool              winkOut,
+                 Rng              *rng)
+{
+    typedef bsl::set<int> Container;
+
+    Container *container = new (*allocator) Container(allocator);
+    for (int i = 0; i < numElements; ++i) {
+        container->insert(rng->next(numElements * 4));
+    }
+    g_sink += container->size();
+    dispose(container, allocator, winkOut);
+}
+
+void churnUnorderedMapString(bslma::Allocator *allocator,
+                             int               numElements,
+                             bool              winkOut,
+                             Rng              *rng)
+{
+    typedef bsl::unordered_map<int, bsl::string> Container;
+
+    Container *container = new (*allocator) Container(allocator);
+    for (int i = 0; i < numElements; ++i) {
+        (*container)[rng->next(numElements * 4)].assign(k_TEXT);
+    }
+    g_sink += container->size();
+    dispose(container, allocator, winkOut);
+}
+
+struct Workload {
+    // This 'struct' associates a churn workload with its name.
+
+    const char       *d_name;      // name written to the results
+    WorkloadFunction  d_function;  // function performing the workload
+};
+
+const Workload k_WORKLOADS[] = {
+    { "vector<int>",                 &churnVectorInt          },
+    { "vector<string>",              &churnVectorString       },
+    { "list<int>",                   &churnListInt            },
+    { "set<int>",                    &churnSetInt             },
+    { "unordered_map<int,string>",   &churnUnorderedMapString }
+};
+
+const int k_NUM_WORKLOADS = sizeof k_WORKLOADS / sizeof *k_WORKLOADS;
+
+void runChurn(AllocatorKind     kind,
+              bslma::Allocator *sharedAllocator,
+              WorkloadFunction  function,
+              int               numElements,
+              int               numIterations,
+              bool              winkOut,
+              unsigned int      seed)
+    // Run the specified churn 'function' the specified 'numIterations' times
+    // with the specified 'numElements', 'winkOut' flag, and 'seed'.  If the
+    // specified 'sharedAllocator' is not 0, use it for every iteration, and
+    // otherwise use a newly-constructed allocator of the specified 'kind' for
+    // every iteration.
+{
+    Rng rng(seed);
+
+    for (int i = 0; i < numIterations; ++i) {
+        if (sharedAllocator) {
+            function(sharedAllocator, numElements, winkOut, &rng);
+        }
+        else {
+            TestedAllocator allocator(kind);
+            function(allocator.allocator(), numElements, winkOut, &rng);
+        }
+    }
+}
+
+//=============================================================================
+//                            MULTITHREADED CHURN
+//-----------------------------------------------------------------------------
+
+struct ThreadArgs {
+    // This 'struct' holds the arguments of a thread running 'runChurn'.
+
+    AllocatorKind     d_kind;             // kind of allocator
+    bslma::Allocator *d_sharedAllocator;  // shared allocator, or 0
+    WorkloadFunction  d_function;         // workload to run
+    int               d_numElements;      // elements per iteration
+    int               d_numIterations;    // number of iterations
+    unsigned int      d_seed;             // seed of the thread's generator
+    bslmt::Barrier   *d_barrier_p;        // barrier marking the start
+    bsls::Types::Int64
+                      d_startTime;        // start of the run, in nanoseconds
+    bsls::Types::Int64
+                      d_endTime;          // end of the run, in nanoseconds
+};
+
+extern "C" void *churnThread(void *arg)
+    // Wait on the barrier of the specified 'arg', which must be the address
+    // of a 'ThreadArgs', and then run 'runChurn' with the arguments it holds,
+    // recording the times at which the run starts and ends.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+
+    args->d_barrier_p->wait();
+    args->d_startTime = bsls::TimeUtil::getTimer();
+    runChurn(args->d_kind,
+             args->d_sharedAllocator,
+             args->d_function,
+             args->d_numElements,
+             args->d_numIterations,
+             false,
+             args->d_seed);
+    args->d_endTime = bsls::TimeUtil::getTimer();
+    return 0;
+}
+
+double runThreads(AllocatorKind     kind,
+                  bslma::Allocator *sharedAllocator,
+                  WorkloadFunction  function,
+                  int               numThreads,
+                  int               numElements,
+                  int               numIterations,
+                  unsigned int      seed)
+    // Run 'runChurn' in the specified 'numThreads' threads with the specified
+    // 'kind', 'sharedAllocator', 'function', 'numElements', and
+    // 'numIterations', each thread seeding its generator from the specified
+    // 'seed', and return the elapsed time, in seconds, from the start of the
+    // first thread to the completion of the last.
+{
+    bslmt::Barrier barrier(numThreads);
+
+    bsl::vector<ThreadArgs>                args(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        ThreadArgs& a = args[i];
+
+        a.d_kind            = kind;
+        a.d_sharedAllocator = sharedAllocator;
+        a.d_function        = function;
+        a.d_numElements     = numElements;
+        a.d_numIterations   = numIterations;
+        a.d_seed            = seed + i;
+        a.d_barrier_p       = &barrier;
+
+        if (0 != bslmt::ThreadUtil::create(&handles[i], churnThread, &a)) {
+            bsl::cerr << "Error: cannot create thread\n";
+            bsl::exit(1);
+        }
+    }
+
+    bsls::Types::Int64 startTime = 0;
+    bsls::Types::Int64 endTime   = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+
+        if (0 == i || args[i].d_startTime < startTime) {
+            startTime = args[i].d_startTime;
+        }
+        if (0 == i || args[i].d_endTime > endTime) {
+            endTime = args[i].d_endTime;
+        }
+    }
+
+    return static_cast<double>(endTime - startTime) / 1.0e9;
+}
+
+//=============================================================================
+//                            DIFFUSION WORKLOAD
+//-----------------------------------------------------------------------------
+
+class Diffusion {
+    // This class implements the 'diffusion' benchmark: a number of
+    // subsystems, each consisting of a list and the allocator supplying its
+    // nodes, whose elements are churned to scatter the nodes in memory.
+
+    // PRIVATE TYPES
+    typedef bsl::list<int> List;
+
+    // DATA
+    bsl::vector<TestedAllocator *> d_allocators;  // one per subsystem
+    bsl::vector<List *>            d_lists;       // one per subsystem
+
+  private:
+    // NOT IMPLEMENTED
+    Diffusion(const Diffusion&);
+    Diffusion& operator=(const Diffusion&);
+
+  public:
+    // CREATORS
+    Diffusion(AllocatorKind kind, int numSubsystems, int numElements);
+        // Create 'numSubsystems' subsystems using allocators of the specified
+        // 'kind', and populate them with a total of the specified
+        // 'numElements' elements, adding one element to each subsystem in
+        // turn.
+
+    ~Diffusion();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void churn(int numOperations, Rng *rng);
+        // Perform the specified 'numOperations' operations, each removing the
+        // first element of a subsystem chosen using the specified 'rng' and
+        // adding an element at the end of that subsystem.
+
+    bsls::Types::Int64 traverse(int numPasses) const;
+        // Traverse every subsystem the specified 'numPasses' times, and
+        // return the sum of the elements visited.
+};
+
+Diffusion::Diffusion(AllocatorKind kind, int numSubsystems, int numElements)
+{
+    d_allocators.reserve(numSubsystems);
+    d_lists.reserve(numSubsystems);
+    for (int i = 0; i < numSubsystems; ++i) {
+        d_allocators.push_back(new TestedAllocator(kind));
+        bslma::Allocator *allocator = d_allocators.back()->allocator();
+        d_lists.push_back(new (*allocator) List(allocator));
+    }
+    for (int i = 0; i < numElements; ++i) {
+        d_lists[i % numSubsystems]->push_back(i);
+    }
+}
+
+Diffusion::~Diffusion()
+{
+    for (bsl::size_t i = 0; i < d_lists.size(); ++i) {
+        d_allocators[i]->allocator()->deleteObject(d_lists[i]);
+        delete d_allocators[i];
+    }
+}
+
+void Diffusion::churn(int numOperations, Rng *rng)
+{
+    const int numSubsystems = static_cast<int>(d_lists.size());
+
+    for (int i = 0; i < numOperations; ++i) {
+        List *list = d_lists[rng->next(numSubsystems)];
+        if (!list->empty()) {
+            list->pop_front();
+        }
+        list->push_back(i);
+    }
+}
+
+bsls::Types::Int64 Diffusion::traverse(int numPasses) const
+{
+    bsls::Types::Int64 sum = 0;
+
+    for (int pass = 0; pass < numPasses; ++pass) {
+        for (bsl::size_t i = 0; i < d_lists.size(); ++i) {
+            const List& list = *d_lists[i];
+            for (List::const_iterator it = list.begin();
+                 it != list.end();
+                 ++it) {
+                sum += *it;
+            }
+        }
+    }
+    return sum;
+}
+
+//=============================================================================
+//                                 REPORTING
+//-----------------------------------------------------------------------------
+
+struct Config {
+    // This 'struct' holds the parameters given on the command line.
+
+    const char   *d_benchmark;       // benchmark to run, or 0 for all
+    const char   *d_allocator;       // allocator to measure, or 0 for all
+    int           d_numElements;     // elements per container
+    int           d_numIterations;   // iterations per measurement
+    int           d_numThreads;      // threads for the 'threads' benchmark
+    int           d_numRepetitions;  // repetitions per measurement
+    int           d_numSubsystems;   // subsystems of 'diffusion'
+    int           d_churnFactor;     // churn operations of 'diffusion' per
+                                     // element
+    unsigned int  d_seed;            // seed of the pseudo-random generators
+};
+
+void printHeader()
+    // Write the header of the results to 'stdout'.
+{
+    bsl::cout << "benchmark,workload,allocator,mode,threads,elements,"
+                 "iterations,repetitions,min_seconds,median_seconds\n";
+}
+
+void printResult(const Config&        config,
+                 const char          *benchmark,
+                 const char          *workload,
+                 AllocatorKind        kind,
+                 const char          *mode,
+                 int                  numThreads,
+                 bsl::vector<double> *times)
+    // Write to 'stdout' one line of results for the specified 'benchmark',
+    // 'workload', allocator 'kind', 'mode', and 'numThreads', summarizing the
+    // specified 'times' of the repetitions, and using the parameters of the
+    // specified 'config'.  Note that 'times' is sorted.
+{
+    bsl::sort(times->begin(), times->end());
+
+    const double median = times->size() % 2
+                        ? (*times)[times->size() / 2]
+                        : ((*times)[times->size() / 2 - 1] +
+                           (*times)[times->size() / 2]) / 2;
+
+    bsl::cout << benchmark             << ','
+              << '"' << workload << '"' << ','
+              << allocatorName(kind)   << ','
+              << mode                  << ','
+              << numThreads            << ','
+              << config.d_numElements  << ','
+              << config.d_numIterations << ','
+              << times->size()         << ','
+              << (*times)[0]           << ','
+              << median                << '\n';
+    bsl::cout.flush();
+}
+
+//=============================================================================
+//                                BENCHMARKS
+//-----------------------------------------------------------------------------
+
+void benchmarkChurn(const Config& config, AllocatorKind kind)
+    // Run the 'churn' benchmark for the allocator of the specified 'kind'
+    // using the specified 'config', and report the results.
+{
+    for (int w = 0; w < k_NUM_WORKLOADS; ++w) {
+        for (int mode = 0; mode < 2; ++mode) {
+            const bool winkOut = 1 == mode;
+
+            if (winkOut && !reclaimsOnDestruction(kind)) {
+                continue;
+            }
+
+            runChurn(kind,
+                     0,
+                     k_WORKLOADS[w].d_function,
+                     config.d_numElements,
+                     1,
+                     winkOut,
+                     config.d_seed);                                // warm-up
+
+            bsl::vector<double> times;
+            for (int r = 0; r < config.d_numRepetitions; ++r) {
+                bsls::Stopwatch timer;
+                timer.start();
+                runChurn(kind,
+                         0,
+                         k_WORKLOADS[w].d_function,
+                         config.d_numElements,
+                         config.d_numIterations,
+                         winkOut,
+                         config.d_seed);
+                timer.stop();
+                times.push_back(timer.elapsedTime());
+            }
+            printResult(config,
+                        "churn",
+                        k_WORKLOADS[w].d_name,
+                        kind,
+                        winkOut ? "winkout" : "destroy",
+                        1,
+                        &times);
+        }
+    }
+}
+
+void benchmarkDiffusion(const Config& config, AllocatorKind kind)
+    // Run the 'diffusion' benchmark for the allocator of the specified 'kind'
+    // using the specified 'config', and report the results.
+{
+    const int numTotal = config.d_numElements * config.d_numSubsystems;
+
+    bsl::vector<double> churnTimes;
+    bsl::vector<double> traverseTimes;
+
+    for (int r = 0; r < config.d_numRepetitions; ++r) {
+        Rng       rng(config.d_seed);
+        Diffusion diffusion(kind, config.d_numSubsystems, numTotal);
+
+        bsls::Stopwatch timer;
+        timer.start();
+        diffusion.churn(numTotal * config.d_churnFactor, &rng);
+        timer.stop();
+        churnTimes.push_back(timer.elapsedTime());
+
+        g_sink += diffusion.traverse(1);                            // warm-up
+
+        timer.reset();
+        timer.start();
+        g_sink += diffusion.traverse(config.d_numIterations);
+        timer.stop();
+        traverseTimes.push_back(timer.elapsedTime());
+    }
+    printResult(config, "diffusion", "churn", kind, "local", 1, &churnTimes);
+    printResult(config,
+                "diffusion",
+                "traverse",
+                kind,
+                "local",
+                1,
+                &traverseTimes);
+}
+
+void benchmarkThreads(const Config& config, AllocatorKind kind)
+    // Run the 'threads' benchmark for the allocator of the specified 'kind'
+    // using the specified 'config', and report the results.
+{
+    for (int w = 0; w < k_NUM_WORKLOADS; ++w) {
+        for (int mode = 0; mode < 2; ++mode) {
+            const bool shared = 1 == mode;
+
+            if (shared && !isThreadSafe(kind)) {
+                continue;
+            }
+
+            bsl::vector<double> times;
+            for (int r = 0; r <= config.d_numRepetitions; ++r) {
+                TestedAllocator   allocator(kind);
+                bslma::Allocator *sharedAllocator = shared
+                                                  ? allocator.allocator()
+                                                  : 0;
+
+                const double time = runThreads(kind,
+                                               sharedAllocator,
+                                               k_WORKLOADS[w].d_function,
+                                               config.d_numThreads,
+                                               config.d_numElements,
+                                               config.d_numIterations,
+                                               config.d_seed);
+                if (0 < r) {
+                    times.push_back(time);  // the first run is a warm-up
+                }
+            }
+            printResult(config,
+                        "threads",
+                        k_WORKLOADS[w].d_name,
+                        kind,
+                        shared ? "shared" : "local",
+                        config.d_numThreads,
+                        &times);
+        }
+    }
+}
+
+//=============================================================================
+//                              COMMAND LINE
+//-----------------------------------------------------------------------------
+
+void usage(const char *program)
+    // Write a description of the command line of the specified 'program' to
+    // 'stderr', and exit with a non-zero status.
+{
+    bsl::cerr <<
+        "usage: " << program << " [options]\n"
+        "  -b <benchmark>  churn, diffusion, or threads (default: all)\n"
+        "  -a <allocator>  newdelete, sequential, bufferedsequential,\n"
+        "                  multipool, or concurrentmultipool (default: all)\n"
+        "  -n <elements>   elements per container (default: 1000)\n"
+        "  -i <count>      iterations per measurement (default: 1000)\n"
+        "  -t <threads>    threads for 'threads' (default: 4)\n"
+        "  -r <count>      repetitions per measurement (default: 5)\n"
+        "  -k <count>      subsystems for 'diffusion' (default: 64)\n"
+        "  -c <factor>     churn operations per element for 'diffusion'\n"
+        "                  (default: 4)\n"
+        "  -s <seed>       seed of the random generators (default: 1)\n";
+    bsl::exit(1);
+}
+
+bool parsePositive(int *result, const char *text)
+    // Load into the specified 'result' the value of the specified 'text'
+    // interpreted as a decimal integer.  Return 'true' if 'text' denotes a
+    // positive integer, and 'false' otherwise.
+{
+    char *end = 0;
+    const long value = bsl::strtol(text, &end, 10);
+
+    if (end == text || '\0' != *end || value <= 0 || value > 0x7fffffff) {
+        return false;                                                 // RETURN
+    }
+    *result = static_cast<int>(value);
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Config config;
+    config.d_benchmark      = 0;
+    config.d_allocator      = 0;
+    config.d_numElements    = 1000;
+    config.d_numIterations  = 1000;
+    config.d_numThreads     = 4;
+    config.d_numRepetitions = 5;
+    config.d_numSubsystems  = 64;
+    config.d_churnFactor    = 4;
+    config.d_seed           = 1;
+
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 >= argc || '-' != argv[i][0] || '\0' == argv[i][1]
+                                               || '\0' != argv[i][2]) {
+            usage(argv[0]);
+        }
+
+        const char *value = argv[i + 1];
+        int         seed  = 0;
+        bool        valid = true;
+
+        switch (argv[i][1]) {
+          case 'b': config.d_benchmark = value;                        break;
+          case 'a': config.d_allocator = value;                        break;
+          case 'n': valid = parsePositive(&config.d_numElements, value);
+                                                                       break;
+          case 'i': valid = parsePositive(&config.d_numIterations, value);
+                                                                       break;
+          case 't': valid = parsePositive(&config.d_numThreads, value);
+                                                                       break;
+          case 'r': valid = parsePositive(&config.d_numRepetitions, value);
+                                                                       break;
+          case 'k': valid = parsePositive(&config.d_numSubsystems, value);
+                                                                       break;
+          case 'c': valid = parsePositive(&config.d_churnFactor, value);
+                                                                       break;
+          case 's': valid = parsePositive(&seed, value);
+                    config.d_seed = static_cast<unsigned int>(seed);   break;
+          default:  valid = false;                                     break;
+        }
+        if (!valid) {
+            usage(argv[0]);
+        }
+    }
+
+    bool foundBenchmark = false;
+    bool foundAllocator = false;
+
+    printHeader();
+
+    static const struct {
+        const char *d_name;
+        void      (*d_function)(const Config&, AllocatorKind);
+    } BENCHMARKS[] = {
+        { "churn",     &benchmarkChurn     },
+        { "diffusion", &benchmarkDiffusion },
+        { "threads",   &benchmarkThreads   }
+    };
+    const int NUM_BENCHMARKS = sizeof BENCHMARKS / sizeof *BENCHMARKS;
+
+    for (int b = 0; b < NUM_BENCHMARKS; ++b) {
+        if (config.d_benchmark &&
+                          0 != bsl::strcmp(config.d_benchmark,
+                                           BENCHMARKS[b].d_name)) {
+            continue;
+        }
+        foundBenchmark = true;
+
+        for (int a = 0; a < k_NUM_ALLOCATOR_KINDS; ++a) {
+            const AllocatorKind kind = static_cast<AllocatorKind>(a);
+
+            if (config.d_allocator &&
+                          0 != bsl::strcmp(config.d_allocator,
+                                           allocatorName(kind))) {
+                continue;
+            }
+            foundAllocator = true;
+
+            BENCHMARKS[b].d_function(config, kind);
+        }
+    }
+
+    if (!foundBenchmark || !foundAllocator) {
+        usage(argv[0]);
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
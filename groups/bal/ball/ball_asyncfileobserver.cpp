@@ -28,6 +28,11 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bdlt_currenttime.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
@@ -54,7 +59,8 @@ namespace {
 
 enum {
     DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    FORCE_WARN_THRESHOLD     = 5000
+    FORCE_WARN_THRESHOLD     = 5000,
+    DEFAULT_MAX_BATCH_SIZE   = 256
 };
 
 static const char LOG_CATEGORY[] = "BALL.ASYNCFILEOBSERVER";
@@ -77,6 +83,63 @@ static void populateWarnRecord(ball::Record *record,
 
 
 // PRIVATE METHODS
+bool AsyncFileObserver::gatherBatch()
+{
+    BSLS_ASSERT(d_batch.empty());
+
+    const int                maxBatchSize    = d_maxBatchSize.loadRelaxed();
+    const bsls::Types::Int64 flushIntervalUs = d_flushIntervalUs.loadRelaxed();
+
+    AsyncRecord asyncRecord = d_recordQueue.popFront();
+
+    bsls::TimeInterval deadline;
+    if (0 < flushIntervalUs) {
+        deadline = bsls::SystemTime::nowMonotonicClock();
+        deadline.addMicroseconds(flushIntervalUs);
+    }
+
+    while (true) {
+        if (Transmission::e_END == asyncRecord.d_context.transmissionCause()
+         || d_shuttingDownFlag) {
+            return true;                                              // RETURN
+        }
+
+        d_batch.push_back(asyncRecord);
+
+        if (maxBatchSize <= static_cast<int>(d_batch.size())) {
+            return false;                                             // RETURN
+        }
+
+        if (0 != d_recordQueue.tryPopFront(&asyncRecord)) {
+            if (0 == flushIntervalUs) {
+                return false;                                         // RETURN
+            }
+
+            // Wait for the next record until the flush deadline has passed.
+            // The flag is set (with sequential consistency) before checking
+            // the queue again, and 'notifyPublicationThread' reads it (with
+            // sequential consistency) after a record is committed to the
+            // queue, so that either this thread sees the record, or the
+            // publishing thread sees the flag and signals the condition.
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+
+            d_waitingFlag = 1;
+
+            int rc = 0;
+            while (0 == rc && 0 != d_recordQueue.tryPopFront(&asyncRecord)) {
+                rc = d_recordCondition.timedWait(&d_waitMutex, deadline);
+            }
+
+            d_waitingFlag = 0;
+
+            if (0 != rc) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+}
+
 void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
 {
     // Log the record, unconditionally, to the file observer (i.e., without
@@ -88,6 +151,31 @@ void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
     d_fileObserver.publish(d_droppedRecordWarning, context);
 }
 
+void AsyncFileObserver::notifyPublicationThread()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_waitingFlag)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+        d_recordCondition.signal();
+    }
+}
+
+void AsyncFileObserver::publishBatch()
+{
+    d_batchRecords.clear();
+    for (bsl::size_t i = 0; i < d_batch.size(); ++i) {
+        d_batchRecords.push_back(d_batch[i].d_record.get());
+    }
+
+    d_fileObserver.publishBatch(d_batchRecords.data(),
+                                static_cast<int>(d_batchRecords.size()));
+
+    // Release the shared references to the published records.
+
+    d_batch.clear();
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     bool done = false;
@@ -95,19 +183,16 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
     while (!done) {
-        AsyncRecord asyncRecord = d_recordQueue.popFront();
+        done = gatherBatch();
 
-        // Publish the next log record on the queue only if the observer is
-        // not shutting down.
+        // Publish the batch of records removed from the queue only if the
+        // observer is not shutting down.
 
-        if (Transmission::e_END
-                == asyncRecord.d_context.transmissionCause()
-            || d_shuttingDownFlag) {
-            done = true;
+        if (d_shuttingDownFlag) {
+            d_batch.clear();
         }
-        else {
-            d_fileObserver.publish(*asyncRecord.d_record,
-                                   asyncRecord.d_context);
+        else if (!d_batch.empty()) {
+            publishBatch();
         }
 
         // Publish the count of dropped records.  To avoid repeatedly
@@ -154,6 +239,7 @@ int AsyncFileObserver::stopThread()
         asyncRecord.d_record  = record;
         asyncRecord.d_context = context;
         d_recordQueue.pushBack(asyncRecord);
+        notifyPublicationThread();
 
         int ret = bslmt::ThreadUtil::join(d_threadHandle);
         d_threadHandle = bslmt::ThreadUtil::invalidHandle();
@@ -185,6 +271,8 @@ void AsyncFileObserver::construct()
     d_threadHandle     = bslmt::ThreadUtil::invalidHandle();
     d_shuttingDownFlag = 0;
     d_dropCount        = 0;
+    d_maxBatchSize     = DEFAULT_MAX_BATCH_SIZE;
+    d_flushIntervalUs  = 0;
 
     d_publishThreadEntryPoint = bsl::function<void()>(
             bsl::allocator_arg_t(),
@@ -207,6 +295,10 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
+, d_waitingFlag(0)
+, d_recordCondition(bsls::SystemClockType::e_MONOTONIC)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -220,6 +312,10 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
+, d_waitingFlag(0)
+, d_recordCondition(bsls::SystemClockType::e_MONOTONIC)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -235,6 +331,10 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
+, d_waitingFlag(0)
+, d_recordCondition(bsls::SystemClockType::e_MONOTONIC)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -251,6 +351,10 @@ AsyncFileObserver::AsyncFileObserver(
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
+, d_waitingFlag(0)
+, d_recordCondition(bsls::SystemClockType::e_MONOTONIC)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -283,11 +387,13 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
     if (record->fixedFields().severity() > d_dropRecordsOnFullQueueThreshold) {
         if (0 != d_recordQueue.tryPushBack(asyncRecord)) {
             d_dropCount.addRelaxed(1);
+            return;                                                   // RETURN
         }
     }
     else {
         d_recordQueue.pushBack(asyncRecord);
     }
+    notifyPublicationThread();
 }
 
 int AsyncFileObserver::startPublicationThread()
@@ -49,6 +49,8 @@ BSLS_IDENT("$Id: $")
 //                         |              forceRotation
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
+//                         |              setFlushInterval
+//                         |              setMaxBatchSize
 //                         |              setOnFileRotationCallback
 //                         |              setStdoutThreshold
 //                         |              setLogFormat
@@ -60,6 +62,8 @@ BSLS_IDENT("$Id: $")
 //                         |              isUserFieldsLoggingEnabled
 //                         |              isPublishInLocalTimeEnabled
 //                         |              isPublicationThreadRunning
+//                         |              flushInterval
+//                         |              maxBatchSize
 //                         |              recordQueueLength
 //                         |              rotationLifetime
 //                         |              rotationSize
@@ -193,6 +197,26 @@ BSLS_IDENT("$Id: $")
 // Note that timestamp pattern elements in a log file name are typically
 // selected so they produce unique names for each rotation.
 //
+///Batched Publication
+///-------------------
+// Each time the publication thread wakes up, it removes from the record queue
+// all of the records that are available, up to a maximum batch size, and
+// publishes them together: the records are formatted into a single buffer
+// that is written to the log file with one system call, and the records
+// destined to 'stdout' are written with one call to 'fwrite' (see
+// 'ball::FileObserver::publishBatch').  Under a burst of log records, the
+// publication thread therefore issues one write per batch rather than one per
+// record, which lets it keep up with the publishing threads, and reduces the
+// number of records dropped because the queue is full.
+//
+// The maximum batch size (256 records by default) is set by 'setMaxBatchSize'.
+// By default, the publication thread publishes a batch as soon as the record
+// queue is empty.  A flush interval may instead be set by 'setFlushInterval',
+// in which case the publication thread waits for up to that interval after
+// removing the first record of a batch for more records to arrive, so that
+// even a moderate stream of records is written in batches, at the cost of
+// delaying the publication of each record by up to the flush interval.
+//
 ///Thread Safety
 ///-------------
 // All public methods of 'ball::AsyncFileObserver' are thread-safe, and can be
@@ -332,6 +356,14 @@ BSLS_IDENT("$Id: $")
 #include <bdlcc_fixedqueue.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
 #ifndef INCLUDED_BSLMT_THREADUTIL
 #include <bslmt_threadutil.h>
 #endif
@@ -348,10 +380,18 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ATOMIC
 #include <bsls_atomic.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
 #ifndef INCLUDED_BSL_FUNCTIONAL
 #include <bsl_functional.h>
 #endif
@@ -364,6 +404,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 
 namespace ball {
@@ -422,6 +466,41 @@ class AsyncFileObserver : public Observer {
                                                      // count of dropped log
                                                      // records
 
+    bsl::vector<AsyncRecord>       d_batch;          // records removed from
+                                                     // the queue and not yet
+                                                     // published (used only
+                                                     // by the publication
+                                                     // thread)
+
+    bsl::vector<const Record *>    d_batchRecords;   // addresses of the
+                                                     // records in 'd_batch'
+                                                     // (used only by the
+                                                     // publication thread)
+
+    bsls::AtomicInt                d_maxBatchSize;   // maximum number of
+                                                     // records published with
+                                                     // a single write
+
+    bsls::AtomicInt64              d_flushIntervalUs;
+                                                     // maximum time (in
+                                                     // microseconds) to wait
+                                                     // for a batch to fill
+
+    bsls::AtomicInt                d_waitingFlag;    // set while the
+                                                     // publication thread
+                                                     // waits on
+                                                     // 'd_recordCondition'
+                                                     // for a record to add to
+                                                     // a batch
+
+    bslmt::Mutex                   d_waitMutex;      // mutex associated with
+                                                     // 'd_recordCondition'
+
+    bslmt::Condition               d_recordCondition;
+                                                     // signaled when a record
+                                                     // is queued while
+                                                     // 'd_waitingFlag' is set
+
     mutable bslmt::Mutex           d_mutex;          // serialize operations
 
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
@@ -438,16 +517,36 @@ class AsyncFileObserver : public Observer {
         // constructor overloads.  Note that this method should be removed when
         // C++11 constructor chaining is available.
 
+    bool gatherBatch();
+        // Remove from the record queue, and append to 'd_batch', the next
+        // batch of records to publish, blocking until at least one record is
+        // available.  Return 'true' if the publication thread must stop after
+        // publishing the batch (i.e., if the 'e_END' record was removed, or
+        // the observer is shutting down), and 'false' otherwise.  The behavior
+        // is undefined unless this method is invoked by the publication
+        // thread and 'd_batch' is empty.
+
     void logDroppedMessageWarning(int numDropped);
         // Synchronously write an entry into the underlying file observer
         // indicating that the specified 'numDropped' number of records have
         // been dropped.  The behavior is undefined if this method is invoked
         // concurrently from multiple threads (i.e., it is *not* *threadsafe*).
 
+    void notifyPublicationThread();
+        // Wake up the publication thread if it is waiting for a record to add
+        // to a batch.  The behavior is undefined unless this method is called
+        // after each record is appended to the record queue.
+
+    void publishBatch();
+        // Publish the records in 'd_batch' to the underlying file observer,
+        // and clear 'd_batch'.  The behavior is undefined unless this method
+        // is invoked by the publication thread.
+
     void publishThreadEntryPoint();
         // Thread function of the publication thread.  The publication thread
-        // pops record shared pointers and contexts from queue and writes the
-        // records referred by these shared pointers to files or 'stdout'.  The
+        // pops batches of record shared pointers and contexts from queue and
+        // writes the records referred by these shared pointers to files or
+        // 'stdout'.  The
         // behavior is undefined if this method is invoked concurrently from
         // multiple threads (i.e., it is *not* *threadsafe*).  Publish records
         // from the record queue until signaled to stop.  This is the entry
@@ -659,6 +758,22 @@ class AsyncFileObserver : public Observer {
         // reference time of 'bdlt::Datetime(1, 1, 1)' and an interval of 24
         // hours would configure a periodic rotation at midnight each day.
 
+    void setFlushInterval(const bsls::TimeInterval& flushInterval);
+        // Set the maximum time that the publication thread waits, after
+        // removing the first record of a batch from the record queue, for
+        // more records to arrive before publishing the batch, to the
+        // specified 'flushInterval'.  If 'flushInterval' is 0, a batch is
+        // published as soon as the record queue is empty.  The behavior is
+        // undefined unless 'bsls::TimeInterval() <= flushInterval'.  Note
+        // that the new value takes effect with the next batch.  See {Batched
+        // Publication}.
+
+    void setMaxBatchSize(int maxBatchSize);
+        // Set the maximum number of records that the publication thread
+        // publishes with a single write to the specified 'maxBatchSize'.  The
+        // behavior is undefined unless '0 < maxBatchSize'.  Note that the new
+        // value takes effect with the next batch.  See {Batched Publication}.
+
     void setOnFileRotationCallback(
               const FileObserver2::OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -725,6 +840,14 @@ class AsyncFileObserver : public Observer {
         // Return 'true' if the publication thread is running, and 'false'
         // otherwise.
 
+    bsls::TimeInterval flushInterval() const;
+        // Return the maximum time that the publication thread waits for a
+        // batch of records to fill before publishing it.
+
+    int maxBatchSize() const;
+        // Return the maximum number of records that the publication thread
+        // publishes with a single write.
+
     int recordQueueLength() const;
         // Return the number of log records currently in this observer's log
         // record queue.
@@ -814,6 +937,23 @@ void AsyncFileObserver::rotateOnTimeInterval(
     d_fileObserver.rotateOnTimeInterval(interval, referenceStartTime);
 }
 
+inline
+void AsyncFileObserver::setFlushInterval(
+                                       const bsls::TimeInterval& flushInterval)
+{
+    BSLS_ASSERT_SAFE(bsls::TimeInterval() <= flushInterval);
+
+    d_flushIntervalUs = flushInterval.totalMicroseconds();
+}
+
+inline
+void AsyncFileObserver::setMaxBatchSize(int maxBatchSize)
+{
+    BSLS_ASSERT_SAFE(0 < maxBatchSize);
+
+    d_maxBatchSize = maxBatchSize;
+}
+
 inline
 void AsyncFileObserver::setOnFileRotationCallback(
           const FileObserver2::OnFileRotationCallback& onRotationCallback)
@@ -878,6 +1018,20 @@ bdlt::DatetimeInterval AsyncFileObserver::rotationLifetime() const
     return d_fileObserver.rotationLifetime();
 }
 
+inline
+bsls::TimeInterval AsyncFileObserver::flushInterval() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_flushIntervalUs.loadRelaxed());
+    return result;
+}
+
+inline
+int AsyncFileObserver::maxBatchSize() const
+{
+    return d_maxBatchSize.loadRelaxed();
+}
+
 inline
 int AsyncFileObserver::recordQueueLength() const
 {
@@ -31,6 +31,7 @@
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
@@ -95,12 +96,16 @@ using bsl::flush;
 // [ 3] void forceRotation()
 // [ 3] void rotateOnSize(int size)
 // [ 3] void rotateOnTimeInterval(const bdlt::DatetimeInterval timeInterval)
+// [10] void setFlushInterval(const bsls::TimeInterval& flushInterval);
+// [10] void setMaxBatchSize(int maxBatchSize);
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold)
 // [ 1] void setLogFormat(const char*, const char*)
 // [ 1] void startPublicationThread();
 // [ 1] void stopPublicationThread();
 //
 // ACCESSORS
+// [10] bsls::TimeInterval flushInterval() const;
+// [10] int maxBatchSize() const;
 // [ 9] int recordQueueLength() const
 // [ 1] bool isFileLoggingEnabled() const
 // [ 1] bool isStdoutLoggingPrefixEnabled() const
@@ -111,7 +116,8 @@ using bsl::flush;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCERN: CONCURRENT PUBLICATION
-// [10] USAGE EXAMPLE
+// [10] CONCERN: BATCHED PUBLICATION
+// [11] USAGE EXAMPLE
 //
 //=============================================================================
 //                        STANDARD BDE ASSERT TEST MACROS
@@ -604,7 +610,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator allocator; bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -663,6 +669,189 @@ int main(int argc, char *argv[])
         asyncFileObserver.stopPublicationThread();
         removeFilesByPrefix(fileName.c_str());
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING: BATCHED PUBLICATION
+        //
+        // Concerns:
+        //:  1 The maximum batch size is 256 and the flush interval is 0 by
+        //:    default, and both can be set.
+        //:
+        //:  2 Whatever the maximum batch size, every queued record is
+        //:    published exactly once, and in order.
+        //:
+        //:  3 When a flush interval is set, a batch is not published before
+        //:    the interval has elapsed, unless it fills up or the publication
+        //:    thread is stopped.
+        //
+        // Plan:
+        //:  1 Verify the default values of 'maxBatchSize' and
+        //:    'flushInterval', set new values, and verify that the accessors
+        //:    return them.  (C-1)
+        //:
+        //:  2 For a series of maximum batch sizes, queue a sequence of records
+        //:    having distinct messages, start and then stop the publication
+        //:    thread, and verify that the messages appear in the log file
+        //:    exactly once, and in order.  (C-2)
+        //:
+        //:  3 Set a long flush interval, publish a record, and verify that it
+        //:    is not written to the log file after a short delay.  Stop the
+        //:    publication thread, and verify that the record was written
+        //:    without waiting for the flush interval to elapse.  Then set the
+        //:    maximum batch size to 1, and verify that a record is written
+        //:    before the flush interval elapses.  (C-3)
+        //
+        // Testing:
+        //   void setFlushInterval(const bsls::TimeInterval& flushInterval);
+        //   void setMaxBatchSize(int maxBatchSize);
+        //   bsls::TimeInterval flushInterval() const;
+        //   int maxBatchSize() const;
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "Testing: Batched Publication" << endl
+                 << "============================" << endl;
+
+        const int ERROR = ball::Severity::e_ERROR;
+
+        if (veryVerbose) cout << "\tTesting the batch attributes." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERTV(X.maxBatchSize(), 256 == X.maxBatchSize());
+            ASSERT(bsls::TimeInterval() == X.flushInterval());
+
+            mX.setMaxBatchSize(1);
+            ASSERT(1 == X.maxBatchSize());
+
+            mX.setMaxBatchSize(1000);
+            ASSERT(1000 == X.maxBatchSize());
+
+            mX.setFlushInterval(bsls::TimeInterval(0, 5000));
+            ASSERT(bsls::TimeInterval(0, 5000) == X.flushInterval());
+
+            mX.setFlushInterval(bsls::TimeInterval(3, 0));
+            ASSERT(bsls::TimeInterval(3, 0) == X.flushInterval());
+
+            mX.setFlushInterval(bsls::TimeInterval());
+            ASSERT(bsls::TimeInterval() == X.flushInterval());
+        }
+
+        if (veryVerbose) cout << "\tTesting the order of records." << endl;
+        {
+            static const int BATCH_SIZES[] = { 1, 2, 3, 7, 256, 5000 };
+            enum { NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES,
+                   NUM_RECORDS     = 1000 };
+
+            for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                if (veryVeryVerbose) { P(BATCH_SIZE); }
+
+                bsl::string fileName = tempFileName(veryVerbose);
+                bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+                Obj mX(ball::Severity::e_OFF, &ta);
+
+                mX.setMaxBatchSize(BATCH_SIZE);
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    bsl::ostringstream oss;
+                    oss << "message-" << i << ".";
+
+                    bsl::shared_ptr<ball::Record> record;
+                    record.createInplace(&ta, &ta);
+                    record->fixedFields().setSeverity(ERROR);
+                    record->fixedFields().setMessage(oss.str().c_str());
+
+                    mX.publish(record, ball::Context());
+                }
+
+                mX.startPublicationThread();
+                mX.stopPublicationThread();
+                mX.disableFileLogging();
+
+                LOOP_ASSERT(BATCH_SIZE,
+                            NUM_RECORDS == countLoggedRecords(fileName));
+
+                const bsl::string content = readPartialFile(fileName, 0);
+
+                bsl::string::size_type position = 0;
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    bsl::ostringstream oss;
+                    oss << "message-" << i << ".";
+
+                    position = content.find(oss.str(), position);
+                    LOOP2_ASSERT(BATCH_SIZE, i,
+                                 bsl::string::npos != position);
+                    if (bsl::string::npos == position) {
+                        break;
+                    }
+                }
+
+                removeFilesByPrefix(fileName.c_str());
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting the flush interval." << endl;
+        {
+            bsl::string fileName = tempFileName(veryVerbose);
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, &ta);
+
+            mX.setFlushInterval(bsls::TimeInterval(60, 0));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.startPublicationThread();
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ERROR);
+            record->fixedFields().setMessage("held");
+            mX.publish(record, ball::Context());
+
+            // The record is removed from the queue, but held for up to a
+            // minute.
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+            ASSERT(0 == mX.recordQueueLength());
+            ASSERT(0 == bdls::FilesystemUtil::getFileSize(fileName));
+
+            bsls::Stopwatch timer;
+            timer.start();
+            mX.stopPublicationThread();
+            ASSERTV(timer.elapsedTime(), timer.elapsedTime() < 30);
+
+            ASSERT(1 == countLoggedRecords(fileName));
+
+            // A full batch is published without waiting.
+
+            mX.setMaxBatchSize(1);
+            mX.startPublicationThread();
+
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ERROR);
+            record->fixedFields().setMessage("published");
+            mX.publish(record, ball::Context());
+
+            timer.reset();
+            timer.start();
+            while (2 != countLoggedRecords(fileName)
+                && timer.elapsedTime() < 30) {
+                bslmt::ThreadUtil::microSleep(1000, 0);
+            }
+            ASSERT(2 == countLoggedRecords(fileName));
+
+            mX.stopPublicationThread();
+            mX.disableFileLogging();
+            removeFilesByPrefix(fileName.c_str());
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING: 'recordQueueLength'
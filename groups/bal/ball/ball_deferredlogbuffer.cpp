@@ -0,0 +1,62 @@
+// ball_deferredlogbuffer.cpp                                         -*-C++-*-
+#include <ball_deferredlogbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredlogbuffer_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                          // -----------------------
+                          // class DeferredLogBuffer
+                          // -----------------------
+
+// CREATORS
+DeferredLogBuffer::DeferredLogBuffer(int               capacity,
+                                     bslma::Allocator *basicAllocator)
+: d_buffer_p(0)
+, d_capacity(16)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_writeIndex(0)
+, d_pendingIndex(0)
+, d_cachedReadIndex(0)
+, d_readIndex(0)
+, d_frontIndex(0)
+{
+    BSLS_ASSERT(16 <= capacity);
+    BSLS_ASSERT(capacity <= 1 << 30);
+
+    while (d_capacity < capacity) {
+        d_capacity <<= 1;
+    }
+    d_mask     = d_capacity - 1;
+    d_buffer_p = static_cast<char *>(
+                     d_allocator_p->allocate(static_cast<int>(d_capacity)));
+}
+
+DeferredLogBuffer::~DeferredLogBuffer()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,344 @@
+// ball_deferredlogbuffer.h                                           -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDLOGBUFFER
+#define INCLUDED_BALL_DEFERREDLOGBUFFER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free single-producer buffer of deferred log entries.
+//
+//@CLASSES:
+//  ball::DeferredLogBuffer: lock-free SPSC ring buffer of variable-size entries
+//
+//@SEE_ALSO: ball_deferredlogger
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'ball::DeferredLogBuffer', implementing a fixed-capacity ring buffer of
+// variable-size entries (i.e., blocks of raw bytes) that may be filled by one
+// thread (the "producer") while being drained by another (the "consumer"),
+// without locking.  It is the per-thread buffer in which
+// 'ball::DeferredLogger' stores the encoded arguments of deferred log records
+// (see 'ball_deferredlogger').
+//
+// The producer obtains space for an entry by calling 'allocate', writes the
+// entry, and then makes it visible to the consumer by calling 'commit'.  The
+// consumer obtains the oldest visible entry by calling 'front', and releases
+// its space by calling 'popFront'.  Neither operation blocks: 'allocate'
+// returns 0 if the buffer has insufficient free space, and 'front' returns 0
+// if the buffer has no visible entry.
+//
+// Entries are aligned on 8-byte boundaries, and are always contiguous in
+// memory: an entry that does not fit between its position and the end of the
+// ring is placed at the start of the ring, and the remaining space at the end
+// is skipped.  Each entry consumes 8 bytes of overhead, plus the padding
+// needed to round its size up to a multiple of 8.
+//
+///Thread Safety
+///-------------
+// 'allocate' and 'commit' may be called by at most one thread at a time, and
+// 'front' and 'popFront' may be called by at most one thread at a time; the
+// producer and the consumer may be different threads, and may run
+// concurrently.  The accessors may be called from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Two Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a producer thread must pass text messages to a consumer thread
+// without blocking.  First, we create a buffer of 1024 bytes:
+//..
+//  ball::DeferredLogBuffer buffer(1024);
+//  assert(1024 == buffer.capacity());
+//  assert(buffer.isEmpty());
+//..
+// Then, the producer writes a message into the buffer.  Note that the message
+// is not visible to the consumer until it is committed:
+//..
+//  const char *message = "Hello, world!";
+//  const int   length  = static_cast<int>(bsl::strlen(message));
+//
+//  void *entry = buffer.allocate(length);
+//  assert(entry);
+//  bsl::memcpy(entry, message, length);
+//
+//  int size;
+//  assert(0 == buffer.front(&size));
+//
+//  buffer.commit();
+//..
+// Finally, the consumer reads and releases the message:
+//..
+//  const void *received = buffer.front(&size);
+//  assert(received);
+//  assert(length == size);
+//  assert(0 == bsl::memcmp(received, message, length));
+//
+//  buffer.popFront();
+//  assert(buffer.isEmpty());
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace ball {
+
+                          // =======================
+                          // class DeferredLogBuffer
+                          // =======================
+
+class DeferredLogBuffer {
+    // This class implements a fixed-capacity, lock-free, single-producer,
+    // single-consumer ring buffer of variable-size entries.
+
+    // PRIVATE TYPES
+    enum {
+        k_ALIGNMENT   = 8,   // alignment (and granularity) of entries
+        k_HEADER_SIZE = 8,   // size of the header preceding each entry
+        k_PADDING     = -1,  // size recorded in the header of skipped space
+        k_CACHE_LINE  = 64   // assumed size of a cache line
+    };
+
+    // DATA
+    char               *d_buffer_p;      // ring storage (owned)
+
+    bsls::Types::Int64  d_capacity;      // size of 'd_buffer_p' (a power of
+                                         // two)
+
+    bsls::Types::Int64  d_mask;          // 'd_capacity - 1'
+
+    bslma::Allocator   *d_allocator_p;   // memory allocator (held, not owned)
+
+    char                d_pad0[k_CACHE_LINE];
+                                         // separates producer and consumer
+                                         // data
+
+    bsls::AtomicInt64   d_writeIndex;    // number of bytes committed by the
+                                         // producer
+
+    bsls::Types::Int64  d_pendingIndex;  // value of 'd_writeIndex' after the
+                                         // next 'commit' (producer only)
+
+    bsls::Types::Int64  d_cachedReadIndex;
+                                         // last value of 'd_readIndex' read
+                                         // by the producer (producer only)
+
+    char                d_pad1[k_CACHE_LINE];
+                                         // separates producer and consumer
+                                         // data
+
+    bsls::AtomicInt64   d_readIndex;     // number of bytes released by the
+                                         // consumer
+
+    bsls::Types::Int64  d_frontIndex;    // index of the header of the front
+                                         // entry (consumer only)
+
+    char                d_pad2[k_CACHE_LINE];
+                                         // separates consumer data from
+                                         // subsequent objects
+
+  private:
+    // NOT IMPLEMENTED
+    DeferredLogBuffer(const DeferredLogBuffer&);
+    DeferredLogBuffer& operator=(const DeferredLogBuffer&);
+
+    // PRIVATE CLASS METHODS
+    static int stride(int size);
+        // Return the number of bytes occupied in the ring by an entry having
+        // the specified 'size', including its header and padding.
+
+  public:
+    // CREATORS
+    explicit DeferredLogBuffer(int               capacity,
+                               bslma::Allocator *basicAllocator = 0);
+        // Create an empty buffer able to hold at least the specified
+        // 'capacity' bytes, including the overhead of its entries.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '16 <= capacity' and
+        // 'capacity <= 1 << 30'.  Note that 'capacity' is rounded up to a
+        // power of two.
+
+    ~DeferredLogBuffer();
+        // Destroy this buffer.
+
+    // MANIPULATORS
+    void *allocate(int size);
+        // Return the address of a contiguous block of the specified 'size'
+        // bytes, aligned on an 8-byte boundary, in which the producer may
+        // write the next entry of this buffer, or 0 if this buffer has
+        // insufficient free space.  The entry is not visible to the consumer
+        // until 'commit' is called.  Calling 'allocate' again before 'commit'
+        // discards the previously allocated entry.  The behavior is undefined
+        // unless '0 <= size'.
+
+    void commit();
+        // Make the entry returned by the last call to 'allocate' visible to
+        // the consumer.  The behavior is undefined unless the last call to
+        // 'allocate' since the last call to 'commit' returned a non-null
+        // address.
+
+    const void *front(int *size);
+        // Return the address of the oldest committed entry of this buffer
+        // that has not been released, and load its size into the specified
+        // 'size', or return 0 if there is no such entry.
+
+    void popFront();
+        // Release the space of the entry returned by the last call to
+        // 'front'.  The behavior is undefined unless the last call to 'front'
+        // since the last call to 'popFront' returned a non-null address.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the capacity, in bytes, of this buffer.
+
+    bool isEmpty() const;
+        // Return 'true' if this buffer has no committed entry that has not
+        // been released, and 'false' otherwise.  Note that the value returned
+        // may be out of date by the time it is used if another thread is
+        // concurrently modifying this buffer.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class DeferredLogBuffer
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+inline
+int DeferredLogBuffer::stride(int size)
+{
+    return k_HEADER_SIZE + ((size + k_ALIGNMENT - 1) & ~(k_ALIGNMENT - 1));
+}
+
+// MANIPULATORS
+inline
+void *DeferredLogBuffer::allocate(int size)
+{
+    BSLS_ASSERT_SAFE(0 <= size);
+
+    const bsls::Types::Int64 writeIndex = d_writeIndex.loadRelaxed();
+    const bsls::Types::Int64 position   = writeIndex & d_mask;
+    const bsls::Types::Int64 entrySize  = stride(size);
+    const bsls::Types::Int64 tailSpace  = d_capacity - position;
+
+    // An entry that does not fit before the end of the ring is placed at the
+    // start, so that the space at the end must also be free.
+
+    const bsls::Types::Int64 required = entrySize <= tailSpace
+                                      ? entrySize
+                                      : tailSpace + entrySize;
+
+    if (writeIndex + required - d_cachedReadIndex > d_capacity) {
+        d_cachedReadIndex = d_readIndex.loadAcquire();
+        if (writeIndex + required - d_cachedReadIndex > d_capacity) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    char *header = d_buffer_p + position;
+    if (entrySize > tailSpace) {
+        *reinterpret_cast<int *>(header) = k_PADDING;
+        header = d_buffer_p;
+    }
+    *reinterpret_cast<int *>(header) = size;
+
+    d_pendingIndex = writeIndex + required;
+    return header + k_HEADER_SIZE;
+}
+
+inline
+void DeferredLogBuffer::commit()
+{
+    d_writeIndex.storeRelease(d_pendingIndex);
+}
+
+inline
+const void *DeferredLogBuffer::front(int *size)
+{
+    BSLS_ASSERT_SAFE(size);
+
+    const bsls::Types::Int64 readIndex = d_readIndex.loadRelaxed();
+
+    if (readIndex == d_writeIndex.loadAcquire()) {
+        return 0;                                                     // RETURN
+    }
+
+    bsls::Types::Int64 frontIndex = readIndex;
+    const char *header = d_buffer_p + (frontIndex & d_mask);
+    if (k_PADDING == *reinterpret_cast<const int *>(header)) {
+        frontIndex += d_capacity - (frontIndex & d_mask);
+        header      = d_buffer_p;
+    }
+
+    d_frontIndex = frontIndex;
+    *size        = *reinterpret_cast<const int *>(header);
+    return header + k_HEADER_SIZE;
+}
+
+inline
+void DeferredLogBuffer::popFront()
+{
+    const char *header = d_buffer_p + (d_frontIndex & d_mask);
+    const int   size   = *reinterpret_cast<const int *>(header);
+
+    d_readIndex.storeRelease(d_frontIndex + stride(size));
+}
+
+// ACCESSORS
+inline
+int DeferredLogBuffer::capacity() const
+{
+    return static_cast<int>(d_capacity);
+}
+
+inline
+bool DeferredLogBuffer::isEmpty() const
+{
+    return d_readIndex.loadAcquire() == d_writeIndex.loadAcquire();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,665 @@
+// ball_deferredlogbuffer.t.cpp                                       -*-C++-*-
+#include <ball_deferredlogbuffer.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_deque.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is a lock-free ring buffer of variable-size
+// entries.  We first verify the constructor and the basic accessors, then
+// verify, against a simple model, that a long sequence of randomly sized
+// entries is stored and retrieved correctly as the buffer fills and wraps
+// around.  Finally, we verify that entries are passed intact and in order
+// between a concurrent producer thread and consumer thread.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit DeferredLogBuffer(int capacity, Allocator *ba = 0);
+// [ 2] ~DeferredLogBuffer();
+//
+// MANIPULATORS
+// [ 3] void *allocate(int size);
+// [ 3] void commit();
+// [ 3] const void *front(int *size);
+// [ 3] void popFront();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 3] bool isEmpty() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT PRODUCER AND CONSUMER
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredLogBuffer Obj;
+
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void fillEntry(void *entry, int size, unsigned int sequence)
+    // Fill the specified 'entry' of the specified 'size' with a byte pattern
+    // derived from the specified 'sequence' number.
+{
+    unsigned char *bytes = static_cast<unsigned char *>(entry);
+    for (int i = 0; i < size; ++i) {
+        bytes[i] = static_cast<unsigned char>(sequence * 31 + i);
+    }
+}
+
+bool checkEntry(const void *entry, int size, unsigned int sequence)
+    // Return 'true' if the specified 'entry' of the specified 'size' holds
+    // the byte pattern written by 'fillEntry' for the specified 'sequence'
+    // number, and 'false' otherwise.
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(entry);
+    for (int i = 0; i < size; ++i) {
+        if (bytes[i] != static_cast<unsigned char>(sequence * 31 + i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+int entrySize(unsigned int sequence)
+    // Return the size of the entry having the specified 'sequence' number in
+    // the concurrent test.
+{
+    return static_cast<int>((sequence * 7919u) % 97u);
+}
+
+struct Entry {
+    // Model of an entry in the buffer, used by the manipulator test.
+
+    unsigned int d_sequence;
+    int          d_size;
+};
+
+struct ThreadArgs {
+    // Arguments of the threads of the concurrent test.
+
+    Obj          *d_buffer_p;
+    unsigned int  d_numEntries;
+    int           d_numErrors;
+};
+
+extern "C" void *producerThread(void *arg)
+    // Write the entries of the concurrent test into the buffer specified by
+    // 'arg', spinning while the buffer is full.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+    for (unsigned int i = 0; i < args->d_numEntries; ++i) {
+        const int  size = entrySize(i);
+        void      *entry;
+        while (0 == (entry = args->d_buffer_p->allocate(size))) {
+            bslmt::ThreadUtil::yield();
+        }
+        fillEntry(entry, size, i);
+        args->d_buffer_p->commit();
+    }
+    return 0;
+}
+
+extern "C" void *consumerThread(void *arg)
+    // Read and verify the entries of the concurrent test from the buffer
+    // specified by 'arg', spinning while the buffer is empty.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+    for (unsigned int i = 0; i < args->d_numEntries; ++i) {
+        int         size;
+        const void *entry;
+        while (0 == (entry = args->d_buffer_p->front(&size))) {
+            bslmt::ThreadUtil::yield();
+        }
+        if (size != entrySize(i) || !checkEntry(entry, size, i)) {
+            ++args->d_numErrors;
+        }
+        args->d_buffer_p->popFront();
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         ta("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Two Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a producer thread must pass text messages to a consumer thread
+// without blocking.  First, we create a buffer of 1024 bytes:
+//..
+    ball::DeferredLogBuffer buffer(1024);
+    ASSERT(1024 == buffer.capacity());
+    ASSERT(buffer.isEmpty());
+//..
+// Then, the producer writes a message into the buffer.  Note that the message
+// is not visible to the consumer until it is committed:
+//..
+    const char *message = "Hello, world!";
+    const int   length  = static_cast<int>(bsl::strlen(message));
+
+    void *entry = buffer.allocate(length);
+    ASSERT(entry);
+    bsl::memcpy(entry, message, length);
+
+    int size;
+    ASSERT(0 == buffer.front(&size));
+
+    buffer.commit();
+//..
+// Finally, the consumer reads and releases the message:
+//..
+    const void *received = buffer.front(&size);
+    ASSERT(received);
+    ASSERT(length == size);
+    ASSERT(0 == bsl::memcmp(received, message, length));
+
+    buffer.popFront();
+    ASSERT(buffer.isEmpty());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PRODUCER AND CONSUMER
+        //
+        // Concerns:
+        //: 1 Entries written by one thread are read intact, and in order, by
+        //:   another thread running concurrently.
+        //:
+        //: 2 The producer observes the space released by the consumer.
+        //
+        // Plan:
+        //: 1 Using a small buffer, so that it is frequently full and empty,
+        //:   write a long sequence of entries of varying size and content from
+        //:   one thread while reading and verifying them from another.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENT PRODUCER AND CONSUMER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT PRODUCER AND CONSUMER" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const int CAPACITIES[] = { 256, 1024, 65536 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            const int CAPACITY = CAPACITIES[ti];
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            Obj mX(CAPACITY, &ta);
+
+            ThreadArgs args = { &mX, 200000, 0 };
+
+            bslmt::ThreadUtil::Handle producer, consumer;
+            ASSERT(0 == bslmt::ThreadUtil::create(&consumer,
+                                                  &consumerThread,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::create(&producer,
+                                                  &producerThread,
+                                                  &args));
+            bslmt::ThreadUtil::join(producer);
+            bslmt::ThreadUtil::join(consumer);
+
+            ASSERTV(CAPACITY, args.d_numErrors, 0 == args.d_numErrors);
+            ASSERT(mX.isEmpty());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 'allocate' returns a properly aligned block of the requested
+        //:   size while there is enough free space, and 0 otherwise.
+        //:
+        //: 2 An allocated entry is not visible until it is committed, and a
+        //:   second 'allocate' before 'commit' discards the first.
+        //:
+        //: 3 'front' returns the entries in the order they were committed,
+        //:   with their size and content intact, including entries that
+        //:   were relocated to the start of the ring.
+        //:
+        //: 4 'popFront' releases exactly the space of the front entry.
+        //:
+        //: 5 'isEmpty' reflects the committed, unreleased entries.
+        //
+        // Plan:
+        //: 1 Perform a long sequence of randomly chosen operations on buffers
+        //:   of several capacities, tracking the sizes and free space of the
+        //:   entries in a simple model, and verify each operation against the
+        //:   model.  (C-1..5)
+        //
+        // Testing:
+        //   void *allocate(int size);
+        //   void commit();
+        //   const void *front(int *size);
+        //   void popFront();
+        //   bool isEmpty() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const int CAPACITIES[] = { 16, 64, 256, 1000 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            Obj mX(CAPACITIES[ti], &ta);  const Obj& X = mX;
+
+            const int CAPACITY = X.capacity();
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            // The model tracks the sequence number and size of each entry,
+            // and the write and read positions.
+
+            bsl::deque<Entry>  model;
+            bsls::Types::Int64 writeIndex = 0;
+            bsls::Types::Int64 readIndex  = 0;
+            unsigned int       sequence   = 0;
+
+            bsl::srand(ti + 1);
+
+            for (int i = 0; i < 20000; ++i) {
+                if (bsl::rand() % 2) {
+                    const int size    = bsl::rand() % (CAPACITY / 2);
+                    const int stride  = 8 + ((size + 7) & ~7);
+                    const int tail    = CAPACITY
+                                      - static_cast<int>(writeIndex
+                                                               % CAPACITY);
+                    const int needed  = stride <= tail ? stride
+                                                       : tail + stride;
+                    const bool FITS   = writeIndex + needed - readIndex
+                                                                 <= CAPACITY;
+
+                    void *entry = mX.allocate(size);
+
+                    ASSERTV(CAPACITY, i, size, FITS, FITS == (0 != entry));
+                    if (!entry) {
+                        continue;
+                    }
+
+                    ASSERTV(0 == (reinterpret_cast<bsls::Types::UintPtr>(
+                                                                entry) & 7));
+
+                    fillEntry(entry, size, sequence);
+
+                    // Occasionally abandon the entry and reallocate it.
+
+                    if (0 == bsl::rand() % 8) {
+                        ASSERT(entry == mX.allocate(size));
+                    }
+
+                    int frontSize;
+                    if (model.empty()) {
+                        ASSERT(0 == mX.front(&frontSize));
+                        ASSERT(X.isEmpty());
+                    }
+
+                    mX.commit();
+                    ASSERT(!X.isEmpty());
+
+                    Entry e = { sequence++, size };
+                    model.push_back(e);
+                    writeIndex += needed;
+                }
+                else {
+                    int         size;
+                    const void *entry = mX.front(&size);
+
+                    ASSERTV(CAPACITY, i, model.empty() == (0 == entry));
+                    if (!entry) {
+                        ASSERT(X.isEmpty());
+                        continue;
+                    }
+
+                    const Entry& e = model.front();
+                    ASSERTV(CAPACITY, i, e.d_size, size, e.d_size == size);
+                    ASSERTV(CAPACITY, i,
+                            checkEntry(entry, size, e.d_sequence));
+
+                    mX.popFront();
+
+                    // Recompute the read position: skip the tail if the
+                    // entry was relocated to the start of the ring.
+
+                    const int stride = 8 + ((size + 7) & ~7);
+                    const int tail   = CAPACITY
+                                     - static_cast<int>(readIndex % CAPACITY);
+                    readIndex += stride <= tail ? stride : tail + stride;
+
+                    model.pop_front();
+                    ASSERT(model.empty() == X.isEmpty());
+                }
+            }
+
+            // Drain the buffer.
+
+            int size;
+            while (!model.empty()) {
+                const void *entry = mX.front(&size);
+                ASSERT(entry);
+                ASSERT(model.front().d_size == size);
+                ASSERT(checkEntry(entry, size, model.front().d_sequence));
+                mX.popFront();
+                model.pop_front();
+            }
+            ASSERT(X.isEmpty());
+            ASSERT(0 == mX.front(&size));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two.
+        //:
+        //: 2 A newly created buffer is empty.
+        //:
+        //: 3 Memory is supplied by the specified allocator, or the default
+        //:   allocator if none is specified, and is released on destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create buffers of various capacities, with and without an
+        //:   allocator, and verify their capacity, emptiness, and memory use.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid capacities.  (C-4)
+        //
+        // Testing:
+        //   explicit DeferredLogBuffer(int capacity, Allocator *ba = 0);
+        //   ~DeferredLogBuffer();
+        //   int capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_capacity;
+            int d_expected;
+        } DATA[] = {
+            { L_,        16,        16 },
+            { L_,        17,        32 },
+            { L_,        31,        32 },
+            { L_,        32,        32 },
+            { L_,      1000,      1024 },
+            { L_,     65536,     65536 },
+            { L_,     65537,    131072 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int CAPACITY = DATA[ti].d_capacity;
+            const int EXPECTED = DATA[ti].d_expected;
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+                ASSERTV(LINE, EXPECTED == X.capacity());
+                ASSERTV(LINE, X.isEmpty());
+                ASSERTV(LINE, 1 == ta.numBlocksInUse());
+                ASSERTV(LINE, EXPECTED == ta.numBytesInUse());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+
+            {
+                Obj mX(CAPACITY);  const Obj& X = mX;
+                ASSERTV(LINE, EXPECTED == X.capacity());
+                ASSERTV(LINE, 1 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(15));
+            ASSERT_PASS(Obj(16));
+            ASSERT_FAIL(Obj((1 << 30) + 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write, wrap around, and read back a few entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(64, &ta);  const Obj& X = mX;
+        ASSERT(64 == X.capacity());
+        ASSERT(X.isEmpty());
+
+        // Two 16-byte entries occupy 48 bytes.
+
+        void *a = mX.allocate(16);  ASSERT(a);  fillEntry(a, 16, 1);
+        mX.commit();
+        void *b = mX.allocate(13);  ASSERT(b);  fillEntry(b, 13, 2);
+        mX.commit();
+        ASSERT(0 == mX.allocate(16));
+
+        int         size;
+        const void *entry = mX.front(&size);
+        ASSERT(a == entry);
+        ASSERT(16 == size);
+        ASSERT(checkEntry(entry, size, 1));
+        mX.popFront();
+
+        // The next entry does not fit in the 16 bytes at the end of the ring,
+        // and is placed at its start.
+
+        void *c = mX.allocate(9);  ASSERT(c);  fillEntry(c, 9, 3);
+        ASSERT(c == a);
+        mX.commit();
+
+        entry = mX.front(&size);
+        ASSERT(b == entry);
+        ASSERT(13 == size);
+        ASSERT(checkEntry(entry, size, 2));
+        mX.popFront();
+
+        entry = mX.front(&size);
+        ASSERT(c == entry);
+        ASSERT(9 == size);
+        ASSERT(checkEntry(entry, size, 3));
+        mX.popFront();
+
+        ASSERT(X.isEmpty());
+        ASSERT(0 == mX.front(&size));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,819 @@
+// ball_deferredlogger.cpp                                            -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredlogger_cpp,"$Id$ $CSID$")
+
+#include <ball_category.h>
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_testobserver.h>                              // for testing only
+#include <ball_transmission.h>
+
+#include <bdlf_memfn.h>
+#include <bdls_processutil.h>
+#include <bdlt_epochutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_memory.h>
+
+#include <stdio.h>  // *NOT* <bsl_cstdio.h>, which does not declare 'snprintf'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+// IMPLEMENTATION NOTE: The buffers of the logging threads are registered in
+// 'd_buffers', and referred to by a thread-specific key whose destructor marks
+// the buffer of an exiting thread as detached.  Only the publication thread
+// (or 'stop', once the publication thread has been joined) removes and
+// destroys buffers, and it only does so once a buffer is both detached and
+// empty, so the pointers it copies into 'd_snapshot' remain valid while it
+// drains them without holding 'd_buffersLock'.
+//
+// A thread logging a deferred record sets the 'd_isWriting' flag of its
+// writer state before checking (again) which deferred logger is started, and
+// clears it once it no longer accesses that logger.  The writer states of all
+// threads are registered in a process-wide registry, independent of any
+// deferred logger, so that 'stop', having cleared 's_started_p', can wait
+// until no thread is writing: no entry is committed to a stopped logger, and
+// no thread accesses a stopped logger, which may then be destroyed.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+const char *parseNumber(const char *spec)
+    // Return the address of the first character of the specified 'spec' that
+    // is not a decimal digit.
+{
+    while ('0' <= *spec && *spec <= '9') {
+        ++spec;
+    }
+    return spec;
+}
+
+struct WriterStateRegistry {
+    // This 'struct' records the writer states of all the threads that have
+    // logged deferred records, and not yet exited.
+
+    // DATA
+    bslmt::Mutex                              d_mutex;   // protects
+                                                         // 'd_states'
+
+    bsl::vector<DeferredLogger_WriterState *> d_states;  // registered states
+                                                         // (owned)
+
+    // CREATORS
+    explicit WriterStateRegistry(bslma::Allocator *basicAllocator)
+    : d_states(basicAllocator)
+    {
+    }
+};
+
+WriterStateRegistry& writerStateRegistry()
+    // Return a reference to the registry of the writer states of all threads.
+{
+    static bsls::ObjectBuffer<WriterStateRegistry> registry;
+    BSLMT_ONCE_DO {
+        // Threads may exit during program termination: the registry is never
+        // destroyed, and its memory is not supplied by the default allocator.
+
+        new (registry.buffer()) WriterStateRegistry(
+                                      &bslma::NewDeleteAllocator::singleton());
+    }
+    return registry.object();
+}
+
+class MessageFormatter {
+    // This class formats a deferred log message by applying a 'printf'-style
+    // format to a sequence of encoded arguments, writing the result to a
+    // stream buffer.
+
+    // PRIVATE TYPES
+    enum { k_SPEC_SIZE = 64, k_OUTPUT_SIZE = 512 };
+
+    // DATA
+    bsl::streambuf *d_stream_p;        // output (held, not owned)
+    const char     *d_arguments_p;     // next encoded argument
+    int             d_numArguments;    // number of arguments not yet used
+
+    // PRIVATE MANIPULATORS
+    bool nextArgument(DeferredLogger_Arg *argument);
+        // Load the next argument into the specified 'argument' and return
+        // 'true', or return 'false' if all arguments have been used.
+
+    template <class TYPE>
+    void print(const char *spec, TYPE value);
+        // Write to the output the specified 'value' formatted according to
+        // the specified 'printf' conversion 'spec'.
+
+  public:
+    // CREATORS
+    MessageFormatter(bsl::streambuf *stream,
+                     const char     *arguments,
+                     int             numArguments);
+        // Create a formatter writing to the specified 'stream' and using the
+        // specified 'numArguments' encoded 'arguments'.
+
+    // MANIPULATORS
+    void format(const char *format);
+        // Write to the output the message produced by the specified 'format'.
+};
+
+                           // ----------------------
+                           // class MessageFormatter
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+bool MessageFormatter::nextArgument(DeferredLogger_Arg *argument)
+{
+    if (0 == d_numArguments) {
+        return false;                                                 // RETURN
+    }
+    --d_numArguments;
+    *argument = DeferredLogger_Arg::decode(&d_arguments_p);
+    return true;
+}
+
+template <class TYPE>
+void MessageFormatter::print(const char *spec, TYPE value)
+{
+    char      output[k_OUTPUT_SIZE];
+    const int length = snprintf(output, sizeof output, spec, value);
+
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+    if (length < static_cast<int>(sizeof output)) {
+        d_stream_p->sputn(output, length);
+        return;                                                       // RETURN
+    }
+
+    // The output was truncated (e.g., by a large field width): format it
+    // again into a sufficiently large buffer.
+
+    bsl::vector<char> largeOutput(length + 1);
+    snprintf(&largeOutput[0], largeOutput.size(), spec, value);
+    d_stream_p->sputn(&largeOutput[0], length);
+}
+
+// CREATORS
+MessageFormatter::MessageFormatter(bsl::streambuf *stream,
+                                   const char     *arguments,
+                                   int             numArguments)
+: d_stream_p(stream)
+, d_arguments_p(arguments)
+, d_numArguments(numArguments)
+{
+}
+
+// MANIPULATORS
+void MessageFormatter::format(const char *format)
+{
+    const char *p = format;
+
+    while (*p) {
+        if ('%' != *p) {
+            const char *end = p;
+            while (*end && '%' != *end) {
+                ++end;
+            }
+            d_stream_p->sputn(p, end - p);
+            p = end;
+            continue;
+        }
+
+        const char *specBegin = p++;
+
+        if ('%' == *p) {
+            d_stream_p->sputc('%');
+            ++p;
+            continue;
+        }
+
+        // Rebuild the conversion specification, substituting the values of
+        // '*' widths and precisions, and dropping any length modifier.
+
+        char spec[k_SPEC_SIZE];
+        int  specLength = 0;
+        bool missing    = false;
+
+        spec[specLength++] = '%';
+        while (*p && bsl::strchr("-+ #0", *p)
+            && specLength < k_SPEC_SIZE - 32) {
+            spec[specLength++] = *p++;
+        }
+
+        for (int part = 0; part < 2; ++part) {
+            if (1 == part) {
+                if ('.' != *p) {
+                    break;
+                }
+                spec[specLength++] = *p++;
+            }
+            if ('*' == *p) {
+                ++p;
+                DeferredLogger_Arg argument;
+                if (!nextArgument(&argument)) {
+                    missing = true;
+                    continue;
+                }
+                const int value = DeferredLogger_Arg::e_DOUBLE
+                                                             == argument.d_tag
+                                ? static_cast<int>(argument.d_value.d_double)
+                                : static_cast<int>(argument.d_value.d_int64);
+                if (1 == part && value < 0) {
+                    --specLength;  // A negative precision is ignored.
+                    continue;
+                }
+                specLength += snprintf(spec + specLength, 12, "%d", value);
+            }
+            else {
+                const char *end = parseNumber(p);
+                if (end - p > 9) {
+                    end = p + 9;
+                }
+                bsl::memcpy(spec + specLength, p, end - p);
+                specLength += static_cast<int>(end - p);
+                p = parseNumber(end);
+            }
+        }
+
+        while (*p && bsl::strchr("hlLqjzt", *p)) {
+            ++p;
+        }
+
+        const char conversion = *p;
+        if (!conversion) {
+            d_stream_p->sputn(specBegin, p - specBegin);
+            break;
+        }
+        ++p;
+
+        if (!bsl::strchr("diouxXcseEfFgGaApn", conversion)) {
+            d_stream_p->sputn(specBegin, p - specBegin);
+            continue;
+        }
+
+        DeferredLogger_Arg argument;
+        if (missing || !nextArgument(&argument)) {
+            d_stream_p->sputn(specBegin, p - specBegin);
+            continue;
+        }
+
+        if ('n' == conversion) {
+            continue;
+        }
+
+        // Choose the conversion applied to the canonical type of the
+        // argument: the requested conversion if it is compatible with that
+        // type, and a default conversion for that type otherwise.
+
+        const char *modifier = "";
+        char        applied  = conversion;
+
+        switch (argument.d_tag) {
+          case DeferredLogger_Arg::e_INT64:
+          case DeferredLogger_Arg::e_UINT64: {
+            if (bsl::strchr("eEfFgGaA", conversion)) {
+                const DeferredLogger_Arg::Value& v = argument.d_value;
+                const double value =
+                                 DeferredLogger_Arg::e_INT64 == argument.d_tag
+                                 ? static_cast<double>(v.d_int64)
+                                 : static_cast<double>(v.d_uint64);
+                argument.d_tag            = DeferredLogger_Arg::e_DOUBLE;
+                argument.d_value.d_double = value;
+            }
+            else if ('c' != conversion) {
+                modifier = "ll";
+                if ('s' == conversion || 'p' == conversion) {
+                    applied = DeferredLogger_Arg::e_INT64 == argument.d_tag
+                              ? 'd'
+                              : 'u';
+                }
+            }
+          } break;
+          case DeferredLogger_Arg::e_DOUBLE: {
+            if (!bsl::strchr("eEfFgGaA", conversion)) {
+                applied = 'g';
+            }
+          } break;
+          case DeferredLogger_Arg::e_STRING: {
+            applied = 's';
+          } break;
+          case DeferredLogger_Arg::e_POINTER: {
+            applied = 'p';
+          } break;
+        }
+
+        if ('s' == applied && 1 == specLength) {
+            // Unadorned '%s': copy the string directly.
+
+            d_stream_p->sputn(argument.d_value.d_string_p, argument.d_length);
+            continue;
+        }
+
+        const bsl::size_t modifierLength = bsl::strlen(modifier);
+        bsl::memcpy(spec + specLength, modifier, modifierLength);
+        specLength += static_cast<int>(modifierLength);
+        spec[specLength++] = applied;
+        spec[specLength]   = '\0';
+
+        switch (argument.d_tag) {
+          case DeferredLogger_Arg::e_INT64: {
+            if ('c' == applied) {
+                print(spec, static_cast<int>(argument.d_value.d_int64));
+            }
+            else {
+                print(spec, argument.d_value.d_int64);
+            }
+          } break;
+          case DeferredLogger_Arg::e_UINT64: {
+            if ('c' == applied) {
+                print(spec, static_cast<int>(argument.d_value.d_uint64));
+            }
+            else {
+                print(spec, argument.d_value.d_uint64);
+            }
+          } break;
+          case DeferredLogger_Arg::e_DOUBLE: {
+            print(spec, argument.d_value.d_double);
+          } break;
+          case DeferredLogger_Arg::e_STRING: {
+            print(spec, argument.d_value.d_string_p);
+          } break;
+          case DeferredLogger_Arg::e_POINTER: {
+            print(spec, argument.d_value.d_pointer_p);
+          } break;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+                         // -------------------------
+                         // struct DeferredLogger_Arg
+                         // -------------------------
+
+// CLASS METHODS
+DeferredLogger_Arg DeferredLogger_Arg::decode(const char **buffer)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(*buffer);
+
+    const int *word = reinterpret_cast<const int *>(*buffer);
+
+    DeferredLogger_Arg result;
+    result.d_tag    = word[0];
+    result.d_length = word[1];
+    *buffer += k_WORD_SIZE;
+
+    if (e_STRING == result.d_tag) {
+        result.d_value.d_string_p = *buffer;
+        *buffer += (result.d_length + k_WORD_SIZE) & ~(k_WORD_SIZE - 1);
+    }
+    else {
+        bsl::memcpy(&result.d_value, *buffer, k_WORD_SIZE);
+        *buffer += k_WORD_SIZE;
+    }
+    return result;
+}
+
+                        // ---------------------------
+                        // class DeferredLogger_Writer
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+void DeferredLogger_Writer::allocateLocalEntry(int size)
+{
+    if (size <= k_LOCAL_BUFFER_SIZE) {
+        d_entry_p = d_local.buffer();
+    }
+    else {
+        d_heap_p  = static_cast<char *>(
+                          bslma::Default::defaultAllocator()->allocate(size));
+        d_entry_p = d_heap_p;
+    }
+}
+
+void DeferredLogger_Writer::logSynchronously()
+{
+    const DeferredLogger_EntryHeader& header =
+              *reinterpret_cast<const DeferredLogger_EntryHeader *>(d_entry_p);
+
+    Record *record = Log::getRecord(header.d_category_p,
+                                    header.d_format_p->d_file_p,
+                                    header.d_format_p->d_line);
+
+    DeferredLogger::formatMessage(&record->fixedFields().messageStreamBuf(),
+                                  header.d_format_p->d_format_p,
+                                  arguments(),
+                                  header.d_numArguments);
+
+    Log::logMessage(header.d_category_p, header.d_severity, record);
+}
+
+                     // ----------------------------------
+                     // struct DeferredLogger_ThreadBuffer
+                     // ----------------------------------
+
+// CREATORS
+DeferredLogger_ThreadBuffer::DeferredLogger_ThreadBuffer(
+                                                  int               capacity,
+                                                  bslma::Allocator *allocator)
+: d_buffer(capacity, allocator)
+, d_threadId(bslmt::ThreadUtil::selfIdAsUint64())
+, d_isDetached(0)
+{
+}
+
+                           // --------------------
+                           // class DeferredLogger
+                           // --------------------
+
+// CLASS DATA
+bsls::AtomicPointer<DeferredLogger> DeferredLogger::s_started_p(0);
+bslmt::ThreadUtil::Key              DeferredLogger::s_writerStateKey;
+
+// PRIVATE CLASS METHODS
+DeferredLogger_WriterState *DeferredLogger::createWriterState()
+{
+    DeferredLogger_WriterState *state =
+                      new (bslma::NewDeleteAllocator::singleton())
+                                                 DeferredLogger_WriterState();
+
+    WriterStateRegistry& registry = writerStateRegistry();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&registry.d_mutex);
+        registry.d_states.push_back(state);
+    }
+    bslmt::ThreadUtil::setSpecific(s_writerStateKey, state);
+    return state;
+}
+
+void DeferredLogger::detachThreadBuffer(void *buffer)
+{
+    if (buffer) {
+        static_cast<ThreadBuffer *>(buffer)->d_isDetached.storeRelease(1);
+    }
+}
+
+void DeferredLogger::releaseWriterState(void *state)
+{
+    if (!state) {
+        return;                                                       // RETURN
+    }
+
+    WriterStateRegistry& registry = writerStateRegistry();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&registry.d_mutex);
+
+        bsl::vector<DeferredLogger_WriterState *>& states = registry.d_states;
+        states.erase(bsl::remove(states.begin(),
+                                 states.end(),
+                                 static_cast<DeferredLogger_WriterState *>(
+                                                                      state)),
+                     states.end());
+    }
+    bslma::NewDeleteAllocator::singleton().deleteObject(
+                             static_cast<DeferredLogger_WriterState *>(state));
+}
+
+void DeferredLogger::waitForWriters()
+{
+    WriterStateRegistry& registry = writerStateRegistry();
+
+    // Note that a writer may be blocked in 'signalPublicationThread', while
+    // the publication thread checks the registry in 'isIdle': the registry is
+    // not locked while yielding.
+
+    for (;;) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&registry.d_mutex);
+
+            bsl::size_t i = 0;
+            while (i < registry.d_states.size()
+                && !registry.d_states[i]->d_isWriting) {
+                ++i;
+            }
+            if (i == registry.d_states.size()) {
+                return;                                               // RETURN
+            }
+        }
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+// PRIVATE MANIPULATORS
+DeferredLogBuffer *DeferredLogger::createThreadBuffer()
+{
+    ThreadBuffer *buffer = new (*d_allocator_p) ThreadBuffer(d_bufferSize,
+                                                             d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+        d_buffers.push_back(buffer);
+    }
+    bslmt::ThreadUtil::setSpecific(d_key, buffer);
+    return &buffer->d_buffer;
+}
+
+int DeferredLogger::drain()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+        d_snapshot = d_buffers;
+    }
+
+    int numPublished = 0;
+    int numRemoved   = 0;
+
+    for (bsl::size_t i = 0; i < d_snapshot.size(); ++i) {
+        ThreadBuffer *buffer = d_snapshot[i];
+
+        // Read the detached flag before draining, so that every entry
+        // committed by an exited thread is drained before its buffer is
+        // removed.
+
+        const bool isDetached = buffer->d_isDetached.loadAcquire();
+
+        int         size;
+        const void *entry;
+        for (int n = 0; n < k_MAX_BATCH_SIZE
+                     && 0 != (entry = buffer->d_buffer.front(&size)); ++n) {
+            publishEntry(static_cast<const char *>(entry), buffer->d_threadId);
+            buffer->d_buffer.popFront();
+            ++numPublished;
+        }
+
+        if (isDetached && buffer->d_buffer.isEmpty()) {
+            d_snapshot[i] = 0;
+            ++numRemoved;
+        }
+    }
+
+    if (numRemoved) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+        for (bsl::size_t i = 0; i < d_snapshot.size(); ++i) {
+            if (0 == d_snapshot[i]) {
+                ThreadBuffer *buffer = d_buffers[i];
+                d_buffers[i] = 0;
+                buffer->~ThreadBuffer();
+                d_allocator_p->deallocate(buffer);
+            }
+        }
+        d_buffers.erase(bsl::remove(d_buffers.begin(),
+                                    d_buffers.end(),
+                                    static_cast<ThreadBuffer *>(0)),
+                        d_buffers.end());
+    }
+
+    return numPublished;
+}
+
+bool DeferredLogger::isIdle()
+{
+    {
+        WriterStateRegistry&           registry = writerStateRegistry();
+        bslmt::LockGuard<bslmt::Mutex> guard(&registry.d_mutex);
+
+        for (bsl::size_t i = 0; i < registry.d_states.size(); ++i) {
+            if (registry.d_states[i]->d_isWriting) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+
+    for (bsl::size_t i = 0; i < d_buffers.size(); ++i) {
+        if (!d_buffers[i]->d_buffer.isEmpty()) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void DeferredLogger::publicationThreadEntryPoint()
+{
+    while (!d_stopFlag.loadAcquire()) {
+        if (0 != drain()) {
+            continue;
+        }
+
+        // Wait for an entry to be committed.  The flag is set (with
+        // sequential consistency) before checking whether a thread is
+        // writing, and a writer reads it (with sequential consistency) after
+        // committing its entry, and before it stops writing, so that either
+        // this thread sees the entry or the writer, or the writer sees the
+        // flag and signals the condition.  A writer that has not yet
+        // committed its entry is waited for by yielding.
+
+        bool isWriterActive = false;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+
+            d_waitingFlag = 1;
+
+            if (isIdle()) {
+                if (!d_stopFlag.loadAcquire()) {
+                    d_waitCondition.wait(&d_waitMutex);
+                }
+            }
+            else {
+                isWriterActive = true;
+            }
+
+            d_waitingFlag = 0;
+        }
+
+        if (isWriterActive) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    while (0 != drain()) {
+    }
+}
+
+void DeferredLogger::publishEntry(const char          *entry,
+                                  bsls::Types::Uint64  threadId)
+{
+    const DeferredLogger_EntryHeader& header =
+                  *reinterpret_cast<const DeferredLogger_EntryHeader *>(entry);
+
+    bsl::shared_ptr<Record> record;
+    record.createInplace(d_allocator_p, d_allocator_p);
+
+    RecordAttributes& attributes = record->fixedFields();
+    attributes.setTimestamp(bdlt::EpochUtil::convertFromTimeInterval(
+                  bsls::TimeInterval(header.d_seconds, header.d_nanoseconds)));
+    attributes.setProcessID(d_processId);
+    attributes.setThreadID(threadId);
+    attributes.setFileName(header.d_format_p->d_file_p);
+    attributes.setLineNumber(header.d_format_p->d_line);
+    attributes.setCategory(header.d_category_p
+                           ? header.d_category_p->categoryName()
+                           : "");
+    attributes.setSeverity(header.d_severity);
+
+    formatMessage(&attributes.messageStreamBuf(),
+                  header.d_format_p->d_format_p,
+                  entry + sizeof(DeferredLogger_EntryHeader),
+                  header.d_numArguments);
+
+    d_observer_p->publish(record, Context(Transmission::e_PASSTHROUGH, 0, 1));
+    d_numPublished.addRelaxed(1);
+}
+
+void DeferredLogger::signalPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+    d_waitCondition.signal();
+}
+
+// CLASS METHODS
+void DeferredLogger::formatMessage(bsl::streambuf *stream,
+                                   const char     *format,
+                                   const char     *arguments,
+                                   int             numArguments)
+{
+    BSLS_ASSERT(stream);
+    BSLS_ASSERT(format);
+    BSLS_ASSERT(arguments || 0 == numArguments);
+    BSLS_ASSERT(0 <= numArguments);
+
+    MessageFormatter(stream, arguments, numArguments).format(format);
+}
+
+// CREATORS
+DeferredLogger::DeferredLogger(Observer         *observer,
+                               int               bufferSize,
+                               bslma::Allocator *basicAllocator)
+: d_observer_p(observer)
+, d_bufferSize(bufferSize)
+, d_buffers(basicAllocator)
+, d_snapshot(basicAllocator)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_stopFlag(0)
+, d_waitingFlag(0)
+, d_numDropped(0)
+, d_numPublished(0)
+, d_processId(bdls::ProcessUtil::getProcessId())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(64 <= bufferSize);
+    BSLS_ASSERT(bufferSize <= 1 << 30);
+
+    d_publicationThreadEntryPoint = bsl::function<void()>(
+          bsl::allocator_arg_t(),
+          bsl::allocator<bsl::function<void()> >(d_allocator_p),
+          bdlf::MemFnUtil::memFn(&DeferredLogger::publicationThreadEntryPoint,
+                                 this));
+
+    BSLMT_ONCE_DO {
+        int rc = bslmt::ThreadUtil::createKey(
+                                        &s_writerStateKey,
+                                        &DeferredLogger::releaseWriterState);
+        BSLS_ASSERT_OPT(0 == rc);
+        (void)rc;
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(&d_key,
+                                          &DeferredLogger::detachThreadBuffer);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+}
+
+DeferredLogger::~DeferredLogger()
+{
+    stop();
+
+    bslmt::ThreadUtil::deleteKey(d_key);
+
+    for (bsl::size_t i = 0; i < d_buffers.size(); ++i) {
+        d_buffers[i]->~ThreadBuffer();
+        d_allocator_p->deallocate(d_buffers[i]);
+    }
+}
+
+// MANIPULATORS
+int DeferredLogger::start()
+{
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    if (0 != s_started_p.testAndSwap(0, this)) {
+        return 1;                                                     // RETURN
+    }
+
+    d_stopFlag.storeRelease(0);
+
+    bslmt::ThreadAttributes attributes;
+    if (0 != bslmt::ThreadUtil::createWithAllocator(
+                                                &d_threadHandle,
+                                                attributes,
+                                                d_publicationThreadEntryPoint,
+                                                d_allocator_p)) {
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+        s_started_p.storeRelease(0);
+        return 2;                                                     // RETURN
+    }
+    return 0;
+}
+
+void DeferredLogger::stop()
+{
+    if (!isStarted()) {
+        return;                                                       // RETURN
+    }
+
+    // Clear the started logger (with sequential consistency) before waiting
+    // for the threads that may still be writing to this logger: see the
+    // constructor of 'DeferredLogger_Writer'.
+
+    s_started_p = 0;
+    waitForWriters();
+
+    d_stopFlag.storeRelease(1);
+    signalPublicationThread();
+    bslmt::ThreadUtil::join(d_threadHandle);
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#undef snprintf
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
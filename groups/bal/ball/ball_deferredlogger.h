@@ -0,0 +1,1683 @@
+// ball_deferredlogger.h                                              -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDLOGGER
+#define INCLUDED_BALL_DEFERREDLOGGER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide logging macros that defer formatting to another thread.
+//
+//@CLASSES:
+//  ball::DeferredLogger: consumer that formats and publishes deferred records
+//  ball::DeferredLogFormat: static description of a deferred logging statement
+//
+//@MACROS:
+//  BALL_LOGDEFER0: log a message with no arguments, deferring its formatting
+//  BALL_LOGDEFER1: log a 'printf'-style message with one argument, deferred
+//  BALL_LOGDEFER9: log a 'printf'-style message with nine arguments, deferred
+//
+//@SEE_ALSO: ball_log, ball_deferredlogbuffer, ball_observer
+//
+//@DESCRIPTION: This component provides a family of macros,
+// 'BALL_LOGDEFER0' through 'BALL_LOGDEFER9', that log 'printf'-style messages
+// like the 'BALL_LOG0' through 'BALL_LOG9' macros of 'ball_log', but that
+// defer the formatting of the message, the creation of the log record, and its
+// publication to a background thread owned by a 'ball::DeferredLogger'
+// object.  The logging thread only copies the raw bytes of the arguments,
+// together with the address of a statically-initialized description of the
+// logging statement (a 'ball::DeferredLogFormat' holding the format string,
+// file name, and line number), into a lock-free buffer private to that thread
+// (see 'ball_deferredlogbuffer').  The cost of a deferred logging statement
+// for the logging thread is therefore a few tens of nanoseconds, independent
+// of the complexity of the format, rather than the microseconds taken to
+// format a message and pass a record through the logger manager.
+//
+// The 'ball::DeferredLogger' object owns a publication thread that repeatedly
+// drains the buffers of all logging threads, formats each deferred entry into
+// a 'ball::Record', and publishes the record to the 'ball::Observer' supplied
+// at construction -- typically the observer registered with the
+// 'ball::LoggerManager' singleton.  A deferred logger takes effect once
+// 'start' is called, and at most one deferred logger may be started at a time.
+// When no deferred logger is started, the 'BALL_LOGDEFER*' macros format and
+// log their message synchronously, exactly as the corresponding 'BALL_LOG*'
+// macros would.
+//
+///Deferred Arguments
+///------------------
+// Each argument of a deferred logging statement is converted, at the point of
+// logging, to one of a small number of canonical types that are copied into
+// the buffer: signed and unsigned 64-bit integers, 'double', pointers, and
+// strings.  Arguments of any fundamental arithmetic type, pointers, 'const
+// char *' (null-terminated strings), 'bsl::string', 'native_std::string', and
+// 'bslstl::StringRef' are supported; the characters of string arguments are
+// copied, so string arguments need not outlive the logging statement.  Note
+// that, because a 'char *' or 'const char *' argument is always copied as a
+// string, a pointer to a character must be cast to 'const void *' to be logged
+// with '%p'.
+//
+// The format string itself is *not* copied: it must be a string literal (or
+// otherwise have static storage duration).  It supports the 'printf'
+// conversion specifications (including flags, field width, precision, and
+// '*'), and each conversion is applied to the canonical value of the
+// corresponding argument, so that length modifiers such as 'l' and 'll' are
+// accepted but unnecessary.  An argument whose canonical type does not match
+// its conversion is formatted sensibly rather than causing undefined behavior
+// (e.g., a string argument formatted with '%d' is output as a string), and a
+// conversion specification for which no argument was supplied is output
+// verbatim.
+//
+///Ordering, Capacity, and Lifetime
+///--------------------------------
+// Records logged by a given thread are published in the order they were
+// logged.  Records logged by different threads are published in batches, and
+// are not necessarily published in timestamp order.  The timestamp of each
+// deferred record is the time at which it was logged, not the time at which it
+// was published.
+//
+// Each logging thread is allocated a buffer of the capacity supplied at
+// construction of the deferred logger the first time it logs a deferred
+// record.  If that buffer is full, because the thread logs records faster than
+// the publication thread can publish them, the record is dropped; the number
+// of dropped records is reported by 'numRecordsDropped'.  The buffer of a
+// thread is released once the thread has exited and its records have been
+// published.
+//
+// Deferred records are published directly to the observer, bypassing the
+// record buffer and trigger processing of the 'ball::LoggerManager' (i.e.,
+// they are treated as if only the "pass" threshold of their category applied),
+// and have no user fields.  The category of a deferred record is referred to
+// by address until the record is published, so categories must not be
+// destroyed (i.e., the logger manager singleton must not be destroyed) while
+// a deferred logger is started.  A record logged concurrently with a call to
+// 'stop' is either published by the deferred logger before 'stop' returns, or
+// logged synchronously: 'stop' waits for the threads writing a deferred record
+// to commit it.  A started deferred logger may therefore be destroyed while
+// other threads are logging, but the behavior is undefined if it is destroyed
+// while a thread that logged deferred records to it is exiting.
+//
+///Thread Safety
+///-------------
+// The 'BALL_LOGDEFER*' macros are thread-safe.  The 'start' and 'stop'
+// methods of 'ball::DeferredLogger' must not be called concurrently with each
+// other; the accessors are thread-safe.  The observer supplied to a deferred
+// logger is invoked from its publication thread, and must be thread-safe if
+// it is also used by other threads (e.g., by the logger manager).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging From a Latency-Sensitive Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-sensitive application must log every order it processes,
+// but cannot afford to format a message on its critical path.  First, we
+// initialize the logger manager with an observer, as usual (here we use a
+// 'ball::TestObserver' so that we can inspect the published records):
+//..
+//  ball::TestObserver observer(bsl::cout);
+//
+//  ball::LoggerManagerConfiguration configuration;
+//  configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_TRACE,
+//                                                 ball::Severity::e_TRACE,
+//                                                 ball::Severity::e_OFF,
+//                                                 ball::Severity::e_OFF);
+//
+//  ball::LoggerManagerScopedGuard guard(&observer, configuration);
+//..
+// Then, we create a deferred logger that publishes to the same observer, with
+// a buffer of 64 KB per logging thread, and start it:
+//..
+//  ball::DeferredLogger deferredLogger(&observer, 65536);
+//  int rc = deferredLogger.start();
+//  assert(0 == rc);
+//..
+// Next, we define a function that processes an order and logs it using
+// 'BALL_LOGDEFER3' in place of 'BALL_LOG3':
+//..
+//  void processOrder(const char *symbol, int quantity, double price)
+//  {
+//      BALL_LOG_SET_CATEGORY("ORDERS");
+//
+//      // ...
+//
+//      BALL_LOGDEFER3(ball::Severity::e_INFO,
+//                     "order: %s %d @ %.2f",
+//                     symbol,
+//                     quantity,
+//                     price);
+//  }
+//..
+// Now, we process an order.  The message has not necessarily been published
+// when 'processOrder' returns:
+//..
+//  processOrder("IBM", 100, 145.5);
+//..
+// Finally, we stop the deferred logger, which publishes all outstanding
+// records, and verify that the record was published with its formatted
+// message:
+//..
+//  deferredLogger.stop();
+//
+//  assert(1 == observer.numPublishedRecords());
+//  const ball::RecordAttributes& attributes =
+//                                observer.lastPublishedRecord().fixedFields();
+//  assert(0 == bsl::strcmp("order: IBM 100 @ 145.50", attributes.message()));
+//  assert(0 == bsl::strcmp("ORDERS", attributes.category()));
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALL_DEFERREDLOGBUFFER
+#include <ball_deferredlogbuffer.h>
+#endif
+
+#ifndef INCLUDED_BALL_LOG
+#include <ball_log.h>
+#endif
+
+#ifndef INCLUDED_BDLT_CURRENTTIME
+#include <bdlt_currenttime.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+                       // ==================================
+                       // Deferred Logging Macro Definitions
+                       // ==================================
+
+#define BALL_LOGDEFER0(BALL_SEVERITY, MSG)                                 \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY);   \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER1(BALL_SEVERITY, MSG, ARG1)                           \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1));                             \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER2(BALL_SEVERITY, MSG, ARG1, ARG2)                     \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2));                     \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER3(BALL_SEVERITY, MSG, ARG1, ARG2, ARG3)               \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2), (ARG3));             \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER4(BALL_SEVERITY, MSG, ARG1, ARG2, ARG3, ARG4)         \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2), (ARG3), (ARG4));     \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER5(BALL_SEVERITY, MSG, ARG1, ARG2, ARG3, ARG4, ARG5)   \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2), (ARG3), (ARG4),      \
+                                      (ARG5));                             \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER6(BALL_SEVERITY, MSG, ARG1, ARG2, ARG3, ARG4, ARG5,   \
+                                      ARG6)                                \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2), (ARG3), (ARG4),      \
+                                      (ARG5), (ARG6));                     \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER7(BALL_SEVERITY, MSG, ARG1, ARG2, ARG3, ARG4, ARG5,   \
+                                      ARG6, ARG7)                          \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2), (ARG3), (ARG4),      \
+                                      (ARG5), (ARG6), (ARG7));             \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER8(BALL_SEVERITY, MSG, ARG1, ARG2, ARG3, ARG4, ARG5,   \
+                                      ARG6, ARG7, ARG8)                    \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2), (ARG3), (ARG4),      \
+                                      (ARG5), (ARG6), (ARG7), (ARG8));     \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+#define BALL_LOGDEFER9(BALL_SEVERITY, MSG, ARG1, ARG2, ARG3, ARG4, ARG5,   \
+                                      ARG6, ARG7, ARG8, ARG9)              \
+do {                                                                       \
+    using namespace BloombergLP;                                           \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                           \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,         \
+                                        BALL_SEVERITY)) {                  \
+            static const ball::DeferredLogFormat ball_lOcAl_FoRmAt = {     \
+                MSG, __FILE__, __LINE__                                    \
+            };                                                             \
+            ball::DeferredLogger::log(&ball_lOcAl_FoRmAt,                  \
+                                      BALL_LOG_CATEGORY, BALL_SEVERITY,    \
+                                      (ARG1), (ARG2), (ARG3), (ARG4),      \
+                                      (ARG5), (ARG6), (ARG7), (ARG8),      \
+                                      (ARG9));                             \
+        }                                                                  \
+    }                                                                      \
+} while(0)
+
+namespace BloombergLP {
+namespace ball {
+
+class Category;
+class DeferredLogger;
+class Observer;
+
+                          // ========================
+                          // struct DeferredLogFormat
+                          // ========================
+
+struct DeferredLogFormat {
+    // This 'struct' describes the invariant part of a deferred logging
+    // statement.  Objects of this type are aggregates intended to be
+    // statically initialized by the 'BALL_LOGDEFER*' macros, and must outlive
+    // every record logged with them.
+
+    // PUBLIC DATA
+    const char *d_format_p;  // 'printf'-style format string
+
+    const char *d_file_p;    // name of the source file of the statement
+
+    int         d_line;      // line number of the statement
+};
+
+                     // =================================
+                     // struct DeferredLogger_EntryHeader
+                     // =================================
+
+struct DeferredLogger_EntryHeader {
+    // [!PRIVATE!] This component-private 'struct' is the fixed-size header of
+    // each entry of a deferred log buffer; it is followed by the encoded
+    // arguments of the entry.
+
+    // PUBLIC DATA
+    const DeferredLogFormat *d_format_p;      // logging statement
+
+    const Category          *d_category_p;    // category (may be 0)
+
+    bsls::Types::Int64       d_seconds;       // timestamp (seconds since the
+                                              // epoch)
+
+    int                      d_nanoseconds;   // timestamp (nanoseconds)
+
+    int                      d_severity;      // severity of the record
+
+    int                      d_numArguments;  // number of encoded arguments
+
+    int                      d_reserved;      // pads the header to a multiple
+                                              // of 8 bytes
+};
+
+                        // =========================
+                        // struct DeferredLogger_Arg
+                        // =========================
+
+struct DeferredLogger_Arg {
+    // [!PRIVATE!] This component-private 'struct' holds an argument of a
+    // deferred logging statement, converted to its canonical type, and
+    // provides the methods to encode it into, and decode it from, a deferred
+    // log entry.  Each argument is encoded as an 8-byte word holding its tag
+    // and length, followed by its value padded to a multiple of 8 bytes.
+
+    // TYPES
+    enum Tag {
+        e_INT64,    // 'd_value.d_int64' holds the value
+        e_UINT64,   // 'd_value.d_uint64' holds the value
+        e_DOUBLE,   // 'd_value.d_double' holds the value
+        e_STRING,   // 'd_value.d_string_p' holds 'd_length' characters
+        e_POINTER   // 'd_value.d_pointer_p' holds the value
+    };
+
+    enum { k_WORD_SIZE = 8 };
+
+    union Value {
+        bsls::Types::Int64   d_int64;
+        bsls::Types::Uint64  d_uint64;
+        double               d_double;
+        const char          *d_string_p;
+        const void          *d_pointer_p;
+    };
+
+    // PUBLIC DATA
+    Value d_value;   // value of the argument
+    int   d_tag;     // 'Tag' of the argument
+    int   d_length;  // length of a string argument, excluding its null
+                     // terminator
+
+    // CLASS METHODS
+    static DeferredLogger_Arg decode(const char **buffer);
+        // Return the argument encoded at the specified '*buffer', and advance
+        // '*buffer' past it.  String arguments refer to the characters in
+        // '*buffer', which are null-terminated.
+
+    // ACCESSORS
+    char *encode(char *buffer) const;
+        // Encode this argument at the specified 'buffer', which must have at
+        // least 'encodedSize()' bytes and be aligned on an 8-byte boundary,
+        // and return the address one past the encoded argument.
+
+    int encodedSize() const;
+        // Return the number of bytes taken to encode this argument.
+};
+
+                        // =============================
+                        // struct DeferredLogger_ArgUtil
+                        // =============================
+
+struct DeferredLogger_ArgUtil {
+    // [!PRIVATE!] This component-private utility 'struct' converts the
+    // arguments of deferred logging statements to their canonical type.
+
+  private:
+    // PRIVATE CLASS METHODS
+    static DeferredLogger_Arg makeInt64(bsls::Types::Int64 value);
+    static DeferredLogger_Arg makeUint64(bsls::Types::Uint64 value);
+    static DeferredLogger_Arg makeDouble(double value);
+    static DeferredLogger_Arg makeString(const char  *value,
+                                         bsl::size_t  length);
+    static DeferredLogger_Arg makePointer(const void *value);
+        // Return an argument having the canonical type indicated by the name
+        // of the method, and the specified 'value' (and 'length').
+
+  public:
+    // CLASS METHODS
+    static DeferredLogger_Arg convert(bool value);
+    static DeferredLogger_Arg convert(char value);
+    static DeferredLogger_Arg convert(signed char value);
+    static DeferredLogger_Arg convert(unsigned char value);
+    static DeferredLogger_Arg convert(short value);
+    static DeferredLogger_Arg convert(unsigned short value);
+    static DeferredLogger_Arg convert(int value);
+    static DeferredLogger_Arg convert(unsigned int value);
+    static DeferredLogger_Arg convert(long value);
+    static DeferredLogger_Arg convert(unsigned long value);
+    static DeferredLogger_Arg convert(long long value);
+    static DeferredLogger_Arg convert(unsigned long long value);
+    static DeferredLogger_Arg convert(float value);
+    static DeferredLogger_Arg convert(double value);
+    static DeferredLogger_Arg convert(long double value);
+    static DeferredLogger_Arg convert(const char *value);
+    static DeferredLogger_Arg convert(char *value);
+    static DeferredLogger_Arg convert(const bsl::string& value);
+    static DeferredLogger_Arg convert(const native_std::string& value);
+    static DeferredLogger_Arg convert(const bslstl::StringRef& value);
+    template <class TYPE>
+    static DeferredLogger_Arg convert(TYPE *value);
+        // Return the specified 'value' converted to its canonical type.  Note
+        // that enumerations are converted by integral promotion, and that a
+        // null 'const char *' is converted to the string "(null)".
+};
+
+                     // ==================================
+                     // struct DeferredLogger_WriterState
+                     // ==================================
+
+struct DeferredLogger_WriterState {
+    // [!PRIVATE!] This component-private 'struct' holds the state, shared by
+    // all deferred loggers, of a thread logging deferred records.
+
+    // PUBLIC DATA
+    bsls::AtomicInt d_isWriting;  // 1 while the thread may access the started
+                                  // deferred logger
+};
+
+                        // ===========================
+                        // class DeferredLogger_Writer
+                        // ===========================
+
+class DeferredLogger_Writer {
+    // [!PRIVATE!] This component-private class writes a single deferred log
+    // entry: into the buffer of the current thread if a deferred logger is
+    // started, and into a temporary buffer, from which it is logged
+    // synchronously on 'commit', otherwise.
+
+    // PRIVATE TYPES
+    enum { k_LOCAL_BUFFER_SIZE = 256 };
+
+    // DATA
+    DeferredLogger             *d_logger_p;  // started logger, or 0 if
+                                             // logging synchronously
+
+    DeferredLogger_WriterState *d_state_p;   // state of the current thread,
+                                             // or 0 if not writing to a
+                                             // started logger
+
+    DeferredLogBuffer          *d_buffer_p;  // buffer of the current thread,
+                                             // or 0 if logging synchronously
+
+    char                       *d_entry_p;   // entry being written, or 0 if
+                                             // dropped
+
+    char                       *d_heap_p;    // dynamically allocated entry,
+                                             // if any
+
+    bsls::AlignedBuffer<k_LOCAL_BUFFER_SIZE, 8>
+                                d_local;     // small synchronous entries
+
+    // NOT IMPLEMENTED
+    DeferredLogger_Writer(const DeferredLogger_Writer&);
+    DeferredLogger_Writer& operator=(const DeferredLogger_Writer&);
+
+    // PRIVATE MANIPULATORS
+    void allocateLocalEntry(int size);
+        // Load into 'd_entry_p' the address of a block of the specified
+        // 'size' bytes, allocated from the local buffer if it is large
+        // enough, and from the default allocator otherwise.
+
+    void logSynchronously();
+        // Format and log the entry at 'd_entry_p' through the logger manager.
+
+  public:
+    // CREATORS
+    DeferredLogger_Writer(const DeferredLogFormat *format,
+                          const Category          *category,
+                          int                      severity,
+                          int                      numArguments,
+                          int                      argumentsSize);
+        // Create a writer for an entry for the specified 'format', 'category',
+        // and 'severity', having the specified 'numArguments' arguments that
+        // take 'argumentsSize' bytes once encoded, and write its header.
+
+    ~DeferredLogger_Writer();
+        // Destroy this writer, and release the deferred logger it writes to,
+        // if any.
+
+    // MANIPULATORS
+    char *arguments();
+        // Return the address at which the arguments of the entry are to be
+        // encoded, or 0 if the entry is dropped.
+
+    void commit();
+        // Publish the entry.  The behavior is undefined unless 'arguments()'
+        // returns a non-null address and the arguments have been encoded.
+};
+
+                     // ==================================
+                     // struct DeferredLogger_ThreadBuffer
+                     // ==================================
+
+struct DeferredLogger_ThreadBuffer {
+    // [!PRIVATE!] This component-private 'struct' holds the deferred log
+    // buffer of a logging thread.
+
+    // PUBLIC DATA
+    DeferredLogBuffer    d_buffer;      // entries logged by the thread
+
+    bsls::Types::Uint64  d_threadId;    // id of the thread
+
+    bsls::AtomicInt      d_isDetached;  // 1 once the thread has exited
+
+    // CREATORS
+    DeferredLogger_ThreadBuffer(int capacity, bslma::Allocator *allocator);
+        // Create a buffer of the specified 'capacity' for the current thread,
+        // using the specified 'allocator' to supply memory.
+};
+
+                           // ====================
+                           // class DeferredLogger
+                           // ====================
+
+class DeferredLogger {
+    // This class provides a mechanism that drains the deferred log entries of
+    // all threads from a background thread, formats them into records, and
+    // publishes the records to an observer.  At most one 'DeferredLogger'
+    // object may be started at a time.
+
+    // PRIVATE TYPES
+    typedef DeferredLogger_ThreadBuffer ThreadBuffer;
+
+    enum {
+        k_MAX_BATCH_SIZE = 256  // entries drained from one thread before
+                                // moving to the next
+    };
+
+    // CLASS DATA
+    static bsls::AtomicPointer<DeferredLogger>
+                                   s_started_p;   // started logger, if any
+
+    static bslmt::ThreadUtil::Key  s_writerStateKey;
+                                                  // key of the writer state
+                                                  // of the current thread
+
+    // DATA
+    Observer                      *d_observer_p;  // observer (held, not
+                                                  // owned)
+
+    int                            d_bufferSize;  // capacity of per-thread
+                                                  // buffers
+
+    bslmt::ThreadUtil::Key         d_key;         // key of the buffer of the
+                                                  // current thread
+
+    bsl::vector<ThreadBuffer *>    d_buffers;     // buffers of all threads
+                                                  // (owned)
+
+    bslmt::Mutex                   d_buffersLock; // protects 'd_buffers'
+
+    bsl::vector<ThreadBuffer *>    d_snapshot;    // copy of 'd_buffers' used
+                                                  // by the publication thread
+
+    bsl::function<void()>          d_publicationThreadEntryPoint;
+                                                  // entry point of the
+                                                  // publication thread
+
+    bslmt::ThreadUtil::Handle      d_threadHandle;
+                                                  // publication thread
+
+    bsls::AtomicInt                d_stopFlag;    // 1 if the publication
+                                                  // thread must exit
+
+    bsls::AtomicInt                d_waitingFlag; // set while the publication
+                                                  // thread waits on
+                                                  // 'd_waitCondition' for an
+                                                  // entry to publish
+
+    bslmt::Mutex                   d_waitMutex;   // mutex associated with
+                                                  // 'd_waitCondition'
+
+    bslmt::Condition               d_waitCondition;
+                                                  // signaled when an entry is
+                                                  // committed while
+                                                  // 'd_waitingFlag' is set,
+                                                  // and on 'stop'
+
+    bsls::AtomicInt64              d_numDropped;  // number of records dropped
+                                                  // because a buffer was full
+
+    bsls::AtomicInt64              d_numPublished;
+                                                  // number of records
+                                                  // published
+
+    int                            d_processId;   // id of this process
+
+    bslma::Allocator              *d_allocator_p; // memory allocator (held,
+                                                  // not owned)
+
+    // FRIENDS
+    friend class DeferredLogger_Writer;
+
+  private:
+    // NOT IMPLEMENTED
+    DeferredLogger(const DeferredLogger&);
+    DeferredLogger& operator=(const DeferredLogger&);
+
+    // PRIVATE CLASS METHODS
+    static DeferredLogger_WriterState *createWriterState();
+        // Create and register the writer state of the current thread, and
+        // return its address.
+
+    static void detachThreadBuffer(void *buffer);
+        // Mark the specified thread 'buffer' as belonging to an exited
+        // thread.  Note that this method is the destructor of the
+        // thread-specific key of the buffers.
+
+    static void releaseWriterState(void *state);
+        // Unregister and destroy the specified writer 'state' of an exited
+        // thread.  Note that this method is the destructor of the
+        // thread-specific key of the writer states.
+
+    static void waitForWriters();
+        // Wait until no thread is writing an entry to the deferred logger
+        // that was started when this method was called.  The behavior is
+        // undefined unless 's_started_p' has been cleared.
+
+    static DeferredLogger_WriterState *writerState();
+        // Return the address of the writer state of the current thread,
+        // creating it if necessary.  The behavior is undefined unless a
+        // deferred logger has been created.
+
+    // PRIVATE MANIPULATORS
+    DeferredLogBuffer *createThreadBuffer();
+        // Create and register the buffer of the current thread, and return
+        // its address.
+
+    int drain();
+        // Publish the entries of all buffers, removing the buffers of exited
+        // threads once empty, and return the number of entries published.
+
+    bool isIdle();
+        // Return 'true' if no thread is writing an entry, and the buffers of
+        // this logger hold no committed entry, and 'false' otherwise.  The
+        // behavior is undefined unless this method is called by the
+        // publication thread after setting 'd_waitingFlag'.
+
+    void notifyPublicationThread();
+        // Wake up the publication thread if it is waiting for an entry to
+        // publish.  The behavior is undefined unless this method is called
+        // after each entry is committed, by the thread committing it.
+
+    void publicationThreadEntryPoint();
+        // Drain the buffers, waiting on 'd_waitCondition' while they are
+        // empty, until 'd_stopFlag' is set, then drain them one final time.
+
+    void publishEntry(const char *entry, bsls::Types::Uint64 threadId);
+        // Format the specified 'entry', logged by the thread having the
+        // specified 'threadId', into a record and publish it.
+
+    void signalPublicationThread();
+        // Signal 'd_waitCondition' while holding 'd_waitMutex'.
+
+    DeferredLogBuffer *threadBuffer();
+        // Return the address of the buffer of the current thread, creating
+        // it if necessary.
+
+  public:
+    // CLASS METHODS
+    static void formatMessage(bsl::streambuf *stream,
+                              const char     *format,
+                              const char     *arguments,
+                              int             numArguments);
+        // Write to the specified 'stream' the message produced by applying
+        // the specified 'printf'-style 'format' to the specified
+        // 'numArguments' encoded 'arguments'.
+
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity);
+    template <class ARG1>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1);
+    template <class ARG1, class ARG2>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2);
+    template <class ARG1, class ARG2, class ARG3>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2,
+                    const ARG3&              argument3);
+    template <class ARG1, class ARG2, class ARG3, class ARG4>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2,
+                    const ARG3&              argument3,
+                    const ARG4&              argument4);
+    template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2,
+                    const ARG3&              argument3,
+                    const ARG4&              argument4,
+                    const ARG5&              argument5);
+    template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+              class ARG6>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2,
+                    const ARG3&              argument3,
+                    const ARG4&              argument4,
+                    const ARG5&              argument5,
+                    const ARG6&              argument6);
+    template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+              class ARG6, class ARG7>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2,
+                    const ARG3&              argument3,
+                    const ARG4&              argument4,
+                    const ARG5&              argument5,
+                    const ARG6&              argument6,
+                    const ARG7&              argument7);
+    template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+              class ARG6, class ARG7, class ARG8>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2,
+                    const ARG3&              argument3,
+                    const ARG4&              argument4,
+                    const ARG5&              argument5,
+                    const ARG6&              argument6,
+                    const ARG7&              argument7,
+                    const ARG8&              argument8);
+    template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+              class ARG6, class ARG7, class ARG8, class ARG9>
+    static void log(const DeferredLogFormat *format,
+                    const Category          *category,
+                    int                      severity,
+                    const ARG1&              argument1,
+                    const ARG2&              argument2,
+                    const ARG3&              argument3,
+                    const ARG4&              argument4,
+                    const ARG5&              argument5,
+                    const ARG6&              argument6,
+                    const ARG7&              argument7,
+                    const ARG8&              argument8,
+                    const ARG9&              argument9);
+        // Log a record having the specified 'format', 'category', 'severity',
+        // and (optionally) specified arguments 'argument1' up to 'argument9':
+        // if a deferred logger is started, copy the record into the buffer of
+        // the current thread, to be formatted and published by the deferred
+        // logger; otherwise, format and log the record synchronously.  Note
+        // that this method is intended to be invoked by the 'BALL_LOGDEFER*'
+        // macros.
+
+    // CREATORS
+    DeferredLogger(Observer         *observer,
+                   int               bufferSize,
+                   bslma::Allocator *basicAllocator = 0);
+        // Create a deferred logger, not yet started, that publishes deferred
+        // records to the specified 'observer', and allocates a buffer of at
+        // least the specified 'bufferSize' bytes for each logging thread.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'observer' remains valid
+        // for the lifetime of this object, and
+        // '64 <= bufferSize <= 1 << 30'.
+
+    ~DeferredLogger();
+        // Stop this deferred logger, if started, and destroy it.  The
+        // behavior is undefined if a thread that logged deferred records to
+        // this logger is exiting.
+
+    // MANIPULATORS
+    int start();
+        // Start the publication thread of this deferred logger, and direct
+        // subsequent deferred records to it.  Return 0 on success, and a
+        // non-zero value if another deferred logger is started or the thread
+        // cannot be created.  Starting a logger that is already started has
+        // no effect.
+
+    void stop();
+        // Direct subsequent deferred records to be logged synchronously,
+        // wait for the threads writing a deferred record to this logger to
+        // commit it, publish all the outstanding records of this deferred
+        // logger, and stop its publication thread.  Stopping a logger that is
+        // not started has no effect.
+
+    // ACCESSORS
+    bool isStarted() const;
+        // Return 'true' if this deferred logger is started, and 'false'
+        // otherwise.
+
+    bsls::Types::Int64 numRecordsDropped() const;
+        // Return the number of records dropped because the buffer of their
+        // thread was full.
+
+    bsls::Types::Int64 numRecordsPublished() const;
+        // Return the number of deferred records published by this logger.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // struct DeferredLogger_Arg
+                        // -------------------------
+
+// ACCESSORS
+inline
+char *DeferredLogger_Arg::encode(char *buffer) const
+{
+    int *word = reinterpret_cast<int *>(buffer);
+    word[0] = d_tag;
+    word[1] = d_length;
+    buffer += k_WORD_SIZE;
+
+    if (e_STRING == d_tag) {
+        bsl::memcpy(buffer, d_value.d_string_p, d_length);
+        buffer[d_length] = '\0';
+        return buffer + ((d_length + k_WORD_SIZE) & ~(k_WORD_SIZE - 1));
+                                                                      // RETURN
+    }
+    bsl::memcpy(buffer, &d_value, k_WORD_SIZE);
+    return buffer + k_WORD_SIZE;
+}
+
+inline
+int DeferredLogger_Arg::encodedSize() const
+{
+    return e_STRING == d_tag
+           ? k_WORD_SIZE + ((d_length + k_WORD_SIZE) & ~(k_WORD_SIZE - 1))
+           : 2 * k_WORD_SIZE;
+}
+
+                        // -----------------------------
+                        // struct DeferredLogger_ArgUtil
+                        // -----------------------------
+
+// PRIVATE CLASS METHODS
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::makeInt64(bsls::Types::Int64 value)
+{
+    DeferredLogger_Arg result;
+    result.d_value.d_int64 = value;
+    result.d_tag           = DeferredLogger_Arg::e_INT64;
+    result.d_length        = 0;
+    return result;
+}
+
+inline
+DeferredLogger_Arg
+DeferredLogger_ArgUtil::makeUint64(bsls::Types::Uint64 value)
+{
+    DeferredLogger_Arg result;
+    result.d_value.d_uint64 = value;
+    result.d_tag            = DeferredLogger_Arg::e_UINT64;
+    result.d_length         = 0;
+    return result;
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::makeDouble(double value)
+{
+    DeferredLogger_Arg result;
+    result.d_value.d_double = value;
+    result.d_tag            = DeferredLogger_Arg::e_DOUBLE;
+    result.d_length         = 0;
+    return result;
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::makeString(const char  *value,
+                                                      bsl::size_t  length)
+{
+    DeferredLogger_Arg result;
+    result.d_value.d_string_p = value;
+    result.d_tag              = DeferredLogger_Arg::e_STRING;
+    result.d_length           = static_cast<int>(length);
+    return result;
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::makePointer(const void *value)
+{
+    DeferredLogger_Arg result;
+    result.d_value.d_pointer_p = value;
+    result.d_tag               = DeferredLogger_Arg::e_POINTER;
+    result.d_length            = 0;
+    return result;
+}
+
+// CLASS METHODS
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(bool value)
+{
+    return makeInt64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(char value)
+{
+    return makeInt64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(signed char value)
+{
+    return makeInt64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(unsigned char value)
+{
+    return makeUint64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(short value)
+{
+    return makeInt64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(unsigned short value)
+{
+    return makeUint64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(int value)
+{
+    return makeInt64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(unsigned int value)
+{
+    return makeUint64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(long value)
+{
+    return makeInt64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(unsigned long value)
+{
+    return makeUint64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(long long value)
+{
+    return makeInt64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(unsigned long long value)
+{
+    return makeUint64(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(float value)
+{
+    return makeDouble(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(double value)
+{
+    return makeDouble(value);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(long double value)
+{
+    return makeDouble(static_cast<double>(value));
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(const char *value)
+{
+    return value ? makeString(value, bsl::strlen(value))
+                 : makeString("(null)", 6);
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(char *value)
+{
+    return convert(static_cast<const char *>(value));
+}
+
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(const bsl::string& value)
+{
+    return makeString(value.data(), value.length());
+}
+
+inline
+DeferredLogger_Arg
+DeferredLogger_ArgUtil::convert(const native_std::string& value)
+{
+    return makeString(value.data(), value.length());
+}
+
+inline
+DeferredLogger_Arg
+DeferredLogger_ArgUtil::convert(const bslstl::StringRef& value)
+{
+    return makeString(value.data(), value.length());
+}
+
+template <class TYPE>
+inline
+DeferredLogger_Arg DeferredLogger_ArgUtil::convert(TYPE *value)
+{
+    return makePointer(value);
+}
+
+                        // ---------------------------
+                        // class DeferredLogger_Writer
+                        // ---------------------------
+
+// CREATORS
+inline
+DeferredLogger_Writer::DeferredLogger_Writer(
+                                       const DeferredLogFormat *format,
+                                       const Category          *category,
+                                       int                      severity,
+                                       int                      numArguments,
+                                       int                      argumentsSize)
+: d_logger_p(0)
+, d_state_p(0)
+, d_buffer_p(0)
+, d_entry_p(0)
+, d_heap_p(0)
+{
+    const int size = static_cast<int>(sizeof(DeferredLogger_EntryHeader))
+                   + argumentsSize;
+
+    DeferredLogger *logger = DeferredLogger::s_started_p.loadAcquire();
+    if (logger) {
+        // Announce that this thread is writing (with sequential consistency)
+        // before checking again that the logger is started, so that either
+        // 'stop' sees the announcement, and waits for this writer to be
+        // destroyed, or this thread sees that the logger is stopped.
+
+        d_state_p = DeferredLogger::writerState();
+        d_state_p->d_isWriting = 1;
+        if (logger == DeferredLogger::s_started_p.load()) {
+            d_logger_p = logger;
+        }
+        else {
+            d_state_p->d_isWriting.storeRelease(0);
+            d_state_p = 0;
+        }
+    }
+
+    if (d_logger_p) {
+        d_buffer_p = d_logger_p->threadBuffer();
+        d_entry_p  = static_cast<char *>(d_buffer_p->allocate(size));
+        if (!d_entry_p) {
+            d_logger_p->d_numDropped.addRelaxed(1);
+            return;                                                   // RETURN
+        }
+    }
+    else {
+        allocateLocalEntry(size);
+    }
+
+    const bsls::TimeInterval now = bdlt::CurrentTime::now();
+
+    DeferredLogger_EntryHeader *header =
+                    reinterpret_cast<DeferredLogger_EntryHeader *>(d_entry_p);
+    header->d_format_p     = format;
+    header->d_category_p   = category;
+    header->d_seconds      = now.seconds();
+    header->d_nanoseconds  = now.nanoseconds();
+    header->d_severity     = severity;
+    header->d_numArguments = numArguments;
+    header->d_reserved     = 0;
+}
+
+inline
+DeferredLogger_Writer::~DeferredLogger_Writer()
+{
+    if (d_heap_p) {
+        bslma::Default::defaultAllocator()->deallocate(d_heap_p);
+    }
+    if (d_state_p) {
+        d_state_p->d_isWriting.storeRelease(0);
+    }
+}
+
+// MANIPULATORS
+inline
+char *DeferredLogger_Writer::arguments()
+{
+    return d_entry_p ? d_entry_p + sizeof(DeferredLogger_EntryHeader) : 0;
+}
+
+inline
+void DeferredLogger_Writer::commit()
+{
+    if (d_buffer_p) {
+        d_buffer_p->commit();
+        d_logger_p->notifyPublicationThread();
+    }
+    else {
+        logSynchronously();
+    }
+}
+
+                           // --------------------
+                           // class DeferredLogger
+                           // --------------------
+
+// PRIVATE CLASS METHODS
+inline
+DeferredLogger_WriterState *DeferredLogger::writerState()
+{
+    void *state = bslmt::ThreadUtil::getSpecific(s_writerStateKey);
+    return state ? static_cast<DeferredLogger_WriterState *>(state)
+                 : createWriterState();
+}
+
+// PRIVATE MANIPULATORS
+inline
+void DeferredLogger::notifyPublicationThread()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_waitingFlag)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        signalPublicationThread();
+    }
+}
+
+inline
+DeferredLogBuffer *DeferredLogger::threadBuffer()
+{
+    void *buffer = bslmt::ThreadUtil::getSpecific(d_key);
+    return buffer ? &static_cast<ThreadBuffer *>(buffer)->d_buffer
+                  : createThreadBuffer();
+}
+
+// CLASS METHODS
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity)
+{
+    DeferredLogger_Writer writer(format, category, severity, 0, 0);
+    if (writer.arguments()) {
+        writer.commit();
+    }
+}
+
+template <class ARG1>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 1,
+                                 a1.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        a1.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 2,
+                                 a1.encodedSize() + a2.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        a2.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2, class ARG3>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2,
+                         const ARG3&              argument3)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+    const DeferredLogger_Arg a3 = DeferredLogger_ArgUtil::convert(argument3);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 3,
+                                 a1.encodedSize() + a2.encodedSize() +
+                                 a3.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        buffer = a2.encode(buffer);
+        a3.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2, class ARG3, class ARG4>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2,
+                         const ARG3&              argument3,
+                         const ARG4&              argument4)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+    const DeferredLogger_Arg a3 = DeferredLogger_ArgUtil::convert(argument3);
+    const DeferredLogger_Arg a4 = DeferredLogger_ArgUtil::convert(argument4);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 4,
+                                 a1.encodedSize() + a2.encodedSize() +
+                                 a3.encodedSize() + a4.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        buffer = a2.encode(buffer);
+        buffer = a3.encode(buffer);
+        a4.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2,
+                         const ARG3&              argument3,
+                         const ARG4&              argument4,
+                         const ARG5&              argument5)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+    const DeferredLogger_Arg a3 = DeferredLogger_ArgUtil::convert(argument3);
+    const DeferredLogger_Arg a4 = DeferredLogger_ArgUtil::convert(argument4);
+    const DeferredLogger_Arg a5 = DeferredLogger_ArgUtil::convert(argument5);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 5,
+                                 a1.encodedSize() + a2.encodedSize() +
+                                 a3.encodedSize() + a4.encodedSize() +
+                                 a5.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        buffer = a2.encode(buffer);
+        buffer = a3.encode(buffer);
+        buffer = a4.encode(buffer);
+        a5.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+          class ARG6>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2,
+                         const ARG3&              argument3,
+                         const ARG4&              argument4,
+                         const ARG5&              argument5,
+                         const ARG6&              argument6)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+    const DeferredLogger_Arg a3 = DeferredLogger_ArgUtil::convert(argument3);
+    const DeferredLogger_Arg a4 = DeferredLogger_ArgUtil::convert(argument4);
+    const DeferredLogger_Arg a5 = DeferredLogger_ArgUtil::convert(argument5);
+    const DeferredLogger_Arg a6 = DeferredLogger_ArgUtil::convert(argument6);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 6,
+                                 a1.encodedSize() + a2.encodedSize() +
+                                 a3.encodedSize() + a4.encodedSize() +
+                                 a5.encodedSize() + a6.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        buffer = a2.encode(buffer);
+        buffer = a3.encode(buffer);
+        buffer = a4.encode(buffer);
+        buffer = a5.encode(buffer);
+        a6.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+          class ARG6, class ARG7>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2,
+                         const ARG3&              argument3,
+                         const ARG4&              argument4,
+                         const ARG5&              argument5,
+                         const ARG6&              argument6,
+                         const ARG7&              argument7)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+    const DeferredLogger_Arg a3 = DeferredLogger_ArgUtil::convert(argument3);
+    const DeferredLogger_Arg a4 = DeferredLogger_ArgUtil::convert(argument4);
+    const DeferredLogger_Arg a5 = DeferredLogger_ArgUtil::convert(argument5);
+    const DeferredLogger_Arg a6 = DeferredLogger_ArgUtil::convert(argument6);
+    const DeferredLogger_Arg a7 = DeferredLogger_ArgUtil::convert(argument7);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 7,
+                                 a1.encodedSize() + a2.encodedSize() +
+                                 a3.encodedSize() + a4.encodedSize() +
+                                 a5.encodedSize() + a6.encodedSize() +
+                                 a7.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        buffer = a2.encode(buffer);
+        buffer = a3.encode(buffer);
+        buffer = a4.encode(buffer);
+        buffer = a5.encode(buffer);
+        buffer = a6.encode(buffer);
+        a7.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+          class ARG6, class ARG7, class ARG8>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2,
+                         const ARG3&              argument3,
+                         const ARG4&              argument4,
+                         const ARG5&              argument5,
+                         const ARG6&              argument6,
+                         const ARG7&              argument7,
+                         const ARG8&              argument8)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+    const DeferredLogger_Arg a3 = DeferredLogger_ArgUtil::convert(argument3);
+    const DeferredLogger_Arg a4 = DeferredLogger_ArgUtil::convert(argument4);
+    const DeferredLogger_Arg a5 = DeferredLogger_ArgUtil::convert(argument5);
+    const DeferredLogger_Arg a6 = DeferredLogger_ArgUtil::convert(argument6);
+    const DeferredLogger_Arg a7 = DeferredLogger_ArgUtil::convert(argument7);
+    const DeferredLogger_Arg a8 = DeferredLogger_ArgUtil::convert(argument8);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 8,
+                                 a1.encodedSize() + a2.encodedSize() +
+                                 a3.encodedSize() + a4.encodedSize() +
+                                 a5.encodedSize() + a6.encodedSize() +
+                                 a7.encodedSize() + a8.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        buffer = a2.encode(buffer);
+        buffer = a3.encode(buffer);
+        buffer = a4.encode(buffer);
+        buffer = a5.encode(buffer);
+        buffer = a6.encode(buffer);
+        buffer = a7.encode(buffer);
+        a8.encode(buffer);
+        writer.commit();
+    }
+}
+
+template <class ARG1, class ARG2, class ARG3, class ARG4, class ARG5,
+          class ARG6, class ARG7, class ARG8, class ARG9>
+inline
+void DeferredLogger::log(const DeferredLogFormat *format,
+                         const Category          *category,
+                         int                      severity,
+                         const ARG1&              argument1,
+                         const ARG2&              argument2,
+                         const ARG3&              argument3,
+                         const ARG4&              argument4,
+                         const ARG5&              argument5,
+                         const ARG6&              argument6,
+                         const ARG7&              argument7,
+                         const ARG8&              argument8,
+                         const ARG9&              argument9)
+{
+    const DeferredLogger_Arg a1 = DeferredLogger_ArgUtil::convert(argument1);
+    const DeferredLogger_Arg a2 = DeferredLogger_ArgUtil::convert(argument2);
+    const DeferredLogger_Arg a3 = DeferredLogger_ArgUtil::convert(argument3);
+    const DeferredLogger_Arg a4 = DeferredLogger_ArgUtil::convert(argument4);
+    const DeferredLogger_Arg a5 = DeferredLogger_ArgUtil::convert(argument5);
+    const DeferredLogger_Arg a6 = DeferredLogger_ArgUtil::convert(argument6);
+    const DeferredLogger_Arg a7 = DeferredLogger_ArgUtil::convert(argument7);
+    const DeferredLogger_Arg a8 = DeferredLogger_ArgUtil::convert(argument8);
+    const DeferredLogger_Arg a9 = DeferredLogger_ArgUtil::convert(argument9);
+
+    DeferredLogger_Writer writer(format,
+                                 category,
+                                 severity,
+                                 9,
+                                 a1.encodedSize() + a2.encodedSize() +
+                                 a3.encodedSize() + a4.encodedSize() +
+                                 a5.encodedSize() + a6.encodedSize() +
+                                 a7.encodedSize() + a8.encodedSize() +
+                                 a9.encodedSize());
+    if (char *buffer = writer.arguments()) {
+        buffer = a1.encode(buffer);
+        buffer = a2.encode(buffer);
+        buffer = a3.encode(buffer);
+        buffer = a4.encode(buffer);
+        buffer = a5.encode(buffer);
+        buffer = a6.encode(buffer);
+        buffer = a7.encode(buffer);
+        buffer = a8.encode(buffer);
+        a9.encode(buffer);
+        writer.commit();
+    }
+}
+
+// ACCESSORS
+inline
+bool DeferredLogger::isStarted() const
+{
+    return this == s_started_p.loadAcquire();
+}
+
+inline
+bsls::Types::Int64 DeferredLogger::numRecordsDropped() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 DeferredLogger::numRecordsPublished() const
+{
+    return d_numPublished.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
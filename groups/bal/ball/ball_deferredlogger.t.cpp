@@ -0,0 +1,1329 @@
+// ball_deferredlogger.t.cpp                                          -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <ball_context.h>
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_testobserver.h>
+
+#include <bdlsb_memoutstreambuf.h>
+#include <bdlt_currenttime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <stdio.h>  // 'snprintf'
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test provides logging macros whose arguments are
+// encoded into a per-thread buffer, and a mechanism that formats and
+// publishes the encoded records from a background thread.  We first verify
+// the encoding of arguments and the formatting of messages, which are shared
+// by the synchronous and the deferred paths.  We then verify that the macros
+// log synchronously through the logger manager when no deferred logger is
+// started, and through the deferred logger when one is started, that
+// records of each thread are published in order, and that records are
+// dropped, and counted, when a buffer is full.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void formatMessage(streambuf *, const char *, const char *, int);
+// [ 4] void log(const DeferredLogFormat *, const Category *, int, ...);
+//
+// CREATORS
+// [ 5] DeferredLogger(Observer *, int, Allocator * = 0);
+// [ 5] ~DeferredLogger();
+//
+// MANIPULATORS
+// [ 5] int start();
+// [ 5] void stop();
+//
+// ACCESSORS
+// [ 5] bool isStarted() const;
+// [ 6] bsls::Types::Int64 numRecordsDropped() const;
+// [ 6] bsls::Types::Int64 numRecordsPublished() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] DeferredLogger_ArgUtil::convert
+// [ 2] DeferredLogger_Arg::encode
+// [ 2] DeferredLogger_Arg::decode
+// [ 4] BALL_LOGDEFER0 .. BALL_LOGDEFER9 (SYNCHRONOUS)
+// [ 6] BALL_LOGDEFER0 .. BALL_LOGDEFER9 (DEFERRED)
+// [ 7] CONCURRENT LOGGING
+// [ 8] STOPPING WHILE LOGGING
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: COST OF A LOGGING STATEMENT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredLogger         Obj;
+typedef ball::DeferredLogger_Arg     Arg;
+typedef ball::DeferredLogger_ArgUtil ArgUtil;
+typedef ball::Severity               Sev;
+
+enum TestEnum { e_TEST_ENUM_VALUE = 7 };
+
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::string formatEncoded(const char *format,
+                          const Arg  *arguments,
+                          int         numArguments)
+    // Return the message produced by 'ball::DeferredLogger::formatMessage'
+    // for the specified 'format' and the specified 'numArguments'
+    // 'arguments', after encoding them.
+{
+    bsl::vector<char> buffer(8);
+    for (int i = 0; i < numArguments; ++i) {
+        const bsl::size_t offset = buffer.size();
+        buffer.resize(offset + arguments[i].encodedSize());
+        ASSERT(&buffer[0] + buffer.size()
+                                == arguments[i].encode(&buffer[0] + offset));
+    }
+
+    bdlsb::MemOutStreamBuf streamBuf;
+    ball::DeferredLogger::formatMessage(&streamBuf,
+                                        format,
+                                        &buffer[0] + 8,
+                                        numArguments);
+    return bsl::string(streamBuf.data(), streamBuf.length());
+}
+
+class RecordingObserver : public ball::Observer {
+    // This class implements an observer that records the messages, thread
+    // ids, and severities of the records published to it.
+
+    // DATA
+    bslmt::Mutex                      d_mutex;
+    bsl::vector<bsl::string>          d_messages;
+    bsl::vector<bsls::Types::Uint64>  d_threadIds;
+    bsl::vector<int>                  d_severities;
+
+  public:
+    // MANIPULATORS
+    virtual void publish(const ball::Record&  record,
+                         const ball::Context&)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_messages.push_back(record.fixedFields().message());
+        d_threadIds.push_back(record.fixedFields().threadID());
+        d_severities.push_back(record.fixedFields().severity());
+    }
+
+    // ACCESSORS
+    int numRecords() const
+    {
+        return static_cast<int>(d_messages.size());
+    }
+
+    const bsl::string& message(int index) const
+    {
+        return d_messages[index];
+    }
+
+    bsls::Types::Uint64 threadId(int index) const
+    {
+        return d_threadIds[index];
+    }
+
+    int severity(int index) const
+    {
+        return d_severities[index];
+    }
+};
+
+class NullObserver : public ball::Observer {
+    // This class implements an observer that ignores the records published
+    // to it.
+
+  public:
+    virtual void publish(const ball::Record&, const ball::Context&)
+    {
+    }
+};
+
+void logSequence(int numRecords)
+    // Log the specified 'numRecords' deferred records, each holding its
+    // sequence number.
+{
+    BALL_LOG_SET_CATEGORY("SEQUENCE");
+
+    for (int i = 0; i < numRecords; ++i) {
+        BALL_LOGDEFER2(Sev::e_INFO, "%s %d", "sequence", i);
+    }
+}
+
+extern "C" void *logSequenceThread(void *numRecords)
+    // Log the number of deferred records specified by 'numRecords'.
+{
+    logSequence(static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(
+                                                                numRecords)));
+    return 0;
+}
+
+struct LogAndCountArgs {
+    // This 'struct' holds the arguments of 'logAndCountThread'.
+
+    int              d_numRecords;    // number of records to log
+    bsls::AtomicInt *d_numDone_p;     // incremented once logged
+};
+
+extern "C" void *logAndCountThread(void *arguments)
+    // Log the number of deferred records specified by 'arguments', yielding
+    // after each record, and then increment its counter of threads done.
+{
+    BALL_LOG_SET_CATEGORY("SEQUENCE");
+
+    LogAndCountArgs *args = static_cast<LogAndCountArgs *>(arguments);
+
+    for (int i = 0; i < args->d_numRecords; ++i) {
+        BALL_LOGDEFER2(Sev::e_INFO, "%s %d", "sequence", i);
+        bslmt::ThreadUtil::yield();
+    }
+    ++*args->d_numDone_p;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Example 1: Logging From a Latency-Sensitive Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Next, we define a function that processes an order and logs it using
+// 'BALL_LOGDEFER3' in place of 'BALL_LOG3':
+//..
+    void processOrder(const char *symbol, int quantity, double price)
+    {
+        BALL_LOG_SET_CATEGORY("ORDERS");
+
+        // ...
+
+        BALL_LOGDEFER3(ball::Severity::e_INFO,
+                       "order: %s %d @ %.2f",
+                       symbol,
+                       quantity,
+                       price);
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging From a Latency-Sensitive Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-sensitive application must log every order it processes,
+// but cannot afford to format a message on its critical path.  First, we
+// initialize the logger manager with an observer, as usual (here we use a
+// 'ball::TestObserver' so that we can inspect the published records):
+//..
+    ball::TestObserver observer(bsl::cout);
+
+    ball::LoggerManagerConfiguration configuration;
+    configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_TRACE,
+                                                   ball::Severity::e_TRACE,
+                                                   ball::Severity::e_OFF,
+                                                   ball::Severity::e_OFF);
+
+    ball::LoggerManagerScopedGuard guard(&observer, configuration);
+//..
+// Then, we create a deferred logger that publishes to the same observer, with
+// a buffer of 64 KB per logging thread, and start it:
+//..
+    ball::DeferredLogger deferredLogger(&observer, 65536);
+    int rc = deferredLogger.start();
+    ASSERT(0 == rc);
+//..
+// Now, we process an order.  The message has not necessarily been published
+// when 'processOrder' returns:
+//..
+    processOrder("IBM", 100, 145.5);
+//..
+// Finally, we stop the deferred logger, which publishes all outstanding
+// records, and verify that the record was published with its formatted
+// message:
+//..
+    deferredLogger.stop();
+
+    ASSERT(1 == observer.numPublishedRecords());
+    const ball::RecordAttributes& attributes =
+                                  observer.lastPublishedRecord().fixedFields();
+    ASSERT(0 == bsl::strcmp("order: IBM 100 @ 145.50", attributes.message()));
+    ASSERT(0 == bsl::strcmp("ORDERS", attributes.category()));
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // STOPPING WHILE LOGGING
+        //
+        // Concerns:
+        //: 1 A record logged concurrently with a call to 'stop' is either
+        //:   published by the deferred logger, or logged synchronously.
+        //:
+        //: 2 A started deferred logger may be destroyed while other threads
+        //:   are logging.
+        //
+        // Plan:
+        //: 1 Have several threads log records continuously while the main
+        //:   thread repeatedly creates, starts, and destroys a deferred
+        //:   logger publishing to the observer of the logger manager.
+        //:   Verify that the number of records published, plus the number of
+        //:   records dropped, is the number of records logged.  (C-1..2)
+        //
+        // Testing:
+        //   STOPPING WHILE LOGGING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STOPPING WHILE LOGGING" << endl
+                          << "======================" << endl;
+
+        RecordingObserver                observer;
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_TRACE,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+        ball::LoggerManagerScopedGuard guard(&observer, configuration);
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const int NUM_THREADS = 4;
+        const int NUM_RECORDS = 5000;
+
+        bsls::AtomicInt numDone(0);
+        LogAndCountArgs args = { NUM_RECORDS, &numDone };
+
+        bslmt::ThreadUtil::Handle handles[NUM_THREADS];
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  &logAndCountThread,
+                                                  &args));
+        }
+
+        // The buffers are large enough for all the records of their thread,
+        // so that no record is dropped.
+
+        int numRounds = 0;
+        while (NUM_THREADS > numDone) {
+            Obj mX(&observer, 1 << 22, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            bslmt::ThreadUtil::microSleep(numRounds % 2 ? 0 : 100);
+
+            if (numRounds % 4) {
+                mX.stop();
+            }
+            ASSERT(0 == X.numRecordsDropped());
+            ++numRounds;
+        }
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        if (veryVerbose) {
+            P_(numRounds) P(observer.numRecords())
+        }
+
+        ASSERTV(observer.numRecords(),
+                NUM_THREADS * NUM_RECORDS == observer.numRecords());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOGGING
+        //
+        // Concerns:
+        //: 1 Records logged concurrently by several threads are all
+        //:   published, unless dropped, and the records of each thread are
+        //:   published in order, with the id of that thread.
+        //:
+        //: 2 The buffers of exited threads are released.
+        //
+        // Plan:
+        //: 1 Start a deferred logger with small buffers, and have several
+        //:   threads each log a sequence of records.  Verify that the
+        //:   number of records published and dropped adds up, and that the
+        //:   sequence numbers published for each thread are increasing.
+        //:   (C-1)
+        //:
+        //: 2 Verify, using a test allocator, that the memory in use by the
+        //:   deferred logger returns to its initial level once the threads
+        //:   have exited and their records have been published.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT LOGGING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOGGING" << endl
+                          << "==================" << endl;
+
+        RecordingObserver                observer;
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_TRACE,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+        ball::LoggerManagerScopedGuard guard(&observer, configuration);
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const int NUM_THREADS = 4;
+        const int NUM_RECORDS = 20000;
+
+        Obj mX(&observer, 4096, &ta);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        const bsls::Types::Int64 numBytesInitial = ta.numBytesInUse();
+
+        bslmt::ThreadUtil::Handle handles[NUM_THREADS];
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                            &handles[i],
+                            &logSequenceThread,
+                            reinterpret_cast<void *>(
+                                  static_cast<bsls::Types::IntPtr>(
+                                                              NUM_RECORDS))));
+        }
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        // Wait for the publication thread to release the buffers of the
+        // exited threads.  Note that the vectors of the logger may retain
+        // a small amount of memory.
+
+        for (int i = 0; i < 5000
+                     && ta.numBytesInUse() - numBytesInitial >= 4096; ++i) {
+            bslmt::ThreadUtil::microSleep(1000);
+        }
+        ASSERTV(numBytesInitial, ta.numBytesInUse(),
+                ta.numBytesInUse() - numBytesInitial < 4096);
+
+        mX.stop();
+
+        if (veryVerbose) {
+            P_(X.numRecordsPublished()) P(X.numRecordsDropped())
+        }
+
+        ASSERT(NUM_THREADS * NUM_RECORDS
+                         == X.numRecordsPublished() + X.numRecordsDropped());
+        ASSERT(X.numRecordsPublished() == observer.numRecords());
+
+        bsl::vector<bsls::Types::Uint64> threadIds;
+        bsl::vector<int>                 lastSequence;
+        for (int i = 0; i < observer.numRecords(); ++i) {
+            bsl::size_t t = 0;
+            while (t < threadIds.size()
+                && threadIds[t] != observer.threadId(i)) {
+                ++t;
+            }
+            if (t == threadIds.size()) {
+                threadIds.push_back(observer.threadId(i));
+                lastSequence.push_back(-1);
+            }
+
+            int sequence;
+            ASSERT(1 == bsl::sscanf(observer.message(i).c_str(),
+                                    "sequence %d",
+                                    &sequence));
+            ASSERTV(i, lastSequence[t], sequence,
+                    lastSequence[t] < sequence);
+            lastSequence[t] = sequence;
+        }
+        ASSERT(NUM_THREADS >= static_cast<int>(threadIds.size()));
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DEFERRED LOGGING
+        //
+        // Concerns:
+        //: 1 When a deferred logger is started, the macros copy their records
+        //:   to it, and it publishes them to its observer, not to the logger
+        //:   manager, with the attributes of the logging statement.
+        //:
+        //: 2 The timestamp of a record is the time it was logged.
+        //:
+        //: 3 A record that does not fit in the buffer of its thread is
+        //:   dropped and counted.
+        //:
+        //: 4 'stop' publishes all outstanding records.
+        //
+        // Plan:
+        //: 1 Install a logger manager with one observer, and start a deferred
+        //:   logger publishing to another.  Log records with each of the
+        //:   macros, stop the deferred logger, and verify the records
+        //:   published to each observer.  (C-1..2, 4)
+        //:
+        //: 2 Log a record whose arguments exceed the capacity of the buffer
+        //:   and verify that it is dropped.  (C-3)
+        //
+        // Testing:
+        //   BALL_LOGDEFER0 .. BALL_LOGDEFER9 (DEFERRED)
+        //   bsls::Types::Int64 numRecordsDropped() const;
+        //   bsls::Types::Int64 numRecordsPublished() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEFERRED LOGGING" << endl
+                          << "================" << endl;
+
+        ball::TestObserver managerObserver(bsl::cout);
+        ball::TestObserver observer(bsl::cout);
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_TRACE,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+        ball::LoggerManagerScopedGuard guard(&managerObserver, configuration);
+
+        BALL_LOG_SET_CATEGORY("DEFERRED");
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(&observer, 4096, &ta);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        const bsls::TimeInterval before = bdlt::CurrentTime::now();
+
+        BALL_LOGDEFER0(Sev::e_WARN, "zero");
+        const int LINE = __LINE__ - 1;
+        BALL_LOGDEFER1(Sev::e_INFO, "%d", 1);
+        BALL_LOGDEFER2(Sev::e_INFO, "%d %d", 1, 2);
+        BALL_LOGDEFER3(Sev::e_INFO, "%d %d %d", 1, 2, 3);
+        BALL_LOGDEFER4(Sev::e_INFO, "%d %d %d %d", 1, 2, 3, 4);
+        BALL_LOGDEFER5(Sev::e_INFO, "%d %d %d %d %d", 1, 2, 3, 4, 5);
+        BALL_LOGDEFER6(Sev::e_INFO, "%d %d %d %d %d %d", 1, 2, 3, 4, 5, 6);
+        BALL_LOGDEFER7(Sev::e_INFO, "%d %d %d %d %d %d %d",
+                       1, 2, 3, 4, 5, 6, 7);
+        BALL_LOGDEFER8(Sev::e_INFO, "%d %d %d %d %d %d %d %d",
+                       1, 2, 3, 4, 5, 6, 7, 8);
+        BALL_LOGDEFER9(Sev::e_ERROR, "%d %d %d %d %d %d %d %d %s",
+                       1, 2, 3, 4, 5, 6, 7, 8, bsl::string("nine"));
+
+        ASSERT(0 == X.numRecordsDropped());
+
+        // Too large for the buffer.
+
+        const bsl::string LARGE(5000, 'x');
+        BALL_LOGDEFER1(Sev::e_INFO, "%s", LARGE);
+        ASSERT(1 == X.numRecordsDropped());
+
+        mX.stop();
+        ASSERT(!X.isStarted());
+
+        const bsls::TimeInterval after = bdlt::CurrentTime::now();
+
+        ASSERT(0  == managerObserver.numPublishedRecords());
+        ASSERT(10 == observer.numPublishedRecords());
+        ASSERT(10 == X.numRecordsPublished());
+
+        const ball::RecordAttributes& attributes =
+                                  observer.lastPublishedRecord().fixedFields();
+        ASSERTV(attributes.message(),
+                0 == bsl::strcmp("1 2 3 4 5 6 7 8 nine",
+                                 attributes.message()));
+        ASSERT(0 == bsl::strcmp("DEFERRED", attributes.category()));
+        ASSERT(0 == bsl::strcmp(__FILE__, attributes.fileName()));
+        ASSERT(LINE < attributes.lineNumber());
+        ASSERT(Sev::e_ERROR == attributes.severity());
+        ASSERT(bslmt::ThreadUtil::selfIdAsUint64() == attributes.threadID());
+
+        const bsls::TimeInterval timestamp =
+                    bdlt::EpochUtil::convertToTimeInterval(
+                                                      attributes.timestamp());
+        ASSERT(before.totalMilliseconds() <= timestamp.totalMilliseconds());
+        ASSERT(timestamp.totalMilliseconds() <= after.totalMilliseconds());
+
+        // Records logged once stopped are logged synchronously.
+
+        BALL_LOGDEFER0(Sev::e_WARN, "synchronous");
+        ASSERT(1 == managerObserver.numPublishedRecords());
+        ASSERT(10 == observer.numPublishedRecords());
+        ASSERT(0 == bsl::strcmp(
+                     "synchronous",
+                     managerObserver.lastPublishedRecord().fixedFields()
+                                                                .message()));
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CREATORS, START, AND STOP
+        //
+        // Concerns:
+        //: 1 A newly created deferred logger is not started.
+        //:
+        //: 2 'start' starts the logger, and is idempotent; at most one logger
+        //:   may be started at a time.
+        //:
+        //: 3 'stop' stops the logger, and is idempotent; a stopped logger may
+        //:   be restarted.
+        //:
+        //: 4 The destructor stops the logger and releases all memory.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create two loggers and exercise 'start' and 'stop' on each in
+        //:   turn, verifying 'isStarted' after each call.  (C-1..3)
+        //:
+        //: 2 Destroy a started logger that has allocated a buffer, and verify
+        //:   that its allocator has no memory in use.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   DeferredLogger(Observer *, int, Allocator * = 0);
+        //   ~DeferredLogger();
+        //   int start();
+        //   void stop();
+        //   bool isStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, START, AND STOP" << endl
+                          << "=========================" << endl;
+
+        NullObserver         observer;
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&observer, 1024, &ta);  const Obj& X = mX;
+            Obj mY(&observer, 1024, &ta);  const Obj& Y = mY;
+
+            ASSERT(!X.isStarted());
+            ASSERT(!Y.isStarted());
+            ASSERT(0 == X.numRecordsDropped());
+            ASSERT(0 == X.numRecordsPublished());
+
+            ASSERT(0 == mX.start());
+            ASSERT( X.isStarted());
+            ASSERT(0 == mX.start());
+            ASSERT( X.isStarted());
+
+            ASSERT(0 != mY.start());
+            ASSERT(!Y.isStarted());
+
+            mX.stop();
+            ASSERT(!X.isStarted());
+            mX.stop();
+            ASSERT(!X.isStarted());
+
+            ASSERT(0 == mY.start());
+            ASSERT( Y.isStarted());
+            mY.stop();
+
+            ASSERT(0 == mX.start());
+            ASSERT( X.isStarted());
+
+            // Allocate a buffer for this thread.
+
+            BALL_LOG_SET_CATEGORY("TEST");
+            BALL_LOGDEFER0(Sev::e_FATAL, "message");
+
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0, 1024, &ta));
+            ASSERT_FAIL(Obj(&observer, 63, &ta));
+            ASSERT_PASS(Obj(&observer, 64, &ta));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SYNCHRONOUS LOGGING
+        //
+        // Concerns:
+        //: 1 When no deferred logger is started, the macros log their record
+        //:   synchronously through the logger manager, with the formatted
+        //:   message, file, line, category, and severity of the statement.
+        //:
+        //: 2 The macros honor the thresholds of their category.
+        //:
+        //: 3 Arguments of every supported type are logged, whether or not
+        //:   their encoding fits in a small local buffer.
+        //
+        // Plan:
+        //: 1 Install a logger manager with a test observer and log records
+        //:   with each of the macros, verifying the published record after
+        //:   each.  (C-1)
+        //:
+        //: 2 Log at a severity below the pass threshold, and verify that no
+        //:   record is published.  (C-2)
+        //:
+        //: 3 Log a record with a long string argument.  (C-3)
+        //
+        // Testing:
+        //   BALL_LOGDEFER0 .. BALL_LOGDEFER9 (SYNCHRONOUS)
+        //   void log(const DeferredLogFormat *, const Category *, int, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SYNCHRONOUS LOGGING" << endl
+                          << "===================" << endl;
+
+        ball::TestObserver observer(bsl::cout);
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_INFO,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+        ball::LoggerManagerScopedGuard guard(&observer, configuration);
+
+        BALL_LOG_SET_CATEGORY("SYNCHRONOUS");
+
+#define CHECK_LAST(EXPECTED, SEVERITY) {                                      \
+            const ball::RecordAttributes& attributes =                        \
+                                observer.lastPublishedRecord().fixedFields(); \
+            ASSERTV(attributes.message(),                                     \
+                    0 == bsl::strcmp(EXPECTED, attributes.message()));        \
+            ASSERT(SEVERITY == attributes.severity());                        \
+            ASSERT(0 == bsl::strcmp("SYNCHRONOUS", attributes.category()));   \
+            ASSERT(0 == bsl::strcmp(__FILE__, attributes.fileName()));        \
+        }
+
+        int numPublished = 0;
+
+        const int ZERO_LINE = __LINE__ + 1;
+        BALL_LOGDEFER0(Sev::e_INFO, "zero %d");
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("zero %d", Sev::e_INFO);
+        ASSERT(ZERO_LINE ==
+                    observer.lastPublishedRecord().fixedFields().lineNumber());
+
+        BALL_LOGDEFER1(Sev::e_WARN, "one %s", "a");
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("one a", Sev::e_WARN);
+
+        BALL_LOGDEFER2(Sev::e_ERROR, "two %s %u", bsl::string("b"), 2u);
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("two b 2", Sev::e_ERROR);
+
+        BALL_LOGDEFER3(Sev::e_INFO, "%c%c%c", 'a', 'b', 'c');
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("abc", Sev::e_INFO);
+
+        BALL_LOGDEFER4(Sev::e_INFO, "%ld %lu %lld %llu",
+                       -1L, 2UL, -3LL, 4ULL);
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("-1 2 -3 4", Sev::e_INFO);
+
+        BALL_LOGDEFER5(Sev::e_INFO, "%hd %hu %d %.1f %.1f",
+                       static_cast<short>(-5),
+                       static_cast<unsigned short>(5),
+                       e_TEST_ENUM_VALUE,
+                       0.5f,
+                       1.5);
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("-5 5 7 0.5 1.5", Sev::e_INFO);
+
+        BALL_LOGDEFER6(Sev::e_INFO, "%d %d %s %s %s %s",
+                       true,
+                       static_cast<signed char>(-6),
+                       bslstl::StringRef("ref"),
+                       native_std::string("std"),
+                       static_cast<const char *>(0),
+                       const_cast<char *>("mutable"));
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("1 -6 ref std (null) mutable", Sev::e_INFO);
+
+        BALL_LOGDEFER7(Sev::e_INFO, "%d%d%d%d%d%d%d", 1, 2, 3, 4, 5, 6, 7);
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("1234567", Sev::e_INFO);
+
+        BALL_LOGDEFER8(Sev::e_INFO, "%d%d%d%d%d%d%d%d",
+                       1, 2, 3, 4, 5, 6, 7, 8);
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("12345678", Sev::e_INFO);
+
+        BALL_LOGDEFER9(Sev::e_INFO, "%d%d%d%d%d%d%d%d%d",
+                       1, 2, 3, 4, 5, 6, 7, 8, 9);
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST("123456789", Sev::e_INFO);
+
+        if (verbose) cout << "\tThresholds." << endl;
+
+        BALL_LOGDEFER1(Sev::e_DEBUG, "debug %d", 1);
+        ASSERT(numPublished == observer.numPublishedRecords());
+
+        if (verbose) cout << "\tLarge entries." << endl;
+
+        const bsl::string LARGE(1000, 'L');
+        BALL_LOGDEFER2(Sev::e_INFO, "%s%s", LARGE, LARGE);
+        ASSERT(++numPublished == observer.numPublishedRecords());
+        CHECK_LAST((LARGE + LARGE).c_str(), Sev::e_INFO);
+
+#undef CHECK_LAST
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'formatMessage'
+        //
+        // Concerns:
+        //: 1 Text outside conversion specifications, and '%%', are output
+        //:   verbatim.
+        //:
+        //: 2 Each conversion specification, including its flags, width, and
+        //:   precision, is applied as by 'printf' to the canonical value of
+        //:   the corresponding argument, ignoring length modifiers.
+        //:
+        //: 3 '*' widths and precisions consume an argument.
+        //:
+        //: 4 An argument whose type does not match its conversion is output
+        //:   according to its type.
+        //:
+        //: 5 Conversion specifications for which no argument is available,
+        //:   and invalid or truncated specifications, are output verbatim.
+        //:
+        //: 6 Extra arguments are ignored.
+        //
+        // Plan:
+        //: 1 Using a table-driven technique, format a set of formats and
+        //:   arguments, and verify the result.  (C-1..6)
+        //
+        // Testing:
+        //   void formatMessage(streambuf *, const char *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'formatMessage'" << endl
+                          << "============================" << endl;
+
+        const Arg I  = ArgUtil::convert(-42);
+        const Arg U  = ArgUtil::convert(42u);
+        const Arg D  = ArgUtil::convert(3.25);
+        const Arg S  = ArgUtil::convert("str");
+        const Arg W  = ArgUtil::convert(6);
+        const Arg NW = ArgUtil::convert(-6);
+        const Arg C  = ArgUtil::convert('x');
+        const Arg N  = ArgUtil::convert(static_cast<const void *>(0));
+
+        char pointerText[32];
+        snprintf(pointerText, sizeof pointerText, "%p",
+                 static_cast<const void *>(0));
+
+        const struct {
+            int         d_line;
+            const char *d_format;
+            Arg         d_args[3];
+            int         d_numArgs;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  FORMAT          ARGS          #  EXPECTED
+            //----  --------------  ------------  -  ------------------
+            { L_,   "",             {},           0, ""                  },
+            { L_,   "abc",          {},           0, "abc"               },
+            { L_,   "100%%",        {},           0, "100%"              },
+            { L_,   "%d",           { I },        1, "-42"               },
+            { L_,   "%i",           { I },        1, "-42"               },
+            { L_,   "%5d|",         { I },        1, "  -42|"            },
+            { L_,   "%-5d|",        { I },        1, "-42  |"            },
+            { L_,   "%+d",          { U },        1, "+42"               },
+            { L_,   "%05d",         { I },        1, "-0042"             },
+            { L_,   "%ld %lld",     { I, U },     2, "-42 42"            },
+            { L_,   "%hhd",         { I },        1, "-42"               },
+            { L_,   "%zu",          { U },        1, "42"                },
+            { L_,   "%x %X %o",     { U, U, U },  3, "2a 2A 52"          },
+            { L_,   "%#x",          { U },        1, "0x2a"              },
+            { L_,   "%u",           { I },        1, "18446744073709551574"},
+            { L_,   "%c",           { C },        1, "x"                 },
+            { L_,   "%f",           { D },        1, "3.250000"          },
+            { L_,   "%.1f",         { D },        1, "3.2"               },
+            { L_,   "%8.3e",        { D },        1, "3.250e+00"         },
+            { L_,   "%g",           { D },        1, "3.25"              },
+            { L_,   "%Lf",          { D },        1, "3.250000"          },
+            { L_,   "%s",           { S },        1, "str"               },
+            { L_,   "[%5s]",        { S },        1, "[  str]"           },
+            { L_,   "[%-5s]",       { S },        1, "[str  ]"           },
+            { L_,   "[%.2s]",       { S },        1, "[st]"              },
+            { L_,   "[%*d]",        { W, I },     2, "[   -42]"          },
+            { L_,   "[%*d]",        { NW, I },    2, "[-42   ]"          },
+            { L_,   "[%.*s]",       { W, S },     2, "[str]"             },
+            { L_,   "[%.*f]",       { NW, D },    2, "[3.250000]"        },
+
+            // Mismatched types.
+
+            { L_,   "%d",           { S },        1, "str"               },
+            { L_,   "%s",           { I },        1, "-42"               },
+            { L_,   "%s",           { U },        1, "42"                },
+            { L_,   "%d",           { D },        1, "3.25"              },
+            { L_,   "%f",           { I },        1, "-42.000000"        },
+            { L_,   "%.1f",         { U },        1, "42.0"              },
+
+            // Missing, invalid, and extra arguments.
+
+            { L_,   "%d",           {},           0, "%d"                },
+            { L_,   "%d %5.2f",     { I },        1, "-42 %5.2f"         },
+            { L_,   "%*d",          { W },        1, "%*d"               },
+            { L_,   "%y %d",        { I },        1, "%y -42"            },
+            { L_,   "abc %",        {},           0, "abc %"             },
+            { L_,   "abc %-5",      { I },        1, "abc %-5"           },
+            { L_,   "%d",           { I, U },     2, "-42"               },
+            { L_,   "%n%d",         { I, U },     2, "42"                },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE     = DATA[ti].d_line;
+            const char        *FORMAT   = DATA[ti].d_format;
+            const Arg         *ARGS     = DATA[ti].d_args;
+            const int          NUM_ARGS = DATA[ti].d_numArgs;
+            const bsl::string  EXPECTED = DATA[ti].d_expected;
+
+            const bsl::string result = formatEncoded(FORMAT, ARGS, NUM_ARGS);
+
+            if (veryVerbose) { T_ P_(LINE) P_(FORMAT) P(result) }
+
+            ASSERTV(LINE, FORMAT, EXPECTED, result, EXPECTED == result);
+        }
+
+        if (verbose) cout << "\tPointers." << endl;
+        {
+            ASSERT(pointerText == formatEncoded("%p", &N, 1));
+            ASSERT(pointerText == formatEncoded("%d", &N, 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ARGUMENT ENCODING
+        //
+        // Concerns:
+        //: 1 Each supported argument type is converted to the expected
+        //:   canonical type and value.
+        //:
+        //: 2 The characters of string arguments are referred to, not copied,
+        //:   by the converted argument, and copied, null-terminated, by
+        //:   'encode'.
+        //:
+        //: 3 'encode' writes exactly 'encodedSize()' bytes, a multiple of 8,
+        //:   and 'decode' reads them back.
+        //
+        // Plan:
+        //: 1 Convert a value of each supported type and verify the tag and
+        //:   value of the result.  (C-1..2)
+        //:
+        //: 2 Encode and decode a sequence of arguments, including strings of
+        //:   every length modulo 8, and verify the decoded values.  (C-3)
+        //
+        // Testing:
+        //   DeferredLogger_ArgUtil::convert
+        //   DeferredLogger_Arg::encode
+        //   DeferredLogger_Arg::decode
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARGUMENT ENCODING" << endl
+                          << "=================" << endl;
+
+        if (verbose) cout << "\tConversion." << endl;
+        {
+            ASSERT(Arg::e_INT64  == ArgUtil::convert(true).d_tag);
+            ASSERT(Arg::e_INT64  == ArgUtil::convert('c').d_tag);
+            ASSERT(Arg::e_INT64  == ArgUtil::convert(
+                                          static_cast<signed char>(1)).d_tag);
+            ASSERT(Arg::e_UINT64 == ArgUtil::convert(
+                                        static_cast<unsigned char>(1)).d_tag);
+            ASSERT(Arg::e_INT64  == ArgUtil::convert(
+                                                static_cast<short>(1)).d_tag);
+            ASSERT(Arg::e_UINT64 == ArgUtil::convert(
+                                       static_cast<unsigned short>(1)).d_tag);
+            ASSERT(Arg::e_INT64  == ArgUtil::convert(-1).d_tag);
+            ASSERT(Arg::e_UINT64 == ArgUtil::convert(1u).d_tag);
+            ASSERT(Arg::e_INT64  == ArgUtil::convert(-1L).d_tag);
+            ASSERT(Arg::e_UINT64 == ArgUtil::convert(1UL).d_tag);
+            ASSERT(Arg::e_INT64  == ArgUtil::convert(-1LL).d_tag);
+            ASSERT(Arg::e_UINT64 == ArgUtil::convert(1ULL).d_tag);
+            ASSERT(Arg::e_INT64  == ArgUtil::convert(e_TEST_ENUM_VALUE).d_tag);
+            ASSERT(Arg::e_DOUBLE == ArgUtil::convert(1.5f).d_tag);
+            ASSERT(Arg::e_DOUBLE == ArgUtil::convert(1.5).d_tag);
+            ASSERT(Arg::e_DOUBLE == ArgUtil::convert(
+                                          static_cast<long double>(1)).d_tag);
+
+            ASSERT(-1   == ArgUtil::convert(-1LL).d_value.d_int64);
+            ASSERT(~0ULL == ArgUtil::convert(~0ULL).d_value.d_uint64);
+            ASSERT(1.5  == ArgUtil::convert(1.5f).d_value.d_double);
+            ASSERT(7    == ArgUtil::convert(
+                                         e_TEST_ENUM_VALUE).d_value.d_int64);
+
+            const char        *CSTR = "abc";
+            char               MSTR[] = "defg";
+            const bsl::string  BSTR("hijkl");
+            native_std::string NSTR("mnopqr");
+            bslstl::StringRef  SREF(CSTR, 2);
+
+            Arg a = ArgUtil::convert(CSTR);
+            ASSERT(Arg::e_STRING == a.d_tag);
+            ASSERT(CSTR == a.d_value.d_string_p);
+            ASSERT(3 == a.d_length);
+
+            a = ArgUtil::convert(MSTR);
+            ASSERT(Arg::e_STRING == a.d_tag);
+            ASSERT(MSTR == a.d_value.d_string_p);
+            ASSERT(4 == a.d_length);
+
+            a = ArgUtil::convert(BSTR);
+            ASSERT(Arg::e_STRING == a.d_tag);
+            ASSERT(BSTR.data() == a.d_value.d_string_p);
+            ASSERT(5 == a.d_length);
+
+            a = ArgUtil::convert(NSTR);
+            ASSERT(Arg::e_STRING == a.d_tag);
+            ASSERT(NSTR.data() == a.d_value.d_string_p);
+            ASSERT(6 == a.d_length);
+
+            a = ArgUtil::convert(SREF);
+            ASSERT(Arg::e_STRING == a.d_tag);
+            ASSERT(CSTR == a.d_value.d_string_p);
+            ASSERT(2 == a.d_length);
+
+            a = ArgUtil::convert(static_cast<const char *>(0));
+            ASSERT(Arg::e_STRING == a.d_tag);
+            ASSERT(0 == bsl::strcmp("(null)", a.d_value.d_string_p));
+
+            int  value = 0;
+            int *pointer = &value;
+            a = ArgUtil::convert(pointer);
+            ASSERT(Arg::e_POINTER == a.d_tag);
+            ASSERT(&value == a.d_value.d_pointer_p);
+
+            a = ArgUtil::convert(static_cast<const void *>(CSTR));
+            ASSERT(Arg::e_POINTER == a.d_tag);
+            ASSERT(CSTR == a.d_value.d_pointer_p);
+        }
+
+        if (verbose) cout << "\tEncoding and decoding." << endl;
+        {
+            const char *TEXT = "0123456789abcdefghij";
+
+            bsl::vector<Arg> args;
+            for (int length = 0; length <= 17; ++length) {
+                args.push_back(ArgUtil::convert(bslstl::StringRef(TEXT,
+                                                                  length)));
+                args.push_back(ArgUtil::convert(length));
+            }
+            args.push_back(ArgUtil::convert(-2.5));
+            args.push_back(ArgUtil::convert(~0ULL));
+            args.push_back(ArgUtil::convert(static_cast<void *>(&args)));
+
+            int totalSize = 0;
+            for (bsl::size_t i = 0; i < args.size(); ++i) {
+                const int size = args[i].encodedSize();
+                ASSERTV(i, 0 == size % 8);
+                totalSize += size;
+            }
+
+            bsl::vector<bsls::Types::Int64> storage(totalSize / 8 + 1, -1);
+            char *buffer = reinterpret_cast<char *>(&storage[0]);
+            char *end    = buffer;
+            for (bsl::size_t i = 0; i < args.size(); ++i) {
+                char *next = args[i].encode(end);
+                ASSERTV(i, next - end == args[i].encodedSize());
+                end = next;
+            }
+            ASSERT(-1 == storage.back());
+
+            const char *cursor = buffer;
+            for (bsl::size_t i = 0; i < args.size(); ++i) {
+                const Arg decoded = Arg::decode(&cursor);
+                ASSERTV(i, args[i].d_tag == decoded.d_tag);
+                ASSERTV(i, args[i].d_length == decoded.d_length);
+                if (Arg::e_STRING == decoded.d_tag) {
+                    ASSERTV(i, 0 == bsl::memcmp(args[i].d_value.d_string_p,
+                                                decoded.d_value.d_string_p,
+                                                decoded.d_length));
+                    ASSERTV(i, '\0' ==
+                                decoded.d_value.d_string_p[decoded.d_length]);
+                }
+                else {
+                    ASSERTV(i, args[i].d_value.d_uint64
+                                              == decoded.d_value.d_uint64);
+                }
+            }
+            ASSERT(end == cursor);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Log a record synchronously, then through a started deferred
+        //:   logger, and verify both are published.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ball::TestObserver observer(bsl::cout);
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_TRACE,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+        ball::LoggerManagerScopedGuard guard(&observer, configuration);
+
+        BALL_LOG_SET_CATEGORY("BREATHING");
+
+        BALL_LOGDEFER2(Sev::e_INFO, "%s=%d", "x", 1);
+        ASSERT(1 == observer.numPublishedRecords());
+        ASSERT(0 == bsl::strcmp(
+                     "x=1",
+                     observer.lastPublishedRecord().fixedFields().message()));
+
+        Obj mX(&observer, 1024);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        BALL_LOGDEFER2(Sev::e_INFO, "%s=%d", "y", 2);
+
+        mX.stop();
+
+        ASSERT(2 == observer.numPublishedRecords());
+        ASSERT(1 == X.numRecordsPublished());
+        ASSERT(0 == bsl::strcmp(
+                     "y=2",
+                     observer.lastPublishedRecord().fixedFields().message()));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COST OF A LOGGING STATEMENT
+        //
+        // Concerns:
+        //: 1 A deferred logging statement is substantially cheaper, for the
+        //:   logging thread, than the equivalent 'BALL_LOG*' statement.
+        //
+        // Plan:
+        //: 1 Time a loop of 'BALL_LOG3' statements, and the same loop of
+        //:   'BALL_LOGDEFER3' statements with a started deferred logger,
+        //:   publishing to an observer that discards the records, and report
+        //:   the cost per statement.
+        //
+        // Testing:
+        //   PERFORMANCE: COST OF A LOGGING STATEMENT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: COST OF A LOGGING STATEMENT"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        NullObserver observer;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_TRACE,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+        ball::LoggerManagerScopedGuard guard(&observer, configuration);
+
+        BALL_LOG_SET_CATEGORY("PERFORMANCE");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        bsls::Stopwatch timer;
+
+        timer.start(true);
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            BALL_LOG3(Sev::e_INFO, "order: %s %d @ %.2f", "IBM", i, 145.5);
+        }
+        timer.stop();
+
+        const double synchronous = timer.elapsedTime() * 1e9 / NUM_ITERATIONS;
+
+        Obj mX(&observer, 1 << 24);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            BALL_LOGDEFER3(Sev::e_INFO,
+                           "order: %s %d @ %.2f", "IBM", i, 145.5);
+        }
+        timer.stop();
+
+        const double deferred = timer.elapsedTime() * 1e9 / NUM_ITERATIONS;
+
+        mX.stop();
+
+        cout << "BALL_LOG3:      " << synchronous << " ns/statement\n"
+             << "BALL_LOGDEFER3: " << deferred    << " ns/statement ("
+             << X.numRecordsDropped() << " dropped)" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -511,6 +511,15 @@ class FileObserver : public Observer {
         // 'stdout' if the severity of 'record' is at least as severe as the
         // severity level specified at construction.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified sequence of 'numRecords' log 'records', in
+        // order, with the same effect as calling 'publish' on each of them,
+        // except that the records written to 'stdout' are written with a
+        // single call to 'fwrite', and the records written to the log file are
+        // written as described by 'FileObserver2::publishBatch'.  The behavior
+        // is undefined unless '0 <= numRecords', and 'records' refers to an
+        // array of at least 'numRecords' valid addresses.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
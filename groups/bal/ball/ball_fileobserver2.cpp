@@ -54,6 +54,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -341,6 +343,58 @@ static bdlt::Datetime computeNextRotationTime(
                           // -------------------
 
 // PRIVATE MANIPULATORS
+void FileObserver2::flushBatch()
+{
+    const int length = static_cast<int>(d_batchStreamBuf.length());
+    if (0 == length) {
+        return;                                                       // RETURN
+    }
+
+    if (d_logStreamBuf.isOpened()) {
+        // Flush the characters buffered by 'd_logStreamBuf' (if any) so that
+        // they precede the batch in the log file.
+
+        d_logOutStream.flush();
+
+        if (!d_logOutStream
+         || length != bdls::FilesystemUtil::write(
+                                               d_logStreamBuf.fileDescriptor(),
+                                               d_batchStreamBuf.data(),
+                                               length)) {
+            fprintf(stderr, "%s Error on file stream for %s: %s\n",
+                    errorMsgPrefix,
+                    d_logFileName.c_str(), bsl::strerror(getErrorCode()));
+
+            d_logStreamBuf.clear();
+        }
+    }
+
+    d_batchStreamBuf.pubseekpos(0);
+}
+
+bool FileObserver2::isRotationNecessary(
+                                 const bdlt::Datetime& currentLogTimeUtc,
+                                 bsls::Types::Int64    numPendingBytes)
+{
+    BSLS_ASSERT(d_logStreamBuf.isOpened());
+
+    if (d_rotationSize) {
+        // 'tellp' returns -1 on failure.  Rotate the log file if either
+        // 'tellp' fails, or the rotation size is exceeded.
+
+        const bsls::Types::Int64 offset = d_logOutStream.tellp();
+
+        if (0 > offset
+         || static_cast<bsls::Types::Uint64>(offset + numPendingBytes) >
+            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+            return true;                                              // RETURN
+        }
+    }
+
+    return d_rotationInterval.totalSeconds()
+        && d_nextRotationTimeUtc <= currentLogTimeUtc;
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -476,19 +530,7 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
         return 1;                                                     // RETURN
     }
 
-    if (d_rotationSize) {
-        // 'tellp' returns -1 on failure.  Rotate the log file if either
-        // 'tellp' fails, or the rotation size is exceeded.
-
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
-            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
-
-            return rotateFile(rotatedLogFileName);                    // RETURN
-        }
-    }
-
-    if (d_rotationInterval.totalSeconds()
-     && d_nextRotationTimeUtc <= currentLogTimeUtc) {
+    if (isRotationNecessary(currentLogTimeUtc, 0)) {
         return rotateFile(rotatedLogFileName);                        // RETURN
     }
     return 1;
@@ -498,6 +540,8 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
 FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 : d_logStreamBuf(bdls::FilesystemUtil::k_INVALID_FD, false)
 , d_logOutStream(&d_logStreamBuf)
+, d_batchStreamBuf(basicAllocator)
+, d_batchOutStream(&d_batchStreamBuf)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -656,6 +700,58 @@ void FileObserver2::publish(const Record&  record,
     }
 }
 
+void FileObserver2::publishBatch(const Record *const *records,
+                                 int                  numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    typedef bsl::pair<int, bsl::string> Rotation;
+
+    bsl::vector<Rotation> rotations;  // status and name of each rotation
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_batchStreamBuf.pubseekpos(0);
+        d_batchOutStream.clear();
+
+        for (int i = 0; i < numRecords; ++i) {
+            const Record& record = *records[i];
+
+            if (d_logStreamBuf.isOpened()
+             && isRotationNecessary(record.fixedFields().timestamp(),
+                                    d_batchStreamBuf.length())) {
+                // The preceding records of the batch belong to the log file
+                // being rotated.
+
+                flushBatch();
+
+                rotations.push_back(Rotation());
+                rotations.back().first = rotateFile(&rotations.back().second);
+            }
+
+            if (d_logStreamBuf.isOpened()) {
+                d_logFileFunctor(d_batchOutStream, record);
+            }
+        }
+
+        flushBatch();
+    }
+
+    // The file-rotation callback must be invoked without a lock on 'd_mutex'
+    // to allow the callback to invoke other manipulators on this object.
+
+    for (bsl::size_t i = 0; i < rotations.size(); ++i) {
+        if (0 >= rotations[i].first) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+            if (d_onRotationCb) {
+                d_onRotationCb(rotations[i].first, rotations[i].second);
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
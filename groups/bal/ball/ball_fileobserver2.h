@@ -166,6 +166,17 @@ BSLS_IDENT("$Id: $")
 // Note that timestamp pattern elements in a log file name are typically
 // selected so they produce unique names for each rotation.
 //
+///Batched Publication
+///-------------------
+// Each call to 'publish' writes one record to the log file, and so costs (at
+// least) one system call.  A client holding several records at once (e.g., a
+// publication thread draining a queue) may instead call 'publishBatch', which
+// formats the records into a single, reusable buffer, and writes that buffer
+// to the log file with one system call.  The rotation rules are applied to
+// each record of a batch exactly as they would be by 'publish': if the log
+// file must be rotated before a record, the records preceding it are written
+// to the old log file first.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -229,6 +240,10 @@ BSLS_IDENT("$Id: $")
 #include <bdls_fdstreambuf.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
+#include <bdlsb_memoutstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIME
 #include <bdlt_datetime.h>
 #endif
@@ -249,6 +264,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_FSTREAM
 #include <bsl_fstream.h>
 #endif
@@ -319,6 +338,17 @@ class FileObserver2 : public Observer {
                                                        // to the buffer
                                                        // 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // reusable buffer in
+                                                       // which a batch of
+                                                       // records is formatted
+                                                       // (see 'publishBatch')
+
+    bsl::ostream           d_batchOutStream;           // output stream for
+                                                       // formatting a batch
+                                                       // (refers to the
+                                                       // buffer
+                                                       // 'd_batchStreamBuf')
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current filename
@@ -376,6 +406,23 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    void flushBatch();
+        // Write the records formatted in the batch buffer of this file
+        // observer to the log file with a single system call, and reset the
+        // batch buffer to empty.  If the write fails, close the log file.
+        // This method has no effect if the batch buffer is empty.  The
+        // behavior is undefined unless the caller acquired the lock for this
+        // object.
+
+    bool isRotationNecessary(const bdlt::Datetime& currentLogTimeUtc,
+                             bsls::Types::Int64    numPendingBytes);
+        // Return 'true' if a record having the specified 'currentLogTimeUtc'
+        // timestamp must be preceded by a log file rotation, given that the
+        // specified 'numPendingBytes' formatted bytes have yet to be written
+        // to the log file, and 'false' otherwise.  The behavior is undefined
+        // unless the log file is opened and the caller acquired the lock for
+        // this object.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
@@ -515,6 +562,16 @@ class FileObserver2 : public Observer {
         // a file if file logging is enabled for this file observer.  The
         // method has no effect if file logging is not enabled.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified sequence of 'numRecords' log 'records', in
+        // order, with the same effect as calling 'publish' on each of them,
+        // except that the records are formatted into a single buffer that is
+        // written to the log file with one system call (or one call per
+        // segment, if the log file is rotated between two of the records).
+        // The method has no effect if file logging is not enabled.  The
+        // behavior is undefined unless '0 <= numRecords', and 'records'
+        // refers to an array of at least 'numRecords' valid addresses.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
@@ -103,6 +103,7 @@ using bsl::flush;
 // [ 1] int enableFileLogging(const char *fileName, bool timestampFlag = false)
 // [ 1] void enablePublishInLocalTime()
 // [ 1] void publish(const ball::Record& record, const ball::Context& context)
+// [13] void publishBatch(const Record *const *records, int numRecords);
 // [ 2] void forceRotation()
 // [ 2] void rotateOnSize(int size)
 // [ 9] void rotateOnTimeInterval(const bdlt::DatetimeInterval& interval);
@@ -672,6 +673,147 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the same bytes to the log file as calling
+        //:   'publish' on each record of the batch, in order.
+        //:
+        //: 2 If the log file must be rotated before a record of the batch,
+        //:   the preceding records are written to the rotated file, and the
+        //:   rotation callback is invoked once per rotation.
+        //:
+        //: 3 'publishBatch' has no effect if file logging is not enabled, or
+        //:   if the batch is empty.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records to one observer with 'publish',
+        //:   and to a second observer with 'publishBatch', and compare the
+        //:   contents of the two log files.  (C-1)
+        //:
+        //: 2 Configure an observer to rotate on size (1 KB), and publish a
+        //:   single batch of records totalling about 1.5 KB.  Verify that the
+        //:   log file was rotated once, that the rotated file exceeds 1 KB,
+        //:   and that every record was written exactly once.  (C-2)
+        //:
+        //: 3 Publish a batch with file logging disabled, and an empty batch
+        //:   with file logging enabled, and verify that no file is written.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_RECORDS = 16 };
+
+        bsl::vector<ball::Record>         records(Z);
+        bsl::vector<const ball::Record *> addresses(Z);
+
+        const bdlt::Datetime TIMESTAMP(2015, 1, 2, 3, 4, 5, 6);
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::string message(200, static_cast<char>('a' + i), Z);
+            ball::RecordAttributes attr(TIMESTAMP,
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        32,
+                                        message.c_str());
+            records.push_back(ball::Record(attr, ball::UserFields(), Z));
+        }
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            addresses.push_back(&records[i]);
+        }
+
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (verbose) cout << "\tComparing with 'publish'." << endl;
+        {
+            const bsl::string BASENAME1 = tempFileName(veryVerbose);
+            const bsl::string BASENAME2 = tempFileName(veryVerbose);
+
+            Obj mX1(Z);
+            Obj mX2(Z);
+
+            ASSERT(0 == mX1.enableFileLogging(BASENAME1.c_str()));
+            ASSERT(0 == mX2.enableFileLogging(BASENAME2.c_str()));
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mX1.publish(records[i], context);
+            }
+            mX2.publishBatch(addresses.data(), k_NUM_RECORDS);
+
+            mX1.disableFileLogging();
+            mX2.disableFileLogging();
+
+            bsl::string content1, content2;
+            ASSERT(2 * k_NUM_RECORDS ==
+                        readFileIntoString(__LINE__, BASENAME1, content1));
+            ASSERT(2 * k_NUM_RECORDS ==
+                        readFileIntoString(__LINE__, BASENAME2, content2));
+            ASSERTV(content1, content2, content1 == content2);
+
+            removeFilesByPrefix(BASENAME1.c_str());
+            removeFilesByPrefix(BASENAME2.c_str());
+        }
+
+        if (verbose) cout << "\tRotating within a batch." << endl;
+        {
+            const bsl::string BASENAME = tempFileName(veryVerbose);
+
+            Obj mX(Z);
+
+            RotCb cb(Z);
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+
+            ASSERT(0 == mX.enableFileLogging(BASENAME.c_str()));
+
+            // Note that the records of the batch must not trigger more than
+            // one rotation, as the rotated files would otherwise be given the
+            // same name.
+
+            enum { k_NUM_ROTATED = 6 };
+
+            mX.publishBatch(addresses.data(), k_NUM_ROTATED);
+            mX.disableFileLogging();
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(), 0 == cb.status());
+            ASSERT(1024 < getFileSize(cb.rotatedFileName().c_str()));
+
+            const int numLines = getNumLines(BASENAME.c_str())
+                               + getNumLines(cb.rotatedFileName().c_str());
+            ASSERTV(numLines, 2 * k_NUM_ROTATED == numLines);
+
+            removeFilesByPrefix(BASENAME.c_str());
+        }
+
+        if (verbose) cout << "\tTesting degenerate batches." << endl;
+        {
+            const bsl::string BASENAME = tempFileName(veryVerbose);
+
+            Obj mX(Z);
+
+            mX.publishBatch(addresses.data(), k_NUM_RECORDS);
+            ASSERT(!FileUtil::exists(BASENAME.c_str()));
+
+            ASSERT(0 == mX.enableFileLogging(BASENAME.c_str()));
+
+            mX.publishBatch(0, 0);
+            ASSERT(0 == getFileSize(BASENAME.c_str()));
+
+            mX.disableFileLogging();
+            removeFilesByPrefix(BASENAME.c_str());
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING: Published Records Show Current Local-Time Offset
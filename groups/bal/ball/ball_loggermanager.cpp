@@ -22,6 +22,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <ball_userfieldsschema.h>
 #include <ball_testobserver.h>                // for testing only
 
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_once.h>
 #include <bslmt_readlockguard.h>
@@ -40,10 +41,13 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
+#include <bslma_newdeleteallocator.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_log.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
@@ -53,6 +57,9 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <bsl_new.h>            // placement 'new' syntax
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_typeinfo.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 //=============================================================================
 //                           IMPLEMENTATION NOTES
@@ -225,12 +232,213 @@ void copyAttributesWithoutMessage(ball::Record                  *record,
     record->fixedFields().setSeverity(srcAttribute.severity());
 }
 
+bsl::shared_ptr<ball::Record> makeHandle(ball::Record *record)
+    // Return a shared pointer to the specified 'record', using the
+    // representation stored with 'record'.  The behavior is undefined unless
+    // 'record' was obtained from a 'ball::Logger' and is not currently
+    // referred to by any shared pointer.
+{
+    ball::Logger_RecordRep *rep =
+                                ball::Logger_RecordNode::fromRecord(record)
+                                                                      ->rep();
+    rep->resetCountsRaw(1, 0);
+    return bsl::shared_ptr<ball::Record>(
+                                   record,
+                                   static_cast<bslma::SharedPtrRep *>(rep));
+}
+
+struct ThreadCacheRegistry {
+    // This 'struct' records the thread caches of all loggers, with the thread
+    // owning each cache.  'ball::Logger::destroyThreadCache', invoked when a
+    // thread exits, may race with the destruction of the logger of the cache
+    // (which destroys the cache); the registry lets it recognize, without
+    // accessing the cache, that the cache has already been destroyed.  The
+    // owning thread is recorded so that a new cache allocated at the address
+    // of a destroyed one is not mistaken for it.
+
+    // TYPES
+    typedef bsl::pair<const void *, bsls::Types::Uint64> Entry;
+        // cache address and owning thread id
+
+    // DATA
+    bslmt::Mutex       d_mutex;    // serializes the creation and destruction
+                                   // of thread caches
+
+    bsl::vector<Entry> d_entries;  // caches not yet destroyed
+
+    // CREATORS
+    explicit ThreadCacheRegistry(bslma::Allocator *basicAllocator)
+    : d_entries(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    void remove(const void *cache)
+        // Remove the specified 'cache' from this registry.  The behavior is
+        // undefined unless 'cache' is registered, and 'd_mutex' is locked.
+    {
+        for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+            if (cache == d_entries[i].first) {
+                d_entries[i] = d_entries.back();
+                d_entries.pop_back();
+                return;                                               // RETURN
+            }
+        }
+        BSLS_ASSERT(false);
+    }
+
+    bool remove(const void *cache, bsls::Types::Uint64 threadId)
+        // Remove the specified 'cache' owned by the thread having the
+        // specified 'threadId' from this registry.  Return 'true' if 'cache'
+        // was registered, and 'false' otherwise.  The behavior is undefined
+        // unless 'd_mutex' is locked.
+    {
+        for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+            if (cache == d_entries[i].first
+             && threadId == d_entries[i].second) {
+                d_entries[i] = d_entries.back();
+                d_entries.pop_back();
+                return true;                                          // RETURN
+            }
+        }
+        return false;
+    }
+};
+
+ThreadCacheRegistry& threadCacheRegistry()
+    // Return a reference to the registry of the thread caches of all loggers.
+{
+    static bsls::ObjectBuffer<ThreadCacheRegistry> registry;
+    BSLMT_ONCE_DO {
+        // The registry must remain valid for the lifetime of the task, as
+        // threads may exit during program termination, and is intentionally
+        // never destroyed.  Its memory is not supplied by the global
+        // allocator, which may be destroyed first.
+
+        new (registry.buffer()) ThreadCacheRegistry(
+                                      &bslma::NewDeleteAllocator::singleton());
+    }
+    return registry.object();
+}
+
 }  // close unnamed namespace
 
+                         // ========================
+                         // class Logger_ThreadCache
+                         // ========================
+
+class Logger_ThreadCache {
+    // This component-private class holds the records and the message buffer
+    // reserved for the exclusive use of one thread logging through one
+    // logger.  Only the owning thread modifies the cache; 'd_numNodes' is
+    // read by other threads to compute the number of records in use.
+
+  public:
+    // TYPES
+    enum { k_CAPACITY = 32 };  // maximum number of cached records
+
+    // DATA
+    Logger            *d_logger_p;               // owning logger (held, not
+                                                 // owned)
+
+    Logger_RecordNode *d_nodes[k_CAPACITY];      // available records (owned)
+
+    bsls::AtomicInt    d_numNodes;               // number of elements of
+                                                 // 'd_nodes'
+
+    char              *d_scratchBuffer_p;        // message buffer of the
+                                                 // thread (owned), or 0 if
+                                                 // not yet allocated
+
+    bslmt::Mutex       d_scratchBufferMutex;     // protects
+                                                 // 'd_scratchBuffer_p'
+
+    // CREATORS
+    explicit Logger_ThreadCache(Logger *logger)
+    : d_logger_p(logger)
+    , d_numNodes(0)
+    , d_scratchBuffer_p(0)
+    {
+    }
+};
+
+                          // ----------------------
+                          // class Logger_RecordRep
+                          // ----------------------
+
+// MANIPULATORS
+void Logger_RecordRep::disposeObject()
+{
+}
+
+void Logger_RecordRep::disposeRep()
+{
+    BSLS_ASSERT(d_logger_p);
+
+    d_logger_p->releaseRecordNode(d_node_p);
+}
+
+void *Logger_RecordRep::getDeleter(const std::type_info&)
+{
+    return 0;
+}
+
+// ACCESSORS
+void *Logger_RecordRep::originalPtr() const
+{
+    return d_node_p->record();
+}
+
                            // ------------
                            // class Logger
                            // ------------
 
+// PRIVATE CLASS METHODS
+void Logger::destroyThreadCache(void *cache)
+{
+    if (!cache) {
+        return;                                                       // RETURN
+    }
+
+    // Holding the lock of the registry until 'cache' is destroyed prevents
+    // its logger from being destroyed meanwhile.
+
+    ThreadCacheRegistry&           registry = threadCacheRegistry();
+    bslmt::LockGuard<bslmt::Mutex> registryGuard(&registry.d_mutex);
+
+    if (!registry.remove(cache, bslmt::ThreadUtil::selfIdAsUint64())) {
+        // 'cache' was destroyed with its logger.
+
+        return;                                                       // RETURN
+    }
+
+    Logger_ThreadCache *threadCache = static_cast<Logger_ThreadCache *>(cache);
+    Logger             *logger      = threadCache->d_logger_p;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&logger->d_threadCachesMutex);
+
+        bsl::vector<Logger_ThreadCache *>& caches = logger->d_threadCaches;
+        for (bsl::size_t i = 0; i < caches.size(); ++i) {
+            if (threadCache == caches[i]) {
+                caches[i] = caches.back();
+                caches.pop_back();
+                break;
+            }
+        }
+    }
+
+    const int numNodes = threadCache->d_numNodes.loadRelaxed();
+    for (int i = 0; i < numNodes; ++i) {
+        logger->d_recordPool.deleteObject(threadCache->d_nodes[i]);
+    }
+
+    if (threadCache->d_scratchBuffer_p) {
+        logger->d_allocator_p->deallocate(threadCache->d_scratchBuffer_p);
+    }
+    logger->d_allocator_p->deleteObject(threadCache);
+}
+
 // PRIVATE CREATORS
 Logger::Logger(
            Observer                                   *observer,
@@ -249,6 +457,8 @@ Logger::Logger(
 , d_populator(populator)
 , d_publishAll(publishAllCallback)
 , d_scratchBufferSize(scratchBufferSize)
+, d_hasThreadCacheKey(false)
+, d_threadCaches(globalAllocator)
 , d_logOrder(logOrder)
 , d_triggerMarkers(triggerMarkers)
 , d_allocator_p(globalAllocator)
@@ -260,6 +470,13 @@ Logger::Logger(
 
     // 'snprintf' message buffer
     d_scratchBuffer_p = (char *)d_allocator_p->allocate(d_scratchBufferSize);
+
+    // Per-thread caches are an optimization: if no thread-specific key is
+    // available, all threads share 'd_recordPool' and 'd_scratchBuffer_p'.
+
+    d_hasThreadCacheKey = 0 == bslmt::ThreadUtil::createKey(
+                                                 &d_threadCacheKey,
+                                                 &Logger::destroyThreadCache);
 }
 
 Logger::~Logger()
@@ -273,6 +490,38 @@ Logger::~Logger()
 
     d_recordBuffer_p->removeAll();
     d_allocator_p->deallocate(d_scratchBuffer_p);
+
+    if (!d_hasThreadCacheKey) {
+        return;                                                       // RETURN
+    }
+
+    // Clear the slot of the calling thread, and delete the key, so that no
+    // thread exiting from now on invokes 'destroyThreadCache' for this
+    // logger.
+
+    bslmt::ThreadUtil::setSpecific(d_threadCacheKey, 0);
+    bslmt::ThreadUtil::deleteKey(d_threadCacheKey);
+
+    // A thread that started exiting before the key was deleted may still
+    // invoke 'destroyThreadCache'.  Under the lock of the registry, either it
+    // destroys its cache before the caches are destroyed below, or it finds
+    // its cache unregistered and leaves it alone.  The records held by the
+    // caches are destroyed with 'd_recordPool'.
+
+    ThreadCacheRegistry&           registry = threadCacheRegistry();
+    bslmt::LockGuard<bslmt::Mutex> registryGuard(&registry.d_mutex);
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadCachesMutex);
+
+    for (bsl::size_t i = 0; i < d_threadCaches.size(); ++i) {
+        Logger_ThreadCache *cache = d_threadCaches[i];
+
+        registry.remove(cache);
+        if (cache->d_scratchBuffer_p) {
+            d_allocator_p->deallocate(cache->d_scratchBuffer_p);
+        }
+        d_allocator_p->deleteObject(cache);
+    }
+    d_threadCaches.clear();
 }
 
 // PRIVATE MANIPULATORS
@@ -306,6 +555,59 @@ void Logger::publish(Transmission::Cause cause)
     d_recordBuffer_p->endSequence();
 }
 
+void Logger::releaseRecordNode(Logger_RecordNode *node)
+{
+    // Do not create a cache for a thread that only releases records (e.g.,
+    // the publication thread of an asynchronous observer).
+
+    Logger_ThreadCache *cache = d_hasThreadCacheKey
+                              ? static_cast<Logger_ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(
+                                                            d_threadCacheKey))
+                              : 0;
+
+    if (cache) {
+        const int numNodes = cache->d_numNodes.loadRelaxed();
+        if (numNodes < Logger_ThreadCache::k_CAPACITY) {
+            cache->d_nodes[numNodes] = node;
+            cache->d_numNodes.storeRelease(numNodes + 1);
+            return;                                                   // RETURN
+        }
+    }
+    d_recordPool.deleteObject(node);
+}
+
+Logger_ThreadCache *Logger::threadCache()
+{
+    if (!d_hasThreadCacheKey) {
+        return 0;                                                     // RETURN
+    }
+
+    Logger_ThreadCache *cache = static_cast<Logger_ThreadCache *>(
+                             bslmt::ThreadUtil::getSpecific(d_threadCacheKey));
+    if (cache) {
+        return cache;                                                 // RETURN
+    }
+
+    cache = new (*d_allocator_p) Logger_ThreadCache(this);
+    {
+        ThreadCacheRegistry&           registry = threadCacheRegistry();
+        bslmt::LockGuard<bslmt::Mutex> registryGuard(&registry.d_mutex);
+
+        registry.d_entries.push_back(ThreadCacheRegistry::Entry(
+                                        cache,
+                                        bslmt::ThreadUtil::selfIdAsUint64()));
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_threadCachesMutex);
+        d_threadCaches.push_back(cache);
+    }
+    if (0 != bslmt::ThreadUtil::setSpecific(d_threadCacheKey, cache)) {
+        destroyThreadCache(cache);
+        return 0;                                                     // RETURN
+    }
+    return cache;
+}
+
 void Logger::logMessage(const Category&            category,
                         int                        severity,
                         Record                    *record,
@@ -325,7 +627,7 @@ void Logger::logMessage(const Category&            category,
         d_populator(&record->userFields(), *d_userFieldsSchema_p);
     }
 
-    bsl::shared_ptr<Record> handle(record, &d_recordPool, d_allocator_p);
+    bsl::shared_ptr<Record> handle = makeHandle(record);
 
     if (levels.recordLevel() >= severity) {
         d_recordBuffer_p->pushBack(handle);
@@ -354,9 +656,7 @@ void Logger::logMessage(const Category&            category,
                                          record->fixedFields().fileName(),
                                          record->fixedFields().lineNumber());
 
-            bsl::shared_ptr<Record> handle(marker,
-                                                &d_recordPool,
-                                                d_allocator_p);
+            bsl::shared_ptr<Record> handle = makeHandle(marker);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
@@ -391,9 +691,7 @@ void Logger::logMessage(const Category&            category,
                                          record->fixedFields().fileName(),
                                          record->fixedFields().lineNumber());
 
-            bsl::shared_ptr<Record> handle(marker,
-                                                &d_recordPool,
-                                                d_allocator_p);
+            bsl::shared_ptr<Record> handle = makeHandle(marker);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
@@ -422,7 +720,20 @@ void Logger::logMessage(const Category&            category,
 // MANIPULATORS
 Record *Logger::getRecord(const char *file, int line)
 {
-    Record *record = d_recordPool.getObject();
+    Logger_ThreadCache *cache = threadCache();
+    Logger_RecordNode  *node;
+
+    int numNodes;
+    if (cache && 0 < (numNodes = cache->d_numNodes.loadRelaxed())) {
+        node = cache->d_nodes[numNodes - 1];
+        cache->d_numNodes.storeRelease(numNodes - 1);
+    }
+    else {
+        node = d_recordPool.getObject();
+    }
+    node->rep()->setLogger(this);
+
+    Record *record = node->record();
     record->userFields().removeAll();
     record->fixedFields().clearMessage();
     record->fixedFields().setFileName(file);
@@ -455,7 +766,7 @@ void Logger::logMessage(const Category&  category,
 {
     ThresholdAggregate thresholds(0, 0, 0, 0);
     if (!isCategoryEnabled(&thresholds, category, severity)) {
-        d_recordPool.deleteObject(record);
+        releaseRecordNode(Logger_RecordNode::fromRecord(record));
         return;                                                       // RETURN
     }
     logMessage(category, severity, record, thresholds);
@@ -473,10 +784,26 @@ void Logger::removeAll()
 
 char *Logger::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 {
-    d_scratchBufferMutex.lock();
-    *mutex = &d_scratchBufferMutex;
+    Logger_ThreadCache *cache = threadCache();
+    if (!cache) {
+        d_scratchBufferMutex.lock();
+        *mutex = &d_scratchBufferMutex;
+        *bufferSize = d_scratchBufferSize;
+        return d_scratchBuffer_p;                                     // RETURN
+    }
+
+    // The mutex of a thread's buffer is locked only by that thread, and is
+    // therefore never contended; it is retained so that callers release the
+    // buffer in the same way regardless of which buffer they obtained.
+
+    cache->d_scratchBufferMutex.lock();
+    if (!cache->d_scratchBuffer_p) {
+        cache->d_scratchBuffer_p =
+                         (char *)d_allocator_p->allocate(d_scratchBufferSize);
+    }
+    *mutex = &cache->d_scratchBufferMutex;
     *bufferSize = d_scratchBufferSize;
-    return d_scratchBuffer_p;
+    return cache->d_scratchBuffer_p;
 }
 
 
@@ -488,8 +815,16 @@ int Logger::messageBufferSize() const
 
 int Logger::numRecordsInUse() const
 {
-    return d_recordPool.numObjects() -
-           d_recordPool.numAvailableObjects();
+    int numCached = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_threadCachesMutex);
+        for (bsl::size_t i = 0; i < d_threadCaches.size(); ++i) {
+            numCached += d_threadCaches[i]->d_numNodes.loadAcquire();
+        }
+    }
+    return d_recordPool.numObjects()
+         - d_recordPool.numAvailableObjects()
+         - numCached;
 }
 }  // close package namespace
 
@@ -329,6 +329,22 @@ BSLS_IDENT("$Id: $")
 // have them share a common logger so that the trace-back log *does* include
 // all relevant records.
 //
+///Per-Thread Record and Buffer Caches
+///- - - - - - - - - - - - - - - - - -
+// A logger shared by many threads keeps, for each thread that logs through
+// it, a small cache of unused records and a private buffer for formatting
+// messages (see 'obtainMessageBuffer').  A thread obtains its records from its
+// own cache, and a record released on a thread (i.e., once the last shared
+// reference to it held by the record buffer and the observers is dropped) is
+// returned to that thread's cache, falling back to a pool shared by all
+// threads only when the cache is empty (or full).  The shared pointer through
+// which a record is published is stored with the record itself, so that
+// publishing a record does not allocate memory.  Consequently, when records
+// are published synchronously, the common logging path of a thread touches
+// no state that is modified by other threads, and logging from many threads
+// concurrently scales with the number of threads.  The cache of a thread is
+// destroyed when the thread exits.
+//
 ///'bsls::Log' Logging Redirection
 ///-------------------------------
 // The 'ball::LoggerManager' singleton, on construction, will redirect the
@@ -888,6 +904,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_rwmutex.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -896,6 +916,18 @@ BSLS_IDENT("$Id: $")
 #include <bslma_managedptr.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_SHAREDPTRREP
+#include <bslma_sharedptrrep.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
 #ifndef INCLUDED_BSL_FUNCTIONAL
 #include <bsl_functional.h>
 #endif
@@ -908,12 +940,22 @@ BSLS_IDENT("$Id: $")
 #include <bsl_set.h>
 #endif
 
+#ifndef INCLUDED_BSL_TYPEINFO
+#include <bsl_typeinfo.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 
 
 namespace ball {
 
+class Logger;
 class LoggerManager;
+class Logger_ThreadCache;
 class Observer;
 class RecordBuffer;
 
@@ -921,6 +963,106 @@ class RecordBuffer;
 
 
 namespace ball {
+
+class Logger_RecordNode;
+
+                          // ======================
+                          // class Logger_RecordRep
+                          // ======================
+
+class Logger_RecordRep : public bslma::SharedPtrRep {
+    // This component-private class provides the shared-pointer representation
+    // of a record dispensed by a 'Logger'.  When the last shared reference to
+    // the record is released, the node containing the record (and this
+    // representation) is returned to the logger from which it was obtained,
+    // rather than destroyed.
+
+    // DATA
+    Logger_RecordNode *d_node_p;    // node containing this representation
+                                    // (held, not owned)
+
+    Logger            *d_logger_p;  // logger to which the node is returned
+                                    // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    Logger_RecordRep(const Logger_RecordRep&);
+    Logger_RecordRep& operator=(const Logger_RecordRep&);
+
+  public:
+    // CREATORS
+    explicit Logger_RecordRep(Logger_RecordNode *node);
+        // Create a representation of the record in the specified 'node'.
+
+    // MANIPULATORS
+    virtual void disposeObject();
+        // Do nothing: the record is reset when it is next dispensed.
+
+    virtual void disposeRep();
+        // Return the node containing this representation to the logger
+        // supplied to the last call to 'setLogger'.
+
+    virtual void *getDeleter(const std::type_info& type);
+        // Return 0.  Note that records have no user-accessible deleter.
+
+    void setLogger(Logger *logger);
+        // Set the logger to which the node containing this representation is
+        // returned to the specified 'logger'.
+
+    // ACCESSORS
+    virtual void *originalPtr() const;
+        // Return the address of the record of the node containing this
+        // representation.
+};
+
+                          // =======================
+                          // class Logger_RecordNode
+                          // =======================
+
+class Logger_RecordNode {
+    // This component-private class provides the storage for a record
+    // dispensed by a 'Logger', together with the representation of the
+    // shared pointers through which that record is published, so that
+    // publishing a record does not allocate memory.
+
+    // DATA
+    Record           d_record;  // dispensed record (must be the first data
+                                // member; see 'fromRecord')
+
+    Logger_RecordRep d_rep;     // representation of the shared pointers to
+                                // 'd_record'
+
+  private:
+    // NOT IMPLEMENTED
+    Logger_RecordNode(const Logger_RecordNode&);
+    Logger_RecordNode& operator=(const Logger_RecordNode&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Logger_RecordNode,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static Logger_RecordNode *fromRecord(Record *record);
+        // Return the address of the node containing the specified 'record'.
+        // The behavior is undefined unless 'record' is the record of a
+        // 'Logger_RecordNode'.
+
+    // CREATORS
+    explicit Logger_RecordNode(bslma::Allocator *basicAllocator = 0);
+        // Create a node holding a default-constructed record.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    // MANIPULATORS
+    Record *record();
+        // Return the address of the modifiable record of this node.
+
+    Logger_RecordRep *rep();
+        // Return the address of the modifiable shared-pointer representation
+        // of the record of this node.
+};
                            // ============
                            // class Logger
                            // ============
@@ -946,8 +1088,10 @@ class Logger {
         // all loggers that are allocated by the logger manager.
 
   private:
-    bdlcc::ObjectPool<Record>
-                          d_recordPool;         // pool of records
+    bdlcc::ObjectPool<Logger_RecordNode>
+                          d_recordPool;         // pool of records shared by
+                                                // all threads (see
+                                                // 'Logger_ThreadCache')
 
     Observer             *d_observer_p;         // holds observer (not owned)
 
@@ -972,6 +1116,23 @@ class Logger {
     bslmt::Mutex          d_scratchBufferMutex; // ensure thread-safety of
                                                 // message buffer
 
+    bslmt::ThreadUtil::Key
+                          d_threadCacheKey;     // key of the cache of each
+                                                // thread for this logger
+
+    bool                  d_hasThreadCacheKey;  // 'true' if
+                                                // 'd_threadCacheKey' was
+                                                // created (otherwise, threads
+                                                // use 'd_recordPool' and
+                                                // 'd_scratchBuffer_p')
+
+    bsl::vector<Logger_ThreadCache *>
+                          d_threadCaches;       // caches of the threads that
+                                                // used this logger (owned)
+
+    mutable bslmt::Mutex  d_threadCachesMutex;  // serialize access to
+                                                // 'd_threadCaches'
+
     LoggerManagerConfiguration::LogOrder
                           d_logOrder;           // logging order
 
@@ -983,11 +1144,21 @@ class Logger {
 
     // FRIENDS
     friend class LoggerManager;
+    friend class Logger_RecordRep;
 
     // NOT IMPLEMENTED
     Logger(const Logger& original);
     Logger& operator=(const Logger& rhs);
 
+    // PRIVATE CLASS METHODS
+    static void destroyThreadCache(void *cache);
+        // Return the cached records of the specified thread 'cache' to the
+        // record pool of the logger owning 'cache', and destroy 'cache'.  This
+        // method has no effect if 'cache' was already destroyed with its
+        // logger.  Note that this method is the destructor of the
+        // thread-specific key of the caches, and may therefore be invoked
+        // concurrently with the destructor of the logger.
+
     // PRIVATE CREATORS
     Logger(
            Observer                                   *observer,
@@ -1023,6 +1194,17 @@ class Logger {
         // the record buffer of this logger and indicate to the observer the
         // specified publication 'cause'.
 
+    void releaseRecordNode(Logger_RecordNode *node);
+        // Return the specified record 'node' to the cache of the calling
+        // thread for this logger if that cache exists and is not full, and to
+        // the record pool of this logger otherwise.  The behavior is undefined
+        // unless 'node' was obtained from this logger.
+
+    Logger_ThreadCache *threadCache();
+        // Return the address of the cache of the calling thread for this
+        // logger, creating it if necessary, or 0 if per-thread caches are not
+        // available.
+
     void logMessage(const Category&            category,
                     int                        severity,
                     Record                    *record,
@@ -1115,11 +1297,14 @@ class Logger {
 
     char *obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize);
         // Block until access to the buffer of this logger used for formatting
-        // messages is available.  Return the address of the modifiable buffer
-        // to which this thread of execution has exclusive access, load the
-        // address of the mutex that protects the buffer into the specified
-        // '*mutex' address, and load the size (in bytes) of the buffer into
-        // the specified 'bufferSize' address.  The address remains valid, and
+        // messages by the calling thread is available.  Return the address of
+        // the modifiable buffer to which this thread of execution has
+        // exclusive access, load the address of the mutex that protects the
+        // buffer into the specified '*mutex' address, and load the size (in
+        // bytes) of the buffer into the specified 'bufferSize' address.  Note
+        // that each thread has its own buffer (see {Per-Thread Record and
+        // Buffer Caches}), so this method does not block unless the calling
+        // thread already holds the lock.  The address remains valid, and
         // the buffer remains locked by this thread of execution, until this
         // thread calls 'mutex->unlock()'.  The behavior is undefined if this
         // thread of execution currently holds a lock on the buffer.  Note that
@@ -1689,6 +1874,60 @@ class LoggerManagerScopedGuard {
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                          // ----------------------
+                          // class Logger_RecordRep
+                          // ----------------------
+
+// CREATORS
+inline
+Logger_RecordRep::Logger_RecordRep(Logger_RecordNode *node)
+: d_node_p(node)
+, d_logger_p(0)
+{
+}
+
+// MANIPULATORS
+inline
+void Logger_RecordRep::setLogger(Logger *logger)
+{
+    d_logger_p = logger;
+}
+
+                          // -----------------------
+                          // class Logger_RecordNode
+                          // -----------------------
+
+// CLASS METHODS
+inline
+Logger_RecordNode *Logger_RecordNode::fromRecord(Record *record)
+{
+    // 'd_record' is the first data member of a class having no base class
+    // and no virtual function, and is therefore at offset 0.
+
+    return reinterpret_cast<Logger_RecordNode *>(record);
+}
+
+// CREATORS
+inline
+Logger_RecordNode::Logger_RecordNode(bslma::Allocator *basicAllocator)
+: d_record(basicAllocator)
+, d_rep(this)
+{
+}
+
+// MANIPULATORS
+inline
+Record *Logger_RecordNode::record()
+{
+    return &d_record;
+}
+
+inline
+Logger_RecordRep *Logger_RecordNode::rep()
+{
+    return &d_rep;
+}
+
                         // -------------------
                         // class LoggerManager
                         // -------------------
@@ -104,9 +104,11 @@ using namespace bdlf::PlaceHolders;
 // [ 7] void publish();
 // [ 7] void removeAll();
 // [ 7] char *obtainMessageBuffer(Mutex **mutex, int *bufferSize);
+// [26] char *obtainMessageBuffer(Mutex **mutex, int *bufferSize);
 // [ 7] char *messageBuffer();
 // [ 7] int messageBufferSize() const;
-// [27] int numRecordsInUse() const;
+// [25] int numRecordsInUse() const;
+// [26] int numRecordsInUse() const;
 //
 // 'ball::LoggerManager' private interface (tested indirectly):
 // [ 9] void publishAllImp(ball::Transmission::Cause cause);
@@ -167,10 +169,11 @@ using namespace bdlf::PlaceHolders;
 // [21] TESTING: isCategoryEnabled (RULE BASED LOGGING)
 // [22] TESTING: 'ball::Logger::logMessage' (RULE BASED LOGGING)
 // [23] TESTING: '~LoggerManager' calls 'Observer::releaseRecords'
-// [26] USAGE EXAMPLE #1
-// [27] USAGE EXAMPLE #2
-// [28] USAGE EXAMPLE #3
-// [29] USAGE EXAMPLE #4
+// [26] CONCURRENT LOGGING THROUGH PER-THREAD CACHES
+// [27] USAGE EXAMPLE #1
+// [28] USAGE EXAMPLE #2
+// [29] USAGE EXAMPLE #3
+// [30] USAGE EXAMPLE #4
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1295,6 +1298,91 @@ extern "C" {
 
 }  // close namespace BALL_LOGGERMANAGER_TEST_CASE_24
 
+// ============================================================================
+//                         CASE 26 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOGGERMANAGER_TEST_CASE_26 {
+enum {
+    NUM_THREADS  = 16,   // number of logging threads
+    NUM_MESSAGES = 1000  // number of messages logged by each thread
+};
+
+ball::Logger   *logger;
+ball::Category *passCategory;    // records are published and released
+ball::Category *recordCategory;  // records are retained by the record buffer
+char           *buffers[NUM_THREADS];
+bslmt::Barrier  barrier(NUM_THREADS);
+
+ball::Logger   *exitingLogger;   // logger destroyed as its threads exit
+bslmt::Barrier  exitBarrier(NUM_THREADS + 1);
+
+extern "C" {
+    void *loggingThread(void *arg)
+        // Log 'NUM_MESSAGES' messages to 'passCategory' and one message to
+        // 'recordCategory', then obtain the message buffer of 'logger',
+        // record its address, and fill it with a pattern identifying this
+        // thread.  Wait for all threads to hold their buffers, and verify
+        // that the pattern is intact.
+    {
+        const int id = static_cast<int>(reinterpret_cast<bsl::size_t>(arg));
+
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            logger->logMessage(*passCategory,
+                               ball::Severity::e_INFO,
+                               __FILE__,
+                               __LINE__,
+                               "pass-through message");
+        }
+        logger->logMessage(*recordCategory,
+                           ball::Severity::e_INFO,
+                           __FILE__,
+                           __LINE__,
+                           "retained message");
+
+        bslmt::Mutex *mutex;
+        int           bufferSize;
+        char         *buffer = logger->obtainMessageBuffer(&mutex,
+                                                           &bufferSize);
+        ASSERT(buffer);
+        ASSERT(mutex);
+        ASSERT(0 < bufferSize);
+
+        buffers[id] = buffer;
+        bsl::memset(buffer, 'A' + id, bufferSize);
+
+        // Every thread holds its buffer at this point; this would deadlock
+        // if the threads shared a buffer.
+
+        barrier.wait();
+
+        for (int i = 0; i < bufferSize; ++i) {
+            if ('A' + id != buffer[i]) {
+                ASSERTV(id, i, buffer[i], 'A' + id == buffer[i]);
+                break;
+            }
+        }
+
+        mutex->unlock();
+        return 0;
+    }
+
+    void *exitingThread(void *)
+        // Log one message through 'exitingLogger', thereby creating a cache
+        // for this thread, wait on 'exitBarrier', and exit.
+    {
+        exitingLogger->logMessage(*passCategory,
+                                  ball::Severity::e_INFO,
+                                  __FILE__,
+                                  __LINE__,
+                                  "exiting message");
+        exitBarrier.wait();
+        return 0;
+    }
+}  // extern "C"
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_CASE_26
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -1348,7 +1436,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #4
         //
@@ -1384,7 +1472,7 @@ int main(int argc, char *argv[])
         }
 
       } break;
-      case 28: {
+      case 29: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #3
         //
@@ -1429,7 +1517,7 @@ int main(int argc, char *argv[])
         }
 
       } break;
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #2
         //
@@ -1451,7 +1539,7 @@ int main(int argc, char *argv[])
         BALL_LOGGERMANAGER_USAGE_EXAMPLE_2::main();
 
       } break;
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #1
         //
@@ -1472,6 +1560,137 @@ int main(int argc, char *argv[])
 
         BALL_LOGGERMANAGER_USAGE_EXAMPLE_1::main();
 
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOGGING THROUGH PER-THREAD CACHES
+        //
+        // Concerns:
+        //: 1 Records logged concurrently by many threads are all published.
+        //:
+        //: 2 Every record obtained by a thread is accounted for by
+        //:   'numRecordsInUse', including records cached by a thread and
+        //:   records released by a thread other than the one that obtained
+        //:   them.
+        //:
+        //: 3 Each thread obtains a distinct message buffer, so that threads
+        //:   holding their buffers concurrently do not block one another.
+        //:
+        //: 4 The caches of exited threads are destroyed, and no memory is
+        //:   leaked.
+        //:
+        //: 5 A logger can be destroyed while threads having caches for it
+        //:   exit, whichever of the logger and a thread destroys the cache of
+        //:   the thread.
+        //
+        // Plan:
+        //: 1 Create 'NUM_THREADS' threads, each logging 'NUM_MESSAGES'
+        //:   published (but not retained) messages and one retained message,
+        //:   and then holding its message buffer while all other threads
+        //:   hold theirs.  Verify the number of published records, and that
+        //:   the buffers are distinct.  (C-1, 3)
+        //:
+        //: 2 Verify that 'numRecordsInUse' reports exactly the retained
+        //:   records, and that it reports 0 once they are removed (and thus
+        //:   released) by the main thread.  (C-2)
+        //:
+        //: 3 Use a test allocator for the logger manager, and verify that all
+        //:   of its memory is released on shutdown.  (C-4)
+        //:
+        //: 4 Repeatedly allocate a logger, have 'NUM_THREADS' threads log
+        //:   through it, then release the threads and deallocate the logger
+        //:   while they exit.  Verify that the memory of the logger and its
+        //:   caches is released.  (C-5)
+        //
+        // Testing:
+        //   CONCURRENT LOGGING THROUGH PER-THREAD CACHES
+        //   char *obtainMessageBuffer(Mutex **mutex, int *bufferSize);
+        //   int numRecordsInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOGGING THROUGH PER-THREAD CACHES"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_CASE_26;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            ball::TestObserver               to(bsl::cout, &ta);
+            ball::LoggerManagerConfiguration lmc;
+            ball::LoggerManagerScopedGuard   guard(&to, lmc, &ta);
+
+            ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+            passCategory   = manager.addCategory("PASS",   0, 255, 0, 0);
+            recordCategory = manager.addCategory("RECORD", 255, 0, 0, 0);
+            ASSERT(passCategory);
+            ASSERT(recordCategory);
+
+            logger = &manager.getLogger();
+            ASSERT(0 == logger->numRecordsInUse());
+
+            executeInParallel(NUM_THREADS, loggingThread);
+
+            ASSERTV(to.numPublishedRecords(),
+                    NUM_THREADS * NUM_MESSAGES == to.numPublishedRecords());
+
+            bsl::sort(buffers, buffers + NUM_THREADS);
+            ASSERT(bsl::adjacent_find(buffers, buffers + NUM_THREADS)
+                                                   == buffers + NUM_THREADS);
+
+            ASSERTV(logger->numRecordsInUse(),
+                    NUM_THREADS == logger->numRecordsInUse());
+
+            logger->removeAll();
+
+            ASSERTV(logger->numRecordsInUse(),
+                    0 == logger->numRecordsInUse());
+
+            // The records released by the main thread are reused.
+
+            ball::Record *record = logger->getRecord(__FILE__, __LINE__);
+            ASSERT(1 == logger->numRecordsInUse());
+            logger->logMessage(*passCategory, ball::Severity::e_INFO, record);
+            ASSERT(0 == logger->numRecordsInUse());
+
+            if (verbose) cout << "\nDestroying a logger as threads exit."
+                              << endl;
+
+            ball::FixedSizeRecordBuffer recordBuffer(1024, &ta);
+
+            // The first round may grow the bookkeeping of the manager.
+
+            bsls::Types::Int64 numBlocks = -1;
+
+            for (int round = 0; round < 100; ++round) {
+                exitingLogger = manager.allocateLogger(&recordBuffer);
+
+                bslmt::ThreadUtil::Handle handles[NUM_THREADS];
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          exitingThread,
+                                                          0));
+                }
+
+                exitBarrier.wait();
+                manager.deallocateLogger(exitingLogger);
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                if (0 == round) {
+                    numBlocks = ta.numBlocksInUse();
+                }
+                ASSERTV(round, numBlocks, ta.numBlocksInUse(),
+                        numBlocks == ta.numBlocksInUse());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
       } break;
       case 25: {
         // --------------------------------------------------------------------
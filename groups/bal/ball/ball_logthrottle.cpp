@@ -0,0 +1,95 @@
+// ball_logthrottle.cpp                                               -*-C++-*-
+#include <ball_logthrottle.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_logthrottle_cpp,"$Id$ $CSID$")
+
+#include <ball_category.h>
+#include <ball_loggermanager.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_testobserver.h>                              // for testing only
+
+#include <bsls_assert.h>
+
+#include <stdio.h>  // *NOT* <bsl_cstdio.h>, which does not declare 'snprintf'
+
+namespace BloombergLP {
+namespace ball {
+
+                            // ------------------
+                            // struct LogThrottle
+                            // ------------------
+
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int64 LogThrottle::s_summaryInterval = {
+                                                            10000000000LL };
+
+// PRIVATE CLASS METHODS
+void LogThrottle::logSummary(bsls::Types::Int64  numSuppressed,
+                             const char         *macroName,
+                             const Category     *category,
+                             int                 severity,
+                             const char         *fileName,
+                             int                 lineNumber)
+{
+    BSLS_ASSERT(macroName);
+    BSLS_ASSERT(fileName);
+
+    if (0 >= numSuppressed) {
+        return;                                                       // RETURN
+    }
+
+    char message[128];
+    snprintf(message,
+             sizeof message,
+             "%s: %lld message(s) suppressed",
+             macroName,
+             static_cast<long long>(numSuppressed));
+
+    Record *record = Log::getRecord(category, fileName, lineNumber);
+    record->fixedFields().setMessage(message);
+    Log::logMessage(category, severity, record);
+}
+
+// CLASS METHODS
+void LogThrottle::setSummaryInterval(const bsls::TimeInterval& interval)
+{
+    BSLS_ASSERT(bsls::TimeInterval() < interval);
+
+    bsls::AtomicOperations::setInt64Relaxed(&s_summaryInterval,
+                                            interval.totalNanoseconds());
+}
+
+bsls::TimeInterval LogThrottle::summaryInterval()
+{
+    const bsls::Types::Int64 k_NANOSECS_PER_SEC = 1000000000;
+
+    typedef bsls::AtomicOperations Ops;
+
+    const bsls::Types::Int64 interval = Ops::getInt64Relaxed(
+                                                         &s_summaryInterval);
+
+    return bsls::TimeInterval(
+                  interval / k_NANOSECS_PER_SEC,
+                  static_cast<int>(interval % k_NANOSECS_PER_SEC));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
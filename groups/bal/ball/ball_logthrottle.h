@@ -0,0 +1,521 @@
+// ball_logthrottle.h                                                 -*-C++-*-
+#ifndef INCLUDED_BALL_LOGTHROTTLE
+#define INCLUDED_BALL_LOGTHROTTLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide logging macros that limit the rate of a logging statement.
+//
+//@CLASSES:
+//  ball::LogThrottle: namespace for the admission functions of the macros
+//  ball::LogThrottle_Site: state of one throttled logging statement
+//
+//@MACROS:
+//  BALL_LOG_ERROR_EVERY_N: log one in every 'N' 'ERROR' messages
+//  BALL_LOG_ERROR_FIRST_N: log the first 'N' 'ERROR' messages only
+//  BALL_LOG_ERROR_RATE: log at most 'PER_SECOND' 'ERROR' messages a second
+//
+//@SEE_ALSO: ball_log
+//
+//@DESCRIPTION: This component provides C++ stream-based logging macros that
+// behave like the 'BALL_LOG_TRACE' .. 'BALL_LOG_FATAL' macros of 'ball_log',
+// except that each use of a macro (i.e., each *logging statement*) logs only
+// some of the messages it is invoked to log.  Three policies are provided,
+// each for every severity, where '<LEVEL>' is one of 'TRACE', 'DEBUG',
+// 'INFO', 'WARN', 'ERROR', and 'FATAL':
+//
+//: 'BALL_LOG_<LEVEL>_EVERY_N(N)':
+//:     Log the first message, and then one in every 'N' messages (i.e., the
+//:     messages numbered 0, 'N', '2 * N', ...).
+//:
+//: 'BALL_LOG_<LEVEL>_FIRST_N(N)':
+//:     Log the first 'N' messages, and no message thereafter.
+//:
+//: 'BALL_LOG_<LEVEL>_RATE(PER_SECOND)':
+//:     Log at most 'PER_SECOND' messages per second on average, allowing a
+//:     burst of up to 'PER_SECOND' (but at least one) messages.  'PER_SECOND'
+//:     may be fractional (e.g., 0.1 logs at most one message every 10
+//:     seconds).
+//
+// The 'BALL_LOG_STREAM_EVERY_N(SEVERITY, N)', 'BALL_LOG_STREAM_FIRST_N',
+// and 'BALL_LOG_STREAM_RATE' macros take the severity as an argument.  All of
+// these macros are terminated by 'BALL_LOG_END', and require a category to
+// have been set with 'BALL_LOG_SET_CATEGORY', exactly as the 'ball_log'
+// macros:
+//..
+//  BALL_LOG_ERROR_RATE(10) << "request failed: " << reason << BALL_LOG_END;
+//..
+// Only the messages that would be logged by the corresponding 'ball_log'
+// macro (i.e., whose severity is enabled for the category) are counted.  A
+// message that is *suppressed* by the throttle costs a few atomic operations
+// (and, for 'RATE', a read of the monotonic clock): the macro returns before
+// creating a 'ball::Log_Stream' or obtaining a record, and the expressions
+// streamed to it are not evaluated.
+//
+// The rate of a 'RATE' statement is enforced by a leaky bucket, implemented
+// as the virtual-scheduling form of the generic cell rate algorithm: the
+// state of the bucket is a single "theoretical arrival time", updated by
+// compare-and-swap, so that admission never blocks.
+//
+///Suppressed-Message Summaries
+///----------------------------
+// So that suppressed messages do not go entirely unnoticed, each logging
+// statement counts the messages it suppresses and, at most once per
+// *summary* *interval* (10 seconds by default; see 'setSummaryInterval'),
+// logs a summary record of the form (for a 'RATE' statement):
+//..
+//  BALL_LOG_RATE: 12345 message(s) suppressed
+//..
+// having the category, severity, file name, and line number of the logging
+// statement.  The summary is logged by the first suppressed message after the
+// interval has elapsed since the previous summary (or since the first
+// suppressed message of the statement); a statement that is no longer invoked
+// logs no further summary.
+//
+///Thread Safety
+///-------------
+// The macros of this component are thread-safe.  The state of each logging
+// statement is a function-scope static object that requires no dynamic
+// initialization, so that it may be used concurrently by several threads
+// even on platforms that do not initialize function-scope statics in a
+// thread-safe manner.  Note that when a statement is used concurrently, the
+// exact messages logged by an 'EVERY_N' statement, and the number logged by
+// a 'RATE' statement, depend on the interleaving of the threads, but the
+// number of messages logged by 'EVERY_N' and 'FIRST_N' statements is exact.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Limiting the Errors Logged on Failure of a Downstream Service
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service logs an error every time a request to a downstream
+// service fails.  When the downstream service is unavailable, every request
+// fails, and logging every failure would fill the disk.  First, we initialize
+// the logger manager (here with a 'ball::TestObserver', so that we can count
+// the published records):
+//..
+//  ball::TestObserver observer(bsl::cout);
+//
+//  ball::LoggerManagerConfiguration configuration;
+//  ball::LoggerManagerScopedGuard   guard(&observer, configuration);
+//..
+// Then, we define a function that reports a failure, logging at most one
+// error in every 1000 failures, and the first 3 failures in full:
+//..
+//  void reportFailure(int requestId)
+//  {
+//      BALL_LOG_SET_CATEGORY("DOWNSTREAM");
+//
+//      BALL_LOG_ERROR_FIRST_N(3) << "request " << requestId << " failed; "
+//                                << "further failures are sampled"
+//                                << BALL_LOG_END;
+//
+//      BALL_LOG_ERROR_EVERY_N(1000) << "request " << requestId << " failed"
+//                                   << BALL_LOG_END;
+//  }
+//..
+// Now, we report 10000 failures:
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      reportFailure(i);
+//  }
+//..
+// Finally, we verify that 3 + 10 records were published:
+//..
+//  assert(13 == observer.numPublishedRecords());
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALL_LOG
+#include <ball_log.h>
+#endif
+
+#ifndef INCLUDED_BALL_SEVERITY
+#include <ball_severity.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+                       // ========================
+                       // Throttled Logging Macros
+                       // ========================
+
+#define BALL_LOG_THROTTLE_STREAM_IMP(BALL_SEVERITY, BALL_ADMIT, BALL_ARG)     \
+{                                                                             \
+    using namespace BloombergLP;                                              \
+    if (BALL_LOG_THRESHOLD >= (BALL_SEVERITY)) {                              \
+        static ball::LogThrottle_Site ball_lOcAl_SiTe;                        \
+        if (ball::Log::isCategoryEnabled(&BALL_LOG_CATEGORYHOLDER,            \
+                                         BALL_SEVERITY)                       \
+         && ball::LogThrottle::BALL_ADMIT(&ball_lOcAl_SiTe,                   \
+                                          BALL_ARG,                           \
+                                          BALL_LOG_CATEGORY,                  \
+                                          BALL_SEVERITY,                      \
+                                          __FILE__,                           \
+                                          __LINE__)) {                        \
+            ball::Log_Stream ball_lOcAl_StReAm(BALL_LOG_CATEGORY, __FILE__,   \
+                                               __LINE__, BALL_SEVERITY);      \
+            BALL_STREAM
+
+#define BALL_LOG_STREAM_EVERY_N(BALL_SEVERITY, N)                             \
+    BALL_LOG_THROTTLE_STREAM_IMP(BALL_SEVERITY, admitEveryN, N)
+
+#define BALL_LOG_STREAM_FIRST_N(BALL_SEVERITY, N)                             \
+    BALL_LOG_THROTTLE_STREAM_IMP(BALL_SEVERITY, admitFirstN, N)
+
+#define BALL_LOG_STREAM_RATE(BALL_SEVERITY, PER_SECOND)                       \
+    BALL_LOG_THROTTLE_STREAM_IMP(BALL_SEVERITY, admitRate, PER_SECOND)
+
+#define BALL_LOG_TRACE_EVERY_N(N)                                             \
+    BALL_LOG_STREAM_EVERY_N(ball::Severity::e_TRACE, N)
+#define BALL_LOG_DEBUG_EVERY_N(N)                                             \
+    BALL_LOG_STREAM_EVERY_N(ball::Severity::e_DEBUG, N)
+#define BALL_LOG_INFO_EVERY_N(N)                                              \
+    BALL_LOG_STREAM_EVERY_N(ball::Severity::e_INFO, N)
+#define BALL_LOG_WARN_EVERY_N(N)                                              \
+    BALL_LOG_STREAM_EVERY_N(ball::Severity::e_WARN, N)
+#define BALL_LOG_ERROR_EVERY_N(N)                                             \
+    BALL_LOG_STREAM_EVERY_N(ball::Severity::e_ERROR, N)
+#define BALL_LOG_FATAL_EVERY_N(N)                                             \
+    BALL_LOG_STREAM_EVERY_N(ball::Severity::e_FATAL, N)
+
+#define BALL_LOG_TRACE_FIRST_N(N)                                             \
+    BALL_LOG_STREAM_FIRST_N(ball::Severity::e_TRACE, N)
+#define BALL_LOG_DEBUG_FIRST_N(N)                                             \
+    BALL_LOG_STREAM_FIRST_N(ball::Severity::e_DEBUG, N)
+#define BALL_LOG_INFO_FIRST_N(N)                                              \
+    BALL_LOG_STREAM_FIRST_N(ball::Severity::e_INFO, N)
+#define BALL_LOG_WARN_FIRST_N(N)                                              \
+    BALL_LOG_STREAM_FIRST_N(ball::Severity::e_WARN, N)
+#define BALL_LOG_ERROR_FIRST_N(N)                                             \
+    BALL_LOG_STREAM_FIRST_N(ball::Severity::e_ERROR, N)
+#define BALL_LOG_FATAL_FIRST_N(N)                                             \
+    BALL_LOG_STREAM_FIRST_N(ball::Severity::e_FATAL, N)
+
+#define BALL_LOG_TRACE_RATE(PER_SECOND)                                       \
+    BALL_LOG_STREAM_RATE(ball::Severity::e_TRACE, PER_SECOND)
+#define BALL_LOG_DEBUG_RATE(PER_SECOND)                                       \
+    BALL_LOG_STREAM_RATE(ball::Severity::e_DEBUG, PER_SECOND)
+#define BALL_LOG_INFO_RATE(PER_SECOND)                                        \
+    BALL_LOG_STREAM_RATE(ball::Severity::e_INFO, PER_SECOND)
+#define BALL_LOG_WARN_RATE(PER_SECOND)                                        \
+    BALL_LOG_STREAM_RATE(ball::Severity::e_WARN, PER_SECOND)
+#define BALL_LOG_ERROR_RATE(PER_SECOND)                                       \
+    BALL_LOG_STREAM_RATE(ball::Severity::e_ERROR, PER_SECOND)
+#define BALL_LOG_FATAL_RATE(PER_SECOND)                                       \
+    BALL_LOG_STREAM_RATE(ball::Severity::e_FATAL, PER_SECOND)
+
+namespace BloombergLP {
+namespace ball {
+
+class Category;
+
+                          // =======================
+                          // struct LogThrottle_Site
+                          // =======================
+
+struct LogThrottle_Site {
+    // This component-private 'struct' holds the state of one throttled
+    // logging statement.  It is a POD type, so that a function-scope static
+    // object of this type is zero-initialized before any code is run, and
+    // therefore requires no (thread-unsafe) dynamic initialization.
+
+    // PUBLIC DATA
+    bsls::AtomicOperations::AtomicTypes::Int64 d_numCalls;
+                                  // number of messages counted by an
+                                  // 'EVERY_N' or 'FIRST_N' statement
+
+    bsls::AtomicOperations::AtomicTypes::Int64 d_arrivalTime;
+                                  // theoretical arrival time, in nanoseconds
+                                  // on the 'bsls::TimeUtil' timer, of the
+                                  // next message of a 'RATE' statement
+
+    bsls::AtomicOperations::AtomicTypes::Int64 d_numSuppressed;
+                                  // number of messages suppressed since the
+                                  // last summary
+
+    bsls::AtomicOperations::AtomicTypes::Int64 d_summaryTime;
+                                  // time, in nanoseconds on the
+                                  // 'bsls::TimeUtil' timer, of the last
+                                  // summary (or of the first suppressed
+                                  // message), or 0 if no message was
+                                  // suppressed
+};
+
+                            // ==================
+                            // struct LogThrottle
+                            // ==================
+
+struct LogThrottle {
+    // This 'struct' provides a namespace for the functions used by the
+    // throttled logging macros to decide whether a message is logged, and
+    // for the configuration of the summaries of suppressed messages.  The
+    // admission functions are intended for use by the macros only, and should
+    // not be called directly.
+
+  private:
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_summaryInterval;
+                                  // minimum interval, in nanoseconds,
+                                  // between two summaries of a statement
+
+    // PRIVATE CLASS METHODS
+    static bool suppress(LogThrottle_Site *site,
+                         const char       *macroName,
+                         const Category   *category,
+                         int               severity,
+                         const char       *fileName,
+                         int               lineNumber);
+        // Count the suppression of a message by the logging statement having
+        // the specified 'site' state, and log a summary of the messages
+        // suppressed by that statement, attributed to the specified
+        // 'macroName', 'category', 'severity', 'fileName', and 'lineNumber',
+        // if the summary interval has elapsed since the last summary.  Return
+        // 'false'.
+
+    static void logSummary(bsls::Types::Int64  numSuppressed,
+                           const char         *macroName,
+                           const Category     *category,
+                           int                 severity,
+                           const char         *fileName,
+                           int                 lineNumber);
+        // Log a record reporting that the specified 'numSuppressed' messages
+        // were suppressed by the logging statement having the specified
+        // 'macroName', 'category', 'severity', 'fileName', and 'lineNumber'.
+
+  public:
+    // CLASS METHODS
+    static bool admitEveryN(LogThrottle_Site   *site,
+                            bsls::Types::Int64  n,
+                            const Category     *category,
+                            int                 severity,
+                            const char         *fileName,
+                            int                 lineNumber);
+        // Return 'true' if the message being logged by the logging statement
+        // having the specified 'site' state is the first message of that
+        // statement or is a multiple of the specified 'n' messages after it,
+        // and 'false' otherwise.  If 'false' is returned, count the message
+        // as suppressed, and log a summary, attributed to the specified
+        // 'category', 'severity', 'fileName', and 'lineNumber', if one is due
+        // (see {Suppressed-Message Summaries}).  The behavior is undefined
+        // unless '0 < n'.
+
+    static bool admitFirstN(LogThrottle_Site   *site,
+                            bsls::Types::Int64  n,
+                            const Category     *category,
+                            int                 severity,
+                            const char         *fileName,
+                            int                 lineNumber);
+        // Return 'true' if fewer than the specified 'n' messages were
+        // previously counted by the logging statement having the specified
+        // 'site' state, and 'false' otherwise.  If 'false' is returned, count
+        // the message as suppressed, and log a summary, attributed to the
+        // specified 'category', 'severity', 'fileName', and 'lineNumber', if
+        // one is due (see {Suppressed-Message Summaries}).  The behavior is
+        // undefined unless '0 <= n'.
+
+    static bool admitRate(LogThrottle_Site *site,
+                          double            perSecond,
+                          const Category   *category,
+                          int               severity,
+                          const char       *fileName,
+                          int               lineNumber);
+        // Return 'true' if logging a message by the logging statement having
+        // the specified 'site' state keeps the rate of messages logged by
+        // that statement within the specified 'perSecond' messages per
+        // second, allowing a burst of 'perSecond' (but at least one)
+        // messages, and 'false' otherwise.  If 'false' is returned, count the
+        // message as suppressed, and log a summary, attributed to the
+        // specified 'category', 'severity', 'fileName', and 'lineNumber', if
+        // one is due (see {Suppressed-Message Summaries}).  The behavior is
+        // undefined unless '0 < perSecond'.
+
+    static void setSummaryInterval(const bsls::TimeInterval& interval);
+        // Set the minimum interval between two summaries of the messages
+        // suppressed by a logging statement to the specified 'interval'.  The
+        // behavior is undefined unless 'bsls::TimeInterval() < interval'.
+
+    static bsls::TimeInterval summaryInterval();
+        // Return the minimum interval between two summaries of the messages
+        // suppressed by a logging statement.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // struct LogThrottle
+                            // ------------------
+
+// CLASS METHODS
+inline
+bool LogThrottle::admitEveryN(LogThrottle_Site   *site,
+                              bsls::Types::Int64  n,
+                              const Category     *category,
+                              int                 severity,
+                              const char         *fileName,
+                              int                 lineNumber)
+{
+    typedef bsls::AtomicOperations Ops;
+
+    const bsls::Types::Int64 count =
+                              Ops::addInt64NvRelaxed(&site->d_numCalls, 1) - 1;
+
+    return 0 == count % n || suppress(site,
+                                      "BALL_LOG_EVERY_N",
+                                      category,
+                                      severity,
+                                      fileName,
+                                      lineNumber);
+}
+
+inline
+bool LogThrottle::admitFirstN(LogThrottle_Site   *site,
+                              bsls::Types::Int64  n,
+                              const Category     *category,
+                              int                 severity,
+                              const char         *fileName,
+                              int                 lineNumber)
+{
+    typedef bsls::AtomicOperations Ops;
+
+    // Stop counting once 'n' is reached, so that the counter cannot overflow.
+
+    if (Ops::getInt64Relaxed(&site->d_numCalls) < n
+     && Ops::addInt64NvRelaxed(&site->d_numCalls, 1) <= n) {
+        return true;                                                  // RETURN
+    }
+    return suppress(site,
+                    "BALL_LOG_FIRST_N",
+                    category,
+                    severity,
+                    fileName,
+                    lineNumber);
+}
+
+inline
+bool LogThrottle::admitRate(LogThrottle_Site *site,
+                            double            perSecond,
+                            const Category   *category,
+                            int               severity,
+                            const char       *fileName,
+                            int               lineNumber)
+{
+    typedef bsls::AtomicOperations Ops;
+
+    const double k_NANOSECS_PER_SEC = 1.0e9;
+
+    bsls::Types::Int64 interval =
+                      static_cast<bsls::Types::Int64>(k_NANOSECS_PER_SEC
+                                                                / perSecond);
+    if (interval < 1) {
+        interval = 1;
+    }
+    const bsls::Types::Int64 burst     = perSecond < 1.0
+                                       ? 1
+                                       : static_cast<bsls::Types::Int64>(
+                                                                   perSecond);
+    const bsls::Types::Int64 tolerance = (burst - 1) * interval;
+    const bsls::Types::Int64 now       = bsls::TimeUtil::getTimer();
+
+    bsls::Types::Int64 arrivalTime =
+                                    Ops::getInt64Relaxed(&site->d_arrivalTime);
+    for (;;) {
+        const bsls::Types::Int64 start = arrivalTime < now ? now : arrivalTime;
+        if (start - now > tolerance) {
+            return suppress(site,
+                            "BALL_LOG_RATE",
+                            category,
+                            severity,
+                            fileName,
+                            lineNumber);                              // RETURN
+        }
+
+        const bsls::Types::Int64 previous = Ops::testAndSwapInt64AcqRel(
+                                                          &site->d_arrivalTime,
+                                                          arrivalTime,
+                                                          start + interval);
+        if (previous == arrivalTime) {
+            return true;                                              // RETURN
+        }
+        arrivalTime = previous;
+    }
+}
+
+inline
+bool LogThrottle::suppress(LogThrottle_Site *site,
+                           const char       *macroName,
+                           const Category   *category,
+                           int               severity,
+                           const char       *fileName,
+                           int               lineNumber)
+{
+    typedef bsls::AtomicOperations Ops;
+
+    Ops::addInt64Relaxed(&site->d_numSuppressed, 1);
+
+    const bsls::Types::Int64 now         = bsls::TimeUtil::getTimer();
+    const bsls::Types::Int64 summaryTime =
+                                    Ops::getInt64Relaxed(&site->d_summaryTime);
+
+    if (0 == summaryTime) {
+        // Start the first summary interval at the first suppressed message.
+
+        Ops::testAndSwapInt64(&site->d_summaryTime, 0, now);
+    }
+    else if (now - summaryTime >= Ops::getInt64Relaxed(&s_summaryInterval)
+          && summaryTime == Ops::testAndSwapInt64(&site->d_summaryTime,
+                                                  summaryTime,
+                                                  now)) {
+        logSummary(Ops::swapInt64(&site->d_numSuppressed, 0),
+                   macroName,
+                   category,
+                   severity,
+                   fileName,
+                   lineNumber);
+    }
+    return false;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,801 @@
+// ball_logthrottle.t.cpp                                             -*-C++-*-
+#include <ball_logthrottle.h>
+
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_testobserver.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test provides logging macros that admit only some of
+// the messages of each logging statement, and the admission functions used
+// by those macros.  We first verify the admission functions directly, then
+// the periodic summaries of suppressed messages, and finally the macros,
+// including their use by several threads concurrently.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool admitEveryN(Site *, Int64, const Category *, int, ...);
+// [ 2] bool admitFirstN(Site *, Int64, const Category *, int, ...);
+// [ 3] bool admitRate(Site *, double, const Category *, int, ...);
+// [ 4] void setSummaryInterval(const bsls::TimeInterval& interval);
+// [ 4] bsls::TimeInterval summaryInterval();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] BALL_LOG_<LEVEL>_EVERY_N, BALL_LOG_<LEVEL>_FIRST_N
+// [ 5] BALL_LOG_<LEVEL>_RATE
+// [ 6] CONCURRENT LOGGING
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::LogThrottle      Obj;
+typedef ball::LogThrottle_Site Site;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int numEvaluations = 0;
+
+static int evaluate()
+    // Increment 'numEvaluations' and return its new value.  Note that this
+    // function is streamed to the macros under test to detect whether their
+    // streamed expressions are evaluated.
+{
+    return ++numEvaluations;
+}
+
+static void logEveryN(int severity, int n)
+    // Log a message of the specified 'severity' using the 'EVERY_N' macro
+    // with the specified 'n'.
+{
+    BALL_LOG_SET_CATEGORY("EVERY_N");
+
+    BALL_LOG_STREAM_EVERY_N(severity, n) << evaluate() << BALL_LOG_END;
+}
+
+static void logFirstN(int severity, int n)
+    // Log a message of the specified 'severity' using the 'FIRST_N' macro
+    // with the specified 'n'.
+{
+    BALL_LOG_SET_CATEGORY("FIRST_N");
+
+    BALL_LOG_STREAM_FIRST_N(severity, n) << evaluate() << BALL_LOG_END;
+}
+
+static int logEachLevel(int i)
+    // Log, with index the specified 'i', one message using each of the
+    // severity-specific throttled macros, and return the number of macros
+    // used.
+{
+    BALL_LOG_SET_CATEGORY("LEVELS");
+
+    BALL_LOG_TRACE_EVERY_N(2) << i << BALL_LOG_END;
+    BALL_LOG_DEBUG_EVERY_N(2) << i << BALL_LOG_END;
+    BALL_LOG_INFO_EVERY_N(2)  << i << BALL_LOG_END;
+    BALL_LOG_WARN_EVERY_N(2)  << i << BALL_LOG_END;
+    BALL_LOG_ERROR_EVERY_N(2) << i << BALL_LOG_END;
+    BALL_LOG_FATAL_EVERY_N(2) << i << BALL_LOG_END;
+
+    BALL_LOG_TRACE_FIRST_N(2) << i << BALL_LOG_END;
+    BALL_LOG_DEBUG_FIRST_N(2) << i << BALL_LOG_END;
+    BALL_LOG_INFO_FIRST_N(2)  << i << BALL_LOG_END;
+    BALL_LOG_WARN_FIRST_N(2)  << i << BALL_LOG_END;
+    BALL_LOG_ERROR_FIRST_N(2) << i << BALL_LOG_END;
+    BALL_LOG_FATAL_FIRST_N(2) << i << BALL_LOG_END;
+
+    BALL_LOG_TRACE_RATE(0.001) << i << BALL_LOG_END;
+    BALL_LOG_DEBUG_RATE(0.001) << i << BALL_LOG_END;
+    BALL_LOG_INFO_RATE(0.001)  << i << BALL_LOG_END;
+    BALL_LOG_WARN_RATE(0.001)  << i << BALL_LOG_END;
+    BALL_LOG_ERROR_RATE(0.001) << i << BALL_LOG_END;
+    BALL_LOG_FATAL_RATE(0.001) << i << BALL_LOG_END;
+
+    return 18;
+}
+
+// ============================================================================
+//                         CASE 6 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOGTHROTTLE_TEST_CASE_6 {
+
+enum {
+    k_NUM_THREADS  = 8,     // number of logging threads
+    k_NUM_MESSAGES = 10000  // number of messages logged by each thread
+};
+
+extern "C" void *logThread(void *)
+    // Log 'k_NUM_MESSAGES' messages using an 'EVERY_N' and a 'FIRST_N'
+    // statement shared with the other logging threads.
+{
+    BALL_LOG_SET_CATEGORY("CONCURRENT");
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        BALL_LOG_ERROR_EVERY_N(100) << "every-n " << i << BALL_LOG_END;
+        BALL_LOG_ERROR_FIRST_N(100) << "first-n " << i << BALL_LOG_END;
+    }
+    return 0;
+}
+
+}  // close namespace BALL_LOGTHROTTLE_TEST_CASE_6
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOGTHROTTLE_USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Limiting the Errors Logged on Failure of a Downstream Service
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service logs an error every time a request to a downstream
+// service fails.  When the downstream service is unavailable, every request
+// fails, and logging every failure would fill the disk.
+//
+// Then, we define a function that reports a failure, logging at most one
+// error in every 1000 failures, and the first 3 failures in full:
+//..
+    void reportFailure(int requestId)
+    {
+        BALL_LOG_SET_CATEGORY("DOWNSTREAM");
+
+        BALL_LOG_ERROR_FIRST_N(3) << "request " << requestId << " failed; "
+                                  << "further failures are sampled"
+                                  << BALL_LOG_END;
+
+        BALL_LOG_ERROR_EVERY_N(1000) << "request " << requestId << " failed"
+                                     << BALL_LOG_END;
+    }
+//..
+
+}  // close namespace BALL_LOGTHROTTLE_USAGE_EXAMPLE
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Long summary intervals keep summaries out of the tests that do not
+    // expect them.
+
+    Obj::setSummaryInterval(bsls::TimeInterval(3600, 0));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file
+        //:   compiles, links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace BALL_LOGTHROTTLE_USAGE_EXAMPLE;
+
+// First, we initialize the logger manager (here with a 'ball::TestObserver',
+// so that we can count the published records):
+//..
+    ball::TestObserver observer(bsl::cout);
+
+    ball::LoggerManagerConfiguration configuration;
+    ball::LoggerManagerScopedGuard   guard(&observer, configuration);
+//..
+// Now, we report 10000 failures:
+//..
+    for (int i = 0; i < 10000; ++i) {
+        reportFailure(i);
+    }
+//..
+// Finally, we verify that 3 + 10 records were published:
+//..
+    ASSERT(13 == observer.numPublishedRecords());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOGGING
+        //
+        // Concerns:
+        //: 1 A throttled statement used concurrently by several threads logs
+        //:   exactly the number of messages prescribed by its policy.
+        //
+        // Plan:
+        //: 1 Log 'k_NUM_MESSAGES' messages from each of 'k_NUM_THREADS'
+        //:   threads through one 'EVERY_N(100)' and one 'FIRST_N(100)'
+        //:   statement, and verify the number of published records.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT LOGGING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOGGING" << endl
+                          << "==================" << endl;
+
+        using namespace BALL_LOGTHROTTLE_TEST_CASE_6;
+
+        ball::TestObserver observer(bsl::cout);
+
+        ball::LoggerManagerConfiguration configuration;
+        ball::LoggerManagerScopedGuard   guard(&observer, configuration);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  &logThread,
+                                                  0));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        const int EXPECTED = k_NUM_THREADS * k_NUM_MESSAGES / 100 + 100;
+
+        ASSERTV(observer.numPublishedRecords(),
+                EXPECTED == observer.numPublishedRecords());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // THROTTLED LOGGING MACROS
+        //
+        // Concerns:
+        //: 1 The 'EVERY_N' macros log the first message and every 'N'th
+        //:   message thereafter, and the 'FIRST_N' macros log the first 'N'
+        //:   messages.
+        //:
+        //: 2 The 'RATE' macros log no more than their rate allows.
+        //:
+        //: 3 The expressions streamed to a suppressed message are not
+        //:   evaluated.
+        //:
+        //: 4 Messages of a disabled severity are neither logged nor counted.
+        //:
+        //: 5 A macro is provided for each severity.
+        //:
+        //: 6 Suppressed messages do not allocate memory.
+        //
+        // Plan:
+        //: 1 Log a sequence of messages through 'EVERY_N' and 'FIRST_N'
+        //:   statements, streaming a function that counts its calls, and
+        //:   verify the published records and the number of calls.  Log
+        //:   messages of a disabled severity between them, and verify that
+        //:   they do not affect the sequence.  (C-1, 3..4)
+        //:
+        //: 2 Log several messages using each severity-specific macro, and
+        //:   verify the number of published records.  (C-2, 5)
+        //:
+        //: 3 Install a test allocator as the default allocator and as the
+        //:   allocator of the logger manager, and verify that suppressed
+        //:   messages do not allocate.  (C-6)
+        //
+        // Testing:
+        //   BALL_LOG_<LEVEL>_EVERY_N, BALL_LOG_<LEVEL>_FIRST_N
+        //   BALL_LOG_<LEVEL>_RATE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THROTTLED LOGGING MACROS" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator ta("manager", veryVeryVerbose);
+        ball::TestObserver   observer(bsl::cout);
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard guard(&observer, configuration, &ta);
+
+        if (verbose) cout << "\tTesting 'EVERY_N' and 'FIRST_N'." << endl;
+        {
+            numEvaluations = 0;
+
+            for (int i = 0; i < 10; ++i) {
+                logEveryN(ball::Severity::e_DEBUG, 3);  // disabled
+                logEveryN(ball::Severity::e_WARN,  3);
+            }
+
+            // Messages 0, 3, 6, and 9 are logged.
+
+            ASSERTV(numEvaluations, 4 == numEvaluations);
+            ASSERTV(observer.numPublishedRecords(),
+                    4 == observer.numPublishedRecords());
+            const ball::RecordAttributes& attributes =
+                                 observer.lastPublishedRecord().fixedFields();
+            ASSERT(0 == bsl::strcmp("4", attributes.message()));
+
+            numEvaluations = 0;
+
+            for (int i = 0; i < 10; ++i) {
+                logFirstN(ball::Severity::e_DEBUG, 3);  // disabled
+                logFirstN(ball::Severity::e_WARN,  3);
+            }
+
+            ASSERTV(numEvaluations, 3 == numEvaluations);
+            ASSERTV(observer.numPublishedRecords(),
+                    7 == observer.numPublishedRecords());
+        }
+
+        if (verbose) cout << "\tTesting the macros of each severity." << endl;
+        {
+            const int NUM_PUBLISHED = observer.numPublishedRecords();
+
+            int numMacros = 0;
+            for (int i = 0; i < 10; ++i) {
+                numMacros = logEachLevel(i);
+            }
+            ASSERT(18 == numMacros);
+
+            // Only 'INFO', 'WARN', 'ERROR', and 'FATAL' are enabled: each
+            // 'EVERY_N(2)' logs 5 messages, each 'FIRST_N(2)' logs 2, and
+            // each 'RATE(0.001)' logs 1.
+
+            const int EXPECTED = NUM_PUBLISHED + 4 * (5 + 2 + 1);
+
+            ASSERTV(observer.numPublishedRecords(),
+                    EXPECTED == observer.numPublishedRecords());
+        }
+
+        if (verbose) cout << "\tTesting suppression without allocation."
+                          << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            logFirstN(ball::Severity::e_WARN, 3);  // suppressed
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            for (int i = 0; i < 1000; ++i) {
+                logFirstN(ball::Severity::e_WARN, 3);  // suppressed
+            }
+
+            ASSERTV(ta.numAllocations(), NUM_ALLOCATIONS,
+                    NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERTV(da.numAllocations(), 0 == da.numAllocations());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SUPPRESSED-MESSAGE SUMMARIES
+        //
+        // Concerns:
+        //: 1 The summary interval can be set and retrieved.
+        //:
+        //: 2 No summary is logged before the summary interval has elapsed
+        //:   since the first suppressed message.
+        //:
+        //: 3 A summary, reporting the number of messages suppressed since
+        //:   the last summary and having the category, severity, file name,
+        //:   and line number of the statement, is logged by the first
+        //:   suppressed message after the interval has elapsed.
+        //
+        // Plan:
+        //: 1 Set several summary intervals and verify the value returned by
+        //:   'summaryInterval'.  (C-1)
+        //:
+        //: 2 Suppress messages of a statement, verifying that no record is
+        //:   published, then wait for the summary interval, suppress one
+        //:   more message, and verify the published summary.  Repeat.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   void setSummaryInterval(const bsls::TimeInterval& interval);
+        //   bsls::TimeInterval summaryInterval();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SUPPRESSED-MESSAGE SUMMARIES" << endl
+                          << "============================" << endl;
+
+        if (verbose) cout << "\tTesting 'setSummaryInterval'." << endl;
+        {
+            const bsls::TimeInterval VALUES[] = {
+                bsls::TimeInterval(0, 1),
+                bsls::TimeInterval(0, 50000000),
+                bsls::TimeInterval(10, 0),
+                bsls::TimeInterval(3600, 999999999),
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                Obj::setSummaryInterval(VALUES[i]);
+                ASSERTV(i, VALUES[i] == Obj::summaryInterval());
+            }
+        }
+
+        if (verbose) cout << "\tTesting summaries." << endl;
+        {
+            ball::TestObserver observer(bsl::cout);
+
+            ball::LoggerManagerConfiguration configuration;
+            ball::LoggerManagerScopedGuard   guard(&observer, configuration);
+
+            ball::LoggerManager& manager = ball::LoggerManager::singleton();
+            const ball::Category *category = manager.setCategory("SUMMARY");
+
+            const bsls::TimeInterval INTERVAL(0, 100000000);  // 100 ms
+            Obj::setSummaryInterval(INTERVAL);
+
+            Site site = {};
+
+            ASSERT(true == Obj::admitFirstN(&site, 1, category,
+                                            ball::Severity::e_ERROR,
+                                            "file.cpp", 42));
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(false == Obj::admitFirstN(&site, 1, category,
+                                                 ball::Severity::e_ERROR,
+                                                 "file.cpp", 42));
+            }
+            ASSERT(0 == observer.numPublishedRecords());
+
+            for (int round = 0; round < 2; ++round) {
+                bslmt::ThreadUtil::sleep(INTERVAL + INTERVAL);
+
+                ASSERT(false == Obj::admitFirstN(&site, 1, category,
+                                                 ball::Severity::e_ERROR,
+                                                 "file.cpp", 42));
+                ASSERTV(round, observer.numPublishedRecords(),
+                        round + 1 == observer.numPublishedRecords());
+
+                const ball::RecordAttributes& attributes =
+                                 observer.lastPublishedRecord().fixedFields();
+
+                const char *EXPECTED = 0 == round
+                                ? "BALL_LOG_FIRST_N: 11 message(s) suppressed"
+                                : "BALL_LOG_FIRST_N: 4 message(s) suppressed";
+
+                if (veryVerbose) { P(attributes.message()); }
+
+                ASSERTV(round, attributes.message(),
+                        0 == bsl::strcmp(EXPECTED, attributes.message()));
+                ASSERT(0 == bsl::strcmp("SUMMARY", attributes.category()));
+                ASSERT(ball::Severity::e_ERROR == attributes.severity());
+                ASSERT(0 == bsl::strcmp("file.cpp", attributes.fileName()));
+                ASSERT(42 == attributes.lineNumber());
+
+                for (int i = 0; i < 3; ++i) {
+                    ASSERT(false == Obj::admitFirstN(&site, 1, category,
+                                                     ball::Severity::e_ERROR,
+                                                     "file.cpp", 42));
+                }
+                ASSERT(round + 1 == observer.numPublishedRecords());
+            }
+
+            Obj::setSummaryInterval(bsls::TimeInterval(3600, 0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'admitRate'
+        //
+        // Concerns:
+        //: 1 A statement admits a burst of 'perSecond' messages (but at least
+        //:   one message), and suppresses the messages that follow.
+        //:
+        //: 2 After a burst, messages are admitted at 'perSecond' messages
+        //:   per second.
+        //
+        // Plan:
+        //: 1 For several rates, verify the number of messages admitted by an
+        //:   immediate sequence of calls.  (C-1)
+        //:
+        //: 2 Exhaust the burst of a statement having a rate of 100 messages
+        //:   per second, wait for 200 ms, and verify that the statement
+        //:   admits about 20 messages, allowing for inaccuracy of the sleep.
+        //:   (C-2)
+        //
+        // Testing:
+        //   bool admitRate(Site *, double, const Category *, int, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'admitRate'" << endl
+                          << "===========" << endl;
+
+        if (verbose) cout << "\tTesting bursts." << endl;
+        {
+            static const struct {
+                int    d_line;       // source line number
+                double d_perSecond;  // rate
+                int    d_burst;      // expected number of admitted messages
+            } DATA[] = {
+                //LINE  PER_SECOND  BURST
+                //----  ----------  -----
+                { L_,       0.001,      1 },
+                { L_,       0.5,        1 },
+                { L_,       1.0,        1 },
+                { L_,       2.5,        2 },
+                { L_,      10.0,       10 },
+                { L_,    1000.0,     1000 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE       = DATA[ti].d_line;
+                const double PER_SECOND = DATA[ti].d_perSecond;
+                const int    BURST      = DATA[ti].d_burst;
+
+                Site site = {};
+
+                int numAdmitted = 0;
+                for (int i = 0; i < 2 * BURST + 10; ++i) {
+                    numAdmitted += Obj::admitRate(&site, PER_SECOND, 0,
+                                                  ball::Severity::e_ERROR,
+                                                  __FILE__, __LINE__);
+                }
+
+                // Allow one more message if the calls took longer than the
+                // emission interval.
+
+                ASSERTV(LINE, numAdmitted, BURST,
+                        BURST == numAdmitted || BURST + 1 == numAdmitted);
+            }
+        }
+
+        if (verbose) cout << "\tTesting sustained rate." << endl;
+        {
+            Site site = {};
+
+            int numAdmitted = 0;
+            for (int i = 0; i < 200; ++i) {
+                numAdmitted += Obj::admitRate(&site, 100, 0,
+                                              ball::Severity::e_ERROR,
+                                              __FILE__, __LINE__);
+            }
+            ASSERTV(numAdmitted, 100 <= numAdmitted && numAdmitted <= 101);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            bslmt::ThreadUtil::microSleep(200000);
+
+            numAdmitted = 0;
+            for (int i = 0; i < 1000; ++i) {
+                numAdmitted += Obj::admitRate(&site, 100, 0,
+                                              ball::Severity::e_ERROR,
+                                              __FILE__, __LINE__);
+            }
+            timer.stop();
+
+            const int EXPECTED = static_cast<int>(timer.elapsedTime() * 100);
+
+            if (veryVerbose) { P_(numAdmitted); P(EXPECTED); }
+
+            ASSERTV(numAdmitted, EXPECTED,
+                    15 <= numAdmitted && numAdmitted <= EXPECTED + 1);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'admitEveryN' AND 'admitFirstN'
+        //
+        // Concerns:
+        //: 1 'admitEveryN' admits the first message and every 'n'th message
+        //:   thereafter.
+        //:
+        //: 2 'admitFirstN' admits the first 'n' messages only, and admits no
+        //:   message if 'n' is 0.
+        //:
+        //: 3 Each site is independent.
+        //
+        // Plan:
+        //: 1 For several values of 'n', call each function with a fresh
+        //:   site, and verify the admitted messages.  (C-1..3)
+        //
+        // Testing:
+        //   bool admitEveryN(Site *, Int64, const Category *, int, ...);
+        //   bool admitFirstN(Site *, Int64, const Category *, int, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'admitEveryN' AND 'admitFirstN'" << endl
+                          << "===============================" << endl;
+
+        const int NS[] = { 0, 1, 2, 3, 7, 100 };
+        const int NUM_NS = sizeof NS / sizeof *NS;
+
+        for (int ni = 0; ni < NUM_NS; ++ni) {
+            const int N = NS[ni];
+
+            Site everySite = {};
+            Site firstSite = {};
+
+            for (int i = 0; i < 250; ++i) {
+                if (0 < N) {
+                    const bool EXP = 0 == i % N;
+                    ASSERTV(N, i, EXP == Obj::admitEveryN(
+                                                      &everySite, N, 0,
+                                                      ball::Severity::e_ERROR,
+                                                      __FILE__, __LINE__));
+                }
+
+                const bool EXP = i < N;
+                ASSERTV(N, i, EXP == Obj::admitFirstN(&firstSite, N, 0,
+                                                      ball::Severity::e_ERROR,
+                                                      __FILE__, __LINE__));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing.
+        //
+        // Plan:
+        //: 1 Log messages through each kind of throttled statement, and
+        //:   verify the number of published records.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ball::TestObserver observer(bsl::cout);
+
+        ball::LoggerManagerConfiguration configuration;
+        ball::LoggerManagerScopedGuard   guard(&observer, configuration);
+
+        BALL_LOG_SET_CATEGORY("BREATHING");
+
+        for (int i = 0; i < 100; ++i) {
+            BALL_LOG_ERROR_EVERY_N(10) << "every " << i << BALL_LOG_END;
+        }
+        ASSERT(10 == observer.numPublishedRecords());
+
+        for (int i = 0; i < 100; ++i) {
+            BALL_LOG_ERROR_FIRST_N(5) << "first " << i << BALL_LOG_END;
+        }
+        ASSERT(15 == observer.numPublishedRecords());
+
+        for (int i = 0; i < 100; ++i) {
+            BALL_LOG_ERROR_RATE(0.01) << "rate " << i << BALL_LOG_END;
+        }
+        ASSERT(16 == observer.numPublishedRecords());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -110,19 +110,209 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+                // --------------------------------------------
+                // struct RecordStringFormatter::TimestampCache
+                // --------------------------------------------
+
+// CREATORS
+RecordStringFormatter::TimestampCache::TimestampCache()
+: d_lock()  // value-initialized, hence equal to 'BSLS_SPINLOCK_UNLOCKED'
+, d_isValid(false)
+, d_datetimeLength(0)
+, d_iso8601Length(0)
+{
+}
+
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::compileFormat()
+{
+    bsl::vector<FormatOp> formatOps(d_formatOps.get_allocator());
+    bsl::string           literals(d_literals.get_allocator());
+    bool                  hasTimestamp = false;
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    // Verbatim text is accumulated into 'literals', and a single operation is
+    // emitted for each run of consecutive verbatim characters.
+
+    bsl::size_t runStart = 0;
+
+    while (iter != end) {
+        char conversion = 0;
+
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': {
+                literals += '%';
+              } break;
+              case 'd':
+              case 'i':
+              case 'I': {
+                hasTimestamp = true;
+                conversion   = *iter;
+              } break;
+              case 'p':
+              case 't':
+              case 's':
+              case 'f':
+              case 'F':
+              case 'l':
+              case 'c':
+              case 'm':
+              case 'x':
+              case 'X':
+              case 'u': {
+                conversion = *iter;
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                literals += '%';
+                literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n': {
+                literals += '\n';
+              } break;
+              case 't': {
+                literals += '\t';
+              } break;
+              case '\\': {
+                literals += '\\';
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                literals += '\\';
+                literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            literals += *iter;
+            ++iter;
+          }
+        }
+
+        if (conversion || iter == end) {
+            if (runStart != literals.length()) {
+                FormatOp op;
+                op.d_conversion = 0;
+                op.d_offset     = static_cast<int>(runStart);
+                op.d_length     = static_cast<int>(literals.length()
+                                                                  - runStart);
+                formatOps.push_back(op);
+                runStart = literals.length();
+            }
+            if (conversion) {
+                FormatOp op;
+                op.d_conversion = conversion;
+                op.d_offset     = 0;
+                op.d_length     = 0;
+                formatOps.push_back(op);
+            }
+        }
+    }
+
+    d_formatOps.swap(formatOps);
+    d_literals.swap(literals);
+    d_hasTimestamp = hasTimestamp;
+}
+
+// PRIVATE ACCESSORS
+void RecordStringFormatter::loadTimestampText(
+                                   char                  *datetime,
+                                   int                   *datetimeLength,
+                                   char                  *iso8601,
+                                   int                   *iso8601Length,
+                                   const bdlt::Datetime&  timestamp) const
+{
+    bdlt::Datetime second(timestamp);
+    second.setMillisecond(0);
+
+    // The cache is only ever "try-locked": a thread finding it in use by
+    // another thread formats the timestamp itself rather than waiting.
+
+    const bool isLocked = 0 == d_timestampCache.d_lock.tryLock();
+
+    if (isLocked
+     && d_timestampCache.d_isValid
+     && d_timestampCache.d_second == second) {
+        *datetimeLength = d_timestampCache.d_datetimeLength;
+        *iso8601Length  = d_timestampCache.d_iso8601Length;
+        bsl::memcpy(datetime, d_timestampCache.d_datetime, *datetimeLength);
+        bsl::memcpy(iso8601,  d_timestampCache.d_iso8601,  *iso8601Length);
+        d_timestampCache.d_lock.unlock();
+        return;                                                       // RETURN
+    }
+
+    // The "%d" format ends with a '.' and the three digits of the millisecond
+    // field, which are removed.
+
+    *datetimeLength = second.printToBuffer(datetime, 32) - 4;
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+    *iso8601Length = snprintf(iso8601,
+                              32,
+                              "%04d-%02d-%02dT%02d:%02d:%02d",
+                              second.year(),
+                              second.month(),
+                              second.day(),
+                              second.hour(),
+                              second.minute(),
+                              second.second());
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#undef snprintf
+#endif
+
+    if (isLocked) {
+        d_timestampCache.d_isValid        = true;
+        d_timestampCache.d_second         = second;
+        d_timestampCache.d_datetimeLength = *datetimeLength;
+        d_timestampCache.d_iso8601Length  = *iso8601Length;
+        bsl::memcpy(d_timestampCache.d_datetime, datetime, *datetimeLength);
+        bsl::memcpy(d_timestampCache.d_iso8601,  iso8601,  *iso8601Length);
+        d_timestampCache.d_lock.unlock();
+    }
+}
 
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_formatOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_formatOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -130,7 +320,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_formatOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -144,7 +338,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_formatOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -153,7 +351,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_formatOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -168,7 +370,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_formatOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -176,6 +382,9 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_formatOps(original.d_formatOps, basicAllocator)
+, d_literals(original.d_literals, basicAllocator)
+, d_hasTimestamp(original.d_hasTimestamp)
 {
 }
 
@@ -190,35 +399,67 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        d_formatOps       = rhs.d_formatOps;
+        d_literals        = rhs.d_literals;
+        d_hasTimestamp    = rhs.d_hasTimestamp;
     }
 
     return *this;
 }
 
+void RecordStringFormatter::setFormat(const char *format)
+{
+    d_formatSpec = format;
+    compileFormat();
+}
+
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
 
 {
     const RecordAttributes& fixedFields = record.fixedFields();
-    bdlt::Datetime                timestamp   = fixedFields.timestamp();
 
-    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
+    // Text of the timestamp, excluding the millisecond field, in the "%d" and
+    // "%i" formats.
+
+    char datetimeText[32];
+    int  datetimeLength = 0;
+    char iso8601Text[32];
+    int  iso8601Length  = 0;
+    int  millisecond    = 0;
+
+    if (d_hasTimestamp) {
+        bdlt::Datetime timestamp = fixedFields.timestamp();
+
+        if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
                                        d_timestampOffset.totalMilliseconds()) {
-        int localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(timestamp).totalSeconds();
-        timestamp.addSeconds(localTimeOffsetInSeconds);
-    } else if(k_DISABLE_PUBLISH_IN_LOCALTIME ==
+            int localTimeOffsetInSeconds =
+              bdlt::LocalTimeOffset::localTimeOffset(timestamp).totalSeconds();
+            timestamp.addSeconds(localTimeOffsetInSeconds);
+        } else if(k_DISABLE_PUBLISH_IN_LOCALTIME ==
                                        d_timestampOffset.totalMilliseconds()) {
-        // Do not adjust 'timestamp'.
-    } else {
-        timestamp += d_timestampOffset;
+            // Do not adjust 'timestamp'.
+        } else {
+            timestamp += d_timestampOffset;
+        }
+
+        loadTimestampText(datetimeText,
+                          &datetimeLength,
+                          iso8601Text,
+                          &iso8601Length,
+                          timestamp);
+        millisecond = timestamp.millisecond();
     }
 
-    // Step through the format string, outputting the required elements.
+    // The three digits of the millisecond field, preceded by a '.'.
 
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
+    const char millisecondText[] = {
+        '.',
+        static_cast<char>('0' + millisecond / 100),
+        static_cast<char>('0' + millisecond / 10 % 10),
+        static_cast<char>('0' + millisecond % 10)
+    };
 
     // Create a buffer on the stack for formatting the record.  Note that the
     // size of the buffer should be slightly larger than the amount we reserve
@@ -234,170 +475,111 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(STRING_RESERVATION);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    // Execute the compiled format specification, outputting the required
+    // elements.
 
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': {
-                char buffer[32];
-                timestamp.printToBuffer(buffer, sizeof buffer);
+    const char *literals = d_literals.data();
 
-                output += buffer;
-              } break;
-              case 'I': // fall through intentionally
-              case 'i': {
-                // use ISO8601 "extended" format
-
-                char buffer[32];
-
-                snprintf(buffer,
-                         sizeof(buffer),
-                         "%04d-%02d-%02dT%02d:%02d:%02d",
-                         timestamp.year(),
-                         timestamp.month(),
-                         timestamp.day(),
-                         timestamp.hour(),
-                         timestamp.minute(),
-                         timestamp.second());
-                output += buffer;
-
-                if ('I' == *iter) {
-                    snprintf(buffer,
-                             sizeof(buffer),
-                             ".%03d",
-                             timestamp.millisecond());
-
-                    output += buffer;
-                }
+    for (bsl::vector<FormatOp>::const_iterator op  = d_formatOps.begin();
+                                               op != d_formatOps.end();
+                                               ++op) {
+        switch (op->d_conversion) {
+          case 0: {
+            output.append(literals + op->d_offset, op->d_length);
+          } break;
+          case 'd': {
+            output.append(datetimeText, datetimeLength);
+            output.append(millisecondText, sizeof millisecondText);
+          } break;
+          case 'I': // fall through intentionally
+          case 'i': {
+            // use ISO8601 "extended" format
 
-                if (0 == d_timestampOffset.totalMilliseconds()) {
-                    output += 'Z';
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
-                                 (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
+            output.append(iso8601Text, iso8601Length);
+
+            if ('I' == op->d_conversion) {
+                output.append(millisecondText, sizeof millisecondText);
+            }
+
+            if (0 == d_timestampOffset.totalMilliseconds()) {
+                output += 'Z';
+            }
+          } break;
+          case 'p': {
+            appendToString(&output, fixedFields.processID());
+          } break;
+          case 't': {
+            appendToString(&output, fixedFields.threadID());
+          } break;
+          case 's': {
+            output += Severity::toAscii(
+                                     (Severity::Level)fixedFields.severity());
+          } break;
+          case 'f': {
+            output += fixedFields.fileName();
+          } break;
+          case 'F': {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
 #ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
+                filename.rfind('\\');
 #else
-                    filename.rfind('/');
+                filename.rfind('/');
 #endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = fixedFields.messageStreamBuf().length();
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = fixedFields.messageStreamBuf().length();
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& userFields = record.userFields();
-                const int numUserFields  = userFields.length();
-
-                if (numUserFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = userFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != userFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
-
-                output += '%';
-                output += *iter;
-              }
+            if (bsl::string::npos == rightmostSlashIndex) {
+                output += filename;
             }
-            ++iter;
-          } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
+            else {
+                output.append(filename, rightmostSlashIndex + 1,
+                              bsl::string::npos);
             }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+          } break;
+          case 'l': {
+            appendToString(&output, fixedFields.lineNumber());
+          } break;
+          case 'c': {
+            output += fixedFields.category();
+          } break;
+          case 'm': {
+            bslstl::StringRef message = fixedFields.messageRef();
+            output.append(message.data(), message.length());
+          } break;
+          case 'x': {
+            bsl::stringstream ss;
+            int length = fixedFields.messageStreamBuf().length();
+            bdlb::Print::printString(ss,
+                                    fixedFields.message(),
+                                    length,
+                                    false);
+            output += ss.str();
+          } break;
+          case 'X': {
+            bsl::stringstream ss;
+            int length = fixedFields.messageStreamBuf().length();
+            bdlb::Print::singleLineHexDump(ss,
+                                          fixedFields.message(),
+                                          length);
+            output += ss.str();
+          } break;
+          case 'u': {
+            typedef ball::UserFields Values;
+            const Values& userFields = record.userFields();
+            const int numUserFields  = userFields.length();
 
-                output += '\\';
-                output += *iter;
-              }
+            if (numUserFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = userFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != userFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output += ss.str();
             }
-            ++iter;
           } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
         }
     }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
     stream.write(output.c_str(), output.size());
     stream.flush();
 
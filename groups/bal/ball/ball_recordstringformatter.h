@@ -89,6 +89,24 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Performance
+///-----------
+// The format specification of a record formatter is translated, when it is
+// supplied (at construction, by 'setFormat', or by assignment), into a
+// sequence of formatting operations in which consecutive verbatim characters
+// (including the expansions of '%%' and the '\'-escape sequences) are merged
+// into a single run of text.  Formatting a record therefore executes one
+// operation per conversion specification or run of text, rather than
+// re-interpreting the format specification character by character.
+//
+// In addition, a record formatter caches the text of the most recently
+// formatted timestamp up to (and excluding) its millisecond field, so that
+// the timestamps of successive records logged within the same second are
+// formatted by copying that text and appending the milliseconds.  The cache
+// is guarded by a spin lock that is never waited upon: a thread that finds
+// the cache in use formats the timestamp directly.  The output of a record
+// formatter does not depend on the state of its cache.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -127,6 +145,10 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 #endif
 
+#ifndef INCLUDED_BDLT_DATETIME
+#include <bdlt_datetime.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIMEINTERVAL
 #include <bdlt_datetimeinterval.h>
 #endif
@@ -143,6 +165,10 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLS_SPINLOCK
+#include <bsls_spinlock.h>
+#endif
+
 #ifndef INCLUDED_BSL_IOSFWD
 #include <bsl_iosfwd.h>
 #endif
@@ -151,6 +177,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 
 namespace ball {
@@ -186,10 +216,76 @@ class RecordStringFormatter {
                                               // adjusted to the current local
                                               // time.
 
+    // PRIVATE TYPES
+    struct FormatOp {
+        // This 'struct' describes one operation of a compiled format
+        // specification: either the output of a run of verbatim text, or the
+        // output of one field of a record.
+
+        char d_conversion;  // conversion character (e.g., 'd' for "%d"), or
+                            // 0 for a run of verbatim text
+
+        int  d_offset;      // offset of the text in 'd_literals'
+
+        int  d_length;      // length of the text
+    };
+
+    struct TimestampCache {
+        // This 'struct' holds the text of the most recently formatted
+        // timestamp, up to (and excluding) its millisecond field.
+
+        bsls::SpinLock d_lock;              // guards the other members
+
+        bool           d_isValid;           // 'true' once 'd_second' is set
+
+        bdlt::Datetime d_second;            // cached timestamp, truncated to
+                                            // the second
+
+        char           d_datetime[32];      // "%d" text of 'd_second'
+
+        int            d_datetimeLength;    // length of 'd_datetime'
+
+        char           d_iso8601[32];       // "%i" text of 'd_second'
+
+        int            d_iso8601Length;     // length of 'd_iso8601'
+
+        // CREATORS
+        TimestampCache();
+            // Create an empty, unlocked timestamp cache.
+    };
+
     // DATA
     bsl::string            d_formatSpec;       // 'printf'-style format spec.
     bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
 
+    bsl::vector<FormatOp>  d_formatOps;        // compiled 'd_formatSpec'
+
+    bsl::string            d_literals;         // verbatim text referred to by
+                                               // 'd_formatOps'
+
+    bool                   d_hasTimestamp;     // 'true' if 'd_formatSpec'
+                                               // outputs a timestamp
+
+    mutable TimestampCache d_timestampCache;   // last formatted timestamp
+
+    // PRIVATE MANIPULATORS
+    void compileFormat();
+        // Translate 'd_formatSpec' into 'd_formatOps', 'd_literals', and
+        // 'd_hasTimestamp'.
+
+    // PRIVATE ACCESSORS
+    void loadTimestampText(char                  *datetime,
+                           int                   *datetimeLength,
+                           char                  *iso8601,
+                           int                   *iso8601Length,
+                           const bdlt::Datetime&  timestamp) const;
+        // Load into the specified 'datetime' and 'iso8601' buffers, each
+        // having at least 32 bytes, the "%d" and "%i" representations of the
+        // specified 'timestamp' truncated to the second, excluding the
+        // millisecond field, and load their lengths into the specified
+        // 'datetimeLength' and 'iso8601Length', using the timestamp cache of
+        // this record formatter if possible.
+
   public:
     // TRAITS
     BSLALG_DECLARE_NESTED_TRAITS(RecordStringFormatter,
@@ -364,12 +460,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
@@ -15,6 +15,8 @@
 #include <ball_userfields.h>
 #include <bslmt_threadutil.h>
 
+#include <bdlb_print.h>
+
 #include <bdlt_currenttime.h>
 #include <bslim_testutil.h>
 
@@ -26,15 +28,23 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <bslstl_stringref.h>
+
 
 #include <bsl_iostream.h>
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+#include <bsl_climits.h>                  // for 'INT_MAX'
+#include <bsl_cstdio.h>                   // for 'sprintf'
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>                  // for 'strcmp'
@@ -79,12 +89,14 @@ using bsl::string;
 // [13] void disablePublishInLocalTime();
 // [13] void enablePublishInLocalTime();
 // [ 2] void setFormat(const char *format);
+// [14] void setFormat(const char *format);
 // [ 2] void setTimestampOffset(const bdlt::DatetimeInterval& offset);
 // ACCESSORS
 // [ 2] const char *format() const;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [14] void operator()(bsl::ostream&, const ball::Record&) const;
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
 // [ 6] bool operator!=(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -92,6 +104,8 @@ using bsl::string;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] COMPILED FORMAT SPECIFICATIONS
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -248,6 +262,278 @@ bool compareText(bslstl::StringRef lhs, bslstl::StringRef rhs)
 
 namespace {
 
+void appendToString(bsl::string *result, int value)
+    // Append the decimal representation of the specified 'value' to the
+    // specified 'result'.
+{
+    char buffer[16];
+    bsl::sprintf(buffer, "%d", value);
+    *result += buffer;
+}
+
+void appendToString(bsl::string *result, bsls::Types::Uint64 value)
+    // Append the decimal representation of the specified 'value' to the
+    // specified 'result'.
+{
+    char buffer[32];
+    bsl::sprintf(buffer, "%llu", value);
+    *result += buffer;
+}
+
+void referenceFormat(bsl::ostream&                 stream,
+                     const char                   *format,
+                     const bdlt::DatetimeInterval&  offset,
+                     const ball::Record&           record)
+    // Format the specified 'record' to the specified 'stream' as would a
+    // record formatter having the specified 'format' and timestamp 'offset',
+    // by interpreting 'format' character by character.  This function
+    // reproduces the implementation of 'operator()' that preceded the
+    // compilation of format specifications, and serves as an oracle.
+{
+    const ball::RecordAttributes& fixedFields = record.fixedFields();
+    bdlt::Datetime                timestamp   = fixedFields.timestamp();
+
+    if (INT_MAX == offset.totalMilliseconds()) {
+        timestamp.addSeconds(
+             bdlt::LocalTimeOffset::localTimeOffset(timestamp).totalSeconds());
+    }
+    else if (INT_MIN != offset.totalMilliseconds()) {
+        timestamp += offset;
+    }
+
+    const char *iter = format;
+    const char *end  = format + bsl::strlen(format);
+
+    bsl::string output;
+
+    while (iter != end) {
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': {
+                output += '%';
+              } break;
+              case 'd': {
+                char buffer[32];
+                timestamp.printToBuffer(buffer, sizeof buffer);
+                output += buffer;
+              } break;
+              case 'I':
+              case 'i': {
+                char buffer[32];
+                bsl::sprintf(buffer,
+                             "%04d-%02d-%02dT%02d:%02d:%02d",
+                             timestamp.year(),
+                             timestamp.month(),
+                             timestamp.day(),
+                             timestamp.hour(),
+                             timestamp.minute(),
+                             timestamp.second());
+                output += buffer;
+                if ('I' == *iter) {
+                    bsl::sprintf(buffer, ".%03d", timestamp.millisecond());
+                    output += buffer;
+                }
+                if (0 == offset.totalMilliseconds()) {
+                    output += 'Z';
+                }
+              } break;
+              case 'p': {
+                appendToString(&output, fixedFields.processID());
+              } break;
+              case 't': {
+                appendToString(&output, fixedFields.threadID());
+              } break;
+              case 's': {
+                output += ball::Severity::toAscii(
+                           (ball::Severity::Level)fixedFields.severity());
+              } break;
+              case 'f': {
+                output += fixedFields.fileName();
+              } break;
+              case 'F': {
+                const bsl::string& filename = fixedFields.fileName();
+                bsl::string::size_type index =
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+                                                         filename.rfind('\\');
+#else
+                                                          filename.rfind('/');
+#endif
+                output += bsl::string::npos == index
+                          ? filename
+                          : filename.substr(index + 1);
+              } break;
+              case 'l': {
+                appendToString(&output, fixedFields.lineNumber());
+              } break;
+              case 'c': {
+                output += fixedFields.category();
+              } break;
+              case 'm': {
+                bslstl::StringRef message = fixedFields.messageRef();
+                output.append(message.data(), message.length());
+              } break;
+              case 'x': {
+                bsl::stringstream ss;
+                bdlb::Print::printString(
+                                     ss,
+                                     fixedFields.message(),
+                                     fixedFields.messageStreamBuf().length(),
+                                     false);
+                output += ss.str();
+              } break;
+              case 'X': {
+                bsl::stringstream ss;
+                bdlb::Print::singleLineHexDump(
+                                     ss,
+                                     fixedFields.message(),
+                                     fixedFields.messageStreamBuf().length());
+                output += ss.str();
+              } break;
+              case 'u': {
+                const ball::UserFields& userFields = record.userFields();
+                if (userFields.length() > 0) {
+                    bsl::stringstream ss;
+                    ball::UserFields::ConstIterator it = userFields.begin();
+                    ss << *it;
+                    for (++it; it != userFields.end(); ++it) {
+                        ss << " " << *it;
+                    }
+                    output += ss.str();
+                }
+              } break;
+              default: {
+                output += '%';
+                output += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n': {
+                output += '\n';
+              } break;
+              case 't': {
+                output += '\t';
+              } break;
+              case '\\': {
+                output += '\\';
+              } break;
+              default: {
+                output += '\\';
+                output += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            output += *iter;
+            ++iter;
+          }
+        }
+    }
+
+    stream.write(output.c_str(), output.size());
+    stream.flush();
+}
+
+const char *const COMPILE_FORMATS[] = {
+    // format specifications exercising every conversion, every escape
+    // sequence, and incomplete and unknown sequences
+
+    "",
+    "%",
+    "\\",
+    "%%",
+    "\\\\",
+    "%%%",
+    "abc",
+    "abc%",
+    "abc\\",
+    "%z%Z%0%\\",
+    "\\q\\%\\n\\t",
+    "%d",
+    "%d%d",
+    "%i|%I",
+    "[%d] [%i] [%I]",
+    "%p:%t %s",
+    "%f %F:%l",
+    "%c",
+    "%m|%x|%X",
+    "%u",
+    "%%d %%i \\%d",
+    "\n%d %p:%t %s %f:%l %c %m %u\n",
+    "\n%I %p:%t %s %F:%l %c %x %u\n",
+    "text only, but rather long: 0123456789012345678901234567890123456789",
+};
+const int NUM_COMPILE_FORMATS = static_cast<int>(
+                          sizeof COMPILE_FORMATS / sizeof *COMPILE_FORMATS);
+
+ball::Record makeRecord(const bdlt::Datetime& timestamp,
+                        const char           *message,
+                        bool                  withUserFields)
+    // Return a record having the specified 'timestamp' and 'message', and
+    // having user fields if the specified 'withUserFields' is 'true'.
+{
+    ball::RecordAttributes fixedFields(timestamp,
+                                       1234,
+                                       5678,
+                                       "some/dir/file.cpp",
+                                       321,
+                                       "CATEGORY.NAME",
+                                       ball::Severity::e_ERROR,
+                                       message);
+    ball::UserFields userFields;
+    if (withUserFields) {
+        userFields.appendString("string");
+        userFields.appendInt64(-42);
+    }
+    return ball::Record(fixedFields, userFields);
+}
+
+struct FormatThreadArgs {
+    // This 'struct' holds the arguments of 'formatThread'.
+
+    const Obj          *d_formatter_p;  // shared formatter
+    int                 d_seed;         // distinguishes the threads
+    bsls::AtomicInt    *d_errors_p;     // number of mismatched records
+};
+
+extern "C" void *formatThread(void *arg)
+    // Format records having various timestamps using the formatter supplied
+    // in the specified 'arg', which refers to a 'FormatThreadArgs', and
+    // increment the error count it supplies for every record whose output
+    // differs from that of 'referenceFormat'.
+{
+    FormatThreadArgs *args = static_cast<FormatThreadArgs *>(arg);
+
+    for (int i = 0; i < 2000; ++i) {
+        bdlt::Datetime timestamp(2015, 6, 1, 12, 0, 0, 0);
+        timestamp.addMilliseconds((i * 7 + args->d_seed * 1013) % 5000);
+
+        const ball::Record record = makeRecord(timestamp, "msg", false);
+
+        bsl::ostringstream actual;
+        bsl::ostringstream expected;
+        (*args->d_formatter_p)(actual, record);
+        referenceFormat(expected,
+                        args->d_formatter_p->format(),
+                        args->d_formatter_p->timestampOffset(),
+                        record);
+        if (actual.str() != expected.str()) {
+            ++*args->d_errors_p;
+        }
+    }
+    return 0;
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -265,6 +551,136 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING COMPILED FORMAT SPECIFICATIONS
+        //   The format specification is translated into a sequence of
+        //   operations when it is supplied, and timestamp text is cached
+        //   between records.
+        //
+        // Concerns:
+        //: 1 The output of 'operator()' is byte-identical to that of
+        //:   interpreting the format specification character by character,
+        //:   for every conversion and escape sequence, and for incomplete and
+        //:   unknown sequences.
+        //:
+        //: 2 The compiled format follows the format specification through
+        //:   'setFormat', copy construction, and assignment.
+        //:
+        //: 3 The cached timestamp text is not reused for a record whose
+        //:   timestamp (after adjustment) lies in a different second, whether
+        //:   later or earlier, and the millisecond field is always that of
+        //:   the record.
+        //:
+        //: 4 A record formatter may be used concurrently by several threads.
+        //
+        // Plan:
+        //: 1 For a table of format specifications, timestamp offsets, and a
+        //:   sequence of records whose timestamps move forward and backward
+        //:   within and across seconds, compare the output of 'operator()'
+        //:   with that of a reference implementation of the interpreter.
+        //:   (C-1, 3)
+        //:
+        //: 2 Repeat P-1 with formatters obtained by 'setFormat', copy
+        //:   construction, and assignment.  (C-2)
+        //:
+        //: 3 Format records using one formatter from several threads, and
+        //:   compare every output with the reference implementation.  (C-4)
+        //
+        // Testing:
+        //   void operator()(bsl::ostream&, const ball::Record&) const;
+        //   void setFormat(const char *format);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COMPILED FORMAT SPECIFICATIONS" << endl
+                          << "======================================" << endl;
+
+        const bdlt::DatetimeInterval OFFSETS[] = {
+            bdlt::DatetimeInterval(0),
+            bdlt::DatetimeInterval(0, 1, 30),
+            bdlt::DatetimeInterval(0, 0, 0, 0, -1),
+            bdlt::DatetimeInterval(0, 0, 0, 0, INT_MAX),
+            bdlt::DatetimeInterval(0, 0, 0, 0, INT_MIN),
+        };
+        const int NUM_OFFSETS = static_cast<int>(sizeof OFFSETS /
+                                                 sizeof *OFFSETS);
+
+        const bdlt::Datetime BASE(2015, 12, 31, 23, 59, 58, 0);
+        const int            DELTAS[] = {
+            // milliseconds from 'BASE' of the successive records
+
+            0, 1, 999, 1000, 1001, 1999, 2000, 2500, 999, 998, 3600000,
+            -1, 0, 5, 7, 1000, 86399999, 0
+        };
+        const int NUM_DELTAS = static_cast<int>(sizeof DELTAS /
+                                                sizeof *DELTAS);
+
+        const char *const MESSAGES[] = { "", "message\x01\tend" };
+
+        for (int ti = 0; ti < NUM_COMPILE_FORMATS; ++ti) {
+            const char *FORMAT = COMPILE_FORMATS[ti];
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const bdlt::DatetimeInterval& OFFSET = OFFSETS[oi];
+
+                Obj        mX(FORMAT, OFFSET);  const Obj& X = mX;
+                Obj        mY("%m");            const Obj& Y = mY;
+                mY.setFormat(FORMAT);
+                mY.setTimestampOffset(OFFSET);
+                const Obj  Z(X);
+                Obj        mW;                  const Obj& W = mW;
+                mW = Y;
+
+                const Obj *const FORMATTERS[] = { &X, &Y, &Z, &W };
+
+                for (int di = 0; di < NUM_DELTAS; ++di) {
+                    bdlt::Datetime timestamp(BASE);
+                    timestamp.addMilliseconds(DELTAS[di]);
+
+                    const ball::Record record = makeRecord(timestamp,
+                                                           MESSAGES[di % 2],
+                                                           di % 3);
+
+                    bsl::ostringstream expected;
+                    referenceFormat(expected, FORMAT, OFFSET, record);
+
+                    for (int fi = 0; fi < 4; ++fi) {
+                        bsl::ostringstream actual;
+                        (*FORMATTERS[fi])(actual, record);
+
+                        if (veryVeryVerbose) { P_(ti) P_(oi) P_(di) P(fi) }
+                        ASSERTV(ti, oi, di, fi,
+                                compareText(actual.str(), expected.str()));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nConcurrent use of one formatter." << endl;
+        {
+            const int NUM_THREADS = 4;
+
+            Obj             mX("%d|%I|%i|%m\n");
+            bsls::AtomicInt errors(0);
+
+            FormatThreadArgs           args[NUM_THREADS];
+            bslmt::ThreadUtil::Handle  handles[NUM_THREADS];
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                args[i].d_formatter_p = &mX;
+                args[i].d_seed        = i;
+                args[i].d_errors_p    = &errors;
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          formatThread,
+                                                          &args[i]));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            ASSERTV(errors, 0 == errors);
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -1680,6 +2096,83 @@ int main(int argc, char *argv[])
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the time taken to format records using a compiled format
+        //   specification with the time taken by interpreting the format
+        //   specification for every record.
+        //
+        // Concerns:
+        //: 1 Formatting with a compiled format specification is faster than
+        //:   interpreting it.
+        //
+        // Plan:
+        //: 1 Format the same sequence of records, whose timestamps advance by
+        //:   a few microseconds per record (as at 500,000 records per
+        //:   second), using the default format specification, both with
+        //:   'operator()' and with the reference interpreter, and report the
+        //:   elapsed times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 500000;
+
+        const char *const FORMATS[] = {
+            "\n%d %p:%t %s %f:%l %c %m %u\n",
+            "%I %s %F:%l %m\n",
+        };
+        const int NUM_FORMATS = static_cast<int>(sizeof FORMATS /
+                                                 sizeof *FORMATS);
+
+        bsl::vector<ball::Record> records;
+        records.reserve(1000);
+        for (int i = 0; i < 1000; ++i) {
+            bdlt::Datetime timestamp(2015, 6, 1, 12, 0, 0, 0);
+            timestamp.addMilliseconds(i / 2);
+            records.push_back(makeRecord(timestamp,
+                                         "a typical log message of some size",
+                                         false));
+        }
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Obj X(FORMATS[fi]);
+
+            bsl::ostringstream stream;
+            bsls::Stopwatch    timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                stream.seekp(0);
+                X(stream, records[i % 1000]);
+            }
+            timer.stop();
+            const double compiledTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                stream.seekp(0);
+                referenceFormat(stream,
+                                X.format(),
+                                X.timestampOffset(),
+                                records[i % 1000]);
+            }
+            timer.stop();
+            const double interpretedTime = timer.elapsedTime();
+
+            cout << "format:      " << FORMATS[fi]
+                 << "records:     " << NUM_RECORDS << endl
+                 << "compiled:    " << compiledTime << "s" << endl
+                 << "interpreted: " << interpretedTime << "s" << endl;
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
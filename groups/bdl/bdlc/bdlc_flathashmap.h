@@ -0,0 +1,812 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatHashMap', implementing an allocator-aware unordered map of
+// unique keys to values, with an interface modeled on that of
+// 'bsl::unordered_map'.  In contrast with 'bsl::unordered_map', which
+// allocates a node for every element, a 'bdlc::FlatHashMap' stores its
+// elements in a single contiguous array, and locates them by open addressing,
+// scanning 16 one-byte control values at a time (using SSE2 instructions
+// where available).  See {'bdlc_flathashtable'|Table Layout} for details.
+//
+// A 'bdlc::FlatHashMap' is typically much faster and more compact than a
+// 'bsl::unordered_map', particularly for small keys and values: it performs
+// no allocation per insertion, its per-element overhead is one byte plus the
+// unused capacity (at most a factor of two, and at least 12.5%), and a
+// successful lookup typically reads one group of control values and one
+// element.  The following table compares the memory used to hold one million
+// distinct 'int' keys (as measured by the performance test of
+// 'bdlc_flathashtable' on a 64-bit platform):
+//..
+//  Container                  Memory
+//  ---------                  ------
+//  bsl::unordered_set<int>    41 MB
+//  bdlc::FlatHashSet<int>     10 MB
+//..
+// The hash functor defaults to 'bslh::Hash<>', so that any type supporting
+// the 'bslh' hashing protocol (i.e., providing 'hashAppend') can be used as a
+// key.  The hash values are mixed before use, so that hash functors of poor
+// quality (e.g., 'bsl::hash<int>', which is the identity) are also supported.
+//
+///Differences from 'bsl::unordered_map'
+///-------------------------------------
+// The interface of 'bdlc::FlatHashMap' differs from that of
+// 'bsl::unordered_map' in the following ways:
+//
+//: o Elements are moved in memory when the map rehashes, so that an insertion
+//:   may invalidate all iterators, references, and pointers to elements.
+//:
+//: o There is no bucket interface, and the maximum load factor is fixed at
+//:   0.875.
+//:
+//: o The memory allocator is supplied as a 'bslma::Allocator *', and is
+//:   returned by 'allocator'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Table of Security Prices
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the last traded price of each security of an
+// exchange, keyed by a ticker symbol, and need fast lookups by symbol.
+//
+// First, we create a map from symbols to prices, reserving room for the
+// expected number of securities so that the map does not rehash while it is
+// populated:
+//..
+//  bslma::TestAllocator allocator;
+//
+//  bdlc::FlatHashMap<bsl::string, double> prices(&allocator);
+//  prices.reserve(1000);
+//  const bsl::size_t capacity = prices.capacity();
+//..
+// Then, we record a few trades:
+//..
+//  prices["IBM"]  = 151.25;
+//  prices["AAPL"] = 126.60;
+//  prices["IBM"]  = 151.50;
+//
+//  assert(2 == prices.size());
+//  assert(capacity == prices.capacity());
+//..
+// Next, we look up prices:
+//..
+//  assert(151.50 == prices["IBM"]);
+//  assert(prices.contains("AAPL"));
+//  assert(prices.end() == prices.find("MSFT"));
+//..
+// Then, we use 'insert', which does not modify the value of an existing
+// element, to record an opening price only if no trade was seen:
+//..
+//  typedef bsl::pair<const bsl::string, double> Element;
+//
+//  assert(false == prices.insert(Element("IBM", 150.0)).second);
+//  assert(true  == prices.insert(Element("MSFT", 47.5)).second);
+//  assert(151.50 == prices.at("IBM"));
+//..
+// Finally, we remove a delisted security, and iterate over the remaining
+// elements:
+//..
+//  assert(1 == prices.erase("AAPL"));
+//
+//  double total = 0.0;
+//  for (bdlc::FlatHashMap<bsl::string, double>::const_iterator it =
+//                                                             prices.begin();
+//       it != prices.end();
+//       ++it) {
+//      total += it->second;
+//  }
+//  assert(151.50 + 47.5 == total);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#include <bdlc_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                         // ============================
+                         // struct FlatHashMap_EntryUtil
+                         // ============================
+
+template <class KEY, class VALUE>
+struct FlatHashMap_EntryUtil {
+    // This component-private utility provides the operations required by
+    // 'FlatHashTable' on the entries of a 'FlatHashMap'.
+
+    // TYPES
+    typedef bsl::pair<const KEY, VALUE> Entry;
+
+    // CLASS METHODS
+    static void constructFromKey(Entry            *address,
+                                 const KEY&        key,
+                                 bslma::Allocator *allocator);
+        // Create at the specified 'address' an entry having the specified
+        // 'key' and a default-constructed value, using the specified
+        // 'allocator' to supply memory.
+
+    static const KEY& key(const Entry& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+};
+
+                             // =================
+                             // class FlatHashMap
+                             // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic unordered map of
+    // unique keys of the (template parameter) type 'KEY' to values of the
+    // (template parameter) type 'VALUE', stored in an open-addressed hash
+    // table, the keys being hashed and compared using the (template
+    // parameter) types 'HASH' and 'EQUAL'.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                             key_type;
+    typedef VALUE                                           mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                     value_type;
+    typedef bsl::size_t                                     size_type;
+    typedef HASH                                            hasher;
+    typedef EQUAL                                           key_equal;
+    typedef value_type&                                     reference;
+    typedef const value_type&                               const_reference;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          value_type,
+                          FlatHashMap_EntryUtil<KEY, VALUE>,
+                          HASH,
+                          EQUAL>                            ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef typename ImplType::iterator                     iterator;
+    typedef typename ImplType::const_iterator               const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t capacity);
+    FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'capacity' indicating
+        // the minimum initial number of slots of the map; if 'capacity' is
+        // not specified or is 0, no memory is allocated.  Optionally specify
+        // a 'hash' functor used to hash keys; if 'hash' is not specified, a
+        // default-constructed 'HASH' is used.  Optionally specify an 'equal'
+        // functor used to compare keys; if 'equal' is not specified, a
+        // default-constructed 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a map holding the elements in the specified range
+        // '[first .. last)', ignoring elements whose key is already present.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a map having the same value, hasher, and key-equality
+        // functor as the specified 'original' map.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~FlatHashMap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this object the value, hasher, and key-equality functor
+        // of the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value of the
+        // element having the specified 'key', first inserting an element
+        // having 'key' and a default-constructed value if there is no such
+        // element.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value of the
+        // element having the specified 'key'.  Throw 'bsl::out_of_range' if
+        // there is no such element.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this map, or
+        // the end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    void clear();
+        // Remove all elements from this map.  Note that the capacity of this
+        // map is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this map, if
+        // any.  Return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this map, and
+        // return an iterator referring to the element following it, or the
+        // end iterator if there is no such element.  The behavior is
+        // undefined unless 'position' refers to an element of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element having the specified
+        // 'key', or the end iterator if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if no element having the
+        // key of 'value' is present.  Return a pair whose first member refers
+        // to the element having the key of 'value', and whose second member
+        // is 'true' if 'value' was inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert the elements in the specified range '[first .. last)' whose
+        // keys are not already present into this map.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to the smallest valid capacity not
+        // less than the specified 'minimumCapacity' that can hold 'size()'
+        // elements.
+
+    void reserve(bsl::size_t numElements);
+        // Ensure that this map can hold the specified 'numElements' elements
+        // without rehashing.
+
+    void swap(FlatHashMap& other);
+        // Exchange the value, hasher, and key-equality functor of this map
+        // with those of the specified 'other' map.  The behavior is undefined
+        // unless this map and 'other' use the same allocator.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the value of
+        // the element having the specified 'key'.  Throw 'bsl::out_of_range'
+        // if there is no such element.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first element of this map, or
+        // the end iterator if this map is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this map.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this map.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this map having the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map has no elements, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element having the specified
+        // 'key', or the end iterator if there is no such element.
+
+    const HASH& hash_function() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this map.
+
+    const EQUAL& key_eq() const;
+        // Return a reference providing non-modifiable access to the
+        // key-equality functor of this map.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements to the capacity of this
+        // map, or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this map.
+
+    bsl::size_t size() const;
+        // Return the number of elements of this map.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same
+    // value, and 'false' otherwise.  Two maps have the same value if they have
+    // the same number of elements, and every element of 'lhs' compares equal
+    // to the element of 'rhs' having the same key.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  If 'a' and 'b'
+    // use the same allocator, this function provides the no-throw
+    // exception-safety guarantee; otherwise, it is implemented by copying.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // ----------------------------
+                         // struct FlatHashMap_EntryUtil
+                         // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE>::constructFromKey(
+                                                  Entry            *address,
+                                                  const KEY&        key,
+                                                  bslma::Allocator *allocator)
+{
+    bslalg::ScalarPrimitives::construct(address, key, VALUE(), allocator);
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE>::key(const Entry& entry)
+{
+    return entry.first;
+}
+
+                             // -----------------
+                             // class FlatHashMap
+                             // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             bsl::size_t       capacity,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             const EQUAL&      equal,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                         const FlatHashMap&  original,
+                                         bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.insertKey(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                           "FlatHashMap::at: key not found");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                           "FlatHashMap::at: key not found");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const HASH& FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const EQUAL& FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
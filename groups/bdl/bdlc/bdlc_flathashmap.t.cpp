@@ -0,0 +1,732 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thin adapter of 'bdlc::FlatHashTable', which
+// is tested thoroughly in its own component.  We therefore test that every
+// method forwards correctly, that the entry utility constructs elements using
+// the allocator of the map, and that the map behaves as an oracle
+// ('bsl::map') over a sequence of random operations on allocating keys and
+// values.
+//-----------------------------------------------------------------------------
+// [ 2] FlatHashMap();
+// [ 2] FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 2] FlatHashMap(bsl::size_t capacity);
+// [ 2] FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+// [ 2] FlatHashMap(capacity, hash, basicAllocator = 0);
+// [ 2] FlatHashMap(capacity, hash, equal, basicAllocator = 0);
+// [ 2] FlatHashMap(INPUT_ITERATOR first, last, basicAllocator = 0);
+// [ 4] FlatHashMap(const FlatHashMap& original, basicAllocator = 0);
+// [ 4] FlatHashMap& operator=(const FlatHashMap& rhs);
+// [ 3] VALUE& operator[](const KEY& key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] void clear();
+// [ 3] bsl::size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator find(const KEY& key);
+// [ 3] bsl::pair<iterator, bool> insert(const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] void rehash(bsl::size_t minimumCapacity);
+// [ 2] void reserve(bsl::size_t numElements);
+// [ 4] void swap(FlatHashMap& other);
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 2] bsl::size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] const HASH& hash_function() const;
+// [ 2] const EQUAL& key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] bsl::size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 4] bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 4] bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 4] void swap(FlatHashMap& a, FlatHashMap& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+
+typedef bdlc::FlatHashMap<int, int>                 IntMap;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringMap;
+typedef bsl::map<bsl::string, bsl::string>          Oracle;
+
+struct ModHash {
+    // This 'struct' provides a hash functor of poor quality, mapping integers
+    // onto a small number of hash values.
+
+    bsl::size_t operator()(int value) const
+        // Return the specified 'value' modulo 4.
+    {
+        return static_cast<bsl::size_t>(value & 3);
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bsl::string makeKey(int value)
+    // Return a string, long enough to allocate memory, encoding the specified
+    // 'value'.
+{
+    bsl::ostringstream oss;
+    oss << "a key long enough to allocate memory #" << value;
+    return oss.str();
+}
+
+bool matches(const StringMap& map, const Oracle& oracle)
+    // Return 'true' if the specified 'map' holds exactly the elements of the
+    // specified 'oracle', and 'false' otherwise.
+{
+    if (map.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    bsl::size_t count = 0;
+    for (StringMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+        Oracle::const_iterator oit = oracle.find(it->first);
+        if (oit == oracle.end() || oit->second != it->second) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    return count == oracle.size();
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator allocator;
+
+        bdlc::FlatHashMap<bsl::string, double> prices(&allocator);
+        prices.reserve(1000);
+        const bsl::size_t capacity = prices.capacity();
+
+        prices["IBM"]  = 151.25;
+        prices["AAPL"] = 126.60;
+        prices["IBM"]  = 151.50;
+
+        ASSERT(2 == prices.size());
+        ASSERT(capacity == prices.capacity());
+
+        ASSERT(151.50 == prices["IBM"]);
+        ASSERT(prices.contains("AAPL"));
+        ASSERT(prices.end() == prices.find("MSFT"));
+
+        typedef bsl::pair<const bsl::string, double> Element;
+
+        ASSERT(false == prices.insert(Element("IBM", 150.0)).second);
+        ASSERT(true  == prices.insert(Element("MSFT", 47.5)).second);
+        ASSERT(151.50 == prices.at("IBM"));
+
+        ASSERT(1 == prices.erase("AAPL"));
+
+        double total = 0.0;
+        for (bdlc::FlatHashMap<bsl::string, double>::const_iterator it =
+                                                               prices.begin();
+             it != prices.end();
+             ++it) {
+            total += it->second;
+        }
+        ASSERT(151.50 + 47.5 == total);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, EQUALITY, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy has the value of the original and uses the allocator
+        //:   supplied at construction.
+        //:
+        //: 2 Assignment gives the target the value of the source, without
+        //:   changing the allocator of the target, and is exception-neutral.
+        //:
+        //: 3 Maps compare equal if and only if they hold the same elements,
+        //:   irrespective of capacity and insertion order.
+        //:
+        //: 4 The member 'swap' exchanges values without allocating, and the
+        //:   free 'swap' also supports maps using different allocators.
+        //
+        // Plan:
+        //: 1 Build maps of varied contents and capacities, and verify the
+        //:   properties of copies, assignments, and swaps, checking memory use
+        //:   with test allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap& original, basicAllocator = 0);
+        //   FlatHashMap& operator=(const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& other);
+        //   bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& a, FlatHashMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, EQUALITY, AND SWAP" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("a", veryVeryVerbose);
+        bslma::TestAllocator tb("b", veryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 2, 15, 16, 17, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int NI = SIZES[i];
+
+            StringMap mX(&ta);  const StringMap& X = mX;
+            for (int k = 0; k < NI; ++k) {
+                mX[makeKey(k)] = makeKey(-k);
+            }
+
+            // Insertion order and capacity do not affect equality.
+
+            StringMap mW(4 * NI + 64, &tb);  const StringMap& W = mW;
+            for (int k = NI - 1; k >= 0; --k) {
+                mW[makeKey(k)] = makeKey(-k);
+            }
+            ASSERTV(NI, X == W);
+            ASSERTV(NI, !(X != W));
+
+            {
+                StringMap mY(X, &tb);  const StringMap& Y = mY;
+                ASSERTV(NI, &tb == Y.allocator());
+                ASSERTV(NI, X == Y);
+                for (StringMap::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ASSERTV(NI, it->first.get_allocator().mechanism() == &tb);
+                    ASSERTV(NI, it->second.get_allocator().mechanism()
+                                                                      == &tb);
+                }
+            }
+
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                const int NJ = SIZES[j];
+
+                StringMap mY(&ta);  const StringMap& Y = mY;
+                for (int k = 0; k < NJ; ++k) {
+                    mY[makeKey(k + 1)] = makeKey(k);
+                }
+                ASSERTV(NI, NJ, (0 == NI && 0 == NJ) == (X == Y));
+
+                {
+                    StringMap mZ(Y, &tb);  const StringMap& Z = mZ;
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(tb) {
+                        mZ = X;
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                    ASSERTV(NI, NJ, X == Z);
+                    ASSERTV(NI, NJ, &tb == Z.allocator());
+                }
+
+                {
+                    StringMap mA(X, &ta);  const StringMap& A = mA;
+                    StringMap mB(Y, &ta);  const StringMap& B = mB;
+
+                    bsls::Types::Int64 numAllocations = ta.numAllocations();
+                    mA.swap(mB);
+                    ASSERTV(NI, NJ, numAllocations == ta.numAllocations());
+                    ASSERTV(NI, NJ, X == B);
+                    ASSERTV(NI, NJ, Y == A);
+
+                    bdlc::swap(mA, mB);
+                    ASSERTV(NI, NJ, numAllocations == ta.numAllocations());
+                    ASSERTV(NI, NJ, X == A);
+                    ASSERTV(NI, NJ, Y == B);
+                }
+
+                {
+                    StringMap mA(X, &ta);  const StringMap& A = mA;
+                    StringMap mB(Y, &tb);  const StringMap& B = mB;
+
+                    bdlc::swap(mA, mB);
+                    ASSERTV(NI, NJ, X == B);
+                    ASSERTV(NI, NJ, Y == A);
+                    ASSERTV(NI, NJ, &ta == A.allocator());
+                    ASSERTV(NI, NJ, &tb == B.allocator());
+                }
+            }
+
+            ASSERTV(NI, 0 == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS AND MODIFICATION
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts an element having a default-constructed
+        //:   value if and only if the key is absent, and returns a reference
+        //:   to the value of the element.
+        //:
+        //: 2 'insert' does not modify the value of an existing element.
+        //:
+        //: 3 'at' returns the value of an existing element, and throws
+        //:   'bsl::out_of_range' otherwise.
+        //:
+        //: 4 'find', 'contains', 'count', and both overloads of 'erase' are
+        //:   consistent with the elements inserted.
+        //:
+        //: 5 Elements are constructed using the allocator of the map, and no
+        //:   memory is leaked, even if an exception is thrown.
+        //
+        // Plan:
+        //: 1 Perform a sequence of random operations on a map and on an oracle
+        //:   'bsl::map', verifying that they agree after every operation.
+        //:   (C-1..5)
+        //:
+        //: 2 Exercise 'operator[]' and 'insert' under the exception-testing
+        //:   macros.  (C-5)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& at(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator find(const KEY& key);
+        //   bsl::pair<iterator, bool> insert(const value_type& value);
+        //   const VALUE& at(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool contains(const KEY& key) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ELEMENT ACCESS AND MODIFICATION" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tRandom operations against an oracle." << endl;
+        {
+            StringMap mX(&ta);  const StringMap& X = mX;
+            Oracle    oracle;
+
+            bsl::srand(1);
+            for (int i = 0; i < 4000; ++i) {
+                const int         k   = bsl::rand() % 200;
+                const bsl::string KEY = makeKey(k);
+                const bsl::string VALUE = makeKey(i);
+
+                switch (bsl::rand() % 6) {
+                  case 0: {
+                    const bool WAS = oracle.count(KEY) > 0;
+                    bsl::string& value = mX[KEY];
+                    ASSERTV(i, WAS || value.empty());
+                    ASSERTV(i, value.get_allocator().mechanism() == &ta);
+                    value = VALUE;
+                    oracle[KEY] = VALUE;
+                  } break;
+                  case 1: {
+                    bsl::pair<StringMap::iterator, bool> result =
+                                 mX.insert(StringMap::value_type(KEY, VALUE));
+                    const bool inserted =
+                        oracle.insert(Oracle::value_type(KEY, VALUE)).second;
+                    ASSERTV(i, inserted == result.second);
+                    ASSERTV(i, KEY == result.first->first);
+                    ASSERTV(i, oracle[KEY] == result.first->second);
+                    ASSERTV(i,
+                            result.first->first.get_allocator().mechanism()
+                                                                      == &ta);
+                  } break;
+                  case 2: {
+                    ASSERTV(i, oracle.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  case 3: {
+                    StringMap::iterator it = mX.find(KEY);
+                    if (it != mX.end()) {
+                        StringMap::iterator next = it;
+                        ++next;
+                        ASSERTV(i, next == mX.erase(it));
+                        oracle.erase(KEY);
+                    }
+                    ASSERTV(i, oracle.count(KEY) == X.count(KEY));
+                  } break;
+                  case 4: {
+                    const bool EXP = oracle.count(KEY) > 0;
+                    ASSERTV(i, EXP == X.contains(KEY));
+                    ASSERTV(i, EXP == (X.find(KEY) != X.end()));
+                    ASSERTV(i, EXP == (mX.find(KEY) != mX.end()));
+                    bool threw = false;
+                    try {
+                        ASSERTV(i, oracle[KEY] == X.at(KEY));
+                        mX.at(KEY) = VALUE;
+                        oracle[KEY] = VALUE;
+                    }
+                    catch (const bsl::out_of_range&) {
+                        threw = true;
+                        oracle.erase(KEY);
+                    }
+                    ASSERTV(i, EXP == !threw);
+                  } break;
+                  default: {
+                    if (0 == bsl::rand() % 100) {
+                        const bsl::size_t CAPACITY = X.capacity();
+                        mX.clear();
+                        oracle.clear();
+                        ASSERTV(i, CAPACITY == X.capacity());
+                    }
+                  } break;
+                }
+                ASSERTV(i, matches(X, oracle));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tException neutrality." << endl;
+        {
+            StringMap mX(&ta);  const StringMap& X = mX;
+
+            for (int k = 0; k < 40; ++k) {
+                const bsl::string KEY = makeKey(k);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    if (k % 2) {
+                        mX[KEY] = KEY;
+                    }
+                    else {
+                        mX.insert(StringMap::value_type(KEY, KEY));
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(k, static_cast<bsl::size_t>(k + 1) == X.size());
+                ASSERTV(k, KEY == X.at(KEY));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Every constructor creates an empty map (or, for the range
+        //:   constructor, a map of the distinct keys of the range) using the
+        //:   intended allocator, hasher, and key-equality functor.
+        //:
+        //: 2 No memory is allocated unless a non-zero capacity is requested.
+        //:
+        //: 3 'reserve' and 'rehash' forward to the table, and the capacity
+        //:   accessors report the state of the table.
+        //
+        // Plan:
+        //: 1 Construct maps using every constructor, and verify their state.
+        //:   (C-1..2)
+        //:
+        //: 2 Reserve and rehash maps, verifying their capacity.  (C-3)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   FlatHashMap(bslma::Allocator *basicAllocator);
+        //   FlatHashMap(bsl::size_t capacity);
+        //   FlatHashMap(bsl::size_t capacity, bslma::Allocator *ba);
+        //   FlatHashMap(capacity, hash, basicAllocator = 0);
+        //   FlatHashMap(capacity, hash, equal, basicAllocator = 0);
+        //   FlatHashMap(INPUT_ITERATOR first, last, basicAllocator = 0);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(bsl::size_t minimumCapacity);
+        //   void reserve(bsl::size_t numElements);
+        //   bsl::size_t capacity() const;
+        //   bool empty() const;
+        //   const HASH& hash_function() const;
+        //   const EQUAL& key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   bsl::size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND CAPACITY" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            IntMap mX;  const IntMap& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.0f == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+        {
+            IntMap mX(&ta);  const IntMap& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+        {
+            IntMap mX(20);  const IntMap& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(32 == X.capacity());
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            IntMap mX(20, &ta);  const IntMap& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(32 == X.capacity());
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            typedef bdlc::FlatHashMap<int, int, ModHash> ModMap;
+
+            ModMap mX(0, ModHash(), &ta);  const ModMap& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(1 == X.hash_function()(5));
+
+            ModMap mY(16, ModHash(), bsl::equal_to<int>(), &ta);
+            const ModMap& Y = mY;
+            ASSERT(16 == Y.capacity());
+            ASSERT(Y.key_eq()(3, 3));
+
+            for (int i = 0; i < 200; ++i) {
+                mX[i] = i * i;
+                mY[i] = i * i;
+            }
+            ASSERT(200 == X.size());
+            ASSERT(X == Y);
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, i * i == X.at(i));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            bsl::vector<IntMap::value_type> values;
+            for (int i = 0; i < 50; ++i) {
+                values.push_back(IntMap::value_type(i % 30, i));
+            }
+
+            IntMap mX(values.begin(), values.end(), &ta);
+            const IntMap& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(30 == X.size());
+            for (int i = 0; i < 30; ++i) {
+                ASSERTV(i, i == X.at(i));  // first occurrence is kept
+            }
+
+            IntMap mY(&ta);  const IntMap& Y = mY;
+            mY.insert(values.begin(), values.end());
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            IntMap mX(&ta);  const IntMap& X = mX;
+
+            mX.reserve(100);
+            const bsl::size_t CAPACITY = X.capacity();
+            ASSERT(128 == CAPACITY);
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(100.0f / 128 == X.load_factor());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+            ASSERT(100 == X.size());
+
+            for (int i = 0; i < 90; ++i) {
+                mX.erase(i);
+            }
+            mX.rehash(0);
+            ASSERT(16 == X.capacity());
+            for (int i = 90; i < 100; ++i) {
+                ASSERTV(i, i == X.at(i));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            StringMap mX(&ta);  const StringMap& X = mX;
+            ASSERT(X.empty());
+
+            mX["one"] = "1";
+            mX["two"] = "2";
+            mX[makeKey(3)] = makeKey(3);
+            ASSERT(3 == X.size());
+            ASSERT("1" == X.at("one"));
+            ASSERT(makeKey(3) == X.at(makeKey(3)));
+            ASSERT(X.contains("two"));
+            ASSERT(!X.contains("four"));
+            ASSERT(1 == mX.erase("two"));
+            ASSERT(2 == X.size());
+            ASSERT(0 == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
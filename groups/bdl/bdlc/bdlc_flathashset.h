@@ -0,0 +1,684 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered set container.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressed unordered set container
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashmap
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatHashSet', implementing an allocator-aware unordered set of
+// unique keys, with an interface modeled on that of 'bsl::unordered_set'.  In
+// contrast with 'bsl::unordered_set', which allocates a node for every
+// element, a 'bdlc::FlatHashSet' stores its elements in a single contiguous
+// array, and locates them by open addressing, scanning 16 one-byte control
+// values at a time (using SSE2 instructions where available).  See
+// {'bdlc_flathashtable'|Table Layout} for details, and {'bdlc_flathashmap'}
+// for a comparison of the performance of the two kinds of containers.
+//
+// The hash functor defaults to 'bslh::Hash<>', so that any type supporting
+// the 'bslh' hashing protocol (i.e., providing 'hashAppend') can be used as a
+// key.
+//
+///Differences from 'bsl::unordered_set'
+///-------------------------------------
+// The interface of 'bdlc::FlatHashSet' differs from that of
+// 'bsl::unordered_set' in the following ways:
+//
+//: o Elements are moved in memory when the set rehashes, so that an insertion
+//:   may invalidate all iterators, references, and pointers to elements.
+//:
+//: o There is no bucket interface, and the maximum load factor is fixed at
+//:   0.875.
+//:
+//: o The memory allocator is supplied as a 'bslma::Allocator *', and is
+//:   returned by 'allocator'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicate Identifiers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a stream of message identifiers, some of which are
+// duplicated, and need to process every message only once.
+//
+// First, we create a set of the identifiers seen so far:
+//..
+//  bslma::TestAllocator allocator;
+//
+//  bdlc::FlatHashSet<int> seen(&allocator);
+//..
+// Then, we process a sequence of identifiers, skipping those already present
+// in the set:
+//..
+//  const int IDS[]   = { 7, 3, 7, 12, 3, 3, 42, 7 };
+//  const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+//
+//  int numProcessed = 0;
+//  for (int i = 0; i < NUM_IDS; ++i) {
+//      if (seen.insert(IDS[i]).second) {
+//          ++numProcessed;  // process the message here
+//      }
+//  }
+//
+//  assert(4 == numProcessed);
+//  assert(4 == seen.size());
+//..
+// Finally, we query and modify the set:
+//..
+//  assert( seen.contains(42));
+//  assert(!seen.contains(5));
+//
+//  assert(1 == seen.erase(3));
+//  assert(0 == seen.erase(3));
+//  assert(3 == seen.size());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#include <bdlc_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                         // ============================
+                         // struct FlatHashSet_EntryUtil
+                         // ============================
+
+template <class KEY>
+struct FlatHashSet_EntryUtil {
+    // This component-private utility provides the operations required by
+    // 'FlatHashTable' on the entries of a 'FlatHashSet'.
+
+    // CLASS METHODS
+    static void constructFromKey(KEY              *address,
+                                 const KEY&        key,
+                                 bslma::Allocator *allocator);
+        // Create at the specified 'address' a copy of the specified 'key',
+        // using the specified 'allocator' to supply memory.
+
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+                             // =================
+                             // class FlatHashSet
+                             // =================
+
+template <class KEY,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This class template implements a value-semantic unordered set of
+    // unique keys of the (template parameter) type 'KEY', stored in an
+    // open-addressed hash table, the keys being hashed and compared using the
+    // (template parameter) types 'HASH' and 'EQUAL'.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                             key_type;
+    typedef KEY                                             value_type;
+    typedef bsl::size_t                                     size_type;
+    typedef HASH                                            hasher;
+    typedef EQUAL                                           key_equal;
+    typedef const KEY&                                      reference;
+    typedef const KEY&                                      const_reference;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          KEY,
+                          FlatHashSet_EntryUtil<KEY>,
+                          HASH,
+                          EQUAL>                            ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef typename ImplType::const_iterator               iterator;
+    typedef typename ImplType::const_iterator               const_iterator;
+        // The elements of a set are not modifiable, so that 'iterator' and
+        // 'const_iterator' are the same type.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashSet();
+    explicit FlatHashSet(bslma::Allocator *basicAllocator);
+    explicit FlatHashSet(bsl::size_t capacity);
+    FlatHashSet(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'capacity' indicating
+        // the minimum initial number of slots of the set; if 'capacity' is
+        // not specified or is 0, no memory is allocated.  Optionally specify
+        // a 'hash' functor used to hash keys; if 'hash' is not specified, a
+        // default-constructed 'HASH' is used.  Optionally specify an 'equal'
+        // functor used to compare keys; if 'equal' is not specified, a
+        // default-constructed 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a set holding the distinct keys in the specified range
+        // '[first .. last)'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a set having the same value, hasher, and key-equality
+        // functor as the specified 'original' set.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~FlatHashSet() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashSet& operator=(const FlatHashSet& rhs);
+        // Assign to this object the value, hasher, and key-equality functor
+        // of the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    void clear();
+        // Remove all elements from this set.  Note that the capacity of this
+        // set is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the specified 'key' from this set, if present.  Return the
+        // number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this set, and
+        // return an iterator referring to the element following it, or the
+        // end iterator if there is no such element.  The behavior is
+        // undefined unless 'position' refers to an element of this set.
+
+    bsl::pair<iterator, bool> insert(const KEY& key);
+        // Insert the specified 'key' into this set if it is not already
+        // present.  Return a pair whose first member refers to the element
+        // equal to 'key', and whose second member is 'true' if 'key' was
+        // inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert the keys in the specified range '[first .. last)' that are
+        // not already present into this set.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this set to the smallest valid capacity not
+        // less than the specified 'minimumCapacity' that can hold 'size()'
+        // elements.
+
+    void reserve(bsl::size_t numElements);
+        // Ensure that this set can hold the specified 'numElements' elements
+        // without rehashing.
+
+    void swap(FlatHashSet& other);
+        // Exchange the value, hasher, and key-equality functor of this set
+        // with those of the specified 'other' set.  The behavior is undefined
+        // unless this set and 'other' use the same allocator.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator referring to the first element of this set, or
+        // the end iterator if this set is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this set.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this set.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains the specified 'key', and 'false'
+        // otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this set equal to the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element equal to the specified
+        // 'key', or the end iterator if there is no such element.
+
+    const HASH& hash_function() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this set.
+
+    const EQUAL& key_eq() const;
+        // Return a reference providing non-modifiable access to the
+        // key-equality functor of this set.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements to the capacity of this
+        // set, or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this set.
+
+    bsl::size_t size() const;
+        // Return the number of elements of this set.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same
+    // value, and 'false' otherwise.  Two sets have the same value if they have
+    // the same number of elements, and every element of 'lhs' is contained in
+    // 'rhs'.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  If 'a' and 'b'
+    // use the same allocator, this function provides the no-throw
+    // exception-safety guarantee; otherwise, it is implemented by copying.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // ----------------------------
+                         // struct FlatHashSet_EntryUtil
+                         // ----------------------------
+
+// CLASS METHODS
+template <class KEY>
+inline
+void FlatHashSet_EntryUtil<KEY>::constructFromKey(
+                                                  KEY              *address,
+                                                  const KEY&        key,
+                                                  bslma::Allocator *allocator)
+{
+    bslalg::ScalarPrimitives::copyConstruct(address, key, allocator);
+}
+
+template <class KEY>
+inline
+const KEY& FlatHashSet_EntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+                             // -----------------
+                             // class FlatHashSet
+                             // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                         const FlatHashSet&  original,
+                                         bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(const FlatHashSet& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result =
+                                                        d_impl.insertKey(key);
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insertKey(*first);
+    }
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+const HASH& FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+const EQUAL& FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashSet<KEY, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashSet<KEY, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
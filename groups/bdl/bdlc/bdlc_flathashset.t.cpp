@@ -0,0 +1,661 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thin adapter of 'bdlc::FlatHashTable', which
+// is tested thoroughly in its own component.  We therefore test that every
+// method forwards correctly, that the entry utility constructs elements using
+// the allocator of the set, and that the set behaves as an oracle
+// ('bsl::set') over a sequence of random operations on allocating keys.
+//-----------------------------------------------------------------------------
+// [ 2] FlatHashSet();
+// [ 2] FlatHashSet(bslma::Allocator *basicAllocator);
+// [ 2] FlatHashSet(bsl::size_t capacity);
+// [ 2] FlatHashSet(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+// [ 2] FlatHashSet(capacity, hash, basicAllocator = 0);
+// [ 2] FlatHashSet(capacity, hash, equal, basicAllocator = 0);
+// [ 2] FlatHashSet(INPUT_ITERATOR first, last, basicAllocator = 0);
+// [ 4] FlatHashSet(const FlatHashSet& original, basicAllocator = 0);
+// [ 4] FlatHashSet& operator=(const FlatHashSet& rhs);
+// [ 3] void clear();
+// [ 3] bsl::size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] bsl::pair<iterator, bool> insert(const KEY& key);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] void rehash(bsl::size_t minimumCapacity);
+// [ 2] void reserve(bsl::size_t numElements);
+// [ 4] void swap(FlatHashSet& other);
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 2] bsl::size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] const HASH& hash_function() const;
+// [ 2] const EQUAL& key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] bsl::size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 4] bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 4] bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 4] void swap(FlatHashSet& a, FlatHashSet& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashSet<int>         IntSet;
+typedef bdlc::FlatHashSet<bsl::string> StringSet;
+typedef bsl::set<bsl::string>          Oracle;
+
+struct ModHash {
+    // This 'struct' provides a hash functor of poor quality, mapping integers
+    // onto a small number of hash values.
+
+    bsl::size_t operator()(int value) const
+        // Return the specified 'value' modulo 4.
+    {
+        return static_cast<bsl::size_t>(value & 3);
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bsl::string makeKey(int value)
+    // Return a string, long enough to allocate memory, encoding the specified
+    // 'value'.
+{
+    bsl::ostringstream oss;
+    oss << "a key long enough to allocate memory #" << value;
+    return oss.str();
+}
+
+bool matches(const StringSet& set, const Oracle& oracle)
+    // Return 'true' if the specified 'set' holds exactly the elements of the
+    // specified 'oracle', and 'false' otherwise.
+{
+    if (set.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    bsl::size_t count = 0;
+    for (StringSet::const_iterator it = set.begin(); it != set.end(); ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    return count == oracle.size();
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator allocator;
+
+        bdlc::FlatHashSet<int> seen(&allocator);
+
+        const int IDS[]   = { 7, 3, 7, 12, 3, 3, 42, 7 };
+        const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+
+        int numProcessed = 0;
+        for (int i = 0; i < NUM_IDS; ++i) {
+            if (seen.insert(IDS[i]).second) {
+                ++numProcessed;  // process the message here
+            }
+        }
+
+        ASSERT(4 == numProcessed);
+        ASSERT(4 == seen.size());
+
+        ASSERT( seen.contains(42));
+        ASSERT(!seen.contains(5));
+
+        ASSERT(1 == seen.erase(3));
+        ASSERT(0 == seen.erase(3));
+        ASSERT(3 == seen.size());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, EQUALITY, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy has the value of the original and uses the allocator
+        //:   supplied at construction.
+        //:
+        //: 2 Assignment gives the target the value of the source, without
+        //:   changing the allocator of the target, and is exception-neutral.
+        //:
+        //: 3 Sets compare equal if and only if they hold the same elements,
+        //:   irrespective of capacity and insertion order.
+        //:
+        //: 4 The member 'swap' exchanges values without allocating, and the
+        //:   free 'swap' also supports sets using different allocators.
+        //
+        // Plan:
+        //: 1 Build sets of varied contents and capacities, and verify the
+        //:   properties of copies, assignments, and swaps, checking memory use
+        //:   with test allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet& original, basicAllocator = 0);
+        //   FlatHashSet& operator=(const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& other);
+        //   bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& a, FlatHashSet& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, EQUALITY, AND SWAP" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("a", veryVeryVerbose);
+        bslma::TestAllocator tb("b", veryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 2, 15, 16, 17, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int NI = SIZES[i];
+
+            StringSet mX(&ta);  const StringSet& X = mX;
+            for (int k = 0; k < NI; ++k) {
+                mX.insert(makeKey(k));
+            }
+
+            // Insertion order and capacity do not affect equality.
+
+            StringSet mW(4 * NI + 64, &tb);  const StringSet& W = mW;
+            for (int k = NI - 1; k >= 0; --k) {
+                mW.insert(makeKey(k));
+            }
+            ASSERTV(NI, X == W);
+            ASSERTV(NI, !(X != W));
+
+            {
+                StringSet mY(X, &tb);  const StringSet& Y = mY;
+                ASSERTV(NI, &tb == Y.allocator());
+                ASSERTV(NI, X == Y);
+                for (StringSet::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ASSERTV(NI, it->get_allocator().mechanism() == &tb);
+                }
+            }
+
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                const int NJ = SIZES[j];
+
+                StringSet mY(&ta);  const StringSet& Y = mY;
+                for (int k = 0; k < NJ; ++k) {
+                    mY.insert(makeKey(k + 1));
+                }
+                ASSERTV(NI, NJ, (0 == NI && 0 == NJ) == (X == Y));
+
+                {
+                    StringSet mZ(Y, &tb);  const StringSet& Z = mZ;
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(tb) {
+                        mZ = X;
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                    ASSERTV(NI, NJ, X == Z);
+                    ASSERTV(NI, NJ, &tb == Z.allocator());
+                }
+
+                {
+                    StringSet mA(X, &ta);  const StringSet& A = mA;
+                    StringSet mB(Y, &ta);  const StringSet& B = mB;
+
+                    bsls::Types::Int64 numAllocations = ta.numAllocations();
+                    mA.swap(mB);
+                    ASSERTV(NI, NJ, numAllocations == ta.numAllocations());
+                    ASSERTV(NI, NJ, X == B);
+                    ASSERTV(NI, NJ, Y == A);
+
+                    bdlc::swap(mA, mB);
+                    ASSERTV(NI, NJ, numAllocations == ta.numAllocations());
+                    ASSERTV(NI, NJ, X == A);
+                    ASSERTV(NI, NJ, Y == B);
+                }
+
+                {
+                    StringSet mA(X, &ta);  const StringSet& A = mA;
+                    StringSet mB(Y, &tb);  const StringSet& B = mB;
+
+                    bdlc::swap(mA, mB);
+                    ASSERTV(NI, NJ, X == B);
+                    ASSERTV(NI, NJ, Y == A);
+                    ASSERTV(NI, NJ, &ta == A.allocator());
+                    ASSERTV(NI, NJ, &tb == B.allocator());
+                }
+            }
+
+            ASSERTV(NI, 0 == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS AND MODIFICATION
+        //
+        // Concerns:
+        //: 1 'insert' adds a key if and only if it is absent, and returns an
+        //:   iterator to the element equal to the key.
+        //:
+        //: 2 'find', 'contains', 'count', and both overloads of 'erase' are
+        //:   consistent with the keys inserted.
+        //:
+        //: 3 Elements are constructed using the allocator of the set, and no
+        //:   memory is leaked, even if an exception is thrown.
+        //
+        // Plan:
+        //: 1 Perform a sequence of random operations on a set and on an oracle
+        //:   'bsl::set', verifying that they agree after every operation.
+        //:   (C-1..3)
+        //:
+        //: 2 Exercise 'insert' under the exception-testing macros.  (C-3)
+        //
+        // Testing:
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   bsl::pair<iterator, bool> insert(const KEY& key);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool contains(const KEY& key) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ELEMENT ACCESS AND MODIFICATION" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tRandom operations against an oracle." << endl;
+        {
+            StringSet mX(&ta);  const StringSet& X = mX;
+            Oracle    oracle;
+
+            bsl::srand(1);
+            for (int i = 0; i < 4000; ++i) {
+                const bsl::string KEY = makeKey(bsl::rand() % 200);
+
+                switch (bsl::rand() % 5) {
+                  case 0:
+                  case 1: {
+                    bsl::pair<StringSet::iterator, bool> result =
+                                                               mX.insert(KEY);
+                    ASSERTV(i, oracle.insert(KEY).second == result.second);
+                    ASSERTV(i, KEY == *result.first);
+                    ASSERTV(i, result.first->get_allocator().mechanism()
+                                                                      == &ta);
+                  } break;
+                  case 2: {
+                    ASSERTV(i, oracle.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  case 3: {
+                    StringSet::iterator it = X.find(KEY);
+                    if (it != X.end()) {
+                        StringSet::iterator next = it;
+                        ++next;
+                        ASSERTV(i, next == mX.erase(it));
+                        oracle.erase(KEY);
+                    }
+                    ASSERTV(i, oracle.count(KEY) == X.count(KEY));
+                  } break;
+                  default: {
+                    const bool EXP = oracle.count(KEY) > 0;
+                    ASSERTV(i, EXP == X.contains(KEY));
+                    ASSERTV(i, EXP == (X.find(KEY) != X.end()));
+
+                    if (0 == bsl::rand() % 100) {
+                        const bsl::size_t CAPACITY = X.capacity();
+                        mX.clear();
+                        oracle.clear();
+                        ASSERTV(i, CAPACITY == X.capacity());
+                    }
+                  } break;
+                }
+                ASSERTV(i, matches(X, oracle));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tException neutrality." << endl;
+        {
+            StringSet mX(&ta);  const StringSet& X = mX;
+
+            for (int k = 0; k < 40; ++k) {
+                const bsl::string KEY = makeKey(k);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    mX.insert(KEY);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(k, static_cast<bsl::size_t>(k + 1) == X.size());
+                ASSERTV(k, X.contains(KEY));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Every constructor creates an empty set (or, for the range
+        //:   constructor, a set of the distinct keys of the range) using the
+        //:   intended allocator, hasher, and key-equality functor.
+        //:
+        //: 2 No memory is allocated unless a non-zero capacity is requested.
+        //:
+        //: 3 'reserve' and 'rehash' forward to the table, and the capacity
+        //:   accessors report the state of the table.
+        //
+        // Plan:
+        //: 1 Construct sets using every constructor, and verify their state.
+        //:   (C-1..2)
+        //:
+        //: 2 Reserve and rehash sets, verifying their capacity.  (C-3)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   FlatHashSet(bslma::Allocator *basicAllocator);
+        //   FlatHashSet(bsl::size_t capacity);
+        //   FlatHashSet(bsl::size_t capacity, bslma::Allocator *ba);
+        //   FlatHashSet(capacity, hash, basicAllocator = 0);
+        //   FlatHashSet(capacity, hash, equal, basicAllocator = 0);
+        //   FlatHashSet(INPUT_ITERATOR first, last, basicAllocator = 0);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(bsl::size_t minimumCapacity);
+        //   void reserve(bsl::size_t numElements);
+        //   bsl::size_t capacity() const;
+        //   bool empty() const;
+        //   const HASH& hash_function() const;
+        //   const EQUAL& key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   bsl::size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND CAPACITY" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            IntSet mX;  const IntSet& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.0f == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+        {
+            IntSet mX(&ta);  const IntSet& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+        {
+            IntSet mX(20);  const IntSet& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(32 == X.capacity());
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            IntSet mX(20, &ta);  const IntSet& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(32 == X.capacity());
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            typedef bdlc::FlatHashSet<int, ModHash> ModSet;
+
+            ModSet mX(0, ModHash(), &ta);  const ModSet& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(1 == X.hash_function()(5));
+
+            ModSet mY(16, ModHash(), bsl::equal_to<int>(), &ta);
+            const ModSet& Y = mY;
+            ASSERT(16 == Y.capacity());
+            ASSERT(Y.key_eq()(3, 3));
+
+            for (int i = 0; i < 200; ++i) {
+                mX.insert(i);
+                mY.insert(199 - i);
+            }
+            ASSERT(200 == X.size());
+            ASSERT(X == Y);
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            bsl::vector<int> values;
+            for (int i = 0; i < 50; ++i) {
+                values.push_back(i % 30);
+            }
+
+            IntSet mX(values.begin(), values.end(), &ta);
+            const IntSet& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(30 == X.size());
+
+            IntSet mY(&ta);  const IntSet& Y = mY;
+            mY.insert(values.begin(), values.end());
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            IntSet mX(&ta);  const IntSet& X = mX;
+
+            mX.reserve(100);
+            const bsl::size_t CAPACITY = X.capacity();
+            ASSERT(128 == CAPACITY);
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(100.0f / 128 == X.load_factor());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+            ASSERT(100 == X.size());
+
+            for (int i = 0; i < 90; ++i) {
+                mX.erase(i);
+            }
+            mX.rehash(0);
+            ASSERT(16 == X.capacity());
+            for (int i = 90; i < 100; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            StringSet mX(&ta);  const StringSet& X = mX;
+            ASSERT(X.empty());
+
+            ASSERT( mX.insert("one").second);
+            ASSERT( mX.insert(makeKey(2)).second);
+            ASSERT(!mX.insert("one").second);
+            ASSERT(2 == X.size());
+            ASSERT(X.contains(makeKey(2)));
+            ASSERT(!X.contains("three"));
+            ASSERT(1 == mX.erase("one"));
+            ASSERT(1 == X.size());
+            ASSERT(0 == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,35 @@
+// bdlc_flathashtable.cpp                                             -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlc_flathashtable_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// The high-order bit of a control value distinguishes available slots from
+// slots in use, which 'FlatHashTable_GroupControl::available' relies upon.
+
+BSLMF_ASSERT(0 != (FlatHashTable_GroupControl::k_EMPTY  & 0x80));
+BSLMF_ASSERT(0 != (FlatHashTable_GroupControl::k_ERASED & 0x80));
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
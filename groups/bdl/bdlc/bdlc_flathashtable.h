@@ -0,0 +1,1414 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table with SIMD-scanned metadata.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table of contiguous entries
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatHashTable', implementing an open-addressed hash table that
+// stores its entries in a single contiguous array, and that is the common
+// implementation of 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet'.  This
+// component is not intended to be used directly by clients; the interfaces of
+// 'bdlc_flathashmap' and 'bdlc_flathashset' should be preferred.
+//
+// A 'bdlc::FlatHashTable' is parameterized by the type of the keys ('KEY'),
+// the type of the entries ('ENTRY'), a utility ('ENTRY_UTIL') providing the
+// key of an entry and constructing an entry from a key, a hash functor
+// ('HASH'), and an equality functor ('EQUAL').  The 'ENTRY_UTIL' type must
+// provide the following two class methods:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return a reference providing non-modifiable access to the key of
+//      // the specified 'entry'.
+//
+//  static void constructFromKey(ENTRY            *address,
+//                               const KEY&        key,
+//                               bslma::Allocator *allocator);
+//      // Create at the specified 'address' an entry having the specified
+//      // 'key' (and a default value, if any), using the specified
+//      // 'allocator' to supply memory.
+//..
+//
+///Table Layout
+///------------
+// In contrast with 'bslstl::HashTable', which allocates a node for every
+// element and chains the nodes of a bucket through a linked list, a
+// 'bdlc::FlatHashTable' stores its entries in an array of slots, and
+// resolves collisions by probing other slots of the same array.  The slots
+// are partitioned into groups of 16, and every slot is associated with a
+// one-byte *control* value that indicates whether the slot is empty, holds an
+// erased entry, or is in use, in which case the control value also holds 7
+// bits of the hash value of the key of the entry of the slot.
+//
+// A lookup hashes the key once, selects a group from the hash value, and
+// compares the 7 bits of the hash value with the 16 control values of the
+// group at once, using SSE2 instructions where available (and a portable
+// loop elsewhere).  The key equality functor is invoked only on the slots
+// whose control value matches, which is, with high probability, only the
+// slot holding the sought key.  If the group contains no matching entry and
+// at least one empty slot, the lookup ends; otherwise the next group of a
+// (triangular) probe sequence is examined.
+//
+// The table maintains a maximum load factor of 0.875, counting slots of
+// erased entries as used, and doubles its capacity (or, if enough slots are
+// occupied by erased entries, reclaims them at the same capacity) when an
+// insertion would exceed it.  The capacity of a table is always either 0 or a
+// power of two not less than 16.  A default-constructed table allocates no
+// memory.
+//
+// Compared with 'bsl::unordered_map', a table holding small entries uses
+// about half as much memory (no node, no bucket array, one control byte per
+// slot) and performs no allocation per insertion, and a lookup typically
+// touches one cache line of control values and one entry.
+//
+///Iterator, Reference, and Pointer Invalidation
+///---------------------------------------------
+// Any insertion that causes the table to rehash invalidates all iterators,
+// references, and pointers to its entries.  Erasing an entry invalidates only
+// iterators, references, and pointers to that entry.
+//
+///Exception Safety
+///----------------
+// Insertion and rehashing provide the strong exception-safety guarantee:
+// if an exception is thrown (by the allocator, the hash functor, or the
+// copy constructor of an entry), the table is left unchanged.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flathashmap' and
+// 'bdlc_flathashset'; see the usage examples in those components.  The
+// following example shows how 'bdlc::FlatHashTable' is configured by such a
+// container.
+//
+///Example 1: Implementing a Set of Integers
+///- - - - - - - - - - - - - - - - - - - - -
+// First, we define the utility that extracts the key from an entry, which, in
+// the case of a set, is the entry itself:
+//..
+//  struct IntEntryUtil {
+//      static const int& key(const int& entry)
+//      {
+//          return entry;
+//      }
+//
+//      static void constructFromKey(int              *address,
+//                                   const int&        key,
+//                                   bslma::Allocator *)
+//      {
+//          *address = key;
+//      }
+//  };
+//..
+// Then, we create a table of integers:
+//..
+//  typedef bdlc::FlatHashTable<int,
+//                              int,
+//                              IntEntryUtil,
+//                              bslh::Hash<>,
+//                              bsl::equal_to<int> > Table;
+//
+//  Table table(0, bslh::Hash<>(), bsl::equal_to<int>());
+//  assert(0 == table.capacity());
+//..
+// Next, we insert a few values:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      assert(true == table.insert(i * i).second);
+//  }
+//  assert(false == table.insert(25).second);
+//  assert(100   == table.size());
+//  assert(128   == table.capacity());
+//..
+// Finally, we look up and erase values:
+//..
+//  assert(table.end() != table.find(49));
+//  assert(table.end() == table.find(50));
+//
+//  assert(1  == table.erase(49));
+//  assert(0  == table.erase(49));
+//  assert(99 == table.size());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECV
+#include <bslmf_removecv.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_ITERATOR
+#include <bsl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BDLC_FLATHASHTABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ================================
+                     // class FlatHashTable_GroupControl
+                     // ================================
+
+class FlatHashTable_GroupControl {
+    // This component-private class provides access to the control values of
+    // a group of 'k_SIZE' consecutive slots of a 'FlatHashTable', and
+    // computes, for every predicate it supports, a bit mask in which bit 'i'
+    // is set if and only if the control value of slot 'i' of the group
+    // satisfies the predicate.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SIZE   = 16,    // number of slots in a group
+
+        k_EMPTY  = 0x80,  // control value of a slot that has never been
+                          // used since the last rehash
+
+        k_ERASED = 0xFE   // control value of a slot whose entry was erased
+    };
+        // Note that the control value of a slot in use is the (non-negative)
+        // 7-bit hash value of its entry, so that the high-order bit of a
+        // control value is set if and only if its slot is available.
+
+  private:
+    // DATA
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+    __m128i             d_value;           // control values of the group
+#else
+    const bsl::uint8_t *d_controls_p;      // control values of the group
+#endif
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+        // Create an object providing access to the group of 'k_SIZE' control
+        // values starting at the specified 'controls' address.  The behavior
+        // is undefined unless 'controls' refers to at least 'k_SIZE' values.
+
+    // ACCESSORS
+    bsl::uint32_t available() const;
+        // Return a bit mask of the slots of this group that are empty or hold
+        // an erased entry.
+
+    bsl::uint32_t empty() const;
+        // Return a bit mask of the slots of this group that are empty.
+
+    bsl::uint32_t match(bsl::uint8_t value) const;
+        // Return a bit mask of the slots of this group whose control value is
+        // the specified 'value'.
+};
+
+                        // ===========================
+                        // class FlatHashTable_Iterator
+                        // ===========================
+
+template <class VALUE_TYPE>
+class FlatHashTable_Iterator {
+    // This component-private class template implements a forward iterator
+    // over the entries of a 'FlatHashTable', providing access to the entries
+    // as objects of the (template parameter) type 'VALUE_TYPE', which is the
+    // (possibly 'const'-qualified) type of the entries.
+
+    // DATA
+    VALUE_TYPE         *d_entry_p;    // current entry
+    const bsl::uint8_t *d_control_p;  // control value of current entry
+    const bsl::uint8_t *d_end_p;      // one past the last control value
+
+    // FRIENDS
+    template <class OTHER_VALUE_TYPE>
+    friend class FlatHashTable_Iterator;
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::forward_iterator_tag                 iterator_category;
+    typedef typename bsl::remove_cv<VALUE_TYPE>::type value_type;
+    typedef bsl::ptrdiff_t                            difference_type;
+    typedef VALUE_TYPE                               *pointer;
+    typedef VALUE_TYPE&                               reference;
+
+    // CREATORS
+    FlatHashTable_Iterator();
+        // Create a singular iterator.
+
+    FlatHashTable_Iterator(VALUE_TYPE         *entry,
+                           const bsl::uint8_t *control,
+                           const bsl::uint8_t *end);
+        // Create an iterator referring to the first slot in use at or after
+        // the slot having the specified 'entry' and 'control' value, or to
+        // the end position if there is no such slot before the specified
+        // 'end' of the control values.
+
+    template <class OTHER_VALUE_TYPE>
+    FlatHashTable_Iterator(
+                       const FlatHashTable_Iterator<OTHER_VALUE_TYPE>& other);
+        // Create an iterator referring to the same position as the specified
+        // 'other' iterator.  Note that this constructor converts a modifiable
+        // iterator to a non-modifiable one, and does not compile for the
+        // converse conversion.
+
+    // MANIPULATORS
+    FlatHashTable_Iterator& operator++();
+        // Advance this iterator to the next entry, and return a reference
+        // providing modifiable access to this iterator.  The behavior is
+        // undefined unless this iterator refers to an entry.
+
+    FlatHashTable_Iterator operator++(int);
+        // Advance this iterator to the next entry, and return an iterator
+        // having the value this iterator had before the call.  The behavior
+        // is undefined unless this iterator refers to an entry.
+
+    // ACCESSORS
+    VALUE_TYPE& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to an entry.
+
+    VALUE_TYPE *operator->() const;
+        // Return the address of the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to an entry.
+
+    VALUE_TYPE *entry() const;
+        // Return the address of the slot referred to by this iterator.
+
+    template <class OTHER_VALUE_TYPE>
+    bool operator==(
+                 const FlatHashTable_Iterator<OTHER_VALUE_TYPE>& other) const;
+        // Return 'true' if this iterator and the specified 'other' iterator
+        // refer to the same position, and 'false' otherwise.
+
+    template <class OTHER_VALUE_TYPE>
+    bool operator!=(
+                 const FlatHashTable_Iterator<OTHER_VALUE_TYPE>& other) const;
+        // Return 'true' if this iterator and the specified 'other' iterator
+        // do not refer to the same position, and 'false' otherwise.
+};
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed hash table of unique
+    // keys, storing entries of the (template parameter) type 'ENTRY' whose
+    // keys, of the (template parameter) type 'KEY', are provided by the
+    // (template parameter) type 'ENTRY_UTIL', and are hashed and compared by
+    // objects of the (template parameter) types 'HASH' and 'EQUAL'.  See the
+    // component documentation for details.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl GroupControl;
+
+    // DATA
+    ENTRY            *d_entries_p;   // array of 'd_capacity' slots
+    bsl::uint8_t     *d_controls_p;  // array of 'd_capacity' control values
+    bsl::size_t       d_size;        // number of entries
+    bsl::size_t       d_numErased;   // number of slots of erased entries
+    bsl::size_t       d_capacity;    // number of slots (0, or a power of two
+                                     // not less than 'GroupControl::k_SIZE')
+    HASH              d_hasher;      // hash functor
+    EQUAL             d_equal;       // key equality functor
+    bslma::Allocator *d_allocator_p; // memory allocator (held, not owned)
+
+  public:
+    // PUBLIC TYPES
+    typedef FlatHashTable_Iterator<ENTRY>       iterator;
+    typedef FlatHashTable_Iterator<const ENTRY> const_iterator;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bsl::uint64_t mix(bsl::size_t hashValue);
+        // Return the specified 'hashValue' with its bits mixed, so that
+        // hash functors having poor dispersion in their high-order or
+        // low-order bits (e.g., the identity) select groups uniformly.
+
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the maximum number of used slots (including the slots of
+        // erased entries) of a table having the specified 'capacity'.
+
+    static bsl::size_t capacityForSize(bsl::size_t size);
+        // Return the smallest valid capacity of a table that can hold the
+        // specified 'size' entries without exceeding its maximum load factor.
+
+    static bsl::uint8_t h2(bsl::uint64_t hashValue);
+        // Return the control value of an entry having the specified (mixed)
+        // 'hashValue'.
+
+    // PRIVATE MANIPULATORS
+    bsl::size_t prepareInsert(bsl::uint64_t hashValue);
+        // Ensure that an entry having the specified (mixed) 'hashValue' can
+        // be inserted without exceeding the maximum load factor, rehashing
+        // this table if needed, and return the index of the slot at which
+        // the entry is to be constructed.
+
+    void commitInsert(bsl::size_t index, bsl::uint64_t hashValue);
+        // Mark the slot at the specified 'index', at which an entry having
+        // the specified (mixed) 'hashValue' has been constructed, as in use.
+
+    void rehashRaw(bsl::size_t newCapacity);
+        // Move the entries of this table to a newly-allocated array having
+        // the specified 'newCapacity' slots.  The behavior is undefined
+        // unless 'newCapacity' is a valid capacity for 'size()' entries.
+
+    void swapRaw(FlatHashTable& other);
+        // Exchange the value, hasher, and equality functor of this table
+        // with those of the specified 'other' table, without regard to their
+        // allocators.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findAvailable(bsl::uint64_t hashValue) const;
+        // Return the index of the first available slot in the probe sequence
+        // of the specified (mixed) 'hashValue'.  The behavior is undefined
+        // unless '0 < capacity()'.
+
+    bsl::size_t findIndex(const KEY& key, bsl::uint64_t hashValue) const;
+        // Return the index of the slot holding the entry having the
+        // specified 'key', whose (mixed) hash value is the specified
+        // 'hashValue', or 'capacity()' if there is no such entry.
+
+    bsl::size_t h1(bsl::uint64_t hashValue) const;
+        // Return the index of the first group of the probe sequence of an
+        // entry having the specified (mixed) 'hashValue'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table having at least the specified 'capacity',
+        // and using the specified 'hash' and 'equal' functors.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'capacity' is 0, no memory is allocated.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, hasher, and equality functor
+        // as the specified 'original' table.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value, hasher, and equality functor of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // the end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+    void clear();
+        // Remove all entries from this table.  Note that the capacity of this
+        // table is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the entry having the specified 'key' from this table, if
+        // any.  Return the number of entries removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the entry at the specified 'position' from this table, and
+        // return an iterator referring to the entry following it, or the end
+        // iterator if there is no such entry.  The behavior is undefined
+        // unless 'position' refers to an entry of this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the end iterator if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' into this table if no entry
+        // having the same key is present.  Return a pair whose first member
+        // refers to the entry having the key of 'entry', and whose second
+        // member is 'true' if 'entry' was inserted, and 'false' otherwise.
+
+    bsl::pair<iterator, bool> insertKey(const KEY& key);
+        // Insert an entry constructed by 'ENTRY_UTIL::constructFromKey' from
+        // the specified 'key' into this table if no entry having 'key' is
+        // present.  Return a pair whose first member refers to the entry
+        // having 'key', and whose second member is 'true' if an entry was
+        // inserted, and 'false' otherwise.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the smallest valid capacity
+        // that is not less than the specified 'minimumCapacity' and that can
+        // hold 'size()' entries, and reclaim the slots of erased entries.
+        // Note that a 'minimumCapacity' of 0 shrinks this table to fit its
+        // entries, releasing all memory if it is empty.
+
+    void reserve(bsl::size_t numEntries);
+        // Ensure that this table can hold the specified 'numEntries' entries
+        // without rehashing.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher, and equality functor of this table
+        // with those of the specified 'other' table.  The behavior is
+        // undefined unless this table and 'other' use the same allocator.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // the end iterator if this table is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table has an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this table has no entries, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the end iterator if there is no such entry.
+
+    const HASH& hash_function() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this table.
+
+    const EQUAL& key_eq() const;
+        // Return a reference providing non-modifiable access to the key
+        // equality functor of this table.
+
+    float load_factor() const;
+        // Return the ratio of the number of entries to the capacity of this
+        // table, or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this table.
+
+    bsl::size_t size() const;
+        // Return the number of entries in this table.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries, and every entry of 'lhs' compares
+    // equal to the entry of 'rhs' having the same key.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class FlatHashTable_GroupControl
+                     // --------------------------------
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                 const bsl::uint8_t *controls)
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+: d_value(_mm_loadu_si128(reinterpret_cast<const __m128i *>(controls)))
+#else
+: d_controls_p(controls)
+#endif
+{
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::available() const
+{
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(d_value));
+#else
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        mask |= static_cast<bsl::uint32_t>(d_controls_p[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::empty() const
+{
+    return match(static_cast<bsl::uint8_t>(k_EMPTY));
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(
+                   _mm_cmpeq_epi8(d_value,
+                                  _mm_set1_epi8(static_cast<char>(value)))));
+#else
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        mask |= static_cast<bsl::uint32_t>(value == d_controls_p[i]) << i;
+    }
+    return mask;
+#endif
+}
+
+                        // ---------------------------
+                        // class FlatHashTable_Iterator
+                        // ---------------------------
+
+// CREATORS
+template <class VALUE_TYPE>
+inline
+FlatHashTable_Iterator<VALUE_TYPE>::FlatHashTable_Iterator()
+: d_entry_p(0)
+, d_control_p(0)
+, d_end_p(0)
+{
+}
+
+template <class VALUE_TYPE>
+inline
+FlatHashTable_Iterator<VALUE_TYPE>::FlatHashTable_Iterator(
+                                              VALUE_TYPE         *entry,
+                                              const bsl::uint8_t *control,
+                                              const bsl::uint8_t *end)
+: d_entry_p(entry)
+, d_control_p(control)
+, d_end_p(end)
+{
+    while (d_control_p != d_end_p && (*d_control_p & 0x80)) {
+        ++d_entry_p;
+        ++d_control_p;
+    }
+}
+
+template <class VALUE_TYPE>
+template <class OTHER_VALUE_TYPE>
+inline
+FlatHashTable_Iterator<VALUE_TYPE>::FlatHashTable_Iterator(
+                        const FlatHashTable_Iterator<OTHER_VALUE_TYPE>& other)
+: d_entry_p(other.d_entry_p)
+, d_control_p(other.d_control_p)
+, d_end_p(other.d_end_p)
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE>
+inline
+FlatHashTable_Iterator<VALUE_TYPE>&
+FlatHashTable_Iterator<VALUE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_control_p != d_end_p);
+
+    do {
+        ++d_entry_p;
+        ++d_control_p;
+    } while (d_control_p != d_end_p && (*d_control_p & 0x80));
+
+    return *this;
+}
+
+template <class VALUE_TYPE>
+inline
+FlatHashTable_Iterator<VALUE_TYPE>
+FlatHashTable_Iterator<VALUE_TYPE>::operator++(int)
+{
+    FlatHashTable_Iterator result(*this);
+    ++*this;
+    return result;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE& FlatHashTable_Iterator<VALUE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_control_p != d_end_p);
+
+    return *d_entry_p;
+}
+
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE *FlatHashTable_Iterator<VALUE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_control_p != d_end_p);
+
+    return d_entry_p;
+}
+
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE *FlatHashTable_Iterator<VALUE_TYPE>::entry() const
+{
+    return d_entry_p;
+}
+
+template <class VALUE_TYPE>
+template <class OTHER_VALUE_TYPE>
+inline
+bool FlatHashTable_Iterator<VALUE_TYPE>::operator==(
+                  const FlatHashTable_Iterator<OTHER_VALUE_TYPE>& other) const
+{
+    return d_control_p == other.d_control_p;
+}
+
+template <class VALUE_TYPE>
+template <class OTHER_VALUE_TYPE>
+inline
+bool FlatHashTable_Iterator<VALUE_TYPE>::operator!=(
+                  const FlatHashTable_Iterator<OTHER_VALUE_TYPE>& other) const
+{
+    return d_control_p != other.d_control_p;
+}
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::uint64_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::mix(bsl::size_t hashValue)
+{
+    // Multiply by 2^64 divided by the golden ratio (Fibonacci hashing), which
+    // propagates every bit of 'hashValue' to the high-order bits.
+
+    return static_cast<bsl::uint64_t>(hashValue) * 0x9E3779B97F4A7C15ULL;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoad(
+                                                         bsl::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacityForSize(
+                                                             bsl::size_t size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t capacity = GroupControl::k_SIZE;
+    while (maxLoad(capacity) < size) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::uint8_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::h2(bsl::uint64_t hashValue)
+{
+    return static_cast<bsl::uint8_t>(hashValue >> 57);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prepareInsert(
+                                                       bsl::uint64_t hashValue)
+{
+    if (d_size + d_numErased + 1 > maxLoad(d_capacity)) {
+        // Reclaim the slots of erased entries at the same capacity if they
+        // occupy more than 1/16 of the slots, and grow the table otherwise.
+
+        const bsl::size_t minCapacity = capacityForSize(d_size + 1);
+        rehashRaw(d_numErased > d_capacity / 16 && minCapacity <= d_capacity
+                  ? d_capacity
+                  : (d_capacity ? 2 * d_capacity : minCapacity));
+    }
+    return findAvailable(hashValue);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::commitInsert(
+                                                      bsl::size_t   index,
+                                                      bsl::uint64_t hashValue)
+{
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    d_controls_p[index] = h2(hashValue);
+    ++d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+                                                      bsl::size_t newCapacity)
+{
+    BSLS_ASSERT_SAFE(maxLoad(newCapacity) >= d_size);
+
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+
+    if (newCapacity) {
+        other.d_controls_p = static_cast<bsl::uint8_t *>(
+                                         d_allocator_p->allocate(newCapacity));
+        bsl::memset(other.d_controls_p, GroupControl::k_EMPTY, newCapacity);
+        other.d_capacity  = newCapacity;
+        other.d_entries_p = static_cast<ENTRY *>(
+                         d_allocator_p->allocate(newCapacity * sizeof(ENTRY)));
+    }
+
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (d_controls_p[i] & 0x80) {
+            continue;
+        }
+
+        const bsl::uint64_t hashValue = mix(d_hasher(
+                                         ENTRY_UTIL::key(d_entries_p[i])));
+        const bsl::size_t   index     = other.findAvailable(hashValue);
+
+        if (bslmf::IsBitwiseMoveable<ENTRY>::value) {
+            // The size of 'other' is updated only once all the entries are
+            // moved, so that 'other' does not destroy them if the hasher
+            // throws.
+
+            bsl::memcpy(static_cast<void *>(other.d_entries_p + index),
+                        static_cast<const void *>(d_entries_p + i),
+                        sizeof(ENTRY));
+            other.d_controls_p[index] = h2(hashValue);
+        }
+        else {
+            bslalg::ScalarPrimitives::copyConstruct(other.d_entries_p + index,
+                                                    d_entries_p[i],
+                                                    d_allocator_p);
+            other.commitInsert(index, hashValue);
+        }
+    }
+
+    if (bslmf::IsBitwiseMoveable<ENTRY>::value && d_size) {
+        // The entries now belong to 'other'; ensure they are not destroyed
+        // twice.
+
+        other.d_size = d_size;
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+        d_size = 0;
+    }
+
+    swapRaw(other);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swapRaw(
+                                                         FlatHashTable& other)
+{
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_numErased,  &other.d_numErased);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                 bsl::uint64_t hashValue) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    const bsl::size_t groupMask = d_capacity / GroupControl::k_SIZE - 1;
+    bsl::size_t       group     = h1(hashValue);
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const bsl::size_t   base = group * GroupControl::k_SIZE;
+        const bsl::uint32_t mask =
+                               GroupControl(d_controls_p + base).available();
+        if (mask) {
+            return base + bdlb::BitUtil::numTrailingUnsetBits(mask);  // RETURN
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::h1(
+                                                 bsl::uint64_t hashValue) const
+{
+    return static_cast<bsl::size_t>(hashValue >> 25)
+         & (d_capacity / GroupControl::k_SIZE - 1);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findIndex(
+                                          const KEY&    key,
+                                          bsl::uint64_t hashValue) const
+{
+    if (0 == d_size) {
+        return d_capacity;                                            // RETURN
+    }
+
+    const bsl::size_t  groupMask = d_capacity / GroupControl::k_SIZE - 1;
+    const bsl::uint8_t control   = h2(hashValue);
+    bsl::size_t        group     = h1(hashValue);
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const bsl::size_t  base = group * GroupControl::k_SIZE;
+        const GroupControl groupControl(d_controls_p + base);
+
+        for (bsl::uint32_t mask = groupControl.match(control);
+             mask;
+             mask &= mask - 1) {
+            const bsl::size_t index =
+                          base + bdlb::BitUtil::numTrailingUnsetBits(mask);
+            if (d_equal(ENTRY_UTIL::key(d_entries_p[index]), key)) {
+                return index;                                         // RETURN
+            }
+        }
+        if (groupControl.empty()) {
+            return d_capacity;                                        // RETURN
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             const EQUAL&      equal,
+                                             bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        rehash(capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                       const FlatHashTable&  original,
+                                       bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == original.d_size) {
+        return;                                                       // RETURN
+    }
+
+    // Build the copy in a local table, which releases its memory if an
+    // exception is thrown.  Since the hasher is the same, every entry is
+    // copied to the slot it occupies in 'original'.
+
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+
+    const bsl::size_t capacity = original.d_capacity;
+
+    other.d_controls_p = static_cast<bsl::uint8_t *>(
+                                            d_allocator_p->allocate(capacity));
+    bsl::memset(other.d_controls_p, GroupControl::k_EMPTY, capacity);
+    other.d_capacity  = capacity;
+    other.d_entries_p = static_cast<ENTRY *>(
+                            d_allocator_p->allocate(capacity * sizeof(ENTRY)));
+
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        const bsl::uint8_t control = original.d_controls_p[i];
+
+        if (0 == (control & 0x80)) {
+            bslalg::ScalarPrimitives::copyConstruct(other.d_entries_p + i,
+                                                    original.d_entries_p[i],
+                                                    d_allocator_p);
+            ++other.d_size;
+        }
+        else if (GroupControl::k_ERASED == control) {
+            ++other.d_numErased;
+        }
+        other.d_controls_p[i] = control;
+    }
+
+    swapRaw(other);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    if (0 == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + i);
+            --d_size;
+        }
+    }
+    d_allocator_p->deallocate(d_entries_p);
+    d_allocator_p->deallocate(d_controls_p);
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                     const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+        swapRaw(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    return iterator(d_entries_p, d_controls_p, d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator(d_entries_p + d_capacity,
+                    d_controls_p + d_capacity,
+                    d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + i);
+            --d_size;
+        }
+    }
+    if (d_capacity) {
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+    d_numErased = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(const KEY& key)
+{
+    const bsl::size_t index = findIndex(key, mix(d_hasher(key)));
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    erase(const_iterator(d_entries_p + index,
+                         d_controls_p + index,
+                         d_controls_p + d_capacity));
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                      const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    const bsl::size_t index = position.entry() - d_entries_p;
+
+    bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + index);
+    --d_size;
+
+    // A probe sequence continues past a group only if the group had no empty
+    // slot when the sought entry was inserted, and a group having no empty
+    // slot never regains one until the next rehash.  Therefore, if the group
+    // of the slot has an empty slot, no probe sequence continues past it, and
+    // the slot can be marked empty; otherwise it must be marked erased.
+
+    const bsl::size_t base = index & ~static_cast<bsl::size_t>(
+                                                    GroupControl::k_SIZE - 1);
+    if (GroupControl(d_controls_p + base).empty()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+
+    return iterator(d_entries_p + index,
+                    d_controls_p + index,
+                    d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    const bsl::size_t index = findIndex(key, mix(d_hasher(key)));
+    return iterator(d_entries_p + index,
+                    d_controls_p + index,
+                    d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    const KEY&          key       = ENTRY_UTIL::key(entry);
+    const bsl::uint64_t hashValue = mix(d_hasher(key));
+
+    bsl::size_t index    = findIndex(key, hashValue);
+    bool        inserted = false;
+
+    if (index == d_capacity) {
+        index = prepareInsert(hashValue);
+        bslalg::ScalarPrimitives::copyConstruct(d_entries_p + index,
+                                                entry,
+                                                d_allocator_p);
+        commitInsert(index, hashValue);
+        inserted = true;
+    }
+
+    return bsl::pair<iterator, bool>(iterator(d_entries_p + index,
+                                              d_controls_p + index,
+                                              d_controls_p + d_capacity),
+                                     inserted);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insertKey(const KEY& key)
+{
+    const bsl::uint64_t hashValue = mix(d_hasher(key));
+
+    bsl::size_t index    = findIndex(key, hashValue);
+    bool        inserted = false;
+
+    if (index == d_capacity) {
+        index = prepareInsert(hashValue);
+        ENTRY_UTIL::constructFromKey(d_entries_p + index, key, d_allocator_p);
+        commitInsert(index, hashValue);
+        inserted = true;
+    }
+
+    return bsl::pair<iterator, bool>(iterator(d_entries_p + index,
+                                              d_controls_p + index,
+                                              d_controls_p + d_capacity),
+                                     inserted);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                  bsl::size_t minimumCapacity)
+{
+    bsl::size_t capacity = capacityForSize(d_size);
+    if (minimumCapacity > capacity) {
+        capacity = capacity
+                 ? capacity
+                 : static_cast<bsl::size_t>(GroupControl::k_SIZE);
+        while (capacity < minimumCapacity) {
+            capacity *= 2;
+        }
+    }
+    rehashRaw(capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                       bsl::size_t numEntries)
+{
+    if (maxLoad(d_capacity) < numEntries + d_numErased) {
+        rehash(capacityForSize(numEntries));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                         FlatHashTable& other)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == other.d_allocator_p);
+
+    swapRaw(other);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_iterator(d_entries_p,
+                          d_controls_p,
+                          d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator(d_entries_p + d_capacity,
+                          d_controls_p + d_capacity,
+                          d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return d_capacity != findIndex(key, mix(d_hasher(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    const bsl::size_t index = findIndex(key, mix(d_hasher(key)));
+    return const_iterator(d_entries_p + index,
+                          d_controls_p + index,
+                          d_controls_p + d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const HASH&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const EQUAL& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                      / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                       const_iterator Iterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    const Iterator rhsEnd = rhs.end();
+    for (Iterator it = lhs.begin(); it != lhs.end(); ++it) {
+        const Iterator match = rhs.find(ENTRY_UTIL::key(*it));
+        if (match == rhsEnd || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
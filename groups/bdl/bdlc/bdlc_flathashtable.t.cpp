@@ -0,0 +1,987 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements an open-addressed hash table, and a
+// component-private class computing bit masks over the control values of a
+// group of slots.  The group operations are tested against a brute-force
+// computation.  The table is tested against an oracle ('bsl::set') over
+// sequences of random insertions and removals, using hash functors of varied
+// quality (including one mapping every key to the same value, which forces
+// every entry into the same probe sequence), so that probing across groups,
+// erased slots, and rehashing are all exercised.  Memory use is checked with
+// 'bslma::TestAllocator', and exception safety with
+// 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'.
+//-----------------------------------------------------------------------------
+// FlatHashTable_GroupControl
+// [ 2] FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+// [ 2] bsl::uint32_t available() const;
+// [ 2] bsl::uint32_t empty() const;
+// [ 2] bsl::uint32_t match(bsl::uint8_t value) const;
+//
+// FlatHashTable
+// [ 3] FlatHashTable(capacity, hash, equal, basicAllocator = 0);
+// [ 4] FlatHashTable(const FlatHashTable& original, basicAllocator = 0);
+// [ 3] ~FlatHashTable();
+// [ 4] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 5] void clear();
+// [ 3] bsl::size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator find(const KEY& key);
+// [ 3] bsl::pair<iterator, bool> insert(const ENTRY& entry);
+// [ 3] bsl::pair<iterator, bool> insertKey(const KEY& key);
+// [ 5] void rehash(bsl::size_t minimumCapacity);
+// [ 5] void reserve(bsl::size_t numEntries);
+// [ 4] void swap(FlatHashTable& other);
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 3] bsl::size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] bsl::size_t size() const;
+// [ 3] bslma::Allocator *allocator() const;
+// [ 4] bool operator==(const FlatHashTable& lhs, const FlatHashTable& rhs);
+// [ 4] bool operator!=(const FlatHashTable& lhs, const FlatHashTable& rhs);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl GroupControl;
+
+struct IdentityEntryUtil {
+    // This 'struct' provides the entry utility of a table whose entries are
+    // their own keys.
+
+    template <class TYPE>
+    static const TYPE& key(const TYPE& entry)
+    {
+        return entry;
+    }
+
+    template <class TYPE>
+    static void constructFromKey(TYPE             *address,
+                                 const TYPE&       key,
+                                 bslma::Allocator *allocator)
+    {
+        bslalg::ScalarPrimitives::copyConstruct(address, key, allocator);
+    }
+};
+
+struct ConstantHash {
+    // This 'struct' provides a hash functor mapping every value to 0.
+
+    template <class TYPE>
+    bsl::size_t operator()(const TYPE&) const
+    {
+        return 0;
+    }
+};
+
+struct IdentityHash {
+    // This 'struct' provides a hash functor mapping every integer to itself.
+
+    bsl::size_t operator()(int value) const
+    {
+        return static_cast<bsl::size_t>(value);
+    }
+};
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityEntryUtil,
+                            bslh::Hash<>,
+                            bsl::equal_to<int> >         IntTable;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityEntryUtil,
+                            IdentityHash,
+                            bsl::equal_to<int> >         IdentityIntTable;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityEntryUtil,
+                            ConstantHash,
+                            bsl::equal_to<int> >         ConstantIntTable;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            IdentityEntryUtil,
+                            bslh::Hash<>,
+                            bsl::equal_to<bsl::string> > StringTable;
+
+// ============================================================================
+//                            HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+class Rng {
+    // This class implements a simple, reproducible pseudo-random generator.
+
+    unsigned int d_state;
+
+  public:
+    explicit Rng(unsigned int seed) : d_state(seed) {}
+
+    int next(int limit)
+    {
+        d_state = d_state * 1103515245U + 12345U;
+        return static_cast<int>((d_state >> 8) % static_cast<unsigned>(limit));
+    }
+};
+
+template <class TABLE>
+bool verify(const TABLE& table, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'table' holds exactly the values of the
+    // specified 'oracle', as determined both by iteration and by lookup, and
+    // 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t count = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it, ++count) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+    }
+    if (count != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::set<int>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        typename TABLE::const_iterator match = table.find(*it);
+        if (match == table.end() || *match != *it || !table.contains(*it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return table.size() <= table.capacity() * table.max_load_factor();
+}
+
+template <class TABLE>
+void testAgainstOracle(int numOperations, int keyRange, unsigned int seed)
+    // Apply the specified 'numOperations' random insertions and removals of
+    // keys in the range '[0 .. keyRange)', using the specified 'seed', to a
+    // table of the (template parameter) type 'TABLE' and to an oracle, and
+    // verify after every operation that they hold the same values.
+{
+    bslma::TestAllocator ta("table", false);
+    {
+        TABLE         mX(0,
+                         typename TABLE::hasher_type(),
+                         bsl::equal_to<int>(),
+                         &ta);
+        const TABLE&  X = mX;
+        bsl::set<int> oracle;
+        Rng           rng(seed);
+
+        for (int i = 0; i < numOperations; ++i) {
+            const int key = rng.next(keyRange);
+
+            switch (rng.next(4)) {
+              case 0: {
+                ASSERTV(i, oracle.erase(key) == mX.erase(key));
+              } break;
+              case 1: {
+                typename TABLE::iterator it = mX.find(key);
+                if (it == mX.end()) {
+                    ASSERTV(i, 0 == oracle.count(key));
+                }
+                else {
+                    ASSERTV(i, *it == key);
+                    mX.erase(it);
+                    oracle.erase(key);
+                }
+              } break;
+              case 2: {
+                const bool inserted = mX.insertKey(key).second;
+                ASSERTV(i, oracle.insert(key).second == inserted);
+              } break;
+              default: {
+                bsl::pair<typename TABLE::iterator, bool> result =
+                                                                mX.insert(key);
+                ASSERTV(i, oracle.insert(key).second == result.second);
+                ASSERTV(i, key == *result.first);
+              } break;
+            }
+            if (0 == i % 64 || i == numOperations - 1) {
+                ASSERTV(i, verify(X, oracle));
+            }
+        }
+    }
+    ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+}
+
+// The oracle test uses 'TABLE::hasher_type' to create the hash functor of the
+// table under test; provide it through a derived class of each table.
+
+template <class HASH>
+class TestTable : public bdlc::FlatHashTable<int,
+                                             int,
+                                             IdentityEntryUtil,
+                                             HASH,
+                                             bsl::equal_to<int> > {
+    // This class template provides a table of integers hashed by the
+    // (template parameter) type 'HASH', for use by 'testAgainstOracle'.
+
+    typedef bdlc::FlatHashTable<int,
+                                int,
+                                IdentityEntryUtil,
+                                HASH,
+                                bsl::equal_to<int> > Base;
+
+  public:
+    typedef HASH hasher_type;
+
+    TestTable(bsl::size_t               capacity,
+              const HASH&               hash,
+              const bsl::equal_to<int>& equal,
+              bslma::Allocator         *basicAllocator)
+    : Base(capacity, hash, equal, basicAllocator)
+    {
+    }
+};
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+struct IntEntryUtil {
+    static const int& key(const int& entry)
+    {
+        return entry;
+    }
+
+    static void constructFromKey(int              *address,
+                                 const int&        key,
+                                 bslma::Allocator *)
+    {
+        *address = key;
+    }
+};
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    IntEntryUtil,
+                                    bslh::Hash<>,
+                                    bsl::equal_to<int> > Table;
+
+        Table table(0, bslh::Hash<>(), bsl::equal_to<int>());
+        ASSERT(0 == table.capacity());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(true == table.insert(i * i).second);
+        }
+        ASSERT(false == table.insert(25).second);
+        ASSERT(100   == table.size());
+        ASSERT(128   == table.capacity());
+
+        ASSERT(table.end() != table.find(49));
+        ASSERT(table.end() == table.find(50));
+
+        ASSERT(1  == table.erase(49));
+        ASSERT(0  == table.erase(49));
+        ASSERT(99 == table.size());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT
+        //
+        // Concerns:
+        //: 1 'reserve' ensures that the requested number of entries can be
+        //:   inserted without changing the capacity.
+        //:
+        //: 2 'rehash' sets the capacity to the smallest valid capacity not
+        //:   less than the requested one that can hold the entries, and
+        //:   'rehash(0)' on an empty table releases all memory.
+        //:
+        //: 3 'clear' removes all entries but retains the capacity.
+        //:
+        //: 4 Repeated insertion and removal at a constant size does not grow
+        //:   the table without bound (erased slots are reclaimed).
+        //
+        // Plan:
+        //: 1 Exercise each method and check capacity, size, contents, and
+        //:   memory use.  (C-1..4)
+        //
+        // Testing:
+        //   void clear();
+        //   void rehash(bsl::size_t minimumCapacity);
+        //   void reserve(bsl::size_t numEntries);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANAGEMENT" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+        {
+            IntTable mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const IntTable& X = mX;
+
+            mX.reserve(1000);
+            const bsl::size_t CAPACITY = X.capacity();
+            ASSERTV(CAPACITY, 1000 <= CAPACITY * X.max_load_factor());
+            ASSERTV(CAPACITY, 2048 == CAPACITY);
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i);
+            }
+            ASSERTV(X.capacity(), CAPACITY == X.capacity());
+
+            mX.rehash(5000);
+            ASSERTV(X.capacity(), 8192 == X.capacity());
+            ASSERT(1000 == X.size());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+
+            mX.rehash(0);
+            ASSERTV(X.capacity(), 2048 == X.capacity());
+
+            mX.clear();
+            ASSERT(0    == X.size());
+            ASSERT(true == X.empty());
+            ASSERT(2048 == X.capacity());
+            ASSERT(X.begin() == X.end());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        {
+            ConstantIntTable mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const ConstantIntTable& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX.insert(i);
+            }
+            const bsl::size_t CAPACITY = X.capacity();
+            for (int i = 20; i < 20000; ++i) {
+                ASSERTV(i, 1 == mX.erase(i - 20));
+                mX.insert(i);
+            }
+            ASSERTV(X.capacity(), CAPACITY == X.capacity());
+            ASSERT(20 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, EQUALITY, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   specified allocator.
+        //:
+        //: 2 Assignment gives the target the value of the source, including
+        //:   for aliases.
+        //:
+        //: 3 Equality does not depend on capacity or insertion order.
+        //:
+        //: 4 Copying, assignment, and insertion are exception neutral, and
+        //:   leave the table unchanged if an exception is thrown.
+        //:
+        //: 5 'swap' exchanges the values of two tables.
+        //
+        // Plan:
+        //: 1 Build tables of strings in different orders and with different
+        //:   capacities, and compare, copy, assign, and swap them, using test
+        //:   allocators and the exception-test macros.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original, basicAllocator = 0);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   void swap(FlatHashTable& other);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, EQUALITY, AND SWAP" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+        bslma::TestAllocator tb("copy",  veryVerbose);
+
+        const char *LONG = "a string that is long enough to allocate memory";
+
+        {
+            StringTable mX(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(),
+                           &ta);
+            const StringTable& X = mX;
+            StringTable mY(256, bslh::Hash<>(), bsl::equal_to<bsl::string>(),
+                           &ta);
+            const StringTable& Y = mY;
+
+            for (int i = 0; i < 100; ++i) {
+                bsl::string value(LONG);
+                value += static_cast<char>('a' + i % 26);
+                value += static_cast<char>('a' + i / 26);
+                mX.insert(value);
+            }
+            for (int i = 99; 0 <= i; --i) {
+                bsl::string value(LONG);
+                value += static_cast<char>('a' + i % 26);
+                value += static_cast<char>('a' + i / 26);
+                mY.insert(value);
+            }
+            ASSERT(X.capacity() != Y.capacity());
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            mY.erase(*Y.begin());
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+
+            if (verbose) cout << "\tCopy construction." << endl;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(tb) {
+                StringTable mZ(X, &tb);  const StringTable& Z = mZ;
+                ASSERT(X  == Z);
+                ASSERT(&tb == Z.allocator());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == tb.numBlocksInUse());
+
+            if (verbose) cout << "\tAssignment." << endl;
+
+            StringTable mZ(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(),
+                           &tb);
+            const StringTable& Z = mZ;
+            mZ.insert(bsl::string(LONG));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(tb) {
+                const StringTable SAVED(Z, &ta);
+                try {
+                    mZ = X;
+                }
+                catch (...) {
+                    ASSERT(SAVED == Z);
+                    throw;
+                }
+                ASSERT(X == Z);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            mZ = Z;
+            ASSERT(X == Z);
+
+            if (verbose) cout << "\tInsertion." << endl;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(tb) {
+                const StringTable SAVED(Z, &ta);
+                try {
+                    for (int i = 0; i < 200; ++i) {
+                        bsl::string value(LONG);
+                        value += static_cast<char>('A' + i % 26);
+                        value += static_cast<char>('A' + i / 26);
+                        mZ.insert(value);
+                    }
+                }
+                catch (...) {
+                    ASSERT(SAVED.size() <= Z.size());
+                    for (StringTable::const_iterator it = SAVED.begin();
+                         it != SAVED.end();
+                         ++it) {
+                        ASSERT(Z.contains(*it));
+                    }
+                    throw;
+                }
+                ASSERT(300 == Z.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            if (verbose) cout << "\tSwap." << endl;
+
+            StringTable mW(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(),
+                           &tb);
+            const StringTable& W = mW;
+            const StringTable  ZZ(Z, &ta);
+
+            mW.swap(mZ);
+            ASSERT(ZZ == W);
+            ASSERT(Z.empty());
+            ASSERT(0 == Z.capacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed table is empty and allocates no memory.
+        //:
+        //: 2 Insertions, lookups, and removals are consistent with an oracle
+        //:   for hash functors of every quality, including a hash functor
+        //:   mapping every key to the same value.
+        //:
+        //: 3 Iteration visits every entry exactly once.
+        //:
+        //: 4 The load factor never exceeds the maximum load factor.
+        //:
+        //: 5 All memory is supplied by the specified allocator, and released
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Create tables and check their initial state.  (C-1)
+        //:
+        //: 2 Apply random sequences of operations to tables using several
+        //:   hash functors, comparing with 'bsl::set' after every few
+        //:   operations.  (C-2..5)
+        //
+        // Testing:
+        //   FlatHashTable(capacity, hash, equal, basicAllocator = 0);
+        //   ~FlatHashTable();
+        //   iterator begin();
+        //   iterator end();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator find(const KEY& key);
+        //   bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        //   bsl::pair<iterator, bool> insertKey(const KEY& key);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bsl::size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY& key) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   bsl::size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        if (verbose) cout << "\tInitial state." << endl;
+        {
+            bslma::TestAllocator ta("table", veryVerbose);
+
+            IntTable mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const IntTable& X = mX;
+
+            ASSERT(0     == X.size());
+            ASSERT(true  == X.empty());
+            ASSERT(0     == X.capacity());
+            ASSERT(0.0f  == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end()   == X.find(0));
+            ASSERT(false == X.contains(0));
+            ASSERT(&ta   == X.allocator());
+            ASSERT(0     == ta.numBlocksTotal());
+
+            IntTable mY(1, bslh::Hash<>(), bsl::equal_to<int>());
+            ASSERT(16 == mY.capacity());
+            ASSERT(0  <  da.numBlocksInUse());
+
+            IntTable mZ(17, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            ASSERT(32 == mZ.capacity());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tIteration and mutation." << endl;
+        {
+            bslma::TestAllocator ta("table", veryVerbose);
+
+            IntTable mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i);
+            }
+            int sum = 0;
+            for (IntTable::iterator it = mX.begin(); it != mX.end(); ++it) {
+                sum += *it;
+            }
+            ASSERTV(sum, 999 * 1000 / 2 == sum);
+
+            // Erase every odd entry while iterating.
+
+            IntTable::iterator it = mX.begin();
+            while (it != mX.end()) {
+                if (*it % 2) {
+                    it = mX.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERTV(mX.size(), 500 == mX.size());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, (0 == i % 2) == mX.contains(i));
+            }
+            ASSERT(0.0f < mX.load_factor());
+            ASSERT(mX.load_factor() <= mX.max_load_factor());
+        }
+
+        if (verbose) cout << "\tComparison with an oracle." << endl;
+
+        testAgainstOracle<TestTable<bslh::Hash<> > >(20000, 2000, 1);
+        testAgainstOracle<TestTable<bslh::Hash<> > >(20000,   50, 2);
+        testAgainstOracle<TestTable<IdentityHash> >(20000, 2000, 3);
+        testAgainstOracle<TestTable<IdentityHash> >(20000,  100, 4);
+        testAgainstOracle<TestTable<ConstantHash> >( 5000,  200, 5);
+        testAgainstOracle<TestTable<ConstantHash> >( 5000,   20, 6);
+
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL
+        //
+        // Concerns:
+        //: 1 'match' returns a mask of exactly the control values equal to
+        //:   the specified value.
+        //:
+        //: 2 'available' returns a mask of exactly the empty and erased
+        //:   control values.
+        //:
+        //: 3 'empty' returns a mask of exactly the empty control values.
+        //:
+        //: 4 The group need not be aligned.
+        //
+        // Plan:
+        //: 1 For pseudo-random groups of control values, at every offset in
+        //:   a buffer, compare each mask with a brute-force computation.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+        //   bsl::uint32_t available() const;
+        //   bsl::uint32_t empty() const;
+        //   bsl::uint32_t match(bsl::uint8_t value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROUP CONTROL" << endl
+                          << "=============" << endl;
+
+        Rng          rng(7);
+        bsl::uint8_t buffer[GroupControl::k_SIZE + 15];
+
+        for (int iteration = 0; iteration < 1000; ++iteration) {
+            for (int i = 0; i < static_cast<int>(sizeof buffer); ++i) {
+                switch (rng.next(4)) {
+                  case 0: {
+                    buffer[i] = GroupControl::k_EMPTY;
+                  } break;
+                  case 1: {
+                    buffer[i] = GroupControl::k_ERASED;
+                  } break;
+                  default: {
+                    buffer[i] = static_cast<bsl::uint8_t>(rng.next(4));
+                  } break;
+                }
+            }
+
+            const int offset = iteration % 16;
+            const bsl::uint8_t *controls = buffer + offset;
+
+            const GroupControl X(controls);
+
+            bsl::uint32_t expAvailable = 0;
+            bsl::uint32_t expEmpty     = 0;
+            bsl::uint32_t expMatch[4]  = { 0, 0, 0, 0 };
+
+            for (int i = 0; i < GroupControl::k_SIZE; ++i) {
+                if (controls[i] & 0x80) {
+                    expAvailable |= 1u << i;
+                }
+                if (GroupControl::k_EMPTY == controls[i]) {
+                    expEmpty |= 1u << i;
+                }
+                if (controls[i] < 4) {
+                    expMatch[controls[i]] |= 1u << i;
+                }
+            }
+
+            ASSERTV(iteration, expAvailable == X.available());
+            ASSERTV(iteration, expEmpty     == X.empty());
+            for (int v = 0; v < 4; ++v) {
+                ASSERTV(iteration, v,
+                        expMatch[v] == X.match(static_cast<bsl::uint8_t>(v)));
+            }
+            ASSERTV(iteration, expEmpty == X.match(GroupControl::k_EMPTY));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+        {
+            StringTable mX(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(),
+                           &ta);
+            const StringTable& X = mX;
+
+            ASSERT(true == mX.insert("hello").second);
+            ASSERT(true == mX.insert("world").second);
+            ASSERT(false == mX.insert("hello").second);
+            ASSERT(2 == X.size());
+            ASSERT(X.contains("hello"));
+            ASSERT(!X.contains("bye"));
+
+            ASSERT(1 == mX.erase("hello"));
+            ASSERT(1 == X.size());
+            ASSERT(!X.contains("hello"));
+            ASSERT("world" == *X.begin());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare lookup and insertion times, and memory use, with those of
+        //   'bsl::unordered_set'.
+        //
+        // Concerns:
+        //: 1 Lookups are faster than those of 'bsl::unordered_set'.
+        //
+        // Plan:
+        //: 1 Time insertion and successful and unsuccessful lookups of
+        //:   integers in both containers, and report the times and the memory
+        //:   used.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int N = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bsl::vector<int> keys(N);
+        Rng rng(11);
+        for (int i = 0; i < N; ++i) {
+            keys[i] = rng.next(0x7fffffff);
+        }
+
+        bslma::TestAllocator ta("flat",      veryVerbose);
+        bslma::TestAllocator tb("unordered", veryVerbose);
+
+        // Use the same hash functor for both containers.
+
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    IdentityEntryUtil,
+                                    bsl::hash<int>,
+                                    bsl::equal_to<int> > Table;
+
+        Table                   mX(0, bsl::hash<int>(), bsl::equal_to<int>(),
+                                   &ta);
+        bsl::unordered_set<int> mY(&tb);
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < N; ++i) {
+            mX.insert(keys[i]);
+        }
+        timer.stop();
+        cout << "flat insert:      " << timer.elapsedTime() << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < N; ++i) {
+            mY.insert(keys[i]);
+        }
+        timer.stop();
+        cout << "unordered insert: " << timer.elapsedTime() << endl;
+
+        bsl::size_t found = 0;
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < N; ++i) {
+            found += mX.contains(keys[i]);
+            found += mX.contains(~keys[i]);
+        }
+        timer.stop();
+        cout << "flat find:        " << timer.elapsedTime() << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < N; ++i) {
+            found += mY.count(keys[i]);
+            found += mY.count(~keys[i]);
+        }
+        timer.stop();
+        cout << "unordered find:   " << timer.elapsedTime() << endl;
+
+        cout << "flat memory:      " << ta.numBytesInUse() << endl
+             << "unordered memory: " << tb.numBytesInUse() << endl;
+        ASSERT(found >= static_cast<bsl::size_t>(N));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,42 @@
+// bdlcc_boundedqueue.cpp                                             -*-C++-*-
+#include <bdlcc_boundedqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_boundedqueue_cpp,"$Id$ $CSID$")
+
+///Implementation Note
+///===================
+// 'bdlcc::BoundedQueue' follows the design of 'bdlcc::FixedQueue' (see
+// 'bdlcc_fixedqueue.cpp'): an array of elements whose cells are protected by
+// the per-cell state machine of a 'bdlcc::FixedQueueIndexManager', with
+// semaphores used only to park threads that find the queue full or empty.
+// The differences are:
+//
+//: o The semaphores are 'bslmt::TimedSemaphore' objects, so that the
+//:   'timedPushBack' and 'timedPopFront' methods can be provided.  A timed-out
+//:   waiter may leave a post unconsumed; this only causes a spurious wake-up
+//:   (and a retry) of a later waiter.
+//:
+//: o The batch operations reserve a run of consecutive cells with one call to
+//:   'reservePushIndices' or 'reservePopIndices'.  The guard and proctor
+//:   objects operate on ranges of cells, so the single-element operations are
+//:   simply batches of one.
+//:
+//: o A thread completing an operation on 'N' cells releases up to 'N' waiting
+//:   threads of the opposite kind (rather than at most one).
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1220 @@
+// bdlcc_boundedqueue.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_BOUNDEDQUEUE
+#define INCLUDED_BDLCC_BOUNDEDQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free bounded queue supporting batch operations.
+//
+//@CLASSES:
+//  bdlcc::BoundedQueue: lock-free bounded MPMC queue of 'TYPE' values
+//
+//@SEE_ALSO: bdlcc_queue, bdlcc_fixedqueue, bdlcc_fixedqueueindexmanager
+//
+//@DESCRIPTION: This component defines a type, 'bdlcc::BoundedQueue', that
+// provides a thread-enabled, lock-free, multi-producer multi-consumer queue of
+// values having a capacity fixed at construction.  The queue is built on the
+// sequence-number scheme implemented by 'bdlcc::FixedQueueIndexManager': each
+// cell of the underlying circular buffer carries an atomic state encoding a
+// generation count, and pushing and popping threads claim cells by atomically
+// swapping those states rather than by acquiring a mutex.
+//
+// The queue offers the blocking, timed, and non-blocking ("try") variants of
+// the single-ended operations provided by 'bdlcc::Queue' ('pushBack',
+// 'timedPushBack', 'tryPushBack', 'popFront', 'timedPopFront', and
+// 'tryPopFront'), with the same return conventions.  As in 'bdlcc::Queue', the
+// timeouts supplied to the timed methods are expressed as values of type
+// 'bsls::TimeInterval' that represent !ABSOLUTE! times from 00:00:00 UTC,
+// January 1, 1970.
+//
+// In addition, the queue provides batch operations, in blocking, timed, and
+// non-blocking variants ('pushBackBatch', 'timedPushBackBatch',
+// 'tryPushBackBatch', 'popFrontBatch', 'timedPopFrontBatch', and
+// 'tryPopFrontBatch'), that transfer several values per claim: a consumer
+// popping a batch reserves a whole run of consecutive full cells with a single
+// call to the index manager, which advances the shared pop index once for the
+// run (see {'bdlcc_fixedqueueindexmanager'|Reserving Batches of Indices}),
+// copies the values out, and releases the run, so that contention on the
+// shared indices and the waking of blocked threads are amortized over the
+// batch.  Note that each cell of the run is still claimed with its own atomic
+// operation, so that a batch is not claimed with a single compare-and-swap.
+// A batch claim never waits on a cell beyond the first one, so a batch
+// operation may transfer fewer values than requested; the number transferred
+// is returned.
+//
+// The queue may be placed into a "disabled" state using the 'disable' method.
+// When disabled, the push methods fail immediately (blocked invocations of
+// 'pushBack', 'timedPushBack', and 'pushBackBatch' are released and fail).
+// The queue may be restored to normal operation with the 'enable' method.
+//
+// Unlike 'bdlcc::Queue', a bounded queue is not double-ended, there is no
+// high-water mark distinct from its capacity, and no 'forcePush' methods.
+// These limitations are the trade-off for avoiding the single mutex (and the
+// two condition variables) that serialize all the operations on a
+// 'bdlcc::Queue'.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::BoundedQueue' is a template that is parameterized on the type of
+// element contained within the queue.  The supplied template argument, 'TYPE',
+// must provide a copy constructor and an assignment operator.  If 'TYPE'
+// declares the 'bslma::UsesBslmaAllocator' trait, the allocator of the queue is
+// propagated to the elements contained in the queue.
+//
+///Exception Safety
+///----------------
+// A 'bdlcc::BoundedQueue' is exception neutral.  The push methods provide the
+// basic exception guarantee: if the copy constructor of 'TYPE' throws, the
+// queue is left in a valid, empty state.  The pop methods provide the basic
+// exception guarantee: if the assignment operator of 'TYPE' throws, the values
+// claimed by that call (including any not yet copied) are removed from the
+// queue.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Batching Consumer
+/// - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::BoundedQueue' is used to pass integers
+// from a producer thread to a consumer thread that processes them in batches.
+//
+// First, we define the consumer, which pops batches of up to 'k_BATCH_SIZE'
+// values from the queue until it reads a negative value, accumulating the sum
+// of the values it reads.  Note that 'popFrontBatch' blocks until at least one
+// value is available:
+//..
+//  enum { k_BATCH_SIZE = 16 };
+//
+//  void myConsumer(bdlcc::BoundedQueue<int> *queue, int *sum)
+//  {
+//      int buffer[k_BATCH_SIZE];
+//      for (;;) {
+//          int numPopped = queue->popFrontBatch(buffer, k_BATCH_SIZE);
+//          for (int i = 0; i < numPopped; ++i) {
+//              if (buffer[i] < 0) {
+//                  return;                                           // RETURN
+//              }
+//              *sum += buffer[i];
+//          }
+//      }
+//  }
+//..
+// Then, we create a queue and start the consumer thread:
+//..
+//  bdlcc::BoundedQueue<int> queue(64);
+//
+//  int                        sum = 0;
+//  bslmt::ThreadUtil::Handle  handle;
+//  int rc = bslmt::ThreadUtil::create(
+//                      &handle,
+//                      bdlf::BindUtil::bind(&myConsumer, &queue, &sum));
+//  assert(0 == rc);
+//..
+// Next, we produce the values 1 through 1000 in batches of 10 values,
+// followed by a single negative value to terminate the consumer:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      int values[10];
+//      for (int j = 0; j < 10; ++j) {
+//          values[j] = i * 10 + j + 1;
+//      }
+//      rc = queue.pushBackBatch(values, 10);
+//      assert(10 == rc);
+//  }
+//  rc = queue.pushBack(-1);
+//  assert(0 == rc);
+//..
+// Finally, we join the consumer and verify that it saw every value:
+//..
+//  bslmt::ThreadUtil::join(handle);
+//  assert(500500 == sum);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLCC_FIXEDQUEUEINDEXMANAGER
+#include <bdlcc_fixedqueueindexmanager.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_TIMEDSEMAPHORE
+#include <bslmt_timedsemaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSL_ALGORITHM
+#include <bsl_algorithm.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class VALUE> class BoundedQueue_PopGuard;
+template <class VALUE> class BoundedQueue_PushProctor;
+
+                            // ==================
+                            // class BoundedQueue
+                            // ==================
+
+template <class TYPE>
+class BoundedQueue {
+    // This class provides a thread-enabled, lock-free, bounded queue of
+    // values supporting batch push and pop operations.
+
+  private:
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE,
+        k_TYPE_PADDING    = k_CACHE_LINE_SIZE
+                                   - sizeof(TYPE *) % k_CACHE_LINE_SIZE,
+        k_SEMA_PADDING    = k_CACHE_LINE_SIZE
+                                   - (sizeof(bsls::AtomicInt)
+                                    + sizeof(bslmt::TimedSemaphore))
+                                                         % k_CACHE_LINE_SIZE
+    };
+
+    // DATA
+    TYPE                  *d_elements;          // array of elements that
+                                                // comprise the queue (array
+                                                // elements are manually
+                                                // constructed and destroyed,
+                                                // and empty elements hold
+                                                // uninitialized memory)
+
+    const char             d_elementsPad[k_TYPE_PADDING];
+                                                // padding to prevent false
+                                                // sharing
+
+    FixedQueueIndexManager d_impl;              // index manager for managing
+                                                // the state of 'd_elements'
+
+    bsls::AtomicInt        d_numWaitingPoppers; // number of threads waiting
+                                                // on 'd_popControlSema' to
+                                                // pop an element
+
+    bslmt::TimedSemaphore  d_popControlSema;    // semaphore on which threads
+                                                // waiting to pop 'wait'
+
+    const char             d_popControlSemaPad[k_SEMA_PADDING];
+                                                // padding to prevent false
+                                                // sharing
+
+    bsls::AtomicInt        d_numWaitingPushers; // number of threads waiting
+                                                // on 'd_pushControlSema' to
+                                                // push an element
+
+    bslmt::TimedSemaphore  d_pushControlSema;   // semaphore on which threads
+                                                // waiting to push 'wait'
+
+    const char             d_pushControlSemaPad[k_SEMA_PADDING];
+                                                // padding to prevent false
+                                                // sharing
+
+    bslma::Allocator      *d_allocator_p;       // allocator, held not owned
+
+    // FRIENDS
+    friend class BoundedQueue_PopGuard<TYPE>;
+    friend class BoundedQueue_PushProctor<TYPE>;
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue(const BoundedQueue&);
+    BoundedQueue& operator=(const BoundedQueue&);
+
+    // PRIVATE MANIPULATORS
+    void wakePoppers(int numItems);
+        // Release up to the specified 'numItems' threads blocked waiting to
+        // pop from this queue.
+
+    void wakePushers(int numItems);
+        // Release up to the specified 'numItems' threads blocked waiting to
+        // push to this queue.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BoundedQueue, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    BoundedQueue(bsl::size_t capacity, bslma::Allocator *basicAllocator = 0);
+        // Create a thread-enabled lock-free queue having the specified
+        // 'capacity'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < capacity' and
+        // 'capacity <= FixedQueueIndexManager::k_MAX_CAPACITY'.
+
+    ~BoundedQueue();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue, blocking
+        // until either space is available - if necessary - or the queue is
+        // disabled.  Return 0 on success, and a non-zero value if the queue is
+        // disabled.
+
+    int timedPushBack(const TYPE& value, const bsls::TimeInterval& timeout);
+        // Append the specified 'value' to the back of this queue.  If this
+        // queue is full, block until space is available, the queue is
+        // disabled, or the specified 'timeout' (expressed as the !ABSOLUTE!
+        // time from 00:00:00 UTC, January 1, 1970) expires.  Return 0 on
+        // success, a negative value if the queue is disabled, and a positive
+        // value if the call timed out before space was available.
+
+    int tryPushBack(const TYPE& value);
+        // Attempt to append the specified 'value' to the back of this queue
+        // without blocking.  Return 0 on success, a negative value if the
+        // queue is disabled, and a positive value if the queue is full.
+
+    int pushBackBatch(const TYPE *values, int numValues);
+        // Append the specified 'numValues' elements of the specified 'values'
+        // array, in order, to the back of this queue, blocking whenever the
+        // queue is full until either space is available or the queue is
+        // disabled.  Return the number of elements appended, which is
+        // 'numValues' unless the queue is disabled.  Note that the elements
+        // appended by a single call are not necessarily contiguous in the
+        // queue, as other producers may interleave their elements with them.
+
+    int timedPushBackBatch(const TYPE                *values,
+                           int                        numValues,
+                           const bsls::TimeInterval&  timeout);
+        // Append the specified 'numValues' elements of the specified 'values'
+        // array, in order, to the back of this queue, blocking whenever the
+        // queue is full until either space is available, the queue is
+        // disabled, or the specified 'timeout' (expressed as the !ABSOLUTE!
+        // time from 00:00:00 UTC, January 1, 1970) expires.  Return the
+        // number of elements appended, which is 'numValues' unless the queue
+        // is disabled or the call timed out.  Note that the elements appended
+        // by a single call are not necessarily contiguous in the queue.
+
+    int tryPushBackBatch(const TYPE *values, int numValues);
+        // Attempt to append the specified 'numValues' elements of the
+        // specified 'values' array, in order, to the back of this queue
+        // without blocking, stopping when the queue becomes full.  Return the
+        // number of elements appended (0 if the queue is full or disabled).
+
+    void popFront(TYPE *value);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If the queue is empty, block
+        // until it is not empty.
+
+    TYPE popFront();
+        // Remove the element from the front of this queue and return its
+        // value.  If the queue is empty, block until it is not empty.
+
+    int timedPopFront(TYPE *value, const bsls::TimeInterval& timeout);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If this queue is empty, block
+        // until an element is available or until the specified 'timeout'
+        // (expressed as the !ABSOLUTE! time from 00:00:00 UTC, January 1,
+        // 1970) expires.  Return 0 on success, and a non-zero value if the
+        // call timed out before an element was available.
+
+    int tryPopFront(TYPE *value);
+        // Attempt to remove the element from the front of this queue without
+        // blocking, and, if successful, load the specified 'value' with the
+        // removed element.  Return 0 on success, and a non-zero value if the
+        // queue was empty.  On failure, 'value' is not changed.
+
+    int popFrontBatch(TYPE *buffer, int maxNumItems);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue with a single claim, and assign them, in order, to the
+        // leading elements of the specified 'buffer'.  If the queue is empty,
+        // block until it is not empty.  Return the number of elements removed,
+        // which is at least 1.  The behavior is undefined unless
+        // '0 < maxNumItems' and 'buffer' refers to an array of at least
+        // 'maxNumItems' elements.
+
+    int timedPopFrontBatch(TYPE                      *buffer,
+                           int                        maxNumItems,
+                           const bsls::TimeInterval&  timeout);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue with a single claim, and assign them, in order, to the
+        // leading elements of the specified 'buffer'.  If the queue is empty,
+        // block until it is not empty or until the specified 'timeout'
+        // (expressed as the !ABSOLUTE! time from 00:00:00 UTC, January 1,
+        // 1970) expires.  Return the number of elements removed (0 if the
+        // call timed out before an element was available).  The behavior is
+        // undefined unless '0 < maxNumItems' and 'buffer' refers to an array
+        // of at least 'maxNumItems' elements.
+
+    int tryPopFrontBatch(TYPE *buffer, int maxNumItems);
+        // Attempt to remove up to the specified 'maxNumItems' elements from
+        // the front of this queue with a single claim and without blocking,
+        // assigning them, in order, to the leading elements of the specified
+        // 'buffer'.  Return the number of elements removed (0 if the queue was
+        // empty).  The behavior is undefined unless '0 < maxNumItems' and
+        // 'buffer' refers to an array of at least 'maxNumItems' elements.
+
+    void removeAll();
+        // Remove all items from this queue.  Note that this operation is not
+        // atomic; if other threads are concurrently pushing items into the
+        // queue the result of 'numElements()' after this function returns is
+        // not guaranteed to be 0.
+
+    void disable();
+        // Disable this queue.  All subsequent invocations of the push methods
+        // will fail immediately.  All blocked invocations of the push methods
+        // will fail immediately.  If the queue is already disabled, this
+        // method has no effect.
+
+    void enable();
+        // Enable queuing.  If the queue is not disabled, this call has no
+        // effect.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of elements that may be stored in this
+        // queue.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue is empty (has no elements), or 'false'
+        // otherwise.
+
+    bool isEnabled() const;
+        // Return 'true' if this queue is enabled, and 'false' otherwise.  Note
+        // that the queue is created in the "enabled" state.
+
+    bool isFull() const;
+        // Return 'true' if this queue is full (when the number of elements
+        // currently in this queue equals its capacity), or 'false' otherwise.
+
+    int numElements() const;
+        // Return the number of elements currently in this queue.
+};
+
+                        // ===========================
+                        // class BoundedQueue_PopGuard
+                        // ===========================
+
+template <class VALUE>
+class BoundedQueue_PopGuard {
+    // This class provides a guard that, upon its destruction, will remove
+    // (pop) the indicated range of elements from the 'BoundedQueue' object
+    // supplied at construction.  Note that this guard is used to provide
+    // exception safety when popping elements from a 'BoundedQueue' object.
+
+    // DATA
+    BoundedQueue<VALUE> *d_parent_p;    // object from which elements will be
+                                        // popped
+
+    unsigned int         d_generation;  // generation count of first cell
+                                        // being popped
+
+    unsigned int         d_index;       // index of first cell being popped
+
+    int                  d_numItems;    // number of cells being popped
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue_PopGuard(const BoundedQueue_PopGuard&);
+    BoundedQueue_PopGuard& operator=(const BoundedQueue_PopGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopGuard(BoundedQueue<VALUE> *queue,
+                          unsigned int         generation,
+                          unsigned int         index,
+                          int                  numItems);
+        // Create a guard that, upon its destruction, will update the state of
+        // the specified 'queue' to remove (pop) the specified 'numItems'
+        // elements starting at the specified 'index' having the specified
+        // 'generation', and destroy those popped objects.  The behavior is
+        // undefined unless 'generation', 'index', and 'numItems' refer to a
+        // range of elements in 'queue' that the current thread has acquired a
+        // reservation to pop.
+
+    ~BoundedQueue_PopGuard();
+        // Update the state of the 'BoundedQueue' object supplied at
+        // construction to remove (pop) the indicated elements, and destroy the
+        // popped objects.
+};
+
+                       // ==============================
+                       // class BoundedQueue_PushProctor
+                       // ==============================
+
+template <class VALUE>
+class BoundedQueue_PushProctor {
+    // This class provides a proctor that, unless the 'release' method has been
+    // previously invoked, will remove and destroy all the elements from a
+    // 'BoundedQueue' object supplied at construction (putting that queue into
+    // a valid empty state), and release the range of cells reserved for
+    // pushing, upon the proctor's destruction.  Note that this proctor is used
+    // to provide exception safety when pushing elements into a
+    // 'BoundedQueue'.
+
+    // DATA
+    BoundedQueue<VALUE> *d_parent_p;         // object in which elements are
+                                             // being pushed
+
+    unsigned int         d_generation;       // generation of first reserved
+                                             // cell
+
+    unsigned int         d_index;            // index of first reserved cell
+
+    int                  d_numReserved;      // number of reserved cells
+
+    int                  d_numConstructed;   // number of leading reserved
+                                             // cells holding a constructed
+                                             // element
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue_PushProctor(const BoundedQueue_PushProctor&);
+    BoundedQueue_PushProctor& operator=(const BoundedQueue_PushProctor&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushProctor(BoundedQueue<VALUE> *queue,
+                             unsigned int         generation,
+                             unsigned int         index,
+                             int                  numReserved);
+        // Create a proctor that manages the specified 'queue' and, unless
+        // 'release' is called, will remove and destroy all the elements from
+        // 'queue' and release the specified 'numReserved' cells starting at
+        // the specified 'index' in the specified 'generation'.  The behavior
+        // is undefined unless 'generation', 'index', and 'numReserved' refer
+        // to a range of cells in 'queue' that the current thread has acquired
+        // a reservation to push.
+
+    ~BoundedQueue_PushProctor();
+        // Destroy this proctor and, if 'release' was not called on this
+        // object, remove and destroy all the elements from the 'BoundedQueue'
+        // object supplied at construction and release the reserved cells.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the 'BoundedQueue' object supplied at
+        // construction.
+
+    void setNumConstructed(int numConstructed);
+        // Indicate that the specified 'numConstructed' leading reserved cells
+        // hold a constructed element.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class BoundedQueue
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::wakePoppers(int numItems)
+{
+    const int numWaiting = d_numWaitingPoppers.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numWaiting)) {
+        d_popControlSema.post(bsl::min(numItems, numWaiting));
+    }
+}
+
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::wakePushers(int numItems)
+{
+    const int numWaiting = d_numWaitingPushers.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numWaiting)) {
+        d_pushControlSema.post(bsl::min(numItems, numWaiting));
+    }
+}
+
+// CREATORS
+template <class TYPE>
+BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
+                                 bslma::Allocator *basicAllocator)
+: d_elements()
+, d_elementsPad()
+, d_impl(capacity, basicAllocator)
+, d_numWaitingPoppers(0)
+, d_popControlSema()
+, d_popControlSemaPad()
+, d_numWaitingPushers(0)
+, d_pushControlSema()
+, d_pushControlSemaPad()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_elements = static_cast<TYPE *>(
+                             d_allocator_p->allocate(capacity * sizeof(TYPE)));
+}
+
+template <class TYPE>
+BoundedQueue<TYPE>::~BoundedQueue()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_elements);
+}
+
+// MANIPULATORS
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
+{
+    unsigned int generation;
+    unsigned int index;
+
+    // SYNCHRONIZATION POINT 1
+    //
+    // The following call to 'reservePushIndex' writes
+    // 'FixedQueueIndexManager::d_pushIndex' with full sequential consistency,
+    // which guarantees the subsequent (relaxed) read from
+    // 'd_numWaitingPoppers' sees any waiting poppers from SYNCHRONIZATION
+    // POINT 1-Prime.
+
+    int retval = d_impl.reservePushIndex(&generation, &index);
+
+    if (0 != retval) {
+        return retval;                                                // RETURN
+    }
+
+    BoundedQueue_PushProctor<TYPE> proctor(this, generation, index, 1);
+    bslalg::ScalarPrimitives::copyConstruct(&d_elements[index],
+                                            value,
+                                            d_allocator_p);
+    proctor.release();
+    d_impl.commitPushIndex(generation, index);
+
+    wakePoppers(1);
+
+    return 0;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBackBatch(const TYPE *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    int numPushed = 0;
+    while (numPushed < numValues) {
+        unsigned int generation;
+        unsigned int index;
+        int          numReserved;
+
+        // SYNCHRONIZATION POINT 1 (see 'tryPushBack')
+
+        if (0 != d_impl.reservePushIndices(&generation,
+                                           &index,
+                                           &numReserved,
+                                           numValues - numPushed)) {
+            break;
+        }
+
+        BoundedQueue_PushProctor<TYPE> proctor(this,
+                                               generation,
+                                               index,
+                                               numReserved);
+
+        unsigned int currGeneration = generation;
+        unsigned int currIndex      = index;
+        for (int i = 0; i < numReserved; ++i) {
+            bslalg::ScalarPrimitives::copyConstruct(&d_elements[currIndex],
+                                                    values[numPushed + i],
+                                                    d_allocator_p);
+            proctor.setNumConstructed(i + 1);
+            d_impl.nextIndex(&currGeneration, &currIndex);
+        }
+        proctor.release();
+        d_impl.commitPushIndices(generation, index, numReserved);
+
+        wakePoppers(numReserved);
+
+        numPushed += numReserved;
+    }
+    return numPushed;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
+{
+    unsigned int generation;
+    unsigned int index;
+
+    // SYNCHRONIZATION POINT 2
+    //
+    // The following call to 'reservePopIndex' writes
+    // 'FixedQueueIndexManager::d_popIndex' with full sequential consistency,
+    // which guarantees the subsequent (relaxed) read from
+    // 'd_numWaitingPushers' sees any waiting pushers from SYNCHRONIZATION
+    // POINT 2-Prime.
+
+    int retval = d_impl.reservePopIndex(&generation, &index);
+
+    if (0 != retval) {
+        return retval;                                                // RETURN
+    }
+
+    BoundedQueue_PopGuard<TYPE> guard(this, generation, index, 1);
+    *value = d_elements[index];
+    return 0;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontBatch(TYPE *buffer, int maxNumItems)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxNumItems);
+
+    unsigned int generation;
+    unsigned int index;
+    int          numReserved;
+
+    // SYNCHRONIZATION POINT 2 (see 'tryPopFront')
+
+    if (0 != d_impl.reservePopIndices(&generation,
+                                      &index,
+                                      &numReserved,
+                                      maxNumItems)) {
+        return 0;                                                     // RETURN
+    }
+
+    // 'BoundedQueue_PopGuard' destroys the popped objects, updates the queue,
+    // and releases waiting pushers, even if an assignment operator throws.
+
+    BoundedQueue_PopGuard<TYPE> guard(this, generation, index, numReserved);
+    for (int i = 0; i < numReserved; ++i) {
+        buffer[i] = d_elements[index];
+        d_impl.nextIndex(&generation, &index);
+    }
+    return numReserved;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBack(const TYPE& value)
+{
+    int retval;
+    while (0 != (retval = tryPushBack(value))) {
+        if (retval < 0) {
+            // The queue is disabled.
+
+            return retval;                                            // RETURN
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime
+        //
+        // The following call to 'isFull' loads
+        // 'FixedQueueIndexManager::d_pushIndex' with full sequential
+        // consistency, which is required to ensure the visibility of the
+        // preceding change to 'd_numWaitingPushers' to SYNCHRONIZATION POINT
+        // 2.
+
+        if (isFull() && isEnabled()) {
+            d_pushControlSema.wait();
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::timedPushBack(const TYPE&               value,
+                                      const bsls::TimeInterval& timeout)
+{
+    int retval;
+    while (0 != (retval = tryPushBack(value))) {
+        if (retval < 0) {
+            return retval;                                            // RETURN
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime (see 'pushBack')
+
+        int timedOut = 0;
+        if (isFull() && isEnabled()) {
+            timedOut = d_pushControlSema.timedWait(timeout);
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+
+        if (timedOut) {
+            // Make a final attempt, so that space made available as the
+            // timeout expired is not missed.
+
+            return tryPushBack(value);                                // RETURN
+        }
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackBatch(const TYPE *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    int numPushed = 0;
+    for (;;) {
+        numPushed += tryPushBackBatch(values + numPushed,
+                                      numValues - numPushed);
+        if (numPushed == numValues || !isEnabled()) {
+            break;
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime (see 'pushBack')
+
+        if (isFull() && isEnabled()) {
+            d_pushControlSema.wait();
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+    }
+    return numPushed;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::timedPushBackBatch(
+                                     const TYPE                *values,
+                                     int                        numValues,
+                                     const bsls::TimeInterval&  timeout)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    int numPushed = 0;
+    for (;;) {
+        numPushed += tryPushBackBatch(values + numPushed,
+                                      numValues - numPushed);
+        if (numPushed == numValues || !isEnabled()) {
+            break;
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime (see 'pushBack')
+
+        int timedOut = 0;
+        if (isFull() && isEnabled()) {
+            timedOut = d_pushControlSema.timedWait(timeout);
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+
+        if (timedOut) {
+            // Make a final attempt, so that space made available as the
+            // timeout expired is not missed.
+
+            numPushed += tryPushBackBatch(values + numPushed,
+                                          numValues - numPushed);
+            break;
+        }
+    }
+    return numPushed;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popFront(TYPE *value)
+{
+    while (0 != tryPopFront(value)) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime
+        //
+        // The following call to 'isEmpty' loads
+        // 'FixedQueueIndexManager::d_pushIndex' with full sequential
+        // consistency, which is required to ensure the visibility of the
+        // preceding change to 'd_numWaitingPoppers' to SYNCHRONIZATION POINT
+        // 1.
+
+        if (isEmpty()) {
+            d_popControlSema.wait();
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+    }
+}
+
+template <class TYPE>
+TYPE BoundedQueue<TYPE>::popFront()
+{
+    unsigned int generation;
+    unsigned int index;
+
+    while (0 != d_impl.reservePopIndex(&generation, &index)) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'popFront(TYPE *)')
+
+        if (isEmpty()) {
+            d_popControlSema.wait();
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+    }
+
+    BoundedQueue_PopGuard<TYPE> guard(this, generation, index, 1);
+    return TYPE(d_elements[index]);
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::timedPopFront(TYPE                      *value,
+                                      const bsls::TimeInterval&  timeout)
+{
+    while (0 != tryPopFront(value)) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'popFront(TYPE *)')
+
+        int timedOut = 0;
+        if (isEmpty()) {
+            timedOut = d_popControlSema.timedWait(timeout);
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+
+        if (timedOut) {
+            return tryPopFront(value);                                // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontBatch(TYPE *buffer, int maxNumItems)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxNumItems);
+
+    int numPopped;
+    while (0 == (numPopped = tryPopFrontBatch(buffer, maxNumItems))) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'popFront(TYPE *)')
+
+        if (isEmpty()) {
+            d_popControlSema.wait();
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+    }
+    return numPopped;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::timedPopFrontBatch(
+                                     TYPE                      *buffer,
+                                     int                        maxNumItems,
+                                     const bsls::TimeInterval&  timeout)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxNumItems);
+
+    int numPopped;
+    while (0 == (numPopped = tryPopFrontBatch(buffer, maxNumItems))) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'popFront(TYPE *)')
+
+        int timedOut = 0;
+        if (isEmpty()) {
+            timedOut = d_popControlSema.timedWait(timeout);
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+
+        if (timedOut) {
+            return tryPopFrontBatch(buffer, maxNumItems);             // RETURN
+        }
+    }
+    return numPopped;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::removeAll()
+{
+    const int numItems    = numElements();
+    int       poppedItems = 0;
+    while (poppedItems < numItems) {
+        unsigned int generation;
+        unsigned int index;
+        int          numReserved;
+
+        if (0 != d_impl.reservePopIndices(&generation,
+                                          &index,
+                                          &numReserved,
+                                          numItems - poppedItems)) {
+            break;
+        }
+
+        unsigned int currGeneration = generation;
+        unsigned int currIndex      = index;
+        for (int i = 0; i < numReserved; ++i) {
+            bslalg::ScalarDestructionPrimitives::destroy(
+                                                    d_elements + currIndex);
+            d_impl.nextIndex(&currGeneration, &currIndex);
+        }
+        d_impl.commitPopIndices(generation, index, numReserved);
+
+        poppedItems += numReserved;
+    }
+
+    if (poppedItems) {
+        wakePushers(poppedItems);
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::disable()
+{
+    d_impl.disable();
+
+    const int numWaitingPushers = d_numWaitingPushers;
+    if (numWaitingPushers) {
+        d_pushControlSema.post(numWaitingPushers);
+    }
+}
+
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::enable()
+{
+    d_impl.enable();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::capacity() const
+{
+    return static_cast<int>(d_impl.capacity());
+}
+
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isEmpty() const
+{
+    return 0 >= numElements();
+}
+
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isEnabled() const
+{
+    return d_impl.isEnabled();
+}
+
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isFull() const
+{
+    return capacity() <= numElements();
+}
+
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::numElements() const
+{
+    return static_cast<int>(d_impl.length());
+}
+
+                        // ---------------------------
+                        // class BoundedQueue_PopGuard
+                        // ---------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+BoundedQueue_PopGuard<VALUE>::BoundedQueue_PopGuard(
+                                              BoundedQueue<VALUE> *queue,
+                                              unsigned int         generation,
+                                              unsigned int         index,
+                                              int                  numItems)
+: d_parent_p(queue)
+, d_generation(generation)
+, d_index(index)
+, d_numItems(numItems)
+{
+}
+
+template <class VALUE>
+BoundedQueue_PopGuard<VALUE>::~BoundedQueue_PopGuard()
+{
+    // This popping thread currently has the range of cells starting at
+    // 'd_index' (in 'd_generation') reserved for popping.  Destroy the
+    // elements in that range and then release the reservation.  Wake up to
+    // 'd_numItems' waiting pusher threads.
+
+    unsigned int generation = d_generation;
+    unsigned int index      = d_index;
+    for (int i = 0; i < d_numItems; ++i) {
+        bslalg::ScalarDestructionPrimitives::destroy(
+                                               d_parent_p->d_elements + index);
+        d_parent_p->d_impl.nextIndex(&generation, &index);
+    }
+
+    if (1 == d_numItems) {
+        d_parent_p->d_impl.commitPopIndex(d_generation, d_index);
+    }
+    else {
+        d_parent_p->d_impl.commitPopIndices(d_generation,
+                                            d_index,
+                                            d_numItems);
+    }
+
+    d_parent_p->wakePushers(d_numItems);
+}
+
+                       // ------------------------------
+                       // class BoundedQueue_PushProctor
+                       // ------------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+BoundedQueue_PushProctor<VALUE>::BoundedQueue_PushProctor(
+                                           BoundedQueue<VALUE> *queue,
+                                           unsigned int         generation,
+                                           unsigned int         index,
+                                           int                  numReserved)
+: d_parent_p(queue)
+, d_generation(generation)
+, d_index(index)
+, d_numReserved(numReserved)
+, d_numConstructed(0)
+{
+}
+
+template <class VALUE>
+BoundedQueue_PushProctor<VALUE>::~BoundedQueue_PushProctor()
+{
+    if (d_parent_p) {
+        FixedQueueIndexManager& impl = d_parent_p->d_impl;
+
+        // Destroy the elements this thread already constructed in its
+        // reserved cells (those cells are 'e_WRITING', and will not be
+        // disposed of by 'reservePopIndexForClear').
+
+        unsigned int generation = d_generation;
+        unsigned int index      = d_index;
+        for (int i = 0; i < d_numConstructed; ++i) {
+            bslalg::ScalarDestructionPrimitives::destroy(
+                                               d_parent_p->d_elements + index);
+            impl.nextIndex(&generation, &index);
+        }
+
+        // For each reserved cell, in order, dispose of all the elements
+        // preceding it and then abandon the reservation.  Abandoning a cell
+        // advances the pop index to the following cell, so only the first
+        // reserved cell can be preceded by elements.
+
+        int poppedItems = d_numReserved;
+
+        generation = d_generation;
+        index      = d_index;
+        for (int i = 0; i < d_numReserved; ++i) {
+            unsigned int disposedGeneration, disposedIndex;
+            while (0 == impl.reservePopIndexForClear(&disposedGeneration,
+                                                     &disposedIndex,
+                                                     generation,
+                                                     index)) {
+                bslalg::ScalarDestructionPrimitives::destroy(
+                                       d_parent_p->d_elements + disposedIndex);
+                ++poppedItems;
+
+                impl.commitPopIndex(disposedGeneration, disposedIndex);
+            }
+
+            impl.abortPushIndexReservation(generation, index);
+            impl.nextIndex(&generation, &index);
+        }
+
+        d_parent_p->wakePushers(poppedItems);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void BoundedQueue_PushProctor<VALUE>::release()
+{
+    d_parent_p = 0;
+}
+
+template <class VALUE>
+inline
+void BoundedQueue_PushProctor<VALUE>::setNumConstructed(int numConstructed)
+{
+    BSLS_ASSERT(numConstructed <= d_numReserved);
+
+    d_numConstructed = numConstructed;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
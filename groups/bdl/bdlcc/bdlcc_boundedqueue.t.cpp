@@ -0,0 +1,1359 @@
+// bdlcc_boundedqueue.t.cpp                                           -*-C++-*-
+#include <bdlcc_boundedqueue.h>
+
+#include <bdlcc_queue.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlt_currenttime.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// 'bdlcc::BoundedQueue' is a thread-enabled queue built on
+// 'bdlcc::FixedQueueIndexManager' (whose lock-free protocol, including the
+// batch reservation methods, is tested in that component's test driver).  This
+// test driver verifies the single-threaded behavior of each manipulator, the
+// blocking and timed behavior of the waiting manipulators, exception safety,
+// and the integrity of the values transferred under concurrent use by multiple
+// producers and consumers mixing single-element and batch operations.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit BoundedQueue(bsl::size_t, bslma::Allocator * = 0);
+// [ 2] ~BoundedQueue();
+//
+// MANIPULATORS
+// [ 2] int pushBack(const TYPE&);
+// [ 4] int timedPushBack(const TYPE&, const bsls::TimeInterval&);
+// [ 2] int tryPushBack(const TYPE&);
+// [ 3] int pushBackBatch(const TYPE *, int);
+// [ 4] int timedPushBackBatch(const TYPE *, int, const TimeInterval&);
+// [ 3] int tryPushBackBatch(const TYPE *, int);
+// [ 2] void popFront(TYPE *);
+// [ 2] TYPE popFront();
+// [ 4] int timedPopFront(TYPE *, const bsls::TimeInterval&);
+// [ 2] int tryPopFront(TYPE *);
+// [ 3] int popFrontBatch(TYPE *, int);
+// [ 4] int timedPopFrontBatch(TYPE *, int, const TimeInterval&);
+// [ 3] int tryPopFrontBatch(TYPE *, int);
+// [ 2] void removeAll();
+// [ 5] void disable();
+// [ 5] void enable();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 5] bool isEnabled() const;
+// [ 2] bool isFull() const;
+// [ 2] int numElements() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 6] CONCERN: exception safety
+// [ 7] CONCERN: concurrent producers and consumers
+// [-1] PERFORMANCE: comparison with 'bdlcc::Queue'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+typedef bdlcc::BoundedQueue<int> Obj;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class ExceptionTester {
+    // This class provides a value-semantic type whose copy constructor and
+    // assignment operator throw, when armed, once a specified number of copies
+    // have been made.
+
+  public:
+    // CLASS DATA
+    static int s_copiesUntilThrow;  // number of copies to allow before
+                                    // throwing; negative to never throw
+
+    // DATA
+    int d_value;
+
+    // CREATORS
+    explicit ExceptionTester(int value = 0)
+    : d_value(value)
+    {
+    }
+
+    ExceptionTester(const ExceptionTester& original)
+    : d_value(original.d_value)
+    {
+        maybeThrow();
+    }
+
+    // MANIPULATORS
+    ExceptionTester& operator=(const ExceptionTester& rhs)
+    {
+        maybeThrow();
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // CLASS METHODS
+    static void maybeThrow()
+    {
+        if (0 == s_copiesUntilThrow) {
+            s_copiesUntilThrow = -1;
+            throw 1;
+        }
+        if (0 < s_copiesUntilThrow) {
+            --s_copiesUntilThrow;
+        }
+    }
+};
+
+int ExceptionTester::s_copiesUntilThrow = -1;
+
+void pushThread(bdlcc::BoundedQueue<int> *queue, int value)
+    // Push the specified 'value' onto the specified 'queue', blocking if
+    // necessary.
+{
+    ASSERTT(0 == queue->pushBack(value));
+}
+
+void delayedPopThread(bdlcc::BoundedQueue<int> *queue, int *value)
+    // Wait for 50 milliseconds, then pop a value from the specified 'queue',
+    // blocking if necessary, and load it into the specified 'value'.
+{
+    bslmt::ThreadUtil::microSleep(50 * 1000);
+    *value = queue->popFront();
+}
+
+void pushBatchThread(bdlcc::BoundedQueue<int> *queue,
+                     int                       numValues,
+                     bsls::AtomicInt          *numPushed)
+    // Push 'numValues' values onto the specified 'queue' with a single call to
+    // 'pushBackBatch', and add the number of values pushed to the specified
+    // 'numPushed'.
+{
+    bsl::vector<int> values(numValues, 7);
+    numPushed->add(queue->pushBackBatch(values.data(), numValues));
+}
+
+namespace CONCURRENCY_TEST {
+
+void producer(bdlcc::BoundedQueue<int> *queue,
+              int                       id,
+              int                       numValues,
+              int                       batchSize,
+              bslmt::Barrier           *barrier)
+    // Push the values 'id * numValues + 1' to '(id + 1) * numValues' onto the
+    // specified 'queue', in batches of the specified 'batchSize' (or one at a
+    // time if 'batchSize' is 1), after waiting on the specified 'barrier'.
+{
+    bsl::vector<int> batch(batchSize);
+    barrier->wait();
+
+    int next = id * numValues + 1;
+    const int end = next + numValues;
+    while (next < end) {
+        if (1 == batchSize) {
+            ASSERTT(0 == queue->pushBack(next));
+            ++next;
+            continue;
+        }
+        const int n = bsl::min(batchSize, end - next);
+        for (int i = 0; i < n; ++i) {
+            batch[i] = next + i;
+        }
+        ASSERTT(n == queue->pushBackBatch(batch.data(), n));
+        next += n;
+    }
+}
+
+void consumer(bdlcc::BoundedQueue<int> *queue,
+              int                       batchSize,
+              bsl::vector<char>        *seen,
+              bsls::AtomicInt          *numSeen,
+              bslmt::Barrier           *barrier)
+    // Pop values from the specified 'queue', in batches of up to the
+    // specified 'batchSize', recording each value in the specified 'seen' and
+    // incrementing the specified 'numSeen', until a 0 value is popped.  The
+    // 0 values terminating the consumers are pushed after every other value,
+    // so any further values in the batch are also 0; push them back for the
+    // other consumers.
+{
+    bsl::vector<int> batch(batchSize);
+    barrier->wait();
+
+    for (;;) {
+        const int n = queue->popFrontBatch(batch.data(), batchSize);
+        ASSERTT(0 < n);
+        ASSERTT(n <= batchSize);
+        for (int i = 0; i < n; ++i) {
+            const int value = batch[i];
+            if (0 == value) {
+                for (int j = i + 1; j < n; ++j) {
+                    ASSERTT(0 == batch[j]);
+                    ASSERTT(0 == queue->pushBack(0));
+                }
+                return;                                               // RETURN
+            }
+            ASSERTT(0 < value);
+            ASSERTT(value < static_cast<int>(seen->size()));
+            ASSERTT(0 == (*seen)[value]);
+            (*seen)[value] = 1;
+            numSeen->add(1);
+        }
+    }
+}
+
+void queueProducer(bdlcc::Queue<int> *queue,
+                   int                numValues,
+                   bslmt::Barrier    *barrier)
+    // Push 'numValues' positive values onto the specified 'queue' after
+    // waiting on the specified 'barrier'.
+{
+    barrier->wait();
+    for (int i = 1; i <= numValues; ++i) {
+        queue->pushBack(i);
+    }
+}
+
+void queueConsumer(bdlcc::Queue<int> *queue, bslmt::Barrier *barrier)
+    // Pop values from the specified 'queue', after waiting on the specified
+    // 'barrier', until a 0 value is popped.
+{
+    barrier->wait();
+    while (0 != queue->popFront()) {
+    }
+}
+
+}  // close namespace CONCURRENCY_TEST
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Batching Consumer
+/// - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::BoundedQueue' is used to pass integers
+// from a producer thread to a consumer thread that processes them in batches.
+//
+// First, we define the consumer, which pops batches of up to 'k_BATCH_SIZE'
+// values from the queue until it reads a negative value, accumulating the sum
+// of the values it reads.  Note that 'popFrontBatch' blocks until at least one
+// value is available:
+//..
+    enum { k_BATCH_SIZE = 16 };
+
+    void myConsumer(bdlcc::BoundedQueue<int> *queue, int *sum)
+    {
+        int buffer[k_BATCH_SIZE];
+        for (;;) {
+            int numPopped = queue->popFrontBatch(buffer, k_BATCH_SIZE);
+            for (int i = 0; i < numPopped; ++i) {
+                if (buffer[i] < 0) {
+                    return;                                           // RETURN
+                }
+                *sum += buffer[i];
+            }
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a queue and start the consumer thread:
+//..
+    bdlcc::BoundedQueue<int> queue(64);
+
+    int                        sum = 0;
+    bslmt::ThreadUtil::Handle  handle;
+    int rc = bslmt::ThreadUtil::create(
+                        &handle,
+                        bdlf::BindUtil::bind(&myConsumer, &queue, &sum));
+    ASSERT(0 == rc);
+//..
+// Next, we produce the values 1 through 1000 in batches of 10 values,
+// followed by a single negative value to terminate the consumer:
+//..
+    for (int i = 0; i < 100; ++i) {
+        int values[10];
+        for (int j = 0; j < 10; ++j) {
+            values[j] = i * 10 + j + 1;
+        }
+        rc = queue.pushBackBatch(values, 10);
+        ASSERT(10 == rc);
+    }
+    rc = queue.pushBack(-1);
+    ASSERT(0 == rc);
+//..
+// Finally, we join the consumer and verify that it saw every value:
+//..
+    bslmt::ThreadUtil::join(handle);
+    ASSERT(500500 == sum);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: concurrent producers and consumers
+        //
+        // Concerns:
+        //: 1 Every value pushed by any producer is popped by exactly one
+        //:   consumer, whether single-element or batch operations are used on
+        //:   either side.
+        //:
+        //: 2 Producers and consumers blocked on a full or empty queue are
+        //:   released when space or values become available.
+        //
+        // Plan:
+        //: 1 For a table of queue capacities, numbers of producers and
+        //:   consumers, and batch sizes, run producers pushing disjoint ranges
+        //:   of values and consumers recording every value popped.  Verify
+        //:   that each value was seen exactly once.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: concurrent producers and consumers
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: concurrent producers and consumers"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        using namespace CONCURRENCY_TEST;
+
+        static const struct {
+            int d_line;
+            int d_capacity;
+            int d_numProducers;
+            int d_pushBatch;
+            int d_numConsumers;
+            int d_popBatch;
+        } DATA[] = {
+            //LINE  CAP  PROD  PBATCH  CONS  CBATCH
+            //----  ---  ----  ------  ----  ------
+            { L_,     1,    1,      1,    1,      1 },
+            { L_,     1,    3,      4,    3,      4 },
+            { L_,     4,    2,      1,    2,      8 },
+            { L_,     4,    2,      8,    2,      1 },
+            { L_,    16,    4,      5,    4,      7 },
+            { L_,    64,    1,     32,    1,     32 },
+            { L_,    64,    4,     16,    2,     64 },
+            { L_,  1024,    4,    100,    4,     10 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int NUM_VALUES = 20000;  // per producer
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE          = DATA[ti].d_line;
+            const int CAPACITY      = DATA[ti].d_capacity;
+            const int NUM_PRODUCERS = DATA[ti].d_numProducers;
+            const int PUSH_BATCH    = DATA[ti].d_pushBatch;
+            const int NUM_CONSUMERS = DATA[ti].d_numConsumers;
+            const int POP_BATCH     = DATA[ti].d_popBatch;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(CAPACITY) P_(NUM_PRODUCERS) P_(PUSH_BATCH)
+                P_(NUM_CONSUMERS) P(POP_BATCH)
+            }
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+            {
+                Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+                bsl::vector<char> seen(NUM_PRODUCERS * NUM_VALUES + 1, 0);
+                bsls::AtomicInt   numSeen(0);
+                bslmt::Barrier    barrier(NUM_PRODUCERS + NUM_CONSUMERS);
+
+                bslmt::ThreadGroup producers, consumers;
+                for (int i = 0; i < NUM_CONSUMERS; ++i) {
+                    consumers.addThread(bdlf::BindUtil::bind(&consumer,
+                                                             &mX,
+                                                             POP_BATCH,
+                                                             &seen,
+                                                             &numSeen,
+                                                             &barrier));
+                }
+                for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(&producer,
+                                                             &mX,
+                                                             i,
+                                                             NUM_VALUES,
+                                                             PUSH_BATCH,
+                                                             &barrier));
+                }
+                producers.joinAll();
+
+                // Terminate each consumer with a 0 value.
+
+                for (int i = 0; i < NUM_CONSUMERS; ++i) {
+                    ASSERTV(LINE, 0 == mX.pushBack(0));
+                }
+                consumers.joinAll();
+
+                ASSERTV(LINE, numSeen, NUM_PRODUCERS * NUM_VALUES == numSeen);
+                for (int v = 1; v <= NUM_PRODUCERS * NUM_VALUES; ++v) {
+                    ASSERTV(LINE, v, 1 == seen[v]);
+                }
+                ASSERTV(LINE, X.isEmpty());
+            }
+            ASSERTV(LINE, 0 == ta.numBytesInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: exception safety
+        //
+        // Concerns:
+        //: 1 If a copy constructor throws during a push (single or batch),
+        //:   the exception propagates, the queue is left empty and usable, and
+        //:   no memory is leaked.
+        //:
+        //: 2 If an assignment operator throws during a pop (single or batch),
+        //:   the exception propagates, the claimed values are removed from the
+        //:   queue, and the queue remains usable.
+        //
+        // Plan:
+        //: 1 Arm 'ExceptionTester' to throw on a chosen copy during each of
+        //:   the push and pop operations, and verify the state of the queue
+        //:   afterwards by running values through it.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: exception safety
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: exception safety" << endl
+                          << "=========================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        typedef bdlcc::BoundedQueue<ExceptionTester> TObj;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tException during 'tryPushBack'." << endl;
+        {
+            TObj mX(4, &ta);  const TObj& X = mX;
+
+            ASSERT(0 == mX.tryPushBack(ExceptionTester(1)));
+            ASSERT(0 == mX.tryPushBack(ExceptionTester(2)));
+
+            ExceptionTester::s_copiesUntilThrow = 0;
+            bool caught = false;
+            try {
+                mX.tryPushBack(ExceptionTester(3));
+            }
+            catch (...) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(X.isEmpty());
+
+            for (int i = 0; i < 10; ++i) {
+                ExceptionTester value;
+                ASSERT(0 == mX.tryPushBack(ExceptionTester(i)));
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(i == value.d_value);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tException during 'tryPushBackBatch'." << endl;
+        for (int throwAt = 0; throwAt < 4; ++throwAt) {
+            TObj mX(8, &ta);  const TObj& X = mX;
+
+            ASSERT(0 == mX.tryPushBack(ExceptionTester(1)));
+            ASSERT(0 == mX.tryPushBack(ExceptionTester(2)));
+
+            ExceptionTester values[4];
+            ExceptionTester::s_copiesUntilThrow = throwAt;
+            bool caught = false;
+            try {
+                mX.tryPushBackBatch(values, 4);
+            }
+            catch (...) {
+                caught = true;
+            }
+            ASSERTV(throwAt, caught);
+            ASSERTV(throwAt, X.numElements(), X.isEmpty());
+
+            for (int i = 0; i < 3; ++i) {
+                ExceptionTester buffer[8];
+                ExceptionTester batch[8];
+                for (int j = 0; j < 8; ++j) {
+                    batch[j].d_value = j;
+                }
+                ASSERTV(throwAt, 8 == mX.tryPushBackBatch(batch, 8));
+                ASSERTV(throwAt, X.isFull());
+                ASSERTV(throwAt, 8 == mX.tryPopFrontBatch(buffer, 8));
+                for (int j = 0; j < 8; ++j) {
+                    ASSERTV(throwAt, j, j == buffer[j].d_value);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tException during 'tryPopFrontBatch'." << endl;
+        for (int throwAt = 0; throwAt < 4; ++throwAt) {
+            TObj mX(8, &ta);  const TObj& X = mX;
+
+            ExceptionTester values[6];
+            for (int i = 0; i < 6; ++i) {
+                values[i].d_value = i;
+            }
+            ASSERT(6 == mX.tryPushBackBatch(values, 6));
+
+            ExceptionTester buffer[4];
+            ExceptionTester::s_copiesUntilThrow = throwAt;
+            bool caught = false;
+            try {
+                mX.tryPopFrontBatch(buffer, 4);
+            }
+            catch (...) {
+                caught = true;
+            }
+            ASSERTV(throwAt, caught);
+
+            // The four claimed values are removed even though not all of them
+            // were copied out.
+
+            ASSERTV(throwAt, X.numElements(), 2 == X.numElements());
+
+            ExceptionTester value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(4 == value.d_value);
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(5 == value.d_value);
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        ExceptionTester::s_copiesUntilThrow = -1;
+#else
+        if (verbose) cout << "\tExceptions are disabled." << endl;
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'disable' AND 'enable'
+        //
+        // Concerns:
+        //: 1 A newly created queue is enabled.
+        //:
+        //: 2 Push methods on a disabled queue fail immediately, and pop
+        //:   methods continue to succeed.
+        //:
+        //: 3 Threads blocked in 'pushBack' and 'pushBackBatch' are released,
+        //:   and fail, when the queue is disabled.
+        //:
+        //: 4 'enable' restores normal operation.
+        //
+        // Plan:
+        //: 1 Exercise the push and pop methods on a disabled queue.  (C-1..2)
+        //:
+        //: 2 Block threads pushing into a full queue, disable the queue, and
+        //:   verify that the threads return.  (C-3)
+        //:
+        //: 3 Enable the queue and push values into it.  (C-4)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   bool isEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'disable' AND 'enable'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+            ASSERT(X.isEnabled());
+
+            ASSERT(0 == mX.pushBack(1));
+
+            mX.disable();
+            ASSERT(!X.isEnabled());
+
+            int values[] = { 2, 3 };
+            ASSERT(0 >  mX.tryPushBack(2));
+            ASSERT(0 != mX.pushBack(2));
+            ASSERT(0 >  mX.timedPushBack(
+                                  2,
+                                  bdlt::CurrentTime::now().addSeconds(10)));
+            ASSERT(0 == mX.tryPushBackBatch(values, 2));
+            ASSERT(0 == mX.pushBackBatch(values, 2));
+            ASSERT(1 == X.numElements());
+
+            int value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(1 == value);
+
+            mX.enable();
+            ASSERT(X.isEnabled());
+            ASSERT(2 == mX.pushBackBatch(values, 2));
+            ASSERT(X.isFull());
+
+            // Block a single-element pusher and a batch pusher on the full
+            // queue, then disable it.
+
+            bsls::AtomicInt numPushed(0);
+
+            bslmt::ThreadGroup threads(&ta);
+            threads.addThread(bdlf::BindUtil::bind(&pushBatchThread,
+                                                   &mX,
+                                                   5,
+                                                   &numPushed));
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+
+            mX.disable();
+            threads.joinAll();
+
+            ASSERTV(numPushed, 0 == numPushed);
+            ASSERT(2 == X.numElements());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING TIMED OPERATIONS
+        //
+        // Concerns:
+        //: 1 'timedPopFront' on an empty queue, and 'timedPushBack' on a full
+        //:   queue, return a positive value once the (absolute) timeout
+        //:   expires, and not before.
+        //:
+        //: 2 The timed methods succeed immediately when possible.
+        //:
+        //: 3 A thread blocked in 'timedPopFront' is released when a value is
+        //:   pushed, and a thread blocked in 'timedPushBack' is released when a
+        //:   value is popped.
+        //:
+        //: 4 The timed batch methods behave as their single-value
+        //:   counterparts, and 'timedPushBackBatch' reports the number of
+        //:   values appended before the timeout expired.
+        //
+        // Plan:
+        //: 1 Time the timed methods against an empty or full queue with a
+        //:   short timeout.  (C-1)
+        //:
+        //: 2 Call the timed methods on a queue that is neither full nor
+        //:   empty.  (C-2)
+        //:
+        //: 3 Release blocked calls from another thread.  (C-3)
+        //:
+        //: 4 Repeat P-1..3 with the timed batch methods, pushing batches
+        //:   larger than the free space of the queue.  (C-4)
+        //
+        // Testing:
+        //   int timedPushBack(const TYPE&, const bsls::TimeInterval&);
+        //   int timedPushBackBatch(const TYPE *, int, const TimeInterval&);
+        //   int timedPopFront(TYPE *, const bsls::TimeInterval&);
+        //   int timedPopFrontBatch(TYPE *, int, const TimeInterval&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TIMED OPERATIONS" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            int value = -1;
+
+            bsls::Stopwatch sw;
+            sw.start();
+            int rc = mX.timedPopFront(
+                                  &value,
+                                  bdlt::CurrentTime::now().addMilliseconds(200));
+            sw.stop();
+            ASSERTV(rc, 0 < rc);
+            ASSERTV(value, -1 == value);
+            ASSERTV(sw.elapsedTime(), sw.elapsedTime() >= 0.15);
+
+            ASSERT(0 == mX.timedPushBack(
+                                  1,
+                                  bdlt::CurrentTime::now().addSeconds(10)));
+            ASSERT(0 == mX.timedPushBack(
+                                  2,
+                                  bdlt::CurrentTime::now().addSeconds(10)));
+            ASSERT(X.isFull());
+
+            sw.reset();
+            sw.start();
+            rc = mX.timedPushBack(
+                                 3,
+                                 bdlt::CurrentTime::now().addMilliseconds(200));
+            sw.stop();
+            ASSERTV(rc, 0 < rc);
+            ASSERTV(sw.elapsedTime(), sw.elapsedTime() >= 0.15);
+            ASSERT(2 == X.numElements());
+
+            ASSERT(0 == mX.timedPopFront(
+                                  &value,
+                                  bdlt::CurrentTime::now().addSeconds(10)));
+            ASSERT(1 == value);
+            ASSERT(0 == mX.timedPopFront(
+                                  &value,
+                                  bdlt::CurrentTime::now().addSeconds(10)));
+            ASSERT(2 == value);
+            ASSERT(X.isEmpty());
+
+            // A blocked 'timedPopFront' is released by a push.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handle,
+                                  bdlf::BindUtil::bind(&pushThread, &mX, 42)));
+            ASSERT(0 == mX.timedPopFront(
+                                  &value,
+                                  bdlt::CurrentTime::now().addSeconds(30)));
+            ASSERT(42 == value);
+            bslmt::ThreadUtil::join(handle);
+
+            // A blocked 'timedPushBack' is released by a pop.
+
+            ASSERT(0 == mX.pushBack(1));
+            ASSERT(0 == mX.pushBack(2));
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handle,
+                                  bdlf::BindUtil::bind(&pushThread, &mX, 3)));
+            bslmt::ThreadUtil::microSleep(50 * 1000);
+            ASSERT(1 == mX.popFront());
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(X.isFull());
+            ASSERT(2 == mX.popFront());
+            ASSERT(3 == mX.popFront());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nTesting timed batch operations." << endl;
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            int buffer[3] = { -1, -1, -1 };
+
+            bsls::Stopwatch sw;
+            sw.start();
+            int rc = mX.timedPopFrontBatch(
+                                buffer,
+                                3,
+                                bdlt::CurrentTime::now().addMilliseconds(200));
+            sw.stop();
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(buffer[0], -1 == buffer[0]);
+            ASSERTV(sw.elapsedTime(), sw.elapsedTime() >= 0.15);
+
+            // Only two of three values fit before the timeout expires.
+
+            const int VALUES[] = { 1, 2, 3 };
+
+            sw.reset();
+            sw.start();
+            rc = mX.timedPushBackBatch(
+                                VALUES,
+                                3,
+                                bdlt::CurrentTime::now().addMilliseconds(200));
+            sw.stop();
+            ASSERTV(rc, 2 == rc);
+            ASSERTV(sw.elapsedTime(), sw.elapsedTime() >= 0.15);
+            ASSERT(X.isFull());
+
+            rc = mX.timedPopFrontBatch(
+                                     buffer,
+                                     3,
+                                     bdlt::CurrentTime::now().addSeconds(10));
+            ASSERTV(rc, 2 == rc);
+            ASSERT(1 == buffer[0]);
+            ASSERT(2 == buffer[1]);
+            ASSERT(X.isEmpty());
+
+            // A blocked 'timedPopFrontBatch' is released by a push.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handle,
+                                  bdlf::BindUtil::bind(&pushThread, &mX, 42)));
+            rc = mX.timedPopFrontBatch(
+                                     buffer,
+                                     3,
+                                     bdlt::CurrentTime::now().addSeconds(30));
+            ASSERTV(rc, 1 == rc);
+            ASSERT(42 == buffer[0]);
+            bslmt::ThreadUtil::join(handle);
+
+            // A blocked 'timedPushBackBatch' is released by a pop.
+
+            int popped = -1;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                       &handle,
+                       bdlf::BindUtil::bind(&delayedPopThread, &mX, &popped)));
+            rc = mX.timedPushBackBatch(
+                                     VALUES,
+                                     3,
+                                     bdlt::CurrentTime::now().addSeconds(30));
+            ASSERTV(rc, 3 == rc);
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(1 == popped);
+            ASSERT(X.isFull());
+            ASSERT(2 == mX.popFront());
+            ASSERT(3 == mX.popFront());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'tryPushBackBatch' pushes values in order until the queue is full
+        //:   and returns the number pushed.
+        //:
+        //: 2 'tryPopFrontBatch' pops up to the requested number of values, in
+        //:   order, and returns the number popped (0 if the queue is empty).
+        //:
+        //: 3 Batches correctly wrap around the end of the underlying buffer.
+        //:
+        //: 4 'pushBackBatch' blocks until every value has been pushed, and
+        //:   'popFrontBatch' blocks until at least one value is available.
+        //:
+        //: 5 Batch operations interoperate with single-element operations.
+        //
+        // Plan:
+        //: 1 For a series of queue capacities and starting offsets, push and
+        //:   pop batches of varying sizes, verifying counts and values.
+        //:   (C-1..3, 5)
+        //:
+        //: 2 Push a batch larger than the capacity from another thread, and
+        //:   drain it with 'popFrontBatch'.  (C-4)
+        //
+        // Testing:
+        //   int pushBackBatch(const TYPE *, int);
+        //   int tryPushBackBatch(const TYPE *, int);
+        //   int popFrontBatch(TYPE *, int);
+        //   int tryPopFrontBatch(TYPE *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH OPERATIONS" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tNon-blocking batches." << endl;
+        for (int capacity = 1; capacity <= 9; ++capacity) {
+            for (int offset = 0; offset < capacity; ++offset) {
+                for (int batch = 1; batch <= capacity + 2; ++batch) {
+                    Obj mX(capacity, &ta);  const Obj& X = mX;
+
+                    // Advance the queue's indices by 'offset'.
+
+                    for (int i = 0; i < offset; ++i) {
+                        int value;
+                        ASSERT(0 == mX.tryPushBack(i));
+                        ASSERT(0 == mX.tryPopFront(&value));
+                    }
+
+                    bsl::vector<int> values(batch);
+                    for (int i = 0; i < batch; ++i) {
+                        values[i] = 100 + i;
+                    }
+
+                    const int EXP_PUSHED = bsl::min(batch, capacity);
+                    int rc = mX.tryPushBackBatch(values.data(), batch);
+                    ASSERTV(capacity, offset, batch, rc, EXP_PUSHED == rc);
+                    ASSERTV(capacity, offset, batch,
+                            EXP_PUSHED == X.numElements());
+
+                    if (batch >= capacity) {
+                        ASSERT(X.isFull());
+                        ASSERT(0 == mX.tryPushBackBatch(values.data(), 1));
+                    }
+
+                    // Pop in batches of two, checking order.
+
+                    bsl::vector<int> buffer(capacity + 2, -1);
+                    int numPopped = 0;
+                    while (numPopped < EXP_PUSHED) {
+                        rc = mX.tryPopFrontBatch(buffer.data() + numPopped,
+                                                 2);
+                        ASSERTV(capacity, offset, batch, rc, 0 < rc);
+                        ASSERTV(capacity, offset, batch, rc, 2 >= rc);
+                        if (0 >= rc) {
+                            break;
+                        }
+                        numPopped += rc;
+                    }
+                    ASSERTV(capacity, offset, batch, numPopped,
+                            EXP_PUSHED == numPopped);
+                    for (int i = 0; i < EXP_PUSHED; ++i) {
+                        ASSERTV(capacity, offset, batch, i,
+                                100 + i == buffer[i]);
+                    }
+                    ASSERT(X.isEmpty());
+                    ASSERT(0 == mX.tryPopFrontBatch(buffer.data(), 2));
+
+                    // Mix single-element and batch operations.
+
+                    ASSERT(0 == mX.tryPushBack(7));
+                    ASSERT(1 == mX.tryPopFrontBatch(buffer.data(), 5));
+                    ASSERT(7 == buffer[0]);
+                    ASSERT(1 == mX.tryPushBackBatch(values.data(), 1));
+                    int value;
+                    ASSERT(0 == mX.tryPopFront(&value));
+                    ASSERT(100 == value);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tBlocking batches." << endl;
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            bsls::AtomicInt numPushed(0);
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                             &handle,
+                             bdlf::BindUtil::bind(&pushBatchThread,
+                                                  &mX,
+                                                  25,
+                                                  &numPushed)));
+
+            int numPopped = 0;
+            int buffer[3];
+            while (numPopped < 25) {
+                int rc = mX.popFrontBatch(buffer, 3);
+                ASSERTV(rc, 0 < rc && rc <= 3);
+                for (int i = 0; i < rc; ++i) {
+                    ASSERT(7 == buffer[i]);
+                }
+                numPopped += rc;
+            }
+            bslmt::ThreadUtil::join(handle);
+            ASSERTV(numPopped, 25 == numPopped);
+            ASSERTV(numPushed, 25 == numPushed);
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SINGLE-ELEMENT OPERATIONS
+        //
+        // Concerns:
+        //: 1 The queue uses the supplied allocator (and the default allocator
+        //:   if none is supplied), and releases all memory on destruction.
+        //:
+        //: 2 Values are popped in the order in which they were pushed, across
+        //:   many generations of the underlying buffer.
+        //:
+        //: 3 'tryPushBack' fails, with a positive value, on a full queue, and
+        //:   'tryPopFront' fails on an empty queue leaving 'value' unchanged.
+        //:
+        //: 4 The accessors reflect the state of the queue.
+        //:
+        //: 5 'removeAll' empties the queue and destroys its elements.
+        //:
+        //: 6 The allocator is propagated to the elements.
+        //
+        // Plan:
+        //: 1 Push and pop values through queues of a range of capacities,
+        //:   checking the accessors at each step.  (C-1..4)
+        //:
+        //: 2 Fill a queue of 'bsl::string' with long strings and call
+        //:   'removeAll'; verify memory use.  (C-5..6)
+        //
+        // Testing:
+        //   explicit BoundedQueue(bsl::size_t, bslma::Allocator * = 0);
+        //   ~BoundedQueue();
+        //   int pushBack(const TYPE&);
+        //   int tryPushBack(const TYPE&);
+        //   void popFront(TYPE *);
+        //   TYPE popFront();
+        //   int tryPopFront(TYPE *);
+        //   void removeAll();
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   int numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SINGLE-ELEMENT OPERATIONS" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int capacity = 1; capacity <= 10; ++capacity) {
+            Obj mX(capacity, &ta);  const Obj& X = mX;
+            ASSERT(0 < ta.numBytesInUse());
+
+            ASSERT(capacity == X.capacity());
+            ASSERT(X.isEmpty());
+            ASSERT(!X.isFull());
+            ASSERT(0 == X.numElements());
+
+            int value = -1;
+            ASSERT(0 != mX.tryPopFront(&value));
+            ASSERT(-1 == value);
+
+            int next    = 0;
+            int expected = 0;
+            for (int generation = 0; generation < 5; ++generation) {
+                for (int i = 0; i < capacity; ++i) {
+                    if (i % 2) {
+                        ASSERT(0 == mX.pushBack(next++));
+                    }
+                    else {
+                        ASSERT(0 == mX.tryPushBack(next++));
+                    }
+                    ASSERTV(capacity, i + 1 == X.numElements());
+                    ASSERT(!X.isEmpty());
+                }
+                ASSERT(X.isFull());
+                ASSERTV(capacity, 0 < mX.tryPushBack(next));
+
+                for (int i = 0; i < capacity; ++i) {
+                    switch (i % 3) {
+                      case 0: {
+                        ASSERT(0 == mX.tryPopFront(&value));
+                      } break;
+                      case 1: {
+                        mX.popFront(&value);
+                      } break;
+                      default: {
+                        value = mX.popFront();
+                      } break;
+                    }
+                    ASSERTV(capacity, expected, value, expected == value);
+                    ++expected;
+                    ASSERT(!X.isFull());
+                }
+                ASSERT(X.isEmpty());
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        {
+            bslma::TestAllocator da(veryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            Obj mX(4);
+            ASSERT(0 <  da.numBytesInUse());
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        {
+            const char *LONG = "a string long enough to require an allocation";
+
+            bdlcc::BoundedQueue<bsl::string> mX(5, &ta);
+            const bsls::Types::Int64 BASE = ta.numBytesInUse();
+
+            for (int i = 0; i < 5; ++i) {
+                ASSERT(0 == mX.tryPushBack(bsl::string(LONG, &ta)));
+            }
+            ASSERT(BASE < ta.numBytesInUse());
+            ASSERT(mX.isFull());
+
+            mX.removeAll();
+            ASSERT(mX.isEmpty());
+            ASSERT(BASE == ta.numBytesInUse());
+
+            ASSERT(0 == mX.tryPushBack(bsl::string(LONG, &ta)));
+            bsl::string value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(LONG == value);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push and pop a few values, singly and in batches.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isEmpty());
+
+            ASSERT(0 == mX.pushBack(1));
+            ASSERT(0 == mX.tryPushBack(2));
+            ASSERT(2 == X.numElements());
+
+            int values[] = { 3, 4, 5 };
+            ASSERT(2 == mX.tryPushBackBatch(values, 3));
+            ASSERT(X.isFull());
+
+            int buffer[4];
+            ASSERT(4 == mX.tryPopFrontBatch(buffer, 4));
+            ASSERT(1 == buffer[0]);
+            ASSERT(2 == buffer[1]);
+            ASSERT(3 == buffer[2]);
+            ASSERT(4 == buffer[3]);
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: comparison with 'bdlcc::Queue'
+        //
+        // Concerns:
+        //: 1 Transferring values through a 'bdlcc::BoundedQueue' under
+        //:   contention is faster than through a 'bdlcc::Queue', and batch
+        //:   consumption is faster still.
+        //
+        // Plan:
+        //: 1 Time a number of producers and consumers transferring a fixed
+        //:   number of values through each queue.  Optionally specify the
+        //:   number of producer and consumer threads as 'argv[2]'.
+        //
+        // Testing:
+        //   PERFORMANCE: comparison with 'bdlcc::Queue'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: comparison with 'bdlcc::Queue'" << endl
+             << "===========================================" << endl;
+
+        using namespace CONCURRENCY_TEST;
+
+        const int NUM_THREADS = argc > 2 ? atoi(argv[2]) : 4;
+        const int NUM_VALUES  = 250000;
+        const int CAPACITY    = 1024;
+
+        const int BATCH_SIZES[] = { 1, 16 };
+
+        for (int b = 0; b < 2; ++b) {
+            const int BATCH = BATCH_SIZES[b];
+
+            Obj                mX(CAPACITY);
+            bsl::vector<char>  seen(NUM_THREADS * NUM_VALUES + 1, 0);
+            bsls::AtomicInt    numSeen(0);
+            bslmt::Barrier     barrier(2 * NUM_THREADS + 1);
+            bslmt::ThreadGroup producers, consumers;
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                consumers.addThread(bdlf::BindUtil::bind(&consumer,
+                                                         &mX,
+                                                         BATCH,
+                                                         &seen,
+                                                         &numSeen,
+                                                         &barrier));
+                producers.addThread(bdlf::BindUtil::bind(&producer,
+                                                         &mX,
+                                                         i,
+                                                         NUM_VALUES,
+                                                         BATCH,
+                                                         &barrier));
+            }
+
+            bsls::Stopwatch sw;
+            sw.start();
+            barrier.wait();
+            producers.joinAll();
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                mX.pushBack(0);
+            }
+            consumers.joinAll();
+            sw.stop();
+
+            cout << "BoundedQueue (batch " << BATCH << "): "
+                 << sw.elapsedTime() << "s" << endl;
+        }
+
+        {
+            bdlcc::Queue<int>  queue(CAPACITY);
+            bslmt::Barrier     barrier(2 * NUM_THREADS + 1);
+            bslmt::ThreadGroup producers, consumers;
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                consumers.addThread(bdlf::BindUtil::bind(&queueConsumer,
+                                                         &queue,
+                                                         &barrier));
+                producers.addThread(bdlf::BindUtil::bind(&queueProducer,
+                                                         &queue,
+                                                         NUM_VALUES,
+                                                         &barrier));
+            }
+
+            bsls::Stopwatch sw;
+            sw.start();
+            barrier.wait();
+            producers.joinAll();
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                queue.pushBack(0);
+            }
+            consumers.joinAll();
+            sw.stop();
+
+            cout << "Queue: " << sw.elapsedTime() << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -493,6 +493,101 @@ void FixedQueueIndexManager::commitPushIndex(unsigned int generation,
     d_states[index] = encodeElementState(generation, e_FULL);
 }
 
+int FixedQueueIndexManager::reservePushIndices(unsigned int *generation,
+                                               unsigned int *index,
+                                               int          *numReserved,
+                                               int           maxNumIndices)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+    BSLS_ASSERT(0 != numReserved);
+    BSLS_ASSERT(0 <  maxNumIndices);
+
+    // Reserve the first cell using the single-index protocol, which also
+    // performs any waiting that may be required.
+
+    int retval = reservePushIndex(generation, index);
+    if (0 != retval) {
+        return retval;                                                // RETURN
+    }
+
+    // Extend the reservation over the subsequent cells.  Claiming the cell
+    // following our last reserved cell is exactly what 'reservePushIndex'
+    // would attempt having loaded a push index referring to that cell, so
+    // other pushing threads observe nothing new: a cell we claim appears to
+    // them to have been reserved by another thread, and they will help
+    // advance the push index beyond it.  We stop at the first cell that
+    // cannot be claimed immediately (rather than spinning), or if the queue
+    // has been disabled.
+
+    unsigned int lastCombinedIndex = *generation
+                                   * static_cast<unsigned int>(d_capacity)
+                                   + *index;
+    int          count             = 1;
+
+    while (count < maxNumIndices) {
+        if (isDisabledFlagSet(d_pushIndex.loadRelaxed())) {
+            break;
+        }
+
+        const unsigned int combinedIndex = nextCombinedIndex(
+                                                            lastCombinedIndex);
+        const unsigned int currGeneration =
+                         static_cast<unsigned int>(combinedIndex / d_capacity);
+        const unsigned int currIndex      =
+                         static_cast<unsigned int>(combinedIndex % d_capacity);
+
+        const int compare = encodeElementState(currGeneration, e_EMPTY);
+        const int swap    = encodeElementState(currGeneration, e_WRITING);
+        if (compare != d_states[currIndex].testAndSwap(compare, swap)) {
+            break;
+        }
+
+        lastCombinedIndex = combinedIndex;
+        ++count;
+    }
+
+    if (1 < count) {
+        // Advance the push index beyond the last reserved cell, unless
+        // another thread has already done so, preserving the disabled flag.
+
+        const unsigned int end = nextCombinedIndex(lastCombinedIndex);
+
+        unsigned int loadedPushIndex = d_pushIndex.loadRelaxed();
+        while (0 < circularDifference(end,
+                                      discardDisabledFlag(loadedPushIndex),
+                                      d_maxCombinedIndex + 1)) {
+            const unsigned int swap =
+                               end | (loadedPushIndex & k_DISABLED_STATE_MASK);
+            const unsigned int was  =
+                             d_pushIndex.testAndSwap(loadedPushIndex, swap);
+            if (was == loadedPushIndex) {
+                break;
+            }
+            loadedPushIndex = was;
+        }
+    }
+
+    *numReserved = count;
+    return 0;
+}
+
+void FixedQueueIndexManager::commitPushIndices(unsigned int generation,
+                                               unsigned int index,
+                                               int          numIndices)
+{
+    BSLS_ASSERT(0 <  numIndices);
+    BSLS_ASSERT(numIndices <= static_cast<int>(d_capacity));
+
+    // Commit the cells in order so that poppers (which may be spinning on the
+    // first of them) can make progress as early as possible.
+
+    for (int i = 0; i < numIndices; ++i) {
+        commitPushIndex(generation, index);
+        nextIndex(&generation, &index);
+    }
+}
+
 int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
                                             unsigned int *index)
 {
@@ -624,6 +719,82 @@ void FixedQueueIndexManager::commitPopIndex(unsigned int generation,
                                          e_EMPTY);
 }
 
+int FixedQueueIndexManager::reservePopIndices(unsigned int *generation,
+                                              unsigned int *index,
+                                              int          *numReserved,
+                                              int           maxNumIndices)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+    BSLS_ASSERT(0 != numReserved);
+    BSLS_ASSERT(0 <  maxNumIndices);
+
+    int retval = reservePopIndex(generation, index);
+    if (0 != retval) {
+        return retval;                                                // RETURN
+    }
+
+    // Extend the reservation over the subsequent full cells (see
+    // 'reservePushIndices').  Poppers that encounter a cell we have claimed
+    // find it 'e_READING' in the current generation, and help advance the pop
+    // index beyond it.
+
+    unsigned int lastCombinedIndex = *generation
+                                   * static_cast<unsigned int>(d_capacity)
+                                   + *index;
+    int          count             = 1;
+
+    while (count < maxNumIndices) {
+        const unsigned int combinedIndex = nextCombinedIndex(
+                                                            lastCombinedIndex);
+        const unsigned int currGeneration =
+                         static_cast<unsigned int>(combinedIndex / d_capacity);
+        const unsigned int currIndex      =
+                         static_cast<unsigned int>(combinedIndex % d_capacity);
+
+        const int compare = encodeElementState(currGeneration, e_FULL);
+        const int swap    = encodeElementState(currGeneration, e_READING);
+        if (compare != d_states[currIndex].testAndSwap(compare, swap)) {
+            break;
+        }
+
+        lastCombinedIndex = combinedIndex;
+        ++count;
+    }
+
+    if (1 < count) {
+        const unsigned int end = nextCombinedIndex(lastCombinedIndex);
+
+        unsigned int loadedPopIndex = d_popIndex.loadRelaxed();
+        while (0 < circularDifference(end,
+                                      loadedPopIndex,
+                                      d_maxCombinedIndex + 1)) {
+            const unsigned int was = d_popIndex.testAndSwap(loadedPopIndex,
+                                                            end);
+            if (was == loadedPopIndex) {
+                break;
+            }
+            loadedPopIndex = was;
+        }
+    }
+
+    *numReserved = count;
+    return 0;
+}
+
+void FixedQueueIndexManager::commitPopIndices(unsigned int generation,
+                                              unsigned int index,
+                                              int          numIndices)
+{
+    BSLS_ASSERT(0 <  numIndices);
+    BSLS_ASSERT(numIndices <= static_cast<int>(d_capacity));
+
+    for (int i = 0; i < numIndices; ++i) {
+        commitPopIndex(generation, index);
+        nextIndex(&generation, &index);
+    }
+}
+
 void FixedQueueIndexManager::disable()
 {
 
@@ -36,6 +36,30 @@ BSLS_IDENT("$Id: $")
 // otherwise, other threads may "spin" indefinitely with severe performance
 // consequences.
 //
+///Reserving Batches of Indices
+///----------------------------
+// 'reservePushIndices' and 'reservePopIndices' allow a client to reserve a
+// range of consecutive cells with a single call.  The first cell is reserved
+// exactly as by 'reservePushIndex' or 'reservePopIndex'; the reservation is
+// then extended, cell by cell, over the cells immediately following it for as
+// long as those cells can be claimed without waiting, and the shared push (or
+// pop) index is advanced past the whole range at once.  A batch reservation
+// therefore never waits on a cell beyond the first one, and may reserve fewer
+// cells than requested.  The reserved range is identified by the generation
+// and index of its first cell and the number of cells reserved; 'nextIndex'
+// can be used to step through the cells of the range, and the range must be
+// released with 'commitPushIndices' or 'commitPopIndices' respectively.
+//
+// Note that, although the shared index is advanced past the range with a
+// single update, each cell of the range is still claimed with its own atomic
+// operation on the state of that cell.  A cell is owned by the thread that
+// swapped its state, the shared indices being merely hints that any thread may
+// advance, which is what allows single-cell and batch reservations to be
+// freely interleaved.  A range therefore cannot be claimed with a single
+// compare-and-swap on the shared index alone (as in queues in which the index
+// is authoritative), and a batch reservation costs one atomic operation per
+// cell, plus one to advance the index.
+//
 ///Thread Safety
 ///-------------
 // 'bdlcc::FixedQueueIndexManager' is fully *thread-safe*, meaning that all
@@ -402,6 +426,33 @@ class FixedQueueIndexManager {
         // 'index' match those returned by a previous successful call to
         // 'reservePushIndex' (that has not previously been committed).
 
+    int reservePushIndices(unsigned int *generation,
+                           unsigned int *index,
+                           int          *numReserved,
+                           int           maxNumIndices);
+        // Reserve at least one, and up to the specified 'maxNumIndices',
+        // consecutive available indices at which to enqueue elements in an
+        // (externally managed) circular buffer; load the specified 'index' and
+        // 'generation' with the index and generation of the first reserved
+        // cell, and load the specified 'numReserved' with the number of
+        // reserved cells.  Return 0 on success, a negative value if the queue
+        // is disabled, and a positive value if the queue is full.  If this
+        // method succeeds, 'commitPushIndices' must be called quickly with the
+        // returned 'generation', 'index', and 'numReserved' values (see
+        // 'reservePushIndex').  If this method fails 'generation', 'index',
+        // and 'numReserved' will be unmodified.  The behavior is undefined
+        // unless '0 < maxNumIndices', and undefined if the current thread is
+        // already holding a reservation on either a push or pop index.
+
+    void commitPushIndices(unsigned int generation,
+                           unsigned int index,
+                           int          numIndices);
+        // Mark the specified 'numIndices' consecutive cells starting at the
+        // specified 'index' in the specified 'generation' as occupied (full).
+        // The behavior is undefined unless 'generation', 'index', and
+        // 'numIndices' match those returned by a previous successful call to
+        // 'reservePushIndices' (that has not previously been committed).
+
                          // Popping Elements
 
     int reservePopIndex(unsigned int *generation, unsigned int *index);
@@ -429,6 +480,34 @@ class FixedQueueIndexManager {
         // successful call to 'reservePopIndex' (that has not previously been
         // committed).
 
+    int reservePopIndices(unsigned int *generation,
+                          unsigned int *index,
+                          int          *numReserved,
+                          int           maxNumIndices);
+        // Reserve at least one, and up to the specified 'maxNumIndices',
+        // consecutive indices from which to dequeue elements from an
+        // (externally managed) circular buffer; load the specified 'index' and
+        // 'generation' with the index and generation of the first reserved
+        // cell, and load the specified 'numReserved' with the number of
+        // reserved cells.  Return 0 on success, and a non-zero value if the
+        // queue is empty.  If this method succeeds, 'commitPopIndices' must be
+        // called quickly with the returned 'generation', 'index', and
+        // 'numReserved' values (see 'reservePopIndex').  If this method fails
+        // 'generation', 'index', and 'numReserved' will be unmodified.  The
+        // behavior is undefined unless '0 < maxNumIndices', and undefined if
+        // the current thread is already holding a reservation on either a
+        // push or pop index.
+
+    void commitPopIndices(unsigned int generation,
+                          unsigned int index,
+                          int          numIndices);
+        // Mark the specified 'numIndices' consecutive cells starting at the
+        // specified 'index' in the specified 'generation' as available
+        // (empty) in their subsequent generations.  The behavior is undefined
+        // unless 'generation', 'index', and 'numIndices' match those returned
+        // by a previous successful call to 'reservePopIndices' (that has not
+        // previously been committed).
+
                                 // Disabled State
 
     void disable();
@@ -483,6 +562,14 @@ class FixedQueueIndexManager {
     bsl::size_t capacity() const;
         // Return the maximum number of items that may be stored in the queue.
 
+    void nextIndex(unsigned int *generation, unsigned int *index) const;
+        // Load into the specified 'generation' and 'index' the generation and
+        // index of the cell that follows, in the circular buffer, the cell
+        // identified by their current values.  The behavior is undefined
+        // unless 'generation' and 'index' refer to a valid cell.  Note that
+        // this method is provided to iterate over the cells of a range
+        // reserved by 'reservePushIndices' or 'reservePopIndices'.
+
     bsl::ostream& print(bsl::ostream& stream) const;
         // Print a formatted string describing the current state of this object
         // to the specified 'stream'.  If 'stream' is not valid on entry, this
@@ -533,6 +620,16 @@ bsl::size_t FixedQueueIndexManager::capacity() const
     return d_capacity;
 }
 
+inline
+void FixedQueueIndexManager::nextIndex(unsigned int *generation,
+                                       unsigned int *index) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_capacity == ++*index)) {
+        *index      = 0;
+        *generation = nextGeneration(*generation);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
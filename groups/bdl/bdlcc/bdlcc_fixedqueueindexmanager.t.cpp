@@ -92,6 +92,10 @@ using namespace bsl;
 // [ 3] void commitPopIndex(unsigned int , unsigned int );
 // [ 6] int reservePopIndexForClear(unsigned *,unsigned *,unsigned,unsigned);
 // [ 7] void abortPushIndexReservation(unsigned int, unsigned int);
+// [13] int reservePushIndices(unsigned *, unsigned *, int *, int);
+// [13] void commitPushIndices(unsigned int, unsigned int, int);
+// [13] int reservePopIndices(unsigned *, unsigned *, int *, int);
+// [13] void commitPopIndices(unsigned int, unsigned int, int);
 // [ 5] void disable();
 // [ 5] void enable();
 // [ 7] void abortPushIndexReservation(unsigned int, unsigned int);
@@ -99,10 +103,11 @@ using namespace bsl;
 // [ 5] bool isEnabled() const;
 // [ 3] unsigned int length() const;
 // [ 2] unsigned int capacity() const;
+// [13] void nextIndex(unsigned int *, unsigned int *) const;
 // [10] bsl::ostream& print(bsl::ostream& ) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 4] CONCERN: 'gg' generator and 'dirtyGG' generator
 // [11] CONCERN: Thread-Safety (concurrent access does not corrupt state)
 // [12] CONCERN: maxCombinedIndex
@@ -821,6 +826,90 @@ void exceptionThread(Obj                    *x,
     }
 }
 
+void batchWriterThread(Obj                    *x,
+                       TestThreadStateBarrier *testState,
+                       int                     delayPeriod)
+    // Simulate a client pushing batches of elements into the specified 'x'
+    // test object, using the specified 'testState' to determine the current
+    // state of the test (running, paused, exiting), and periodically inserting
+    // delays using the specified 'delayPeriod'.
+{
+    const bsl::size_t CAPACITY = x->capacity();
+
+    int seed = 0;
+
+    testState->blockUntilStateChange();
+
+    for (;;) {
+        TestThreadStateBarrier::State state = testState->state();
+        if (state == TestThreadStateBarrier::e_EXIT) {
+            return;                                                   // RETURN
+        }
+        else if (state == TestThreadStateBarrier::e_WAIT) {
+            testState->blockUntilStateChange();
+            continue;
+        }
+        bsl::size_t length = x->length();
+        ASSERTV(length, length <= CAPACITY);
+
+        unsigned int generation, index;
+        int          numReserved;
+        const int    maxNum = 1 + bdlb::Random::generate15(&seed) % 8;
+        int rc = x->reservePushIndices(&generation,
+                                       &index,
+                                       &numReserved,
+                                       maxNum);
+        performDelay(delayPeriod);
+        if (0 == rc) {
+            ASSERTV(numReserved, maxNum, 0 < numReserved);
+            ASSERTV(numReserved, maxNum, numReserved <= maxNum);
+            x->commitPushIndices(generation, index, numReserved);
+        }
+    }
+}
+
+void batchReaderThread(Obj                    *x,
+                       TestThreadStateBarrier *testState,
+                       int                     delayPeriod)
+    // Simulate a client popping batches of elements from the specified 'x'
+    // test object, using the specified 'testState' to determine the current
+    // state of the test (running, paused, exiting), and periodically inserting
+    // delays using the specified 'delayPeriod'.
+{
+    const bsl::size_t CAPACITY = x->capacity();
+
+    int seed = 1;
+
+    testState->blockUntilStateChange();
+
+    for (;;) {
+        TestThreadStateBarrier::State state = testState->state();
+        if (state == TestThreadStateBarrier::e_EXIT) {
+            return;                                                   // RETURN
+        }
+        else if (state == TestThreadStateBarrier::e_WAIT) {
+            testState->blockUntilStateChange();
+            continue;
+        }
+        bsl::size_t length = x->length();
+        ASSERTV(length, length <= CAPACITY);
+
+        unsigned int generation, index;
+        int          numReserved;
+        const int    maxNum = 1 + bdlb::Random::generate15(&seed) % 8;
+        int rc = x->reservePopIndices(&generation,
+                                      &index,
+                                      &numReserved,
+                                      maxNum);
+        performDelay(delayPeriod);
+        if (0 == rc) {
+            ASSERTV(numReserved, maxNum, 0 < numReserved);
+            ASSERTV(numReserved, maxNum, numReserved <= maxNum);
+            x->commitPopIndices(generation, index, numReserved);
+        }
+    }
+}
+
 void assertValidState(Obj *x)
     // Use 'ASSERT' to verify the properties of the specified 'x' test object.
 {
@@ -982,7 +1071,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1021,6 +1110,288 @@ int main(int argc, char *argv[])
     ASSERT(1 == result);
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING: batch reservation
+        //
+        // Concerns:
+        //:  1 'reservePushIndices' reserves the first available cell and
+        //:    extends the reservation over the following empty cells, up to
+        //:    the requested maximum, and advances the push index beyond the
+        //:    reserved range.
+        //:
+        //:  2 'reservePopIndices' reserves the first full cell and extends the
+        //:    reservation over the following full cells, up to the requested
+        //:    maximum, and advances the pop index beyond the reserved range.
+        //:
+        //:  3 A batch reservation correctly wraps around the end of the
+        //:    circular buffer (incrementing the generation), and 'nextIndex'
+        //:    iterates over the cells of a reserved range.
+        //:
+        //:  4 Batch reservations fail, leaving their arguments unmodified, if
+        //:    the queue is full, empty, or disabled, as appropriate.
+        //:
+        //:  5 Concurrent use of the batch and single-cell manipulators does
+        //:    not corrupt the state of the buffer.
+        //
+        // Plan:
+        //:  1 For a table of queue states (generated with 'gg'), reserve a
+        //:    batch of push and pop indices, verify the number of cells
+        //:    reserved, the first cell reserved, and the resulting length of
+        //:    the queue.  (C-1..4)
+        //:
+        //:  2 Run batch and single-cell reader and writer threads, along with
+        //:    an exception thread, against a shared index manager, and
+        //:    periodically verify its state with 'assertValidState'.  (C-5)
+        //
+        // Testing:
+        //   int reservePushIndices(unsigned *, unsigned *, int *, int);
+        //   void commitPushIndices(unsigned int, unsigned int, int);
+        //   int reservePopIndices(unsigned *, unsigned *, int *, int);
+        //   void commitPopIndices(unsigned int, unsigned int, int);
+        //   void nextIndex(unsigned int *, unsigned int *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: batch reservation" << endl
+                          << "==========================" << endl;
+
+        if (verbose) cout << "\tTest 'nextIndex'." << endl;
+        {
+            Obj x(3);  const Obj& X = x;
+            FixedQueueState state(&X);
+
+            unsigned int generation = 0, index = 0;
+            X.nextIndex(&generation, &index);
+            ASSERT(0 == generation);  ASSERT(1 == index);
+            X.nextIndex(&generation, &index);
+            ASSERT(0 == generation);  ASSERT(2 == index);
+            X.nextIndex(&generation, &index);
+            ASSERT(1 == generation);  ASSERT(0 == index);
+
+            generation = state.maxGeneration();
+            index      = 2;
+            X.nextIndex(&generation, &index);
+            ASSERT(0 == generation);  ASSERT(0 == index);
+        }
+
+        if (verbose) cout << "\tSingle threaded batch reservation." << endl;
+        {
+            struct {
+                int d_line;
+                int d_capacity;        // queue capacity
+                int d_pushCombined;    // initial push combined index
+                int d_popCombined;     // initial pop combined index
+                int d_maxNum;          // maximum number to reserve
+                int d_expPush;         // expected number of push reservations
+                int d_expPop;          // expected number of pop reservations
+            } DATA[] = {
+                //          initial state    batch     expected
+                //         -------------- ---------  ----------
+                // Line Cap Push      Pop   MaxNum    Push  Pop
+                // ---- --- ----      ---   ------    ----  ---
+                {  L_,   1,    0,       0,      1,      1,   1 },
+                {  L_,   1,    0,       0,      5,      1,   1 },
+                {  L_,   1,    1,       1,      5,      1,   1 },
+                {  L_,   1,    1,       0,      5,      0,   1 },
+                {  L_,   4,    0,       0,      2,      2,   2 },
+                {  L_,   4,    0,       0,      4,      4,   4 },
+                {  L_,   4,    0,       0,      9,      4,   4 },
+                {  L_,   4,    2,       0,      9,      2,   4 },
+                {  L_,   4,    4,       0,      9,      0,   4 },
+                {  L_,   4,    3,       2,      9,      3,   4 },
+                {  L_,   4,    6,       5,      2,      2,   2 },
+                {  L_,   4,    7,       5,      9,      2,   4 },
+                {  L_,   7,    9,       5,      3,      3,   3 },
+                {  L_,   7,   12,       5,      9,      0,   7 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int          LINE     = DATA[i].d_line;
+                const int          CAPACITY = DATA[i].d_capacity;
+                const unsigned int PUSH     = DATA[i].d_pushCombined;
+                const unsigned int POP      = DATA[i].d_popCombined;
+                const int          MAX_NUM  = DATA[i].d_maxNum;
+                const int          EXP_PUSH = DATA[i].d_expPush;
+                const int          EXP_POP  = DATA[i].d_expPop;
+
+                if (veryVerbose) {
+                    T_ P_(LINE) P_(CAPACITY) P_(PUSH) P_(POP) P(MAX_NUM)
+                }
+
+                Obj x(CAPACITY);  const Obj& X = x;
+                gg(&x, PUSH, POP);
+
+                const unsigned int INITIAL_LENGTH = PUSH - POP;
+                ASSERTV(LINE, INITIAL_LENGTH == X.length());
+
+                unsigned int generation = 99, index = 99;
+                int          numReserved = 99;
+
+                int rc = x.reservePushIndices(&generation,
+                                              &index,
+                                              &numReserved,
+                                              MAX_NUM);
+                if (0 == EXP_PUSH) {
+                    ASSERTV(LINE, rc, 0 < rc);
+                    ASSERTV(LINE, 99 == generation);
+                    ASSERTV(LINE, 99 == index);
+                    ASSERTV(LINE, 99 == numReserved);
+                }
+                else {
+                    ASSERTV(LINE, rc, 0 == rc);
+                    ASSERTV(LINE, numReserved, EXP_PUSH == numReserved);
+                    ASSERTV(LINE, generation, PUSH / CAPACITY == generation);
+                    ASSERTV(LINE, index, PUSH % CAPACITY == index);
+                    ASSERTV(LINE, X.length(),
+                            INITIAL_LENGTH + EXP_PUSH == X.length());
+
+                    // Every cell in the range should be 'e_WRITING'.
+
+                    FixedQueueState state(&X);
+                    unsigned int g = generation, idx = index;
+                    for (int j = 0; j < numReserved; ++j) {
+                        ASSERTV(LINE, j, e_WRITING == state.elementState(idx));
+                        ASSERTV(LINE, j, g == state.elementGeneration(idx));
+                        X.nextIndex(&g, &idx);
+                    }
+                    x.commitPushIndices(generation, index, numReserved);
+                }
+
+                const unsigned int LENGTH = X.length();
+
+                generation  = 99;
+                index       = 99;
+                numReserved = 99;
+
+                rc = x.reservePopIndices(&generation,
+                                         &index,
+                                         &numReserved,
+                                         MAX_NUM);
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, numReserved, EXP_POP == numReserved);
+                ASSERTV(LINE, generation, POP / CAPACITY == generation);
+                ASSERTV(LINE, index, POP % CAPACITY == index);
+                ASSERTV(LINE, X.length(), LENGTH - EXP_POP == X.length());
+
+                x.commitPopIndices(generation, index, numReserved);
+                assertValidState(&x);
+            }
+        }
+
+        if (verbose) cout << "\tEmpty and disabled queues." << endl;
+        {
+            Obj x(4);  const Obj& X = x;
+
+            unsigned int generation = 99, index = 99;
+            int          numReserved = 99;
+
+            ASSERT(0 != x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            4));
+            ASSERT(99 == generation && 99 == index && 99 == numReserved);
+
+            x.disable();
+            ASSERT(0 > x.reservePushIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            4));
+            ASSERT(99 == generation && 99 == index && 99 == numReserved);
+
+            x.enable();
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             4));
+            ASSERT(4 == numReserved);
+            ASSERT(4 == X.length());
+            x.commitPushIndices(generation, index, numReserved);
+        }
+
+        if (verbose) cout << "\tConcurrent batch reservation." << endl;
+        {
+            const int NUM_PROBES = 10;
+            const int CAPACITIES[] = { 1, 4, 15 };
+            const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+            for (int i = 0; i < NUM_CAPACITIES; ++i) {
+                const int CAPACITY    = CAPACITIES[i];
+                const int NUM_THREADS = 9;
+
+                TestThreadStateBarrier state(NUM_THREADS);
+                Obj x(CAPACITY);  const Obj& X = x;
+
+                bsl::vector<bslmt::ThreadUtil::Handle> handles;
+                handles.resize(NUM_THREADS);
+
+                for (int t = 0; t < NUM_THREADS; ++t) {
+                    int rc;
+                    switch (t % 5) {
+                      case 0: {
+                        rc = bslmt::ThreadUtil::create(
+                              &handles[t],
+                              bdlf::BindUtil::bind(&batchWriterThread,
+                                                   &x,
+                                                   &state,
+                                                   0));
+                      } break;
+                      case 1: {
+                        rc = bslmt::ThreadUtil::create(
+                              &handles[t],
+                              bdlf::BindUtil::bind(&batchReaderThread,
+                                                   &x,
+                                                   &state,
+                                                   0));
+                      } break;
+                      case 2: {
+                        rc = bslmt::ThreadUtil::create(
+                              &handles[t],
+                              bdlf::BindUtil::bind(&writerThread,
+                                                   &x,
+                                                   &state,
+                                                   0));
+                      } break;
+                      case 3: {
+                        rc = bslmt::ThreadUtil::create(
+                              &handles[t],
+                              bdlf::BindUtil::bind(&readerThread,
+                                                   &x,
+                                                   &state,
+                                                   0));
+                      } break;
+                      default: {
+                        rc = bslmt::ThreadUtil::create(
+                              &handles[t],
+                              bdlf::BindUtil::bind(&exceptionThread,
+                                                   &x,
+                                                   &state,
+                                                   0));
+                      } break;
+                    }
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+
+                state.continueTest();
+
+                for (int j = 0; j < NUM_PROBES; ++j) {
+                    bslmt::ThreadUtil::microSleep(50 * 1000);
+                    state.suspendTest();
+                    assertValidState(&x);
+                    if (veryVeryVerbose) {
+                        P(X);
+                    }
+                    state.continueTest();
+                }
+                state.exitTest();
+
+                for (int t = 0; t < NUM_THREADS; ++t) {
+                    bslmt::ThreadUtil::join(handles[t]);
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // CONCERN: maxCombinedIndex
@@ -0,0 +1,1250 @@
+// bdlcc_shardedtimequeue.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDTIMEQUEUE
+#define INCLUDED_BDLCC_SHARDEDTIMEQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a time queue partitioned into independently-locked shards.
+//
+//@CLASSES:
+//  bdlcc::ShardedTimeQueue: sharded, thread-safe time queue
+//
+//@SEE_ALSO: bdlcc_timequeue
+//
+//@DESCRIPTION: This component provides a thread-safe container,
+// 'bdlcc::ShardedTimeQueue', of items each associated with a time value, that
+// offers the interface of 'bdlcc::TimeQueue' (and uses the same
+// 'bdlcc::TimeQueueItem' type to return items), but that distributes its items
+// among a number of independently-locked sub-queues ("shards").
+// 'bdlcc::TimeQueue' protects all of its state with a single mutex, so that
+// threads adding, removing, and updating unrelated items all serialize on that
+// mutex.  In a 'bdlcc::ShardedTimeQueue', these operations lock only the shard
+// holding the item, so threads working on items of different shards do not
+// contend.
+//
+// The number of shards is a power of two that is specified at construction
+// (8 by default).  An item is added to a shard selected by hashing the
+// identifier of the calling thread, so that each thread tends to work with
+// its own shard, and the index of that shard is encoded in the low-order bits
+// of the handle returned for the item, so that 'remove', 'update', and
+// 'isRegisteredHandle' go directly to the shard of the item.  If the selected
+// shard is full, the other shards are tried in turn.
+//
+// Operations that need the lowest items of the whole queue, 'popFront',
+// 'popLE', and 'removeAll', lock every shard (always in the same order) and
+// merge the shards in a single pass: each item is taken from the shard whose
+// front item has the lowest time value, so that the items are removed in time
+// order across the whole queue, and 'popLE' with a 'maxTimers' argument
+// removes exactly the lowest items, as for 'bdlcc::TimeQueue'.  The shards are
+// locked only for the duration of the pass, which is proportional to the
+// number of items removed (and to the number of shards).
+//
+///'bdlcc::ShardedTimeQueue::Handle' Uniqueness, Reuse and 'numIndexBits'
+///----------------------------------------------------------------------
+// A 'bdlcc::ShardedTimeQueue::Handle' is a 32-bit integer whose low-order
+// 'numIndexBits' bits (the index section) identify a node, exactly as for
+// 'bdlcc::TimeQueue' (see "'bdlcc::TimeQueue::Handle' Uniqueness, Reuse and
+// 'numIndexBits'" in 'bdlcc_timequeue').  The lowest 'log2(numShards)' bits of
+// the index section hold the index of the shard of the node, and the remaining
+// bits of the index section hold the index of the node within its shard.  Up
+// to '2 ** (numIndexBits - log2(numShards)) - 2' nodes can therefore exist in
+// a given shard.  The higher-order bits of the handle hold an iteration count
+// that is changed every time a node is freed, as for 'bdlcc::TimeQueue'.
+//
+///Thread Safety
+///- - - - - - -
+// It is safe to access or modify two distinct 'bdlcc::ShardedTimeQueue'
+// objects simultaneously, each from a separate thread.  It is safe to access
+// or modify a single 'bdlcc::ShardedTimeQueue' object simultaneously from two
+// or more separate threads.
+//
+// The values loaded into the 'isNewTop', 'newLength', and 'newMinTime'
+// arguments of 'add', 'remove', and 'update' are computed by examining the
+// other shards after the shard of the item has been modified, and are
+// therefore only snapshots of the state of the queue.  An item whose time
+// equals the lowest time of another shard is reported as the new top, so
+// that concurrently adding several items having the same time to distinct
+// shards reports at least one of them as the new top (at the cost of an
+// occasional spurious report).  The values loaded by 'popFront', 'popLE', and
+// 'removeAll' reflect the state of the queue at the end of the operation.
+//
+// As for 'bdlcc::TimeQueue', there is no guarantee regarding the safety of
+// enqueuing objects whose copy constructors or assignment operators may modify
+// or even merely access the same 'bdlcc::ShardedTimeQueue' object (except
+// 'length').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Dispatching Timers Added From Several Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, several worker threads schedule timeouts, identified by
+// integers, in a shared 'bdlcc::ShardedTimeQueue', and a dispatcher thread
+// periodically processes the timeouts that are due, a bounded number at a
+// time.
+//
+// First, we define the queue and a function, run by each worker thread, that
+// adds timeouts to the queue, and cancels every other one of them:
+//..
+//  bdlcc::ShardedTimeQueue<int> timeouts(4);
+//
+//  void scheduleTimeouts(int base)
+//  {
+//      bsls::TimeInterval now = bdlt::CurrentTime::now();
+//
+//      for (int i = 0; i < 100; ++i) {
+//          bsls::TimeInterval timeout = now + bsls::TimeInterval(0, i * 10);
+//          bdlcc::ShardedTimeQueue<int>::Handle handle =
+//                                            timeouts.add(timeout, base + i);
+//          if (i % 2) {
+//              timeouts.remove(handle);
+//          }
+//      }
+//  }
+//..
+// Notice that adding and cancelling timeouts from different worker threads
+// typically locks different shards.
+//
+// Then, we start the workers, and wait for them to complete:
+//..
+//  bslmt::ThreadGroup workers;
+//  for (int i = 0; i < 4; ++i) {
+//      workers.addThread(bdlf::BindUtil::bind(&scheduleTimeouts, i * 1000));
+//  }
+//  workers.joinAll();
+//
+//  assert(200 == timeouts.length());
+//..
+// Finally, the dispatcher removes all the timeouts that are due, at most 64 at
+// a time, in the order of their times, regardless of the shards holding them:
+//..
+//  bsl::vector<bdlcc::TimeQueueItem<int> > expired;
+//
+//  bsls::TimeInterval deadline = bdlt::CurrentTime::now()
+//                              + bsls::TimeInterval(1, 0);
+//  int                remaining = 1;
+//  while (remaining) {
+//      expired.clear();
+//      timeouts.popLE(deadline, 64, &expired, &remaining);
+//
+//      assert(0 < expired.size() && expired.size() <= 64);
+//      for (bsl::size_t i = 1; i < expired.size(); ++i) {
+//          assert(expired[i - 1].time() <= expired[i].time());
+//      }
+//  }
+//  assert(0 == timeouts.length());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLCC_TIMEQUEUE
+#include <bdlcc_timequeue.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_LOCKGUARD
+#include <bslmt_lockguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_LIMITS
+#include <bsl_limits.h>
+#endif
+
+#ifndef INCLUDED_BSL_MAP
+#include <bsl_map.h>
+#endif
+
+#ifndef INCLUDED_BSL_NEW
+#include <bsl_new.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                           // ======================
+                           // class ShardedTimeQueue
+                           // ======================
+
+template <class DATA>
+class ShardedTimeQueue {
+    // This parameterized class provides the interface of 'TimeQueue<DATA>'
+    // over a fixed number of independently-locked shards, each of which is a
+    // time-ordered queue of items.  Operations on a single item lock only the
+    // shard of the item; operations removing the lowest items of the queue
+    // lock all the shards and merge them.
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_INDEX_BITS_MIN     = 8,
+        k_NUM_INDEX_BITS_MAX     = 24,
+        k_NUM_INDEX_BITS_DEFAULT = 17,
+        k_NUM_SHARDS_DEFAULT     = 8,
+        k_CACHE_LINE_SIZE        = bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+  public:
+    // TYPES
+    typedef typename TimeQueue<DATA>::Handle Handle;
+        // 'Handle' defines an alias for uniquely identifying a valid node in
+        // the time queue.  See the component-level documentation for more
+        // details.
+
+    typedef typename TimeQueue<DATA>::Key    Key;
+        // 'Key' defines an alias for the type supplied by clients to uniquely
+        // identify an item in the queue.
+
+  private:
+    // PRIVATE TYPES
+    struct Node {
+        // This struct provides the node of the doubly-linked circular list of
+        // items of a shard that have the same time value.  Nodes that are not
+        // in a list are linked, using 'd_next_p', in the singly-linked free
+        // list of their shard.
+
+        int                       d_index;
+        bsls::TimeInterval        d_time;
+        Key                       d_key;
+        Node                     *d_prev_p;
+        Node                     *d_next_p;
+        bsls::ObjectBuffer<DATA>  d_data;
+
+        // CREATORS
+        Node()
+        : d_index(0)
+        , d_key(0)
+        , d_prev_p(0)
+        , d_next_p(0)
+            // Create a 'Node' having a time value of 0.
+        {
+        }
+    };
+
+    typedef bsl::map<bsls::TimeInterval, Node *> NodeMap;
+        // Internal typedef for the time index map of a shard.
+
+    typedef typename NodeMap::iterator           MapIter;
+        // Internal typedef for the iterator used to navigate a time index.
+
+    struct Shard {
+        // This struct provides one independently-locked sub-queue, organized
+        // as 'TimeQueue' is: a map of time values, each entry of which holds
+        // a list of the nodes having that time value, and an array of all the
+        // nodes ever allocated by the shard, indexed by handle.  Shards are
+        // separated by a cache line so that threads working on different
+        // shards do not contend.
+
+        char                       d_pad[k_CACHE_LINE_SIZE];
+                                                   // separates this shard
+                                                   // from the previous one
+
+        mutable bslmt::Mutex       d_mutex;        // synchronizes access to
+                                                   // this shard
+
+        bsl::vector<Node *>        d_nodeArray;    // nodes of this shard
+
+        bsls::AtomicPointer<Node>  d_nextFreeNode_p;
+                                                   // head of the free list of
+                                                   // this shard
+
+        NodeMap                    d_map;          // lists of nodes in
+                                                   // increasing time order
+
+        bsls::AtomicInt            d_length;       // number of items in this
+                                                   // shard
+
+        // CREATORS
+        explicit Shard(bslma::Allocator *basicAllocator)
+        : d_nodeArray(basicAllocator)
+        , d_nextFreeNode_p(0)
+        , d_map(basicAllocator)
+        , d_length(0)
+            // Create an empty shard using the specified 'basicAllocator' to
+            // supply memory.
+        {
+        }
+    };
+
+    // DATA
+    const int         d_numShardBits;        // 'log2' of the number of shards
+
+    const int         d_shardMask;           // mask of the shard index in a
+                                             // handle
+
+    const int         d_indexMask;           // mask of the index section of
+                                             // a handle
+
+    const int         d_indexIterationMask;  // mask of the iteration count of
+                                             // a handle
+
+    const int         d_indexIterationInc;   // increment of the iteration
+                                             // count of a handle
+
+    const int         d_maxNodesPerShard;    // maximum number of nodes in a
+                                             // shard
+
+    Shard            *d_shards;              // array of shards (owned)
+
+    bslma::Allocator *d_allocator_p;         // allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    ShardedTimeQueue(const ShardedTimeQueue&);
+    ShardedTimeQueue& operator=(const ShardedTimeQueue&);
+
+    // PRIVATE CLASS METHODS
+    static int log2(int value);
+        // Return the base-2 logarithm of the specified 'value'.  The behavior
+        // is undefined unless 'value' is a positive power of 2.
+
+    // PRIVATE MANIPULATORS
+    void freeNode(Node *node);
+        // Prepare the specified 'node' for being reused on the free list by
+        // incrementing the iteration count.  Set 'd_prev_p' field to 0.  The
+        // behavior is undefined unless the lock of the shard of 'node' is
+        // held.
+
+    void linkNode(Shard *shard, Node *node);
+        // Link the specified 'node', whose time value is set, into the
+        // specified 'shard'.  The behavior is undefined unless the lock of
+        // 'shard' is held.
+
+    void unlinkNode(Shard *shard, MapIter it, Node *node);
+        // Unlink the specified 'node' from the specified 'shard', where the
+        // specified 'it' refers to the entry of the time value of 'node'.  The
+        // behavior is undefined unless the lock of 'shard' is held.
+
+    void lockAll() const;
+        // Acquire the locks of all the shards, in index order.
+
+    void unlockAll() const;
+        // Release the locks of all the shards.
+
+    void popImp(const bsls::TimeInterval          *time,
+                int                                maxTimers,
+                bsl::vector<TimeQueueItem<DATA> > *buffer,
+                int                               *newLength,
+                bsls::TimeInterval                *newMinTime);
+        // Remove from this queue, in increasing time order, up to the
+        // specified 'maxTimers' items having a time value less than or equal
+        // to the specified 'time', or up to 'maxTimers' items of any time
+        // value if 'time' is 0, and append them to the specified 'buffer' if
+        // it is not 0.  Load into the specified 'newLength', if not 0, the
+        // number of items remaining in this queue, and into the specified
+        // 'newMinTime', if not 0, the lowest remaining time value in this
+        // queue if items remain.  Lock all the shards during the removal.
+
+    void putFreeNodeList(Node *begin);
+        // Destroy the 'DATA' of every node in the singly-linked list starting
+        // at the specified 'begin' node and ending with a null pointer, and
+        // return each node to the free list of its shard.  Note that the
+        // caller must not hold the lock of any shard.
+
+    // PRIVATE ACCESSORS
+    Node *findNode(const Shard *shard, Handle handle, const Key& key) const;
+        // Return the node of the specified 'shard' identified by the specified
+        // 'handle' and 'key', or 0 if there is no such item in 'shard'.  The
+        // behavior is undefined unless the lock of 'shard' is held.
+
+    Shard *frontShard() const;
+        // Return the shard holding the lowest time value in this queue, or 0
+        // if this queue is empty.  The behavior is undefined unless the locks
+        // of all the shards are held.
+
+    bool isLowerThanOtherShards(const Shard               *shard,
+                                const bsls::TimeInterval&  time) const;
+        // Return 'true' if every shard other than the specified 'shard' is
+        // either empty or has a lowest time value not less than the specified
+        // 'time', and 'false' otherwise.  The caller must not hold the lock
+        // of any shard.  Note that ties are reported as 'true', so that of
+        // several items having the same time added concurrently to distinct
+        // shards, at least one is reported as the new top.
+
+    Shard *shardOf(Handle handle) const;
+        // Return the shard encoded in the specified 'handle'.
+
+    int threadShardIndex() const;
+        // Return the index of the shard to which the calling thread adds
+        // items.
+
+  public:
+    // CREATORS
+    explicit ShardedTimeQueue(bslma::Allocator *basicAllocator = 0);
+    explicit ShardedTimeQueue(int               numShards,
+                              bslma::Allocator *basicAllocator = 0);
+    ShardedTimeQueue(int               numShards,
+                     int               numIndexBits,
+                     bslma::Allocator *basicAllocator = 0);
+        // Create an empty time queue.  Optionally specify 'numShards', the
+        // number of independently-locked sub-queues of this queue.  If
+        // 'numShards' is not specified a default value of 8 is used.
+        // Optionally specify 'numIndexBits' to configure the number of index
+        // bits used by this object.  If 'numIndexBits' is not specified a
+        // default value of 17 is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'numShards' is a power of 2,
+        // '8 <= numIndexBits <= 24', and
+        // 'numShards <= 2 ** (numIndexBits - 4)'.  See the component-level
+        // documentation for more information regarding 'numIndexBits'.
+
+    ~ShardedTimeQueue();
+        // Destroy this time queue.
+
+    // MANIPULATORS
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               int                       *isNewTop = 0,
+               int                       *newLength = 0);
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               const Key&                 key,
+               int                       *isNewTop = 0,
+               int                       *newLength = 0);
+        // Add a new item to this queue having the specified 'time' value, and
+        // associated 'data'.  Optionally use the specified 'key' to uniquely
+        // identify the item in subsequent calls to 'remove' and 'update'.
+        // Optionally load into the optionally specified 'isNewTop' a non-zero
+        // value if the item is now the lowest item in this queue, and a 0
+        // value otherwise.  If specified, load into the optionally specified
+        // 'newLength', the new number of items in this queue.  Return a value
+        // that may be used to identify the newly added item in future calls to
+        // this time queue on success, and -1 if every shard has reached its
+        // maximum length.
+
+    Handle add(const TimeQueueItem<DATA>&  item,
+               int                        *isNewTop = 0,
+               int                        *newLength = 0);
+        // Add the value of the specified 'item' to this queue.  Optionally
+        // load into the optionally specified 'isNewTop' a non-zero value if
+        // the item is now the lowest element in this queue, and a 0 value
+        // otherwise.  If specified, load into the optionally specified
+        // 'newLength', the new number of elements in this queue.  Return a
+        // value that may be used to identify the newly added element in future
+        // calls to this time queue on success, and -1 if every shard has
+        // reached its maximum length.
+
+    int popFront(TimeQueueItem<DATA> *buffer = 0,
+                 int                 *newLength = 0,
+                 bsls::TimeInterval  *newMinTime = 0);
+        // Atomically remove the top item from this queue, and optionally load
+        // into the optionally specified 'buffer' the time and associated data
+        // of the item removed.  Optionally load into the optionally specified
+        // 'newLength', the number of items remaining in the queue.  Optionally
+        // load into the optionally specified 'newMinTime' the new lowest time
+        // in this queue.  Return 0 on success, and a non-zero value if there
+        // are no items in the queue.
+
+    void popLE(const bsls::TimeInterval&          time,
+               bsl::vector<TimeQueueItem<DATA> > *buffer = 0,
+               int                               *newLength = 0,
+               bsls::TimeInterval                *newMinTime = 0);
+        // Remove from this queue all the items that have a time value less
+        // than or equal to the specified 'time', and optionally append into
+        // the optionally specified 'buffer' a list of the removed items,
+        // ordered by their corresponding time values (top item first).
+        // Optionally load into the optionally specified 'newLength' the number
+        // of items remaining in this queue, and into the optionally specified
+        // 'newMinTime' the lowest remaining time value in this queue.  Note
+        // that 'newMinTime' is only loaded if there are items remaining in the
+        // time queue; therefore, 'newLength' should be specified and examined
+        // to determine whether items remain, and 'newMinTime' used only when
+        // 'newLength' > 0.
+
+    void popLE(const bsls::TimeInterval&          time,
+               int                                maxTimers,
+               bsl::vector<TimeQueueItem<DATA> > *buffer = 0,
+               int                               *newLength = 0,
+               bsls::TimeInterval                *newMinTime = 0);
+        // Remove from this queue, in a single pass over all the shards, up to
+        // the specified 'maxTimers' number of items that have a time value
+        // less than or equal to the specified 'time', and optionally append
+        // into the optionally specified 'buffer' a list of the removed items,
+        // ordered by their corresponding time values (top item first).
+        // Optionally load into the optionally specified 'newLength' the number
+        // of items remaining in this queue, and into the optionally specified
+        // 'newMinTime' the lowest remaining time value in this queue.  The
+        // behavior is undefined unless 'maxTimers' >= 0.  Note that
+        // 'newMinTime' is only loaded if there are items remaining in the time
+        // queue.  Note also that all the items appended into 'buffer' have a
+        // time value less than or equal to the elements remaining in this
+        // queue.
+
+    int remove(Handle               handle,
+               int                 *newLength = 0,
+               bsls::TimeInterval  *newMinTime = 0,
+               TimeQueueItem<DATA> *item = 0);
+    int remove(Handle               handle,
+               const Key&           key,
+               int                 *newLength = 0,
+               bsls::TimeInterval  *newMinTime = 0,
+               TimeQueueItem<DATA> *item = 0);
+        // Remove from this queue the item having the specified 'handle', and
+        // optionally load into the optionally specified 'item' the time and
+        // data values of the recently removed item.  Optionally use the
+        // specified 'key' to uniquely identify the item.  If specified, load
+        // into the optionally specified 'newLength' the number of items
+        // remaining in this queue, and into the optionally specified
+        // 'newMinTime', the resulting lowest time value remaining in the queue
+        // if items remain.  Return 0 on success, and a non-zero value if no
+        // item with the 'handle' exists in the queue.
+
+    void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+        // Remove all the items from this queue.  Optionally specify a 'buffer'
+        // in which to load the removed items.  The resultant items in the
+        // 'buffer' are ordered by increasing time interval.
+
+    int update(Handle                     handle,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop = 0);
+    int update(Handle                     handle,
+               const Key&                 key,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop = 0);
+        // Update the time value of the item having the specified 'handle' to
+        // the specified 'newTime' and optionally load into the optionally
+        // specified 'isNewTop' a non-zero value if the modified item is now
+        // the lowest time value in the time queue or zero otherwise.
+        // Optionally use the specified 'key' to uniquely identify the item.
+        // Return 0 on success, and a non-zero value if there is currently no
+        // item having the 'handle' registered with this time queue.
+
+    // ACCESSORS
+    bool isRegisteredHandle(Handle handle) const;
+    bool isRegisteredHandle(Handle handle, const Key& key) const;
+        // Return 'true' if an item having specified 'handle' (and optionally
+        // specified 'key') is currently registered with this time queue and
+        // false otherwise.
+
+    int length() const;
+        // Return a "snapshot" of the current number of items in this queue.
+
+    int minTime(bsls::TimeInterval *buffer) const;
+        // Load into the specified 'buffer', the time value of the lowest time
+        // in this queue.  Return 0 on success, and a non-zero value if this
+        // queue is empty.
+
+    int numShards() const;
+        // Return the number of shards of this queue.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class ShardedTimeQueue
+                           // ----------------------
+
+// PRIVATE CLASS METHODS
+template <class DATA>
+int ShardedTimeQueue<DATA>::log2(int value)
+{
+    BSLS_ASSERT(0 < value && 0 == (value & (value - 1)));
+
+    int result = 0;
+    while (1 < value) {
+        value >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+inline
+void ShardedTimeQueue<DATA>::freeNode(Node *node)
+{
+    node->d_index = ((node->d_index + d_indexIterationInc) &
+                         d_indexIterationMask) | (node->d_index & d_indexMask);
+
+    if (!(node->d_index & d_indexIterationMask)) {
+        node->d_index += d_indexIterationInc;
+    }
+    node->d_prev_p = 0;
+}
+
+template <class DATA>
+void ShardedTimeQueue<DATA>::linkNode(Shard *shard, Node *node)
+{
+    MapIter it = shard->d_map.find(node->d_time);
+
+    if (shard->d_map.end() == it) {
+        node->d_prev_p = node;
+        node->d_next_p = node;
+        shard->d_map[node->d_time] = node;
+    }
+    else {
+        node->d_prev_p = it->second->d_prev_p;
+        it->second->d_prev_p->d_next_p = node;
+        node->d_next_p = it->second;
+        it->second->d_prev_p = node;
+    }
+}
+
+template <class DATA>
+inline
+void ShardedTimeQueue<DATA>::unlinkNode(Shard *shard, MapIter it, Node *node)
+{
+    if (node->d_next_p != node) {
+        node->d_prev_p->d_next_p = node->d_next_p;
+        node->d_next_p->d_prev_p = node->d_prev_p;
+        if (it->second == node) {
+            it->second = node->d_next_p;
+        }
+    }
+    else {
+        shard->d_map.erase(it);
+    }
+}
+
+template <class DATA>
+void ShardedTimeQueue<DATA>::lockAll() const
+{
+    const int numShards = 1 << d_numShardBits;
+    for (int i = 0; i < numShards; ++i) {
+        d_shards[i].d_mutex.lock();
+    }
+}
+
+template <class DATA>
+void ShardedTimeQueue<DATA>::unlockAll() const
+{
+    const int numShards = 1 << d_numShardBits;
+    for (int i = numShards - 1; i >= 0; --i) {
+        d_shards[i].d_mutex.unlock();
+    }
+}
+
+template <class DATA>
+void ShardedTimeQueue<DATA>::popImp(
+                                 const bsls::TimeInterval          *time,
+                                 int                                maxTimers,
+                                 bsl::vector<TimeQueueItem<DATA> > *buffer,
+                                 int                               *newLength,
+                                 bsls::TimeInterval                *newMinTime)
+{
+    Node *begin = 0;
+
+    lockAll();
+
+    for (; 0 < maxTimers; --maxTimers) {
+        Shard *shard = frontShard();
+        if (0 == shard) {
+            break;
+        }
+
+        MapIter it = shard->d_map.begin();
+        if (time && *time < it->first) {
+            break;
+        }
+
+        Node *node = it->second;
+        if (buffer) {
+            buffer->push_back(TimeQueueItem<DATA>(it->first,
+                                                  node->d_data.object(),
+                                                  node->d_index,
+                                                  node->d_key,
+                                                  d_allocator_p));
+        }
+        unlinkNode(shard, it, node);
+        freeNode(node);
+        --shard->d_length;
+
+        node->d_next_p = begin;
+        begin = node;
+    }
+
+    if (newLength) {
+        *newLength = length();
+    }
+    if (newMinTime) {
+        Shard *shard = frontShard();
+        if (shard) {
+            *newMinTime = shard->d_map.begin()->first;
+        }
+    }
+
+    unlockAll();
+    putFreeNodeList(begin);
+}
+
+template <class DATA>
+void ShardedTimeQueue<DATA>::putFreeNodeList(Node *begin)
+{
+    while (begin) {
+        Node *node = begin;
+        begin = begin->d_next_p;
+
+        node->d_data.object().~DATA();
+
+        Shard *shard        = shardOf(node->d_index);
+        Node  *nextFreeNode = shard->d_nextFreeNode_p;
+        node->d_next_p = nextFreeNode;
+        while (nextFreeNode !=
+                     shard->d_nextFreeNode_p.testAndSwap(nextFreeNode, node)) {
+            nextFreeNode = shard->d_nextFreeNode_p;
+            node->d_next_p = nextFreeNode;
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class DATA>
+inline
+typename ShardedTimeQueue<DATA>::Node *
+ShardedTimeQueue<DATA>::findNode(const Shard *shard,
+                                 Handle       handle,
+                                 const Key&   key) const
+{
+    const int index = ((handle & d_indexMask) >> d_numShardBits) - 1;
+
+    if (index < 0 || index >= static_cast<int>(shard->d_nodeArray.size())) {
+        return 0;                                                     // RETURN
+    }
+    Node *node = shard->d_nodeArray[index];
+
+    if (node->d_index != handle || node->d_key != key || 0 == node->d_prev_p) {
+        return 0;                                                     // RETURN
+    }
+    return node;
+}
+
+template <class DATA>
+typename ShardedTimeQueue<DATA>::Shard *
+ShardedTimeQueue<DATA>::frontShard() const
+{
+    const int  numShards = 1 << d_numShardBits;
+    Shard     *result    = 0;
+
+    for (int i = 0; i < numShards; ++i) {
+        Shard *shard = d_shards + i;
+        if (!shard->d_map.empty()
+         && (0 == result
+          || shard->d_map.begin()->first < result->d_map.begin()->first)) {
+            result = shard;
+        }
+    }
+    return result;
+}
+
+template <class DATA>
+bool ShardedTimeQueue<DATA>::isLowerThanOtherShards(
+                                        const Shard               *shard,
+                                        const bsls::TimeInterval&  time) const
+{
+    const int numShards = 1 << d_numShardBits;
+
+    for (int i = 0; i < numShards; ++i) {
+        const Shard *other = d_shards + i;
+        if (other == shard) {
+            continue;
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&other->d_mutex);
+        if (!other->d_map.empty() && other->d_map.begin()->first < time) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class DATA>
+inline
+typename ShardedTimeQueue<DATA>::Shard *
+ShardedTimeQueue<DATA>::shardOf(Handle handle) const
+{
+    return d_shards + (handle & d_shardMask);
+}
+
+template <class DATA>
+inline
+int ShardedTimeQueue<DATA>::threadShardIndex() const
+{
+    bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+
+    // Mix the bits of the identifier, which is often an aligned address.
+
+    id ^= id >> 33;
+    id *= 0xff51afd7ed558ccdULL;
+    id ^= id >> 33;
+
+    return static_cast<int>(id) & d_shardMask;
+}
+
+// CREATORS
+template <class DATA>
+ShardedTimeQueue<DATA>::ShardedTimeQueue(bslma::Allocator *basicAllocator)
+: d_numShardBits(log2(k_NUM_SHARDS_DEFAULT))
+, d_shardMask(k_NUM_SHARDS_DEFAULT - 1)
+, d_indexMask((1 << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_maxNodesPerShard((1 << (k_NUM_INDEX_BITS_DEFAULT - d_numShardBits)) - 2)
+, d_shards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_shards = static_cast<Shard *>(d_allocator_p->allocate(
+                                     k_NUM_SHARDS_DEFAULT * sizeof(Shard)));
+    for (int i = 0; i < k_NUM_SHARDS_DEFAULT; ++i) {
+        new (d_shards + i) Shard(d_allocator_p);
+    }
+}
+
+template <class DATA>
+ShardedTimeQueue<DATA>::ShardedTimeQueue(int               numShards,
+                                         bslma::Allocator *basicAllocator)
+: d_numShardBits(log2(numShards))
+, d_shardMask(numShards - 1)
+, d_indexMask((1 << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_maxNodesPerShard((1 << (k_NUM_INDEX_BITS_DEFAULT - d_numShardBits)) - 2)
+, d_shards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(d_numShardBits <= k_NUM_INDEX_BITS_DEFAULT - 4);
+
+    d_shards = static_cast<Shard *>(d_allocator_p->allocate(
+                                                   numShards * sizeof(Shard)));
+    for (int i = 0; i < numShards; ++i) {
+        new (d_shards + i) Shard(d_allocator_p);
+    }
+}
+
+template <class DATA>
+ShardedTimeQueue<DATA>::ShardedTimeQueue(int               numShards,
+                                         int               numIndexBits,
+                                         bslma::Allocator *basicAllocator)
+: d_numShardBits(log2(numShards))
+, d_shardMask(numShards - 1)
+, d_indexMask((1 << numIndexBits) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_maxNodesPerShard((1 << (numIndexBits - d_numShardBits)) - 2)
+, d_shards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
+             && k_NUM_INDEX_BITS_MAX >= numIndexBits);
+    BSLS_ASSERT(d_numShardBits <= numIndexBits - 4);
+
+    d_shards = static_cast<Shard *>(d_allocator_p->allocate(
+                                                   numShards * sizeof(Shard)));
+    for (int i = 0; i < numShards; ++i) {
+        new (d_shards + i) Shard(d_allocator_p);
+    }
+}
+
+template <class DATA>
+ShardedTimeQueue<DATA>::~ShardedTimeQueue()
+{
+    removeAll();
+
+    const int numShards = 1 << d_numShardBits;
+    for (int i = 0; i < numShards; ++i) {
+        Shard& shard = d_shards[i];
+
+        const int numNodes = static_cast<int>(shard.d_nodeArray.size());
+        for (int j = 0; j < numNodes; ++j) {
+            d_allocator_p->deleteObjectRaw(shard.d_nodeArray[j]);
+        }
+        shard.~Shard();
+    }
+    d_allocator_p->deallocate(d_shards);
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+typename ShardedTimeQueue<DATA>::Handle ShardedTimeQueue<DATA>::add(
+                                          const bsls::TimeInterval&  time,
+                                          const DATA&                data,
+                                          int                       *isNewTop,
+                                          int                       *newLength)
+{
+    return add(time, data, Key(0), isNewTop, newLength);
+}
+
+template <class DATA>
+typename ShardedTimeQueue<DATA>::Handle ShardedTimeQueue<DATA>::add(
+                                          const bsls::TimeInterval&  time,
+                                          const DATA&                data,
+                                          const Key&                 key,
+                                          int                       *isNewTop,
+                                          int                       *newLength)
+{
+    const int numShards  = 1 << d_numShardBits;
+    const int firstShard = threadShardIndex();
+
+    for (int i = 0; i < numShards; ++i) {
+        const int shardIndex = (firstShard + i) & d_shardMask;
+        Shard    *shard      = d_shards + shardIndex;
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&shard->d_mutex);
+
+        Node *node;
+        if (shard->d_nextFreeNode_p) {
+            // All allocation of nodes of a shard is guarded by the mutex of
+            // the shard, so no other thread removes anything from its free
+            // list while this code is executing.  However, other threads may
+            // add to the free list.
+
+            node = shard->d_nextFreeNode_p;
+            Node *next = node->d_next_p;
+            while (node != shard->d_nextFreeNode_p.testAndSwap(node, next)) {
+                node = shard->d_nextFreeNode_p;
+                next = node->d_next_p;
+            }
+        }
+        else {
+            if (static_cast<int>(shard->d_nodeArray.size())
+                                                       >= d_maxNodesPerShard) {
+                continue;
+            }
+
+            node = new (*d_allocator_p) Node;
+            shard->d_nodeArray.push_back(node);
+            const int nodeIndex = static_cast<int>(shard->d_nodeArray.size());
+            node->d_index = (nodeIndex << d_numShardBits)
+                          | shardIndex
+                          | d_indexIterationInc;
+        }
+        node->d_time = time;
+        node->d_key  = key;
+        bslalg::ScalarPrimitives::copyConstruct(&node->d_data.object(),
+                                                data,
+                                                d_allocator_p);
+        linkNode(shard, node);
+        ++shard->d_length;
+
+        const Handle handle    = node->d_index;
+        const bool   shardTop  = shard->d_map.begin()->second == node
+                              && node->d_prev_p == node;
+
+        lock.release()->unlock();
+
+        if (isNewTop) {
+            *isNewTop = shardTop && isLowerThanOtherShards(shard, time);
+        }
+        if (newLength) {
+            *newLength = length();
+        }
+
+        BSLS_ASSERT(-1 != handle);
+        return handle;                                                // RETURN
+    }
+    return -1;
+}
+
+template <class DATA>
+inline
+typename ShardedTimeQueue<DATA>::Handle ShardedTimeQueue<DATA>::add(
+                                         const TimeQueueItem<DATA>&  item,
+                                         int                        *isNewTop,
+                                         int                        *newLength)
+{
+    return add(item.time(), item.data(), item.key(), isNewTop, newLength);
+}
+
+template <class DATA>
+int ShardedTimeQueue<DATA>::popFront(TimeQueueItem<DATA> *buffer,
+                                     int                 *newLength,
+                                     bsls::TimeInterval  *newMinTime)
+{
+    lockAll();
+
+    Shard *shard = frontShard();
+    if (0 == shard) {
+        unlockAll();
+        return 1;                                                     // RETURN
+    }
+
+    MapIter  it   = shard->d_map.begin();
+    Node    *node = it->second;
+
+    if (buffer) {
+        buffer->time()   = node->d_time;
+        buffer->data()   = node->d_data.object();
+        buffer->handle() = node->d_index;
+        buffer->key()    = node->d_key;
+    }
+    unlinkNode(shard, it, node);
+    freeNode(node);
+    --shard->d_length;
+
+    if (newMinTime) {
+        Shard *front = frontShard();
+        if (front) {
+            *newMinTime = front->d_map.begin()->first;
+        }
+    }
+    if (newLength) {
+        *newLength = length();
+    }
+
+    unlockAll();
+
+    node->d_next_p = 0;
+    putFreeNodeList(node);
+    return 0;
+}
+
+template <class DATA>
+inline
+void ShardedTimeQueue<DATA>::popLE(
+                                 const bsls::TimeInterval&          time,
+                                 bsl::vector<TimeQueueItem<DATA> > *buffer,
+                                 int                               *newLength,
+                                 bsls::TimeInterval                *newMinTime)
+{
+    popImp(&time,
+           bsl::numeric_limits<int>::max(),
+           buffer,
+           newLength,
+           newMinTime);
+}
+
+template <class DATA>
+inline
+void ShardedTimeQueue<DATA>::popLE(
+                                 const bsls::TimeInterval&          time,
+                                 int                                maxTimers,
+                                 bsl::vector<TimeQueueItem<DATA> > *buffer,
+                                 int                               *newLength,
+                                 bsls::TimeInterval                *newMinTime)
+{
+    BSLS_ASSERT(0 <= maxTimers);
+
+    popImp(&time, maxTimers, buffer, newLength, newMinTime);
+}
+
+template <class DATA>
+inline
+int ShardedTimeQueue<DATA>::remove(Handle               handle,
+                                   int                 *newLength,
+                                   bsls::TimeInterval  *newMinTime,
+                                   TimeQueueItem<DATA> *item)
+{
+    return remove(handle, Key(0), newLength, newMinTime, item);
+}
+
+template <class DATA>
+int ShardedTimeQueue<DATA>::remove(Handle               handle,
+                                   const Key&           key,
+                                   int                 *newLength,
+                                   bsls::TimeInterval  *newMinTime,
+                                   TimeQueueItem<DATA> *item)
+{
+    Shard *shard = shardOf(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&shard->d_mutex);
+
+    Node *node = findNode(shard, handle, key);
+    if (0 == node) {
+        return 1;                                                     // RETURN
+    }
+
+    if (item) {
+        item->time()   = node->d_time;
+        item->data()   = node->d_data.object();
+        item->handle() = node->d_index;
+        item->key()    = node->d_key;
+    }
+
+    unlinkNode(shard, shard->d_map.find(node->d_time), node);
+    freeNode(node);
+    --shard->d_length;
+
+    lock.release()->unlock();
+
+    node->d_next_p = 0;
+    putFreeNodeList(node);
+
+    if (newLength) {
+        *newLength = length();
+    }
+    if (newMinTime) {
+        minTime(newMinTime);
+    }
+    return 0;
+}
+
+template <class DATA>
+inline
+void ShardedTimeQueue<DATA>::removeAll(
+                                     bsl::vector<TimeQueueItem<DATA> > *buffer)
+{
+    popImp(0, bsl::numeric_limits<int>::max(), buffer, 0, 0);
+}
+
+template <class DATA>
+inline
+int ShardedTimeQueue<DATA>::update(Handle                     handle,
+                                   const bsls::TimeInterval&  newTime,
+                                   int                       *isNewTop)
+{
+    return update(handle, Key(0), newTime, isNewTop);
+}
+
+template <class DATA>
+int ShardedTimeQueue<DATA>::update(Handle                     handle,
+                                   const Key&                 key,
+                                   const bsls::TimeInterval&  newTime,
+                                   int                       *isNewTop)
+{
+    Shard *shard = shardOf(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&shard->d_mutex);
+
+    Node *node = findNode(shard, handle, key);
+    if (0 == node) {
+        return 1;                                                     // RETURN
+    }
+
+    unlinkNode(shard, shard->d_map.find(node->d_time), node);
+    node->d_time = newTime;
+    linkNode(shard, node);
+
+    const bool shardTop = shard->d_map.begin()->second == node
+                       && node->d_prev_p == node;
+
+    lock.release()->unlock();
+
+    if (isNewTop) {
+        *isNewTop = shardTop && isLowerThanOtherShards(shard, newTime);
+    }
+    return 0;
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+bool ShardedTimeQueue<DATA>::isRegisteredHandle(Handle handle) const
+{
+    return isRegisteredHandle(handle, Key(0));
+}
+
+template <class DATA>
+inline
+bool ShardedTimeQueue<DATA>::isRegisteredHandle(Handle     handle,
+                                                const Key& key) const
+{
+    const Shard *shard = shardOf(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&shard->d_mutex);
+
+    return 0 != findNode(shard, handle, key);
+}
+
+template <class DATA>
+int ShardedTimeQueue<DATA>::length() const
+{
+    const int numShards = 1 << d_numShardBits;
+    int       result    = 0;
+
+    for (int i = 0; i < numShards; ++i) {
+        result += d_shards[i].d_length;
+    }
+    return result;
+}
+
+template <class DATA>
+int ShardedTimeQueue<DATA>::minTime(bsls::TimeInterval *buffer) const
+{
+    BSLS_ASSERT(buffer);
+
+    const int numShards = 1 << d_numShardBits;
+    int       rc        = 1;
+
+    for (int i = 0; i < numShards; ++i) {
+        const Shard& shard = d_shards[i];
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&shard.d_mutex);
+        if (!shard.d_map.empty()
+         && (rc || shard.d_map.begin()->first < *buffer)) {
+            *buffer = shard.d_map.begin()->first;
+            rc      = 0;
+        }
+    }
+    return rc;
+}
+
+template <class DATA>
+inline
+int ShardedTimeQueue<DATA>::numShards() const
+{
+    return 1 << d_numShardBits;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
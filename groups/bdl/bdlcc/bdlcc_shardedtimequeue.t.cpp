@@ -0,0 +1,1128 @@
+// bdlcc_shardedtimequeue.t.cpp                                       -*-C++-*-
+#include <bdlcc_shardedtimequeue.h>
+
+#include <bdlcc_timequeue.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlt_currenttime.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// 'bdlcc::ShardedTimeQueue' offers the interface of 'bdlcc::TimeQueue'.  We
+// verify the manipulators and accessors on single items directly, including
+// the encoding of the shard in handles and the fallback to other shards when
+// a shard is full.  Since all the items added by a given thread go to the
+// same shard, we populate several shards by adding items from several threads,
+// and verify that the operations removing the lowest items ('popFront' and
+// the 'popLE' overloads) merge the shards into the order given by an oracle.
+// Finally we verify that concurrent use does not lose or duplicate items.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedTimeQueue(Allocator *basicAllocator = 0);
+// [ 2] ShardedTimeQueue(int numShards, Allocator *basicAllocator = 0);
+// [ 2] ShardedTimeQueue(int numShards, int numIndexBits, Allocator * = 0);
+// [ 2] ~ShardedTimeQueue();
+//
+// MANIPULATORS
+// [ 2] Handle add(const TimeInterval&, const DATA&, int *, int *);
+// [ 2] Handle add(const TimeInterval&, const DATA&, const Key&, int *, int *);
+// [ 2] Handle add(const TimeQueueItem<DATA>&, int *, int *);
+// [ 3] int popFront(TimeQueueItem<DATA> *, int *, TimeInterval *);
+// [ 3] void popLE(const TimeInterval&, vector *, int *, TimeInterval *);
+// [ 3] void popLE(const TimeInterval&, int, vector *, int *, TimeInterval *);
+// [ 2] int remove(Handle, int *, TimeInterval *, TimeQueueItem<DATA> *);
+// [ 2] int remove(Handle, const Key&, int *, TimeInterval *, Item *);
+// [ 3] void removeAll(vector *buffer = 0);
+// [ 2] int update(Handle, const TimeInterval&, int *isNewTop = 0);
+// [ 2] int update(Handle, const Key&, const TimeInterval&, int * = 0);
+//
+// ACCESSORS
+// [ 2] bool isRegisteredHandle(Handle handle) const;
+// [ 2] bool isRegisteredHandle(Handle handle, const Key& key) const;
+// [ 2] int length() const;
+// [ 2] int minTime(TimeInterval *buffer) const;
+// [ 2] int numShards() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 3] CONCERN: items are removed in time order across all shards
+// [ 4] CONCERN: concurrent insertions, removals, updates, and pops
+// [ 5] CONCERN: adding items having equal times reports a new top
+// [-1] PERFORMANCE: contended add/remove compared with 'bdlcc::TimeQueue'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+typedef bdlcc::ShardedTimeQueue<int>          Obj;
+typedef bdlcc::ShardedTimeQueue<bsl::string>  StrObj;
+typedef bdlcc::TimeQueueItem<int>             Item;
+typedef bdlcc::TimeQueueItem<bsl::string>     StrItem;
+typedef Obj::Handle                           Handle;
+typedef Obj::Key                              Key;
+typedef StrObj::Key                           StrKey;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class Random {
+    // This class provides a deterministic 64-bit pseudo-random generator.
+
+    // DATA
+    bsls::Types::Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(bsls::Types::Uint64 seed) : d_state(seed) {}
+
+    // MANIPULATORS
+    int operator()(int range)
+        // Return a pseudo-random value in the range '[0 .. range)'.
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<int>((d_state >> 33) % range);
+    }
+};
+
+typedef bsl::multimap<bsls::TimeInterval, int> Oracle;
+
+void addItems(Obj                *queue,
+              bsl::vector<Handle> *handles,
+              int                 seed,
+              int                 numItems)
+    // Add to the specified 'queue' the specified 'numItems' items having
+    // pseudo-random times generated from the specified 'seed', and data
+    // values '[seed * numItems .. (seed + 1) * numItems)', and load their
+    // handles into the specified 'handles'.
+{
+    Random random(seed + 1);
+    handles->resize(numItems);
+    for (int i = 0; i < numItems; ++i) {
+        (*handles)[i] = queue->add(bsls::TimeInterval(random(100), 0),
+                                   seed * numItems + i);
+        ASSERTT(-1 != (*handles)[i]);
+    }
+}
+
+int populate(Obj *queue, Oracle *oracle, int numThreads, int numItems)
+    // Add to the specified 'queue' 'numItems' items from each of the
+    // specified 'numThreads' threads, using 'addItems', and add the same items
+    // to the specified 'oracle'.  Return the number of distinct shards of
+    // 'queue' to which the items were added.
+{
+    bsl::vector<bsl::vector<Handle> > handles(numThreads);
+
+    // Run the threads concurrently, so that they have distinct identifiers,
+    // and hence tend to add to distinct shards.  The resulting contents of the
+    // queue do not depend on the scheduling of the threads.
+
+    bslmt::ThreadGroup threads;
+    for (int t = 0; t < numThreads; ++t) {
+        ASSERT(0 == threads.addThread(bdlf::BindUtil::bind(&addItems,
+                                                           queue,
+                                                           &handles[t],
+                                                           t,
+                                                           numItems)));
+
+        Random random(t + 1);
+        for (int i = 0; i < numItems; ++i) {
+            oracle->insert(Oracle::value_type(
+                                          bsls::TimeInterval(random(100), 0),
+                                          t * numItems + i));
+        }
+    }
+    threads.joinAll();
+
+    bsl::set<int> shards;
+    for (int t = 0; t < numThreads; ++t) {
+        for (int i = 0; i < numItems; ++i) {
+            shards.insert(handles[t][i] & (queue->numShards() - 1));
+        }
+    }
+    return static_cast<int>(shards.size());
+}
+
+void verifyPopped(const bsl::vector<Item>&  popped,
+                  Oracle                   *oracle,
+                  int                       line)
+    // Verify that the specified 'popped' items are ordered by time, and are
+    // the lowest items of the specified 'oracle', and remove them from
+    // 'oracle'.  Use the specified 'line' to report errors.
+{
+    for (bsl::size_t i = 0; i < popped.size(); ++i) {
+        LOOP2_ASSERT(line, i, !oracle->empty());
+        if (oracle->empty()) {
+            return;                                                   // RETURN
+        }
+        LOOP2_ASSERT(line, i, oracle->begin()->first == popped[i].time());
+        if (i) {
+            LOOP2_ASSERT(line, i, popped[i - 1].time() <= popped[i].time());
+        }
+
+        // Items having the same time may be popped in any order.
+
+        typedef Oracle::iterator Iter;
+        bsl::pair<Iter, Iter> range = oracle->equal_range(popped[i].time());
+        Iter                  it    = range.first;
+        while (it != range.second && it->second != popped[i].data()) {
+            ++it;
+        }
+        LOOP2_ASSERT(line, i, it != range.second);
+        if (it != range.second) {
+            oracle->erase(it);
+        }
+    }
+}
+
+                          // ====================
+                          // struct ConcurrentArgs
+                          // ====================
+
+struct ConcurrentArgs {
+    // This 'struct' holds the state shared by the threads of the concurrency
+    // test.
+
+    Obj             *d_queue_p;
+    bsls::AtomicInt  d_now;
+    bsls::AtomicInt  d_added;
+    bsls::AtomicInt  d_removed;
+    bsls::AtomicInt  d_popped;
+    bsls::AtomicInt  d_producersDone;
+};
+
+void producer(ConcurrentArgs *args, int id, int numItems)
+    // Add the specified 'numItems' items to the queue of the specified 'args',
+    // slightly ahead of its current time, update every second of them, and
+    // remove every third of them again.  Use the specified 'id' to seed the
+    // times.
+{
+    Random random(id + 1);
+    for (int i = 0; i < numItems; ++i) {
+        const int    now    = args->d_now.loadRelaxed();
+        const Handle handle = args->d_queue_p->add(
+                                bsls::TimeInterval(now + random(1000), 0),
+                                id,
+                                Key(i));
+        ASSERTT(-1 != handle);
+        ++args->d_added;
+
+        if (0 == i % 2) {
+            args->d_queue_p->update(handle,
+                                    Key(i),
+                                    bsls::TimeInterval(now + random(1000), 0));
+        }
+        if (0 == i % 3 && 0 == args->d_queue_p->remove(handle, Key(i))) {
+            ++args->d_removed;
+        }
+        if (0 == i % 64) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    ++args->d_producersDone;
+}
+
+void consumer(ConcurrentArgs *args, int numProducers)
+    // Advance the time of the specified 'args' and pop the items that are due
+    // until the specified 'numProducers' have finished and the queue is
+    // empty.
+{
+    bsl::vector<Item> buffer;
+    while (numProducers != args->d_producersDone.loadRelaxed()
+        || 0 != args->d_queue_p->length()) {
+        const int now = args->d_now.addRelaxed(10);
+
+        buffer.clear();
+        args->d_queue_p->popLE(bsls::TimeInterval(now, 0), 32, &buffer);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            ASSERTT(buffer[i].time() <= bsls::TimeInterval(now, 0));
+            ASSERTT(!args->d_queue_p->isRegisteredHandle(buffer[i].handle(),
+                                                         buffer[i].key()));
+            if (i) {
+                ASSERTT(buffer[i - 1].time() <= buffer[i].time());
+            }
+        }
+        args->d_popped += static_cast<int>(buffer.size());
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+void addAtTime(Obj                       *queue,
+               const bsls::TimeInterval&  time,
+               bslmt::Barrier            *before,
+               bslmt::Barrier            *after,
+               Handle                    *handle,
+               int                       *isNewTop)
+    // Wait on the specified 'before' barrier, if not 0, then add to the
+    // specified 'queue' an item having the specified 'time', load its handle
+    // into the specified 'handle' and whether it is the new top into the
+    // specified 'isNewTop', and wait on the specified 'after' barrier, if not
+    // 0.
+{
+    if (before) {
+        before->wait();
+    }
+    *handle = queue->add(time, 0, isNewTop);
+    if (after) {
+        after->wait();
+    }
+}
+
+template <class QUEUE>
+void addRemove(QUEUE *queue, bslmt::Barrier *barrier, int numCycles)
+    // Wait on the specified 'barrier', then add and remove an item from the
+    // specified 'queue' the specified 'numCycles' times.
+{
+    Random random(reinterpret_cast<bsls::Types::UintPtr>(&random));
+
+    barrier->wait();
+    for (int i = 0; i < numCycles; ++i) {
+        typename QUEUE::Handle handle =
+                  queue->add(bsls::TimeInterval(random(1000000), 0), i);
+        queue->remove(handle);
+    }
+}
+
+template <class QUEUE>
+double timeAddRemove(QUEUE *queue, int numThreads, int numCycles)
+    // Return the average time, in nanoseconds, of an add/remove cycle on the
+    // specified 'queue', run 'numCycles' times by each of the specified
+    // 'numThreads' threads.
+{
+    bslmt::Barrier  barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bind(&addRemove<QUEUE>,
+                                               queue,
+                                               &barrier,
+                                               numCycles));
+    }
+
+    bsls::Stopwatch sw;
+    sw.start();
+    barrier.wait();
+    threads.joinAll();
+    sw.stop();
+
+    return sw.elapsedTime() * 1e9 / (numThreads * numCycles);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Example 1: Dispatching Timers Added From Several Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, several worker threads schedule timeouts, identified by
+// integers, in a shared 'bdlcc::ShardedTimeQueue', and a dispatcher thread
+// periodically processes the timeouts that are due, a bounded number at a
+// time.
+//
+// First, we define the queue and a function, run by each worker thread, that
+// adds timeouts to the queue, and cancels every other one of them:
+//..
+    bdlcc::ShardedTimeQueue<int> timeouts(4);
+
+    void scheduleTimeouts(int base)
+    {
+        bsls::TimeInterval now = bdlt::CurrentTime::now();
+
+        for (int i = 0; i < 100; ++i) {
+            bsls::TimeInterval timeout = now + bsls::TimeInterval(0, i * 10);
+            bdlcc::ShardedTimeQueue<int>::Handle handle =
+                                              timeouts.add(timeout, base + i);
+            if (i % 2) {
+                timeouts.remove(handle);
+            }
+        }
+    }
+//..
+// Notice that adding and cancelling timeouts from different worker threads
+// typically locks different shards.
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we start the workers, and wait for them to complete:
+//..
+    bslmt::ThreadGroup workers;
+    for (int i = 0; i < 4; ++i) {
+        workers.addThread(bdlf::BindUtil::bind(&scheduleTimeouts, i * 1000));
+    }
+    workers.joinAll();
+
+    ASSERT(200 == timeouts.length());
+//..
+// Finally, the dispatcher removes all the timeouts that are due, at most 64 at
+// a time, in the order of their times, regardless of the shards holding them:
+//..
+    bsl::vector<bdlcc::TimeQueueItem<int> > expired;
+
+    bsls::TimeInterval deadline = bdlt::CurrentTime::now()
+                                + bsls::TimeInterval(1, 0);
+    int                remaining = 1;
+    while (remaining) {
+        expired.clear();
+        timeouts.popLE(deadline, 64, &expired, &remaining);
+
+        ASSERT(0 < expired.size() && expired.size() <= 64);
+        for (bsl::size_t i = 1; i < expired.size(); ++i) {
+            ASSERT(expired[i - 1].time() <= expired[i].time());
+        }
+    }
+    ASSERT(0 == timeouts.length());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: adding items having equal times reports a new top
+        //
+        // Concerns:
+        //: 1 An item added to one shard with the same time as the lowest item
+        //:   of another shard is reported as the new top.
+        //:
+        //: 2 When items having the same time are added concurrently to an
+        //:   empty queue, at least one of them is reported as the new top, so
+        //:   that a dispatcher waiting for a new top is always woken.
+        //
+        // Plan:
+        //: 1 Add an item from one thread, then an item having the same time
+        //:   from another thread, and, if the second item is in a distinct
+        //:   shard, verify that it is reported as the new top.  (C-1)
+        //:
+        //: 2 Repeatedly start two threads that wait on a barrier and then add
+        //:   items having the same time to an empty queue, and verify that at
+        //:   least one of them is reported as the new top.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: adding items having equal times reports a new top
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: EQUAL TIMES REPORT A NEW TOP" << endl
+                          << "=====================================" << endl;
+
+        const bsls::TimeInterval TIME(10, 0);
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tSequential adds to distinct shards." << endl;
+        {
+            int numDistinct = 0;
+            for (int i = 0; i < 100 && numDistinct < 10; ++i) {
+                Obj                mX(2, &ta);
+                bslmt::Barrier     barrier(2);
+                Handle             handles[2];
+                int                isNewTop[2];
+                bslmt::ThreadGroup threads;
+
+                // Both threads run at once, so that they have distinct
+                // identifiers, but the second adds after the first.
+
+                ASSERT(0 == threads.addThread(
+                                      bdlf::BindUtil::bind(&addAtTime,
+                                                           &mX,
+                                                           TIME,
+                                                           (bslmt::Barrier *)0,
+                                                           &barrier,
+                                                           &handles[0],
+                                                           &isNewTop[0])));
+                ASSERT(0 == threads.addThread(
+                                      bdlf::BindUtil::bind(&addAtTime,
+                                                           &mX,
+                                                           TIME,
+                                                           &barrier,
+                                                           (bslmt::Barrier *)0,
+                                                           &handles[1],
+                                                           &isNewTop[1])));
+                threads.joinAll();
+
+                ASSERTV(i, isNewTop[0]);
+                if ((handles[0] & 1) != (handles[1] & 1)) {
+                    ++numDistinct;
+                    ASSERTV(i, isNewTop[1]);
+                }
+            }
+            if (veryVerbose) {
+                P(numDistinct)
+            }
+        }
+
+        if (verbose) cout << "\tConcurrent adds." << endl;
+        {
+            for (int i = 0; i < 1000; ++i) {
+                Obj                mX(2, &ta);
+                bslmt::Barrier     barrier(2);
+                Handle             handles[2];
+                int                isNewTop[2];
+                bslmt::ThreadGroup threads;
+
+                for (int t = 0; t < 2; ++t) {
+                    ASSERT(0 == threads.addThread(
+                                      bdlf::BindUtil::bind(&addAtTime,
+                                                           &mX,
+                                                           TIME,
+                                                           &barrier,
+                                                           (bslmt::Barrier *)0,
+                                                           &handles[t],
+                                                           &isNewTop[t])));
+                }
+                threads.joinAll();
+
+                ASSERTV(i, isNewTop[0] || isNewTop[1]);
+                ASSERTV(i, 2 == mX.length());
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: concurrent insertions, removals, updates, and pops
+        //
+        // Concerns:
+        //: 1 When several threads add, update, and remove items while another
+        //:   thread pops the items that are due, every item added is removed
+        //:   exactly once, either by its producer or by the consumer.
+        //:
+        //: 2 No item is popped before its time, and each batch of popped
+        //:   items is ordered by time.
+        //
+        // Plan:
+        //: 1 Run several producer threads adding items with times slightly
+        //:   ahead of a shared clock, updating half of them, and removing a
+        //:   third of them, and a consumer thread advancing the clock and
+        //:   popping the items that are due in bounded batches.  Verify that
+        //:   the counts balance and that the queue ends up empty.  (C-1,2)
+        //
+        // Testing:
+        //   CONCERN: concurrent insertions, removals, updates, and pops
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT USE" << endl
+                          << "=======================" << endl;
+
+        const int NUM_PRODUCERS = 4;
+        const int NUM_ITEMS     = 20000;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj            mX(4, &ta);
+            ConcurrentArgs args;
+            args.d_queue_p = &mX;
+
+            bslmt::ThreadUtil::Handle handles[NUM_PRODUCERS + 1];
+            for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handles[i],
+                                      bdlf::BindUtil::bind(&producer,
+                                                           &args,
+                                                           i,
+                                                           NUM_ITEMS)));
+            }
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handles[NUM_PRODUCERS],
+                                  bdlf::BindUtil::bind(&consumer,
+                                                       &args,
+                                                       NUM_PRODUCERS)));
+            for (int i = 0; i <= NUM_PRODUCERS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            if (veryVerbose) {
+                P_(args.d_added) P_(args.d_removed) P(args.d_popped)
+            }
+
+            ASSERT(NUM_PRODUCERS * NUM_ITEMS == args.d_added);
+            ASSERT(args.d_added == args.d_removed + args.d_popped);
+            ASSERT(0 == mX.length());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: items are removed in time order across all shards
+        //
+        // Concerns:
+        //: 1 'popFront' removes an item having the lowest time value of the
+        //:   whole queue, whichever shard holds it.
+        //:
+        //: 2 'popLE' removes all the items not after the specified time, in
+        //:   time order, and 'popLE' with a maximum number of items removes
+        //:   exactly the lowest such items.
+        //:
+        //: 3 'newLength' and 'newMinTime' reflect the items remaining in all
+        //:   the shards, and 'newMinTime' is not loaded if the queue is empty.
+        //:
+        //: 4 'removeAll' removes the items of all the shards, in time order.
+        //
+        // Plan:
+        //: 1 Populate a queue from several threads, verifying that several
+        //:   shards are used, and apply the same operations to the queue and
+        //:   to a 'bsl::multimap' oracle.  (C-1..4)
+        //
+        // Testing:
+        //   int popFront(TimeQueueItem<DATA> *, int *, TimeInterval *);
+        //   void popLE(const TimeInterval&, vector *, int *, TimeInterval *);
+        //   void popLE(const TimeInterval&, int, vector *, int *, Interval *);
+        //   void removeAll(vector *buffer = 0);
+        //   CONCERN: items are removed in time order across all shards
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: TIME ORDER ACROSS SHARDS" << endl
+                          << "=================================" << endl;
+
+        const int NUM_THREADS = 16;
+        const int NUM_ITEMS   = 200;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj    mX(8, &ta);  const Obj& X = mX;
+            Oracle oracle;
+
+            const int numUsed = populate(&mX, &oracle, NUM_THREADS, NUM_ITEMS);
+            if (veryVerbose) { P(numUsed) }
+            ASSERT(1 < numUsed);
+            ASSERT(NUM_THREADS * NUM_ITEMS == X.length());
+
+            if (verbose) cout << "\tTesting 'popFront'." << endl;
+
+            for (int i = 0; i < 100; ++i) {
+                Item               item(&ta);
+                int                newLength  = -1;
+                bsls::TimeInterval newMinTime;
+
+                ASSERT(0 == mX.popFront(&item, &newLength, &newMinTime));
+                ASSERT(!X.isRegisteredHandle(item.handle()));
+
+                bsl::vector<Item> popped(1, item);
+                verifyPopped(popped, &oracle, L_);
+                ASSERT(static_cast<int>(oracle.size()) == newLength);
+                ASSERT(oracle.begin()->first == newMinTime);
+            }
+
+            if (verbose) cout << "\tTesting bounded 'popLE'." << endl;
+
+            for (int i = 0; i < 20; ++i) {
+                bsl::vector<Item>  popped(&ta);
+                int                newLength  = -1;
+                bsls::TimeInterval newMinTime;
+
+                mX.popLE(bsls::TimeInterval(50, 0),
+                         i * 7,
+                         &popped,
+                         &newLength,
+                         &newMinTime);
+
+                LOOP_ASSERT(i, popped.size() <= bsl::size_t(i * 7));
+                for (bsl::size_t j = 0; j < popped.size(); ++j) {
+                    ASSERT(popped[j].time() <= bsls::TimeInterval(50, 0));
+                }
+                verifyPopped(popped, &oracle, L_);
+                ASSERT(static_cast<int>(oracle.size()) == newLength);
+                ASSERT(oracle.begin()->first == newMinTime);
+            }
+
+            if (verbose) cout << "\tTesting unbounded 'popLE'." << endl;
+            {
+                bsl::vector<Item>  popped(&ta);
+                int                newLength  = -1;
+                bsls::TimeInterval newMinTime;
+
+                mX.popLE(bsls::TimeInterval(80, 0),
+                         &popped,
+                         &newLength,
+                         &newMinTime);
+
+                verifyPopped(popped, &oracle, L_);
+                ASSERT(static_cast<int>(oracle.size()) == newLength);
+                ASSERT(oracle.begin()->first == newMinTime);
+                ASSERT(bsls::TimeInterval(80, 0) < newMinTime);
+            }
+
+            if (verbose) cout << "\tTesting 'removeAll'." << endl;
+            {
+                bsl::vector<Item> removed(&ta);
+                mX.removeAll(&removed);
+
+                verifyPopped(removed, &oracle, L_);
+                ASSERT(oracle.empty());
+                ASSERT(0 == X.length());
+
+                int                newLength  = -1;
+                bsls::TimeInterval newMinTime(-1, 0);
+                Item               item(&ta);
+
+                ASSERT(0 != mX.popFront(&item, &newLength, &newMinTime));
+                mX.popLE(bsls::TimeInterval(100, 0), 5, 0, &newLength,
+                         &newMinTime);
+                ASSERT(0 == newLength);
+                ASSERT(bsls::TimeInterval(-1, 0) == newMinTime);
+            }
+
+            if (verbose) cout << "\tTesting a zero maximum." << endl;
+            {
+                populate(&mX, &oracle, 2, 10);
+
+                bsl::vector<Item> popped(&ta);
+                int               newLength = -1;
+                mX.popLE(bsls::TimeInterval(100, 0), 0, &popped, &newLength);
+                ASSERT(popped.empty());
+                ASSERT(20 == newLength);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SINGLE-ITEM MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors create an empty queue having the specified (or
+        //:   default) number of shards, and the destructor releases all
+        //:   memory, including that of items still in the queue.
+        //:
+        //: 2 'add' returns a handle that encodes a valid shard index and that
+        //:   identifies the item (and key) in 'remove', 'update', and
+        //:   'isRegisteredHandle', and 'isNewTop' and 'newLength' are loaded
+        //:   as for 'bdlcc::TimeQueue'.
+        //:
+        //: 3 A removed item's handle is no longer registered, even after its
+        //:   node is reused.
+        //:
+        //: 4 When the shard of the calling thread is full, items are added to
+        //:   other shards, and 'add' returns -1 once all the shards are full.
+        //:
+        //: 5 Memory is supplied by the specified allocator, including to the
+        //:   items, and is returned when the queue is destroyed.
+        //
+        // Plan:
+        //: 1 Exercise each method on a few items, with and without keys, and
+        //:   verify the results against the expected values.  (C-1..3,5)
+        //:
+        //: 2 Fill a queue having few index bits, and verify the shards
+        //:   encoded in the handles and the failure of 'add'.  (C-4)
+        //
+        // Testing:
+        //   ShardedTimeQueue(Allocator *basicAllocator = 0);
+        //   ShardedTimeQueue(int numShards, Allocator *basicAllocator = 0);
+        //   ShardedTimeQueue(int numShards, int numIndexBits, Allocator *);
+        //   ~ShardedTimeQueue();
+        //   Handle add(const TimeInterval&, const DATA&, int *, int *);
+        //   Handle add(const TimeInterval&, const DATA&, const Key&, ...);
+        //   Handle add(const TimeQueueItem<DATA>&, int *, int *);
+        //   int remove(Handle, int *, TimeInterval *, TimeQueueItem<DATA> *);
+        //   int remove(Handle, const Key&, int *, TimeInterval *, Item *);
+        //   int update(Handle, const TimeInterval&, int *isNewTop = 0);
+        //   int update(Handle, const Key&, const TimeInterval&, int * = 0);
+        //   bool isRegisteredHandle(Handle handle) const;
+        //   bool isRegisteredHandle(Handle handle, const Key& key) const;
+        //   int length() const;
+        //   int minTime(TimeInterval *buffer) const;
+        //   int numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SINGLE-ITEM MANIPULATORS AND ACCESSORS"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting constructors." << endl;
+        {
+            StrObj mA(&ta);          const StrObj& A = mA;
+            StrObj mB(2, &ta);       const StrObj& B = mB;
+            StrObj mC(16, 12, &ta);  const StrObj& C = mC;
+
+            ASSERT(8  == A.numShards());
+            ASSERT(2  == B.numShards());
+            ASSERT(16 == C.numShards());
+            ASSERT(0  == A.length());
+            ASSERT(0  == B.length());
+            ASSERT(0  == C.length());
+
+            bsls::TimeInterval t;
+            ASSERT(0 != A.minTime(&t));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting 'add', 'remove', and 'update'."
+                          << endl;
+        {
+            const bsl::string LONG("a string long enough to allocate memory");
+
+            StrObj mX(4, &ta);  const StrObj& X = mX;
+
+            int    isNewTop  = -1;
+            int    newLength = -1;
+            Handle h1 = mX.add(bsls::TimeInterval(5, 0),
+                               LONG + "1",
+                               &isNewTop,
+                               &newLength);
+            ASSERT(-1 != h1);
+            ASSERT(1  == isNewTop);
+            ASSERT(1  == newLength);
+
+            Handle h2 = mX.add(bsls::TimeInterval(7, 0),
+                               LONG + "2",
+                               StrKey(&X),
+                               &isNewTop,
+                               &newLength);
+            ASSERT(0 == isNewTop);
+            ASSERT(2 == newLength);
+
+            Handle h3 = mX.add(StrItem(bsls::TimeInterval(5, 0),
+                                       LONG + "3",
+                                       0,
+                                       &ta),
+                               &isNewTop,
+                               &newLength);
+            ASSERT(0 == isNewTop);  // same time as 'h1'
+            ASSERT(3 == newLength);
+            ASSERT(3 == X.length());
+
+            ASSERT(h1 != h2 && h2 != h3 && h1 != h3);
+            ASSERT( X.isRegisteredHandle(h1));
+            ASSERT(!X.isRegisteredHandle(h2));
+            ASSERT( X.isRegisteredHandle(h2, StrKey(&X)));
+            ASSERT(!X.isRegisteredHandle(h1, StrKey(&X)));
+            ASSERT( X.isRegisteredHandle(h3));
+
+            bsls::TimeInterval t;
+            ASSERT(0 == X.minTime(&t));
+            ASSERT(bsls::TimeInterval(5, 0) == t);
+
+            // Update 'h2' to become the new top.
+
+            ASSERT(0 != mX.update(h2, bsls::TimeInterval(1, 0), &isNewTop));
+            ASSERT(0 == mX.update(h2,
+                                  StrKey(&X),
+                                  bsls::TimeInterval(1, 0),
+                                  &isNewTop));
+            ASSERT(1 == isNewTop);
+            ASSERT(0 == X.minTime(&t));
+            ASSERT(bsls::TimeInterval(1, 0) == t);
+
+            ASSERT(0 == mX.update(h1, bsls::TimeInterval(9, 0), &isNewTop));
+            ASSERT(0 == isNewTop);
+
+            // Remove 'h2'.
+
+            StrItem            item(&ta);
+            bsls::TimeInterval newMinTime;
+            ASSERT(0 != mX.remove(h2, &newLength, &newMinTime, &item));
+            ASSERT(0 == mX.remove(h2,
+                                  StrKey(&X),
+                                  &newLength,
+                                  &newMinTime,
+                                  &item));
+            ASSERT(2 == newLength);
+            ASSERT(bsls::TimeInterval(5, 0) == newMinTime);
+            ASSERT(bsls::TimeInterval(1, 0) == item.time());
+            ASSERT(LONG + "2"               == item.data());
+            ASSERT(h2                       == item.handle());
+            ASSERT(StrKey(&X)                  == item.key());
+            ASSERT(!X.isRegisteredHandle(h2, StrKey(&X)));
+            ASSERT(0 != mX.remove(h2, StrKey(&X)));
+            ASSERT(0 != mX.update(h2, StrKey(&X), bsls::TimeInterval(1, 0)));
+
+            // Reuse the node of 'h2'.
+
+            Handle h4 = mX.add(bsls::TimeInterval(3, 0),
+                               LONG + "4",
+                               StrKey(&X));
+            ASSERT(h4 != h2);
+            ASSERT((h4 & 0xffff) == (h2 & 0xffff));
+            ASSERT(!X.isRegisteredHandle(h2, StrKey(&X)));
+            ASSERT( X.isRegisteredHandle(h4, StrKey(&X)));
+
+            // Remove the last items, leaving 'h1' in the queue for the
+            // destructor.
+
+            ASSERT(0 == mX.remove(h4, StrKey(&X), &newLength));
+            ASSERT(2 == newLength);
+            ASSERT(0 == mX.remove(h3, &newLength, &newMinTime));
+            ASSERT(1 == newLength);
+            ASSERT(bsls::TimeInterval(9, 0) == newMinTime);
+
+            ASSERT(0 != mX.remove(-1));
+            ASSERT(0 != mX.remove(0));
+            ASSERT(!X.isRegisteredHandle(-1));
+            ASSERT(!X.isRegisteredHandle(0));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting full shards." << endl;
+        {
+            // With 8 index bits and 4 shards, each shard holds up to
+            // '2 ** 6 - 2' items.
+
+            const int NUM_SHARDS = 4;
+            const int PER_SHARD  = (1 << 6) - 2;
+
+            Obj mX(NUM_SHARDS, 8, &ta);  const Obj& X = mX;
+
+            int count[NUM_SHARDS] = { 0 };
+            for (int i = 0; i < NUM_SHARDS * PER_SHARD; ++i) {
+                Handle h = mX.add(bsls::TimeInterval(i, 0), i);
+                ASSERT(-1 != h);
+                ASSERT(X.isRegisteredHandle(h));
+                ++count[h & (NUM_SHARDS - 1)];
+            }
+            for (int i = 0; i < NUM_SHARDS; ++i) {
+                LOOP_ASSERT(i, PER_SHARD == count[i]);
+            }
+            ASSERT(NUM_SHARDS * PER_SHARD == X.length());
+            ASSERT(-1 == mX.add(bsls::TimeInterval(0, 0), 0));
+
+            // Freeing one item makes room again.
+
+            Item item;
+            ASSERT(0 == mX.popFront(&item));
+            ASSERT(0 == item.data());
+            ASSERT(-1 != mX.add(bsls::TimeInterval(0, 0), 0));
+            ASSERT(-1 == mX.add(bsls::TimeInterval(0, 0), 0));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add a few items, pop some of them, and remove the others.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.length());
+
+            Handle h1 = mX.add(bsls::TimeInterval(3, 0), 3);
+            Handle h2 = mX.add(bsls::TimeInterval(1, 0), 1);
+            Handle h3 = mX.add(bsls::TimeInterval(2, 0), 2);
+            ASSERT(3 == X.length());
+
+            bsl::vector<Item> popped;
+            mX.popLE(bsls::TimeInterval(2, 0), &popped);
+            ASSERT(2 == popped.size());
+            ASSERT(1 == popped[0].data());
+            ASSERT(2 == popped[1].data());
+            ASSERT(h2 == popped[0].handle());
+            ASSERT(h3 == popped[1].handle());
+            ASSERT(1 == X.length());
+
+            ASSERT(!X.isRegisteredHandle(h2));
+            ASSERT( X.isRegisteredHandle(h1));
+            ASSERT(0 == mX.remove(h1));
+            ASSERT(0 == X.length());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: contended add/remove compared with 'bdlcc::TimeQueue'
+        //
+        // Concerns:
+        //: 1 Threads adding and removing items concurrently contend less on a
+        //:   sharded queue than on a 'bdlcc::TimeQueue'.
+        //
+        // Plan:
+        //: 1 Time cycles of adding and removing an item run concurrently by
+        //:   several threads, on a sharded queue and on a time queue.
+        //
+        // Testing:
+        //   PERFORMANCE: contended add/remove compared with 'bdlcc::TimeQueue'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: CONTENDED ADD/REMOVE" << endl
+                          << "=================================" << endl;
+
+        const int NUM_THREADS = argc > 2 ? atoi(argv[2]) : 8;
+        const int NUM_CYCLES  = 200000;
+
+        {
+            bdlcc::ShardedTimeQueue<int> queue;
+            cout << "ShardedTimeQueue: "
+                 << timeAddRemove(&queue, NUM_THREADS, NUM_CYCLES)
+                 << "ns per add/remove with " << NUM_THREADS << " threads"
+                 << endl;
+        }
+        {
+            bdlcc::TimeQueue<int> queue;
+            cout << "TimeQueue:        "
+                 << timeAddRemove(&queue, NUM_THREADS, NUM_CYCLES)
+                 << "ns per add/remove with " << NUM_THREADS << " threads"
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
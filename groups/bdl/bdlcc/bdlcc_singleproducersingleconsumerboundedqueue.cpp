@@ -0,0 +1,42 @@
+// bdlcc_singleproducersingleconsumerboundedqueue.cpp                 -*-C++-*-
+#include <bdlcc_singleproducersingleconsumerboundedqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_singleproducersingleconsumerboundedqueue_cpp,
+                 "$Id$ $CSID$")
+
+///Implementation Note
+///===================
+// The queue is a classic two-index ring: the producer writes the element at
+// 'd_pushIndex' and then increments 'd_pushCount'; the consumer reads the
+// element at 'd_popIndex' and then increments 'd_popCount'.  The counts are
+// 64-bit and never wrap in practice, so the queue is full exactly when
+// 'd_pushCount - d_popCount == d_capacity', and no cell states (and so no
+// read-modify-write operations) are required on the fast path.  The indices
+// into 'd_elements' are maintained separately (and privately) by each side to
+// avoid a division per operation.
+//
+// The counts are published with sequentially consistent stores, and the
+// "waiting" flags are read immediately afterwards.  A waiting side sets its
+// flag (also sequentially consistently) and then re-checks the counts before
+// blocking, which guarantees that a push (or pop) racing with the decision to
+// block either is seen by the waiter, or sees the flag and posts the
+// semaphore.  The flag is cleared with a compare-and-swap by exactly one of
+// the two sides, so every post is consumed by exactly one wait.
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+// ----------------------------- END-OF-FILE ----------------------------------
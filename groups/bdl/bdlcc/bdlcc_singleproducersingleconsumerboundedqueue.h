@@ -0,0 +1,746 @@
+// bdlcc_singleproducersingleconsumerboundedqueue.h                   -*-C++-*-
+#ifndef INCLUDED_BDLCC_SINGLEPRODUCERSINGLECONSUMERBOUNDEDQUEUE
+#define INCLUDED_BDLCC_SINGLEPRODUCERSINGLECONSUMERBOUNDEDQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a wait-free single-producer/single-consumer bounded queue.
+//
+//@CLASSES:
+//  bdlcc::SingleProducerSingleConsumerBoundedQueue: SPSC ring of 'TYPE'
+//
+//@SEE_ALSO: bdlcc_fixedqueue, bdlcc_boundedqueue
+//
+//@DESCRIPTION: This component defines a type,
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue', that provides a
+// fixed-capacity queue of values for the common case of a hand-off from
+// exactly one producing thread to exactly one consuming thread (for example,
+// a network reader feeding a decoder).  Restricting each end of the queue to
+// a single thread allows the push and pop operations to be implemented
+// without any read-modify-write atomic operations: the producer owns the back
+// index, the consumer owns the front index, and each side publishes its
+// progress to the other with a single atomic store.  The non-blocking
+// operations are therefore wait-free.
+//
+// The producer-owned and consumer-owned state are kept on separate cache
+// lines, and each side caches the most recently observed position of the
+// other side, so that, in the steady state, a push or pop touches a cache
+// line owned by the other thread only when the queue appears full (to the
+// producer) or empty (to the consumer).
+//
+///Thread Safety
+///-------------
+// At most one thread may invoke the producer methods ('pushBack',
+// 'tryPushBack', 'reservePushBack', 'tryReservePushBack', and
+// 'commitPushBack'), and at most one thread may invoke the consumer methods
+// ('popFront', 'tryPopFront', 'reservePopFront', 'tryReservePopFront',
+// 'commitPopFront', and 'removeAll'), at any one time.  The producer and the
+// consumer may (and typically do) run concurrently.  The thread acting as the
+// producer (or consumer) may change over the lifetime of the queue provided
+// that the hand-off between those threads is externally synchronized.  The
+// accessors may be invoked from any thread, though their results are only a
+// snapshot of a state that may be changing.
+//
+///Blocking
+///--------
+// The blocking methods ('pushBack', 'popFront', 'reservePushBack', and
+// 'reservePopFront') first poll the queue a bounded number of times, which,
+// for a hand-off between two busy threads, avoids the cost of a system call
+// entirely.  If the queue remains full (or empty), the calling thread then
+// announces that it is waiting and blocks on a 'bslmt::Semaphore' (which, on
+// Linux, is implemented over a futex), and is woken by the next operation of
+// the other side.  A side that is not waiting never touches the semaphores.
+//
+///Zero-Copy Operations
+///--------------------
+// In addition to the copying 'pushBack' and 'popFront' methods, the queue
+// allows elements to be constructed and consumed in place.
+// 'reservePushBack' (or 'tryReservePushBack') returns the address of the
+// uninitialized storage for the next element; the producer constructs a
+// 'TYPE' object at that address and then calls 'commitPushBack' to make it
+// visible to the consumer.  Similarly, 'reservePopFront' (or
+// 'tryReservePopFront') returns the address of the front element, which the
+// consumer may use in place before calling 'commitPopFront' to destroy it and
+// release its storage to the producer.  Each side may have at most one
+// outstanding reservation.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue' is a template that is
+// parameterized on the type of element contained within the queue.  The
+// supplied template argument, 'TYPE', must provide a copy constructor (for
+// 'pushBack' and 'tryPushBack') and an assignment operator (for 'popFront' and
+// 'tryPopFront').  If 'TYPE' declares the 'bslma::UsesBslmaAllocator' trait,
+// the allocator of the queue is propagated to the elements copied into the
+// queue by 'pushBack' and 'tryPushBack'.
+//
+///Exception Safety
+///----------------
+// If the copy constructor of 'TYPE' throws during a push, the queue is
+// unchanged.  If the assignment operator of 'TYPE' throws during a pop, the
+// element remains at the front of the queue.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Buffers Between Two Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example a reader thread hands fixed-size messages to a
+// decoder thread.  The messages are constructed directly in the queue's
+// storage, and decoded in place, so no copy of a message is ever made.
+//
+// First, we define the message type:
+//..
+//  struct Message {
+//      int  d_length;
+//      char d_data[64];
+//  };
+//..
+// Then, we define the decoder, which sums the first byte of each message
+// until it receives a message of length 0:
+//..
+//  void decoder(bdlcc::SingleProducerSingleConsumerBoundedQueue<Message> *q,
+//               int                                                    *sum)
+//  {
+//      for (;;) {
+//          Message *message = q->reservePopFront();
+//          if (0 == message->d_length) {
+//              q->commitPopFront();
+//              return;                                               // RETURN
+//          }
+//          *sum += message->d_data[0];
+//          q->commitPopFront();
+//      }
+//  }
+//..
+// Next, we create the queue and start the decoder:
+//..
+//  bdlcc::SingleProducerSingleConsumerBoundedQueue<Message> queue(16);
+//
+//  int                       sum = 0;
+//  bslmt::ThreadUtil::Handle handle;
+//  int rc = bslmt::ThreadUtil::create(
+//                               &handle,
+//                               bdlf::BindUtil::bind(&decoder, &queue, &sum));
+//  assert(0 == rc);
+//..
+// Then, the reader (here, the main thread) fills 100 messages in place,
+// followed by an empty message to terminate the decoder:
+//..
+//  for (int i = 0; i <= 100; ++i) {
+//      Message *message = new (queue.reservePushBack()) Message();
+//      message->d_length  = i < 100 ? 1 : 0;
+//      message->d_data[0] = 1;
+//      queue.commitPushBack();
+//  }
+//..
+// Finally, we join the decoder and check that it saw every message:
+//..
+//  bslmt::ThreadUtil::join(handle);
+//  assert(100 == sum);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_SEMAPHORE
+#include <bslmt_semaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+            // ==============================================
+            // class SingleProducerSingleConsumerBoundedQueue
+            // ==============================================
+
+template <class TYPE>
+class SingleProducerSingleConsumerBoundedQueue {
+    // This class provides a wait-free, bounded queue of values transferred
+    // from a single producing thread to a single consuming thread.
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE,
+        k_SPIN_COUNT      = 1024  // number of times a blocking method polls
+                                  // the queue before waiting on a semaphore
+    };
+
+    // DATA
+
+    // Shared, read-only, state.
+
+    TYPE               *d_elements;         // array of elements (manually
+                                            // constructed and destroyed;
+                                            // unused elements hold
+                                            // uninitialized memory)
+
+    const int           d_capacity;         // number of elements in
+                                            // 'd_elements'
+
+    bslma::Allocator   *d_allocator_p;      // allocator, held not owned
+
+    const char          d_sharedPad[k_CACHE_LINE_SIZE];
+                                            // padding to prevent false
+                                            // sharing
+
+    // Producer state: 'd_pushCount' is written only by the producer.
+
+    bsls::AtomicInt64   d_pushCount;        // number of elements ever pushed
+
+    bsls::Types::Int64  d_cachedPopCount;   // value of 'd_popCount' most
+                                            // recently observed by the
+                                            // producer
+
+    int                 d_pushIndex;        // index of the next element to be
+                                            // pushed
+
+    const char          d_pushPad[k_CACHE_LINE_SIZE];
+                                            // padding to prevent false
+                                            // sharing
+
+    // Consumer state: 'd_popCount' is written only by the consumer.
+
+    bsls::AtomicInt64   d_popCount;         // number of elements ever popped
+
+    bsls::Types::Int64  d_cachedPushCount;  // value of 'd_pushCount' most
+                                            // recently observed by the
+                                            // consumer
+
+    int                 d_popIndex;         // index of the next element to be
+                                            // popped
+
+    const char          d_popPad[k_CACHE_LINE_SIZE];
+                                            // padding to prevent false
+                                            // sharing
+
+    // Blocking state: touched only when one side must wait.
+
+    bsls::AtomicInt     d_consumerWaiting;  // 1 if the consumer is (about to
+                                            // be) blocked on 'd_popSema', and
+                                            // 0 otherwise
+
+    bsls::AtomicInt     d_producerWaiting;  // 1 if the producer is (about to
+                                            // be) blocked on 'd_pushSema', and
+                                            // 0 otherwise
+
+    bslmt::Semaphore    d_popSema;          // semaphore on which a blocked
+                                            // consumer waits
+
+    bslmt::Semaphore    d_pushSema;         // semaphore on which a blocked
+                                            // producer waits
+
+  private:
+    // NOT IMPLEMENTED
+    SingleProducerSingleConsumerBoundedQueue(
+                              const SingleProducerSingleConsumerBoundedQueue&);
+    SingleProducerSingleConsumerBoundedQueue& operator=(
+                              const SingleProducerSingleConsumerBoundedQueue&);
+
+    // PRIVATE MANIPULATORS
+    bool isFullForProducer();
+        // Return 'true' if the producer may not push an element, and 'false'
+        // otherwise.  Refresh 'd_cachedPopCount' if the queue appears full
+        // based on its previous value.  The behavior is undefined unless
+        // invoked from the producer thread.
+
+    bool isEmptyForConsumer();
+        // Return 'true' if the consumer may not pop an element, and 'false'
+        // otherwise.  Refresh 'd_cachedPushCount' if the queue appears empty
+        // based on its previous value.  The behavior is undefined unless
+        // invoked from the consumer thread.
+
+    void waitUntilNotEmpty();
+        // Block until the queue is not empty.  The behavior is undefined
+        // unless invoked from the consumer thread.
+
+    void waitUntilNotFull();
+        // Block until the queue is not full.  The behavior is undefined unless
+        // invoked from the producer thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SingleProducerSingleConsumerBoundedQueue,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    SingleProducerSingleConsumerBoundedQueue(
+                                      bsl::size_t       capacity,
+                                      bslma::Allocator *basicAllocator = 0);
+        // Create a queue having the specified 'capacity'.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < capacity' and 'capacity' is representable as
+        // an 'int'.
+
+    ~SingleProducerSingleConsumerBoundedQueue();
+        // Destroy this object, and any elements it contains.  The behavior is
+        // undefined unless neither side holds an outstanding reservation.
+
+    // MANIPULATORS
+
+    // Producer Methods
+
+    void pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue, blocking
+        // until space is available if necessary.
+
+    int tryPushBack(const TYPE& value);
+        // Attempt to append the specified 'value' to the back of this queue
+        // without blocking.  Return 0 on success, and a non-zero value if the
+        // queue is full.
+
+    TYPE *reservePushBack();
+        // Return the address of the uninitialized storage for the element at
+        // the back of this queue, blocking until space is available if
+        // necessary.  The caller must construct a 'TYPE' object at the
+        // returned address and then call 'commitPushBack'.  The behavior is
+        // undefined if the producer holds an outstanding reservation.
+
+    TYPE *tryReservePushBack();
+        // Return the address of the uninitialized storage for the element at
+        // the back of this queue, or 0 if the queue is full, without blocking.
+        // If the returned value is not 0, the caller must construct a 'TYPE'
+        // object at the returned address and then call 'commitPushBack'.  The
+        // behavior is undefined if the producer holds an outstanding
+        // reservation.
+
+    void commitPushBack();
+        // Append the element constructed at the address returned by the
+        // outstanding 'reservePushBack' or 'tryReservePushBack' to this queue,
+        // and release that reservation.  The behavior is undefined unless the
+        // producer holds an outstanding reservation, and a 'TYPE' object has
+        // been constructed at its address.
+
+    // Consumer Methods
+
+    void popFront(TYPE *value);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value', blocking until an element is
+        // available if necessary.
+
+    int tryPopFront(TYPE *value);
+        // Attempt to remove the element from the front of this queue without
+        // blocking, and, if successful, load the specified 'value' with the
+        // removed element.  Return 0 on success, and a non-zero value if the
+        // queue was empty.  On failure, 'value' is not changed.
+
+    TYPE *reservePopFront();
+        // Return the address of the element at the front of this queue,
+        // blocking until an element is available if necessary.  The element
+        // remains in the queue, and may be used (and modified) in place,
+        // until 'commitPopFront' is called.  The behavior is undefined if the
+        // consumer holds an outstanding reservation.
+
+    TYPE *tryReservePopFront();
+        // Return the address of the element at the front of this queue, or 0
+        // if the queue is empty, without blocking.  If the returned value is
+        // not 0, the element remains in the queue, and may be used (and
+        // modified) in place, until 'commitPopFront' is called.  The behavior
+        // is undefined if the consumer holds an outstanding reservation.
+
+    void commitPopFront();
+        // Destroy the element at the address returned by the outstanding
+        // 'reservePopFront' or 'tryReservePopFront', remove it from this
+        // queue, and release that reservation.  The behavior is undefined
+        // unless the consumer holds an outstanding reservation.
+
+    void removeAll();
+        // Remove all the elements from this queue.  Note that this method is a
+        // consumer method; the queue may not be empty on return if the
+        // producer is concurrently pushing elements.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of elements that may be stored in this
+        // queue.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue is empty (has no elements), or 'false'
+        // otherwise.
+
+    bool isFull() const;
+        // Return 'true' if this queue is full (when the number of elements
+        // currently in this queue equals its capacity), or 'false' otherwise.
+
+    int numElements() const;
+        // Return the number of elements currently in this queue.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+            // ----------------------------------------------
+            // class SingleProducerSingleConsumerBoundedQueue
+            // ----------------------------------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+bool SingleProducerSingleConsumerBoundedQueue<TYPE>::isFullForProducer()
+{
+    const bsls::Types::Int64 pushCount = d_pushCount.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                pushCount - d_cachedPopCount == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Acquire the consumer's progress, which orders the consumer's
+        // destruction of the popped elements before our reuse of their
+        // storage.
+
+        d_cachedPopCount = d_popCount.loadAcquire();
+        return pushCount - d_cachedPopCount == d_capacity;            // RETURN
+    }
+    return false;
+}
+
+template <class TYPE>
+inline
+bool SingleProducerSingleConsumerBoundedQueue<TYPE>::isEmptyForConsumer()
+{
+    const bsls::Types::Int64 popCount = d_popCount.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                           popCount == d_cachedPushCount)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Acquire the producer's progress, which orders the producer's
+        // construction of the pushed elements before our use of them.
+
+        d_cachedPushCount = d_pushCount.loadAcquire();
+        return popCount == d_cachedPushCount;                         // RETURN
+    }
+    return false;
+}
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::waitUntilNotEmpty()
+{
+    for (int i = 0; i < k_SPIN_COUNT; ++i) {
+        if (!isEmptyForConsumer()) {
+            return;                                                   // RETURN
+        }
+    }
+
+    // Announce that we are waiting, then check the queue again.  Both the
+    // announcement and the check (in 'isEmpty') are sequentially consistent,
+    // as are the producer's update of 'd_pushCount' and its subsequent check
+    // of 'd_consumerWaiting' (in 'commitPushBack'), so either we observe the
+    // new element or the producer observes our announcement.
+
+    d_consumerWaiting = 1;
+    if (isEmpty()) {
+        d_popSema.wait();
+    }
+    else if (1 != d_consumerWaiting.testAndSwap(1, 0)) {
+        // The producer has already claimed our announcement, and so will post
+        // (or has posted) the semaphore: consume that post.
+
+        d_popSema.wait();
+    }
+}
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::waitUntilNotFull()
+{
+    for (int i = 0; i < k_SPIN_COUNT; ++i) {
+        if (!isFullForProducer()) {
+            return;                                                   // RETURN
+        }
+    }
+
+    // See 'waitUntilNotEmpty'.
+
+    d_producerWaiting = 1;
+    if (isFull()) {
+        d_pushSema.wait();
+    }
+    else if (1 != d_producerWaiting.testAndSwap(1, 0)) {
+        d_pushSema.wait();
+    }
+}
+
+// CREATORS
+template <class TYPE>
+SingleProducerSingleConsumerBoundedQueue<TYPE>::
+                       SingleProducerSingleConsumerBoundedQueue(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_elements(0)
+, d_capacity(static_cast<int>(capacity))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_sharedPad()
+, d_pushCount(0)
+, d_cachedPopCount(0)
+, d_pushIndex(0)
+, d_pushPad()
+, d_popCount(0)
+, d_cachedPushCount(0)
+, d_popIndex(0)
+, d_popPad()
+, d_consumerWaiting(0)
+, d_producerWaiting(0)
+, d_popSema()
+, d_pushSema()
+{
+    BSLS_ASSERT(0 < d_capacity);
+
+    d_elements = static_cast<TYPE *>(
+                             d_allocator_p->allocate(capacity * sizeof(TYPE)));
+}
+
+template <class TYPE>
+SingleProducerSingleConsumerBoundedQueue<TYPE>::
+                                   ~SingleProducerSingleConsumerBoundedQueue()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_elements);
+}
+
+// MANIPULATORS
+
+// Producer Methods
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::pushBack(
+                                                             const TYPE& value)
+{
+    bslalg::ScalarPrimitives::copyConstruct(reservePushBack(),
+                                            value,
+                                            d_allocator_p);
+    commitPushBack();
+}
+
+template <class TYPE>
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPushBack(
+                                                             const TYPE& value)
+{
+    TYPE *address = tryReservePushBack();
+    if (0 == address) {
+        return 1;                                                     // RETURN
+    }
+    bslalg::ScalarPrimitives::copyConstruct(address, value, d_allocator_p);
+    commitPushBack();
+    return 0;
+}
+
+template <class TYPE>
+TYPE *SingleProducerSingleConsumerBoundedQueue<TYPE>::reservePushBack()
+{
+    while (isFullForProducer()) {
+        waitUntilNotFull();
+    }
+    return d_elements + d_pushIndex;
+}
+
+template <class TYPE>
+inline
+TYPE *SingleProducerSingleConsumerBoundedQueue<TYPE>::tryReservePushBack()
+{
+    return isFullForProducer() ? 0 : d_elements + d_pushIndex;
+}
+
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::commitPushBack()
+{
+    if (++d_pushIndex == d_capacity) {
+        d_pushIndex = 0;
+    }
+
+    // Publish the element with a sequentially consistent store (see
+    // 'waitUntilNotEmpty').
+
+    d_pushCount = d_pushCount.loadRelaxed() + 1;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_consumerWaiting.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (1 == d_consumerWaiting.testAndSwap(1, 0)) {
+            d_popSema.post();
+        }
+    }
+}
+
+// Consumer Methods
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::popFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    *value = *reservePopFront();
+    commitPopFront();
+}
+
+template <class TYPE>
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    TYPE *address = tryReservePopFront();
+    if (0 == address) {
+        return 1;                                                     // RETURN
+    }
+    *value = *address;
+    commitPopFront();
+    return 0;
+}
+
+template <class TYPE>
+TYPE *SingleProducerSingleConsumerBoundedQueue<TYPE>::reservePopFront()
+{
+    while (isEmptyForConsumer()) {
+        waitUntilNotEmpty();
+    }
+    return d_elements + d_popIndex;
+}
+
+template <class TYPE>
+inline
+TYPE *SingleProducerSingleConsumerBoundedQueue<TYPE>::tryReservePopFront()
+{
+    return isEmptyForConsumer() ? 0 : d_elements + d_popIndex;
+}
+
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::commitPopFront()
+{
+    bslalg::ScalarDestructionPrimitives::destroy(d_elements + d_popIndex);
+
+    if (++d_popIndex == d_capacity) {
+        d_popIndex = 0;
+    }
+
+    // Release the storage with a sequentially consistent store (see
+    // 'waitUntilNotFull').
+
+    d_popCount = d_popCount.loadRelaxed() + 1;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_producerWaiting.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (1 == d_producerWaiting.testAndSwap(1, 0)) {
+            d_pushSema.post();
+        }
+    }
+}
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::removeAll()
+{
+    while (tryReservePopFront()) {
+        commitPopFront();
+    }
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class TYPE>
+inline
+bool SingleProducerSingleConsumerBoundedQueue<TYPE>::isEmpty() const
+{
+    return 0 == numElements();
+}
+
+template <class TYPE>
+inline
+bool SingleProducerSingleConsumerBoundedQueue<TYPE>::isFull() const
+{
+    return d_capacity == numElements();
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::numElements() const
+{
+    // Load the pop count first: as the push count never falls behind it, the
+    // difference is never negative, though (as the counts may advance between
+    // the loads) it may exceed the capacity.
+
+    const bsls::Types::Int64 popCount  = d_popCount.load();
+    const bsls::Types::Int64 pushCount = d_pushCount.load();
+    const bsls::Types::Int64 length    = pushCount - popCount;
+
+    return length < d_capacity ? static_cast<int>(length) : d_capacity;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1071 @@
+// bdlcc_singleproducersingleconsumerboundedqueue.t.cpp               -*-C++-*-
+#include <bdlcc_singleproducersingleconsumerboundedqueue.h>
+
+#include <bdlcc_fixedqueue.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue' is a ring buffer whose two
+// ends are each used by a single thread.  We first verify the single-threaded
+// behavior of every method, including the wrap-around of the indices and the
+// management of element lifetimes, and then verify the blocking methods and
+// the integrity and order of values transferred between two threads running
+// concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SingleProducerSingleConsumerBoundedQueue(size_t, Allocator * = 0);
+// [ 2] ~SingleProducerSingleConsumerBoundedQueue();
+//
+// MANIPULATORS
+// [ 4] void pushBack(const TYPE&);
+// [ 2] int tryPushBack(const TYPE&);
+// [ 4] TYPE *reservePushBack();
+// [ 3] TYPE *tryReservePushBack();
+// [ 3] void commitPushBack();
+// [ 4] void popFront(TYPE *);
+// [ 2] int tryPopFront(TYPE *);
+// [ 4] TYPE *reservePopFront();
+// [ 3] TYPE *tryReservePopFront();
+// [ 3] void commitPopFront();
+// [ 2] void removeAll();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] bool isFull() const;
+// [ 2] int numElements() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 5] CONCERN: exception safety
+// [ 6] CONCERN: concurrent producer and consumer
+// [-1] PERFORMANCE: hand-off latency compared with 'bdlcc::FixedQueue'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<int> Obj;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class ExceptionTester {
+    // This class provides a value-semantic type whose copy constructor and
+    // assignment operator throw, when armed, once a specified number of copies
+    // have been made.
+
+  public:
+    // CLASS DATA
+    static int s_copiesUntilThrow;  // number of copies to allow before
+                                    // throwing; negative to never throw
+
+    // DATA
+    int d_value;
+
+    // CREATORS
+    explicit ExceptionTester(int value = 0)
+    : d_value(value)
+    {
+    }
+
+    ExceptionTester(const ExceptionTester& original)
+    : d_value(original.d_value)
+    {
+        maybeThrow();
+    }
+
+    // MANIPULATORS
+    ExceptionTester& operator=(const ExceptionTester& rhs)
+    {
+        maybeThrow();
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // CLASS METHODS
+    static void maybeThrow()
+    {
+        if (0 == s_copiesUntilThrow) {
+            s_copiesUntilThrow = -1;
+            throw 1;
+        }
+        if (0 < s_copiesUntilThrow) {
+            --s_copiesUntilThrow;
+        }
+    }
+};
+
+int ExceptionTester::s_copiesUntilThrow = -1;
+
+class CountedObject {
+    // This class counts the number of its instances in existence.
+
+  public:
+    // CLASS DATA
+    static bsls::AtomicInt s_count;
+
+    // DATA
+    int d_value;
+
+    // CREATORS
+    explicit CountedObject(int value = 0)
+    : d_value(value)
+    {
+        ++s_count;
+    }
+
+    CountedObject(const CountedObject& original)
+    : d_value(original.d_value)
+    {
+        ++s_count;
+    }
+
+    ~CountedObject()
+    {
+        --s_count;
+    }
+
+    // MANIPULATORS
+    CountedObject& operator=(const CountedObject& rhs)
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+};
+
+bsls::AtomicInt CountedObject::s_count(0);
+
+namespace CONCURRENCY_TEST {
+
+void producer(Obj *queue, int numValues)
+    // Push the values 1 to the specified 'numValues' onto the specified
+    // 'queue', cycling through the different push methods, followed by 0.
+{
+    for (int i = 1; i <= numValues; ++i) {
+        switch (i % 4) {
+          case 0: {
+            queue->pushBack(i);
+          } break;
+          case 1: {
+            while (0 != queue->tryPushBack(i)) {
+                bslmt::ThreadUtil::yield();
+            }
+          } break;
+          case 2: {
+            new (queue->reservePushBack()) int(i);
+            queue->commitPushBack();
+          } break;
+          default: {
+            int *address;
+            while (0 == (address = queue->tryReservePushBack())) {
+                bslmt::ThreadUtil::yield();
+            }
+            *address = i;
+            queue->commitPushBack();
+          } break;
+        }
+    }
+    queue->pushBack(0);
+}
+
+void consumer(Obj *queue, int *numPopped)
+    // Pop values from the specified 'queue', cycling through the different
+    // pop methods, until 0 is popped, verifying that the values are popped in
+    // increasing order, and load the number of (non-zero) values popped into
+    // the specified 'numPopped'.
+{
+    int expected = 1;
+    for (int i = 0;; ++i) {
+        int value;
+        switch (i % 4) {
+          case 0: {
+            queue->popFront(&value);
+          } break;
+          case 1: {
+            while (0 != queue->tryPopFront(&value)) {
+                bslmt::ThreadUtil::yield();
+            }
+          } break;
+          case 2: {
+            value = *queue->reservePopFront();
+            queue->commitPopFront();
+          } break;
+          default: {
+            int *address;
+            while (0 == (address = queue->tryReservePopFront())) {
+                bslmt::ThreadUtil::yield();
+            }
+            value = *address;
+            queue->commitPopFront();
+          } break;
+        }
+        if (0 == value) {
+            break;
+        }
+        ASSERTT(expected == value);
+        expected = value + 1;
+    }
+    *numPopped = expected - 1;
+}
+
+void pingPong(Obj *request, Obj *response, int numRoundTrips)
+    // Pop 'numRoundTrips' values from the specified 'request' queue, and push
+    // each one onto the specified 'response' queue.
+{
+    for (int i = 0; i < numRoundTrips; ++i) {
+        int value;
+        request->popFront(&value);
+        response->pushBack(value);
+    }
+}
+
+void fixedPingPong(bdlcc::FixedQueue<int> *request,
+                   bdlcc::FixedQueue<int> *response,
+                   int                     numRoundTrips)
+    // Pop 'numRoundTrips' values from the specified 'request' queue, and push
+    // each one onto the specified 'response' queue.
+{
+    for (int i = 0; i < numRoundTrips; ++i) {
+        response->pushBack(request->popFront());
+    }
+}
+
+}  // close namespace CONCURRENCY_TEST
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Buffers Between Two Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example a reader thread hands fixed-size messages to a
+// decoder thread.  The messages are constructed directly in the queue's
+// storage, and decoded in place, so no copy of a message is ever made.
+//
+// First, we define the message type:
+//..
+    struct Message {
+        int  d_length;
+        char d_data[64];
+    };
+//..
+// Then, we define the decoder, which sums the first byte of each message
+// until it receives a message of length 0:
+//..
+    void decoder(bdlcc::SingleProducerSingleConsumerBoundedQueue<Message> *q,
+                 int                                                    *sum)
+    {
+        for (;;) {
+            Message *message = q->reservePopFront();
+            if (0 == message->d_length) {
+                q->commitPopFront();
+                return;                                               // RETURN
+            }
+            *sum += message->d_data[0];
+            q->commitPopFront();
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Next, we create the queue and start the decoder:
+//..
+    bdlcc::SingleProducerSingleConsumerBoundedQueue<Message> queue(16);
+
+    int                       sum = 0;
+    bslmt::ThreadUtil::Handle handle;
+    int rc = bslmt::ThreadUtil::create(
+                                 &handle,
+                                 bdlf::BindUtil::bind(&decoder, &queue, &sum));
+    ASSERT(0 == rc);
+//..
+// Then, the reader (here, the main thread) fills 100 messages in place,
+// followed by an empty message to terminate the decoder:
+//..
+    for (int i = 0; i <= 100; ++i) {
+        Message *message = new (queue.reservePushBack()) Message();
+        message->d_length  = i < 100 ? 1 : 0;
+        message->d_data[0] = 1;
+        queue.commitPushBack();
+    }
+//..
+// Finally, we join the decoder and check that it saw every message:
+//..
+    bslmt::ThreadUtil::join(handle);
+    ASSERT(100 == sum);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: concurrent producer and consumer
+        //
+        // Concerns:
+        //: 1 Every value pushed by the producer is popped by the consumer,
+        //:   exactly once and in order, for any capacity, and whichever
+        //:   combination of push and pop methods is used.
+        //:
+        //: 2 Neither side blocks indefinitely, whether the queue is mostly
+        //:   full or mostly empty.
+        //
+        // Plan:
+        //: 1 For a range of capacities, run a producer thread that pushes an
+        //:   increasing sequence of values (cycling through the push methods)
+        //:   and a consumer thread that pops and verifies them (cycling
+        //:   through the pop methods).  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: concurrent producer and consumer
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: concurrent producer and consumer"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        using namespace CONCURRENCY_TEST;
+
+        const int CAPACITIES[] = { 1, 2, 3, 7, 64, 1000 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        const int NUM_VALUES = 200000;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            const int CAPACITY = CAPACITIES[ti];
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+            int numPopped = 0;
+
+            bslmt::ThreadUtil::Handle producerHandle, consumerHandle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                 &consumerHandle,
+                                 bdlf::BindUtil::bind(&consumer,
+                                                      &mX,
+                                                      &numPopped)));
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                 &producerHandle,
+                                 bdlf::BindUtil::bind(&producer,
+                                                      &mX,
+                                                      NUM_VALUES)));
+            bslmt::ThreadUtil::join(producerHandle);
+            bslmt::ThreadUtil::join(consumerHandle);
+
+            ASSERTV(CAPACITY, numPopped, NUM_VALUES == numPopped);
+            ASSERTV(CAPACITY, X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: exception safety
+        //
+        // Concerns:
+        //: 1 If the copy constructor throws during a push, the queue is
+        //:   unchanged.
+        //:
+        //: 2 If the assignment operator throws during a pop, the element
+        //:   remains at the front of the queue.
+        //
+        // Plan:
+        //: 1 Arm 'ExceptionTester' to throw during each of 'tryPushBack',
+        //:   'pushBack', 'tryPopFront', and 'popFront', and verify the
+        //:   contents of the queue afterwards.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: exception safety
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: exception safety" << endl
+                          << "=========================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<
+                                                       ExceptionTester> TObj;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            TObj mX(3, &ta);  const TObj& X = mX;
+
+            mX.pushBack(ExceptionTester(1));
+
+            for (int i = 0; i < 2; ++i) {
+                ExceptionTester::s_copiesUntilThrow = 0;
+                bool caught = false;
+                try {
+                    if (i) {
+                        mX.pushBack(ExceptionTester(2));
+                    }
+                    else {
+                        mX.tryPushBack(ExceptionTester(2));
+                    }
+                }
+                catch (...) {
+                    caught = true;
+                }
+                ASSERTV(i, caught);
+                ASSERTV(i, 1 == X.numElements());
+            }
+
+            ASSERT(0 == mX.tryPushBack(ExceptionTester(2)));
+
+            for (int i = 0; i < 2; ++i) {
+                ExceptionTester value(-1);
+                ExceptionTester::s_copiesUntilThrow = 0;
+                bool caught = false;
+                try {
+                    if (i) {
+                        mX.popFront(&value);
+                    }
+                    else {
+                        mX.tryPopFront(&value);
+                    }
+                }
+                catch (...) {
+                    caught = true;
+                }
+                ASSERTV(i, caught);
+                ASSERTV(i, -1 == value.d_value);
+                ASSERTV(i, 2 == X.numElements());
+            }
+
+            ExceptionTester value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(1 == value.d_value);
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(2 == value.d_value);
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        ExceptionTester::s_copiesUntilThrow = -1;
+#else
+        if (verbose) cout << "\tExceptions are disabled." << endl;
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCKING METHODS
+        //
+        // Concerns:
+        //: 1 'popFront' and 'reservePopFront' return immediately when the
+        //:   queue is not empty, and otherwise block until an element is
+        //:   pushed.
+        //:
+        //: 2 'pushBack' and 'reservePushBack' return immediately when the
+        //:   queue is not full, and otherwise block until an element is
+        //:   popped.
+        //
+        // Plan:
+        //: 1 Call the blocking methods on a queue in a state in which they do
+        //:   not need to block.  (C-1..2)
+        //:
+        //: 2 Block the consumer on an empty queue and the producer on a full
+        //:   queue, releasing each, after a delay long enough for the blocked
+        //:   thread to have stopped polling, from another thread.  (C-1..2)
+        //
+        // Testing:
+        //   void pushBack(const TYPE&);
+        //   TYPE *reservePushBack();
+        //   void popFront(TYPE *);
+        //   TYPE *reservePopFront();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BLOCKING METHODS" << endl
+                          << "========================" << endl;
+
+        using namespace CONCURRENCY_TEST;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            mX.pushBack(1);
+            new (mX.reservePushBack()) int(2);
+            mX.commitPushBack();
+            ASSERT(X.isFull());
+
+            int value;
+            mX.popFront(&value);
+            ASSERT(1 == value);
+            ASSERT(2 == *mX.reservePopFront());
+            mX.commitPopFront();
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\tBlocking consumer." << endl;
+        {
+            Obj mX(2, &ta);  Obj mY(2, &ta);
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                 &handle,
+                                 bdlf::BindUtil::bind(&pingPong,
+                                                      &mX,
+                                                      &mY,
+                                                      10)));
+            for (int i = 0; i < 10; ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+                mX.pushBack(i);
+                int value = -1;
+                mY.popFront(&value);
+                ASSERTV(i, value, i == value);
+            }
+            bslmt::ThreadUtil::join(handle);
+        }
+
+        if (verbose) cout << "\tBlocking producer." << endl;
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            mX.pushBack(0);
+
+            int numPopped = 0;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                 &handle,
+                                 bdlf::BindUtil::bind(&producer, &mX, 10)));
+
+            // The producer blocks on the full queue until we pop the initial
+            // 0; then each push blocks until the consumer below pops.
+
+            bslmt::ThreadUtil::microSleep(50 * 1000);
+            ASSERT(X.isFull());
+
+            int value;
+            mX.popFront(&value);
+            ASSERT(0 == value);
+
+            for (int i = 1; i <= 10; ++i) {
+                bslmt::ThreadUtil::microSleep(5 * 1000);
+                ASSERT(i == *mX.reservePopFront());
+                mX.commitPopFront();
+                ++numPopped;
+            }
+            mX.popFront(&value);
+            ASSERT(0 == value);
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(10 == numPopped);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING ZERO-COPY METHODS
+        //
+        // Concerns:
+        //: 1 'tryReservePushBack' returns the address of the storage of the
+        //:   back element, or 0 if the queue is full, without changing the
+        //:   state of the queue.
+        //:
+        //: 2 'commitPushBack' appends the object constructed at the reserved
+        //:   address without copying it.
+        //:
+        //: 3 'tryReservePopFront' returns the address of the front element, or
+        //:   0 if the queue is empty, without removing it.
+        //:
+        //: 4 'commitPopFront' destroys the front element and removes it.
+        //
+        // Plan:
+        //: 1 Using 'CountedObject', construct elements in place, and inspect
+        //:   and remove them in place, for a range of capacities and across
+        //:   several wrap-arounds, checking the number of objects in existence
+        //:   and the accessors at each step.  (C-1..4)
+        //
+        // Testing:
+        //   TYPE *tryReservePushBack();
+        //   void commitPushBack();
+        //   TYPE *tryReservePopFront();
+        //   void commitPopFront();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ZERO-COPY METHODS" << endl
+                          << "=========================" << endl;
+
+        typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<CountedObject>
+                                                                         CObj;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int capacity = 1; capacity <= 5; ++capacity) {
+            {
+                CObj mX(capacity, &ta);  const CObj& X = mX;
+
+                ASSERT(0 == mX.tryReservePopFront());
+
+                int next = 0;
+                int expected = 0;
+                for (int round = 0; round < 3 * capacity; ++round) {
+                    // Fill the queue.
+
+                    for (int i = 0; i < capacity; ++i) {
+                        CountedObject *address = mX.tryReservePushBack();
+                        ASSERTV(capacity, i, 0 != address);
+
+                        // Reserving again without committing returns the same
+                        // address.
+
+                        ASSERT(address == mX.tryReservePushBack());
+                        ASSERT(i == X.numElements());
+
+                        new (address) CountedObject(next++);
+                        mX.commitPushBack();
+                        ASSERT(i + 1 == X.numElements());
+                        ASSERT(i + 1 == CountedObject::s_count);
+                    }
+                    ASSERT(X.isFull());
+                    ASSERT(0 == mX.tryReservePushBack());
+
+                    // Drain half of it.
+
+                    for (int i = 0; i < (capacity + 1) / 2; ++i) {
+                        CountedObject *address = mX.tryReservePopFront();
+                        ASSERTV(capacity, i, 0 != address);
+                        ASSERT(address == mX.tryReservePopFront());
+                        ASSERTV(capacity, expected, address->d_value,
+                                expected == address->d_value);
+                        ++expected;
+
+                        const int count = CountedObject::s_count;
+                        mX.commitPopFront();
+                        ASSERT(count - 1 == CountedObject::s_count);
+                    }
+
+                    // Drain the rest with 'tryPopFront' but for one element.
+
+                    while (1 < X.numElements()) {
+                        CountedObject value;
+                        ASSERT(0 == mX.tryPopFront(&value));
+                        ASSERT(expected == value.d_value);
+                        ++expected;
+                    }
+
+                    // Drain the last element.
+
+                    if (1 == X.numElements()) {
+                        ASSERT(expected == mX.tryReservePopFront()->d_value);
+                        ++expected;
+                        mX.commitPopFront();
+                    }
+                    ASSERT(X.isEmpty());
+                    ASSERT(0 == CountedObject::s_count);
+                }
+
+                // Leave elements in the queue to be destroyed by the
+                // destructor.
+
+                for (int i = 0; i < capacity; ++i) {
+                    new (mX.tryReservePushBack()) CountedObject(i);
+                    mX.commitPushBack();
+                }
+                ASSERT(capacity == CountedObject::s_count);
+            }
+            ASSERT(0 == CountedObject::s_count);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING COPYING METHODS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The queue uses the supplied allocator (and the default allocator
+        //:   if none is supplied), and releases all memory on destruction.
+        //:
+        //: 2 Values are popped in the order in which they were pushed, across
+        //:   many wrap-arounds of the underlying buffer.
+        //:
+        //: 3 'tryPushBack' fails on a full queue, and 'tryPopFront' fails on
+        //:   an empty queue leaving 'value' unchanged.
+        //:
+        //: 4 The accessors reflect the state of the queue.
+        //:
+        //: 5 'removeAll' empties the queue and destroys its elements, and the
+        //:   destructor destroys any remaining elements.
+        //:
+        //: 6 The allocator is propagated to the elements.
+        //
+        // Plan:
+        //: 1 Push and pop values through queues of a range of capacities,
+        //:   checking the accessors at each step.  (C-1..4)
+        //:
+        //: 2 Fill a queue of 'bsl::string' with long strings and call
+        //:   'removeAll', then refill it and destroy it; verify memory use.
+        //:   (C-5..6)
+        //
+        // Testing:
+        //   SingleProducerSingleConsumerBoundedQueue(size_t, Allocator * = 0);
+        //   ~SingleProducerSingleConsumerBoundedQueue();
+        //   int tryPushBack(const TYPE&);
+        //   int tryPopFront(TYPE *);
+        //   void removeAll();
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   int numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COPYING METHODS AND ACCESSORS" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int capacity = 1; capacity <= 10; ++capacity) {
+            Obj mX(capacity, &ta);  const Obj& X = mX;
+            ASSERT(0 < ta.numBytesInUse());
+
+            ASSERT(capacity == X.capacity());
+            ASSERT(X.isEmpty());
+            ASSERT(!X.isFull());
+            ASSERT(0 == X.numElements());
+
+            int value = -1;
+            ASSERT(0 != mX.tryPopFront(&value));
+            ASSERT(-1 == value);
+
+            int next     = 0;
+            int expected = 0;
+            for (int round = 0; round < 5; ++round) {
+                // Push a number of values that is not a multiple of the
+                // capacity to exercise every wrap-around position.
+
+                const int NUM_PUSH = round % 2 ? capacity : capacity / 2 + 1;
+                for (int i = 0; i < NUM_PUSH; ++i) {
+                    ASSERTV(capacity, round, i, 0 == mX.tryPushBack(next++));
+                    ASSERT(!X.isEmpty());
+                }
+                ASSERTV(capacity, NUM_PUSH == X.numElements());
+                ASSERT((NUM_PUSH == capacity) == X.isFull());
+
+                if (X.isFull()) {
+                    ASSERT(0 != mX.tryPushBack(next));
+                    ASSERT(capacity == X.numElements());
+                }
+
+                while (!X.isEmpty()) {
+                    ASSERT(0 == mX.tryPopFront(&value));
+                    ASSERTV(capacity, expected, value, expected == value);
+                    ++expected;
+                    ASSERT(!X.isFull());
+                }
+                ASSERT(0 == X.numElements());
+                ASSERT(0 != mX.tryPopFront(&value));
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        {
+            bslma::TestAllocator da(veryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            Obj mX(4);
+            ASSERT(0 <  da.numBytesInUse());
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        {
+            const char *LONG = "a string long enough to require an allocation";
+
+            {
+                bdlcc::SingleProducerSingleConsumerBoundedQueue<bsl::string>
+                                                                    mX(5, &ta);
+                const bsls::Types::Int64 BASE = ta.numBytesInUse();
+
+                bslma::TestAllocator sa(veryVeryVerbose);
+                for (int i = 0; i < 5; ++i) {
+                    ASSERT(0 == mX.tryPushBack(bsl::string(LONG, &sa)));
+                }
+                ASSERT(BASE < ta.numBytesInUse());
+                ASSERT(mX.isFull());
+
+                mX.removeAll();
+                ASSERT(mX.isEmpty());
+                ASSERT(BASE == ta.numBytesInUse());
+
+                for (int i = 0; i < 3; ++i) {
+                    ASSERT(0 == mX.tryPushBack(bsl::string(LONG, &sa)));
+                }
+                bsl::string value;
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(LONG == value);
+                ASSERT(2 == mX.numElements());
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push and pop a few values, by copy and in place.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(3, &ta);  const Obj& X = mX;
+
+            ASSERT(3 == X.capacity());
+            ASSERT(X.isEmpty());
+
+            ASSERT(0 == mX.tryPushBack(1));
+            mX.pushBack(2);
+            *mX.tryReservePushBack() = 3;
+            mX.commitPushBack();
+            ASSERT(X.isFull());
+            ASSERT(0 != mX.tryPushBack(4));
+
+            int value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(1 == value);
+            mX.popFront(&value);
+            ASSERT(2 == value);
+            ASSERT(3 == *mX.tryReservePopFront());
+            mX.commitPopFront();
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: hand-off latency compared with 'bdlcc::FixedQueue'
+        //
+        // Concerns:
+        //: 1 A round trip between two threads through a pair of
+        //:   'SingleProducerSingleConsumerBoundedQueue' objects is
+        //:   substantially faster than through a pair of 'bdlcc::FixedQueue'
+        //:   objects.
+        //
+        // Plan:
+        //: 1 Bounce a value between two threads a large number of times using
+        //:   each kind of queue, and report the average round-trip time.
+        //:   Optionally specify the number of round trips as 'argv[2]'.
+        //
+        // Testing:
+        //   PERFORMANCE: hand-off latency compared with 'bdlcc::FixedQueue'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: hand-off latency" << endl
+             << "=============================" << endl;
+
+        using namespace CONCURRENCY_TEST;
+
+        const int NUM_ROUND_TRIPS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        {
+            Obj mX(64);  Obj mY(64);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle,
+                                      bdlf::BindUtil::bind(&pingPong,
+                                                           &mX,
+                                                           &mY,
+                                                           NUM_ROUND_TRIPS));
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_ROUND_TRIPS; ++i) {
+                int value;
+                mX.pushBack(i);
+                mY.popFront(&value);
+            }
+            sw.stop();
+            bslmt::ThreadUtil::join(handle);
+
+            cout << "SingleProducerSingleConsumerBoundedQueue: "
+                 << sw.elapsedTime() * 1e9 / NUM_ROUND_TRIPS
+                 << "ns per round trip" << endl;
+        }
+        {
+            bdlcc::FixedQueue<int> mX(64);  bdlcc::FixedQueue<int> mY(64);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle,
+                                      bdlf::BindUtil::bind(&fixedPingPong,
+                                                           &mX,
+                                                           &mY,
+                                                           NUM_ROUND_TRIPS));
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_ROUND_TRIPS; ++i) {
+                mX.pushBack(i);
+                mY.popFront();
+            }
+            sw.stop();
+            bslmt::ThreadUtil::join(handle);
+
+            cout << "FixedQueue:                               "
+                 << sw.elapsedTime() * 1e9 / NUM_ROUND_TRIPS
+                 << "ns per round trip" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+// ----------------------------- END-OF-FILE ----------------------------------
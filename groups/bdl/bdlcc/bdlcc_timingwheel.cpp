@@ -0,0 +1,287 @@
+// bdlcc_timingwheel.cpp                                              -*-C++-*-
+#include <bdlcc_timingwheel.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_timingwheel_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsl_limits.h>
+
+///Implementation Note
+///===================
+// Let 'C' be the current tick of the wheel.  A node expiring at tick 'T > C'
+// is stored at the level 'L' of the most significant 'k_BITS_PER_LEVEL'-bit
+// digit in which 'T' and 'C' differ, in the slot indexed by that digit of
+// 'T'.  Consequently, the nodes of level 'L' share all digits above 'L' with
+// 'C', and the slots of level 'L' that are occupied all have an index greater
+// than digit 'L' of 'C'.  This has two consequences:
+//
+//: o The earliest non-empty slot of the lowest non-empty level starts before
+//:   every other non-empty slot, and it is found with a single bit scan of the
+//:   occupancy mask of that level.
+//:
+//: o Moving 'C' forward to any tick before the start of that slot preserves
+//:   the invariant without moving any node.
+//
+// 'advance' therefore repeatedly moves 'C' to the start of the earliest
+// non-empty slot (if that start is not past the target tick), and re-places
+// the nodes of that slot relative to the new 'C': each of them either has
+// expired or belongs to a lower level.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+
+inline
+void initSentinel(TimingWheel_Link *sentinel)
+    // Make the specified 'sentinel' an empty list.
+{
+    sentinel->d_next_p = sentinel;
+    sentinel->d_prev_p = sentinel;
+}
+
+inline
+void linkBefore(TimingWheel_Link *position, TimingWheel_Link *link)
+    // Insert the specified 'link' before the specified 'position'.
+{
+    link->d_next_p               = position;
+    link->d_prev_p               = position->d_prev_p;
+    position->d_prev_p->d_next_p = link;
+    position->d_prev_p           = link;
+}
+
+inline
+bsls::Types::Uint64 ceilTick(bsls::Types::Int64 key,
+                             bsls::Types::Int64 resolution)
+    // Return the first tick, of the specified 'resolution', that is not
+    // before the specified 'key'.
+{
+    if (key <= 0) {
+        return 0;                                                     // RETURN
+    }
+    return key / resolution + (0 != key % resolution);
+}
+
+inline
+bsls::Types::Uint64 floorTick(bsls::Types::Int64 key,
+                              bsls::Types::Int64 resolution)
+    // Return the last tick, of the specified 'resolution', that is not after
+    // the specified 'key'.
+{
+    return key <= 0 ? 0 : key / resolution;
+}
+
+}  // close unnamed namespace
+
+                            // ----------------------
+                            // class TimingWheel_Imp
+                            // ----------------------
+
+// PRIVATE MANIPULATORS
+void TimingWheel_Imp::place(TimingWheel_NodeBase *node)
+{
+    const bsls::Types::Uint64 tick = node->d_tick;
+
+    if (tick <= d_currentTick) {
+        linkBefore(&d_ready, node);
+        node->d_location = k_READY;
+        return;                                                       // RETURN
+    }
+
+    const bsl::uint64_t diff    = tick ^ d_currentTick;
+    const int           highBit = 63
+                                - bdlb::BitUtil::numLeadingUnsetBits(diff);
+    const int           level   = highBit / k_BITS_PER_LEVEL;
+    const int           slot    = static_cast<int>(
+                                        (tick >> (level * k_BITS_PER_LEVEL))
+                                      & (k_NUM_SLOTS - 1));
+
+    linkBefore(&d_slots[level][slot], node);
+    d_occupied[level] |= static_cast<bsl::uint64_t>(1) << slot;
+    node->d_location   = level * k_NUM_SLOTS + slot;
+}
+
+void TimingWheel_Imp::unlink(TimingWheel_NodeBase *node)
+{
+    BSLS_ASSERT(k_DETACHED != node->d_location);
+
+    node->d_prev_p->d_next_p = node->d_next_p;
+    node->d_next_p->d_prev_p = node->d_prev_p;
+    node->d_next_p           = 0;
+    node->d_prev_p           = 0;
+
+    if (0 <= node->d_location) {
+        const int level = node->d_location / k_NUM_SLOTS;
+        const int slot  = node->d_location % k_NUM_SLOTS;
+
+        TimingWheel_Link *sentinel = &d_slots[level][slot];
+        if (sentinel->d_next_p == sentinel) {
+            d_occupied[level] &=
+                             ~(static_cast<bsl::uint64_t>(1) << slot);
+        }
+    }
+
+    node->d_location = k_DETACHED;
+}
+
+// PRIVATE ACCESSORS
+int TimingWheel_Imp::firstOccupiedLevel() const
+{
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        if (d_occupied[level]) {
+            return level;                                             // RETURN
+        }
+    }
+    return -1;
+}
+
+bsls::Types::Uint64 TimingWheel_Imp::slotStart(int level) const
+{
+    BSLS_ASSERT(d_occupied[level]);
+
+    const int shift = level * k_BITS_PER_LEVEL;
+    const int slot  = bdlb::BitUtil::numTrailingUnsetBits(d_occupied[level]);
+
+    const bsls::Types::Uint64 highMask =
+                   shift + k_BITS_PER_LEVEL >= 64
+                   ? 0
+                   : ~((static_cast<bsls::Types::Uint64>(1)
+                                           << (shift + k_BITS_PER_LEVEL)) - 1);
+
+    return (d_currentTick & highMask)
+         | (static_cast<bsls::Types::Uint64>(slot) << shift);
+}
+
+// CREATORS
+TimingWheel_Imp::TimingWheel_Imp(bsls::Types::Int64 resolution)
+: d_currentTick(0)
+, d_resolution(resolution)
+, d_length(0)
+{
+    BSLS_ASSERT(0 < resolution);
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+            initSentinel(&d_slots[level][slot]);
+        }
+        d_occupied[level] = 0;
+    }
+    initSentinel(&d_ready);
+}
+
+// MANIPULATORS
+void TimingWheel_Imp::advance(bsls::Types::Int64 now)
+{
+    const bsls::Types::Uint64 target = floorTick(now, d_resolution);
+
+    while (d_currentTick < target) {
+        const int level = firstOccupiedLevel();
+        if (0 > level) {
+            d_currentTick = target;
+            break;
+        }
+
+        const bsls::Types::Uint64 start = slotStart(level);
+        if (start > target) {
+            d_currentTick = target;
+            break;
+        }
+
+        d_currentTick = start;
+
+        // Detach the list of the slot, then re-place its nodes in order.
+
+        const int         slot     = bdlb::BitUtil::numTrailingUnsetBits(
+                                                           d_occupied[level]);
+        TimingWheel_Link *sentinel = &d_slots[level][slot];
+        TimingWheel_Link *link     = sentinel->d_next_p;
+
+        sentinel->d_prev_p->d_next_p = 0;
+        initSentinel(sentinel);
+        d_occupied[level] &= ~(static_cast<bsl::uint64_t>(1) << slot);
+
+        while (link) {
+            TimingWheel_Link *next = link->d_next_p;
+            place(static_cast<TimingWheel_NodeBase *>(link));
+            link = next;
+        }
+    }
+}
+
+TimingWheel_NodeBase *TimingWheel_Imp::first()
+{
+    if (d_ready.d_next_p != &d_ready) {
+        return static_cast<TimingWheel_NodeBase *>(d_ready.d_next_p);
+                                                                      // RETURN
+    }
+
+    const int level = firstOccupiedLevel();
+    if (0 > level) {
+        return 0;                                                     // RETURN
+    }
+
+    const int slot = bdlb::BitUtil::numTrailingUnsetBits(d_occupied[level]);
+    return static_cast<TimingWheel_NodeBase *>(
+                                               d_slots[level][slot].d_next_p);
+}
+
+void TimingWheel_Imp::insert(TimingWheel_NodeBase *node)
+{
+    BSLS_ASSERT(k_DETACHED == node->d_location);
+
+    node->d_tick = ceilTick(node->d_key, d_resolution);
+    place(node);
+    ++d_length;
+}
+
+void TimingWheel_Imp::remove(TimingWheel_NodeBase *node)
+{
+    unlink(node);
+    --d_length;
+}
+
+// ACCESSORS
+int TimingWheel_Imp::nextExpiry(bsls::Types::Int64 *result) const
+{
+    bsls::Types::Uint64 tick;
+
+    if (d_ready.d_next_p != &d_ready) {
+        tick = d_currentTick;
+    }
+    else {
+        const int level = firstOccupiedLevel();
+        if (0 > level) {
+            return -1;                                                // RETURN
+        }
+        tick = slotStart(level);
+    }
+
+    const bsls::Types::Int64 maxValue =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+
+    *result = tick > static_cast<bsls::Types::Uint64>(maxValue / d_resolution)
+              ? maxValue
+              : static_cast<bsls::Types::Int64>(tick) * d_resolution;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
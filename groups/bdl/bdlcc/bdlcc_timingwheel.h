@@ -0,0 +1,1051 @@
+// bdlcc_timingwheel.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#define INCLUDED_BDLCC_TIMINGWHEEL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe hierarchical timing wheel.
+//
+//@CLASSES:
+//  bdlcc::TimingWheel:           thread-safe hierarchical timing wheel
+//  bdlcc::TimingWheelPair:       type for opaque pointers
+//  bdlcc::TimingWheelPairHandle: scope mechanism for safe item references
+//
+//@SEE_ALSO: bdlcc_skiplist, bdlcc_timequeue, bdlmt_eventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe container,
+// 'bdlcc::TimingWheel', that associates objects of a parameterized 'DATA' type
+// with integral expiration times ("keys"), and that hands back those objects
+// once a supplied notion of "now" reaches their expiration times.  Unlike an
+// ordered container such as 'bdlcc::SkipList', a timing wheel does not keep
+// its elements sorted: adding, removing, and rescheduling an element take
+// constant time regardless of the number of elements in the wheel, at the
+// cost of a bounded loss of precision.
+//
+// A timing wheel is constructed with a *resolution*: the length, in key units,
+// of a *tick*.  The key of each element is rounded *up* to a whole number of
+// ticks, and the wheel is advanced, by the 'expiredFrontRaw' method, to the
+// last tick that is not after the supplied 'now' value.  An element therefore
+// never expires before its key, and it expires at most one resolution after
+// it.  Elements whose keys round to the same tick are returned in the order
+// in which they became due, which need not be the order of their keys.
+//
+// The wheel is *hierarchical*: ticks are organized into
+// 'TimingWheel_Imp::k_NUM_LEVELS' levels of 'TimingWheel_Imp::k_NUM_SLOTS'
+// slots each, level 'N' covering ranges of 'k_NUM_SLOTS^N' ticks.  An element
+// is stored in the slot of the coarsest level whose range distinguishes its
+// expiration tick from the current tick, and is moved ("cascaded") to a finer
+// level when the wheel reaches the start of that slot.  Every element is
+// cascaded at most 'k_NUM_LEVELS' times over its lifetime, and the levels
+// span the whole range of 64-bit ticks, so there is no limit on how far in
+// the future an element may be scheduled.  Each level records which of its
+// slots are occupied in a bit mask, so finding the next slot to process does
+// not require scanning empty slots.
+//
+// Associations (pairings of data objects with keys) in the wheel are
+// identified by 'bdlcc::TimingWheelPairHandle' objects or
+// 'bdlcc::TimingWheelPair' pointers, which follow the same rules as their
+// counterparts in 'bdlcc_skiplist': a 'bdlcc::TimingWheelPair' pointer
+// obtained from the "raw" API must be released (using 'releaseReferenceRaw')
+// exactly once, and a pair remains valid (though possibly no longer in the
+// wheel) for as long as a reference to it is outstanding.
+//
+///Waking Up a Dispatcher
+///----------------------
+// A thread consuming expired elements typically sleeps until the next element
+// may be due.  The 'nextExpiry' method returns a time before which no element
+// will expire (the start of the earliest non-empty slot), and records it; the
+// insertion methods ('add', 'addRaw', and 'update') report, through their
+// optional 'newFrontFlag' argument, whether the key being inserted is earlier
+// than the time last returned by 'nextExpiry' (or whether the wheel was found
+// empty by the last call to 'nextExpiry').  As with 'bdlcc::SkipList', a
+// consumer that calls 'nextExpiry' and then waits on a condition variable
+// while holding a mutex, and producers that signal that condition variable
+// under the same mutex whenever 'newFrontFlag' is 'true', cannot miss an
+// update.  Note that since 'nextExpiry' may return the start of a coarse slot,
+// a consumer may occasionally wake up and find no element due.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::TimingWheel' is thread-safe and thread-aware; that is, multiple
+// threads may use their own wheel objects or may concurrently use the same
+// object.  All operations are serialized by a mutex internal to the wheel.
+//
+// 'bdlcc::TimingWheelPairHandle' is only *const* *thread-safe*.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Expiring Session Timeouts
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a server tracks one inactivity timeout per client session, and
+// timeouts are frequently rearmed or cancelled before they expire.  A timing
+// wheel with a resolution of 10 milliseconds keeps each of these operations
+// constant-time.
+//
+// First, we create the wheel, whose keys are expressed in microseconds:
+//..
+//  bdlcc::TimingWheel<int> wheel(10 * 1000);
+//..
+// Then, we schedule timeouts for two sessions, keeping a handle to the first
+// one so that it can be rearmed:
+//..
+//  bdlcc::TimingWheel<int>::PairHandle session1;
+//  wheel.add(&session1, 1000 * 1000, 1);
+//  wheel.add(0, 1500 * 1000, 2);
+//  assert(2 == wheel.length());
+//..
+// Next, session 1 sees some activity, and its timeout is pushed back:
+//..
+//  int rc = wheel.update(session1, 2000 * 1000);
+//  assert(0 == rc);
+//..
+// Now, we advance the wheel to 1.6 seconds and see that only session 2 has
+// timed out:
+//..
+//  bdlcc::TimingWheel<int>::Pair *expired;
+//  rc = wheel.expiredFrontRaw(&expired, 1600 * 1000);
+//  assert(0 == rc);
+//  assert(2 == expired->data());
+//  assert(0 == wheel.remove(expired));
+//  wheel.releaseReferenceRaw(expired);
+//
+//  rc = wheel.expiredFrontRaw(&expired, 1600 * 1000);
+//  assert(0 != rc);
+//..
+// Finally, we ask when to check the wheel again:
+//..
+//  bsls::Types::Int64 next;
+//  rc = wheel.nextExpiry(&next);
+//  assert(0 == rc);
+//  assert(next <= 2000 * 1000);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_POOL
+#include <bdlma_pool.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_LOCKGUARD
+#include <bslmt_lockguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#ifndef INCLUDED_BSL_LIMITS
+#include <bsl_limits.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class DATA> class TimingWheel;
+
+                          // =======================
+                          // struct TimingWheel_Link
+                          // =======================
+
+struct TimingWheel_Link {
+    // This component-private structure is a link of a circular,
+    // doubly-linked, intrusive list.  Each slot of a timing wheel is the
+    // sentinel of such a list.
+
+    // DATA
+    TimingWheel_Link *d_next_p;
+    TimingWheel_Link *d_prev_p;
+};
+
+                        // ===========================
+                        // struct TimingWheel_NodeBase
+                        // ===========================
+
+struct TimingWheel_NodeBase : TimingWheel_Link {
+    // This component-private structure holds the part of a timing wheel
+    // element that does not depend on the 'DATA' type.
+
+    // DATA
+    bsls::Types::Int64  d_key;       // expiration time
+
+    bsls::Types::Uint64 d_tick;      // expiration tick
+
+    int                 d_refCount;  // number of references, including the
+                                     // one held by the wheel while the node
+                                     // is linked
+
+    int                 d_location;  // slot holding the node, or one of the
+                                     // 'TimingWheel_Imp::k_DETACHED' and
+                                     // 'TimingWheel_Imp::k_READY' values
+};
+
+                            // ======================
+                            // class TimingWheel_Imp
+                            // ======================
+
+class TimingWheel_Imp {
+    // This component-private class implements the slots, the occupancy masks,
+    // and the cascading of a hierarchical timing wheel, independently of the
+    // type of data stored in the nodes.  This class is *not* thread-safe, and
+    // does not manage the lifetime of the nodes it links.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_BITS_PER_LEVEL = 6,
+        k_NUM_SLOTS      = 1 << k_BITS_PER_LEVEL,
+        k_NUM_LEVELS     = (64 + k_BITS_PER_LEVEL - 1) / k_BITS_PER_LEVEL,
+
+        k_DETACHED       = -1,  // the node is not in the wheel
+        k_READY          = -2   // the node has expired
+    };
+
+  private:
+    // DATA
+    TimingWheel_Link    d_slots[k_NUM_LEVELS][k_NUM_SLOTS];
+                                               // sentinels of the slot lists
+
+    bsl::uint64_t       d_occupied[k_NUM_LEVELS];
+                                               // bit 'i' of 'd_occupied[L]'
+                                               // is set if slot 'i' of level
+                                               // 'L' is not empty
+
+    TimingWheel_Link    d_ready;               // sentinel of the list of
+                                               // expired nodes
+
+    bsls::Types::Uint64 d_currentTick;         // tick the wheel was last
+                                               // advanced to
+
+    bsls::Types::Int64  d_resolution;          // length of a tick
+
+    int                 d_length;              // number of linked nodes
+
+    // NOT IMPLEMENTED
+    TimingWheel_Imp(const TimingWheel_Imp&);
+    TimingWheel_Imp& operator=(const TimingWheel_Imp&);
+
+    // PRIVATE MANIPULATORS
+    void place(TimingWheel_NodeBase *node);
+        // Link the specified 'node' into the ready list if its tick is not
+        // after the current tick, and into the appropriate slot otherwise.
+
+    void unlink(TimingWheel_NodeBase *node);
+        // Unlink the specified 'node' from the list it is in, and mark it
+        // detached.
+
+    // PRIVATE ACCESSORS
+    int firstOccupiedLevel() const;
+        // Return the lowest level having a non-empty slot, or -1 if all slots
+        // are empty.
+
+    bsls::Types::Uint64 slotStart(int level) const;
+        // Return the first tick of the earliest non-empty slot of the
+        // specified 'level'.  The behavior is undefined unless 'level' has a
+        // non-empty slot.
+
+  public:
+    // CREATORS
+    explicit TimingWheel_Imp(bsls::Types::Int64 resolution);
+        // Create an empty timing wheel whose ticks are the specified
+        // 'resolution' long.  The behavior is undefined unless
+        // '0 < resolution'.
+
+    // MANIPULATORS
+    void advance(bsls::Types::Int64 now);
+        // Advance this wheel to the last tick not after the specified 'now',
+        // appending every node expiring on or before that tick to the ready
+        // list.  This method has no effect if 'now' is before the current
+        // tick.
+
+    TimingWheel_NodeBase *first();
+        // Return the first node in the ready list if it is not empty, any
+        // node in this wheel if the ready list is empty, and 0 if this wheel
+        // is empty.
+
+    void insert(TimingWheel_NodeBase *node);
+        // Link the specified 'node', whose key has been set, into this wheel.
+        // The behavior is undefined if 'node' is already in a wheel.
+
+    void remove(TimingWheel_NodeBase *node);
+        // Unlink the specified 'node' from this wheel.  The behavior is
+        // undefined unless 'node' is in this wheel.
+
+    // ACCESSORS
+    TimingWheel_NodeBase *frontReady() const;
+        // Return the first node of the ready list, or 0 if the ready list is
+        // empty.
+
+    int length() const;
+        // Return the number of nodes in this wheel.
+
+    int nextExpiry(bsls::Types::Int64 *result) const;
+        // Load into the specified 'result' a time before which no node in
+        // this wheel expires, and return 0.  Return a non-zero value, with no
+        // effect on 'result', if this wheel is empty.
+
+    bsls::Types::Int64 resolution() const;
+        // Return the length of the ticks of this wheel.
+};
+
+                          // =======================
+                          // struct TimingWheel_Node
+                          // =======================
+
+template <class DATA>
+struct TimingWheel_Node : TimingWheel_NodeBase {
+    // This component-private structure is a node of a 'TimingWheel'.
+
+    // DATA
+    DATA d_data;
+};
+
+                          // =====================
+                          // class TimingWheelPair
+                          // =====================
+
+template <class DATA>
+class TimingWheelPair {
+    // Pointers to objects of this class are used in the "raw" API of
+    // 'TimingWheel'; however, objects of the class are never constructed as
+    // the class serves only to provide type-safe pointers.
+
+    // DATA
+    TimingWheel_Node<DATA> d_node;    // never directly accessed
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheelPair();
+    TimingWheelPair(const TimingWheelPair&);
+    TimingWheelPair& operator=(const TimingWheelPair&);
+
+  public:
+    // ACCESSORS
+    const bsls::Types::Int64& key() const;
+        // Return a reference to the non-modifiable key of this pair.
+
+    DATA& data() const;
+        // Return a reference to the modifiable "data" of this pair.
+};
+
+                       // ===========================
+                       // class TimingWheelPairHandle
+                       // ===========================
+
+template <class DATA>
+class TimingWheelPairHandle {
+    // Objects of this class refer to an association (pair) in a
+    // 'TimingWheel'.  A 'bdlcc::TimingWheelPairHandle' is implicitly
+    // convertible to a 'const Pair*' and thus may be used anywhere in the
+    // 'TimingWheel' API that a 'const Pair*' is expected.
+
+    // PRIVATE TYPES
+    typedef TimingWheelPair<DATA> Pair;
+
+    // DATA
+    const TimingWheel<DATA> *d_wheel_p;
+    Pair                    *d_node_p;
+
+    // FRIENDS
+    friend class TimingWheel<DATA>;
+
+  private:
+    // PRIVATE MANIPULATORS
+    void reset(const TimingWheel<DATA> *wheel, Pair *reference);
+        // Change this handle to manage the specified 'reference' in the
+        // specified 'wheel'.  If this handle refers to a pair, release the
+        // reference.  Note that it is assumed that the calling scope already
+        // owns the 'reference'.
+
+  public:
+    // CREATORS
+    TimingWheelPairHandle();
+        // Construct a new handle that does not refer to a pair.
+
+    TimingWheelPairHandle(const TimingWheelPairHandle& original);
+        // Construct a new handle referring to the same wheel and pair as the
+        // specified 'original'.
+
+    ~TimingWheelPairHandle();
+        // Destroy this handle.  If this handle refers to a pair, release the
+        // reference.
+
+    // MANIPULATORS
+    TimingWheelPairHandle& operator=(const TimingWheelPairHandle& rhs);
+        // Change this handle to refer to the same wheel and pair as the
+        // specified 'rhs'.  If this handle initially refers to a pair, release
+        // the reference.  Return '*this'.
+
+    void release();
+        // Release the reference (if any) managed by this handle.
+
+    // ACCESSORS
+    bool isValid() const;
+        // Return 'true' if this handle currently refers to a pair, and 'false'
+        // otherwise.
+
+    const bsls::Types::Int64& key() const;
+        // Return a reference to the non-modifiable key of the pair referred to
+        // by this object.  The behavior is undefined unless 'isValid' returns
+        // 'true'.
+
+    DATA& data() const;
+        // Return a reference to the "data" value of the pair referred to by
+        // this object.  The behavior is undefined unless 'isValid' returns
+        // 'true'.
+
+    operator const Pair*() const;
+        // Return the address of the pair referred to by this handle, or 0 if
+        // this handle does not manage a reference.
+};
+
+                            // =================
+                            // class TimingWheel
+                            // =================
+
+template <class DATA>
+class TimingWheel {
+    // This class provides a thread-safe hierarchical timing wheel of 'DATA'
+    // objects keyed by 64-bit expiration times.
+
+  public:
+    // CONSTANTS
+    enum {
+        e_SUCCESS   = 0,
+        e_NOT_FOUND = 1,
+        e_INVALID   = 3
+    };
+
+    // TYPES
+    typedef TimingWheelPair<DATA>       Pair;
+    typedef TimingWheelPairHandle<DATA> PairHandle;
+
+  private:
+    // PRIVATE TYPES
+    typedef TimingWheel_Node<DATA>          Node;
+    typedef bslmt::LockGuard<bslmt::Mutex>  LockGuard;
+
+    // DATA
+    mutable bslmt::Mutex  d_lock;           // serializes all operations
+
+    TimingWheel_Imp       d_imp;            // slots and cascading logic
+
+    bsls::Types::Int64    d_nextExpiry;     // value last loaded by
+                                            // 'nextExpiry', or the maximum
+                                            // 64-bit value if the wheel was
+                                            // then empty
+
+    mutable bdlma::Pool   d_pool;           // node storage
+
+    bslma::Allocator     *d_allocator_p;    // memory allocator (held, not
+                                            // owned)
+
+    // FRIENDS
+    friend class TimingWheelPair<DATA>;
+    friend class TimingWheelPairHandle<DATA>;
+
+    // NOT IMPLEMENTED
+    TimingWheel(const TimingWheel&);
+    TimingWheel& operator=(const TimingWheel&);
+
+    // PRIVATE CLASS METHODS
+    static Node *toNode(const Pair *reference);
+        // Return the node identified by the specified 'reference'.
+
+    // PRIVATE MANIPULATORS
+    Node *createNode(bsls::Types::Int64 key, const DATA& data);
+        // Return a new node holding the specified 'key' and 'data', having a
+        // reference count of 2 (one for the wheel and one for the caller).
+
+    void insertNode(bool *newFrontFlag, Node *node);
+        // Link the specified 'node' into this wheel and, if 'newFrontFlag' is
+        // not 0, load into it whether the key of 'node' is before the time
+        // last reported by 'nextExpiry'.  The behavior is undefined unless
+        // 'd_lock' is held.
+
+    // PRIVATE ACCESSORS
+    void releaseNode(Node *node) const;
+        // Decrement the reference count of the specified 'node', and destroy
+        // it if no reference remains.  The behavior is undefined unless
+        // 'd_lock' is held.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimingWheel, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TimingWheel(bsls::Types::Int64  resolution,
+                         bslma::Allocator   *basicAllocator = 0);
+        // Create an empty timing wheel whose ticks are the specified
+        // 'resolution' long, in the units of the keys.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < resolution'.
+
+    ~TimingWheel();
+        // Destroy this timing wheel.  The behavior is undefined if references
+        // to pairs of this wheel are outstanding.
+
+    // MANIPULATORS
+    void add(PairHandle         *result,
+             bsls::Types::Int64  key,
+             const DATA&         data,
+             bool               *newFrontFlag = 0);
+        // Add the specified 'data' to this wheel, to expire at the specified
+        // 'key'.  If the specified 'result' is not 0, load into it a handle
+        // to the new pair.  If the optionally specified 'newFrontFlag' is not
+        // 0, load into it 'true' if 'key' is before the time last reported by
+        // 'nextExpiry' (see {Waking Up a Dispatcher}), and 'false' otherwise.
+
+    void addRaw(Pair               **result,
+                bsls::Types::Int64   key,
+                const DATA&          data,
+                bool                *newFrontFlag = 0);
+        // Add the specified 'data' to this wheel, to expire at the specified
+        // 'key'.  If the specified 'result' is not 0, load into it a reference
+        // to the new pair; that reference must be released (using
+        // 'releaseReferenceRaw') when it is no longer needed.  If the
+        // optionally specified 'newFrontFlag' is not 0, load into it 'true' if
+        // 'key' is before the time last reported by 'nextExpiry', and 'false'
+        // otherwise.
+
+    int expiredFrontRaw(Pair **front, bsls::Types::Int64 now);
+        // Advance this wheel to the specified 'now' and load into the
+        // specified 'front' a reference to the first pair that has expired
+        // (that is, whose key is not after 'now') and that has not been
+        // removed.  The reference must be released (using
+        // 'releaseReferenceRaw') when it is no longer needed.  Return 0 on
+        // success, and a non-zero value (with 0 loaded into 'front') if no
+        // pair has expired.  Note that the pair is *not* removed from the
+        // wheel.
+
+    int nextExpiry(bsls::Types::Int64 *result);
+        // Load into the specified 'result' a time before which no pair in
+        // this wheel expires, record that time for the purpose of the
+        // 'newFrontFlag' arguments of subsequent insertions, and return 0.
+        // Return a non-zero value, with no effect on 'result', if this wheel
+        // is empty.  Note that the time loaded is not before the current time
+        // unless an expired pair has not yet been removed.
+
+    int remove(const Pair *reference);
+        // Remove the pair identified by the specified 'reference' from this
+        // wheel.  Return 0 on success, 'e_NOT_FOUND' if the pair is no longer
+        // in the wheel, and 'e_INVALID' if 'reference' is 0.  Note that the
+        // reference itself is not released.
+
+    int removeAll();
+        // Remove all pairs from this wheel and return the number of pairs
+        // removed.
+
+    int update(const Pair         *reference,
+               bsls::Types::Int64  newKey,
+               bool               *newFrontFlag = 0);
+        // Change the expiration time of the pair identified by the specified
+        // 'reference' to the specified 'newKey'.  If the optionally specified
+        // 'newFrontFlag' is not 0, load into it 'true' if 'newKey' is before
+        // the time last reported by 'nextExpiry', and 'false' otherwise.
+        // Return 0 on success, 'e_NOT_FOUND' if the pair is no longer in the
+        // wheel, and 'e_INVALID' if 'reference' is 0.
+
+    // ACCESSORS
+    Pair *addPairReferenceRaw(const Pair *reference) const;
+        // Increment the reference count of the pair identified by the
+        // specified 'reference' and return 'reference'.  The additional
+        // reference must be released (using 'releaseReferenceRaw') when it is
+        // no longer needed.
+
+    bool isEmpty() const;
+        // Return 'true' if this wheel is empty, and 'false' otherwise.
+
+    int length() const;
+        // Return the number of pairs in this wheel.
+
+    void releaseReferenceRaw(const Pair *reference) const;
+        // Release the specified 'reference'.  After calling this method,
+        // 'reference' must not be used.
+
+    bsls::Types::Int64 resolution() const;
+        // Return the length of the ticks of this wheel.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // ----------------------
+                            // class TimingWheel_Imp
+                            // ----------------------
+
+// ACCESSORS
+inline
+TimingWheel_NodeBase *TimingWheel_Imp::frontReady() const
+{
+    return d_ready.d_next_p == &d_ready
+           ? 0
+           : static_cast<TimingWheel_NodeBase *>(d_ready.d_next_p);
+}
+
+inline
+int TimingWheel_Imp::length() const
+{
+    return d_length;
+}
+
+inline
+bsls::Types::Int64 TimingWheel_Imp::resolution() const
+{
+    return d_resolution;
+}
+
+                          // ---------------------
+                          // class TimingWheelPair
+                          // ---------------------
+
+// ACCESSORS
+template <class DATA>
+inline
+const bsls::Types::Int64& TimingWheelPair<DATA>::key() const
+{
+    return TimingWheel<DATA>::toNode(this)->d_key;
+}
+
+template <class DATA>
+inline
+DATA& TimingWheelPair<DATA>::data() const
+{
+    return TimingWheel<DATA>::toNode(this)->d_data;
+}
+
+                       // ---------------------------
+                       // class TimingWheelPairHandle
+                       // ---------------------------
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+inline
+void TimingWheelPairHandle<DATA>::reset(const TimingWheel<DATA> *wheel,
+                                        Pair                    *reference)
+{
+    release();
+    d_wheel_p = wheel;
+    d_node_p  = reference;
+}
+
+// CREATORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::TimingWheelPairHandle()
+: d_wheel_p(0)
+, d_node_p(0)
+{
+}
+
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::TimingWheelPairHandle(
+                                         const TimingWheelPairHandle& original)
+: d_wheel_p(original.d_wheel_p)
+, d_node_p(original.d_node_p
+           ? original.d_wheel_p->addPairReferenceRaw(original.d_node_p)
+           : 0)
+{
+}
+
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::~TimingWheelPairHandle()
+{
+    release();
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>&
+TimingWheelPairHandle<DATA>::operator=(const TimingWheelPairHandle& rhs)
+{
+    if (this != &rhs) {
+        reset(rhs.d_wheel_p,
+              rhs.d_node_p ? rhs.d_wheel_p->addPairReferenceRaw(rhs.d_node_p)
+                           : 0);
+    }
+    return *this;
+}
+
+template <class DATA>
+inline
+void TimingWheelPairHandle<DATA>::release()
+{
+    if (d_node_p) {
+        d_wheel_p->releaseReferenceRaw(d_node_p);
+        d_node_p = 0;
+    }
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+bool TimingWheelPairHandle<DATA>::isValid() const
+{
+    return 0 != d_node_p;
+}
+
+template <class DATA>
+inline
+const bsls::Types::Int64& TimingWheelPairHandle<DATA>::key() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->key();
+}
+
+template <class DATA>
+inline
+DATA& TimingWheelPairHandle<DATA>::data() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->data();
+}
+
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::operator const Pair*() const
+{
+    return d_node_p;
+}
+
+                            // -----------------
+                            // class TimingWheel
+                            // -----------------
+
+// PRIVATE CLASS METHODS
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Node *
+TimingWheel<DATA>::toNode(const Pair *reference)
+{
+    return static_cast<Node *>(
+                  const_cast<void *>(static_cast<const void *>(reference)));
+}
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+typename TimingWheel<DATA>::Node *
+TimingWheel<DATA>::createNode(bsls::Types::Int64 key, const DATA& data)
+{
+    Node *node = static_cast<Node *>(d_pool.allocate());
+
+    bslma::DeallocatorProctor<bdlma::Pool> proctor(node, &d_pool);
+    bslalg::ScalarPrimitives::copyConstruct(&node->d_data,
+                                            data,
+                                            d_allocator_p);
+    proctor.release();
+
+    node->d_next_p   = 0;
+    node->d_prev_p   = 0;
+    node->d_key      = key;
+    node->d_tick     = 0;
+    node->d_refCount = 2;
+    node->d_location = TimingWheel_Imp::k_DETACHED;
+    return node;
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::insertNode(bool *newFrontFlag, Node *node)
+{
+    d_imp.insert(node);
+    if (newFrontFlag) {
+        *newFrontFlag = node->d_key < d_nextExpiry;
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class DATA>
+inline
+void TimingWheel<DATA>::releaseNode(Node *node) const
+{
+    BSLS_ASSERT(0 < node->d_refCount);
+
+    if (0 == --node->d_refCount) {
+        BSLS_ASSERT(TimingWheel_Imp::k_DETACHED == node->d_location);
+
+        node->d_data.~DATA();
+        d_pool.deallocate(node);
+    }
+}
+
+// CREATORS
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(bsls::Types::Int64  resolution,
+                               bslma::Allocator   *basicAllocator)
+: d_imp(resolution)
+, d_nextExpiry(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_pool(sizeof(Node), basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < resolution);
+}
+
+template <class DATA>
+TimingWheel<DATA>::~TimingWheel()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+template <class DATA>
+void TimingWheel<DATA>::add(PairHandle         *result,
+                            bsls::Types::Int64  key,
+                            const DATA&         data,
+                            bool               *newFrontFlag)
+{
+    Pair *reference;
+    addRaw(&reference, key, data, newFrontFlag);
+    if (result) {
+        result->reset(this, reference);
+    }
+    else {
+        releaseReferenceRaw(reference);
+    }
+}
+
+template <class DATA>
+void TimingWheel<DATA>::addRaw(Pair               **result,
+                               bsls::Types::Int64   key,
+                               const DATA&          data,
+                               bool                *newFrontFlag)
+{
+    LockGuard guard(&d_lock);
+
+    Node *node = createNode(key, data);
+    insertNode(newFrontFlag, node);
+
+    if (result) {
+        *result = reinterpret_cast<Pair *>(static_cast<void *>(node));
+    }
+    else {
+        releaseNode(node);
+    }
+}
+
+template <class DATA>
+int TimingWheel<DATA>::expiredFrontRaw(Pair               **front,
+                                       bsls::Types::Int64   now)
+{
+    LockGuard guard(&d_lock);
+
+    d_imp.advance(now);
+
+    Node *node = static_cast<Node *>(d_imp.frontReady());
+    if (0 == node) {
+        *front = 0;
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    ++node->d_refCount;
+    *front = reinterpret_cast<Pair *>(static_cast<void *>(node));
+    return 0;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::nextExpiry(bsls::Types::Int64 *result)
+{
+    BSLS_ASSERT(result);
+
+    LockGuard guard(&d_lock);
+
+    if (0 != d_imp.nextExpiry(&d_nextExpiry)) {
+        d_nextExpiry = bsl::numeric_limits<bsls::Types::Int64>::max();
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    *result = d_nextExpiry;
+    return 0;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::remove(const Pair *reference)
+{
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = toNode(reference);
+
+    LockGuard guard(&d_lock);
+
+    if (TimingWheel_Imp::k_DETACHED == node->d_location) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    d_imp.remove(node);
+    releaseNode(node);
+    return 0;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::removeAll()
+{
+    LockGuard guard(&d_lock);
+
+    int count = 0;
+    while (Node *node = static_cast<Node *>(d_imp.first())) {
+        d_imp.remove(node);
+        releaseNode(node);
+        ++count;
+    }
+    return count;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::update(const Pair         *reference,
+                              bsls::Types::Int64  newKey,
+                              bool               *newFrontFlag)
+{
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = toNode(reference);
+
+    LockGuard guard(&d_lock);
+
+    if (TimingWheel_Imp::k_DETACHED == node->d_location) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    d_imp.remove(node);
+    node->d_key = newKey;
+    insertNode(newFrontFlag, node);
+    return 0;
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Pair *
+TimingWheel<DATA>::addPairReferenceRaw(const Pair *reference) const
+{
+    BSLS_ASSERT(reference);
+
+    LockGuard guard(&d_lock);
+
+    Node *node = toNode(reference);
+    BSLS_ASSERT(0 < node->d_refCount);
+
+    ++node->d_refCount;
+    return const_cast<Pair *>(reference);
+}
+
+template <class DATA>
+inline
+bool TimingWheel<DATA>::isEmpty() const
+{
+    return 0 == length();
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::length() const
+{
+    LockGuard guard(&d_lock);
+
+    return d_imp.length();
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::releaseReferenceRaw(const Pair *reference) const
+{
+    BSLS_ASSERT(reference);
+
+    LockGuard guard(&d_lock);
+
+    releaseNode(toNode(reference));
+}
+
+template <class DATA>
+inline
+bsls::Types::Int64 TimingWheel<DATA>::resolution() const
+{
+    return d_imp.resolution();
+}
+
+                                  // Aspects
+
+template <class DATA>
+inline
+bslma::Allocator *TimingWheel<DATA>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
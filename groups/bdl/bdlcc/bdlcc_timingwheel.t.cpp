@@ -0,0 +1,937 @@
+// bdlcc_timingwheel.t.cpp                                            -*-C++-*-
+#include <bdlcc_timingwheel.h>
+
+#include <bdlcc_skiplist.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// 'bdlcc::TimingWheel' is a container whose observable behavior is defined by
+// a simple rule: a pair with key 'K' is returned by 'expiredFrontRaw(now)' if
+// and only if 'ceil(K / resolution) <= floor(now / resolution)'.  We verify
+// the bookkeeping (lengths, references, memory) of the manipulators directly,
+// and the expiration rule by comparing the wheel with a brute-force oracle on
+// random sequences of operations spanning the whole range of the levels.
+// Finally we verify that concurrent use does not lose or duplicate pairs.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] TimingWheel(Int64 resolution, Allocator *basicAllocator = 0);
+// [ 2] ~TimingWheel();
+//
+// MANIPULATORS
+// [ 2] void add(PairHandle *, Int64, const DATA&, bool * = 0);
+// [ 2] void addRaw(Pair **, Int64, const DATA&, bool * = 0);
+// [ 3] int expiredFrontRaw(Pair **front, Int64 now);
+// [ 4] int nextExpiry(Int64 *result);
+// [ 2] int remove(const Pair *reference);
+// [ 2] int removeAll();
+// [ 4] int update(const Pair *, Int64, bool * = 0);
+//
+// ACCESSORS
+// [ 2] Pair *addPairReferenceRaw(const Pair *reference) const;
+// [ 2] bool isEmpty() const;
+// [ 2] int length() const;
+// [ 2] void releaseReferenceRaw(const Pair *reference) const;
+// [ 2] Int64 resolution() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// TimingWheelPairHandle
+// [ 2] TimingWheelPairHandle();
+// [ 2] TimingWheelPairHandle(const TimingWheelPairHandle&);
+// [ 2] TimingWheelPairHandle& operator=(const TimingWheelPairHandle&);
+// [ 2] void release();
+// [ 2] bool isValid() const;
+// [ 2] const Int64& key() const;
+// [ 2] DATA& data() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 3] CONCERN: pairs expire neither early nor more than one tick late
+// [ 5] CONCERN: concurrent insertions, removals, and expirations
+// [-1] PERFORMANCE: schedule/cancel compared with 'bdlcc::SkipList'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+typedef bdlcc::TimingWheel<int>          Obj;
+typedef bdlcc::TimingWheel<bsl::string>  StrObj;
+typedef bsls::Types::Int64               Int64;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class Random {
+    // This class provides a deterministic 64-bit pseudo-random generator.
+
+    // DATA
+    bsls::Types::Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(bsls::Types::Uint64 seed) : d_state(seed) {}
+
+    // MANIPULATORS
+    bsls::Types::Uint64 operator()()
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return d_state >> 11 ^ d_state << 31;
+    }
+};
+
+Int64 ceilTick(Int64 key, Int64 resolution)
+    // Return the first tick of the specified 'resolution' that is not before
+    // the specified 'key'.
+{
+    return key <= 0 ? 0 : key / resolution + (0 != key % resolution);
+}
+
+Int64 floorTick(Int64 now, Int64 resolution)
+    // Return the last tick of the specified 'resolution' that is not after
+    // the specified 'now'.
+{
+    return now <= 0 ? 0 : now / resolution;
+}
+
+int drain(Obj *wheel, Int64 now, bsl::vector<int> *expired)
+    // Remove every pair of the specified 'wheel' that has expired at the
+    // specified 'now', and append their data to the specified 'expired'.
+    // Return the number of pairs removed.
+{
+    int         count = 0;
+    Obj::Pair  *front;
+    while (0 == wheel->expiredFrontRaw(&front, now)) {
+        expired->push_back(front->data());
+        ASSERT(0 == wheel->remove(front));
+        wheel->releaseReferenceRaw(front);
+        ++count;
+    }
+    return count;
+}
+
+                          // ====================
+                          // struct ConcurrentArgs
+                          // ====================
+
+struct ConcurrentArgs {
+    // This 'struct' holds the state shared by the threads of the concurrency
+    // test.
+
+    Obj               *d_wheel_p;
+    bsls::AtomicInt64  d_now;
+    bsls::AtomicInt    d_added;
+    bsls::AtomicInt    d_removed;
+    bsls::AtomicInt    d_expired;
+    bsls::AtomicInt    d_producersDone;
+};
+
+void producer(ConcurrentArgs *args, int id, int numItems)
+    // Add the specified 'numItems' pairs to the wheel of the specified 'args',
+    // slightly ahead of its current time, and remove every third of them
+    // again.  Use the specified 'id' to seed the keys.
+{
+    Random random(id + 1);
+    for (int i = 0; i < numItems; ++i) {
+        Obj::PairHandle handle;
+        Int64           key = args->d_now.loadRelaxed()
+                            + static_cast<Int64>(random() % 5000);
+
+        args->d_wheel_p->add(&handle, key, id);
+        ++args->d_added;
+
+        if (0 == i % 3 && 0 == args->d_wheel_p->remove(handle)) {
+            ++args->d_removed;
+        }
+        if (0 == i % 64) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    ++args->d_producersDone;
+}
+
+void consumer(ConcurrentArgs *args, int numProducers)
+    // Advance the time of the specified 'args' and remove expired pairs until
+    // the specified 'numProducers' have finished and the wheel is empty.
+{
+    while (numProducers != args->d_producersDone.loadRelaxed()
+        || !args->d_wheel_p->isEmpty()) {
+        Int64      now = args->d_now.addRelaxed(100);
+        Obj::Pair *front;
+        while (0 == args->d_wheel_p->expiredFrontRaw(&front, now)) {
+            ASSERTT(front->key() <= now);
+            if (0 == args->d_wheel_p->remove(front)) {
+                ++args->d_expired;
+            }
+            args->d_wheel_p->releaseReferenceRaw(front);
+        }
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+void noop()
+    // Do nothing.
+{
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Expiring Session Timeouts
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a server tracks one inactivity timeout per client session, and
+// timeouts are frequently rearmed or cancelled before they expire.  A timing
+// wheel with a resolution of 10 milliseconds keeps each of these operations
+// constant-time.
+//
+// First, we create the wheel, whose keys are expressed in microseconds:
+//..
+    bdlcc::TimingWheel<int> wheel(10 * 1000);
+//..
+// Then, we schedule timeouts for two sessions, keeping a handle to the first
+// one so that it can be rearmed:
+//..
+    bdlcc::TimingWheel<int>::PairHandle session1;
+    wheel.add(&session1, 1000 * 1000, 1);
+    wheel.add(0, 1500 * 1000, 2);
+    ASSERT(2 == wheel.length());
+//..
+// Next, session 1 sees some activity, and its timeout is pushed back:
+//..
+    int rc = wheel.update(session1, 2000 * 1000);
+    ASSERT(0 == rc);
+//..
+// Now, we advance the wheel to 1.6 seconds and see that only session 2 has
+// timed out:
+//..
+    bdlcc::TimingWheel<int>::Pair *expired;
+    rc = wheel.expiredFrontRaw(&expired, 1600 * 1000);
+    ASSERT(0 == rc);
+    ASSERT(2 == expired->data());
+    ASSERT(0 == wheel.remove(expired));
+    wheel.releaseReferenceRaw(expired);
+
+    rc = wheel.expiredFrontRaw(&expired, 1600 * 1000);
+    ASSERT(0 != rc);
+//..
+// Finally, we ask when to check the wheel again:
+//..
+    bsls::Types::Int64 next;
+    rc = wheel.nextExpiry(&next);
+    ASSERT(0 == rc);
+    ASSERT(next <= 2000 * 1000);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: concurrent insertions, removals, and expirations
+        //
+        // Concerns:
+        //: 1 When several threads add and remove pairs while another thread
+        //:   advances the wheel and removes expired pairs, every pair added
+        //:   is removed exactly once, either by its producer or on expiry.
+        //:
+        //: 2 No pair is returned before its key.
+        //
+        // Plan:
+        //: 1 Run several producer threads adding pairs with keys slightly
+        //:   ahead of a shared clock and removing a third of them, and a
+        //:   consumer thread advancing the clock and removing expired pairs.
+        //:   Verify that the counts balance and that the wheel ends up empty.
+        //:   (C-1,2)
+        //
+        // Testing:
+        //   CONCERN: concurrent insertions, removals, and expirations
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT USE" << endl
+                          << "=======================" << endl;
+
+        const int NUM_PRODUCERS = 4;
+        const int NUM_ITEMS     = 20000;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj            mX(7, &ta);
+            ConcurrentArgs args;
+            args.d_wheel_p = &mX;
+
+            bslmt::ThreadUtil::Handle handles[NUM_PRODUCERS + 1];
+            for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handles[i],
+                                      bdlf::BindUtil::bind(&producer,
+                                                           &args,
+                                                           i,
+                                                           NUM_ITEMS)));
+            }
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handles[NUM_PRODUCERS],
+                                  bdlf::BindUtil::bind(&consumer,
+                                                       &args,
+                                                       NUM_PRODUCERS)));
+            for (int i = 0; i <= NUM_PRODUCERS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            if (veryVerbose) {
+                P_(args.d_added) P_(args.d_removed) P(args.d_expired)
+            }
+
+            ASSERT(NUM_PRODUCERS * NUM_ITEMS == args.d_added);
+            ASSERT(args.d_added == args.d_removed + args.d_expired);
+            ASSERT(mX.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'update' AND 'nextExpiry'
+        //
+        // Concerns:
+        //: 1 'update' moves a pair to its new expiration time, in either
+        //:   direction, and fails on pairs no longer in the wheel.
+        //:
+        //: 2 'nextExpiry' returns a time not after the earliest key rounded up
+        //:   to a tick, and not before the current tick unless an expired pair
+        //:   is pending; it fails on an empty wheel.
+        //:
+        //: 3 'newFrontFlag' reports whether the inserted key is before the
+        //:   time last returned by 'nextExpiry', and is 'true' once
+        //:   'nextExpiry' found the wheel empty.
+        //
+        // Plan:
+        //: 1 Move pairs forward and backward across levels and check when
+        //:   they expire.  (C-1)
+        //:
+        //: 2 For random sets of keys, compare 'nextExpiry' with the smallest
+        //:   rounded-up key.  (C-2)
+        //:
+        //: 3 Check 'newFrontFlag' around a call to 'nextExpiry'.  (C-3)
+        //
+        // Testing:
+        //   int update(const Pair *, Int64, bool * = 0);
+        //   int nextExpiry(Int64 *result);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'update' AND 'nextExpiry'" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(10, &ta);  const Obj& X = mX;
+
+            Obj::PairHandle h1, h2;
+            mX.add(&h1, 1000000, 1);
+            mX.add(&h2, 50, 2);
+
+            ASSERT(0 == mX.update(h1, 75));
+            ASSERT(0 == mX.update(h2, 1000000000));
+            ASSERT(75 == h1.key());
+
+            bsl::vector<int> expired;
+            ASSERT(0 == drain(&mX, 79, &expired));
+            ASSERT(1 == drain(&mX, 80, &expired));
+            ASSERT(1 == expired[0]);
+
+            ASSERT(Obj::e_NOT_FOUND == mX.update(h1, 100));
+            ASSERT(Obj::e_INVALID   == mX.update(0, 100));
+
+            ASSERT(0 == mX.update(h2, 90));
+            ASSERT(1 == drain(&mX, 90, &expired));
+            ASSERT(2 == expired[1]);
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\tTesting 'nextExpiry'." << endl;
+        {
+            Random random(17);
+            for (int ti = 0; ti < 200; ++ti) {
+                const Int64 RES   = 1 + random() % 1000;
+                const int   SHIFT = static_cast<int>(random() % 50);
+
+                Obj   mX(RES, &ta);
+                Int64 now      = static_cast<Int64>(random() % (1 << 30));
+                Int64 earliest = bsl::numeric_limits<Int64>::max();
+                Int64 result;
+
+                ASSERT(0 != mX.nextExpiry(&result));
+
+                Obj::Pair *front;
+                ASSERT(0 != mX.expiredFrontRaw(&front, now));  // advance
+                for (int i = 0; i < 20; ++i) {
+                    Int64 key = now + 1 + static_cast<Int64>(
+                                        random() % (Int64(1) << SHIFT));
+                    mX.add(0, key, i);
+                    if (ceilTick(key, RES) < earliest) {
+                        earliest = ceilTick(key, RES);
+                    }
+                }
+
+                ASSERT(0 == mX.nextExpiry(&result));
+                LOOP3_ASSERT(ti, result, earliest * RES,
+                             result <= earliest * RES);
+                LOOP3_ASSERT(ti, result, now, result >= floorTick(now, RES)
+                                                                       * RES);
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'newFrontFlag'." << endl;
+        {
+            Obj  mX(10, &ta);
+            bool newFront = false;
+
+            mX.add(0, 500, 0, &newFront);
+            ASSERT(newFront);           // 'nextExpiry' never called
+
+            Int64 result;
+            ASSERT(0 == mX.nextExpiry(&result));
+            ASSERT(500 >= result);
+
+            mX.add(0, result, 1, &newFront);
+            ASSERT(!newFront);
+            mX.add(0, result - 1, 2, &newFront);
+            ASSERT(newFront);
+
+            ASSERT(3 == mX.removeAll());
+            ASSERT(0 != mX.nextExpiry(&result));
+            mX.add(0, 1000000, 3, &newFront);
+            ASSERT(newFront);           // wheel was found empty
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: pairs expire neither early nor more than one tick late
+        //
+        // Concerns:
+        //: 1 'expiredFrontRaw(now)' returns a pair if and only if its key,
+        //:   rounded up to a tick, is not after 'now' rounded down to a tick.
+        //:
+        //: 2 This holds for keys in any level of the wheel, including the
+        //:   highest ones, for non-positive keys, and when the wheel is
+        //:   advanced by large or small steps, or not at all.
+        //:
+        //: 3 Pairs due on the same tick are returned in the order in which
+        //:   they were added.
+        //
+        // Plan:
+        //: 1 For several resolutions, perform random sequences of additions
+        //:   (with keys at random distances, in powers of two, from the
+        //:   current time), removals, and advances, and compare the pairs
+        //:   returned with a brute-force model.  (C-1,2)
+        //:
+        //: 2 Add several pairs with keys within the same tick, and verify the
+        //:   order in which they expire.  (C-3)
+        //
+        // Testing:
+        //   int expiredFrontRaw(Pair **front, Int64 now);
+        //   CONCERN: pairs expire neither early nor more than one tick late
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: EXPIRATION TIMES" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        const Int64 RESOLUTIONS[] = { 1, 3, 64, 1000, 123457 };
+        const int   NUM_RESOLUTIONS = sizeof RESOLUTIONS / sizeof *RESOLUTIONS;
+
+        for (int ri = 0; ri < NUM_RESOLUTIONS; ++ri) {
+            const Int64 RES = RESOLUTIONS[ri];
+            if (veryVerbose) { T_ P(RES) }
+
+            Random random(ri);
+            Obj    mX(RES, &ta);
+
+            bsl::vector<Int64>               keys;     // by data value
+            bsl::vector<Obj::PairHandle>     handles;  // by data value
+            bsl::vector<bool>                live;     // by data value
+            Int64                            now = 0;
+
+            for (int step = 0; step < 4000; ++step) {
+                const int op = static_cast<int>(random() % 8);
+                if (op < 4) {
+                    // Add, at a random power-of-two distance.
+
+                    const int   shift = static_cast<int>(random() % 63);
+                    const Int64 limit = bsl::numeric_limits<Int64>::max()
+                                      - now;
+                    Int64 delta = static_cast<Int64>(random()
+                                             & ((Int64(1) << shift) - 1));
+                    if (delta > limit) {
+                        delta = limit;
+                    }
+                    if (0 == random() % 16) {
+                        delta = -delta / 2 - 1;    // already expired
+                    }
+
+                    const int value = static_cast<int>(keys.size());
+                    keys.push_back(now + delta);
+                    handles.resize(handles.size() + 1);
+                    live.push_back(true);
+                    mX.add(&handles.back(), now + delta, value);
+                }
+                else if (op < 5 && !keys.empty()) {
+                    // Remove a random pair.
+
+                    const int value = static_cast<int>(random()
+                                                              % keys.size());
+                    const int rc    = mX.remove(handles[value]);
+                    LOOP2_ASSERT(value, rc,
+                                 rc == (live[value] ? 0 : Obj::e_NOT_FOUND));
+                    live[value] = false;
+                }
+                else {
+                    // Advance, by a random power-of-two amount.
+
+                    const int shift = static_cast<int>(random() % 40);
+                    now += static_cast<Int64>(random()
+                                                & ((Int64(1) << shift) - 1));
+
+                    bsl::vector<int> expired;
+                    drain(&mX, now, &expired);
+
+                    bsl::vector<bool> seen(keys.size(), false);
+                    for (bsl::size_t i = 0; i < expired.size(); ++i) {
+                        const int value = expired[i];
+                        LOOP2_ASSERT(RES, value, live[value]);
+                        LOOP3_ASSERT(RES, keys[value], now,
+                                     ceilTick(keys[value], RES)
+                                               <= floorTick(now, RES));
+                        live[value] = false;
+                        seen[value] = true;
+                    }
+                    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+                        if (live[i]) {
+                            LOOP3_ASSERT(RES, keys[i], now,
+                                         ceilTick(keys[i], RES)
+                                                   > floorTick(now, RES));
+                        }
+                    }
+                }
+            }
+
+            int numLive = 0;
+            for (bsl::size_t i = 0; i < live.size(); ++i) {
+                numLive += live[i];
+            }
+            LOOP3_ASSERT(RES, numLive, mX.length(), numLive == mX.length());
+        }
+
+        if (verbose) cout << "\tTesting order within a tick." << endl;
+        {
+            Obj mX(100, &ta);
+
+            mX.add(0, 10050, 0);
+            mX.add(0, 10001, 1);
+            mX.add(0, 10100, 2);
+            mX.add(0, 1000000, 3);
+
+            bsl::vector<int> expired;
+            ASSERT(0 == drain(&mX, 10099, &expired));
+            ASSERT(3 == drain(&mX, 10100, &expired));
+            ASSERT(0 == expired[0]);
+            ASSERT(1 == expired[1]);
+            ASSERT(2 == expired[2]);
+            ASSERT(1 == mX.length());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND REFERENCES
+        //
+        // Concerns:
+        //: 1 'add' and 'addRaw' insert pairs holding copies of the data, which
+        //:   use the allocator of the wheel, and optionally return references.
+        //:
+        //: 2 'remove' removes a pair only once, and returns 'e_INVALID' for a
+        //:   null reference.
+        //:
+        //: 3 A pair outlives its removal for as long as a reference (raw or
+        //:   handle) to it is outstanding, and is destroyed when the last one
+        //:   is released.
+        //:
+        //: 4 'removeAll' and the destructor release the memory of pairs with
+        //:   no outstanding reference.
+        //:
+        //: 5 'length', 'isEmpty', 'resolution', and 'allocator' report the
+        //:   state of the wheel.
+        //
+        // Plan:
+        //: 1 Using a wheel of 'bsl::string' and a test allocator, exercise
+        //:   each manipulator and check the memory in use at each step.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   TimingWheel(Int64 resolution, Allocator *basicAllocator = 0);
+        //   ~TimingWheel();
+        //   void add(PairHandle *, Int64, const DATA&, bool * = 0);
+        //   void addRaw(Pair **, Int64, const DATA&, bool * = 0);
+        //   int remove(const Pair *reference);
+        //   int removeAll();
+        //   Pair *addPairReferenceRaw(const Pair *reference) const;
+        //   bool isEmpty() const;
+        //   int length() const;
+        //   void releaseReferenceRaw(const Pair *reference) const;
+        //   Int64 resolution() const;
+        //   bslma::Allocator *allocator() const;
+        //   TimingWheelPairHandle();
+        //   TimingWheelPairHandle(const TimingWheelPairHandle&);
+        //   TimingWheelPairHandle& operator=(const TimingWheelPairHandle&);
+        //   void release();
+        //   bool isValid() const;
+        //   const Int64& key() const;
+        //   DATA& data() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PRIMARY MANIPULATORS AND REFERENCES"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        const char *LONG = "a string too long for the short-string buffer";
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::TestAllocator         ta(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        {
+            StrObj mX(1000, &ta);  const StrObj& X = mX;
+
+            ASSERT(1000 == X.resolution());
+            ASSERT(&ta  == X.allocator());
+            ASSERT(X.isEmpty());
+            ASSERT(0    == X.length());
+
+            StrObj::PairHandle h1;
+            ASSERT(!h1.isValid());
+            ASSERT(0 == static_cast<const StrObj::Pair *>(h1));
+
+            mX.add(&h1, 5000, LONG);
+            ASSERT(h1.isValid());
+            ASSERT(5000 == h1.key());
+            ASSERT(LONG == h1.data());
+            ASSERT(&ta  == h1.data().get_allocator().mechanism());
+            ASSERT(1    == X.length());
+
+            StrObj::Pair *p2;
+            mX.addRaw(&p2, 7000, "two");
+            ASSERT(7000  == p2->key());
+            ASSERT("two" == p2->data());
+
+            mX.addRaw(0, 9000, "three");
+            mX.add(0, 11000, "four");
+            ASSERT(4 == X.length());
+            ASSERT(!X.isEmpty());
+
+            // Copies of handles share the pair.
+
+            StrObj::PairHandle h1b(h1);
+            StrObj::PairHandle h1c;
+            h1c = h1b;
+            ASSERT(h1b.isValid() && h1c.isValid());
+            ASSERT(static_cast<const StrObj::Pair *>(h1)
+                              == static_cast<const StrObj::Pair *>(h1c));
+
+            // Removal keeps referenced pairs alive.
+
+            const Int64 IN_USE = ta.numBytesInUse();
+
+            ASSERT(0                 == mX.remove(h1));
+            ASSERT(StrObj::e_NOT_FOUND == mX.remove(h1b));
+            ASSERT(StrObj::e_INVALID   == mX.remove(0));
+            ASSERT(3                 == X.length());
+            ASSERT(LONG              == h1c.data());
+
+            h1.release();
+            h1b.release();
+            ASSERT(!h1.isValid());
+            ASSERT(IN_USE == ta.numBytesInUse());
+            h1c.release();
+            ASSERT(IN_USE >  ta.numBytesInUse());
+
+            // Raw references are counted too.
+
+            StrObj::Pair *p2b = mX.addPairReferenceRaw(p2);
+            ASSERT(p2b == p2);
+            mX.releaseReferenceRaw(p2);
+            ASSERT(0 == mX.remove(p2b));
+            ASSERT("two" == p2b->data());
+            mX.releaseReferenceRaw(p2b);
+
+            ASSERT(2 == mX.removeAll());
+            ASSERT(X.isEmpty());
+            ASSERT(0 == mX.removeAll());
+
+            mX.add(0, 13000, LONG);
+            mX.add(0, Int64(1) << 62, LONG);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add a few pairs and advance the wheel past them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(10, &ta);  const Obj& X = mX;
+
+            mX.add(0, 300, 3);
+            mX.add(0, 100, 1);
+            mX.add(0, 200000, 2);
+            ASSERT(3 == X.length());
+
+            bsl::vector<int> expired;
+            ASSERT(0 == drain(&mX, 99, &expired));
+            ASSERT(1 == drain(&mX, 100, &expired));
+            ASSERT(1 == drain(&mX, 1000, &expired));
+            ASSERT(1 == drain(&mX, 300000, &expired));
+            ASSERT(3 == expired.size());
+            ASSERT(1 == expired[0]);
+            ASSERT(3 == expired[1]);
+            ASSERT(2 == expired[2]);
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: schedule/cancel compared with 'bdlcc::SkipList'
+        //
+        // Concerns:
+        //: 1 Adding and removing a pair takes constant time, independently of
+        //:   the number of pairs in the wheel.
+        //
+        // Plan:
+        //: 1 With a large number of pairs in place, time cycles of adding and
+        //:   removing a pair, in a timing wheel and in a skip list, as used by
+        //:   'bdlmt::EventScheduler'.
+        //
+        // Testing:
+        //   PERFORMANCE: schedule/cancel compared with 'bdlcc::SkipList'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: SCHEDULE/CANCEL" << endl
+                          << "============================" << endl;
+
+        typedef bsl::function<void()>                            Callback;
+        typedef bdlcc::TimingWheel<Callback>                     Wheel;
+        typedef bdlcc::SkipList<bsls::Types::Int64, Callback>    List;
+
+        const int NUM_RESIDENT = argc > 2 ? atoi(argv[2]) : 100000;
+        const int NUM_CYCLES   = 1000000;
+        const Callback CB      = &noop;
+
+        {
+            Wheel  wheel(1000);
+            Random random(1);
+            for (int i = 0; i < NUM_RESIDENT; ++i) {
+                wheel.add(0, static_cast<Int64>(random() % 1000000000), CB);
+            }
+
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_CYCLES; ++i) {
+                Wheel::Pair *p;
+                wheel.addRaw(&p,
+                             static_cast<Int64>(random() % 1000000000),
+                             CB);
+                wheel.remove(p);
+                wheel.releaseReferenceRaw(p);
+            }
+            sw.stop();
+            cout << "TimingWheel: " << sw.elapsedTime() * 1e9 / NUM_CYCLES
+                 << "ns per add/remove with " << NUM_RESIDENT
+                 << " resident" << endl;
+        }
+        {
+            List   list;
+            Random random(1);
+            for (int i = 0; i < NUM_RESIDENT; ++i) {
+                list.add(static_cast<Int64>(random() % 1000000000), CB);
+            }
+
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_CYCLES; ++i) {
+                List::Pair *p;
+                list.addRawR(&p,
+                             static_cast<Int64>(random() % 1000000000),
+                             CB);
+                list.remove(p);
+                list.releaseReferenceRaw(p);
+            }
+            sw.stop();
+            cout << "SkipList:    " << sw.elapsedTime() * 1e9 / NUM_CYCLES
+                 << "ns per add/remove with " << NUM_RESIDENT
+                 << " resident" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+// ----------------------------- END-OF-FILE ----------------------------------
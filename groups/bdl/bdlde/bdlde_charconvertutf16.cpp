@@ -18,9 +18,16 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
+#include <bsl_cstring.h>    // 'memcpy', 'strlen'
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#define BDLDE_CHARCONVERTUTF16_SSE2 1
+#include <emmintrin.h>
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -433,6 +440,15 @@ struct Utf8 {
             return octets;
         }
 
+        bool isAvailable(const OctetType *position, int numOctets) const
+            // Return 'true' if the specified 'numOctets' octets beginning at
+            // the specified 'position' all precede the end of input, and
+            // 'false' otherwise.  The behavior is undefined unless
+            // 'position <= d_end'.
+        {
+            return d_end - position >= numOctets;
+        }
+
         bool verifyContinuations(const OctetType *octets, int n) const
             // Return 'true' if there are at least the specified 'n'
             // continuation bytes beginning at the specified 'octets' and prior
@@ -460,7 +476,18 @@ struct Utf8 {
         }
     };
 
-    struct ZeroBasedEnd {
+    class ZeroBasedEnd {
+        // DATA
+        mutable const OctetType *d_end_p;  // terminating null, or 0 if not
+                                           // yet located
+
+      public:
+        // CREATORS
+        ZeroBasedEnd()
+            // Create a 'ZeroBasedEnd' object.
+        : d_end_p(0)
+        {}
+
         // ACCESSORS
         bool isFinished(const OctetType *position) const
             // Return 'true' if the specified 'position' is at the end of
@@ -469,6 +496,22 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        bool isAvailable(const OctetType *position, int numOctets) const
+            // Return 'true' if the specified 'numOctets' octets beginning at
+            // the specified 'position' all precede the end of input, and
+            // 'false' otherwise.  The behavior is undefined unless 'position'
+            // is not past the end of input, and all 'position' values passed
+            // to this object are within the same null-terminated input.  Note
+            // that the terminating null is located by the first call only.
+        {
+            if (!d_end_p) {
+                d_end_p = position + bsl::strlen(
+                                   reinterpret_cast<const char *>(position));
+            }
+
+            return d_end_p - position >= numOctets;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets'.  The behavior is
@@ -742,13 +785,32 @@ struct Utf16 {
                 return true;                                          // RETURN
             }
         }
+
+        bool isAvailable(const UTF16_WORD *utf16Buf, int numWords) const
+            // Return 'true' if the specified 'numWords' words beginning at
+            // the specified 'utf16Buf' all precede the end of input, and
+            // 'false' otherwise.
+        {
+            return d_end - utf16Buf >= numWords;
+        }
     };
 
     template <class UTF16_WORD>
-    struct ZeroBasedEnd {
+    class ZeroBasedEnd {
         // The 'class' determines whether translation is at the end of input by
         // evaluating whether the next word of input is 0.
 
+        // DATA
+        mutable const UTF16_WORD *d_end_p;  // terminating null, or 0 if not
+                                            // yet located
+
+      public:
+        // CREATORS
+        ZeroBasedEnd()
+            // Create a 'ZeroBasedEnd' object.
+        : d_end_p(0)
+        {}
+
         // ACCESSORS
         bool isFinished(const UTF16_WORD *u16Buf) const
             // Return 'true' if the specified 'utf16Buf' is at the end of
@@ -756,6 +818,28 @@ struct Utf16 {
         {
             return !*u16Buf;
         }
+
+        bool isAvailable(const UTF16_WORD *utf16Buf, int numWords) const
+            // Return 'true' if the specified 'numWords' words beginning at
+            // the specified 'utf16Buf' all precede the end of input, and
+            // 'false' otherwise.  The behavior is undefined unless 'utf16Buf'
+            // is not past the end of input, and all 'utf16Buf' values passed
+            // to this object are within the same null-terminated input.  Note
+            // that the terminating null is located by the first call only.
+        {
+            if (!d_end_p) {
+                const UTF16_WORD *end = utf16Buf;
+                while (end[0] && end[1] && end[2] && end[3]) {
+                    end += 4;
+                }
+                while (*end) {
+                    ++end;
+                }
+                d_end_p = end;
+            }
+
+            return d_end_p - utf16Buf >= numWords;
+        }
     };
 
     // CLASS METHODS
@@ -988,6 +1072,390 @@ struct NoOpSwapper {
     }
 };
 
+// LOCAL HELPER STRUCT
+struct Block {
+    // 'Block' provides the fast paths of the translation routines: functions
+    // that classify and translate a whole block of input at once.  Runs of
+    // ASCII and of two-octet UTF-8 sequences (i.e., code points below
+    // 'U+0800') are handled; the translation routines fall back to
+    // translating one code point at a time for any block containing anything
+    // else, so that the output is identical either way.  SSE2 instructions,
+    // which all x86-64 processors support, are used where available, and
+    // equivalent portable code is used otherwise.  UTF-16 words are passed to
+    // and from these functions in host byte order in arrays of
+    // 'unsigned short'; 'loadWords' and 'storeWords' convert them from and to
+    // the caller's word type and byte order.
+
+    // TYPES
+    typedef Utf8::OctetType OctetType;
+
+    enum {
+        k_OCTETS = 16,  // octets of UTF-8 examined at once
+        k_WORDS  = 8    // words of UTF-16 examined at once
+    };
+
+    enum Kind {
+        // Classification of a block of 'k_WORDS' UTF-16 words.
+
+        e_OTHER,        // anything else
+        e_ASCII,        // all words encode as a single octet
+        e_TWO_OCTETS    // all words encode as two octets
+    };
+
+    // CLASS METHODS
+
+    // Part 1: UTF-8 to UTF-16
+
+    static
+    bool isAscii(const OctetType *octets)
+        // Return 'true' if all 'k_OCTETS' octets beginning at the specified
+        // 'octets' are single-octet code points, and 'false' otherwise.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        return 0 == _mm_movemask_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(octets)));
+#else
+        for (int ii = 0; ii < k_OCTETS; ++ii) {
+            if (!Utf8::isSingleOctet(octets[ii])) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;
+#endif
+    }
+
+    static
+    bool isTwoOctetRun(const OctetType *octets)
+        // Return 'true' if the 'k_OCTETS' octets beginning at the specified
+        // 'octets' are 'k_WORDS' minimally-encoded two-octet sequences, and
+        // 'false' otherwise.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        // Each 16-bit lane holds a header octet in its low-order byte and a
+        // continuation octet in its high-order byte.  A header of '0xc0' or
+        // '0xc1' indicates a non-minimal encoding.
+
+        const __m128i input = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(octets));
+        const __m128i tags  = _mm_and_si128(
+                                input,
+                                _mm_set1_epi16(static_cast<short>(0xc0e0)));
+        const __m128i value = _mm_and_si128(input, _mm_set1_epi16(0x1e));
+        const __m128i zero  = _mm_setzero_si128();
+
+        return 0xffff == _mm_movemask_epi8(_mm_cmpeq_epi16(
+                               tags,
+                               _mm_set1_epi16(static_cast<short>(0x80c0))))
+            && 0      == _mm_movemask_epi8(_mm_cmpeq_epi16(value, zero));
+#else
+        for (int ii = 0; ii < k_OCTETS; ii += 2) {
+            if (!Utf8::isTwoOctetHeader(octets[ii])
+             || (octets[ii + 1] & Utf8::CONTINUE_MASK) != Utf8::CONTINUE_TAG
+             || Utf8::fitsInSingleOctet(Utf8::decodeTwoOctets(octets + ii))) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;
+#endif
+    }
+
+    static
+    void decodeAscii(unsigned short *words, const OctetType *octets)
+        // Load into the 'k_OCTETS' words beginning at the specified 'words'
+        // the 'k_OCTETS' single-octet code points beginning at the specified
+        // 'octets'.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        const __m128i input = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(octets));
+        const __m128i zero  = _mm_setzero_si128();
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(words),
+                         _mm_unpacklo_epi8(input, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(words + k_WORDS),
+                         _mm_unpackhi_epi8(input, zero));
+#else
+        for (int ii = 0; ii < k_OCTETS; ++ii) {
+            words[ii] = octets[ii];
+        }
+#endif
+    }
+
+    static
+    void decodeTwoOctetRun(unsigned short *words, const OctetType *octets)
+        // Load into the 'k_WORDS' words beginning at the specified 'words'
+        // the code points encoded by the 'k_WORDS' two-octet sequences
+        // beginning at the specified 'octets'.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        const __m128i input = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(octets));
+        const __m128i high  = _mm_slli_epi16(
+                             _mm_and_si128(input, _mm_set1_epi16(0x1f)), 6);
+        const __m128i low   = _mm_and_si128(_mm_srli_epi16(input, 8),
+                                            _mm_set1_epi16(0x3f));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(words),
+                         _mm_or_si128(high, low));
+#else
+        for (int ii = 0; ii < k_WORDS; ++ii) {
+            words[ii] = static_cast<unsigned short>(
+                                     Utf8::decodeTwoOctets(octets + 2 * ii));
+        }
+#endif
+    }
+
+    template <class UTF16_WORD, class SWAPPER>
+    static
+    void storeWords(UTF16_WORD           *dstBuffer,
+                    const unsigned short *words,
+                    int                   numWords,
+                    SWAPPER)
+        // Write the specified 'numWords' words beginning at the specified
+        // 'words' to the specified 'dstBuffer', converted to 'UTF16_WORD' in
+        // the byte order indicated by 'SWAPPER'.
+    {
+        for (int ii = 0; ii < numWords; ++ii) {
+            dstBuffer[ii] = SWAPPER::encodeSingleWord(words[ii]);
+        }
+    }
+
+    static
+    void storeWords(unsigned short              *dstBuffer,
+                    const unsigned short        *words,
+                    int                          numWords,
+                    NoOpSwapper<unsigned short>)
+        // Write the specified 'numWords' words beginning at the specified
+        // 'words' to the specified 'dstBuffer'.
+    {
+        bsl::memcpy(dstBuffer, words, numWords * sizeof *words);
+    }
+
+    // Part 2: UTF-16 to UTF-8
+
+    template <class UTF16_WORD, class SWAPPER>
+    static
+    bool loadWords(unsigned short   *words,
+                   const UTF16_WORD *srcBuffer,
+                   SWAPPER)
+        // Load into the 'k_WORDS' words beginning at the specified 'words' the
+        // 'k_WORDS' words beginning at the specified 'srcBuffer', converted
+        // to host byte order as indicated by 'SWAPPER'.  Return 'true' on
+        // success, and 'false', with no effect on the contents of 'words' that
+        // the caller may rely on, if any of the converted words does not fit
+        // in 16 bits.
+    {
+        for (int ii = 0; ii < k_WORDS; ++ii) {
+            const UnicodeCodePoint word = SWAPPER::decodeSingleWord(
+                                                              srcBuffer + ii);
+            if (word > 0xffff) {
+                return false;                                         // RETURN
+            }
+            words[ii] = static_cast<unsigned short>(word);
+        }
+        return true;
+    }
+
+    static
+    bool loadWords(unsigned short              *words,
+                   const unsigned short        *srcBuffer,
+                   NoOpSwapper<unsigned short>)
+        // Load into the 'k_WORDS' words beginning at the specified 'words' the
+        // 'k_WORDS' words beginning at the specified 'srcBuffer', and return
+        // 'true'.
+    {
+        bsl::memcpy(words, srcBuffer, k_WORDS * sizeof *words);
+        return true;
+    }
+
+    static
+    bool loadWords(unsigned short       *words,
+                   const wchar_t        *srcBuffer,
+                   NoOpSwapper<wchar_t>  swapper)
+        // Load into the 'k_WORDS' words beginning at the specified 'words' the
+        // 'k_WORDS' words beginning at the specified 'srcBuffer'.  Return
+        // 'true' on success, and 'false', with no effect on the contents of
+        // 'words' that the caller may rely on, if any of the words does not
+        // fit in 16 bits.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        if (4 == sizeof(wchar_t)) {
+            // Check that the high-order halves of all eight 32-bit words are
+            // zero, then narrow them with a signed saturating pack, biasing
+            // each word into, and back out of, the range of 'short'.
+
+            const __m128i low   = _mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(srcBuffer));
+            const __m128i high  = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(srcBuffer + 4));
+            const __m128i zero  = _mm_setzero_si128();
+            const __m128i upper = _mm_and_si128(
+                              _mm_or_si128(low, high),
+                              _mm_set1_epi32(static_cast<int>(0xffff0000)));
+            if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi32(upper, zero))) {
+                return false;                                         // RETURN
+            }
+
+            const __m128i bias = _mm_set1_epi32(0x8000);
+            _mm_storeu_si128(
+                   reinterpret_cast<__m128i *>(words),
+                   _mm_add_epi16(_mm_packs_epi32(_mm_sub_epi32(low,  bias),
+                                                 _mm_sub_epi32(high, bias)),
+                                 _mm_set1_epi16(static_cast<short>(0x8000))));
+            return true;                                              // RETURN
+        }
+#endif
+        return loadWords<wchar_t>(words, srcBuffer, swapper);
+    }
+
+    static
+    Kind classify(const unsigned short *words)
+        // Return the classification of the 'k_WORDS' words beginning at the
+        // specified 'words'.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        const __m128i input    = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(words));
+        const __m128i zero     = _mm_setzero_si128();
+        const __m128i notAscii = _mm_set1_epi16(static_cast<short>(0xff80));
+        const __m128i notTwo   = _mm_set1_epi16(static_cast<short>(0xf800));
+
+        const int ascii = _mm_movemask_epi8(
+                   _mm_cmpeq_epi16(_mm_and_si128(input, notAscii), zero));
+        if (0xffff == ascii) {
+            return e_ASCII;                                           // RETURN
+        }
+
+        const int fitsInTwo = _mm_movemask_epi8(
+                     _mm_cmpeq_epi16(_mm_and_si128(input, notTwo), zero));
+
+        return 0 == ascii && 0xffff == fitsInTwo ? e_TWO_OCTETS : e_OTHER;
+#else
+        int numAscii = 0, numTwoOctets = 0;
+        for (int ii = 0; ii < k_WORDS; ++ii) {
+            if (Utf8::fitsInSingleOctet(words[ii])) {
+                ++numAscii;
+            }
+            else if (Utf8::fitsInTwoOctets(words[ii])) {
+                ++numTwoOctets;
+            }
+        }
+
+        return k_WORDS == numAscii     ? e_ASCII
+             : k_WORDS == numTwoOctets ? e_TWO_OCTETS
+             :                           e_OTHER;
+#endif
+    }
+
+    static
+    void encodeAscii(char *dstBuffer, const unsigned short *words)
+        // Write to the 'k_WORDS' bytes beginning at the specified 'dstBuffer'
+        // the UTF-8 encoding of the 'k_WORDS' words beginning at the
+        // specified 'words'.  The behavior is undefined unless
+        // 'e_ASCII == classify(words)'.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        const __m128i input = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(words));
+
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dstBuffer),
+                         _mm_packus_epi16(input, input));
+#else
+        for (int ii = 0; ii < k_WORDS; ++ii) {
+            dstBuffer[ii] = static_cast<char>(words[ii]);
+        }
+#endif
+    }
+
+    static
+    void encodeTwoOctetRun(char *dstBuffer, const unsigned short *words)
+        // Write to the 'k_OCTETS' bytes beginning at the specified
+        // 'dstBuffer' the UTF-8 encoding of the 'k_WORDS' words beginning at
+        // the specified 'words'.  The behavior is undefined unless
+        // 'e_TWO_OCTETS == classify(words)'.
+    {
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+        // Build each two-octet sequence in a 16-bit lane, with the header in
+        // the low-order byte and the continuation in the high-order byte.
+
+        const __m128i input  = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(words));
+        const __m128i header = _mm_or_si128(_mm_srli_epi16(input, 6),
+                                            _mm_set1_epi16(0xc0));
+        const __m128i cont   = _mm_or_si128(
+                          _mm_slli_epi16(_mm_and_si128(input,
+                                                       _mm_set1_epi16(0x3f)),
+                                         8),
+                          _mm_set1_epi16(static_cast<short>(0x8000)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBuffer),
+                         _mm_or_si128(header, cont));
+#else
+        for (int ii = 0; ii < k_WORDS; ++ii) {
+            Utf8::encodeTwoOctets(dstBuffer + 2 * ii, words[ii]);
+        }
+#endif
+    }
+};
+
+// LOCAL HELPER CLASS
+template <class UNIT>
+class BlockSchedule {
+    // This class determines where a translation routine, stepping through
+    // input made of 'UNIT's, next examines a block of input for one of the
+    // 'Block' fast paths.  Examining a block that turns out to hold a mix of
+    // code points costs more than translating a few code points one at a
+    // time, so after each such block the distance to the next block examined
+    // doubles, up to a limit, and it returns to zero once a block qualifies.
+
+    // PRIVATE CONSTANTS
+    enum { k_MAX_DISTANCE = 512 };  // most 'UNIT's skipped after a mix
+
+    // DATA
+    const UNIT *d_next_p;    // where the next block may be examined
+    int         d_distance;  // 'UNIT's skipped after the last mixed block
+
+  public:
+    // CREATORS
+    explicit
+    BlockSchedule(const UNIT *input)
+        // Create a 'BlockSchedule' object for the specified 'input'.
+    : d_next_p(input)
+    , d_distance(0)
+    {}
+
+    // MANIPULATORS
+    void noteMatch()
+        // Note that the last block examined qualified for a fast path.
+    {
+        d_distance = 0;
+    }
+
+    template <class END_FUNCTOR>
+    void noteMismatch(const UNIT         *position,
+                      int                 blockSize,
+                      const END_FUNCTOR&  endFunctor)
+        // Note that the block of the specified 'blockSize' units at the
+        // specified 'position' did not qualify for a fast path, using the
+        // specified 'endFunctor' to evaluate end of input.  The behavior is
+        // undefined unless 'endFunctor.isAvailable(position, blockSize)'.
+    {
+        d_distance = bsl::min<int>(bsl::max<int>(2 * d_distance, blockSize),
+                                   k_MAX_DISTANCE);
+        d_next_p   = position + (endFunctor.isAvailable(position, d_distance)
+                                 ? d_distance
+                                 : blockSize);
+    }
+
+    // ACCESSORS
+    bool isDue(const UNIT *position) const
+        // Return 'true' if a block beginning at the specified 'position' may
+        // be examined, and 'false' otherwise.
+    {
+        return !(position < d_next_p);
+    }
+};
+
 // These compile-time asserts aren't strictly necessary, but we may plan to
 // expand this component to support UTF-16 wstrings someday, which won't work
 // if the size of a 'wchar_t' is less than that of a 'short' on any platform
@@ -1023,12 +1491,33 @@ bsl::size_t utf16BufferLength(const char  *srcBuffer,
 
     const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
                                           static_cast<const void*>(srcBuffer));
+    BlockSchedule<Utf8::OctetType> schedule(octets);
     while (!endFunctor.isFinished(octets)) {
         if      (Utf8::isSingleOctet(     *octets)) {
+            if (schedule.isDue(octets)
+             && endFunctor.isAvailable(octets, Block::k_OCTETS)) {
+                if (Block::isAscii(octets)) {
+                    schedule.noteMatch();
+                    octets      += Block::k_OCTETS;
+                    wordsNeeded += Block::k_OCTETS;
+                    continue;
+                }
+                schedule.noteMismatch(octets, Block::k_OCTETS, endFunctor);
+            }
             ++octets;
             ++wordsNeeded;
         }
         else if (Utf8::isTwoOctetHeader(  *octets)) {
+            if (schedule.isDue(octets)
+             && endFunctor.isAvailable(octets, Block::k_OCTETS)) {
+                if (Block::isTwoOctetRun(octets)) {
+                    schedule.noteMatch();
+                    octets      += Block::k_OCTETS;
+                    wordsNeeded += Block::k_WORDS;
+                    continue;
+                }
+                schedule.noteMismatch(octets, Block::k_OCTETS, endFunctor);
+            }
             octets += endFunctor.verifyContinuations(octets + 1, 1) ? 2 : 1;
             ++wordsNeeded;
         }
@@ -1137,6 +1626,12 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
 
     const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
                                           static_cast<const void*>(srcBuffer));
+
+    // Whole blocks of ASCII, or of two-octet sequences, are translated at
+    // once, when 'schedule' permits.
+
+    BlockSchedule<Utf8::OctetType> schedule(octets);
+
     while (!endFunctor.isFinished(octets)) {
         // Checking for output space is tricky.  If we have an error case and
         // no replacement word, we may consume input octets without using any
@@ -1153,6 +1648,27 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
         // Single-octet case is simple and quick.
 
         if (Utf8::isSingleOctet(*octets)) {
+            if (schedule.isDue(octets)
+             && !(dstCapacity < Block::k_OCTETS + 1)
+             && endFunctor.isAvailable(octets, Block::k_OCTETS)) {
+                if (Block::isAscii(octets)) {
+                    unsigned short words[Block::k_OCTETS];
+                    Block::decodeAscii(words, octets);
+                    Block::storeWords(dstBuffer,
+                                      words,
+                                      Block::k_OCTETS,
+                                      swapper);
+
+                    schedule.noteMatch();
+                    octets      += Block::k_OCTETS;
+                    dstBuffer   += Block::k_OCTETS;
+                    dstCapacity -= Block::k_OCTETS;
+                    nCodePoints += Block::k_OCTETS;
+                    continue;
+                }
+                schedule.noteMismatch(octets, Block::k_OCTETS, endFunctor);
+            }
+
             if (dstCapacity < 2) {
                 // Are we out of output room, with only space for the null?
 
@@ -1176,6 +1692,27 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
         UnicodeCodePoint convBuf;
 
         if (Utf8::isTwoOctetHeader(*octets)) {
+            if (schedule.isDue(octets)
+             && !(dstCapacity < Block::k_WORDS + 1)
+             && endFunctor.isAvailable(octets, Block::k_OCTETS)) {
+                if (Block::isTwoOctetRun(octets)) {
+                    unsigned short words[Block::k_WORDS];
+                    Block::decodeTwoOctetRun(words, octets);
+                    Block::storeWords(dstBuffer,
+                                      words,
+                                      Block::k_WORDS,
+                                      swapper);
+
+                    schedule.noteMatch();
+                    octets      += Block::k_OCTETS;
+                    dstBuffer   += Block::k_WORDS;
+                    dstCapacity -= Block::k_WORDS;
+                    nCodePoints += Block::k_WORDS;
+                    continue;
+                }
+                schedule.noteMismatch(octets, Block::k_OCTETS, endFunctor);
+            }
+
             if (!endFunctor.verifyContinuations(octets + 1, 1)) {
                 returnStatus |= INVALID_INPUT_BIT;
                 octets = endFunctor.skipContinuations(octets + 1);
@@ -1345,10 +1882,25 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
     return returnStatus;
 }
 
+template <class UTF16_WORD, class SWAPPER>
+Block::Kind loadBlock(unsigned short   *words,
+                      const UTF16_WORD *srcBuffer,
+                      SWAPPER           swapper)
+    // Load into the 'Block::k_WORDS' words beginning at the specified 'words'
+    // the 'Block::k_WORDS' words beginning at the specified 'srcBuffer', using
+    // the specified 'swapper' to swap or not swap bytes, and return their
+    // classification, or 'Block::e_OTHER' if any of them does not fit in 16
+    // bits.
+{
+    return Block::loadWords(words, srcBuffer, swapper)
+           ? Block::classify(words)
+           : Block::e_OTHER;
+}
+
 template <class UTF16_WORD, class END_FUNCTOR, class SWAPPER>
-bsl::size_t utf8BufferLength(const UTF16_WORD *srcBuffer,
-                             END_FUNCTOR       endFunctor,
-                             SWAPPER           swapper)
+bsl::size_t utf8BufferLength(const UTF16_WORD   *srcBuffer,
+                             const END_FUNCTOR&  endFunctor,
+                             SWAPPER             swapper)
     // Return the length needed in bytes, for a buffer to hold the
     // null-terminated UTF-8 string translated from the specified
     // null-terminated UTF-16 string 'srcBuffer', using the specified
@@ -1358,20 +1910,49 @@ bsl::size_t utf8BufferLength(const UTF16_WORD *srcBuffer,
     // case it will slightly over-estimate the necessary length.  Also note
     // that 'SWAPPER' is a stateless type containing only static functions; we
     // take it as an argument to avoid having to explicitly specify template
-    // arguments when calling this function.
+    // arguments when calling this function.  Also note that 'endFunctor' is
+    // taken by reference so that an end of input it locates is retained for
+    // a translation that follows.
 {
     (void) swapper;    // suppress 'unused' warning
 
     bsl::size_t bytesNeeded = 0;
+
+    BlockSchedule<UTF16_WORD> schedule(srcBuffer);
+
     while (!endFunctor.isFinished(srcBuffer)) {
         UnicodeCodePoint word0, word1;
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if      (Utf16::isSingleUtf8(word0)) {
+            if (schedule.isDue(srcBuffer)
+             && endFunctor.isAvailable(srcBuffer, Block::k_WORDS)) {
+                unsigned short words[Block::k_WORDS];
+                if (Block::e_ASCII == loadBlock(words, srcBuffer, swapper)) {
+                    schedule.noteMatch();
+                    srcBuffer   += Block::k_WORDS;
+                    bytesNeeded += Block::k_WORDS;
+                    continue;
+                }
+                schedule.noteMismatch(srcBuffer, Block::k_WORDS, endFunctor);
+            }
             ++srcBuffer;
             ++bytesNeeded;
         }
         else if (Utf16::isSingleWord(word0)) {
+            if (Utf8::fitsInTwoOctets(word0)
+             && schedule.isDue(srcBuffer)
+             && endFunctor.isAvailable(srcBuffer, Block::k_WORDS)) {
+                unsigned short words[Block::k_WORDS];
+                if (Block::e_TWO_OCTETS ==
+                                       loadBlock(words, srcBuffer, swapper)) {
+                    schedule.noteMatch();
+                    srcBuffer   += Block::k_WORDS;
+                    bytesNeeded += Block::k_OCTETS;
+                    continue;
+                }
+                schedule.noteMismatch(srcBuffer, Block::k_WORDS, endFunctor);
+            }
             ++srcBuffer;
             bytesNeeded += Utf8::fitsInTwoOctets(word0) ? 2 : 3;
         }
@@ -1441,6 +2022,11 @@ int localUtf16ToUtf8(char             *dstBuffer,
 
     bsl::size_t nCodePoints = 0;
 
+    // Whole blocks of words encoding as one octet each, or as two, are
+    // translated at once, when 'schedule' permits.
+
+    BlockSchedule<UTF16_WORD> schedule(srcBuffer);
+
     int returnStatus = 0;
     while (!endFunctor.isFinished(srcBuffer)) {
         // We don't do the out-of-room tests until we know that we can
@@ -1452,6 +2038,23 @@ int localUtf16ToUtf8(char             *dstBuffer,
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if (Utf16::isSingleUtf8(word0)) {
+            if (schedule.isDue(srcBuffer)
+             && !(dstCapacity < Block::k_WORDS + 1)
+             && endFunctor.isAvailable(srcBuffer, Block::k_WORDS)) {
+                unsigned short words[Block::k_WORDS];
+                if (Block::e_ASCII == loadBlock(words, srcBuffer, swapper)) {
+                    Block::encodeAscii(dstBuffer, words);
+
+                    schedule.noteMatch();
+                    srcBuffer   += Block::k_WORDS;
+                    dstBuffer   += Block::k_WORDS;
+                    dstCapacity -= Block::k_WORDS;
+                    nCodePoints += Block::k_WORDS;
+                    continue;
+                }
+                schedule.noteMismatch(srcBuffer, Block::k_WORDS, endFunctor);
+            }
+
             if (dstCapacity < 2) {
                 // One for the code point, one for the null.
 
@@ -1471,6 +2074,25 @@ int localUtf16ToUtf8(char             *dstBuffer,
         // Is it a single-word code point?
 
         if (Utf16::isSingleWord(word0)) {
+            if (Utf8::fitsInTwoOctets(word0)
+             && schedule.isDue(srcBuffer)
+             && !(dstCapacity < Block::k_OCTETS + 1)
+             && endFunctor.isAvailable(srcBuffer, Block::k_WORDS)) {
+                unsigned short words[Block::k_WORDS];
+                if (Block::e_TWO_OCTETS ==
+                                       loadBlock(words, srcBuffer, swapper)) {
+                    Block::encodeTwoOctetRun(dstBuffer, words);
+
+                    schedule.noteMatch();
+                    srcBuffer   += Block::k_WORDS;
+                    dstBuffer   += Block::k_OCTETS;
+                    dstCapacity -= Block::k_OCTETS;
+                    nCodePoints += Block::k_WORDS;
+                    continue;
+                }
+                schedule.noteMismatch(srcBuffer, Block::k_WORDS, endFunctor);
+            }
+
             convBuf = word0;
             ++srcBuffer;
 
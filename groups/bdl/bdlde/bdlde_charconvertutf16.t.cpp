@@ -122,8 +122,9 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [15] USAGE EXAMPLE 2
-// [14] USAGE EXAMPLE 1
+// [16] USAGE EXAMPLE 2
+// [15] USAGE EXAMPLE 1
+// [14] VECTORIZED FAST PATHS
 // [13] BACKWARDS BYTE ORDER TEST
 // [12] EMBEDDED ZEROES TEST
 // [11] UTF-16 -> UTF-8: THOROUGH BROKEN GLASS TEST
@@ -4449,6 +4450,653 @@ bsl::size_t localUtf16Len(const UTF16_WORD *str)
     return pws - str;
 }
 
+// The following functions support the VECTORIZED FAST PATHS test.  Inputs are
+// built from runs of 'tokens', each of which holds a single code point or a
+// single error sequence, chosen so that translating a whole input yields the
+// concatenation of the translations of its tokens.  Long runs of one class of
+// token engage the block-at-a-time fast paths of the translators, while the
+// expected results are obtained by translating the (short) tokens one at a
+// time.
+
+enum FastPathTokenClass {
+    // Classes of the tokens from which fast path test inputs are built.
+
+    e_FP_ASCII,          // one code point encoded in one UTF-8 octet
+    e_FP_TWO_OCTETS,     // one code point encoded in two UTF-8 octets
+    e_FP_THREE_OCTETS,   // one code point encoded in three UTF-8 octets
+    e_FP_FOUR_OCTETS,    // one code point encoded in four UTF-8 octets
+    e_FP_ERROR,          // one error sequence
+    e_FP_NUM_CLASSES
+};
+
+unsigned int fastPathRandom(unsigned int *seed)
+    // Advance the specified '*seed' and return a pseudo-random value in the
+    // range '[ 0 .. 0x7fff ]'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+int fastPathRun(int *runLength, unsigned int *seed)
+    // Return a pseudo-random token class, using the specified '*seed', and
+    // load into the specified '*runLength' the number of consecutive tokens
+    // of that class to generate.  Runs of valid code points are often long
+    // enough to fill several fast path blocks.
+{
+    const int tokenClass = fastPathRandom(seed) % e_FP_NUM_CLASSES;
+
+    *runLength = e_FP_ERROR == tokenClass ? 1 + fastPathRandom(seed) % 3
+                                          : 1 + fastPathRandom(seed) % 48;
+    return tokenClass;
+}
+
+unsigned int fastPathCodePoint(int tokenClass, unsigned int *seed)
+    // Return a pseudo-random, valid, non-zero code point of the specified
+    // 'tokenClass', using the specified '*seed'.  The behavior is undefined if
+    // 'e_FP_ERROR == tokenClass'.
+{
+    const unsigned int r = fastPathRandom(seed) << 15 | fastPathRandom(seed);
+
+    switch (tokenClass) {
+      case e_FP_ASCII: {
+        return 1 + r % 0x7f;                                          // RETURN
+      }
+      case e_FP_TWO_OCTETS: {
+        return 0x80 + r % (0x800 - 0x80);                             // RETURN
+      }
+      case e_FP_THREE_OCTETS: {
+        const unsigned int cp = 0x800 + r % (0x10000 - 0x800 - 0x800);
+
+        return cp < 0xd800 ? cp : cp + 0x800;                         // RETURN
+      }
+      default: {
+        return 0x10000 + r % (0x110000 - 0x10000);                    // RETURN
+      }
+    }
+}
+
+bsl::string fastPathUtf8Token(int           tokenClass,
+                              bool          afterValid,
+                              unsigned int *seed)
+    // Return a pseudo-random UTF-8 token of the specified 'tokenClass', using
+    // the specified '*seed'.  Stray continuation octets are generated only if
+    // the specified 'afterValid' is 'true', indicating that the token will
+    // follow a valid code point rather than an error sequence they might
+    // extend.
+{
+    if (e_FP_ERROR == tokenClass) {
+        static const char *const ERRORS[] = {
+            "\x80",            // stray continuation octets
+            "\xbf",
+            "\xff",            // never valid in UTF-8
+            "\xc3",            // truncated sequences
+            "\xe4\xb8",
+            "\xf2\x94\xb4",
+            "\xc0\x80",        // non-minimal encoding
+            "\xed\xa0\x80",    // encoded surrogate
+        };
+        enum { k_NUM_ERRORS = sizeof ERRORS / sizeof *ERRORS,
+               k_NUM_STRAY  = 2 };
+
+        return afterValid                                             // RETURN
+             ? ERRORS[fastPathRandom(seed) % k_NUM_ERRORS]
+             : ERRORS[k_NUM_STRAY +
+                      fastPathRandom(seed) % (k_NUM_ERRORS - k_NUM_STRAY)];
+    }
+
+    const unsigned int cp = fastPathCodePoint(tokenClass, seed);
+
+    bsl::string ret;
+    switch (tokenClass) {
+      case e_FP_ASCII: {
+        ret += static_cast<char>(cp);
+      } break;
+      case e_FP_TWO_OCTETS: {
+        ret += static_cast<char>(0xc0 | cp >> 6);
+        ret += static_cast<char>(0x80 | (cp & 0x3f));
+      } break;
+      case e_FP_THREE_OCTETS: {
+        ret += static_cast<char>(0xe0 | cp >> 12);
+        ret += static_cast<char>(0x80 | (cp >> 6 & 0x3f));
+        ret += static_cast<char>(0x80 | (cp & 0x3f));
+      } break;
+      default: {
+        ret += static_cast<char>(0xf0 | cp >> 18);
+        ret += static_cast<char>(0x80 | (cp >> 12 & 0x3f));
+        ret += static_cast<char>(0x80 | (cp >> 6 & 0x3f));
+        ret += static_cast<char>(0x80 | (cp & 0x3f));
+      } break;
+    }
+
+    return ret;
+}
+
+bsl::vector<unsigned short> fastPathUtf16Token(int           tokenClass,
+                                               bool          afterLoneFirst,
+                                               unsigned int *seed)
+    // Return a pseudo-random UTF-16 token of the specified 'tokenClass',
+    // using the specified '*seed'.  Lone second surrogates are not generated
+    // if the specified 'afterLoneFirst' is 'true', indicating that the token
+    // will follow a lone first surrogate with which it would form a pair.
+{
+    bsl::vector<unsigned short> ret;
+
+    if (e_FP_ERROR == tokenClass) {
+        const unsigned int r = fastPathRandom(seed);
+
+        const unsigned int base = (r & 1) && !afterLoneFirst ? 0xdc00
+                                                             : 0xd800;
+
+        ret.push_back(static_cast<unsigned short>(base + (r >> 1) % 0x400));
+        return ret;                                                   // RETURN
+    }
+
+    const unsigned int cp = fastPathCodePoint(tokenClass, seed);
+
+    if (cp < 0x10000) {
+        ret.push_back(static_cast<unsigned short>(cp));
+    }
+    else {
+        ret.push_back(static_cast<unsigned short>(
+                                               0xd800 | (cp - 0x10000) >> 10));
+        ret.push_back(static_cast<unsigned short>(0xdc00 | (cp & 0x3ff)));
+    }
+
+    return ret;
+}
+
+template <class UTF16_WORD>
+UTF16_WORD fastPathSwapped(UTF16_WORD word)
+    // Return the specified 'word' with its bytes in the opposite order.
+{
+    unsigned long value = static_cast<unsigned long>(word);
+    unsigned long ret   = 0;
+    for (unsigned int ii = 0; ii < sizeof(UTF16_WORD); ++ii) {
+        ret   = ret << 8 | (value & 0xff);
+        value >>= 8;
+    }
+
+    return static_cast<UTF16_WORD>(ret);
+}
+
+template <class UTF16_WORD>
+void checkFastPathUtf8ToUtf16Buffer(
+                          int                                line,
+                          const bsl::string&                 src,
+                          bool                               nullTerminated,
+                          bsl::size_t                        capacity,
+                          bdlde::ByteOrder::Enum             byteOrder,
+                          UTF16_WORD                         errorWord,
+                          const bsl::vector<unsigned short>& expected,
+                          const bsl::vector<bsl::size_t>&    ends,
+                          const bsl::vector<bsl::size_t>&    codePoints,
+                          int                                expectedRc)
+    // Translate the specified UTF-8 'src', as a null-terminated string if the
+    // specified 'nullTerminated' is 'true' and as a 'bslstl::StringRef'
+    // otherwise, into a buffer of 'UTF16_WORD' of the specified 'capacity'
+    // in the specified 'byteOrder', substituting the specified 'errorWord'
+    // for errors, and verify the results against the specified 'expected'
+    // translation of 'src' in host byte order, the specified 'ends' and
+    // 'codePoints' giving the number of words and of code points (including
+    // the terminating null) in the translation of each prefix of the tokens of
+    // 'src', and the specified 'expectedRc' return value of translating all
+    // of 'src'.  Only the words reported as written may be modified.  Use the
+    // specified 'line' to identify failures.
+{
+    const UTF16_WORD SENTINEL = static_cast<UTF16_WORD>(0x5a5a);
+
+    bsl::size_t numTokens = 0;
+    while (numTokens < ends.size() && ends[numTokens] < capacity) {
+        ++numTokens;
+    }
+    const bool        fits     = ends.size() == numTokens;
+    const bsl::size_t numWords = numTokens ? ends[numTokens - 1] : 0;
+    const bsl::size_t numCps   = numTokens ? codePoints[numTokens - 1] : 1;
+
+    bsl::vector<UTF16_WORD> buffer(capacity + 8, SENTINEL);
+
+    bsl::size_t nc = -1, nw = -1;
+    const int   rc = nullTerminated
+                   ? Util::utf8ToUtf16(&buffer[0],
+                                       capacity,
+                                       src.c_str(),
+                                       &nc,
+                                       &nw,
+                                       errorWord,
+                                       byteOrder)
+                   : Util::utf8ToUtf16(&buffer[0],
+                                       capacity,
+                                       bslstl::StringRef(src),
+                                       &nc,
+                                       &nw,
+                                       errorWord,
+                                       byteOrder);
+
+    LOOP4_ASSERT(line, capacity, numWords + 1, nw, numWords + 1 == nw);
+    LOOP4_ASSERT(line, capacity, numCps, nc, numCps == nc);
+    if (fits) {
+        LOOP4_ASSERT(line, capacity, expectedRc, rc, expectedRc == rc);
+    }
+    else {
+        LOOP3_ASSERT(line, capacity, rc, Status::k_OUT_OF_SPACE_BIT & rc);
+    }
+
+    const bool swap = bdlde::ByteOrder::e_HOST != byteOrder;
+    for (bsl::size_t ii = 0; ii < buffer.size(); ++ii) {
+        const UTF16_WORD EXP = ii < numWords
+                             ? static_cast<UTF16_WORD>(expected[ii])
+                             : ii == numWords ? 0 : SENTINEL;
+        const UTF16_WORD GOT = swap && ii <= numWords
+                             ? fastPathSwapped(buffer[ii])
+                             : buffer[ii];
+        if (EXP != GOT) {
+            LOOP4_ASSERT(line, capacity, ii, numWords, EXP == GOT);
+            break;
+        }
+    }
+}
+
+void testFastPathsUtf8ToUtf16(int                             line,
+                              const bsl::vector<bsl::string>& tokens,
+                              unsigned short                  errorWord,
+                              unsigned int                   *seed)
+    // Verify the translation to UTF-16, through every container and buffer
+    // interface and in both byte orders, of the UTF-8 input made of the
+    // specified 'tokens', substituting the specified 'errorWord' for errors
+    // and using the specified '*seed' to choose buffer capacities.  Use the
+    // specified 'line' to identify failures.
+{
+    bsl::string                 src;
+    bsl::vector<unsigned short> expected;
+    bsl::vector<bsl::size_t>    ends;
+    bsl::vector<bsl::size_t>    codePoints;
+    bsl::size_t                 numCodePoints = 1;
+    int                         expectedRc    = 0;
+
+    for (bsl::size_t ti = 0; ti < tokens.size(); ++ti) {
+        bsl::vector<unsigned short> out;
+        bsl::size_t                 nc = -1;
+        expectedRc |= Util::utf8ToUtf16(&out,
+                                        bslstl::StringRef(tokens[ti]),
+                                        &nc,
+                                        errorWord);
+        ASSERT(!out.empty() && 0 == out.back());
+
+        src           += tokens[ti];
+        expected.insert(expected.end(), out.begin(), out.end() - 1);
+        numCodePoints += nc - 1;
+        ends.push_back(expected.size());
+        codePoints.push_back(numCodePoints);
+    }
+
+    if (veryVeryVerbose) {
+        P_(line) P_(src.length()) P(expected.size());
+    }
+
+    for (int bo = 0; bo < 2; ++bo) {
+        const bdlde::ByteOrder::Enum ORDER = bo ? e_BACKWARDS
+                                                : bdlde::ByteOrder::e_HOST;
+
+        for (int nt = 0; nt < 2; ++nt) {
+            bsl::vector<unsigned short> v;
+            bsl::size_t                 nc = -1;
+            int                         rc = nt
+                                           ? Util::utf8ToUtf16(&v,
+                                                               src.c_str(),
+                                                               &nc,
+                                                               errorWord,
+                                                               ORDER)
+                                           : Util::utf8ToUtf16(
+                                                        &v,
+                                                        bslstl::StringRef(src),
+                                                        &nc,
+                                                        errorWord,
+                                                        ORDER);
+            LOOP4_ASSERT(line, bo, nt, rc, expectedRc == rc);
+            LOOP4_ASSERT(line, bo, nt, nc, numCodePoints == nc);
+            LOOP3_ASSERT(line, bo, nt, expected.size() + 1 == v.size());
+            if (expected.size() + 1 == v.size()) {
+                for (bsl::size_t ii = 0; ii < expected.size(); ++ii) {
+                    const unsigned short GOT = bo ? fastPathSwapped(v[ii])
+                                                  : v[ii];
+                    if (expected[ii] != GOT) {
+                        LOOP4_ASSERT(line, bo, nt, ii, expected[ii] == GOT);
+                        break;
+                    }
+                }
+            }
+
+            bsl::wstring w;
+            nc = -1;
+            rc = nt ? Util::utf8ToUtf16(&w,
+                                        src.c_str(),
+                                        &nc,
+                                        errorWord,
+                                        ORDER)
+                    : Util::utf8ToUtf16(&w,
+                                        bslstl::StringRef(src),
+                                        &nc,
+                                        errorWord,
+                                        ORDER);
+            LOOP4_ASSERT(line, bo, nt, rc, expectedRc == rc);
+            LOOP4_ASSERT(line, bo, nt, nc, numCodePoints == nc);
+            LOOP3_ASSERT(line, bo, nt, expected.size() == w.length());
+            if (expected.size() == w.length()) {
+                for (bsl::size_t ii = 0; ii < expected.size(); ++ii) {
+                    const wchar_t GOT = bo ? fastPathSwapped(w[ii]) : w[ii];
+                    if (static_cast<wchar_t>(expected[ii]) != GOT) {
+                        LOOP4_ASSERT(line, bo, nt, ii,
+                                     static_cast<wchar_t>(expected[ii]) ==
+                                                                          GOT);
+                        break;
+                    }
+                }
+            }
+
+            const bsl::size_t CAPACITIES[] = {
+                1,
+                2,
+                1 + fastPathRandom(seed) % (expected.size() + 1),
+                1 + fastPathRandom(seed) % (expected.size() + 1),
+                expected.size(),
+                expected.size() + 1,
+                expected.size() + 17
+            };
+            enum { k_NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES };
+
+            for (int ci = 0; ci < k_NUM_CAPACITIES; ++ci) {
+                if (0 == CAPACITIES[ci]) {
+                    continue;
+                }
+
+                checkFastPathUtf8ToUtf16Buffer(line,
+                                               src,
+                                               nt,
+                                               CAPACITIES[ci],
+                                               ORDER,
+                                               errorWord,
+                                               expected,
+                                               ends,
+                                               codePoints,
+                                               expectedRc);
+                checkFastPathUtf8ToUtf16Buffer(
+                                             line,
+                                             src,
+                                             nt,
+                                             CAPACITIES[ci],
+                                             ORDER,
+                                             static_cast<wchar_t>(errorWord),
+                                             expected,
+                                             ends,
+                                             codePoints,
+                                             expectedRc);
+            }
+        }
+    }
+}
+
+int fastPathUtf16ToUtf8(char                               *dstBuffer,
+                        bsl::size_t                         dstCapacity,
+                        const bsl::vector<unsigned short>&  src,
+                        bool                                ,
+                        bsl::size_t                        *numCodePoints,
+                        bsl::size_t                        *numBytes,
+                        char                                errorByte,
+                        bdlde::ByteOrder::Enum              byteOrder)
+    // Translate the specified null-terminated 'src' into the specified
+    // 'dstBuffer' of the specified 'dstCapacity', passing the specified
+    // 'numCodePoints', 'numBytes', 'errorByte', and 'byteOrder' on to
+    // 'utf16ToUtf8', and return its result.  Note that 'unsigned short' input
+    // can only be passed null-terminated.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             &src[0],
+                             numCodePoints,
+                             numBytes,
+                             errorByte,
+                             byteOrder);
+}
+
+int fastPathUtf16ToUtf8(char                        *dstBuffer,
+                        bsl::size_t                  dstCapacity,
+                        const bsl::vector<wchar_t>&  src,
+                        bool                         nullTerminated,
+                        bsl::size_t                 *numCodePoints,
+                        bsl::size_t                 *numBytes,
+                        char                         errorByte,
+                        bdlde::ByteOrder::Enum       byteOrder)
+    // Translate the specified null-terminated 'src', as a null-terminated
+    // string if the specified 'nullTerminated' is 'true' and as a
+    // 'bslstl::StringRefWide' otherwise, into the specified 'dstBuffer' of the
+    // specified 'dstCapacity', passing the specified 'numCodePoints',
+    // 'numBytes', 'errorByte', and 'byteOrder' on to 'utf16ToUtf8', and return
+    // its result.
+{
+    return nullTerminated
+           ? Util::utf16ToUtf8(dstBuffer,
+                               dstCapacity,
+                               &src[0],
+                               numCodePoints,
+                               numBytes,
+                               errorByte,
+                               byteOrder)
+           : Util::utf16ToUtf8(dstBuffer,
+                               dstCapacity,
+                               bslstl::StringRefWide(&src[0], src.size() - 1),
+                               numCodePoints,
+                               numBytes,
+                               errorByte,
+                               byteOrder);
+}
+
+template <class UTF16_WORD>
+void checkFastPathUtf16ToUtf8Buffer(
+                               int                             line,
+                               const bsl::vector<UTF16_WORD>&  src,
+                               bool                            nullTerminated,
+                               bsl::size_t                     capacity,
+                               bdlde::ByteOrder::Enum          byteOrder,
+                               char                            errorByte,
+                               const bsl::string&              expected,
+                               const bsl::vector<bsl::size_t>& ends,
+                               const bsl::vector<bsl::size_t>& codePoints,
+                               int                             expectedRc)
+    // Translate the specified null-terminated UTF-16 'src' in the specified
+    // 'byteOrder', as a null-terminated string if the specified
+    // 'nullTerminated' is 'true' and as a 'bslstl::StringRefWide' otherwise,
+    // into a buffer of the specified 'capacity', substituting the specified
+    // 'errorByte' for errors, and verify the results against the specified
+    // 'expected' translation of 'src', the specified 'ends' and 'codePoints'
+    // giving the number of octets and of code points (including the
+    // terminating null) in the translation of each prefix of the tokens of
+    // 'src', and the specified 'expectedRc' return value of translating all
+    // of 'src'.  Only the octets reported as written may be modified.  Use
+    // the specified 'line' to identify failures.  The behavior is undefined
+    // unless 'nullTerminated' or 'UTF16_WORD' is 'wchar_t'.
+{
+    const char SENTINEL = static_cast<char>(0xa5);
+
+    bsl::size_t numTokens = 0;
+    while (numTokens < ends.size() && ends[numTokens] < capacity) {
+        ++numTokens;
+    }
+    const bool        fits      = ends.size() == numTokens;
+    const bsl::size_t numOctets = numTokens ? ends[numTokens - 1] : 0;
+    const bsl::size_t numCps    = numTokens ? codePoints[numTokens - 1] : 1;
+
+    bsl::vector<char> buffer(capacity + 8, SENTINEL);
+
+    bsl::size_t nc = -1, nb = -1;
+    const int   rc = fastPathUtf16ToUtf8(&buffer[0],
+                                         capacity,
+                                         src,
+                                         nullTerminated,
+                                         &nc,
+                                         &nb,
+                                         errorByte,
+                                         byteOrder);
+
+    LOOP4_ASSERT(line, capacity, numOctets + 1, nb, numOctets + 1 == nb);
+    LOOP4_ASSERT(line, capacity, numCps, nc, numCps == nc);
+    if (fits) {
+        LOOP4_ASSERT(line, capacity, expectedRc, rc, expectedRc == rc);
+    }
+    else {
+        LOOP3_ASSERT(line, capacity, rc, Status::k_OUT_OF_SPACE_BIT & rc);
+    }
+
+    for (bsl::size_t ii = 0; ii < buffer.size(); ++ii) {
+        const char EXP = ii < numOctets ? expected[ii]
+                                        : ii == numOctets ? 0 : SENTINEL;
+        if (EXP != buffer[ii]) {
+            LOOP4_ASSERT(line, capacity, ii, numOctets, EXP == buffer[ii]);
+            break;
+        }
+    }
+}
+
+void testFastPathsUtf16ToUtf8(
+                     int                                             line,
+                     const bsl::vector<bsl::vector<unsigned short> >& tokens,
+                     char                                            errorByte,
+                     unsigned int                                   *seed)
+    // Verify the translation to UTF-8, through every container and buffer
+    // interface and in both byte orders, of the UTF-16 input made of the
+    // specified 'tokens', substituting the specified 'errorByte' for errors
+    // and using the specified '*seed' to choose buffer capacities.  Use the
+    // specified 'line' to identify failures.
+{
+    bsl::vector<unsigned short> src;
+    bsl::string                 expected;
+    bsl::vector<bsl::size_t>    ends;
+    bsl::vector<bsl::size_t>    codePoints;
+    bsl::size_t                 numCodePoints = 1;
+    int                         expectedRc    = 0;
+
+    for (bsl::size_t ti = 0; ti < tokens.size(); ++ti) {
+        bsl::vector<unsigned short> token(tokens[ti]);
+        token.push_back(0);
+
+        bsl::string out;
+        bsl::size_t nc = -1;
+        expectedRc |= Util::utf16ToUtf8(&out, &token[0], &nc, errorByte);
+
+        src.insert(src.end(), tokens[ti].begin(), tokens[ti].end());
+        expected      += out;
+        numCodePoints += nc - 1;
+        ends.push_back(expected.length());
+        codePoints.push_back(numCodePoints);
+    }
+    src.push_back(0);
+
+    if (veryVeryVerbose) {
+        P_(line) P_(src.size()) P(expected.length());
+    }
+
+    for (int bo = 0; bo < 2; ++bo) {
+        const bdlde::ByteOrder::Enum ORDER = bo ? e_BACKWARDS
+                                                : bdlde::ByteOrder::e_HOST;
+
+        bsl::vector<unsigned short> src16(src);
+        bsl::vector<wchar_t>        srcW(src.begin(), src.end());
+        if (bo) {
+            for (bsl::size_t ii = 0; ii < src.size(); ++ii) {
+                src16[ii] = fastPathSwapped(src16[ii]);
+                srcW[ii]  = fastPathSwapped(srcW[ii]);
+            }
+        }
+        const bslstl::StringRefWide srcRef(&srcW[0], srcW.size() - 1);
+
+        for (int si = 0; si < 3; ++si) {
+            bsl::string s;
+            bsl::size_t nc = -1;
+            int         rc = 0 == si
+                           ? Util::utf16ToUtf8(&s,
+                                               &src16[0],
+                                               &nc,
+                                               errorByte,
+                                               ORDER)
+                           : 1 == si
+                           ? Util::utf16ToUtf8(&s,
+                                               &srcW[0],
+                                               &nc,
+                                               errorByte,
+                                               ORDER)
+                           : Util::utf16ToUtf8(&s,
+                                               srcRef,
+                                               &nc,
+                                               errorByte,
+                                               ORDER);
+            LOOP4_ASSERT(line, bo, si, rc, expectedRc == rc);
+            LOOP4_ASSERT(line, bo, si, nc, numCodePoints == nc);
+            LOOP3_ASSERT(line, bo, si, expected == s);
+
+            bsl::vector<char> v;
+            nc = -1;
+            rc = 0 == si ? Util::utf16ToUtf8(&v,
+                                             &src16[0],
+                                             &nc,
+                                             errorByte,
+                                             ORDER)
+               : 1 == si ? Util::utf16ToUtf8(&v,
+                                             &srcW[0],
+                                             &nc,
+                                             errorByte,
+                                             ORDER)
+               :           Util::utf16ToUtf8(&v,
+                                             srcRef,
+                                             &nc,
+                                             errorByte,
+                                             ORDER);
+            LOOP4_ASSERT(line, bo, si, rc, expectedRc == rc);
+            LOOP4_ASSERT(line, bo, si, nc, numCodePoints == nc);
+            LOOP3_ASSERT(line, bo, si, expected.length() + 1 == v.size()
+                                     && expected == &v[0]);
+        }
+
+        const bsl::size_t CAPACITIES[] = {
+            1,
+            2,
+            1 + fastPathRandom(seed) % (expected.length() + 1),
+            1 + fastPathRandom(seed) % (expected.length() + 1),
+            expected.length(),
+            expected.length() + 1,
+            expected.length() + 33
+        };
+        enum { k_NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES };
+
+        for (int ci = 0; ci < k_NUM_CAPACITIES; ++ci) {
+            if (0 == CAPACITIES[ci]) {
+                continue;
+            }
+
+            checkFastPathUtf16ToUtf8Buffer(line,
+                                           src16,
+                                           true,
+                                           CAPACITIES[ci],
+                                           ORDER,
+                                           errorByte,
+                                           expected,
+                                           ends,
+                                           codePoints,
+                                           expectedRc);
+            for (int nt = 0; nt < 2; ++nt) {
+                checkFastPathUtf16ToUtf8Buffer(line,
+                                               srcW,
+                                               nt,
+                                               CAPACITIES[ci],
+                                               ORDER,
+                                               errorByte,
+                                               expected,
+                                               ends,
+                                               codePoints,
+                                               expectedRc);
+            }
+        }
+    }
+}
+
 
 // ============================================================================
 //                               MAIN PROGRAM
@@ -4466,7 +5114,7 @@ int main(int argc, char**argv)
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -4590,7 +5238,7 @@ int main(int argc, char**argv)
     ASSERT(utf16CodePointsWritten       == uf8CodePointsWritten);
 //..
       } break;
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
@@ -4683,6 +5331,89 @@ int main(int argc, char**argv)
     ASSERT(0    == secondUtf16String[5]);
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // VECTORIZED FAST PATHS
+        //
+        // Concerns:
+        //: 1 Runs of code points that each encode as one UTF-8 octet, or that
+        //:   each encode as two, which the translators process a block at a
+        //:   time, are translated exactly as they are a code point at a time,
+        //:   in both directions and both byte orders, from null-terminated
+        //:   and 'StringRef' input, to containers and to buffers.
+        //:
+        //: 2 Runs beginning and ending anywhere relative to a block, runs
+        //:   interrupted by other code points or by error sequences, and the
+        //:   end of input or of the output buffer falling within a block, are
+        //:   handled correctly, including error substitution and the counts of
+        //:   code points and of words or octets written.
+        //:
+        //: 3 No memory past the reported output is written.
+        //
+        // Plan:
+        //: 1 Build pseudo-random inputs from runs of 'tokens', each holding a
+        //:   single code point or error sequence, of random class and length,
+        //:   so that many runs span several blocks.  Obtain the expected
+        //:   results by translating the tokens, each too short for a fast
+        //:   path, one at a time.  (C-1..2)
+        //:
+        //: 2 Translate each input through every interface, with a non-zero
+        //:   and a zero error substitute, in both byte orders, and compare
+        //:   with the expected results.  (C-1..2)
+        //:
+        //: 3 Translate each input into buffers of various capacities, filled
+        //:   beforehand with a sentinel value, and verify that the longest
+        //:   prefix of tokens whose translation fits is written, followed by a
+        //:   null and nothing else.  (C-2..3)
+        //
+        // Testing:
+        //   VECTORIZED FAST PATHS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "VECTORIZED FAST PATHS\n"
+                             "=====================\n";
+
+        unsigned int seed = 12345;
+
+        for (int ti = 0; ti < 200; ++ti) {
+            bsl::vector<bsl::string>                  utf8Tokens;
+            bsl::vector<bsl::vector<unsigned short> > utf16Tokens;
+
+            bool afterValid     = true;
+            bool afterLoneFirst = false;
+
+            const int numRuns = 1 + fastPathRandom(&seed) % 12;
+            for (int ri = 0; ri < numRuns; ++ri) {
+                int       runLength;
+                const int tokenClass = fastPathRun(&runLength, &seed);
+
+                for (int rj = 0; rj < runLength; ++rj) {
+                    utf8Tokens.push_back(fastPathUtf8Token(tokenClass,
+                                                           afterValid,
+                                                           &seed));
+                    afterValid = e_FP_ERROR != tokenClass;
+
+                    utf16Tokens.push_back(fastPathUtf16Token(tokenClass,
+                                                             afterLoneFirst,
+                                                             &seed));
+                    const bsl::vector<unsigned short>& TOKEN =
+                                                           utf16Tokens.back();
+                    afterLoneFirst = 1 == TOKEN.size()
+                                  && 0xd800 == (TOKEN[0] & 0xfc00);
+                }
+            }
+
+            if (veryVerbose) {
+                P_(ti) P_(utf8Tokens.size()) P(utf16Tokens.size());
+            }
+
+            testFastPathsUtf8ToUtf16(L_, utf8Tokens, '?', &seed);
+            testFastPathsUtf8ToUtf16(L_, utf8Tokens, 0,   &seed);
+
+            testFastPathsUtf16ToUtf8(L_, utf16Tokens, '?', &seed);
+            testFastPathsUtf16ToUtf8(L_, utf16Tokens, 0,   &seed);
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // BACKWARDS BYTE ORDER TEST
@@ -14,8 +14,21 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#define BDLDE_UTF8UTIL_SSE2 1
+#include <emmintrin.h>
+#if (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)    \
+ || (defined(BSLS_PLATFORM_CMP_CLANG) && BSLS_PLATFORM_CMP_VERSION >= 30800)
+#define BDLDE_UTF8UTIL_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -33,8 +46,11 @@ enum {
 
     k_MAX_VALID = 0x10ffff,        // max value that can be encoded in UTF-8
 
-    k_CONT_VALUE_MASK = 0x3f       // part of a continuation byte that contains
+    k_CONT_VALUE_MASK = 0x3f,      // part of a continuation byte that contains
                                    // the 6 bits of value info
+
+    k_ASCII_BLOCK_SIZE = 16        // number of bytes examined at once by the
+                                   // ASCII fast path
 };
 
 }  // close unnamed namespace
@@ -92,107 +108,272 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
-static
-int validateAndCountCodePoints(const char **invalidString, const char *string)
-    // Return the number of Unicode code points in the specified 'string' if it
-    // contains valid UTF-8, with no effect on the specified 'invalidString'.
-    // Otherwise, return a negative value and load into 'invalidString' the
-    // address of the first sequence in 'string' that does not constitute the
-    // start of a valid UTF-8 encoding specifying a valid Unicode code point.
-    // 'string' is necessarily null-terminated, so it cannot contain embedded
-    // null bytes.  Note that 'string' may contain less than
-    // 'bsl::strlen(string)' Unicode code points.
+static inline
+bool isAsciiBlock(const char *pc)
+    // Return 'true' if none of the 'k_ASCII_BLOCK_SIZE' bytes starting at the
+    // specified 'pc' has its high-order bit set, and 'false' otherwise.
 {
-    // The following assertions are redundant with those in the CLASS METHODS.
-    // Hence, 'BSLS_ASSERT_SAFE' is used.
-
-    BSLS_ASSERT_SAFE(invalidString);
-    BSLS_ASSERT_SAFE(string);
+#if defined(BDLDE_UTF8UTIL_SSE2)
+    return 0 == _mm_movemask_epi8(
+                       _mm_loadu_si128(reinterpret_cast<const __m128i *>(pc)));
+#else
+    BloombergLP::bsls::Types::Uint64 words[2];
+    bsl::memcpy(words, pc, sizeof words);
+
+    return 0 == ((words[0] | words[1]) & 0x8080808080808080ULL);
+#endif
+}
 
-    int count = 0;
+#if defined(BDLDE_UTF8UTIL_AVX2)
 
-    while (true) {
-        switch ((*string >> 4) & 0xf) {
-          case 0:
-          case 1:
-          case 2:
-          case 3:
-          case 4:
-          case 5:
-          case 6:
-          case 7: {
-            if (UNLIKELY(!*string)) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-                return count;                                         // RETURN
-            }
-            ++string;
-          } break;
-          case 0xc:
-          case 0xd: {
-            if (UNLIKELY(isNotContinuation(string[1]))) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+static inline
+bool isAvx2Supported()
+    // Return 'true' if the processor executing this function, and the
+    // operating system, support AVX2 instructions, and 'false' otherwise.
+{
+    return __builtin_cpu_supports("avx2");
+}
 
-                *invalidString = string;
-                return -1;                                            // RETURN
+__attribute__((target("avx2")))
+static
+BloombergLP::bsls::Types::IntPtr validateAndCountPrefixAvx2(
+                                      int                              *count,
+                                      const char                       *string,
+                                      BloombergLP::bsls::Types::IntPtr  length)
+    // Validate, 32 bytes at a time, the longest prefix of the specified
+    // 'string' having the specified 'length' (in bytes) that consists of
+    // whole 32-byte blocks of valid UTF-8, load into the specified 'count' the
+    // number of Unicode code points in that prefix, and return the length of
+    // the prefix, which is truncated to the start of any code point that it
+    // does not entirely contain.  The bytes of 'string' following the
+    // returned length, if any, must be examined by the scalar validator, which
+    // also pinpoints any invalid sequence.  The behavior is undefined unless
+    // the processor supports AVX2.  Note that this is the lookup-table
+    // algorithm of Keiser and Lemire ("Validating UTF-8 In Less Than One
+    // Instruction Per Byte", 2020), under which the error bits from three
+    // 16-entry tables -- indexed by the high and low nibbles of the previous
+    // byte and the high nibble of the current byte -- are 'and'ed together,
+    // so that a byte pair is flagged exactly when it cannot occur in valid
+    // UTF-8, and the 3rd and 4th bytes of multi-byte sequences are checked
+    // separately against the lead byte 2 and 3 positions back.
+{
+    typedef BloombergLP::bsls::Types::IntPtr IntPtr;
+
+    enum {
+        k_TOO_SHORT  = 0x01,  // lead byte not followed by a continuation
+        k_TOO_LONG   = 0x02,  // ASCII byte followed by a continuation
+        k_OVERLONG_3 = 0x04,  // '0xe0' followed by '0x80 .. 0x9f'
+        k_TOO_LARGE  = 0x08,  // value above 'U+10ffff'
+        k_SURROGATE  = 0x10,  // '0xed' followed by '0xa0 .. 0xbf'
+        k_OVERLONG_2 = 0x20,  // '0xc0' or '0xc1' lead byte
+        k_TOO_LARGE2 = 0x40,  // '0xf5 .. 0xff' followed by '0x80 .. 0x8f'
+        k_OVERLONG_4 = 0x40,  // '0xf0' followed by '0x80 .. 0x8f'
+        k_TWO_CONTS  = 0x80,  // continuation followed by a continuation
+
+        k_CARRY      = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+    };
+
+    const __m256i byte1High = _mm256_setr_epi8(
+        // high nibble of the previous byte: 0 .. 7 (ASCII)
+
+        k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,
+        k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,
+
+        // 8 .. b (continuation)
+
+        k_TWO_CONTS,  k_TWO_CONTS,  k_TWO_CONTS,  k_TWO_CONTS,
+
+        // c, d (2-byte lead), e (3-byte lead), f (4-byte lead)
+
+        k_TOO_SHORT | k_OVERLONG_2,
+        k_TOO_SHORT,
+        k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,
+        k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE2 | k_OVERLONG_4,
+
+        // the same 16 entries, for the high 128-bit lane
+
+        k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,
+        k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,   k_TOO_LONG,
+        k_TWO_CONTS,  k_TWO_CONTS,  k_TWO_CONTS,  k_TWO_CONTS,
+        k_TOO_SHORT | k_OVERLONG_2,
+        k_TOO_SHORT,
+        k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,
+        k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE2 | k_OVERLONG_4);
+
+    const __m256i byte1Low = _mm256_setr_epi8(
+        // low nibble of the previous byte: 0 .. f
+
+        k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,
+        k_CARRY | k_OVERLONG_2,
+        k_CARRY,
+        k_CARRY,
+        k_CARRY | k_TOO_LARGE,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2 | k_SURROGATE,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+
+        // the same 16 entries, for the high 128-bit lane
+
+        k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,
+        k_CARRY | k_OVERLONG_2,
+        k_CARRY,
+        k_CARRY,
+        k_CARRY | k_TOO_LARGE,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2 | k_SURROGATE,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE2);
+
+    const int k_CONT_ERRORS = k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS;
+
+    const __m256i byte2High = _mm256_setr_epi8(
+        // high nibble of the current byte: 0 .. 7 (ASCII)
+
+        k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,
+        k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,
+
+        // 8, 9, a, b (continuation)
+
+        k_CONT_ERRORS | k_OVERLONG_3 | k_TOO_LARGE2 | k_OVERLONG_4,
+        k_CONT_ERRORS | k_OVERLONG_3 | k_TOO_LARGE,
+        k_CONT_ERRORS | k_SURROGATE  | k_TOO_LARGE,
+        k_CONT_ERRORS | k_SURROGATE  | k_TOO_LARGE,
+
+        // c .. f (lead)
+
+        k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,
+
+        // the same 16 entries, for the high 128-bit lane
+
+        k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,
+        k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,
+        k_CONT_ERRORS | k_OVERLONG_3 | k_TOO_LARGE2 | k_OVERLONG_4,
+        k_CONT_ERRORS | k_OVERLONG_3 | k_TOO_LARGE,
+        k_CONT_ERRORS | k_SURROGATE  | k_TOO_LARGE,
+        k_CONT_ERRORS | k_SURROGATE  | k_TOO_LARGE,
+        k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT,  k_TOO_SHORT);
+
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+    const __m256i highBit    = _mm256_set1_epi8(static_cast<char>(0x80));
+    const __m256i thirdBase  = _mm256_set1_epi8(0xe0 - 0x80);
+    const __m256i fourthBase = _mm256_set1_epi8(0xf0 - 0x80);
+    const __m256i lastCont   = _mm256_set1_epi8(static_cast<char>(0xbf));
+
+    // A byte of 'incompleteBase' is exceeded by a byte of a block exactly
+    // when that byte starts a sequence extending past the end of the block.
+
+    const __m256i incompleteBase = _mm256_setr_epi8(
+              -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+              -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+              static_cast<char>(0xf0 - 1),
+              static_cast<char>(0xe0 - 1),
+              static_cast<char>(0xc0 - 1));
+
+    __m256i prev       = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+
+    IntPtr offset = 0;
+    int    num    = 0;
+
+    for (; offset + 32 <= length; offset += 32) {
+        const __m256i input = _mm256_loadu_si256(
+                           reinterpret_cast<const __m256i *>(string + offset));
+
+        if (0 == _mm256_movemask_epi8(input)) {
+            // ASCII fast path: the block is valid unless the previous block
+            // ended with an incomplete sequence.
+
+            if (!_mm256_testz_si256(incomplete, incomplete)) {
+                break;
             }
-            const int value = get2ByteValue(string);
-            if (UNLIKELY(value < k_MIN_2_BYTE_VALUE)) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            num  += 32;
+            prev  = input;
+            continue;
+        }
 
-                *invalidString = string;
-                return -1;                                            // RETURN
-            }
-            string += 2;
-          } break;
-          case 0xe: {
-            if (UNLIKELY(isNotContinuation(string[1]))
-             || UNLIKELY(isNotContinuation(string[2]))) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        const __m256i carried = _mm256_permute2x128_si256(prev, input, 0x21);
+        const __m256i prev1   = _mm256_alignr_epi8(input, carried, 15);
+        const __m256i prev2   = _mm256_alignr_epi8(input, carried, 14);
+        const __m256i prev3   = _mm256_alignr_epi8(input, carried, 13);
+
+        const __m256i special = _mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_shuffle_epi8(byte1High,
+                                    _mm256_and_si256(_mm256_srli_epi16(prev1,
+                                                                       4),
+                                                     nibbleMask)),
+                _mm256_shuffle_epi8(byte1Low,
+                                    _mm256_and_si256(prev1, nibbleMask))),
+            _mm256_shuffle_epi8(byte2High,
+                                _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                                 nibbleMask)));
+
+        const __m256i must23 = _mm256_and_si256(
+                              _mm256_or_si256(_mm256_subs_epu8(prev2,
+                                                               thirdBase),
+                                              _mm256_subs_epu8(prev3,
+                                                               fourthBase)),
+                              highBit);
+
+        const __m256i error = _mm256_xor_si256(must23, special);
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
 
-                *invalidString = string;
-                return -1;                                            // RETURN
-            }
-            const int value = get3ByteValue(string);
-            if (UNLIKELY((value < k_MIN_3_BYTE_VALUE)
-                       | isSurrogateValue(value))) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // Count the bytes that are not continuations, i.e., that are greater
+        // than '0xbf' or less than '0x80'.
 
-                *invalidString = string;
-                return -1;                                            // RETURN
-            }
-            string += 3;
-          } break;
-          case 0xf: {
-            if (UNLIKELY(isNotContinuation(string[1]))
-             || UNLIKELY(isNotContinuation(string[2]))
-             || UNLIKELY(isNotContinuation(string[3]))) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        num += __builtin_popcount(_mm256_movemask_epi8(
+                                  _mm256_cmpgt_epi8(input, lastCont)));
+        incomplete = _mm256_subs_epu8(input, incompleteBase);
+        prev       = input;
+    }
 
-                *invalidString = string;
-                return -1;                                            // RETURN
-            }
-            const int value = get4ByteValue(string);
-            if (UNLIKELY((8 & *string)
-                       | (value < k_MIN_4_BYTE_VALUE)
-                       | (value > k_MAX_VALID))) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    // Every byte of the first 'offset' bytes of 'string' has been validated
+    // against the bytes preceding it, so that those bytes consist of complete
+    // valid sequences followed by, at most, the first 1, 2, or 3 bytes of a
+    // valid sequence.  Back up to the start of any such incomplete sequence.
 
-                *invalidString = string;
-                return -1;                                            // RETURN
-            }
-            string += 4;
-          } break;
-          default: {
-            *invalidString = string;
-            return -1;                                                // RETURN
-          }
+    if (offset) {
+        const char *pc   = string + offset - 1;
+        const char *stop = string + offset - 4;
+        while (pc > stop && !isNotContinuation(*pc)) {
+            --pc;
         }
 
-        ++count;
+        const unsigned char lead =
+                                  *reinterpret_cast<const unsigned char *>(pc);
+        const IntPtr        seqLength = lead < 0x80 ? 1
+                                      : lead < 0xe0 ? 2
+                                      : lead < 0xf0 ? 3
+                                      : 4;
+        if (pc + seqLength > string + offset) {
+            offset = pc - string;
+            --num;
+        }
     }
+
+    *count = num;
+    return offset;
 }
 
+#endif
+
 static
 int validateAndCountCodePoints(
                               const char                       **invalidString,
@@ -215,10 +396,17 @@ int validateAndCountCodePoints(
     BSLS_ASSERT_SAFE(0 <= length);
 
     const char       *pc     = string;
-    const char *const pcEnd4 = string + length - 4;
+    const char *const pcEnd  = string + length;
+    const char *const pcEnd4 = pcEnd - 4;
 
     int count = 0;
 
+#if defined(BDLDE_UTF8UTIL_AVX2)
+    if (isAvx2Supported()) {
+        pc += validateAndCountPrefixAvx2(&count, string, length);
+    }
+#endif
+
     while (pc <= pcEnd4) {
         switch ((*pc >> 4) & 0xf) {
           case 0:
@@ -229,6 +417,11 @@ int validateAndCountCodePoints(
           case 5:
           case 6:
           case 7: {
+            if (pcEnd - pc >= k_ASCII_BLOCK_SIZE && isAsciiBlock(pc)) {
+                pc    += k_ASCII_BLOCK_SIZE;
+                count += k_ASCII_BLOCK_SIZE;
+                continue;
+            }
             ++pc;
           } break;
           case 0xc:
@@ -354,6 +547,35 @@ int validateAndCountCodePoints(
     return count;
 }
 
+static
+int validateAndCountCodePoints(const char **invalidString, const char *string)
+    // Return the number of Unicode code points in the specified 'string' if it
+    // contains valid UTF-8, with no effect on the specified 'invalidString'.
+    // Otherwise, return a negative value and load into 'invalidString' the
+    // address of the first sequence in 'string' that does not constitute the
+    // start of a valid UTF-8 encoding specifying a valid Unicode code point.
+    // 'string' is necessarily null-terminated, so it cannot contain embedded
+    // null bytes.  Note that 'string' may contain less than
+    // 'bsl::strlen(string)' Unicode code points.
+{
+    // The following assertions are redundant with those in the CLASS METHODS.
+    // Hence, 'BSLS_ASSERT_SAFE' is used.
+
+    BSLS_ASSERT_SAFE(invalidString);
+    BSLS_ASSERT_SAFE(string);
+
+    // Finding the terminating null byte first lets the vectorized code read
+    // whole blocks without straying past the end of 'string'.  A sequence
+    // truncated by the null byte is invalid whether it is truncated by the
+    // end of input or by a null byte that is not a continuation byte, so the
+    // result is the same as that of checking for the null byte while
+    // decoding.
+
+    return validateAndCountCodePoints(invalidString,
+                                      string,
+                                      bsl::strlen(string));
+}
+
 namespace BloombergLP {
 
 namespace bdlde {
@@ -607,6 +829,15 @@ int Utf8Util::advanceIfValid(int          *status,
           case 7: {
             // binary: 0xxxxxxx: ASCII and possible '\0'
 
+            if (endOfInput - string >= k_ASCII_BLOCK_SIZE
+             && numCodePoints - ret >= k_ASCII_BLOCK_SIZE
+             && isAsciiBlock(string)) {
+                // Skip a whole block of ASCII at once.  Note that the loop
+                // increment accounts for the last code point of the block.
+
+                next  = string + k_ASCII_BLOCK_SIZE;
+                ret  += k_ASCII_BLOCK_SIZE - 1;
+            }
           } continue;
 
           case 8:
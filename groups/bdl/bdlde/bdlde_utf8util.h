@@ -52,6 +52,14 @@ BSLS_IDENT("$Id: $")
 // explicit length argument.  Naturally, null-terminated C-style strings cannot
 // contain embedded null code points.
 //
+// On x86-64 platforms, 'isValid' and 'numCodePointsIfValid' validate 32 bytes
+// at a time using AVX2 instructions if the processor supports them (as
+// determined at run time).  Otherwise these functions, like the length-taking
+// overload of 'advanceIfValid', skip over blocks of ASCII 16 bytes at a time
+// and decode the remaining input one code point at a time.  The results,
+// including the address of the invalid sequence reported, are the same
+// whichever code path is taken.
+//
 // The UTF-8 format is described in the RFC 3629 document at:
 //..
 //  http://tools.ietf.org/html/rfc3629
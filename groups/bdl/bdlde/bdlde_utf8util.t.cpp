@@ -11,6 +11,7 @@
 
 #include <bdlb_random.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -72,11 +73,14 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [10] USAGE EXAMPLE
+// [10] Testing: vectorized validation against a reference decoder
+// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE 2
 // [ 9] Testing: 'advanceIfValid' on correct input followed by incorrect input
 // [ 8] Testing: all 'advance*' on machine-generated correct input
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE: VALIDATION THROUGHPUT
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -2457,6 +2461,110 @@ bsl::string clone(const char *pc, int length)
     return ret;
 }
 
+static
+int referenceNumCodePointsIfValid(const char  **invalidString,
+                                  const char   *string,
+                                  bsl::size_t   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' (in bytes) if 'string' is valid UTF-8,
+    // and otherwise return -1 and load into the specified 'invalidString' the
+    // address of the first sequence that is not a valid encoding of a code
+    // point.  This decoder, which examines one code point at a time, is
+    // deliberately simple so that it can serve as the reference against which
+    // the vectorized validation of the component is checked.
+{
+    const unsigned char *pc  = (const unsigned char *) string;
+    const unsigned char *end = pc + length;
+
+    int count = 0;
+    for (; pc < end; ++count) {
+        int len      = 0;
+        int minValue = 0;
+        int value    = 0;
+
+        if      (*pc < 0x80) { len = 1; value = *pc; }
+        else if (*pc < 0xc0) { len = 0; }
+        else if (*pc < 0xe0) { len = 2; value = *pc & 0x1f; minValue = 0x80; }
+        else if (*pc < 0xf0) { len = 3; value = *pc & 0x0f; minValue = 0x800; }
+        else if (*pc < 0xf8) { len = 4; value = *pc & 0x07;
+                                                         minValue = 0x10000; }
+
+        bool ok = 0 != len && end - pc >= len;
+        for (int ii = 1; ok && ii < len; ++ii) {
+            ok    = 0x80 == (pc[ii] & 0xc0);
+            value = (value << 6) | (pc[ii] & 0x3f);
+        }
+        if (!ok || value < minValue || value > 0x10ffff
+                || (value >= 0xd800 && value <= 0xdfff)) {
+            *invalidString = (const char *) pc;
+            return -1;                                                // RETURN
+        }
+        pc += len;
+    }
+
+    return count;
+}
+
+static
+void checkAgainstReference(int line, const bsl::string& str)
+    // Verify, using the specified 'line' to report failures, that the
+    // validating functions of 'Utf8Util', applied to the specified 'str' both
+    // with an explicit length and as a null-terminated string, yield the same
+    // results as 'referenceNumCodePointsIfValid'.  Also verify that the
+    // 'advanceIfValid' overload taking a length agrees with the one taking a
+    // null-terminated string, which decodes one byte at a time.
+{
+    const char        *DATA   = str.data();
+    const bsl::size_t  LENGTH = str.length();
+    const bsl::size_t  ZLEN   = bsl::strlen(str.c_str());
+
+    const char *expInvalid = 0;
+    const int   EXP = referenceNumCodePointsIfValid(&expInvalid, DATA, LENGTH);
+
+    const char *invalid = 0;
+    int         rc      = Obj::numCodePointsIfValid(&invalid, DATA, LENGTH);
+    LOOP3_ASSERT(line, EXP, rc, EXP == rc);
+    LOOP3_ASSERT(line, expInvalid - DATA, invalid - DATA,
+                                            EXP >= 0 || expInvalid == invalid);
+
+    invalid = 0;
+    LOOP_ASSERT(line, (EXP >= 0) == Obj::isValid(&invalid, DATA, LENGTH));
+    LOOP_ASSERT(line, EXP >= 0 || expInvalid == invalid);
+
+    const char *expZInvalid = 0;
+    const int   EXPZ = referenceNumCodePointsIfValid(&expZInvalid, DATA, ZLEN);
+
+    invalid = 0;
+    rc      = Obj::numCodePointsIfValid(&invalid, str.c_str());
+    LOOP3_ASSERT(line, EXPZ, rc, EXPZ == rc);
+    LOOP_ASSERT(line, EXPZ >= 0 || expZInvalid == invalid);
+
+    invalid = 0;
+    LOOP_ASSERT(line, (EXPZ >= 0) == Obj::isValid(&invalid, str.c_str()));
+    LOOP_ASSERT(line, EXPZ >= 0 || expZInvalid == invalid);
+
+    const int NUMS[] = { 0, 1, 15, 16, 17, 33, INT_MAX };
+    for (int ti = 0; ti < (int) (sizeof NUMS / sizeof *NUMS); ++ti) {
+        const int NUM = NUMS[ti];
+
+        int         expStatus = 2, status = 2;
+        const char *expResult = 0, *result = 0;
+
+        const int EXP_RET = Obj::advanceIfValid(&expStatus,
+                                                &expResult,
+                                                str.c_str(),
+                                                NUM);
+        const int RET     = Obj::advanceIfValid(&status,
+                                                &result,
+                                                DATA,
+                                                ZLEN,
+                                                NUM);
+        LOOP4_ASSERT(line, NUM, EXP_RET, RET, EXP_RET == RET);
+        LOOP2_ASSERT(line, NUM, expStatus == status);
+        LOOP2_ASSERT(line, NUM, expResult == result);
+    }
+}
+
 // Some useful multi-octet code points:
 
     // The 2 lowest 2-octet code points.
@@ -2835,7 +2943,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'.
         //
@@ -2947,7 +3055,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' and 'numCodePoints*'
         //
@@ -3045,6 +3153,164 @@ int main(int argc, char *argv[])
     ASSERT(false == bdlde::Utf8Util::isValid(stringWithOverlong.c_str()));
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING VECTORIZED VALIDATION
+        //
+        // Concerns:
+        //: 1 'isValid' and 'numCodePointsIfValid' yield the same results, and
+        //:   report the same invalid sequence, as a simple decoder examining
+        //:   one code point at a time, whether the vectorized code or the
+        //:   scalar code (for the tail of the input, and on platforms without
+        //:   vector instructions) does the work.
+        //:
+        //: 2 Invalid sequences and sequences spanning the boundary between two
+        //:   blocks of input examined at once are handled correctly wherever
+        //:   in a block they occur.
+        //:
+        //: 3 The ASCII fast path of 'advanceIfValid' never advances past the
+        //:   requested number of code points, the end of input, or an invalid
+        //:   sequence.
+        //
+        // Plan:
+        //: 1 Place each of a table of valid and invalid sequences at every
+        //:   offset of ASCII and of 3-byte filler text spanning several blocks
+        //:   and compare the results of the validating functions to those of
+        //:   'referenceNumCodePointsIfValid'.  Compare the 'advanceIfValid'
+        //:   overload taking a length, which has an ASCII fast path, to the
+        //:   overload taking a null-terminated string.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 for many randomly generated strings consisting of runs
+        //:   of ASCII and of multi-byte code points, some of which are
+        //:   corrupted by overwriting, inserting, or removing a byte.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   bool isValid(const char **err, const char *s);
+        //   bool isValid(const char **err, const char *s, int len);
+        //   int numCodePointsIfValid(**err, const char *s);
+        //   int numCodePointsIfValid(**err, const char *s, int len);
+        //   int advanceIfValid(int *, const char **, const char *, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING VECTORIZED VALIDATION\n"
+                             "=============================\n";
+
+        static const struct {
+            int         d_line;
+            const char *d_sequence;
+        } DATA[] = {
+            // valid
+
+            { L_, "\xc2\x80" },
+            { L_, "\xdf\xbf" },
+            { L_, "\xe0\xa0\x80" },
+            { L_, "\xed\x9f\xbf" },
+            { L_, "\xee\x80\x80" },
+            { L_, "\xef\xbf\xbf" },
+            { L_, "\xf0\x90\x80\x80" },
+            { L_, "\xf4\x8f\xbf\xbf" },
+
+            // stray continuations and invalid lead bytes
+
+            { L_, "\x80" },
+            { L_, "\xbf" },
+            { L_, "\xc2\x80\x80" },
+            { L_, "\xf8\x88\x80\x80\x80" },
+            { L_, "\xfe" },
+            { L_, "\xff" },
+
+            // truncated sequences
+
+            { L_, "\xc2" },
+            { L_, "\xc2\xc2\x80" },
+            { L_, "\xe1\x80" },
+            { L_, "\xe1\x80\xe1\x80\x80" },
+            { L_, "\xf0\x90\x80" },
+            { L_, "\xf1" },
+
+            // overlong values
+
+            { L_, "\xc0\x80" },
+            { L_, "\xc1\xbf" },
+            { L_, "\xe0\x80\x80" },
+            { L_, "\xe0\x9f\xbf" },
+            { L_, "\xf0\x80\x80\x80" },
+            { L_, "\xf0\x8f\xbf\xbf" },
+
+            // surrogates and values above 'U+10ffff'
+
+            { L_, "\xed\xa0\x80" },
+            { L_, "\xed\xbf\xbf" },
+            { L_, "\xf4\x90\x80\x80" },
+            { L_, "\xf5\x80\x80\x80" },
+            { L_, "\xf7\xbf\xbf\xbf" },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        if (verbose) cout << "Every sequence at every offset.\n";
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *SEQUENCE = DATA[ti].d_sequence;
+
+            for (int offset = 0; offset <= 100; ++offset) {
+                bsl::string ascii(100, 'a');
+                ascii.insert(offset, SEQUENCE);
+                checkAgainstReference(LINE, ascii);
+
+                // Fill with the 3-byte encoding of 'U+4e2d', inserting the
+                // sequence between two code points.
+
+                bsl::string cjk;
+                for (int ii = 0; ii < 34; ++ii) {
+                    cjk += "\xe4\xb8\xad";
+                }
+                cjk.insert(offset / 3 * 3, SEQUENCE);
+                checkAgainstReference(LINE, cjk);
+            }
+        }
+
+        if (verbose) cout << "Random strings.\n";
+
+        for (int ti = 0; ti < 20 * 1000; ++ti) {
+            bsl::string str;
+
+            const int numRuns = randUnsigned() % 8;
+            for (int run = 0; run < numRuns; ++run) {
+                const int kind   = randUnsigned() % 5;
+                const int numCps = randUnsigned() % 40;
+                for (int ii = 0; ii < numCps; ++ii) {
+                    switch (kind) {
+                      case 0: appendRand1Byte(&str);                   break;
+                      case 1: appendRand2Byte(&str);                   break;
+                      case 2: appendRand3Byte(&str);                   break;
+                      case 3: appendRand4Byte(&str);                   break;
+                      default: appendRandCorrectCodePoint(&str, true);
+                    }
+                }
+            }
+
+            const int         corruption = str.empty()
+                                         ? 0
+                                         : randUnsigned() % 4;
+            const bsl::size_t pos        = str.empty()
+                                         ? 0
+                                         : randUnsigned() % str.length();
+            const char BYTES[] = { '\x80', '\xbf', '\xc1', '\xc2', '\xe0',
+                                   '\xed', '\xf0', '\xf4', '\xf5', '\xff',
+                                   'a',    '\0' };
+            const char byte = BYTES[randUnsigned() % sizeof BYTES];
+
+            switch (corruption) {
+              case 1: str[pos] = byte;              break;
+              case 2: str.insert(pos, 1, byte);     break;
+              case 3: str.erase(pos, 1);            break;
+            }
+
+            checkAgainstReference(L_, str);
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING CORRECT + BROKEN GLASS
@@ -4910,6 +5176,118 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: VALIDATION THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'numCodePointsIfValid' and 'isValid' on
+        //:   ASCII, CJK, and mixed ASCII/CJK corpora, compared to that of a
+        //:   decoder examining one code point at a time.
+        //
+        // Plan:
+        //: 1 Build 3 corpora of about 1MB each: ASCII text resembling JSON,
+        //:   text consisting of 3-byte CJK code points, and ASCII text with
+        //:   frequent runs of CJK code points.  Time repeated validation of
+        //:   each corpus by the component functions and by
+        //:   'referenceNumCodePointsIfValid', and print the throughput in
+        //:   MB/sec.  The number of repetitions can be specified as the second
+        //:   argument on the command line.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: VALIDATION THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: VALIDATION THROUGHPUT\n"
+                             "==================================\n";
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 100;
+
+        const char *const JSON = "{\"id\": 12345, \"name\": \"example\", "
+                                 "\"tags\": [\"alpha\", \"beta\"]}, ";
+        const char *const CJK  = "\xe4\xb8\xad\xe6\x96\x87\xe6\x97\xa5"
+                                 "\xe6\x9c\xac\xe8\xaa\x9e\xed\x95\x9c";
+
+        enum { k_CORPUS_SIZE = 1024 * 1024 };
+
+        bsl::string ascii, cjk, mixed;
+        while (ascii.length() < k_CORPUS_SIZE) {
+            ascii += JSON;
+        }
+        while (cjk.length() < k_CORPUS_SIZE) {
+            cjk += CJK;
+        }
+        while (mixed.length() < k_CORPUS_SIZE) {
+            mixed += JSON;
+            mixed += CJK;
+        }
+
+        const struct {
+            const char        *d_name;
+            const bsl::string *d_corpus_p;
+        } CORPORA[] = {
+            { "ASCII", &ascii },
+            { "CJK",   &cjk   },
+            { "mixed", &mixed },
+        };
+        enum { k_NUM_CORPORA = sizeof CORPORA / sizeof *CORPORA };
+
+        for (int ti = 0; ti < k_NUM_CORPORA; ++ti) {
+            const bsl::string& CORPUS = *CORPORA[ti].d_corpus_p;
+            const double       MB     = CORPUS.length() * NUM_ITERATIONS
+                                                           / (1024.0 * 1024.0);
+
+            const char *invalid = 0;
+            const int   EXP     = referenceNumCodePointsIfValid(
+                                                             &invalid,
+                                                             CORPUS.data(),
+                                                             CORPUS.length());
+            ASSERT(0 < EXP);
+
+            bsls::Stopwatch timer;
+            int             sum = 0;
+
+            timer.start();
+            for (int ii = 0; ii < NUM_ITERATIONS; ++ii) {
+                sum += referenceNumCodePointsIfValid(&invalid,
+                                                     CORPUS.data(),
+                                                     CORPUS.length());
+            }
+            timer.stop();
+            const double referenceTime = timer.elapsedTime();
+            ASSERT(EXP * NUM_ITERATIONS == sum);
+
+            sum = 0;
+            timer.reset();
+            timer.start();
+            for (int ii = 0; ii < NUM_ITERATIONS; ++ii) {
+                sum += Obj::numCodePointsIfValid(&invalid,
+                                                 CORPUS.data(),
+                                                 CORPUS.length());
+            }
+            timer.stop();
+            const double countTime = timer.elapsedTime();
+            ASSERT(EXP * NUM_ITERATIONS == sum);
+
+            sum = 0;
+            timer.reset();
+            timer.start();
+            for (int ii = 0; ii < NUM_ITERATIONS; ++ii) {
+                sum += Obj::isValid(CORPUS.c_str());
+            }
+            timer.stop();
+            const double isValidTime = timer.elapsedTime();
+            ASSERT(NUM_ITERATIONS == sum);
+
+            cout << CORPORA[ti].d_name << ":\n"
+                 << "\treference decoder:    " << MB / referenceTime
+                                                            << " MB/sec\n"
+                 << "\tnumCodePointsIfValid: " << MB / countTime
+                                                            << " MB/sec\n"
+                 << "\tisValid:              " << MB / isValidTime
+                                                            << " MB/sec\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
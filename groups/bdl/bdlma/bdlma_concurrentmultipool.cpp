@@ -336,6 +336,30 @@ void ConcurrentMultipool::deallocate(void *address)
     }
 }
 
+int ConcurrentMultipool::enableThreadCache()
+{
+    return enableThreadCache(ConcurrentPool::k_DEFAULT_THREAD_CACHE_CAPACITY);
+}
+
+int ConcurrentMultipool::enableThreadCache(int capacity)
+{
+    BSLS_ASSERT(2 <= capacity);
+
+    for (int i = 0; i < d_numPools; ++i) {
+        const int rc = d_pools_p[i].enableThreadCache(capacity);
+        if (0 != rc) {
+            // Leave the multipool as it was: if thread caching was already
+            // enabled, 'i' is 0 and no pool is affected.
+
+            while (i--) {
+                d_pools_p[i].disableThreadCache();
+            }
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
 void ConcurrentMultipool::release()
 {
     for (int i = 0; i < d_numPools; ++i) {
@@ -345,6 +369,13 @@ void ConcurrentMultipool::release()
     d_blockList.release();
 }
 
+void ConcurrentMultipool::releaseThreadCache()
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].releaseThreadCache();
+    }
+}
+
 void ConcurrentMultipool::reserveCapacity(int size, int numBlocks)
 {
     BSLS_ASSERT(0 <= size);
@@ -368,6 +399,13 @@ void ConcurrentMultipool::reserveCapacity(int size, int numBlocks)
     const int pool = findPool(size);
     d_pools_p[pool].reserveCapacity(numBlocks);
 }
+
+// ACCESSORS
+int ConcurrentMultipool::threadCacheCapacity() const
+{
+    return d_pools_p[d_numPools - 1].threadCacheCapacity();
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -62,6 +62,20 @@ BSLS_IDENT("$Id: $")
 // 'bdlma::ConcurrentMultipool' is *fully thread-safe*, meaning any operation
 // on the same object can be safely invoked from any thread.
 //
+///Thread Caching
+///--------------
+// The 'enableThreadCache' method enables the per-thread caches of free blocks
+// of each 'bdlma::ConcurrentPool' maintained by a multipool (see
+// {'bdlma_concurrentpool'|Thread Caching}).  With thread caching enabled, most
+// allocations and deallocations of pooled blocks involve no atomic operation
+// and no memory shared with other threads, so that the throughput of a
+// multipool shared by many threads scales with the number of threads.  Note
+// that each pool, i.e., each pooled size class, consumes one thread-specific
+// storage key, so that a multipool having thread caching enabled consumes
+// 'numPools()' keys.  If fewer keys are available, 'enableThreadCache' fails
+// and leaves thread caching disabled for every pool.  Also note that thread
+// caching must be enabled before the multipool is shared among threads.
+//
 ///Configuration at Construction
 ///-----------------------------
 // When creating a 'bdlma::ConcurrentMultipool', clients can optionally
@@ -708,9 +722,28 @@ class ConcurrentMultipool {
         // allocated using this multipool, and has not already been
         // deallocated.
 
+    int enableThreadCache();
+    int enableThreadCache(int capacity);
+        // Enable thread caching for each pool maintained by this multipool,
+        // each thread cache holding at most the specified 'capacity' free
+        // blocks.  If 'capacity' is not specified, the default capacity of
+        // 'bdlma::ConcurrentPool' is used.  Return 0 on success, and a
+        // non-zero value if thread caching is already enabled, or if not
+        // enough thread-specific storage keys are available (in which case
+        // thread caching remains disabled for every pool).  The behavior is
+        // undefined unless '2 <= capacity', and this method is called before
+        // this multipool is accessed by more than one thread.  Note that each
+        // pool, hence each pooled size class, consumes one thread-specific
+        // storage key, so that 'numPools()' keys are needed.
+
     void release();
         // Relinquish all memory currently allocated via this multipool object.
 
+    void releaseThreadCache();
+        // Return all the blocks held by the calling thread's caches to the
+        // pools maintained by this multipool.  This method has no effect if
+        // thread caching is not enabled.
+
     void reserveCapacity(int size, int numBlocks);
         // Reserve memory from this multipool to satisfy memory requests for at
         // least the specified 'numBlocks' having the specified 'size' (in
@@ -730,6 +763,11 @@ class ConcurrentMultipool {
         // where 'numPools' is either specified at construction, or an
         // implementation-defined value.
 
+    int threadCacheCapacity() const;
+        // Return the maximum number of free blocks held by each thread cache
+        // of the pools maintained by this multipool, or 0 if thread caching
+        // is not enabled.
+
 };
 
 // ============================================================================
@@ -66,11 +66,15 @@ using namespace bsl;  // automatically added by script
 // [ 9] void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
 // [ 6] void reserveCapacity(int size, int numObjects);
+// [11] int enableThreadCache();
+// [11] int enableThreadCache(int capacity);
+// [11] void releaseThreadCache();
+// [11] int threadCacheCapacity() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] CONCURRENCY TEST
 // [10] OLD USAGE EXAMPLE
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -296,6 +300,45 @@ extern "C" void *workerThread(void *arg) {
     return arg;
 }
 
+struct CacheArgs {
+    Obj  *d_multipool_p;  // multipool with thread caching enabled
+    char  d_pattern;      // pattern written to each allocated block
+    int   d_numErrors;    // number of corrupted blocks found
+};
+
+extern "C" void *checkedAllocate(void *arg) {
+    // Repeatedly allocate blocks of every size up to twice the maximum pooled
+    // size of the multipool referred to by the specified 'arg', which must
+    // be the address of a 'CacheArgs', fill each block with the pattern of
+    // 'arg', and count the blocks whose pattern is not intact when they are
+    // deallocated.
+
+    CacheArgs *args      = static_cast<CacheArgs *>(arg);
+    Obj       *multipool = args->d_multipool_p;
+
+    const int MAX_SIZE = 2 * multipool->maxPooledBlockSize();
+
+    bsl::vector<char *> blocks(bslma::Default::allocator(0));
+    blocks.resize(MAX_SIZE + 1);
+
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        for (int size = 1; size <= MAX_SIZE; ++size) {
+            blocks[size] = static_cast<char *>(multipool->allocate(size));
+            bsl::memset(blocks[size], args->d_pattern, size);
+        }
+        for (int size = MAX_SIZE; 1 <= size; --size) {
+            for (int i = 0; i < size; ++i) {
+                if (args->d_pattern != blocks[size][i]) {
+                    ++args->d_numErrors;
+                    break;
+                }
+            }
+            multipool->deallocate(blocks[size]);
+        }
+    }
+    return 0;
+}
+
 //=============================================================================
 //                                USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -657,7 +700,7 @@ int main(int argc, char *argv[])
     bslma::Allocator    *Z = &testAllocator;
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -726,6 +769,160 @@ int main(int argc, char *argv[])
             // Now 'pM' and 'pBuf' are also invalid addresses.
         }
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD CACHING
+        //
+        // Concerns:
+        //   1 'threadCacheCapacity' is 0 until 'enableThreadCache' is called,
+        //     and then reports the capacity passed to it.
+        //
+        //   2 Thread caching can be enabled only once.
+        //
+        //   3 Blocks of every pooled size and blocks larger than the maximum
+        //     pooled size can be allocated and deallocated with thread
+        //     caching enabled, and are not corrupted by other threads.
+        //
+        //   4 'releaseThreadCache' and 'release' may be called with blocks
+        //     held in the thread caches.
+        //
+        //   5 If there are not enough thread-specific storage keys for all
+        //     the pools, 'enableThreadCache' fails, leaves thread caching
+        //     disabled, and releases the keys it consumed.
+        //
+        // Plan:
+        //   1 Verify the capacity before and after enabling thread caching,
+        //     and verify that enabling it a second time fails.  (C-1..2)
+        //
+        //   2 In several threads, repeatedly allocate blocks of every size
+        //     up to twice the maximum pooled size, fill each block with a
+        //     thread-specific pattern, verify the pattern, and deallocate the
+        //     blocks.  (C-3)
+        //
+        //   3 Call 'releaseThreadCache' and 'release' with blocks cached,
+        //     and verify that the multipool remains usable.  (C-4)
+        //
+        //   4 Consume all but two thread-specific storage keys, and verify
+        //     that enabling thread caching on a multipool of five pools fails
+        //     and leaves the capacity 0, and that two keys remain available.
+        //     Then release the keys, and enable thread caching.  (C-5)
+        //
+        // Testing:
+        //   int enableThreadCache();
+        //   int enableThreadCache(int capacity);
+        //   void releaseThreadCache();
+        //   int threadCacheCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING THREAD CACHING"
+                          << endl << "======================" << endl;
+
+        if (verbose) cout << "\nTesting capacity." << endl;
+        {
+            Obj mX(5, Z);  const Obj& X = mX;
+
+            ASSERT(0 == X.threadCacheCapacity());
+            ASSERT(0 == mX.enableThreadCache());
+            ASSERT(bdlma::ConcurrentPool::k_DEFAULT_THREAD_CACHE_CAPACITY
+                                                  == X.threadCacheCapacity());
+            ASSERT(0 != mX.enableThreadCache(8));
+            ASSERT(bdlma::ConcurrentPool::k_DEFAULT_THREAD_CACHE_CAPACITY
+                                                  == X.threadCacheCapacity());
+        }
+        {
+            Obj mX(5, Z);  const Obj& X = mX;
+
+            ASSERT(0 == mX.enableThreadCache(8));
+            ASSERT(8 == X.threadCacheCapacity());
+
+            // Cache blocks of each size, then return them in several ways.
+
+            for (int size = 1; size <= 2 * X.maxPooledBlockSize(); ++size) {
+                void *p = mX.allocate(size);
+                ASSERT(p);
+                bsl::memset(p, 0xa5, size);
+                mX.deallocate(p);
+            }
+            mX.releaseThreadCache();
+
+            void *p = mX.allocate(4);
+            ASSERT(p);
+            mX.deallocate(p);
+            mX.release();
+
+            p = mX.allocate(4);
+            ASSERT(p);
+            mX.deallocate(p);
+        }
+        ASSERT(0 == testAllocator.numBytesInUse());
+
+        if (verbose) cout << "\nTesting failure to enable." << endl;
+        {
+            Obj mX(5, Z);  const Obj& X = mX;
+
+            // Consume all the keys, then make two of them available again.
+
+            bsl::vector<bslmt::ThreadUtil::Key> keys;
+            bslmt::ThreadUtil::Key              key;
+            while (0 == bslmt::ThreadUtil::createKey(&key, 0)) {
+                keys.push_back(key);
+            }
+            ASSERT(2 <= keys.size());
+
+            for (int i = 0; i < 2; ++i) {
+                bslmt::ThreadUtil::deleteKey(keys.back());
+                keys.pop_back();
+            }
+
+            ASSERT(0 != mX.enableThreadCache(8));
+            ASSERT(0 == X.threadCacheCapacity());
+
+            // The keys consumed by the first pools were released.
+
+            for (int i = 0; i < 2; ++i) {
+                LOOP_ASSERT(i, 0 == bslmt::ThreadUtil::createKey(&key, 0));
+                keys.push_back(key);
+            }
+
+            for (bsl::size_t i = 0; i < keys.size(); ++i) {
+                bslmt::ThreadUtil::deleteKey(keys[i]);
+            }
+
+            void *p = mX.allocate(4);
+            ASSERT(p);
+            mX.deallocate(p);
+
+            ASSERT(0 == mX.enableThreadCache(8));
+            ASSERT(8 == X.threadCacheCapacity());
+        }
+        ASSERT(0 == testAllocator.numBytesInUse());
+
+        if (verbose) cout << "\nTesting concurrent use." << endl;
+        {
+            const int NUM_THREADS = 4;
+
+            Obj mX(6, Z);
+
+            ASSERT(0 == mX.enableThreadCache(4));
+
+            CacheArgs                 args[NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[NUM_THREADS];
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                args[i].d_multipool_p = &mX;
+                args[i].d_pattern     = static_cast<char>('a' + i);
+                args[i].d_numErrors   = 0;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      checkedAllocate,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                LOOP2_ASSERT(i, args[i].d_numErrors,
+                             0 == args[i].d_numErrors);
+            }
+        }
+        ASSERT(0 == testAllocator.numBytesInUse());
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING OLD USAGE EXAMPLE
@@ -13,16 +13,25 @@
 BSLS_IDENT_RCSID(bdlma_concurrentpool_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
+#include <bslmt_once.h>
 
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocator.h>  // for testing purpose only
 
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>  // for 'max()'
 #include <bsl_cstddef.h>    // for 'offsetof()'
 #include <bsl_cstdlib.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace {
@@ -52,10 +61,103 @@ struct LLink {
 enum {
     k_INITIAL_CHUNK_SIZE =  1, // default 'numObjects' value
 
-    k_MAX_CHUNK_SIZE     = 32  // minimum 'd_numObjects' value beyond which
+    k_MAX_CHUNK_SIZE     = 32, // minimum 'd_numObjects' value beyond which
                                // 'd_numObjects' becomes positive
+
+    k_THREAD_CACHE_PERIOD_FACTOR = 8
+                               // length, in multiples of the thread cache
+                               // capacity, of the period (in operations)
+                               // after which blocks unused in a thread cache
+                               // are returned to the shared free list
+};
+
+                         // ==========================
+                         // struct ThreadCacheRegistry
+                         // ==========================
+
+struct ThreadCacheRegistry {
+    // This 'struct' records the live thread caches of all pools, each with
+    // the thread owning it.  The destructor of a thread-specific key may
+    // still be running in an exiting thread after the key is deleted, so the
+    // destruction of a pool (which deallocates its caches) can race with the
+    // destruction of one of its caches by the exiting thread owning it.  Both
+    // sides hold 'd_mutex' while accessing a cache and its pool, and the
+    // exiting thread leaves alone a cache that is no longer registered,
+    // without accessing it.  The owning thread distinguishes a cache from a
+    // new one later allocated at the same address by another thread.
+
+    // TYPES
+    typedef bsl::pair<const void *, bsls::Types::Uint64> Entry;
+        // cache address and owning thread id
+
+    // DATA
+    bslmt::Mutex       d_mutex;    // serializes the destruction of caches,
+                                   // and the destruction of their pools
+
+    bsl::vector<Entry> d_entries;  // caches not yet deallocated
+
+    // CREATORS
+    explicit ThreadCacheRegistry(bslma::Allocator *basicAllocator)
+    : d_entries(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    void add(const void *cache, bsls::Types::Uint64 threadId)
+        // Add to this registry the specified 'cache' owned by the thread
+        // having the specified 'threadId'.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+    {
+        d_entries.push_back(Entry(cache, threadId));
+    }
+
+    void remove(const void *cache)
+        // Remove the specified 'cache' from this registry.  The behavior is
+        // undefined unless 'cache' is registered, and 'd_mutex' is locked.
+    {
+        for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+            if (cache == d_entries[i].first) {
+                d_entries[i] = d_entries.back();
+                d_entries.pop_back();
+                return;                                               // RETURN
+            }
+        }
+        BSLS_ASSERT(false);
+    }
+
+    bool remove(const void *cache, bsls::Types::Uint64 threadId)
+        // Remove the specified 'cache' owned by the thread having the
+        // specified 'threadId' from this registry.  Return 'true' if 'cache'
+        // was registered, and 'false' otherwise.  The behavior is undefined
+        // unless 'd_mutex' is locked.
+    {
+        for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+            if (cache == d_entries[i].first
+             && threadId == d_entries[i].second) {
+                d_entries[i] = d_entries.back();
+                d_entries.pop_back();
+                return true;                                          // RETURN
+            }
+        }
+        return false;
+    }
 };
 
+ThreadCacheRegistry& threadCacheRegistry()
+    // Return a reference to the registry of the thread caches of all pools.
+{
+    static bsls::ObjectBuffer<ThreadCacheRegistry> registry;
+    BSLMT_ONCE_DO {
+        // Threads may exit, and pools may be destroyed, during program
+        // termination: the registry is never destroyed, and its memory is not
+        // supplied by the default allocator.
+
+        new (registry.buffer()) ThreadCacheRegistry(
+                                      &bslma::NewDeleteAllocator::singleton());
+    }
+    return registry.object();
+}
+
 }  // close unnamed namespace
 
 // implementation details of private support functions
@@ -132,86 +234,188 @@ void replenishImp(bsls::AtomicPointer<LLink>       *nextList,
 
 namespace bdlma {
 
-                           // --------------------
-                           // class ConcurrentPool
-                           // --------------------
+                     // ================================
+                     // struct ConcurrentPool_ThreadCache
+                     // ================================
 
-// PRIVATE MANIPULATORS
-void ConcurrentPool::replenish()
+struct ConcurrentPool_ThreadCache {
+    // This component-private 'struct' holds the free blocks cached by one
+    // thread for one 'ConcurrentPool', linked through their 'd_next_p'
+    // members.  The blocks of a cache are allocated from the point of view of
+    // the shared free list of the pool (i.e., their reference count is that of
+    // a block dispensed by 'popBlock').  The links 'd_prev_p' and 'd_next_p'
+    // are guarded by the mutex of the pool; all other members are accessed
+    // only by the owning thread.
+
+    typedef ConcurrentPool::Link Link;
+
+    // DATA
+    ConcurrentPool             *d_pool_p;         // pool owning this cache
+
+    Link                       *d_head_p;         // first cached block
+
+    int                         d_numBlocks;      // number of cached blocks
+
+    int                         d_lowWater;       // minimum of 'd_numBlocks'
+                                                  // in the current period
+
+    int                         d_numOperations;  // number of operations in
+                                                  // the current period
+
+    int                         d_generation;     // generation of the pool
+                                                  // the cached blocks belong
+                                                  // to
+
+    ConcurrentPool_ThreadCache *d_prev_p;         // previous cache of the
+                                                  // pool
+
+    ConcurrentPool_ThreadCache *d_next_p;         // next cache of the pool
+
+    // CLASS METHODS
+    static void destroy(void *cache);
+        // Return the blocks held by the specified 'cache' to the shared free
+        // list of its pool, remove 'cache' from the list of caches of its
+        // pool, and deallocate it, unless 'cache' was already deallocated by
+        // its pool, in which case this function has no effect.  Note that this
+        // function is invoked when the thread owning 'cache' exits.
+
+    // MANIPULATORS
+    void endOperation();
+        // Account for one allocation or deallocation performed through this
+        // cache, and, if this operation ends the current period, return to
+        // the pool half of the blocks that have been unused during the period.
+
+    Link *pop();
+        // Remove a block from this cache, refilling this cache from the
+        // shared free list of the pool if it is empty, and return its
+        // address.
+
+    void push(Link *block);
+        // Add the specified 'block' to this cache, first returning half of
+        // the blocks of this cache to the shared free list of the pool if this
+        // cache is full.
+};
+
+// CLASS METHODS
+void ConcurrentPool_ThreadCache::destroy(void *cache)
 {
-    replenishImp(reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
-                 &d_blockList,
-                 d_internalBlockSize,
-                 d_chunkSize);
+    ThreadCacheRegistry&           registry = threadCacheRegistry();
+    bslmt::LockGuard<bslmt::Mutex> registryGuard(&registry.d_mutex);
 
-    if (bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
-     && d_chunkSize < d_maxBlocksPerChunk) {
+    if (!registry.remove(cache, bslmt::ThreadUtil::selfIdAsUint64())) {
+        // The pool of 'cache' was destroyed (or its thread caching disabled)
+        // after this thread started exiting; 'cache' was deallocated.
 
-        if (d_chunkSize * 2 <= d_maxBlocksPerChunk) {
-            d_chunkSize = d_chunkSize * 2;
+        return;                                                       // RETURN
+    }
+
+    ConcurrentPool_ThreadCache *self =
+                              static_cast<ConcurrentPool_ThreadCache *>(cache);
+    ConcurrentPool             *pool = self->d_pool_p;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&pool->d_mutex);
+
+        if (self->d_generation == pool->d_generation.loadRelaxed()) {
+            pool->returnBlocks(self, self->d_numBlocks);
+        }
+
+        if (self->d_prev_p) {
+            self->d_prev_p->d_next_p = self->d_next_p;
         }
         else {
-            d_chunkSize = d_maxBlocksPerChunk;
+            pool->d_threadCaches_p = self->d_next_p;
+        }
+        if (self->d_next_p) {
+            self->d_next_p->d_prev_p = self->d_prev_p;
         }
     }
+
+    pool->d_allocator_p->deallocate(self);
 }
 
-// CREATORS
-ConcurrentPool::ConcurrentPool(int blockSize, bslma::Allocator *basicAllocator)
-: d_blockSize(blockSize)
-, d_chunkSize(k_INITIAL_CHUNK_SIZE)
-, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
-, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
-, d_freeList(0)
-, d_blockList(basicAllocator)
+// MANIPULATORS
+inline
+void ConcurrentPool_ThreadCache::endOperation()
 {
-    BSLS_ASSERT(1 <= blockSize);
+    const int capacity = d_pool_p->d_threadCacheCapacity;
 
-    d_internalBlockSize = computeInternalBlockSize(blockSize);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+              ++d_numOperations >= k_THREAD_CACHE_PERIOD_FACTOR * capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_pool_p->returnBlocks(this, (d_lowWater + 1) / 2);
+        d_numOperations = 0;
+        d_lowWater      = d_numBlocks;
+    }
 }
 
-ConcurrentPool::ConcurrentPool(int                          blockSize,
-                               bsls::BlockGrowth::Strategy  growthStrategy,
-                               bslma::Allocator            *basicAllocator)
-: d_blockSize(blockSize)
-, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
-              ? k_MAX_CHUNK_SIZE : k_INITIAL_CHUNK_SIZE)
-, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
-, d_growthStrategy(growthStrategy)
-, d_freeList(0)
-, d_blockList(basicAllocator)
+inline
+ConcurrentPool_ThreadCache::Link *ConcurrentPool_ThreadCache::pop()
 {
-    BSLS_ASSERT(1 <= blockSize);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_numBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
-    d_internalBlockSize = computeInternalBlockSize(blockSize);
+        const int numBlocks = d_pool_p->d_threadCacheCapacity / 2;
+        for (int i = 0; i < numBlocks; ++i) {
+            Link *block = d_pool_p->popBlock();
+            block->d_next_p = d_head_p;
+            d_head_p        = block;
+        }
+        d_numBlocks = numBlocks;
+    }
+
+    Link *block = d_head_p;
+    d_head_p    = block->d_next_p;
+
+    if (--d_numBlocks < d_lowWater) {
+        d_lowWater = d_numBlocks;
+    }
+
+    endOperation();
+    return block;
 }
 
-ConcurrentPool::ConcurrentPool(int                          blockSize,
-                               bsls::BlockGrowth::Strategy  growthStrategy,
-                               int                          maxBlocksPerChunk,
-                               bslma::Allocator            *basicAllocator)
-: d_blockSize(blockSize)
-, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
-              ? maxBlocksPerChunk : k_INITIAL_CHUNK_SIZE)
-, d_maxBlocksPerChunk(maxBlocksPerChunk)
-, d_growthStrategy(growthStrategy)
-, d_freeList(0)
-, d_blockList(basicAllocator)
+inline
+void ConcurrentPool_ThreadCache::push(Link *block)
 {
-    BSLS_ASSERT(1 <= blockSize);
-    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+    const int capacity = d_pool_p->d_threadCacheCapacity;
 
-    d_internalBlockSize = computeInternalBlockSize(blockSize);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(capacity == d_numBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_pool_p->returnBlocks(this, capacity / 2);
+    }
+
+    block->d_next_p = d_head_p;
+    d_head_p        = block;
+    ++d_numBlocks;
+
+    endOperation();
 }
 
-ConcurrentPool::~ConcurrentPool()
+}  // close package namespace
+
+extern "C" {
+
+static void bdlma_ConcurrentPool_destroyThreadCache(void *cache)
+    // Destroy the specified 'cache', a 'bdlma::ConcurrentPool_ThreadCache'.
+    // Note that this function is the destructor of the thread-specific keys
+    // of 'bdlma::ConcurrentPool' objects.
 {
-    BSLS_ASSERT(static_cast<int>(sizeof(LLink)) <= d_internalBlockSize);
-    BSLS_ASSERT(0 != d_chunkSize);
+    bdlma::ConcurrentPool_ThreadCache::destroy(cache);
 }
 
-// MANIPULATORS
-void *ConcurrentPool::allocate()
+}  // extern "C"
+
+namespace bdlma {
+
+                           // --------------------
+                           // class ConcurrentPool
+                           // --------------------
+
+// PRIVATE MANIPULATORS
+ConcurrentPool::Link *ConcurrentPool::popBlock()
 {
     Link *p;
     for (;;) {
@@ -285,8 +489,7 @@ void *ConcurrentPool::allocate()
                     // The node is now free but not on the free list.  Try to
                     // take it.
 
-                    return static_cast<void *>(const_cast<Link **>(
-                                                      &p->d_next_p)); // RETURN
+                    return p;                                         // RETURN
                 }
             }
             else if (refCount ==
@@ -299,46 +502,367 @@ void *ConcurrentPool::allocate()
         }
     }
 
-    return static_cast<void *>(const_cast<Link **>(&p->d_next_p));
+    return p;
 }
 
-void ConcurrentPool::deallocate(void *address)
+void ConcurrentPool::pushBlocks(Link *first, Link *last)
 {
-    Link *p = static_cast<Link *>(static_cast<void *>(
-                     static_cast<char *>(address) - offsetof(Link, d_next_p)));
-    int refCount = bsls::AtomicOperations::getIntRelaxed(&p->d_refCount);
+    Link *old = d_freeList.loadRelaxed();
+    for (;;) {
+        last->d_next_p = old;
+        const Link * const swap = old;
+        old = d_freeList.testAndSwap(old, first);  // release
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(swap == old)) {
+            break;
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+}
+
+void ConcurrentPool::replenish()
+{
+    replenishImp(reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
+                 &d_blockList,
+                 d_internalBlockSize,
+                 d_chunkSize);
+
+    if (bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
+     && d_chunkSize < d_maxBlocksPerChunk) {
+
+        if (d_chunkSize * 2 <= d_maxBlocksPerChunk) {
+            d_chunkSize = d_chunkSize * 2;
+        }
+        else {
+            d_chunkSize = d_maxBlocksPerChunk;
+        }
+    }
+}
+
+ConcurrentPool_ThreadCache *ConcurrentPool::existingThreadCache()
+{
+    BSLS_ASSERT(d_threadCacheCapacity);
+
+    ConcurrentPool_ThreadCache *cache =
+                              static_cast<ConcurrentPool_ThreadCache *>(
+                                  bslmt::ThreadUtil::getSpecific(
+                                                            d_threadCacheKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        const int generation = d_generation.loadRelaxed();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                          generation != cache->d_generation)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // The cached blocks were released by 'release'.
+
+            cache->d_head_p        = 0;
+            cache->d_numBlocks     = 0;
+            cache->d_lowWater      = 0;
+            cache->d_numOperations = 0;
+            cache->d_generation    = generation;
+        }
+    }
+    return cache;
+}
+
+ConcurrentPool_ThreadCache *ConcurrentPool::threadCache()
+{
+    ConcurrentPool_ThreadCache *cache = existingThreadCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    cache = static_cast<ConcurrentPool_ThreadCache *>(
+                                       d_allocator_p->allocate(sizeof *cache));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(cache, d_allocator_p);
+
+    cache->d_pool_p        = this;
+    cache->d_head_p        = 0;
+    cache->d_numBlocks     = 0;
+    cache->d_lowWater      = 0;
+    cache->d_numOperations = 0;
+    cache->d_generation    = d_generation.loadRelaxed();
+    cache->d_prev_p        = 0;
+
+    {
+        ThreadCacheRegistry&           registry = threadCacheRegistry();
+        bslmt::LockGuard<bslmt::Mutex> registryGuard(&registry.d_mutex);
+
+        registry.add(cache, bslmt::ThreadUtil::selfIdAsUint64());
+        proctor.release();
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        cache->d_next_p = d_threadCaches_p;
+        if (d_threadCaches_p) {
+            d_threadCaches_p->d_prev_p = cache;
+        }
+        d_threadCaches_p = cache;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_threadCacheKey, cache)) {
+        // The cache remains on the list of caches, and is deallocated when
+        // this pool is destroyed.
+
+        return 0;                                                     // RETURN
+    }
+    return cache;
+}
+
+void ConcurrentPool::returnBlocks(ConcurrentPool_ThreadCache *cache,
+                                  int                         numBlocks)
+{
+    BSLS_ASSERT(cache);
+    BSLS_ASSERT(0 <= numBlocks);
+    BSLS_ASSERT(numBlocks <= cache->d_numBlocks);
+
+    Link *first = 0;
+    Link *last  = 0;
+    Link *p     = cache->d_head_p;
+
+    for (int i = 0; i < numBlocks; ++i) {
+        Link *next = p->d_next_p;
+
+        if (releaseReference(p)) {
+            p->d_next_p = first;
+            if (!first) {
+                last = p;
+            }
+            first = p;
+        }
+        p = next;
+    }
+
+    cache->d_head_p     = p;
+    cache->d_numBlocks -= numBlocks;
+    if (cache->d_lowWater > cache->d_numBlocks) {
+        cache->d_lowWater = cache->d_numBlocks;
+    }
+
+    if (first) {
+        pushBlocks(first, last);
+    }
+}
+
+// PRIVATE CLASS METHODS
+bool ConcurrentPool::releaseReference(Link *block)
+{
+    int refCount = bsls::AtomicOperations::getIntRelaxed(&block->d_refCount);
     for (;;) {
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-            refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
-                                                              2,
-                                                              0);
+            refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                           &block->d_refCount,
+                                                           2,
+                                                           0);
             if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-                break;
+                return true;                                          // RETURN
             }
         }
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
         const int oldRefCount = refCount;
-        refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
+        refCount = bsls::AtomicOperations::testAndSwapInt(&block->d_refCount,
                                                           refCount,
                                                           refCount - 1);
         if (oldRefCount == refCount) {
             // Someone else is still trying to pop this item.  Just let them
             // have it.
 
-            return;                                                   // RETURN
+            return false;                                             // RETURN
         }
     }
+}
 
-    Link *old = d_freeList.loadRelaxed();
-    for (;;) {
-        p->d_next_p = old;
-        const Link * const swap = old;
-        old = d_freeList.testAndSwap(old, p);  // release
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(swap == old)) {
-            break;
+// CREATORS
+ConcurrentPool::ConcurrentPool(int blockSize, bslma::Allocator *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
+, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
+, d_freeList(0)
+, d_blockList(basicAllocator)
+, d_threadCacheCapacity(0)
+, d_threadCaches_p(0)
+, d_generation(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    d_internalBlockSize = computeInternalBlockSize(blockSize);
+}
+
+ConcurrentPool::ConcurrentPool(int                          blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? k_MAX_CHUNK_SIZE : k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
+, d_growthStrategy(growthStrategy)
+, d_freeList(0)
+, d_blockList(basicAllocator)
+, d_threadCacheCapacity(0)
+, d_threadCaches_p(0)
+, d_generation(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    d_internalBlockSize = computeInternalBlockSize(blockSize);
+}
+
+ConcurrentPool::ConcurrentPool(int                          blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? maxBlocksPerChunk : k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(maxBlocksPerChunk)
+, d_growthStrategy(growthStrategy)
+, d_freeList(0)
+, d_blockList(basicAllocator)
+, d_threadCacheCapacity(0)
+, d_threadCaches_p(0)
+, d_generation(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= blockSize);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    d_internalBlockSize = computeInternalBlockSize(blockSize);
+}
+
+ConcurrentPool::~ConcurrentPool()
+{
+    BSLS_ASSERT(static_cast<int>(sizeof(LLink)) <= d_internalBlockSize);
+    BSLS_ASSERT(0 != d_chunkSize);
+
+    if (d_threadCacheCapacity) {
+        // Once the key is deleted, no thread starting to exit accesses this
+        // pool.  A thread that already started exiting may still destroy its
+        // cache: the registry lock makes this exclusive with the deallocation
+        // of the caches below, after which that thread leaves its
+        // (unregistered) cache alone.
+
+        bslmt::ThreadUtil::setSpecific(d_threadCacheKey, 0);
+        bslmt::ThreadUtil::deleteKey(d_threadCacheKey);
+
+        ThreadCacheRegistry&           registry = threadCacheRegistry();
+        bslmt::LockGuard<bslmt::Mutex> registryGuard(&registry.d_mutex);
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        while (d_threadCaches_p) {
+            ConcurrentPool_ThreadCache *next = d_threadCaches_p->d_next_p;
+            registry.remove(d_threadCaches_p);
+            d_allocator_p->deallocate(d_threadCaches_p);
+            d_threadCaches_p = next;
         }
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+}
+
+// MANIPULATORS
+void *ConcurrentPool::allocate()
+{
+    Link                       *p;
+    ConcurrentPool_ThreadCache *cache;
+
+    if (d_threadCacheCapacity && 0 != (cache = threadCache())) {
+        p = cache->pop();
+    }
+    else {
+        p = popBlock();
+    }
+
+    return static_cast<void *>(const_cast<Link **>(&p->d_next_p));
+}
+
+void ConcurrentPool::deallocate(void *address)
+{
+    Link *p = static_cast<Link *>(static_cast<void *>(
+                     static_cast<char *>(address) - offsetof(Link, d_next_p)));
+
+    ConcurrentPool_ThreadCache *cache;
+
+    // Only a cache that already exists is used: 'deallocate' must neither
+    // allocate nor throw.
+
+    if (d_threadCacheCapacity && 0 != (cache = existingThreadCache())) {
+        cache->push(p);
+    }
+    else if (releaseReference(p)) {
+        pushBlocks(p, p);
+    }
+}
+
+void ConcurrentPool::disableThreadCache()
+{
+    if (!d_threadCacheCapacity) {
+        return;                                                       // RETURN
+    }
+
+    // Clear the slot of the calling thread, so that its cache is not
+    // destroyed a second time when the thread exits.
+
+    bslmt::ThreadUtil::setSpecific(d_threadCacheKey, 0);
+    bslmt::ThreadUtil::deleteKey(d_threadCacheKey);
+
+    ThreadCacheRegistry&           registry = threadCacheRegistry();
+    bslmt::LockGuard<bslmt::Mutex> registryGuard(&registry.d_mutex);
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    const int generation = d_generation.loadRelaxed();
+    while (d_threadCaches_p) {
+        ConcurrentPool_ThreadCache *next = d_threadCaches_p->d_next_p;
+        if (d_threadCaches_p->d_generation == generation) {
+            returnBlocks(d_threadCaches_p, d_threadCaches_p->d_numBlocks);
+        }
+        registry.remove(d_threadCaches_p);
+        d_allocator_p->deallocate(d_threadCaches_p);
+        d_threadCaches_p = next;
+    }
+    d_threadCacheCapacity = 0;
+}
+
+int ConcurrentPool::enableThreadCache(int capacity)
+{
+    BSLS_ASSERT(2 <= capacity);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_threadCacheCapacity) {
+        return 1;                                                     // RETURN
+    }
+
+    if (0 != bslmt::ThreadUtil::createKey(
+                                   &d_threadCacheKey,
+                                   &bdlma_ConcurrentPool_destroyThreadCache)) {
+        return 2;                                                     // RETURN
+    }
+
+    d_threadCacheCapacity = capacity;
+    return 0;
+}
+
+void ConcurrentPool::releaseThreadCache()
+{
+    if (!d_threadCacheCapacity) {
+        return;                                                       // RETURN
+    }
+
+    ConcurrentPool_ThreadCache *cache =
+                              static_cast<ConcurrentPool_ThreadCache *>(
+                                  bslmt::ThreadUtil::getSpecific(
+                                                            d_threadCacheKey));
+
+    if (cache && cache->d_generation == d_generation.loadRelaxed()) {
+        returnBlocks(cache, cache->d_numBlocks);
+        cache->d_numOperations = 0;
     }
 }
 
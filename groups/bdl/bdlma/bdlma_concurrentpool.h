@@ -138,6 +138,45 @@ BSLS_IDENT("$Id: $")
 // An overloaded operator 'delete' is supplied solely to allow the compiler to
 // arrange for it to be called in case of an exception.
 //
+///Thread Caching
+///--------------
+// By default, every 'allocate' and 'deallocate' operates directly on the
+// pool's shared free list, using an atomic compare-and-swap on the head of the
+// list.  When many threads allocate and deallocate blocks from the same pool,
+// the cache line holding the head of the free list is continually transferred
+// between processors, which limits the throughput of the pool.
+//
+// The 'enableThreadCache' method equips a pool with an optional layer of
+// per-thread caches ("magazines"), in the style of the thread caches of
+// tcmalloc.  Once thread caching is enabled, each thread allocating from the
+// pool is given its own bounded list of free blocks, and 'allocate' and
+// 'deallocate' operate on the calling thread's cache without any atomic
+// operation, touching the shared free list only to:
+//
+//: o refill an empty cache with half of its capacity of blocks,
+//:
+//: o return half of the blocks of a full cache, and
+//:
+//: o periodically return half of the blocks that have remained unused in a
+//:   cache during the last period (a fixed number of operations on that
+//:   cache), so that a cache shrinks to match the demand of its thread.
+//
+// A thread's cache is returned to the shared free list when the thread exits,
+// and can be returned earlier by calling 'releaseThreadCache' from that
+// thread.  Note that a block may be deallocated by a thread other than the one
+// that allocated it; the block is then added to the deallocating thread's
+// cache if that thread has one, and to the shared free list otherwise.  Caches
+// are created only by 'allocate', so that 'deallocate' never allocates memory
+// and never throws.
+//
+// Thread caching must be enabled before the pool is shared among threads, and
+// cannot be disabled.  Each pool with thread caching enabled consumes one
+// thread-specific storage key (see 'bslmt::ThreadUtil::createKey'), of which
+// the number is limited on most platforms (e.g., 1024 on Linux), so thread
+// caching is intended for a small number of heavily-shared, long-lived pools.
+// A pool may be destroyed while threads that used it are exiting: the caches
+// of these threads are then deallocated by the pool.
+//
 ///Usage
 ///-----
 // A 'bdlma::ConcurrentPool' can be used by node-based containers (such as
@@ -263,6 +302,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_mutex.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
 #ifndef INCLUDED_BDLMA_INFREQUENTDELETEBLOCKLIST
 #include <bdlma_infrequentdeleteblocklist.h>
 #endif
@@ -306,6 +349,8 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace bdlma {
 
+struct ConcurrentPool_ThreadCache;
+
                            // ====================
                            // class ConcurrentPool
                            // ====================
@@ -356,20 +401,87 @@ class ConcurrentPool {
                      d_blockList;  // memory manager for allocated memory
 
     bslmt::Mutex      d_mutex;      // protects access to the block list
+                                   // and to the list of thread caches
+
+    int              d_threadCacheCapacity;
+                                   // maximum number of blocks in each thread
+                                   // cache, or 0 if thread caching is not
+                                   // enabled
+
+    bslmt::ThreadUtil::Key
+                     d_threadCacheKey;
+                                   // key of the calling thread's cache (valid
+                                   // only if thread caching is enabled)
+
+    ConcurrentPool_ThreadCache
+                    *d_threadCaches_p;
+                                   // list of the thread caches of this pool
+
+    bsls::AtomicInt  d_generation; // incremented by 'release', invalidating
+                                   // the content of all thread caches
+
+    bslma::Allocator
+                    *d_allocator_p;
+                                   // allocator supplying the thread caches
+                                   // (held, not owned)
+
+    // FRIENDS
+    friend struct ConcurrentPool_ThreadCache;
 
     // PRIVATE MANIPULATORS
+    Link *popBlock();
+        // Remove a block from the shared free list of this pool, replenishing
+        // the free list if it is empty, and return its address.
+
+    void pushBlocks(Link *first, Link *last);
+        // Insert the list of blocks starting at the specified 'first' block
+        // and ending at the specified 'last' block into the shared free list
+        // of this pool.
+
     void replenish();
         // Dynamically allocate a new chunk using the pool's underlying growth
         // strategy, and use the chunk to replenish the free memory list of
         // this pool.  The behavior is undefined unless the calling thread has
         // a lock on 'd_mutex'.
 
+    ConcurrentPool_ThreadCache *existingThreadCache();
+        // Return the address of the cache of the calling thread, discarding
+        // its content if it was filled before the last call to 'release', or
+        // 0 if the calling thread has no cache.  This method neither allocates
+        // memory nor throws.  The behavior is undefined unless thread caching
+        // is enabled.
+
+    ConcurrentPool_ThreadCache *threadCache();
+        // Return the address of the cache of the calling thread, creating it
+        // if needed, and discarding its content if it was filled before the
+        // last call to 'release'.  Return 0 if the cache could not be
+        // registered with the calling thread.  The behavior is undefined
+        // unless thread caching is enabled.
+
+    void returnBlocks(ConcurrentPool_ThreadCache *cache, int numBlocks);
+        // Move the specified 'numBlocks' blocks from the specified 'cache' to
+        // the shared free list of this pool.  The behavior is undefined unless
+        // '0 <= numBlocks <= cache->d_numBlocks'.
+
+    // PRIVATE CLASS METHODS
+    static bool releaseReference(Link *block);
+        // Mark the specified 'block', which is allocated, as free, and return
+        // 'true' if it must be inserted into the shared free list by the
+        // caller, or 'false' if a thread racing to remove 'block' from the
+        // free list has taken ownership of it.
+
   private:
     // NOT IMPLEMENTED
     ConcurrentPool(const ConcurrentPool&);
     ConcurrentPool& operator=(const ConcurrentPool&);
 
   public:
+    // PUBLIC TYPES
+    enum {
+        k_DEFAULT_THREAD_CACHE_CAPACITY = 64  // default number of blocks per
+                                              // thread cache
+    };
+
     // CREATORS
     explicit ConcurrentPool(int               blockSize,
                             bslma::Allocator *basicAllocator = 0);
@@ -409,7 +521,9 @@ class ConcurrentPool {
         // Relinquish the memory block at the specified 'address' back to this
         // pool object for reuse.  The behavior is undefined unless 'address'
         // is non-zero, was allocated by this pool, and has not already been
-        // deallocated.
+        // deallocated.  Note that, if thread caching is enabled and the
+        // calling thread has a cache, the block is added to that cache; this
+        // method never creates a cache.
 
     template <class TYPE>
     void deleteObject(const TYPE *object);
@@ -430,19 +544,50 @@ class ConcurrentPool {
         // it was originally dispensed by this pool), was allocated using this
         // pool, and has not already been deallocated.
 
+    int enableThreadCache(int capacity = k_DEFAULT_THREAD_CACHE_CAPACITY);
+        // Enable thread caching for this pool, each thread cache holding at
+        // most the specified 'capacity' free blocks (see {Thread Caching} in
+        // the component-level documentation).  Return 0 on success, and a
+        // non-zero value if thread caching is already enabled, or if no
+        // thread-specific storage key is available (in which case thread
+        // caching remains disabled).  The behavior is undefined unless
+        // '2 <= capacity', and this method is called before this pool is
+        // accessed by more than one thread.
+
+    void disableThreadCache();
+        // Disable thread caching for this pool, returning the blocks held by
+        // its thread caches to the shared free list and releasing its
+        // thread-specific storage key.  This method has no effect if thread
+        // caching is not enabled.  The behavior is undefined unless no thread
+        // other than the calling thread has accessed this pool since thread
+        // caching was enabled, and no other thread accesses this pool during
+        // this call.
+
     void release();
         // Relinquish all memory currently allocated via this pool object.
+        // Note that the content of the thread caches of this pool, if any, is
+        // discarded.
+
+    void releaseThreadCache();
+        // Return all the blocks held by the calling thread's cache to the
+        // shared free list of this pool.  This method has no effect if thread
+        // caching is not enabled, or if the calling thread has no cache.
 
     void reserveCapacity(int numBlocks);
         // Reserve memory from this pool to satisfy memory requests for at
         // least the specified 'numBlocks' before the pool replenishes.  The
-        // behavior is undefined unless '0 <= numBlocks'.
+        // behavior is undefined unless '0 <= numBlocks'.  Note that blocks
+        // held by thread caches are not accounted for.
 
     // ACCESSORS
     int blockSize() const;
         // Return the size (in bytes) of the memory blocks allocated from this
         // pool object.  Note that all blocks dispensed by this pool have the
         // same size.
+
+    int threadCacheCapacity() const;
+        // Return the maximum number of free blocks held by each thread cache
+        // of this pool, or 0 if thread caching is not enabled.
 };
 
 }  // close package namespace
@@ -546,6 +691,7 @@ void ConcurrentPool::release()
 {
     d_mutex.lock();
     d_freeList = (Link*)0;
+    ++d_generation;
     d_blockList.release();
     d_mutex.unlock();
 }
@@ -557,6 +703,12 @@ int ConcurrentPool::blockSize() const
     return d_blockSize;
 }
 
+inline
+int ConcurrentPool::threadCacheCapacity() const
+{
+    return d_threadCacheCapacity;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -81,7 +81,11 @@ using namespace bsl;  // automatically added by script
 // [ 8] void reserveCapacity(int numObjects);
 // [ 9] template<typename TYPE> void deleteObject(TYPE *object)
 //-----------------------------------------------------------------------------
-// [16] USAGE EXAMPLE
+// [16] int enableThreadCache(int capacity);
+// [16] void disableThreadCache();
+// [16] void releaseThreadCache();
+// [16] int threadCacheCapacity() const;
+// [17] USAGE EXAMPLE
 // [15] ORIGINAL USAGE EXAMPLE
 // [14] PERFORMANCE TEST
 // [13] CONCURRENCY TEST
@@ -611,6 +615,75 @@ void *workerThread(void *arg) {
     return arg;
 }
 
+struct CacheArgs {
+    // This 'struct' holds the arguments of 'allocateAndDeallocate'.
+
+    Obj *d_pool_p;       // pool to allocate from
+    int  d_numBlocks;    // number of blocks to allocate at once
+};
+
+extern "C"
+void *allocateAndDeallocate(void *arg)
+    // Allocate from the pool of the 'CacheArgs' object addressed by the
+    // specified 'arg' the number of blocks indicated by that object, write to
+    // them, and deallocate them.
+{
+    CacheArgs *args = static_cast<CacheArgs *>(arg);
+
+    bsl::vector<void *> blocks;
+    for (int i = 0; i < args->d_numBlocks; ++i) {
+        void *block = args->d_pool_p->allocate();
+        bsl::memset(block, 0xAB, args->d_pool_p->blockSize());
+        blocks.push_back(block);
+    }
+    for (int i = 0; i < args->d_numBlocks; ++i) {
+        args->d_pool_p->deallocate(blocks[i]);
+    }
+    return 0;
+}
+
+struct DeallocateArgs {
+    // This 'struct' holds the arguments of 'deallocateAll'.
+
+    Obj                 *d_pool_p;    // pool to deallocate to
+    bsl::vector<void *> *d_blocks_p;  // blocks to deallocate
+};
+
+extern "C"
+void *deallocateAll(void *arg)
+    // Deallocate to the pool of the 'DeallocateArgs' object addressed by the
+    // specified 'arg' all the blocks indicated by that object.
+{
+    DeallocateArgs *args = static_cast<DeallocateArgs *>(arg);
+
+    for (bsl::size_t i = 0; i < args->d_blocks_p->size(); ++i) {
+        args->d_pool_p->deallocate((*args->d_blocks_p)[i]);
+    }
+    return 0;
+}
+
+struct ExitArgs {
+    // This 'struct' holds the arguments of 'fillCacheAndExit'.
+
+    Obj            *d_pool_p;     // pool to allocate from
+    bslmt::Barrier *d_barrier_p;  // barrier to wait on before exiting
+};
+
+extern "C"
+void *fillCacheAndExit(void *arg)
+    // Allocate and deallocate a few blocks from the pool of the 'ExitArgs'
+    // object addressed by the specified 'arg', so that the calling thread
+    // has a thread cache, then wait on the barrier of that object and exit.
+{
+    ExitArgs *args = static_cast<ExitArgs *>(arg);
+
+    CacheArgs cacheArgs = { args->d_pool_p, 4 };
+    allocateAndDeallocate(&cacheArgs);
+
+    args->d_barrier_p->wait();
+    return 0;
+}
+
 //=============================================================================
 //                              BENCHMARKS
 //-----------------------------------------------------------------------------
@@ -692,7 +765,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Make sure main usage example compiles and works.
@@ -726,6 +799,280 @@ int main(int argc, char *argv[]) {
         array.removeAll();
         ASSERT(0 == array.length());
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD CACHING
+        //
+        // Concerns:
+        //: 1 Thread caching is disabled by default, can be enabled once, and
+        //:   reports its capacity.
+        //:
+        //: 2 Blocks dispensed through a thread cache are distinct and usable.
+        //:
+        //: 3 The blocks of a thread cache are returned to the shared free
+        //:   list by 'releaseThreadCache' and when the thread exits, so that
+        //:   other threads can reuse them without the pool replenishing.
+        //:
+        //: 4 'release' discards the content of the thread caches, after which
+        //:   the pool can be used again.
+        //:
+        //: 5 The destructor deallocates the thread caches.
+        //:
+        //: 6 'allocate' and 'deallocate' are thread-safe with thread caching
+        //:   enabled.
+        //:
+        //: 7 'deallocate' never creates a thread cache: a thread without a
+        //:   cache returns blocks to the shared free list.
+        //:
+        //: 8 'disableThreadCache' returns the cached blocks to the shared free
+        //:   list, deallocates the caches, and allows thread caching to be
+        //:   enabled again.
+        //:
+        //: 9 A pool can be destroyed while threads having a cache exit: each
+        //:   cache is deallocated exactly once, and an exiting thread does not
+        //:   access the destroyed pool.
+        //
+        // Plan:
+        //: 1 Enable thread caching on a pool, and verify the return values of
+        //:   'enableThreadCache' and 'threadCacheCapacity'.  (C-1)
+        //:
+        //: 2 Using a pool replenished by chunks of exactly 16 blocks,
+        //:   allocate 16 blocks, write to them, and deallocate them.  Then
+        //:   call 'releaseThreadCache', and in another thread allocate 16
+        //:   blocks; verify with a test allocator that the pool did not
+        //:   replenish.  Repeat using a third thread, after the second has
+        //:   exited.  (C-2..3)
+        //:
+        //: 3 Call 'release', verify that the chunk is deallocated, and
+        //:   allocate again.  (C-4)
+        //:
+        //: 4 Verify that all memory is returned to the test allocator when
+        //:   the pool is destroyed.  (C-5)
+        //:
+        //: 5 Run the concurrency test on a pool with thread caching enabled.
+        //:   (C-6)
+        //:
+        //: 6 Deallocate, from a thread that never allocated, blocks allocated
+        //:   by the main thread, and verify that no memory was allocated for a
+        //:   cache, and that the blocks can be allocated again without
+        //:   replenishing.  (C-7)
+        //:
+        //: 7 Fill the cache of the main thread, call 'disableThreadCache',
+        //:   and verify that the cache is deallocated, that the capacity is
+        //:   0, and that the blocks can be allocated again without
+        //:   replenishing.  Then enable thread caching again.  (C-8)
+        //:
+        //: 8 Repeatedly, create a pool with thread caching enabled, start
+        //:   threads that allocate from it and then wait on a barrier with the
+        //:   main thread, and destroy the pool as soon as the barrier is
+        //:   passed, while the threads exit.  Verify that no memory is leaked
+        //:   (the test allocator also reports any double deallocation).  (C-9)
+        //
+        // Testing:
+        //   int enableThreadCache(int capacity);
+        //   void disableThreadCache();
+        //   void releaseThreadCache();
+        //   int threadCacheCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING THREAD CACHING" << endl
+                                  << "======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Obj mX(8, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.threadCacheCapacity());
+
+            mX.releaseThreadCache();  // no effect
+
+            ASSERT(0 == mX.enableThreadCache());
+            ASSERT(Obj::k_DEFAULT_THREAD_CACHE_CAPACITY ==
+                                                      X.threadCacheCapacity());
+
+            ASSERT(0 != mX.enableThreadCache(8));
+            ASSERT(Obj::k_DEFAULT_THREAD_CACHE_CAPACITY ==
+                                                      X.threadCacheCapacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nReturning cached blocks." << endl;
+        {
+            enum { k_CHUNK = 16, k_CAPACITY = 8 };
+
+            Obj mX(8, bsls::BlockGrowth::BSLS_CONSTANT, k_CHUNK, &ta);
+            ASSERT(0 == mX.enableThreadCache(k_CAPACITY));
+
+            CacheArgs args = { &mX, k_CHUNK };
+
+            // The main thread fills its cache; its cache is then allocated,
+            // as is the first chunk.
+
+            allocateAndDeallocate(&args);
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+
+            mX.releaseThreadCache();
+
+            // Another thread can now allocate all the blocks of the chunk.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &allocateAndDeallocate,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            // The cache of the exited thread was deallocated, and no chunk
+            // was added.
+
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+
+            // The blocks cached by the exited thread were returned.
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &allocateAndDeallocate,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting 'release'." << endl;
+
+            void *block = mX.allocate();
+            bsl::memset(block, 0xAB, mX.blockSize());
+
+            mX.release();
+            ASSERTV(ta.numBlocksInUse(), 1 == ta.numBlocksInUse());
+
+            allocateAndDeallocate(&args);
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nDeallocating without a cache." << endl;
+        {
+            enum { k_CHUNK = 16, k_CAPACITY = 8 };
+
+            Obj mX(8, bsls::BlockGrowth::BSLS_CONSTANT, k_CHUNK, &ta);
+            ASSERT(0 == mX.enableThreadCache(k_CAPACITY));
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < k_CHUNK; ++i) {
+                blocks.push_back(mX.allocate());
+            }
+
+            // A thread that only deallocates does not get a cache: the
+            // blocks go to the shared free list.
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            DeallocateArgs            args = { &mX, &blocks };
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &deallocateAll,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(ta.numAllocations(), NUM_ALLOCATIONS,
+                    NUM_ALLOCATIONS == ta.numAllocations());
+
+            // The blocks can be allocated again without replenishing.
+
+            blocks.clear();
+            for (int i = 0; i < k_CHUNK; ++i) {
+                blocks.push_back(mX.allocate());
+            }
+            ASSERTV(ta.numAllocations(), NUM_ALLOCATIONS,
+                    NUM_ALLOCATIONS == ta.numAllocations());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'disableThreadCache'." << endl;
+        {
+            enum { k_CHUNK = 16, k_CAPACITY = 8 };
+
+            Obj mX(8, bsls::BlockGrowth::BSLS_CONSTANT, k_CHUNK, &ta);
+            const Obj& X = mX;
+
+            mX.disableThreadCache();  // no effect
+            ASSERT(0 == X.threadCacheCapacity());
+
+            ASSERT(0 == mX.enableThreadCache(k_CAPACITY));
+
+            // Fill the cache of the main thread.
+
+            CacheArgs args = { &mX, k_CHUNK };
+            allocateAndDeallocate(&args);
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+
+            mX.disableThreadCache();
+            ASSERT(0 == X.threadCacheCapacity());
+            ASSERTV(ta.numBlocksInUse(), 1 == ta.numBlocksInUse());
+
+            // The cached blocks were returned to the shared free list.
+
+            allocateAndDeallocate(&args);
+            ASSERTV(ta.numBlocksInUse(), 1 == ta.numBlocksInUse());
+
+            ASSERT(0 == mX.enableThreadCache(k_CAPACITY));
+            ASSERT(k_CAPACITY == X.threadCacheCapacity());
+
+            allocateAndDeallocate(&args);
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nDestroying while threads exit." << endl;
+        {
+            enum { k_NUM_ROUNDS = 100, k_NUM_EXITING = 8 };
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                Obj *mX = new (ta) Obj(8, &ta);
+                ASSERT(0 == mX->enableThreadCache(4));
+
+                bslmt::Barrier            exitBarrier(k_NUM_EXITING + 1);
+                ExitArgs                  args = { mX, &exitBarrier };
+                bslmt::ThreadUtil::Handle handles[k_NUM_EXITING];
+
+                for (int i = 0; i < k_NUM_EXITING; ++i) {
+                    ASSERTV(round, i, 0 == bslmt::ThreadUtil::create(
+                                                            &handles[i],
+                                                            &fillCacheAndExit,
+                                                            &args));
+                }
+                exitBarrier.wait();
+
+                ta.deleteObject(mX);
+
+                for (int i = 0; i < k_NUM_EXITING; ++i) {
+                    ASSERTV(round, i, 0 == bslmt::ThreadUtil::join(
+                                                                 handles[i]));
+                }
+                ASSERTV(round, ta.numBlocksInUse(),
+                        0 == ta.numBlocksInUse());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nConcurrency test." << endl;
+        {
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+            Obj mX(k_OBJECT_SIZE, &ta);
+            ASSERT(0 == mX.enableThreadCache(4));
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::create(&threads[i],
+                                                   workerThread,
+                                                   &mX);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::join(threads[i]);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // ORIGINAL USAGE EXAMPLE
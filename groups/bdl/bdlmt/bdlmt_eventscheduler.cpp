@@ -18,6 +18,8 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 #include <bdlf_bind.h>
 #include <bsls_systemtime.h>
 
+#include <bslma_default.h>
+
 #include <bsls_assert.h>
 
 #include <bsl_algorithm.h>
@@ -147,6 +149,90 @@ void EventScheduler::dispatchEvents()
 
 }
 
+void EventScheduler::dispatchWheelEvents()
+{
+    BSLS_ASSERT(d_eventWheel_mp);
+
+    while (1) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // Get ready for the next iteration.
+
+        releaseCurrentEvents();
+
+        if (d_dispatcherAwaited) {
+            d_dispatcherAwaited = false;
+            d_iterationCondition.broadcast();
+        }
+
+        // Now proceed with the next iteration.
+
+        if (!d_running) {
+            return;                                                   // RETURN
+        }
+
+        BSLS_ASSERT(0 == d_currentRecurringEvent);
+        BSLS_ASSERT(0 == d_currentWheelEvent);
+
+        bsls::Types::Int64 now =
+                        bsls::SystemTime::now(d_clockType).totalMicroseconds();
+
+        // An event returned by the wheel is already due, so (as in
+        // 'chooseNextEvent') it is preferred over any recurring event.
+
+        if (0 == d_eventWheel_mp->expiredFrontRaw(&d_currentWheelEvent,
+                                                  now)) {
+            int ret = d_eventWheel_mp->remove(d_currentWheelEvent);
+            if (0 == ret) {
+                lock.release()->unlock();
+                d_dispatcherFunctor(d_currentWheelEvent->data());
+            }
+            continue;
+        }
+
+        d_recurringQueue.frontRaw(&d_currentRecurringEvent);
+
+        if (d_currentRecurringEvent && d_currentRecurringEvent->key() <= now) {
+            RecurringEventData& data = d_currentRecurringEvent->data();
+            int ret = d_recurringQueue.updateR(
+                                          d_currentRecurringEvent,
+                                          d_currentRecurringEvent->key()
+                                          + data.second.totalMicroseconds());
+            if (0 == ret) {
+                lock.release()->unlock();
+                d_dispatcherFunctor(data.first);
+            }
+            continue;
+        }
+
+        // Nothing is due: wait for the earlier of the next recurring event
+        // and the start of the next non-empty slot of the wheel.  Note that
+        // 'nextExpiry' must be called with 'd_mutex' held until the wait (see
+        // {'bdlcc_timingwheel'|Waking Up a Dispatcher}).
+
+        bsls::Types::Int64 t;
+        int                rc = d_eventWheel_mp->nextExpiry(&t);
+
+        if (d_currentRecurringEvent) {
+            if (0 != rc || d_currentRecurringEvent->key() < t) {
+                t  = d_currentRecurringEvent->key();
+                rc = 0;
+            }
+        }
+
+        releaseCurrentEvents();
+
+        if (0 != rc) {
+            d_queueCondition.wait(&d_mutex);
+        }
+        else {
+            bsls::TimeInterval w;
+            w.addMicroseconds(t);
+            d_queueCondition.timedWait(&d_mutex, w);
+        }
+    }
+}
+
 void EventScheduler::releaseCurrentEvents()
 {
     if (d_currentRecurringEvent) {
@@ -158,6 +244,11 @@ void EventScheduler::releaseCurrentEvents()
         d_eventQueue.releaseReferenceRaw(d_currentEvent);
         d_currentEvent = 0;
     }
+
+    if (d_currentWheelEvent) {
+        d_eventWheel_mp->releaseReferenceRaw(d_currentWheelEvent);
+        d_currentWheelEvent = 0;
+    }
 }
 
 // CREATORS
@@ -171,6 +262,7 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 {
 }
 
@@ -186,6 +278,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 {
 }
 
@@ -201,6 +294,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 {
 }
 
@@ -218,7 +312,61 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
+{
+}
+
+EventScheduler::EventScheduler(
+                            bsls::SystemClockType::Enum  clockType,
+                            const bsls::TimeInterval&    timingWheelResolution,
+                            bslma::Allocator            *basicAllocator)
+: d_clockType(clockType)
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(&defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+{
+    BSLS_ASSERT(0 < timingWheelResolution.totalMicroseconds());
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+    d_eventWheel_mp.load(
+                   new (*allocator) EventWheel(
+                                   timingWheelResolution.totalMicroseconds(),
+                                   allocator),
+                   allocator);
+}
+
+EventScheduler::EventScheduler(
+                      const EventScheduler::Dispatcher&  dispatcherFunctor,
+                      bsls::SystemClockType::Enum        clockType,
+                      const bsls::TimeInterval&          timingWheelResolution,
+                      bslma::Allocator                  *basicAllocator)
+: d_clockType(clockType)
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
 {
+    BSLS_ASSERT(0 < timingWheelResolution.totalMicroseconds());
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+    d_eventWheel_mp.load(
+                   new (*allocator) EventWheel(
+                                   timingWheelResolution.totalMicroseconds(),
+                                   allocator),
+                   allocator);
 }
 
 EventScheduler::~EventScheduler()
@@ -245,10 +393,13 @@ int EventScheduler::start(const bslmt::ThreadAttributes& threadAttributes)
     bslmt::ThreadAttributes modAttr(threadAttributes);
     modAttr.setDetachedState(bslmt::ThreadAttributes::e_CREATE_JOINABLE);
 
-    if (bslmt::ThreadUtil::create(
-                &d_dispatcherThread,
-                modAttr,
-                bdlf::BindUtil::bind(&EventScheduler::dispatchEvents, this))) {
+    void (EventScheduler::*dispatch)() = d_eventWheel_mp
+                                       ? &EventScheduler::dispatchWheelEvents
+                                       : &EventScheduler::dispatchEvents;
+
+    if (bslmt::ThreadUtil::create(&d_dispatcherThread,
+                                  modAttr,
+                                  bdlf::BindUtil::bind(dispatch, this))) {
         return -1;                                                    // RETURN
     }
 
@@ -282,10 +433,20 @@ EventScheduler::scheduleEvent(EventHandle                  *event,
 {
     bool newTop;
 
-    d_eventQueue.addR(&event->d_handle,
-                      time.totalMicroseconds(),
-                      callback,
-                      &newTop);
+    if (d_eventWheel_mp) {
+        event->d_handle.release();
+        d_eventWheel_mp->add(&event->d_wheelHandle,
+                             time.totalMicroseconds(),
+                             callback,
+                             &newTop);
+    }
+    else {
+        event->d_wheelHandle.release();
+        d_eventQueue.addR(&event->d_handle,
+                          time.totalMicroseconds(),
+                          callback,
+                          &newTop);
+    }
 
     if (newTop) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -299,10 +460,18 @@ void EventScheduler::scheduleEventRaw(Event                        **event,
 {
     bool newTop;
 
-    d_eventQueue.addRawR((EventQueue::Pair **)event,
-                         time.totalMicroseconds(),
-                         callback,
-                         &newTop);
+    if (d_eventWheel_mp) {
+        d_eventWheel_mp->addRaw((EventWheel::Pair **)event,
+                                time.totalMicroseconds(),
+                                callback,
+                                &newTop);
+    }
+    else {
+        d_eventQueue.addRawR((EventQueue::Pair **)event,
+                             time.totalMicroseconds(),
+                             callback,
+                             &newTop);
+    }
 
     if (newTop) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -432,6 +601,24 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                            d_dispatcherThread));
 
+    if (d_eventWheel_mp) {
+        const EventWheel::Pair *wheelItemPtr =
+                             reinterpret_cast<const EventWheel::Pair *>(
+                                       reinterpret_cast<const void *>(handle));
+
+        int ret = d_eventWheel_mp->remove(wheelItemPtr);
+        if (EventWheel::e_NOT_FOUND != ret) {
+            return ret;                                               // RETURN
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        while (d_currentWheelEvent == wheelItemPtr) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+        return ret;                                                   // RETURN
+    }
+
     const EventQueue::Pair *itemPtr =
                              reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
@@ -484,6 +671,23 @@ int EventScheduler::cancelEventAndWait(RecurringEventHandle *handle)
 int EventScheduler::rescheduleEvent(const Event               *handle,
                                     const bsls::TimeInterval&  newTime)
 {
+    if (d_eventWheel_mp) {
+        const EventWheel::Pair *h = reinterpret_cast<const EventWheel::Pair *>(
+                                       reinterpret_cast<const void *>(handle));
+
+        bool isNewTop;
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        int ret = d_eventWheel_mp->update(h,
+                                          newTime.totalMicroseconds(),
+                                          &isNewTop);
+
+        if (0 == ret && isNewTop) {
+            d_queueCondition.signal();
+        }
+        return ret;                                                   // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
 
@@ -504,6 +708,30 @@ int EventScheduler::rescheduleEventAndWait(const Event               *handle,
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_eventWheel_mp) {
+        const EventWheel::Pair *h = reinterpret_cast<const EventWheel::Pair *>(
+                                       reinterpret_cast<const void *>(handle));
+
+        bool isNewTop;
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        int ret = d_eventWheel_mp->update(h,
+                                          newTime.totalMicroseconds(),
+                                          &isNewTop);
+
+        if (0 == ret && isNewTop) {
+            d_queueCondition.signal();
+        }
+
+        // Wait until event is rescheduled or dispatched.
+
+        while (d_currentWheelEvent == h) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+        return ret;                                                   // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
     int ret;
@@ -541,6 +769,9 @@ int EventScheduler::rescheduleEventAndWait(const Event               *handle,
 
 void EventScheduler::cancelAllEvents()
 {
+    if (d_eventWheel_mp) {
+        d_eventWheel_mp->removeAll();
+    }
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 }
@@ -550,12 +781,17 @@ void EventScheduler::cancelAllEventsAndWait()
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                            d_dispatcherThread));
 
+    if (d_eventWheel_mp) {
+        d_eventWheel_mp->removeAll();
+    }
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (0 == d_currentEvent && 0 == d_currentRecurringEvent) {
+        if (0 == d_currentEvent
+         && 0 == d_currentRecurringEvent
+         && 0 == d_currentWheelEvent) {
             break;
         }
         else {
@@ -22,7 +22,7 @@ BSLS_IDENT("$Id: $")
 //  bdlmt::EventSchedulerEventHandle: handle to a single scheduled event
 //  bdlmt::EventSchedulerRecurringEventHandle: handle to a recurring event
 //
-//@SEE_ALSO: bdlmt_timereventscheduler
+//@SEE_ALSO: bdlmt_timereventscheduler, bdlcc_timingwheel
 //
 //@DESCRIPTION: This component provides a thread-safe event scheduler.
 // 'bdlmt::EventScheduler', that implements methods to schedule and cancel
@@ -110,6 +110,33 @@ BSLS_IDENT("$Id: $")
 // dispatcher thread becomes available; once the backlog is worked off, events
 // will be executed at or near their scheduled times.
 //
+///Timing-Wheel Mode
+///-----------------
+// By default, one-time events are kept in a skip list ordered by scheduled
+// time, so that scheduling, cancelling, and rescheduling an event take time
+// logarithmic in the number of pending events.  Applications maintaining very
+// large numbers of one-time events that are mostly cancelled or rescheduled
+// before they are due (e.g., I/O timeouts) may instead create the scheduler
+// with a *timing-wheel* *resolution*, in which case one-time events are kept
+// in a 'bdlcc::TimingWheel' having ticks of that length, and those operations
+// take constant time.  In that mode:
+//
+//: o One-time events are never executed before their scheduled time, but may
+//:   be executed up to one resolution after it (in addition to the usual
+//:   scheduling latency of the dispatcher thread).
+//:
+//: o One-time events whose scheduled times fall within the same tick may be
+//:   executed in any order.  One-time events that are overdue are executed
+//:   ahead of recurring events.
+//:
+//: o Recurring events are unaffected: they are still kept in a skip list (as
+//:   a recurring event is rescheduled every time it executes, and there are
+//:   typically few of them) and are executed at their precise times.
+//
+// The interface of the scheduler is the same in both modes, including the
+// "Raw" API; note, however, that 'Event' pointers and handles must only be
+// used with the scheduler that populated them.
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -293,6 +320,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlcc_skiplist.h>
 #endif
 
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#include <bdlcc_timingwheel.h>
+#endif
+
 #ifndef INCLUDED_BSLMT_CONDITION
 #include <bslmt_condition.h>
 #endif
@@ -325,6 +356,10 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_MANAGEDPTR
+#include <bslma_managedptr.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -366,6 +401,8 @@ class EventScheduler {
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             bsl::function<void()> >        EventQueue;
 
+    typedef bdlcc::TimingWheel<bsl::function<void()> >     EventWheel;
+
     // FRIENDS
     friend class EventSchedulerEventHandle;
     friend class EventSchedulerRecurringEventHandle;
@@ -399,6 +436,11 @@ class EventScheduler {
 
     RecurringEventQueue   d_recurringQueue;     // recurring events
 
+    bslma::ManagedPtr<EventWheel>
+                          d_eventWheel_mp;      // events, in timing-wheel
+                                                // mode (used instead of
+                                                // 'd_eventQueue'), or empty
+
     Dispatcher            d_dispatcherFunctor;  // dispatch events
 
     bslmt::ThreadUtil::Handle
@@ -436,6 +478,11 @@ class EventScheduler {
                                                 // scheduled recurring event
                                                 // being executed
 
+    EventWheel::Pair     *d_currentWheelEvent;  // Raw reference to the
+                                                // scheduled event being
+                                                // executed, in timing-wheel
+                                                // mode
+
     // PRIVATE MANIPULATORS
     bsls::Types::Int64 chooseNextEvent(bsls::Types::Int64 *now);
         // Pick either d_currentEvent or d_currentRecurringEvent as the next
@@ -458,9 +505,14 @@ class EventScheduler {
         // event queues at their scheduled times.  Note that this method
         // implements the dispatching thread.
 
+    void dispatchWheelEvents();
+        // While d_running is true, execute events in the timing wheel and
+        // recurring event queue at their scheduled times.  Note that this
+        // method implements the dispatching thread in timing-wheel mode.
+
     void releaseCurrentEvents();
-        // Release 'd_currentRecurringEvent' and 'd_currentEvent', if they
-        // refer to valid events.
+        // Release 'd_currentRecurringEvent', 'd_currentEvent', and
+        // 'd_currentWheelEvent', if they refer to valid events.
 
   public:
     // TRAITS
@@ -508,6 +560,35 @@ class EventScheduler {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
+    EventScheduler(bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    timingWheelResolution,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler in timing-wheel mode, keeping one-time
+        // events in a timing wheel having ticks of the specified
+        // 'timingWheelResolution' (see {Timing-Wheel Mode} in the component
+        // documentation), using the default dispatcher functor, and use the
+        // specified 'clockType' to indicate the epoch used for all time
+        // intervals (see {Supported Clock-Types} in the component
+        // documentation).  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'timingWheelResolution' is at least one microsecond.
+
+    EventScheduler(const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    timingWheelResolution,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler in timing-wheel mode, keeping one-time
+        // events in a timing wheel having ticks of the specified
+        // 'timingWheelResolution' (see {Timing-Wheel Mode} in the component
+        // documentation), using the specified 'dispatcherFunctor', and use
+        // the specified 'clockType' to indicate the epoch used for all time
+        // intervals (see {Supported Clock-Types} in the component
+        // documentation).  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'timingWheelResolution' is at least one microsecond.
+
     ~EventScheduler();
         // Discard all unprocessed events and destroy this object.  The
         // behavior is undefined unless the scheduler is stopped.
@@ -708,6 +789,12 @@ class EventScheduler {
     int numRecurringEvents() const;
         // Return the number of recurring events registered with this
         // scheduler.
+
+    bsls::TimeInterval timingWheelResolution() const;
+        // Return the resolution of the timing wheel holding the one-time
+        // events of this scheduler, or a zero interval if this scheduler is
+        // not in timing-wheel mode (see {Timing-Wheel Mode} in the component
+        // documentation).
 };
 
                       // ===============================
@@ -724,8 +811,15 @@ class EventSchedulerEventHandle
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             bsl::function<void()> > EventQueue;
 
+    typedef bdlcc::TimingWheel<bsl::function<void()> >
+                                                    EventWheel;
+
     // DATA
-    EventQueue::PairHandle  d_handle;
+    EventQueue::PairHandle  d_handle;       // reference to an event of a
+                                            // scheduler in the default mode
+
+    EventWheel::PairHandle  d_wheelHandle;  // reference to an event of a
+                                            // scheduler in timing-wheel mode
 
     // FRIENDS
     friend class EventScheduler;
@@ -833,6 +927,7 @@ inline
 EventSchedulerEventHandle::EventSchedulerEventHandle(
                                      const EventSchedulerEventHandle& original)
 : d_handle(original.d_handle)
+, d_wheelHandle(original.d_wheelHandle)
 {
 }
 
@@ -846,7 +941,8 @@ inline
 EventSchedulerEventHandle&
 EventSchedulerEventHandle::operator=(const EventSchedulerEventHandle& rhs)
 {
-    d_handle = rhs.d_handle;
+    d_handle      = rhs.d_handle;
+    d_wheelHandle = rhs.d_wheelHandle;
     return *this;
 }
 
@@ -854,6 +950,7 @@ inline
 void EventSchedulerEventHandle::release()
 {
     d_handle.release();
+    d_wheelHandle.release();
 }
 }  // close package namespace
 
@@ -865,6 +962,10 @@ inline
 bdlmt::EventSchedulerEventHandle::
 operator const bdlmt::EventSchedulerEventHandle::Event*() const
 {
+    if (d_wheelHandle.isValid()) {
+        return (const Event*)((const EventWheel::Pair*)d_wheelHandle);
+                                                                      // RETURN
+    }
     return (const Event*)((const EventQueue::Pair*)d_handle);
 }
 
@@ -929,6 +1030,13 @@ namespace bdlmt {
 inline
 int EventScheduler::cancelEvent(const Event *handle)
 {
+    if (d_eventWheel_mp) {
+        return d_eventWheel_mp->remove(
+                          reinterpret_cast<const EventWheel::Pair*>(
+                                       reinterpret_cast<const void*>(handle)));
+                                                                      // RETURN
+    }
+
     const EventQueue::Pair *itemPtr =
                         reinterpret_cast<const EventQueue::Pair*>(
                                         reinterpret_cast<const void*>(handle));
@@ -956,6 +1064,13 @@ void EventScheduler::scheduleEvent(const bsls::TimeInterval&    time,
 inline
 void EventScheduler::releaseEventRaw(Event *handle)
 {
+    if (d_eventWheel_mp) {
+        d_eventWheel_mp->releaseReferenceRaw(
+                                reinterpret_cast<EventWheel::Pair*>(
+                                             reinterpret_cast<void*>(handle)));
+        return;                                                       // RETURN
+    }
+
     d_eventQueue.releaseReferenceRaw(reinterpret_cast<EventQueue::Pair*>(
                                              reinterpret_cast<void*>(handle)));
 }
@@ -982,6 +1097,14 @@ inline
 EventScheduler::Event*
 EventScheduler::addEventRefRaw(Event *handle) const
 {
+    if (d_eventWheel_mp) {
+        EventWheel::Pair *h = reinterpret_cast<EventWheel::Pair*>(
+                                              reinterpret_cast<void*>(handle));
+        return reinterpret_cast<Event*>(
+                                      d_eventWheel_mp->addPairReferenceRaw(h));
+                                                                      // RETURN
+    }
+
     EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
                                               reinterpret_cast<void*>(handle));
     return reinterpret_cast<Event*>(d_eventQueue.addPairReferenceRaw(h));
@@ -1007,7 +1130,8 @@ bsls::SystemClockType::Enum EventScheduler::clockType() const
 inline
 int EventScheduler::numEvents() const
 {
-    return d_eventQueue.length();
+    return d_eventWheel_mp ? d_eventWheel_mp->length()
+                           : d_eventQueue.length();
 }
 
 inline
@@ -1016,6 +1140,16 @@ int EventScheduler::numRecurringEvents() const
     return d_recurringQueue.length();
 }
 
+inline
+bsls::TimeInterval EventScheduler::timingWheelResolution() const
+{
+    bsls::TimeInterval result;
+    if (d_eventWheel_mp) {
+        result.addMicroseconds(d_eventWheel_mp->resolution());
+    }
+    return result;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -14,6 +14,8 @@
 #include <bslma_testallocator.h>
 #include <bsls_atomic.h>
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadgroup.h>
 
 #include <bdlf_bind.h>
@@ -44,6 +46,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -89,6 +92,9 @@ using namespace bsl;  // automatically added by script
 // [08] bdlmt::EventScheduler(dispatcher, allocator = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, alloc = 0);
 //
+// [22] bdlmt::EventScheduler(clockType, resolution, alloc = 0);
+// [22] bdlmt::EventScheduler(disp, clockType, resolution, alloc = 0);
+//
 // [01] ~bdlmt::EventScheduler();
 //
 // MANIPULATORS
@@ -107,12 +113,14 @@ using namespace bsl;  // automatically added by script
 // [09] void stop();
 //
 // ACCESSORS
+// [22] bsls::TimeInterval timingWheelResolution() const;
 //-----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [07] TESTING METHODS INVOCATIONS FROM THE DISPATCHER THREAD
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
-// [21] USAGE EXAMPLE
+// [22] TESTING TIMING-WHEEL MODE
+// [23] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -814,6 +822,42 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 22 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_22 {
+
+struct Recorder {
+    // This 'struct' records the (monotonic) time at which each event of a
+    // test was executed.
+
+    bslmt::Mutex                    d_mutex;
+    bsl::vector<bsls::Types::Int64> d_executed;     // 0 if not executed
+    bsls::AtomicInt                 d_numExecuted;
+};
+
+void record(Recorder *recorder, int index)
+    // Record in the specified 'recorder' that the event having the specified
+    // 'index' was executed now.
+{
+    bsls::Types::Int64 now =
+                  bsls::SystemTime::nowMonotonicClock().totalMicroseconds();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&recorder->d_mutex);
+    recorder->d_executed[index] = now;
+    ++recorder->d_numExecuted;
+}
+
+void dispatcherFunction(bsl::function<void()> functor)
+    // This is a dispatcher function that simply executes the specified
+    // 'functor'.
+{
+    functor();
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_22
+
 // ============================================================================
 //                         CASE 20 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2109,7 +2153,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 22: {
+      case 23: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLES:
         //
@@ -2164,6 +2208,207 @@ int main(int argc, char *argv[])
         ASSERT(0 < ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       } break;
+      case 22: {
+        // --------------------------------------------------------------------
+        // TESTING TIMING-WHEEL MODE
+        //
+        // Concerns:
+        //: 1 The timing-wheel constructors create a scheduler in timing-wheel
+        //:   mode, with the specified clock type and dispatcher, and
+        //:   'timingWheelResolution' reports the resolution (or 0 for a
+        //:   scheduler in the default mode).
+        //:
+        //: 2 One-time events are executed, never before their scheduled
+        //:   times, unless cancelled; cancelled and rescheduled events are
+        //:   handled as in the default mode.
+        //:
+        //: 3 The "Raw" API, recurring events, and the 'AndWait' methods work
+        //:   in timing-wheel mode.
+        //:
+        //: 4 All memory is released.
+        //
+        // Plan:
+        //: 1 Construct schedulers with each constructor and check the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Schedule events at various times, cancel and reschedule some of
+        //:   them, start the scheduler, and verify when (and whether) each
+        //:   event is executed.  (C-2)
+        //:
+        //: 3 Exercise the remaining methods on a running scheduler.  (C-3)
+        //:
+        //: 4 Use a test allocator throughout.  (C-4)
+        //
+        // Testing:
+        //   bdlmt::EventScheduler(clockType, resolution, alloc = 0);
+        //   bdlmt::EventScheduler(disp, clockType, resolution, alloc = 0);
+        //   bsls::TimeInterval timingWheelResolution() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TIMING-WHEEL MODE" << endl
+                          << "=========================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_22;
+        using namespace bdlf::PlaceHolders;
+
+        typedef bsls::Types::Int64 Int64;
+
+        const bsls::SystemClockType::Enum monotonic =
+                                            bsls::SystemClockType::e_MONOTONIC;
+        const bsls::TimeInterval          RESOLUTION(0, 5 * 1000 * 1000);
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tConstructors and accessors." << endl;
+        {
+            bdlmt::EventScheduler::Dispatcher dispatcher =
+                                 bdlf::BindUtil::bind(&dispatcherFunction, _1);
+
+            Obj x(&ta);                                  const Obj& X = x;
+            Obj y(monotonic, RESOLUTION, &ta);           const Obj& Y = y;
+            Obj z(dispatcher, monotonic, RESOLUTION, &ta);
+                                                         const Obj& Z = z;
+
+            ASSERT(bsls::TimeInterval() == X.timingWheelResolution());
+            ASSERT(RESOLUTION           == Y.timingWheelResolution());
+            ASSERT(RESOLUTION           == Z.timingWheelResolution());
+            ASSERT(monotonic            == Y.clockType());
+            ASSERT(monotonic            == Z.clockType());
+
+            Recorder recorder;
+            recorder.d_executed.resize(1, 0);
+
+            z.start();
+            z.scheduleEvent(bsls::SystemTime::nowMonotonicClock(),
+                            bdlf::BindUtil::bind(&record, &recorder, 0));
+            for (int i = 0; i < 100 && 0 == recorder.d_numExecuted; ++i) {
+                microSleep(10000, 0);
+            }
+            z.stop();
+            ASSERT(1 == recorder.d_numExecuted);
+        }
+
+        if (verbose) cout << "\tExecution, cancellation, rescheduling."
+                          << endl;
+        {
+            const int NUM_EVENTS = 200;
+
+            Recorder recorder;
+            recorder.d_executed.resize(NUM_EVENTS, 0);
+
+            Obj                      x(monotonic, RESOLUTION, &ta);
+            bsl::vector<EventHandle> handles(NUM_EVENTS);
+            bsl::vector<Int64>       scheduled(NUM_EVENTS);
+
+            const bsls::TimeInterval now =
+                                         bsls::SystemTime::nowMonotonicClock();
+
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                bsls::TimeInterval time(now);
+                time.addMicroseconds((i * 7919) % 300000);
+                scheduled[i] = time.totalMicroseconds();
+                x.scheduleEvent(&handles[i],
+                                time,
+                                bdlf::BindUtil::bind(&record, &recorder, i));
+            }
+            ASSERT(NUM_EVENTS == x.numEvents());
+
+            int numExpected = NUM_EVENTS;
+            for (int i = 0; i < NUM_EVENTS; i += 4) {
+                ASSERT(0 == x.cancelEvent(handles[i]));
+                --numExpected;
+            }
+            for (int i = 1; i < NUM_EVENTS; i += 4) {
+                bsls::TimeInterval time;
+                time.addMicroseconds(scheduled[i] + 100000);
+                ASSERT(0 == x.rescheduleEvent(handles[i], time));
+                scheduled[i] = time.totalMicroseconds();
+            }
+            ASSERT(numExpected == x.numEvents());
+
+            x.start();
+            for (int i = 0; i < 500 && numExpected != recorder.d_numExecuted;
+                                                                         ++i) {
+                microSleep(10000, 0);
+            }
+            x.stop();
+
+            ASSERT(numExpected == recorder.d_numExecuted);
+            ASSERT(0           == x.numEvents());
+
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                if (0 == i % 4) {
+                    LOOP_ASSERT(i, 0 == recorder.d_executed[i]);
+                    LOOP_ASSERT(i, 0 != x.cancelEvent(handles[i]));
+                }
+                else {
+                    LOOP3_ASSERT(i, recorder.d_executed[i], scheduled[i],
+                                 recorder.d_executed[i] >= scheduled[i]);
+                    LOOP_ASSERT(i, 0 != x.cancelEvent(handles[i]));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tRaw API, recurring events, and waiting."
+                          << endl;
+        {
+            Recorder recorder;
+            recorder.d_executed.resize(3, 0);
+
+            Obj                  x(monotonic, RESOLUTION, &ta);
+            EventHandle          h;
+            RecurringEventHandle rh;
+
+            bsls::TimeInterval soon = bsls::SystemTime::nowMonotonicClock();
+            soon.addMilliseconds(20);
+            bsls::TimeInterval later = soon;
+            later.addSeconds(10);
+
+            Event *raw;
+            x.scheduleEventRaw(&raw,
+                               soon,
+                               bdlf::BindUtil::bind(&record, &recorder, 0));
+            Event *raw2 = x.addEventRefRaw(raw);
+            ASSERT(raw2 == raw);
+            x.releaseEventRaw(raw);
+
+            x.scheduleRecurringEvent(
+                                  &rh,
+                                  bsls::TimeInterval(0, 10 * 1000 * 1000),
+                                  bdlf::BindUtil::bind(&record, &recorder, 1));
+            x.scheduleEvent(&h,
+                            later,
+                            bdlf::BindUtil::bind(&record, &recorder, 2));
+            ASSERT(2 == x.numEvents());
+            ASSERT(1 == x.numRecurringEvents());
+
+            x.start();
+            for (int i = 0; i < 100 && 0 == recorder.d_executed[0]; ++i) {
+                microSleep(10000, 0);
+            }
+            microSleep(50000, 0);
+
+            ASSERT(0 != recorder.d_executed[0]);
+            ASSERT(0 != recorder.d_executed[1]);
+            ASSERT(0 != x.cancelEventAndWait(raw2));
+            x.releaseEventRaw(raw2);
+
+            ASSERT(0 == x.rescheduleEventAndWait(h, later + RESOLUTION));
+            ASSERT(0 == x.cancelEventAndWait(&h));
+            ASSERT(0 == recorder.d_executed[2]);
+            ASSERT(0 == x.numEvents());
+
+            x.scheduleEvent(&h,
+                            later,
+                            bdlf::BindUtil::bind(&record, &recorder, 2));
+            x.cancelAllEventsAndWait();
+            ASSERT(0 == x.numEvents());
+            ASSERT(0 == x.numRecurringEvents());
+            x.stop();
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // TESTING CLOCKTYPE ACCESSOR
@@ -53,8 +53,10 @@ BSLS_IDENT("$Id: $")
 // 'bdlmt::FixedThreadPool' once it is created with a specified number of
 // threads and queue capacity, hence the name "fixed" thread pool.  An
 // application can, however, specify the attributes of the threads in the pool
-// (e.g., thread priority or stack size), by providing a
-// 'bslmt::ThreadAttributes' object with the desired values set.  See
+// (e.g., thread priority, stack size, processor affinity, or thread name), by
+// providing a 'bslmt::ThreadAttributes' object with the desired values set.
+// Note that every thread of the pool is created with the same attributes, so
+// a 'cpuAffinity' names the processors shared by all threads.  See
 // 'bslmt_threadutil' package documentation for a description of
 // 'bslmt::ThreadAttributes'.
 //
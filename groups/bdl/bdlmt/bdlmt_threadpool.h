@@ -56,9 +56,11 @@ BSLS_IDENT("$Id: $")
 // should select a value for the minimum number of threads that reflects the
 // expected average load.  A higher value for the maximum number of threads can
 // be used to handle periodic bursts.  An application can also specify the
-// attributes of the threads in the pool (e.g., thread priority or stack size),
-// by providing a 'bslmt::ThreadAttributes' object with the desired values set.
-// See 'bslmt_threadutil' package documentation for a description of
+// attributes of the threads in the pool (e.g., thread priority, stack size,
+// processor affinity, or thread name), by providing a
+// 'bslmt::ThreadAttributes' object with the desired values set.  Note that
+// every thread of the pool is created with the same attributes.  See
+// 'bslmt_threadutil' package documentation for a description of
 // 'bslmt::ThreadAttributes'.
 //
 // Thread pools are ideal for developing multi-threaded server applications.  A
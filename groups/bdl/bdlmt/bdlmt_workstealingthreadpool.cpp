@@ -0,0 +1,487 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlb_random.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_deque.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigfillset
+#endif
+
+///Implementation Notes
+///--------------------
+// Every worker owns a 'bsl::deque' of jobs protected by its own mutex.  The
+// owner pushes and pops at the back of its deque, and thieves pop at the
+// front, so that the owner and a thief contend only when the deque is almost
+// empty.  Each worker also publishes the size of its deque in an atomic
+// counter ('d_numJobs') so that thieves can skip empty victims without
+// acquiring their mutex.
+//
+// The pool keeps two counters shared by all threads:
+//
+//: 'd_numPendingJobs': the number of jobs that have been (or are being)
+//:     enqueued, but have not yet been taken by a worker.  'enqueueJob'
+//:     increments this counter *before* checking whether queuing is enabled,
+//:     and backs the increment out if it is not.  Since 'drain' disables
+//:     queuing before it waits for this counter to reach 0, a job is either
+//:     rejected or processed before 'drain' returns.
+//:
+//: 'd_numActiveJobs': the number of jobs currently executing.  A worker
+//:     increments this counter *before* decrementing 'd_numPendingJobs', so
+//:     that the two counters are never both observed to be 0 while a job is
+//:     in flight.
+//
+// A worker that finds no job goes to sleep on 'd_jobCond' after incrementing
+// 'd_numSleeping' and re-checking 'd_numPendingJobs' under 'd_mutex'.  An
+// enqueuing thread increments 'd_numPendingJobs' before loading
+// 'd_numSleeping', and signals 'd_jobCond' (under 'd_mutex') only if a worker
+// may be asleep.  Since both sides first write their own counter and then
+// read the other's (all operations being sequentially consistent), either the
+// worker observes the pending job and does not sleep, or the enqueuing thread
+// observes the sleeping worker and wakes it up.  Likewise, the thread that
+// brings both counters to 0 broadcasts 'd_drainCond' (under 'd_mutex') to
+// release any thread blocked in 'drain'.
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                    // ===================================
+                    // struct WorkStealingThreadPool_Worker
+                    // ===================================
+
+struct WorkStealingThreadPool_Worker {
+    // This 'struct' holds the state of a single processing thread of a
+    // 'WorkStealingThreadPool': its queue of jobs and the mutex protecting
+    // it.
+
+    // TYPES
+    typedef WorkStealingThreadPool::Job Job;
+
+    // DATA
+    bslmt::Mutex              d_mutex;    // protects 'd_jobs'
+
+    bsl::deque<Job>           d_jobs;     // jobs queued on this worker
+
+    bsls::AtomicInt           d_numJobs;  // snapshot of 'd_jobs.size()'
+
+    bslmt::ThreadUtil::Handle d_handle;   // handle of the processing thread
+
+    int                       d_seed;     // seed used to select victims
+
+    // CREATORS
+    WorkStealingThreadPool_Worker(int index, bslma::Allocator *allocator);
+        // Create a worker having the specified 'index' in its pool, using the
+        // specified 'allocator' to supply memory.
+};
+
+                    // -----------------------------------
+                    // struct WorkStealingThreadPool_Worker
+                    // -----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Worker::WorkStealingThreadPool_Worker(
+                                                int               index,
+                                                bslma::Allocator *allocator)
+: d_jobs(allocator)
+, d_numJobs(0)
+, d_handle(bslmt::ThreadUtil::invalidHandle())
+, d_seed(index + 1)
+{
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::clearQueues()
+{
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        Worker          *worker = d_workers[i];
+        bsl::deque<Job>  discarded(d_allocator_p);
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&worker->d_mutex);
+            discarded.swap(worker->d_jobs);
+            worker->d_numJobs = 0;
+        }
+
+        // The discarded jobs are destroyed outside of the lock, since they
+        // may have objects bound with non-trivial destructors.
+
+        if (!discarded.empty()) {
+            const int numDiscarded = static_cast<int>(discarded.size());
+            if (0 == d_numPendingJobs.add(-numDiscarded)
+             && 0 == d_numActiveJobs) {
+                jobDone();
+            }
+        }
+    }
+}
+
+void WorkStealingThreadPool::jobDone()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_drainCond.broadcast();
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void WorkStealingThreadPool::initBlockSet()
+{
+    sigfillset(&d_blockSet);
+
+    static const int synchronousSignals[] = {
+        SIGBUS,
+        SIGFPE,
+        SIGILL,
+        SIGSEGV,
+        SIGSYS,
+        SIGABRT,
+        SIGTRAP,
+    #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+        SIGIOT
+    #endif
+    };
+    static const int SIZE =
+                        sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(&d_blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+bool WorkStealingThreadPool::popJob(Job *job, Worker *self)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&self->d_mutex);
+        if (!self->d_jobs.empty()) {
+            job->swap(self->d_jobs.back());
+            self->d_jobs.pop_back();
+            self->d_numJobs = static_cast<int>(self->d_jobs.size());
+            return true;                                              // RETURN
+        }
+    }
+
+    const int numWorkers = static_cast<int>(d_workers.size());
+    const int start      = bdlb::Random::generate15(&self->d_seed)
+                                                                  % numWorkers;
+
+    for (int i = 0; i < numWorkers; ++i) {
+        Worker *victim = d_workers[(start + i) % numWorkers];
+
+        if (victim == self || 0 == victim->d_numJobs.loadRelaxed()) {
+            continue;
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&victim->d_mutex);
+        if (!victim->d_jobs.empty()) {
+            job->swap(victim->d_jobs.front());
+            victim->d_jobs.pop_front();
+            victim->d_numJobs = static_cast<int>(victim->d_jobs.size());
+            d_numStolenJobs.addRelaxed(1);
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+int WorkStealingThreadPool::startThreads()
+{
+    BSLS_ASSERT(0 == d_numThreadsStarted);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals in the processing threads, which inherit
+    // the signal mask of the creating thread.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = 0;
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        rc = bslmt::ThreadUtil::create(
+                           &d_workers[i]->d_handle,
+                           d_threadAttributes,
+                           bdlf::BindUtil::bind(
+                                         &WorkStealingThreadPool::workerThread,
+                                         this,
+                                         d_workers[i]));
+        if (0 != rc) {
+            break;
+        }
+        ++d_numThreadsStarted;
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_sigmask(SIG_SETMASK, &oldset, 0);
+#endif
+
+    if (0 != rc) {
+        stopThreads();
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_stopThreads = true;
+        d_jobCond.broadcast();
+    }
+
+    for (int i = 0; i < d_numThreadsStarted; ++i) {
+        bslmt::ThreadUtil::join(d_workers[i]->d_handle);
+        d_workers[i]->d_handle = bslmt::ThreadUtil::invalidHandle();
+    }
+    d_numThreadsStarted = 0;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_stopThreads = false;
+}
+
+void WorkStealingThreadPool::waitForDrain()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    while (0 != d_numPendingJobs || 0 != d_numActiveJobs) {
+        d_drainCond.wait(&d_mutex);
+    }
+}
+
+void WorkStealingThreadPool::workerThread(Worker *self)
+{
+    bslmt::ThreadUtil::setSpecific(d_workerKey, self);
+
+    Job job;
+    while (1) {
+        if (popJob(&job, self)) {
+            d_numActiveJobs.add(1);
+            d_numPendingJobs.add(-1);
+
+            job();
+
+            // The job is cleared before the counters are updated, since it
+            // might have objects bound with non-trivial destructors that must
+            // be destroyed before 'drain' returns.
+
+            job = Job();
+
+            if (0 == d_numActiveJobs.add(-1) && 0 == d_numPendingJobs) {
+                jobDone();
+            }
+            continue;
+        }
+
+        if (0 != d_numPendingJobs) {
+            // A job is being enqueued, or is held by a worker that has not yet
+            // accounted for it: try again.
+
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        if (d_stopThreads) {
+            break;
+        }
+        d_numSleeping.add(1);
+        if (0 == d_numPendingJobs) {
+            d_jobCond.wait(&d_mutex);
+        }
+        d_numSleeping.add(-1);
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_threadAttributes(threadAttributes)
+, d_state(e_DISABLED)
+, d_numPendingJobs(0)
+, d_numActiveJobs(0)
+, d_numSleeping(0)
+, d_nextWorker(0)
+, d_numStolenJobs(0)
+, d_stopThreads(false)
+, d_numThreadsStarted(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    // The processing threads are joined by 'stop' and 'shutdown'.
+
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet();
+#endif
+
+    d_workers.reserve(numThreads);
+    BSLS_TRY {
+        for (int i = 0; i < numThreads; ++i) {
+            d_workers.push_back(new (*d_allocator_p) Worker(i,
+                                                            d_allocator_p));
+        }
+    }
+    BSLS_CATCH(...) {
+        for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+            d_allocator_p->deleteObjectRaw(d_workers[i]);
+        }
+        BSLS_RETHROW;
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT(0 == rc);  (void)rc;
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        d_allocator_p->deleteObjectRaw(d_workers[i]);
+    }
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    d_state.testAndSwap(e_ENABLED, e_DISABLED);
+    waitForDrain();
+}
+
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    if (!functor) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    Worker *self = static_cast<Worker *>(
+                                 bslmt::ThreadUtil::getSpecific(d_workerKey));
+
+    // Reserve the job *before* checking the state (see the implementation
+    // notes).
+
+    d_numPendingJobs.add(1);
+
+    const int state = d_state;
+    if (e_ENABLED != state && (e_DISABLED != state || 0 == self)) {
+        if (0 == d_numPendingJobs.add(-1) && 0 == d_numActiveJobs) {
+            jobDone();
+        }
+        return -1;                                                    // RETURN
+    }
+
+    Worker *worker = self;
+    if (!worker) {
+        const unsigned int next = static_cast<unsigned int>(
+                                                         d_nextWorker.add(1));
+        worker = d_workers[next % d_workers.size()];
+    }
+
+    BSLS_TRY {
+        bslmt::LockGuard<bslmt::Mutex> guard(&worker->d_mutex);
+        worker->d_jobs.push_back(functor);
+        worker->d_numJobs = static_cast<int>(worker->d_jobs.size());
+    }
+    BSLS_CATCH(...) {
+        if (0 == d_numPendingJobs.add(-1) && 0 == d_numActiveJobs) {
+            jobDone();
+        }
+        BSLS_RETHROW;
+    }
+
+    if (0 != d_numSleeping) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_jobCond.signal();
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    d_state = e_SHUTDOWN;
+    clearQueues();
+    stopThreads();
+
+    // Jobs that were executing when the state changed might have enqueued
+    // further jobs before the threads were joined.
+
+    clearQueues();
+    d_state = e_DISABLED;
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    if (0 == d_numThreadsStarted && 0 != startThreads()) {
+        return -1;                                                    // RETURN
+    }
+    d_state = e_ENABLED;
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    d_state.testAndSwap(e_ENABLED, e_DISABLED);
+    waitForDrain();
+    stopThreads();
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+    return d_numThreadsStarted;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
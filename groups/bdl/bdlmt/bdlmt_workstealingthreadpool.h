@@ -0,0 +1,513 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads using work stealing.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size pool of work-stealing threads
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-supplied functions
+// ("jobs") on a fixed number of processing threads.  The interface mirrors
+// that of 'bdlmt::ThreadPool' ('enqueueJob', 'drain', 'stop', 'shutdown'),
+// but the implementation does not funnel every job through a single shared
+// queue.  Instead, each processing thread ("worker") owns its own double-ended
+// queue of jobs, protected by its own mutex:
+//
+//: o A job enqueued by a thread that is *not* a worker of the pool is
+//:   distributed, in round-robin order, to the back of one of the worker
+//:   queues.
+//:
+//: o A job enqueued from *within* a job running on a worker of the pool is
+//:   pushed onto the back of that worker's own queue, so that work generated
+//:   by a job stays local to the thread (and the caches) that produced it.
+//:
+//: o A worker takes jobs from the back of its own queue (last-in, first-out).
+//:
+//: o A worker whose own queue is empty attempts to "steal" a job from the
+//:   front of the queue of another worker, visiting the other workers in an
+//:   order that begins at a randomly chosen victim.
+//:
+//: o A worker that finds no job anywhere in the pool goes to sleep until a
+//:   new job is enqueued.
+//
+// Since enqueuing and dequeuing threads contend only on the mutex of a single
+// worker queue, rather than on one mutex for the whole pool, throughput
+// scales with the number of workers for workloads consisting of many short
+// jobs, and in particular for "fan-out" workloads where jobs enqueue further
+// jobs.
+//
+// Note that, unlike 'bdlmt::ThreadPool', the number of processing threads is
+// fixed at construction, and no ordering is guaranteed between jobs (even
+// between jobs enqueued by the same thread), since any job may be stolen by
+// any worker.
+//
+///Draining and Stopping
+///---------------------
+// 'drain' disables queuing of jobs from threads that are not workers of the
+// pool, and blocks until all pending jobs have completed.  Jobs enqueued by
+// jobs that run while the pool is draining are still accepted (and are
+// executed before 'drain' returns), so that a tree of jobs started before
+// 'drain' is called is completely processed.  'start' re-enables queuing
+// after a call to 'drain'.  'stop' drains the pool and then joins all
+// processing threads, whereas 'shutdown' discards all pending jobs and joins
+// the processing threads once the currently executing jobs complete.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.  Note that 'start',
+// 'drain', 'stop', and 'shutdown' must not be invoked from a job executing on
+// a worker of the pool.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with 'bdlmt::ThreadPool', on Unix platforms all the threads in the pool
+// block all asynchronous signals, that is all signals except SIGBUS, SIGFPE,
+// SIGILL, SIGSEGV, SIGSYS, SIGABRT, SIGTRAP, and SIGIOT.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Fan-Out
+///- - - - - - - - - - - - - -
+// In this example we sum the elements of a large array by recursively
+// splitting the range into halves, each half being processed by a separate
+// job.  Since the sub-jobs are enqueued from within a job, they are placed on
+// the queue of the worker executing the parent job, and are redistributed to
+// other workers only if those workers run out of work.
+//
+// First, we define the function implementing a job, which either sums a
+// small range directly, or splits the range and enqueues two new jobs:
+//..
+//  void sumRange(bdlmt::WorkStealingThreadPool *pool,
+//                const int                     *begin,
+//                const int                     *end,
+//                bsls::AtomicInt64             *result)
+//  {
+//      enum { k_GRAIN_SIZE = 1024 };
+//
+//      if (end - begin <= k_GRAIN_SIZE) {
+//          bsls::Types::Int64 sum = 0;
+//          for (const int *p = begin; p != end; ++p) {
+//              sum += *p;
+//          }
+//          result->add(sum);
+//          return;                                                   // RETURN
+//      }
+//
+//      const int *middle = begin + (end - begin) / 2;
+//      pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                            pool,
+//                                            begin,
+//                                            middle,
+//                                            result));
+//      pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                            pool,
+//                                            middle,
+//                                            end,
+//                                            result));
+//  }
+//..
+// Then, we create and start a pool having four worker threads:
+//..
+//  bslmt::ThreadAttributes       attributes;
+//  bdlmt::WorkStealingThreadPool pool(attributes, 4);
+//
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create the data to be summed:
+//..
+//  bsl::vector<int> data(100000);
+//  for (bsl::size_t i = 0; i < data.size(); ++i) {
+//      data[i] = static_cast<int>(i % 10);
+//  }
+//..
+// Then, we enqueue the root job:
+//..
+//  bsls::AtomicInt64 result(0);
+//
+//  rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                            &pool,
+//                                            data.data(),
+//                                            data.data() + data.size(),
+//                                            &result));
+//  assert(0 == rc);
+//..
+// Finally, we wait for the whole tree of jobs to complete, and verify the
+// result.  Note that 'drain' does not return until all the jobs enqueued by
+// the root job (and their descendants) have completed:
+//..
+//  pool.drain();
+//  assert(450000 == result);
+//
+//  pool.stop();
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLF_BIND
+#include <bdlf_bind.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADATTRIBUTES
+#include <bslmt_threadattributes.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    #ifndef INCLUDED_BSL_CSIGNAL
+    #include <bsl_csignal.h>              // sigfillset
+    #endif
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+struct WorkStealingThreadPool_Worker;
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a fixed-size thread pool in which each processing
+    // thread owns a queue of jobs, and idle processing threads steal jobs from
+    // the queues of busy processing threads.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    enum {
+        e_DISABLED   = 0,  // only jobs enqueued by workers are accepted
+        e_ENABLED    = 1,  // all jobs are accepted
+        e_SHUTDOWN   = 2   // no job is accepted
+    };
+
+    // DATA
+    bsl::vector<Worker *>    d_workers;          // per-thread job queues
+                                                 // (owned)
+
+    bslmt::ThreadAttributes  d_threadAttributes; // attributes used to create
+                                                 // the processing threads
+
+    bslmt::ThreadUtil::Key   d_workerKey;        // thread-specific key
+                                                 // identifying the 'Worker'
+                                                 // of the calling thread
+
+    bsls::AtomicInt          d_state;            // one of 'e_DISABLED',
+                                                 // 'e_ENABLED', 'e_SHUTDOWN'
+
+    bsls::AtomicInt          d_numPendingJobs;   // number of jobs enqueued
+                                                 // (or being enqueued) but
+                                                 // not yet started
+
+    bsls::AtomicInt          d_numActiveJobs;    // number of jobs currently
+                                                 // executing
+
+    bsls::AtomicInt          d_numSleeping;      // number of workers waiting
+                                                 // on 'd_jobCond'
+
+    bsls::AtomicInt          d_nextWorker;       // round-robin index used to
+                                                 // distribute external jobs
+
+    bsls::AtomicInt64        d_numStolenJobs;    // number of jobs executed by
+                                                 // a worker other than the
+                                                 // one they were queued on
+
+    bool                     d_stopThreads;      // 'true' if the processing
+                                                 // threads must exit when no
+                                                 // job is available (guarded
+                                                 // by 'd_mutex')
+
+    int                      d_numThreadsStarted;
+                                                 // number of processing
+                                                 // threads currently running
+                                                 // (guarded by 'd_metaMutex')
+
+    bslmt::Mutex             d_mutex;            // guards 'd_stopThreads' and
+                                                 // sleeping workers
+
+    bslmt::Condition         d_jobCond;          // signaled when a job is
+                                                 // enqueued, or the threads
+                                                 // are to be stopped
+
+    bslmt::Condition         d_drainCond;        // signaled when no job is
+                                                 // pending or active
+
+    mutable bslmt::Mutex     d_metaMutex;        // serializes 'start',
+                                                 // 'drain', 'stop', and
+                                                 // 'shutdown'
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                 d_blockSet;         // set of signals to be
+                                                 // blocked in managed threads
+#endif
+
+    bslma::Allocator        *d_allocator_p;      // memory allocator (held,
+                                                 // not owned)
+
+    // FRIENDS
+    friend struct WorkStealingThreadPool_Worker;
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+    // PRIVATE MANIPULATORS
+    void clearQueues();
+        // Discard all the jobs in the queues of the workers of this pool.
+
+    void jobDone();
+        // Signal any thread waiting in 'drain' if no job is pending nor
+        // active.
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    void initBlockSet();
+        // Initialize the the set of signals to be blocked in the managed
+        // threads.
+#endif
+
+    bool popJob(Job *job, Worker *self);
+        // Load into the specified 'job' a job taken from the back of the queue
+        // of the specified 'self' worker or, if that queue is empty, stolen
+        // from the front of the queue of another worker.  Return 'true' if a
+        // job was loaded, and 'false' otherwise.
+
+    int startThreads();
+        // Start one processing thread per worker.  Return 0 on success, and a
+        // non-zero value otherwise, in which case no thread is left running.
+        // The behavior is undefined unless 'd_metaMutex' is locked and no
+        // processing thread is running.
+
+    void stopThreads();
+        // Signal all processing threads to exit once no job is available, and
+        // join them.  The behavior is undefined unless 'd_metaMutex' is
+        // locked.
+
+    void waitForDrain();
+        // Block until no job is pending nor active.
+
+    void workerThread(Worker *self);
+        // Run the job-processing loop of the specified 'self' worker.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Create a thread pool that executes jobs on the specified
+        // 'numThreads' processing threads, each created using the specified
+        // 'threadAttributes'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The newly created pool does not accept
+        // jobs until 'start' is called.  The behavior is undefined unless
+        // '1 <= numThreads'.  Note that the detached state of
+        // 'threadAttributes' is ignored: the processing threads are always
+        // joinable.
+
+    ~WorkStealingThreadPool();
+        // Call 'shutdown' and destroy this thread pool.
+
+    // MANIPULATORS
+    void drain();
+        // Disable queuing of jobs from threads that are not processing threads
+        // of this pool, and wait until all pending jobs (including the jobs
+        // enqueued by those jobs) have completed.  Use 'start' to re-enable
+        // queuing.
+
+    int enqueueJob(const Job& functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread of this pool.  If this method is called from a processing
+        // thread of this pool, 'functor' is placed on the queue of the calling
+        // thread; otherwise it is placed on the queue of one of the processing
+        // threads selected in round-robin order.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+        // The behavior is undefined unless 'functor' is not "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a processing
+        // thread of this pool.  The specified 'userData' pointer will be
+        // passed to the function by the processing thread.  Return 0 if
+        // enqueued successfully, and a non-zero value if queuing is currently
+        // disabled.
+
+    void shutdown();
+        // Disable queuing on this thread pool, discard all pending jobs, and
+        // shut down all processing threads after the active jobs complete.
+
+    int start();
+        // Enable queuing on this thread pool and, if they are not already
+        // running, spawn 'numThreads()' processing threads.  Return 0 on
+        // success, and a non-zero value otherwise.  If the processing threads
+        // could not all be started, no processing thread is left running and
+        // queuing remains disabled.
+
+    void stop();
+        // Disable queuing on this thread pool, wait until all pending jobs
+        // complete, then shut down all processing threads.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if this pool accepts jobs from threads that are not
+        // processing threads of this pool, and 'false' otherwise.
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of processing threads that are
+        // currently executing a job.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs that are currently queued,
+        // but not yet being processed.
+
+    bsls::Types::Int64 numStolenJobs() const;
+        // Return the number of jobs that were executed by a processing thread
+        // other than the one on whose queue they were placed.
+
+    int numThreads() const;
+        // Return the number of processing threads of this pool.
+
+    int numThreadsStarted() const;
+        // Return the number of processing threads that are currently running.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return e_ENABLED == d_state.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveJobs.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    const int numPending = d_numPendingJobs.loadRelaxed();
+    return numPending < 0 ? 0 : numPending;
+}
+
+inline
+bsls::Types::Int64 WorkStealingThreadPool::numStolenJobs() const
+{
+    return d_numStolenJobs.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return static_cast<int>(d_workers.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,846 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_threadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a fixed-size thread pool in which each thread
+// owns a queue of jobs and idle threads steal jobs from busy threads.  We
+// first verify the basic life cycle of the pool ('start', 'drain', 'stop',
+// 'shutdown') and the enabled state governing 'enqueueJob'.  We then verify
+// that jobs enqueued from a processing thread are placed on that thread's
+// queue (and are therefore only executed elsewhere by stealing), that a tree
+// of jobs is fully processed by 'drain', and that 'shutdown' discards pending
+// jobs.  Finally, we stress the pool with concurrent producers.
+//
+// A negative test case compares the throughput of this pool with that of
+// 'bdlmt::ThreadPool' for short jobs.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 2] int start();
+// [ 2] void stop();
+// [ 4] void drain();
+// [ 5] void shutdown();
+// [ 2] int enqueueJob(const Job& functor);
+// [ 2] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+//
+// ACCESSORS
+// [ 2] bool isEnabled() const;
+// [ 5] int numActiveThreads() const;
+// [ 5] int numPendingJobs() const;
+// [ 3] bsls::Types::Int64 numStolenJobs() const;
+// [ 2] int numThreads() const;
+// [ 2] int numThreadsStarted() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: jobs enqueued by a job stay on the local queue
+// [ 6] CONCERN: concurrent producers
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: comparison with 'bdlmt::ThreadPool'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void incrementCounter(bsls::AtomicInt *counter)
+{
+    ++*counter;
+}
+
+extern "C" void incrementCounterC(void *counter)
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitOnSemaphore(bslmt::Semaphore *start, bslmt::Semaphore *finish)
+{
+    start->post();
+    finish->wait();
+}
+
+void recordThread(bslmt::Mutex                  *mutex,
+                  bsl::set<bsls::Types::Uint64> *threads)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+    threads->insert(bslmt::ThreadUtil::selfIdAsUint64());
+}
+
+void spawnLocalJobs(Obj             *pool,
+                    int              numJobs,
+                    bsls::AtomicInt *counter,
+                    bsls::AtomicInt *numRejected)
+    // Enqueue the specified 'numJobs' jobs incrementing the specified
+    // 'counter' on the specified 'pool', then block until all of them have
+    // been executed, so that they can only be executed by stealing.  Increment
+    // the specified 'numRejected' for every job that could not be enqueued.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        if (0 != pool->enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                       counter))) {
+            ++*numRejected;
+        }
+    }
+    while (*counter + *numRejected < numJobs) {
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+void fanOut(Obj *pool, int depth, bsls::AtomicInt *numLeaves)
+    // Enqueue two jobs recursively calling this function with one less than
+    // the specified 'depth' on the specified 'pool', or increment the
+    // specified 'numLeaves' if 'depth' is 0.
+{
+    if (0 == depth) {
+        ++*numLeaves;
+        return;                                                       // RETURN
+    }
+    ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                      pool,
+                                                      depth - 1,
+                                                      numLeaves)));
+    ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                      pool,
+                                                      depth - 1,
+                                                      numLeaves)));
+}
+
+void produce(Obj *pool, int numJobs, bsls::AtomicInt *counter)
+{
+    for (int i = 0; i < numJobs; ++i) {
+        ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                          counter)));
+    }
+}
+
+void shortJob(bsls::AtomicInt *counter)
+    // Perform a small amount of work, then increment the specified 'counter'.
+{
+    volatile int sum = 0;
+    for (int i = 0; i < 100; ++i) {
+        sum += i;
+    }
+    ++*counter;
+}
+
+template <class POOL>
+void fanOutGeneric(POOL *pool, int depth, bsls::AtomicInt *numLeaves)
+{
+    if (0 == depth) {
+        shortJob(numLeaves);
+        return;                                                       // RETURN
+    }
+    pool->enqueueJob(bdlf::BindUtil::bind(&fanOutGeneric<POOL>,
+                                          pool,
+                                          depth - 1,
+                                          numLeaves));
+    pool->enqueueJob(bdlf::BindUtil::bind(&fanOutGeneric<POOL>,
+                                          pool,
+                                          depth - 1,
+                                          numLeaves));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Fan-Out
+///- - - - - - - - - - - - - -
+// In this example we sum the elements of a large array by recursively
+// splitting the range into halves, each half being processed by a separate
+// job.  Since the sub-jobs are enqueued from within a job, they are placed on
+// the queue of the worker executing the parent job, and are redistributed to
+// other workers only if those workers run out of work.
+//
+// First, we define the function implementing a job, which either sums a
+// small range directly, or splits the range and enqueues two new jobs:
+//..
+    void sumRange(bdlmt::WorkStealingThreadPool *pool,
+                  const int                     *begin,
+                  const int                     *end,
+                  bsls::AtomicInt64             *result)
+    {
+        enum { k_GRAIN_SIZE = 1024 };
+
+        if (end - begin <= k_GRAIN_SIZE) {
+            bsls::Types::Int64 sum = 0;
+            for (const int *p = begin; p != end; ++p) {
+                sum += *p;
+            }
+            result->add(sum);
+            return;                                                   // RETURN
+        }
+
+        const int *middle = begin + (end - begin) / 2;
+        pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                              pool,
+                                              begin,
+                                              middle,
+                                              result));
+        pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                              pool,
+                                              middle,
+                                              end,
+                                              result));
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator(veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we create and start a pool having four worker threads:
+//..
+    bslmt::ThreadAttributes       attributes;
+    bdlmt::WorkStealingThreadPool pool(attributes, 4);
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we create the data to be summed:
+//..
+    bsl::vector<int> data(100000);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(i % 10);
+    }
+//..
+// Then, we enqueue the root job:
+//..
+    bsls::AtomicInt64 result(0);
+
+    rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                              &pool,
+                                              data.data(),
+                                              data.data() + data.size(),
+                                              &result));
+    ASSERT(0 == rc);
+//..
+// Finally, we wait for the whole tree of jobs to complete, and verify the
+// result.  Note that 'drain' does not return until all the jobs enqueued by
+// the root job (and their descendants) have completed:
+//..
+    pool.drain();
+    ASSERT(450000 == result);
+
+    pool.stop();
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT PRODUCERS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued concurrently by several external threads are all
+        //:   executed exactly once.
+        //:
+        //: 2 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For a varying number of processing and producing threads, have
+        //:   each producer enqueue a large number of jobs incrementing a
+        //:   shared counter, join the producers, drain the pool, and verify
+        //:   the counter.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: concurrent producers
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT PRODUCERS" << endl
+                          << "=============================" << endl;
+
+        const int k_NUM_JOBS = 10000;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            for (int numProducers = 1; numProducers <= 4; ++numProducers) {
+                if (veryVerbose) { T_ P_(numThreads) P(numProducers) }
+
+                bsls::AtomicInt counter(0);
+                {
+                    Obj mX(bslmt::ThreadAttributes(), numThreads, &ta);
+                    ASSERT(0 == mX.start());
+
+                    bslmt::ThreadGroup producers(&ta);
+                    producers.addThreads(bdlf::BindUtil::bind(&produce,
+                                                              &mX,
+                                                              k_NUM_JOBS,
+                                                              &counter),
+                                         numProducers);
+                    producers.joinAll();
+
+                    mX.drain();
+                    LOOP2_ASSERT(numThreads,
+                                 numProducers,
+                                 k_NUM_JOBS * numProducers == counter);
+                    ASSERT(0 == mX.numPendingJobs());
+                    ASSERT(0 == mX.numActiveThreads());
+                }
+                ASSERT(0 == ta.numBytesInUse());
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'shutdown'
+        //
+        // Concerns:
+        //: 1 'shutdown' discards pending jobs and waits for active jobs.
+        //:
+        //: 2 'numPendingJobs' and 'numActiveThreads' reflect the jobs queued
+        //:   and executing.
+        //:
+        //: 3 The pool can be restarted after 'shutdown'.
+        //
+        // Plan:
+        //: 1 Block the only processing thread of a pool in a job, enqueue
+        //:   further jobs, and verify the accessors.  Call 'shutdown' from
+        //:   another thread, release the blocked job, and verify that the
+        //:   pending jobs were not executed.  (C-1..2)
+        //:
+        //: 2 Restart the pool and verify that jobs are executed.  (C-3)
+        //
+        // Testing:
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'shutdown'" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, &ta);
+            ASSERT(0 == mX.start());
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore finish;
+            bsls::AtomicInt  counter(0);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOnSemaphore,
+                                                           &started,
+                                                           &finish)));
+            started.wait();
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                            bdlf::BindUtil::bind(&incrementCounter, &counter)));
+            }
+            ASSERT(1  == mX.numActiveThreads());
+            ASSERT(10 == mX.numPendingJobs());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                         &handle,
+                                         bdlf::BindUtil::bind(&Obj::shutdown,
+                                                              &mX)));
+            while (mX.isEnabled() || 0 != mX.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+            ASSERT(0 != mX.enqueueJob(
+                            bdlf::BindUtil::bind(&incrementCounter, &counter)));
+            finish.post();
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(0 == counter);
+            ASSERT(0 == mX.numThreadsStarted());
+            ASSERT(0 == mX.numActiveThreads());
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.enqueueJob(
+                            bdlf::BindUtil::bind(&incrementCounter, &counter)));
+            mX.stop();
+            ASSERT(1 == counter);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'drain'
+        //
+        // Concerns:
+        //: 1 'drain' waits for all pending jobs, including the jobs enqueued
+        //:   by jobs while the pool is draining.
+        //:
+        //: 2 'drain' disables queuing from external threads, and 'start'
+        //:   re-enables it without restarting the processing threads.
+        //
+        // Plan:
+        //: 1 Enqueue a job recursively enqueuing a binary tree of jobs, drain
+        //:   the pool, and verify that all the leaves have been executed.
+        //:   (C-1)
+        //:
+        //: 2 Verify that 'enqueueJob' fails after 'drain', and succeeds after
+        //:   'start'.  (C-2)
+        //
+        // Testing:
+        //   void drain();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'drain'" << endl
+                          << "===============" << endl;
+
+        const int k_DEPTH = 12;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            if (veryVerbose) { T_ P(numThreads) }
+
+            Obj mX(bslmt::ThreadAttributes(), numThreads, &ta);
+            ASSERT(0 == mX.start());
+
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                bsls::AtomicInt numLeaves(0);
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                               &mX,
+                                                               k_DEPTH,
+                                                               &numLeaves)));
+                mX.drain();
+                LOOP2_ASSERT(numThreads,
+                             numLeaves,
+                             (1 << k_DEPTH) == numLeaves);
+                ASSERT(false == mX.isEnabled());
+                ASSERT(0     != mX.enqueueJob(
+                                    bdlf::BindUtil::bind(&incrementCounter,
+                                                         &numLeaves)));
+                ASSERT(numThreads == mX.numThreadsStarted());
+
+                ASSERT(0 == mX.start());
+                ASSERT(true == mX.isEnabled());
+                ASSERT(numThreads == mX.numThreadsStarted());
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: JOBS ENQUEUED BY A JOB STAY LOCAL
+        //
+        // Concerns:
+        //: 1 A job enqueued from a processing thread is placed on the queue of
+        //:   that thread.
+        //:
+        //: 2 Jobs on the queue of a busy thread are stolen by idle threads.
+        //
+        // Plan:
+        //: 1 Enqueue a job that enqueues N further jobs and then blocks until
+        //:   all of them have been executed.  Since the thread of the parent
+        //:   job is blocked, the N jobs can only be executed by being stolen;
+        //:   verify that exactly N jobs were stolen, which implies that all of
+        //:   them were placed on the queue of the parent job's thread.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that jobs are executed on several distinct threads.
+        //
+        // Testing:
+        //   bsls::Types::Int64 numStolenJobs() const;
+        //   CONCERN: jobs enqueued by a job stay on the local queue
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: JOBS ENQUEUED BY A JOB STAY LOCAL"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        const int k_NUM_JOBS = 1000;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(bslmt::ThreadAttributes(), 4, &ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            bsls::AtomicInt numRejected(0);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&spawnLocalJobs,
+                                                           &mX,
+                                                           k_NUM_JOBS,
+                                                           &counter,
+                                                           &numRejected)));
+            mX.drain();
+
+            ASSERT(0          == numRejected);
+            ASSERT(k_NUM_JOBS == counter);
+            ASSERTV(mX.numStolenJobs(), k_NUM_JOBS == mX.numStolenJobs());
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Mutex                        mutex;
+            bsl::set<bsls::Types::Uint64>       threads;
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&recordThread,
+                                                               &mutex,
+                                                               &threads)));
+            }
+            mX.stop();
+            ASSERT(1 <= threads.size());
+            ASSERT(4 >= threads.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'start', 'stop', AND 'enqueueJob'
+        //
+        // Concerns:
+        //: 1 A newly created pool has no thread running and rejects jobs.
+        //:
+        //: 2 'start' creates 'numThreads()' threads and enables queuing.
+        //:
+        //: 3 Both overloads of 'enqueueJob' enqueue jobs that are executed.
+        //:
+        //: 4 'stop' executes all pending jobs, joins the threads, and disables
+        //:   queuing.
+        //:
+        //: 5 The pool can be restarted after 'stop'.
+        //:
+        //: 6 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 For a range of thread counts, create a pool, verify the initial
+        //:   state, start the pool, enqueue jobs with both overloads, stop
+        //:   the pool, and verify the counter of executed jobs.  Repeat a few
+        //:   times on the same object.  (C-1..6)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   ~WorkStealingThreadPool();
+        //   int start();
+        //   void stop();
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   bool isEnabled() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'start', 'stop', AND 'enqueueJob'"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        const int k_NUM_JOBS = 1000;
+
+        for (int numThreads = 1; numThreads <= 8; ++numThreads) {
+            if (veryVerbose) { T_ P(numThreads) }
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+            {
+                Obj mX(bslmt::ThreadAttributes(), numThreads, &ta);
+                const Obj& X = mX;
+
+                ASSERT(numThreads == X.numThreads());
+                ASSERT(0          == X.numThreadsStarted());
+                ASSERT(false      == X.isEnabled());
+
+                bsls::AtomicInt counter(0);
+                ASSERT(0 != mX.enqueueJob(&incrementCounterC, &counter));
+
+                for (int iteration = 0; iteration < 3; ++iteration) {
+                    ASSERT(0          == mX.start());
+                    ASSERT(numThreads == X.numThreadsStarted());
+                    ASSERT(true       == X.isEnabled());
+
+                    for (int i = 0; i < k_NUM_JOBS; ++i) {
+                        if (i % 2) {
+                            ASSERT(0 == mX.enqueueJob(&incrementCounterC,
+                                                      &counter));
+                        }
+                        else {
+                            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &incrementCounter,
+                                                          &counter)));
+                        }
+                    }
+                    mX.stop();
+
+                    LOOP2_ASSERT(iteration,
+                                 counter,
+                                 (iteration + 1) * k_NUM_JOBS == counter);
+                    ASSERT(0     == X.numThreadsStarted());
+                    ASSERT(false == X.isEnabled());
+                    ASSERT(0     == X.numPendingJobs());
+                    ASSERT(0     != mX.enqueueJob(&incrementCounterC,
+                                                  &counter));
+                }
+                ASSERT(0 < ta.numAllocations());
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, start it, enqueue a few jobs, drain and stop it.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(bslmt::ThreadAttributes(), 2, &ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                            bdlf::BindUtil::bind(&incrementCounter, &counter)));
+            }
+            mX.drain();
+            ASSERT(10 == counter);
+
+            mX.stop();
+            ASSERT(0 == mX.numThreadsStarted());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bdlmt::ThreadPool'
+        //
+        // Concerns:
+        //: 1 For fan-out workloads of short jobs, throughput of this pool
+        //:   scales with the number of threads, and exceeds that of
+        //:   'bdlmt::ThreadPool'.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, time a binary tree of short
+        //:   jobs on both pools and report the elapsed times.
+        //
+        // Testing:
+        //   PERFORMANCE: comparison with 'bdlmt::ThreadPool'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: COMPARISON WITH 'bdlmt::ThreadPool'" << endl
+             << "================================================" << endl;
+
+        const int DEPTH = argc > 2 ? atoi(argv[2]) : 20;
+
+        const int MAX_THREADS = argc > 3 ? atoi(argv[3]) : 16;
+
+        for (int numThreads = 1; numThreads <= MAX_THREADS; numThreads *= 2) {
+            bsls::AtomicInt numLeaves(0);
+
+            bdlmt::ThreadPool tp(bslmt::ThreadAttributes(),
+                                 numThreads,
+                                 numThreads,
+                                 1000);
+            tp.start();
+
+            bsls::Stopwatch timer;
+            timer.start();
+            tp.enqueueJob(bdlf::BindUtil::bind(
+                                        &fanOutGeneric<bdlmt::ThreadPool>,
+                                        &tp,
+                                        DEPTH,
+                                        &numLeaves));
+            while ((1 << DEPTH) != numLeaves) {
+                bslmt::ThreadUtil::microSleep(100);
+            }
+            tp.drain();
+            timer.stop();
+            const double tpTime = timer.elapsedTime();
+            tp.stop();
+
+            numLeaves = 0;
+
+            Obj ws(bslmt::ThreadAttributes(), numThreads);
+            ws.start();
+
+            timer.reset();
+            timer.start();
+            ws.enqueueJob(bdlf::BindUtil::bind(&fanOutGeneric<Obj>,
+                                               &ws,
+                                               DEPTH,
+                                               &numLeaves));
+            ws.drain();
+            timer.stop();
+            const double wsTime = timer.elapsedTime();
+
+            cout << "threads: "            << numThreads
+                 << "\tThreadPool: "       << tpTime
+                 << "s\tWorkStealing: "    << wsTime
+                 << "s\tstolen: "          << ws.numStolenJobs() << endl;
+            ws.stop();
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
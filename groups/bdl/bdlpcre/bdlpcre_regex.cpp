@@ -10,6 +10,27 @@ BSLS_IDENT_RCSID(bdlpcre2_regex_cpp,"$Id$ $CSID$")
 // Expressions (PCRE2) library (http://www.pcre.org).
 //
 // The PCRE2 library used by this component was configured with UTF8 support.
+//
+// JIT compilation is available only if the PCRE2 library was configured with
+// 'SUPPORT_JIT' (which requires the 'sljit' sources of the PCRE2
+// distribution).  Otherwise, 'pcre2_jit_compile' is a stub that always fails,
+// and 'prepare' falls back to the interpreter.  Note that 'pcre2_match' runs
+// the JIT-compiled code of a pattern, when present, by itself.
+//
+// The compiled pattern and the match context of a 'RegEx' object are only
+// read by 'pcre2_match', and so can be shared by concurrent calls to 'match'.
+// The match data (and the JIT stack, which is assigned to a match context)
+// are written by 'pcre2_match', and so must be owned by a single call.  Each
+// call therefore acquires a 'MatchDataSlot' from a small array owned by the
+// object: a slot is claimed by atomically swapping its 'd_inUse' flag from 0
+// to 1, and released by storing 0 (with release semantics, so that the next
+// owner of the slot sees the match data allocated by the previous one).  The
+// resources of a slot are allocated lazily, by its first owner.  Since the
+// number of slots is fixed, and slots are never unlinked, this pool is not
+// susceptible to the ABA problem of lock-free free lists.  If all slots are
+// in use, the call allocates a slot of its own.  A slot holding a JIT stack
+// also holds a copy of the match context of the object to which the stack is
+// assigned, and 'setDepthLimit' updates these copies.
 
 #include <bslma_allocator.h>
 #include <bslma_deallocatorproctor.h>
@@ -18,6 +39,7 @@ BSLS_IDENT_RCSID(bdlpcre2_regex_cpp,"$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_exceptionutil.h>
 
+#include <bsl_algorithm.h>  // bsl::min
 #include <bsl_cstring.h>    // bsl::memset
 #include <bsl_string.h>
 #include <bsl_utility.h>    // bsl::pair
@@ -64,6 +86,104 @@ enum {
 };
     // Return values for this API.
 
+                        // ===========================
+                        // class RegEx::MatchDataGuard
+                        // ===========================
+
+class RegEx::MatchDataGuard {
+    // This class implements a guard that acquires, upon construction, a
+    // 'MatchDataSlot' of a regular-expression object for the exclusive use of
+    // the calling thread, and releases it upon destruction.  A free slot of
+    // the pool of the object is used if there is one; otherwise a slot local
+    // to the guard is allocated for the lifetime of the guard.
+
+    // DATA
+    const RegEx   *d_regex_p;    // regular-expression object
+    MatchDataSlot *d_slot_p;     // acquired slot, or 0 if allocation failed
+    MatchDataSlot  d_localSlot;  // slot used if the pool is exhausted
+
+  private:
+    // NOT IMPLEMENTED
+    MatchDataGuard(const MatchDataGuard&);
+    MatchDataGuard& operator=(const MatchDataGuard&);
+
+  public:
+    // CREATORS
+    explicit MatchDataGuard(const RegEx *regex);
+        // Create a guard that acquires a slot of the specified prepared
+        // 'regex' for the calling thread.
+
+    ~MatchDataGuard();
+        // Release the slot acquired by this guard, if any.
+
+    // ACCESSORS
+    const MatchDataSlot *slot() const;
+        // Return the address of the slot acquired by this guard, or 0 if
+        // the pool was exhausted and a slot could not be allocated.
+};
+
+                        // ---------------------------
+                        // class RegEx::MatchDataGuard
+                        // ---------------------------
+
+// CREATORS
+RegEx::MatchDataGuard::MatchDataGuard(const RegEx *regex)
+: d_regex_p(regex)
+, d_slot_p(0)
+{
+    BSLS_ASSERT(regex);
+    BSLS_ASSERT(regex->isPrepared());
+
+    MatchDataSlot *pool = regex->d_matchDataPool;
+
+    for (int i = 0; i < k_MATCH_DATA_POOL_SIZE; ++i) {
+        MatchDataSlot *slot = &pool[i];
+
+        if (0 != bsls::AtomicOperations::getIntRelaxed(&slot->d_inUse)
+         || 0 != bsls::AtomicOperations::testAndSwapIntAcqRel(&slot->d_inUse,
+                                                              0,
+                                                              1)) {
+            continue;                                               // CONTINUE
+        }
+
+        if (0 == slot->d_matchData_p && 0 != regex->initMatchDataSlot(slot)) {
+            bsls::AtomicOperations::setIntRelease(&slot->d_inUse, 0);
+            return;                                                   // RETURN
+        }
+
+        d_slot_p = slot;
+        return;                                                       // RETURN
+    }
+
+    // The pool is exhausted.
+
+    bsls::AtomicOperations::initInt(&d_localSlot.d_inUse, 1);
+    d_localSlot.d_matchData_p    = 0;
+    d_localSlot.d_matchContext_p = 0;
+    d_localSlot.d_jitStack_p     = 0;
+
+    if (0 == regex->initMatchDataSlot(&d_localSlot)) {
+        d_slot_p = &d_localSlot;
+    }
+}
+
+RegEx::MatchDataGuard::~MatchDataGuard()
+{
+    if (&d_localSlot == d_slot_p) {
+        d_regex_p->destroyMatchDataSlot(&d_localSlot);
+    }
+    else if (d_slot_p) {
+        bsls::AtomicOperations::setIntRelease(&d_slot_p->d_inUse, 0);
+    }
+}
+
+// ACCESSORS
+inline
+const RegEx::MatchDataSlot *RegEx::MatchDataGuard::slot() const
+{
+    return d_slot_p;
+}
+
                              // -----------
                              // class RegEx
                              // -----------
@@ -71,11 +191,89 @@ enum {
 // CLASS DATA
 bsls::AtomicOperations::AtomicTypes::Int RegEx::s_depthLimit = {10000000};
 
+// CLASS METHODS
+bool RegEx::isJitAvailable()
+{
+    uint32_t jitAvailable = 0;
+
+    pcre2_config(PCRE2_CONFIG_JIT, &jitAvailable);
+
+    return 0 != jitAvailable;
+}
+
 // PRIVATE ACCESSORS
-int RegEx::privateMatch(const char *subject,
-                        size_t      subjectLength,
-                        size_t      subjectOffset) const
+void RegEx::destroyMatchDataSlot(MatchDataSlot *slot) const
+{
+    BSLS_ASSERT(slot);
+
+    if (slot->d_matchContext_p) {
+        pcre2_match_context_free(slot->d_matchContext_p);
+    }
+    if (slot->d_jitStack_p) {
+        pcre2_jit_stack_free(slot->d_jitStack_p);
+    }
+    if (slot->d_matchData_p) {
+        pcre2_match_data_free(slot->d_matchData_p);
+    }
+
+    slot->d_matchData_p    = 0;
+    slot->d_matchContext_p = 0;
+    slot->d_jitStack_p     = 0;
+}
+
+int RegEx::initMatchDataSlot(MatchDataSlot *slot) const
+{
+    BSLS_ASSERT(slot);
+    BSLS_ASSERT(0 == slot->d_matchData_p);
+    BSLS_ASSERT(isPrepared());
+
+    pcre2_match_data *matchData = pcre2_match_data_create_from_pattern(
+                                                          d_patternCode_p, 0);
+
+    if (0 == matchData) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    pcre2_match_context *matchContext = 0;
+    pcre2_jit_stack     *jitStack     = 0;
+
+    if (0 != d_jitStackSize) {
+        // A JIT stack must not be used by concurrent matches, so each slot
+        // has its own, assigned to its own copy of the match context.
+
+        matchContext = pcre2_match_context_copy(d_matchContext_p);
+        jitStack     = pcre2_jit_stack_create(
+                                   bsl::min<size_t>(32 * 1024, d_jitStackSize),
+                                   d_jitStackSize,
+                                   d_pcre2Context_p);
+
+        if (0 == matchContext || 0 == jitStack) {
+            if (matchContext) {
+                pcre2_match_context_free(matchContext);
+            }
+            if (jitStack) {
+                pcre2_jit_stack_free(jitStack);
+            }
+            pcre2_match_data_free(matchData);
+            return k_FAILURE;                                         // RETURN
+        }
+
+        pcre2_jit_stack_assign(matchContext, 0, jitStack);
+    }
+
+    slot->d_matchData_p    = matchData;
+    slot->d_matchContext_p = matchContext;
+    slot->d_jitStack_p     = jitStack;
+
+    return k_SUCCESS;
+}
+
+int RegEx::privateMatch(const MatchDataSlot *slot,
+                        const char          *subject,
+                        size_t               subjectLength,
+                        size_t               subjectOffset) const
 {
+    BSLS_ASSERT(slot);
     BSLS_ASSERT(subject || 0 == subjectLength);
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
@@ -90,10 +288,13 @@ int RegEx::privateMatch(const char *subject,
                                   subjectLength,
                                   subjectOffset,
                                   0,
-                                  d_matchData_p,
-                                  d_matchContext_p);
+                                  slot->d_matchData_p,
+                                  slot->d_matchContext_p
+                                  ? slot->d_matchContext_p
+                                  : d_matchContext_p);
 
-    if (PCRE2_ERROR_MATCHLIMIT == returnValue) {
+    if (PCRE2_ERROR_MATCHLIMIT == returnValue
+     || PCRE2_ERROR_JIT_STACKLIMIT == returnValue) {
         result = k_DEPTHLIMITFAILURE;
     } else if (0 > returnValue) {
         result = k_FAILURE;
@@ -110,7 +311,7 @@ RegEx::RegEx(bslma::Allocator *basicAllocator)
 , d_compileContext_p(0)
 , d_matchContext_p(0)
 , d_patternCode_p(0)
-, d_matchData_p(0)
+, d_jitStackSize(0)
 , d_depthLimit(RegEx::defaultDepthLimit())
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -129,16 +330,27 @@ RegEx::RegEx(bslma::Allocator *basicAllocator)
     BSLS_ASSERT(0 != d_matchContext_p);
 
     pcre2_set_match_limit(d_matchContext_p, d_depthLimit);
+
+    for (int i = 0; i < k_MATCH_DATA_POOL_SIZE; ++i) {
+        MatchDataSlot& slot = d_matchDataPool[i];
+
+        bsls::AtomicOperations::initInt(&slot.d_inUse, 0);
+        slot.d_matchData_p    = 0;
+        slot.d_matchContext_p = 0;
+        slot.d_jitStack_p     = 0;
+    }
 }
 
 // MANIPULATORS
 void RegEx::clear()
 {
     if (isPrepared()) {
+        for (int i = 0; i < k_MATCH_DATA_POOL_SIZE; ++i) {
+            destroyMatchDataSlot(&d_matchDataPool[i]);
+        }
         pcre2_code_free(d_patternCode_p);
-        pcre2_match_data_free(d_matchData_p);
         d_patternCode_p = 0;
-        d_matchData_p   = 0;
+        d_jitStackSize  = 0;
         d_flags         = 0;
         d_pattern.clear();
     }
@@ -147,7 +359,8 @@ void RegEx::clear()
 int RegEx::prepare(bsl::string *errorMessage,
                    size_t      *errorOffset,
                    const char  *pattern,
-                   int          flags)
+                   int          flags,
+                   size_t       jitStackSize)
 {
     BSLS_ASSERT(pattern);
 
@@ -167,7 +380,7 @@ int RegEx::prepare(bsl::string *errorMessage,
     pcre2_code *patternCode = pcre2_compile(
                                reinterpret_cast<const unsigned char*>(pattern),
                                PCRE2_ZERO_TERMINATED,
-                               flags,
+                               flags & ~k_FLAG_JIT,
                                &errorCodeFromPcre2,
                                &errorOffsetFromPcre2,
                                d_compileContext_p);
@@ -195,35 +408,70 @@ int RegEx::prepare(bsl::string *errorMessage,
         return k_FAILURE;                                             // RETURN
     }
 
-    pcre2_match_data *matchData = pcre2_match_data_create_from_pattern(
-                                                               patternCode, 0);
+    // Compile the pattern into machine code if requested.  On failure (in
+    // particular if JIT is not available), the JIT-compiled code is simply
+    // absent, and the pattern is interpreted.
 
-    if (0 == matchData) {
+    const bool isJitCompiled = (flags & k_FLAG_JIT)
+                            && 0 == pcre2_jit_compile(patternCode,
+                                                      PCRE2_JIT_COMPLETE);
+
+    d_patternCode_p = patternCode;
+    d_jitStackSize  = isJitCompiled ? jitStackSize : 0;
+
+    // Allocate the first slot of the match data pool, so that a single thread
+    // matching against this object never allocates memory.
+
+    if (0 != initMatchDataSlot(&d_matchDataPool[0])) {
         pcre2_code_free(patternCode);
+        d_patternCode_p = 0;
+        d_jitStackSize  = 0;
         if (errorMessage) {
             errorMessage->assign("Out of memory.");
         }
         if (errorOffset) {
             *errorOffset = 0;
         }
-        return k_FAILURE;
+        return k_FAILURE;                                             // RETURN
     }
 
     // Set the data members and set the object to the "prepared" state.
     d_pattern       = pattern;
-    d_patternCode_p = patternCode;
-    d_matchData_p   = matchData;
     d_flags         = flags;
 
     return k_SUCCESS;
 }
 
+int RegEx::setDepthLimit(int depthLimit)
+{
+    int previous = d_depthLimit;
+
+    d_depthLimit = depthLimit;
+
+    pcre2_set_match_limit(d_matchContext_p, d_depthLimit);
+
+    for (int i = 0; i < k_MATCH_DATA_POOL_SIZE; ++i) {
+        if (d_matchDataPool[i].d_matchContext_p) {
+            pcre2_set_match_limit(d_matchDataPool[i].d_matchContext_p,
+                                  d_depthLimit);
+        }
+    }
+
+    return previous;
+}
+
 // ACCESSORS
 int RegEx::match(const char *subject,
                  size_t      subjectLength,
                  size_t      subjectOffset) const
 {
-    return privateMatch(subject, subjectLength, subjectOffset);
+    MatchDataGuard guard(this);
+
+    if (0 == guard.slot()) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    return privateMatch(guard.slot(), subject, subjectLength, subjectOffset);
 }
 
 int RegEx::match(bsl::pair<size_t, size_t> *result,
@@ -233,16 +481,27 @@ int RegEx::match(bsl::pair<size_t, size_t> *result,
 {
     BSLS_ASSERT(result);
 
-    int matchResult = privateMatch(subject, subjectLength, subjectOffset);
+    MatchDataGuard guard(this);
+
+    if (0 == guard.slot()) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    int matchResult = privateMatch(guard.slot(),
+                                   subject,
+                                   subjectLength,
+                                   subjectOffset);
 
     if (k_SUCCESS != matchResult) {
         return matchResult;                                           // RETURN
     }
 
-    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(d_matchData_p);
+    pcre2_match_data *matchData = guard.slot()->d_matchData_p;
+
+    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(matchData);
 
     // Number of pairs in the output vector
-    unsigned int ovectorCount = pcre2_get_ovector_count(d_matchData_p);
+    unsigned int ovectorCount = pcre2_get_ovector_count(matchData);
 
     BSLS_ASSERT(1 <= ovectorCount);
 
@@ -260,16 +519,27 @@ int RegEx::match(bslstl::StringRef *result,
 {
     BSLS_ASSERT(result);
 
-    int matchResult = privateMatch(subject, subjectLength, subjectOffset);
+    MatchDataGuard guard(this);
+
+    if (0 == guard.slot()) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    int matchResult = privateMatch(guard.slot(),
+                                   subject,
+                                   subjectLength,
+                                   subjectOffset);
 
     if (k_SUCCESS != matchResult) {
         return matchResult;                                           // RETURN
     }
 
-    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(d_matchData_p);
+    pcre2_match_data *matchData = guard.slot()->d_matchData_p;
+
+    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(matchData);
 
     // Number of pairs in the output vector
-    unsigned int ovectorCount = pcre2_get_ovector_count(d_matchData_p);
+    unsigned int ovectorCount = pcre2_get_ovector_count(matchData);
 
     BSLS_ASSERT(1 <= ovectorCount);
 
@@ -292,16 +562,27 @@ RegEx::match(bsl::vector<bsl::pair<size_t, size_t> > *result,
 {
     BSLS_ASSERT(result);
 
-    int matchResult = privateMatch(subject, subjectLength, subjectOffset);
+    MatchDataGuard guard(this);
+
+    if (0 == guard.slot()) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    int matchResult = privateMatch(guard.slot(),
+                                   subject,
+                                   subjectLength,
+                                   subjectOffset);
 
     if (k_SUCCESS != matchResult) {
         return matchResult;                                           // RETURN
     }
 
-    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(d_matchData_p);
+    pcre2_match_data *matchData = guard.slot()->d_matchData_p;
+
+    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(matchData);
 
     // Number of pairs in the output vector
-    unsigned int ovectorCount = pcre2_get_ovector_count(d_matchData_p);
+    unsigned int ovectorCount = pcre2_get_ovector_count(matchData);
 
     result->resize(ovectorCount);
 
@@ -322,16 +603,27 @@ RegEx::match(bsl::vector<bslstl::StringRef>  *result,
 {
     BSLS_ASSERT(result);
 
-    int matchResult = privateMatch(subject, subjectLength, subjectOffset);
+    MatchDataGuard guard(this);
+
+    if (0 == guard.slot()) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    int matchResult = privateMatch(guard.slot(),
+                                   subject,
+                                   subjectLength,
+                                   subjectOffset);
 
     if (k_SUCCESS != matchResult) {
         return matchResult;                                           // RETURN
     }
 
-    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(d_matchData_p);
+    pcre2_match_data *matchData = guard.slot()->d_matchData_p;
+
+    PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(matchData);
 
     // Number of pairs in the output vector
-    unsigned int ovectorCount = pcre2_get_ovector_count(d_matchData_p);
+    unsigned int ovectorCount = pcre2_get_ovector_count(matchData);
 
     result->resize(ovectorCount);
 
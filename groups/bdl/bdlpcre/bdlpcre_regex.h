@@ -112,6 +112,56 @@ BSLS_IDENT("$Id$ $CSID$")
 // negative class such as '[^a]' always matches newline characters, independent
 // of the setting of this option.
 //
+///JIT Compiling Optimization
+///- - - - - - - - - - - - -
+// If 'RegEx::k_FLAG_JIT' is included in the flags supplied to 'prepare', then
+// the pattern is additionally compiled into native machine code by the
+// just-in-time (JIT) compiler of PCRE2, and subsequent calls to 'match' run
+// that machine code instead of interpreting the compiled pattern, which is
+// typically several times faster.  JIT compilation itself is expensive, so
+// this flag pays off for patterns that are prepared once and matched many
+// times (e.g., filters applied to every message of a stream).  The results of
+// 'match' are the same with and without this flag.
+//
+// JIT compilation is not available on every platform, nor in every build of
+// the PCRE2 library (see 'isJitAvailable'), and may fail for some patterns
+// (e.g., very large ones).  In these cases 'prepare' silently falls back to
+// the interpreter, so 'k_FLAG_JIT' can always be supplied.
+//
+// Note that the PCRE2 library distributed with this package is built without
+// JIT support (its 'config.h' leaves 'SUPPORT_JIT' undefined, and the 'sljit'
+// code generator required by the JIT compiler is not included): in this
+// build, 'isJitAvailable' returns 'false', and 'k_FLAG_JIT' has no effect
+// other than being reported by 'flags'.  Client code supplying the flag needs
+// no change to benefit from a build of PCRE2 with JIT support.
+//
+// JIT-compiled code does not use the machine stack for backtracking, but a
+// separate stack, which is 32K by default.  Patterns with deep backtracking
+// may exceed this size, in which case 'match' fails and returns 1, as when
+// the depth limit is exceeded.  A larger stack, of up to the 'jitStackSize'
+// optionally supplied to 'prepare', is then allocated (using the allocator of
+// the regular-expression object) and installed in the match context of the
+// object.
+//
+///Thread Safety
+///-------------
+// 'bdlpcre::RegEx' is *const* *thread-safe*: distinct objects may be used
+// concurrently from different threads, and the 'const' methods (in particular
+// all of the 'match' overloads) of a single prepared object may be called
+// concurrently from different threads.  The manipulators ('prepare', 'clear',
+// and 'setDepthLimit') must not be called concurrently with any other method
+// of the same object.  Hence, a pattern can be prepared (and JIT-compiled)
+// once, and the resulting object shared by all the threads of a thread pool.
+//
+// Each call to 'match' needs a block of memory (the PCRE2 "match data") to
+// hold the offsets of the matched substrings, and, if a 'jitStackSize' was
+// supplied to 'prepare', a JIT stack.  A regular-expression object owns a
+// small, fixed-size, lock-free pool of such blocks, which are allocated on
+// first use and retained until the object is cleared or re-prepared.  A call
+// to 'match' that finds every block of the pool in use by other threads
+// allocates (and then frees) a block for the duration of the call, so such
+// calls, while still correct, are slower.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate using this component to extract
@@ -463,6 +513,38 @@ class RegEx {
                                                             // evaluation
                                                             // recursion depth
 
+    // PRIVATE TYPES
+    enum {
+        k_MATCH_DATA_POOL_SIZE = 8  // number of match data blocks pooled by a
+                                    // regular-expression object
+    };
+
+    struct MatchDataSlot {
+        // This 'struct' holds the per-call state required to match a subject
+        // against the compiled pattern.
+
+        bsls::AtomicOperations::AtomicTypes::Int
+                             d_inUse;           // 1 if a call to 'match' owns
+                                                // this slot, and 0 otherwise
+
+        pcre2_match_data    *d_matchData_p;     // match data, or 0 if not yet
+                                                // allocated
+
+        pcre2_match_context *d_matchContext_p;  // match context owning
+                                                // 'd_jitStack_p', or 0 if the
+                                                // context of the object is
+                                                // used
+
+        pcre2_jit_stack     *d_jitStack_p;      // JIT stack, or 0 if the
+                                                // default stack is used
+    };
+
+    class MatchDataGuard;
+        // Guard acquiring a 'MatchDataSlot' for the duration of a call to
+        // 'match' (defined in the implementation file).
+
+    friend class MatchDataGuard;
+
     // PRIVATE DATA
     int                    d_flags;            // prepare/match flags
 
@@ -476,7 +558,13 @@ class RegEx {
 
     pcre2_code            *d_patternCode_p;    // PCRE2 compiled pattern
 
-    pcre2_match_data      *d_matchData_p;      // PCRE2 match data for pattern
+    mutable MatchDataSlot  d_matchDataPool[k_MATCH_DATA_POOL_SIZE];
+                                               // lock-free pool of PCRE2
+                                               // match data for pattern
+
+    size_t                 d_jitStackSize;     // maximum size of the JIT
+                                               // stack, or 0 if the default
+                                               // (32K) stack is used
 
     int                    d_depthLimit;       // evaluation recursion depth
 
@@ -488,13 +576,27 @@ class RegEx {
     RegEx& operator=(const RegEx&);
 
     // PRIVATE ACCESSORS
-    int privateMatch(const char *subject,
-                     size_t      subjectLength,
-                     size_t      subjectOffset) const;
+    void destroyMatchDataSlot(MatchDataSlot *slot) const;
+        // Free the resources held by the specified 'slot' and reset it to its
+        // unallocated state.
+
+    int initMatchDataSlot(MatchDataSlot *slot) const;
+        // Allocate the match data (and, if 'd_jitStackSize' is not 0, the
+        // match context and JIT stack) of the specified unallocated 'slot'
+        // for the pattern held by this regular-expression object.  Return 0
+        // on success, and a non-zero value (with no effect on 'slot')
+        // otherwise.  The behavior is undefined unless 'isPrepared() ==
+        // true'.
+
+    int privateMatch(const MatchDataSlot *slot,
+                     const char          *subject,
+                     size_t               subjectLength,
+                     size_t               subjectOffset) const;
         // Match the specified 'subject', having the specified 'subjectLength',
         // against the pattern held by this regular-expression object
         // ('pattern()').  Begin matching at the specified 'subjectOffset' in
-        // 'subject'.  Load 'd_matchData_p' with the results of the match.
+        // 'subject'.  Load the match data of the specified 'slot' with the
+        // results of the match.
         // Return 0 on success, 1 if the depth limit was exceeded, and another
         // non-zero value otherwise.  The behavior is undefined unless
         // 'isPrepared() == true', '0 <= subjectLength', '0 <= subjectOffset',
@@ -519,7 +621,11 @@ class RegEx {
 
         k_FLAG_MULTILINE     = PCRE2_MULTILINE, // multi-line matching
 
-        k_FLAG_UTF8          = PCRE2_UTF        // UTF-8 support
+        k_FLAG_UTF8          = PCRE2_UTF,       // UTF-8 support
+
+        k_FLAG_JIT           = 1 << 28          // just-in-time compiling
+                                                // optimization requested (not
+                                                // a PCRE2 compile option)
     };
         // This enumeration defines the flags that may be supplied to the
         // 'prepare' method to effect specific pattern matching behavior.
@@ -528,6 +634,11 @@ class RegEx {
     static int defaultDepthLimit();
         // Returns the process-wide default evaluation recursion depth limit.
 
+    static bool isJitAvailable();
+        // Return 'true' if the just-in-time compiling optimization (see
+        // 'k_FLAG_JIT') is supported by the current platform and build of the
+        // PCRE2 library, and 'false' otherwise.
+
     static int setDefaultDepthLimit(int depthLimit);
         // Set the process-wide default evaluation recursion depth limit to the
         // specified 'depthLimit'.  Returns the previous depth limit.
@@ -547,33 +658,46 @@ class RegEx {
     void clear();
         // Free resources used by this regular-expression object and put this
         // object into the "unprepared" state.  This method has no effect if
-        // this object is already in the "unprepared" state.
+        // this object is already in the "unprepared" state.  The behavior is
+        // undefined if this method is called concurrently with any other
+        // method of this object.
 
     int prepare(bsl::string *errorMessage,
                 size_t      *errorOffset,
                 const char  *pattern,
-                int          flags = 0);
+                int          flags = 0,
+                size_t       jitStackSize = 0);
         // Prepare this regular-expression object with the specified 'pattern'
-        // and the optionally specified 'flags'.  On success, put this object
-        // into the "prepared" state and return 0, with no effect on the
-        // specified 'errorMessage' and 'errorOffset'.  Otherwise, (1) put this
-        // object into the "unprepared" state, (2) load 'errorMessage' (if
-        // non-null) with a string describing the error detected, (3) load
-        // 'errorOffset' (if non-null) with the offset in 'pattern' at which
-        // the error was detected, and (4) return a non-zero value.  The
-        // behavior is undefined unless 'flags' is the bit-wise inclusive-or of
-        // 0 or more of the following values:
+        // and the optionally specified 'flags'.  If 'flags' includes
+        // 'k_FLAG_JIT', optionally specify a 'jitStackSize' indicating the
+        // maximum size of the stack used by the JIT-compiled pattern; if
+        // 'jitStackSize' is 0 (the default), the default stack of 32K is used.
+        // On success, put this object into the "prepared" state and return 0,
+        // with no effect on the specified 'errorMessage' and 'errorOffset'.
+        // Otherwise, (1) put this object into the "unprepared" state, (2) load
+        // 'errorMessage' (if non-null) with a string describing the error
+        // detected, (3) load 'errorOffset' (if non-null) with the offset in
+        // 'pattern' at which the error was detected, and (4) return a non-zero
+        // value.  The behavior is undefined unless 'flags' is the bit-wise
+        // inclusive-or of 0 or more of the following values:
         //..
         //  k_FLAG_CASELESS
         //  k_FLAG_DOTMATCHESALL
         //  k_FLAG_MULTILINE
         //  k_FLAG_UTF8
+        //  k_FLAG_JIT
         //..
+        // The behavior is also undefined if this method is called
+        // concurrently with any other method of this object.  Note that if
+        // JIT compilation is requested but not available, or fails for
+        // 'pattern', the pattern is interpreted instead (see {JIT Compiling
+        // Optimization}).
 
     int setDepthLimit(int depthLimit);
         // Set the evaluation recursion depth limit for this regular-expression
         // object to the specified 'depthLimit'.  Return the previous depth
-        // limit.
+        // limit.  The behavior is undefined if this method is called
+        // concurrently with any other method of this object.
 
     // ACCESSORS
     int depthLimit() const;
@@ -591,12 +715,20 @@ class RegEx {
         //  k_FLAG_DOTMATCHESALL
         //  k_FLAG_MULTILINE
         //  k_FLAG_UTF8
+        //  k_FLAG_JIT
         //..
 
     bool isPrepared() const;
         // Return 'true' if this regular-expression object is in the "prepared"
         // state, and 'false' otherwise.
 
+    size_t jitStackSize() const;
+        // Return the maximum size of the stack used by the JIT-compiled
+        // pattern held by this regular-expression object, as supplied to the
+        // most recent successful call to the 'prepare' method, or 0 if the
+        // default stack is used.  The behavior is undefined unless
+        // 'isPrepared() == true'.
+
     int match(const char *subject,
               size_t      subjectLength,
               size_t      subjectOffset = 0) const;
@@ -730,19 +862,6 @@ RegEx::~RegEx()
     pcre2_general_context_free(d_pcre2Context_p);
 }
 
-// MANIPULATORS
-inline
-int RegEx::setDepthLimit(int depthLimit)
-{
-    int previous = d_depthLimit;
-
-    d_depthLimit = depthLimit;
-
-    pcre2_set_match_limit(d_matchContext_p, d_depthLimit);
-
-    return previous;
-}
-
 // ACCESSORS
 inline
 int RegEx::depthLimit() const
@@ -759,7 +878,13 @@ int RegEx::flags() const
 inline
 bool RegEx::isPrepared() const
 {
-    return (0 != d_patternCode_p && 0 != d_matchData_p);
+    return 0 != d_patternCode_p;
+}
+
+inline
+size_t RegEx::jitStackSize() const
+{
+    return d_jitStackSize;
 }
 
 inline
@@ -8,7 +8,10 @@
 #include <bdlma_bufferedsequentialallocator.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bsls_alignedbuffer.h>
+#include <bsls_atomic.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -47,9 +50,13 @@ using namespace bdlpcre;
 // MANIPULATORS
 // [ 3] void clear();
 // [ 3] int prepare(const char*, int, const char**, int*);
+// [18] int prepare(bsl::string*, size_t*, const char*, int, size_t);
 // [14] int setDepthLimit(int)
 // [14] int setDefaultDepthLimit(int)
 //
+// CLASS METHODS
+// [18] bool isJitAvailable();
+//
 // ACCESSORS
 // [ 6] int flags() const;
 // [ 3] bool isPrepared() const;
@@ -58,6 +65,7 @@ using namespace bdlpcre;
 // [ 4] int match(bsl::vector<bsl::pair<size_t, size_t> > *result, ...) const;
 // [ 5] int match(bslstl::StringRef *result, ...) const;
 // [ 5] int match(bsl::vector<bslstl::StringRef> *result, ...) const;
+// [18] size_t jitStackSize() const;
 // [11] int numSubpatterns() const;
 // [ 2] const bsl::string& pattern() const;
 // [11] int subpatternIndex(const char *name) const;
@@ -73,7 +81,9 @@ using namespace bdlpcre;
 // [13] NON-CAPTURING GROUPS
 // [15] UNICODE CHARACTER PROPERTY SUPPORT
 // [16] MEMORY ALLIGNMENT
-// [17] USAGE EXAMPLE
+// [18] k_FLAG_JIT
+// [19] CONCURRENT MATCHING
+// [20] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -513,6 +523,84 @@ typedef RegEx Obj;
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+namespace TEST_CASE_CONCURRENT_MATCHING {
+
+struct SubjectData {
+    const char *d_subject;      // subject string
+    int         d_retCode;      // expected return code of 'match'
+    size_t      d_userOffset;   // expected offset of the first sub-pattern
+    size_t      d_userLength;   // expected length of the first sub-pattern
+};
+
+const SubjectData SUBJECTS[] = {
+    { "from: alice@example.com",            0,  6, 5 },
+    { "no address here",                   -1,  0, 0 },
+    { "cc: bob_smith@test.com, x@y.com",    0,  4, 9 },
+    { "someone@nowhere",                   -1,  0, 0 },
+    { "to: z@abc.com",                      0,  4, 1 },
+};
+const int NUM_SUBJECTS = sizeof SUBJECTS / sizeof *SUBJECTS;
+
+class Matcher {
+    // This class provides a functor that matches, from its own thread, each
+    // of 'SUBJECTS' against a shared regular-expression object, and counts
+    // the results that differ from the expected ones.
+
+    // DATA
+    const Obj       *d_regex_p;        // shared regular expression
+    int              d_numIterations;  // number of passes over 'SUBJECTS'
+    bslmt::Barrier  *d_barrier_p;      // barrier to start all threads
+    bsls::AtomicInt *d_numErrors_p;    // number of mismatched results
+
+  public:
+    // CREATORS
+    Matcher(const Obj       *regex,
+            int              numIterations,
+            bslmt::Barrier  *barrier,
+            bsls::AtomicInt *numErrors)
+    : d_regex_p(regex)
+    , d_numIterations(numIterations)
+    , d_barrier_p(barrier)
+    , d_numErrors_p(numErrors)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+    {
+        bsl::vector<bsl::pair<size_t, size_t> > result;
+
+        d_barrier_p->wait();
+
+        for (int n = 0; n < d_numIterations; ++n) {
+            for (int i = 0; i < NUM_SUBJECTS; ++i) {
+                const SubjectData& DATA = SUBJECTS[i];
+
+                result.clear();
+
+                const int retCode = d_regex_p->match(
+                                                 &result,
+                                                 DATA.d_subject,
+                                                 bsl::strlen(DATA.d_subject));
+
+                if (0 == DATA.d_retCode) {
+                    if (0 != retCode
+                     || 3 != result.size()
+                     || DATA.d_userOffset != result[1].first
+                     || DATA.d_userLength != result[1].second) {
+                        ++*d_numErrors_p;
+                    }
+                }
+                else if (0 == retCode) {
+                    ++*d_numErrors_p;
+                }
+            }
+        }
+    }
+};
+
+}  // close namespace TEST_CASE_CONCURRENT_MATCHING
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -528,7 +616,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -581,6 +669,255 @@ int main(int argc, char *argv[])
 //  }
 //..
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING CONCURRENT MATCHING
+        //
+        // Concerns:
+        //: 1 The 'match' methods of a single prepared object can be called
+        //:   concurrently from multiple threads, and each call gives the same
+        //:   result as a call made from a single thread.
+        //:
+        //: 2 Calls made while every pooled match data block is in use by
+        //:   other threads still give the correct results.
+        //:
+        //: 3 The above holds whether or not the object is prepared with
+        //:   'k_FLAG_JIT' and a JIT stack (each concurrent call then needs a
+        //:   stack of its own).
+        //:
+        //: 4 The memory allocated by concurrent calls is released by 'clear'.
+        //
+        // Plan:
+        //: 1 Prepare an object with a pattern having sub-patterns, then
+        //:   start more threads than there are pooled match data blocks, each
+        //:   of which repeatedly matches a set of subjects against the object
+        //:   and verifies the results.  Count the mismatches, and verify that
+        //:   there are none.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with the object prepared with 'k_FLAG_JIT' and a
+        //:   non-zero JIT stack size.  (C-3)
+        //:
+        //: 3 Use a test allocator to verify that no memory allocated after
+        //:   construction is in use after 'clear'.  (C-4)
+        //
+        // Testing:
+        //   CONCURRENT MATCHING
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING CONCURRENT MATCHING" << endl
+                          << "===========================" << endl;
+
+        using namespace TEST_CASE_CONCURRENT_MATCHING;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const int k_NUM_THREADS    = 16;
+        const int k_NUM_ITERATIONS = 2000;
+
+        static const struct {
+            int    d_lineNum;       // source line number
+            int    d_flags;         // flags supplied to 'prepare'
+            size_t d_jitStackSize;  // JIT stack size supplied to 'prepare'
+        } DATA[] = {
+            //line  flags             jitStackSize
+            //----  -----             ------------
+            { L_,   0,                0            },
+            { L_,   Obj::k_FLAG_JIT,  0            },
+            { L_,   Obj::k_FLAG_JIT,  64 * 1024    },
+        };
+        const size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE           = DATA[ti].d_lineNum;
+            const int    FLAGS          = DATA[ti].d_flags;
+            const size_t JIT_STACK_SIZE = DATA[ti].d_jitStackSize;
+
+            if (veryVerbose) { P_(LINE) P_(FLAGS) P(JIT_STACK_SIZE) }
+
+            Obj mX(&ta); const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            bsl::string errorMsg;
+            size_t      errorOffset;
+
+            int retCode = mX.prepare(&errorMsg,
+                                     &errorOffset,
+                                     "([\\w.]+)@(\\w+)\\.com",
+                                     FLAGS,
+                                     JIT_STACK_SIZE);
+            ASSERTV(LINE, errorMsg, errorOffset, 0 == retCode);
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bsls::AtomicInt    numErrors(0);
+            bslmt::ThreadGroup threadGroup;
+
+            ASSERTV(LINE, k_NUM_THREADS == threadGroup.addThreads(
+                                                 Matcher(&X,
+                                                         k_NUM_ITERATIONS,
+                                                         &barrier,
+                                                         &numErrors),
+                                                 k_NUM_THREADS));
+            threadGroup.joinAll();
+
+            ASSERTV(LINE, numErrors, 0 == numErrors);
+
+            mX.clear();
+
+            ASSERTV(LINE, NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS == ta.numBlocksInUse());
+        }
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_FLAG_JIT'
+        //
+        // Concerns:
+        //: 1 A pattern prepared with 'k_FLAG_JIT' matches exactly the same
+        //:   subjects, at the same offsets, as the same pattern prepared
+        //:   without the flag, whether or not JIT compiling is available.
+        //:
+        //: 2 'flags' reports 'k_FLAG_JIT' if it was supplied to 'prepare'.
+        //:
+        //: 3 'jitStackSize' reports the size of the JIT stack installed by
+        //:   'prepare', which is 0 if no stack was requested, if
+        //:   'k_FLAG_JIT' was not supplied, or if JIT compiling is not
+        //:   available.
+        //:
+        //: 4 'clear' releases the JIT stack, and all memory is allocated
+        //:   from the allocator supplied at construction.
+        //
+        // Plan:
+        //: 1 Using a table-driven technique, prepare two objects with each
+        //:   pattern, one with and one without 'k_FLAG_JIT' (and a non-zero
+        //:   JIT stack size), and verify that both objects give the same
+        //:   result for each subject.  (C-1..2)
+        //:
+        //: 2 Verify the value of 'jitStackSize' against 'isJitAvailable',
+        //:   then 'clear' the objects and verify that 'jitStackSize' is 0.
+        //:   (C-3)
+        //:
+        //: 3 Use a test allocator to verify that no memory is leaked and that
+        //:   the default allocator is not used.  (C-4)
+        //
+        // Testing:
+        //   bool isJitAvailable();
+        //   int prepare(bsl::string*, size_t*, const char*, int, size_t);
+        //   size_t jitStackSize() const;
+        //   k_FLAG_JIT
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING 'k_FLAG_JIT'" << endl
+                          << "====================" << endl;
+
+        if (verbose) {
+            cout << "\tJIT compiling available: "
+                 << Obj::isJitAvailable() << endl;
+        }
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_lineNum;   // source line number
+            const char *d_pattern;   // pattern string
+            const char *d_subject;   // subject string
+            int         d_flags;     // flags other than 'k_FLAG_JIT'
+        } DATA[] = {
+            //line  pattern              subject           flags
+            //----  -------              -------           -----
+            { L_,   "abc",               "xxabcxx",        0                },
+            { L_,   "abc",               "xxABCxx",        0                },
+            { L_,   "abc",               "xxABCxx",
+                                                      Obj::k_FLAG_CASELESS  },
+            { L_,   "^b",                "a\nb",           0                },
+            { L_,   "^b",                "a\nb",
+                                                      Obj::k_FLAG_MULTILINE },
+            { L_,   "(\\d+)-(\\d+)",     "id 123-4567 ok", 0                },
+            { L_,   "(a|b)*c",           "ababababd",      0                },
+            { L_,   "password=\\S+",     "user=x password=secret", 0        },
+            { L_,   "a.c",               "xxa\nc",         0                },
+            { L_,   "a.c",               "xxa\nc",
+                                                  Obj::k_FLAG_DOTMATCHESALL },
+            { L_,   "",                  "",               0                },
+        };
+        const size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const size_t JIT_STACK_SIZE = 64 * 1024;
+
+        for (size_t i = 0; i < NUM_DATA; ++i) {
+            const int   LINE    = DATA[i].d_lineNum;
+            const char *PATTERN = DATA[i].d_pattern;
+            const char *SUBJECT = DATA[i].d_subject;
+            const int   FLAGS   = DATA[i].d_flags;
+
+            if (veryVerbose) { P_(LINE) P_(PATTERN) P(SUBJECT) }
+
+            Obj mX(&ta); const Obj& X = mX;
+            Obj mY(&ta); const Obj& Y = mY;
+
+            bsl::string errorMsg(&ta);
+            size_t      errorOffset;
+
+            int retCode = mX.prepare(&errorMsg, &errorOffset, PATTERN, FLAGS);
+            ASSERTV(LINE, errorMsg, errorOffset, 0 == retCode);
+
+            retCode = mY.prepare(&errorMsg,
+                                 &errorOffset,
+                                 PATTERN,
+                                 FLAGS | Obj::k_FLAG_JIT,
+                                 JIT_STACK_SIZE);
+            ASSERTV(LINE, errorMsg, errorOffset, 0 == retCode);
+
+            ASSERTV(LINE, FLAGS == X.flags());
+            ASSERTV(LINE, (FLAGS | Obj::k_FLAG_JIT) == Y.flags());
+            ASSERTV(LINE, PATTERN == Y.pattern());
+
+            ASSERTV(LINE, 0 == X.jitStackSize());
+            ASSERTV(LINE, X.jitStackSize(),
+                    (Obj::isJitAvailable() ? JIT_STACK_SIZE : 0) ==
+                                                           Y.jitStackSize());
+
+            const size_t LENGTH = bsl::strlen(SUBJECT);
+
+            bsl::pair<size_t, size_t> xResult(0, 0);
+            bsl::pair<size_t, size_t> yResult(0, 0);
+
+            const int xRet = X.match(&xResult, SUBJECT, LENGTH);
+            const int yRet = Y.match(&yResult, SUBJECT, LENGTH);
+
+            ASSERTV(LINE, xRet, yRet, xRet == yRet);
+            if (0 == xRet) {
+                ASSERTV(LINE, xResult.first, yResult.first,
+                        xResult.first == yResult.first);
+                ASSERTV(LINE, xResult.second, yResult.second,
+                        xResult.second == yResult.second);
+            }
+
+            ASSERTV(LINE, X.numSubpatterns() == Y.numSubpatterns());
+
+            mY.clear();
+
+            ASSERTV(LINE, false == Y.isPrepared());
+            ASSERTV(LINE, 0     == Y.jitStackSize());
+
+            // Prepare again without a JIT stack: the default stack is used.
+
+            retCode = mY.prepare(&errorMsg,
+                                 &errorOffset,
+                                 PATTERN,
+                                 FLAGS | Obj::k_FLAG_JIT);
+            ASSERTV(LINE, errorMsg, errorOffset, 0 == retCode);
+            ASSERTV(LINE, 0 == Y.jitStackSize());
+
+            ASSERTV(LINE, xRet == Y.match(SUBJECT, LENGTH));
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING MEMORY ALIGNMENT
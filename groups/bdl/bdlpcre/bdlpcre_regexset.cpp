@@ -0,0 +1,678 @@
+// bdlpcre_regexset.cpp                                               -*-C++-*-
+#include <bdlpcre_regexset.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlpcre_regexset_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Required literals are extracted by a single left-to-right scan of the
+// pattern that collects the maximal runs of literal characters appearing at
+// the top level of the pattern (i.e., outside of any group or character
+// class).  Each such run must appear, as a whole, in any subject matching the
+// pattern, provided that:
+//: o The pattern has no top-level alternation (in which case no literal is
+//:   required).
+//:
+//: o A literal character followed by a quantifier that allows zero
+//:   repetitions ('?', '*', '{0,n}') is removed from the run, and a literal
+//:   character followed by any other quantifier ends the run.
+//:
+//: o Constructs that change how the rest of the pattern is parsed ('\Q..\E',
+//:   the extended option '(?x)', and '(*VERB)' items) disable the extraction
+//:   altogether.
+//:
+//: o Non-ASCII characters end the run if the pattern may be matched
+//:   caselessly (since PCRE2 folds the case of non-ASCII characters in UTF-8
+//:   mode), and each is otherwise kept or removed as a whole (in UTF-8 mode,
+//:   a character spans several bytes).
+//
+// The longest run is retained.  All runs are converted to ASCII lower case,
+// and the automaton maps each upper-case ASCII letter to the same input class
+// as its lower-case counterpart, so that the prefilter matches literals
+// irrespective of ASCII case.
+//
+// The automaton is a deterministic Aho-Corasick automaton: the goto function
+// of the trie of the literals is completed, by a breadth-first traversal,
+// with the transitions of the failure nodes, so that each byte of the subject
+// costs a single table lookup.  To keep the table small, byte values are
+// mapped to input classes: one class per distinct byte value appearing in a
+// literal, plus one class (0) for all other byte values.  The automaton is
+// rebuilt from scratch by each call to 'add'.
+
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+
+#include <bsls_exceptionutil.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+
+namespace bdlpcre {
+
+namespace {
+
+const char *skipClass(const char *position)
+    // Return the address of the character following the end of the character
+    // class starting at the specified 'position', or 0 if the class is not
+    // terminated.  The behavior is undefined unless '*position' is '['.
+{
+    const char *p = position + 1;
+
+    if ('^' == *p) {
+        ++p;
+    }
+    if (']' == *p) {
+        ++p;  // a leading ']' is a literal
+    }
+
+    while (*p) {
+        if ('\\' == *p) {
+            if (0 == p[1]) {
+                return 0;                                             // RETURN
+            }
+            p += 2;
+        }
+        else if ('[' == *p && ':' == p[1]) {
+            const char *end = bsl::strstr(p + 2, ":]");
+            p = end ? end + 2 : p + 1;
+        }
+        else if (']' == *p) {
+            return p + 1;                                             // RETURN
+        }
+        else {
+            ++p;
+        }
+    }
+
+    return 0;
+}
+
+const char *skipGroup(const char *position)
+    // Return the address of the character following the parenthesis closing
+    // the group starting at the specified 'position', or 0 if the group is
+    // not closed.  The behavior is undefined unless '*position' is '('.
+{
+    const char *p     = position;
+    int         depth = 0;
+
+    while (p && *p) {
+        switch (*p) {
+          case '\\': {
+            p = p[1] ? p + 2 : 0;
+          } break;
+          case '[': {
+            p = skipClass(p);
+          } break;
+          case '(': {
+            ++depth;
+            ++p;
+          } break;
+          case ')': {
+            if (0 == --depth) {
+                return p + 1;                                         // RETURN
+            }
+            ++p;
+          } break;
+          default: {
+            ++p;
+          }
+        }
+    }
+
+    return 0;
+}
+
+void endRun(bsl::string *result, bsl::string *run, bsl::size_t *atomStart)
+    // Retain the specified 'run' in the specified 'result' if it is longer
+    // than 'result', then clear 'run' and reset the specified 'atomStart'.
+{
+    if (run->size() > result->size()) {
+        result->swap(*run);
+    }
+    run->clear();
+    *atomStart = bsl::string::npos;
+}
+
+void dropAtom(bsl::string *run, bsl::size_t *atomStart)
+    // Remove from the specified 'run' its last literal character, starting
+    // at the specified 'atomStart' offset, if any.
+{
+    if (bsl::string::npos != *atomStart) {
+        run->resize(*atomStart);
+        *atomStart = bsl::string::npos;
+    }
+}
+
+bool isDigit(char c)
+    // Return 'true' if the specified 'c' is an ASCII decimal digit.
+{
+    return '0' <= c && c <= '9';
+}
+
+bool isHexDigit(char c)
+    // Return 'true' if the specified 'c' is an ASCII hexadecimal digit.
+{
+    return isDigit(c) || ('a' <= c && c <= 'f') || ('A' <= c && c <= 'F');
+}
+
+bool isAlnum(char c)
+    // Return 'true' if the specified 'c' is an ASCII letter or digit.
+{
+    return isDigit(c) || ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z');
+}
+
+char toLower(char c)
+    // Return the ASCII lower-case counterpart of the specified 'c' if it is
+    // an upper-case ASCII letter, and 'c' otherwise.
+{
+    return 'A' <= c && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+}  // close unnamed namespace
+
+                             // --------------
+                             // class RegExSet
+                             // --------------
+
+// PRIVATE MANIPULATORS
+void RegExSet::buildAutomaton()
+{
+    // Assign input classes.
+
+    int byteClasses[256];
+    bsl::memset(byteClasses, 0, sizeof byteClasses);
+
+    int numClasses = 1;
+
+    for (bsl::size_t i = 0; i < d_literals.size(); ++i) {
+        const bsl::string& literal = d_literals[i];
+
+        for (bsl::size_t j = 0; j < literal.size(); ++j) {
+            const unsigned char byte = static_cast<unsigned char>(literal[j]);
+
+            if (0 == byteClasses[byte]) {
+                byteClasses[byte] = numClasses++;
+            }
+        }
+    }
+    for (int c = 'A'; c <= 'Z'; ++c) {
+        byteClasses[c] = byteClasses[c - 'A' + 'a'];
+    }
+
+    // Build the trie of the literals.  Missing transitions are -1.
+
+    const int numPatterns = static_cast<int>(d_literals.size());
+
+    bsl::vector<int> transitions(numClasses, -1, d_allocator_p);
+    bsl::vector<int> firstPatterns(1, -1, d_allocator_p);
+    bsl::vector<int> nextPattern(numPatterns, -1, d_allocator_p);
+
+    for (int i = 0; i < numPatterns; ++i) {
+        const bsl::string& literal = d_literals[i];
+
+        if (literal.empty()) {
+            continue;                                               // CONTINUE
+        }
+
+        int node = 0;
+
+        for (bsl::size_t j = 0; j < literal.size(); ++j) {
+            const unsigned char byte  = static_cast<unsigned char>(literal[j]);
+            const bsl::size_t   index = node * numClasses + byteClasses[byte];
+
+            if (-1 == transitions[index]) {
+                transitions[index] = static_cast<int>(firstPatterns.size());
+                transitions.resize(transitions.size() + numClasses, -1);
+                firstPatterns.push_back(-1);
+            }
+            node = transitions[index];
+        }
+
+        nextPattern[i]      = firstPatterns[node];
+        firstPatterns[node] = i;
+    }
+
+    // Compute the failure and output nodes, and complete the transitions, in
+    // breadth-first order, so that the failure node of a node (which is
+    // shallower) is always complete when the node is visited.
+
+    const int numNodes = static_cast<int>(firstPatterns.size());
+
+    bsl::vector<int> failures(numNodes, 0, d_allocator_p);
+    bsl::vector<int> outputs(numNodes, -1, d_allocator_p);
+    bsl::vector<int> queue(d_allocator_p);
+    queue.reserve(numNodes);
+
+    for (int c = 0; c < numClasses; ++c) {
+        if (-1 == transitions[c]) {
+            transitions[c] = 0;
+        }
+        else {
+            queue.push_back(transitions[c]);
+        }
+    }
+
+    for (bsl::size_t head = 0; head < queue.size(); ++head) {
+        const int node    = queue[head];
+        const int failure = failures[node];
+
+        outputs[node] = -1 != firstPatterns[node] ? node : outputs[failure];
+
+        for (int c = 0; c < numClasses; ++c) {
+            const int  failureNext = transitions[failure * numClasses + c];
+            int&       next        = transitions[node * numClasses + c];
+
+            if (-1 == next) {
+                next = failureNext;
+            }
+            else {
+                failures[next] = failureNext;
+                queue.push_back(next);
+            }
+        }
+    }
+
+    // Commit.
+
+    bsl::memcpy(d_byteClasses, byteClasses, sizeof byteClasses);
+    d_numClasses = numClasses;
+    d_transitions.swap(transitions);
+    d_failures.swap(failures);
+    d_firstPatterns.swap(firstPatterns);
+    d_outputs.swap(outputs);
+    d_nextPattern.swap(nextPattern);
+}
+
+// CLASS METHODS
+void RegExSet::extractLiteral(bsl::string *result,
+                              const char  *pattern,
+                              int          flags)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(pattern);
+
+    result->clear();
+
+    // Reject the constructs that change how the rest of the pattern is
+    // parsed, and detect inline caseless options.
+
+    if (bsl::strstr(pattern, "\\Q") || bsl::strstr(pattern, "(*")) {
+        return;                                                       // RETURN
+    }
+
+    bool isCaseless = 0 != (flags & RegEx::k_FLAG_CASELESS);
+
+    for (const char *p = bsl::strstr(pattern, "(?");
+         p;
+         p = bsl::strstr(p + 2, "(?")) {
+        for (const char *q = p + 2; isAlnum(*q) || '-' == *q || '^' == *q;
+                                                                        ++q) {
+            if ('x' == *q) {
+                return;                                               // RETURN
+            }
+            if ('i' == *q) {
+                isCaseless = true;
+            }
+        }
+    }
+
+    const bool isUtf8 = 0 != (flags & RegEx::k_FLAG_UTF8);
+
+    bsl::string run(result->get_allocator());
+    bsl::size_t atomStart = bsl::string::npos;  // offset in 'run' of its last
+                                                // literal character, if any
+
+    const char *p = pattern;
+
+    while (*p) {
+        switch (*p) {
+          case '|': {
+            // Top-level alternation: no literal is required.
+
+            result->clear();
+            return;                                                   // RETURN
+          }
+          case ')': {
+            result->clear();
+            return;                                                   // RETURN
+          }
+          case '(': {
+            endRun(result, &run, &atomStart);
+            p = skipGroup(p);
+          } break;
+          case '[': {
+            endRun(result, &run, &atomStart);
+            p = skipClass(p);
+          } break;
+          case '.':
+          case '^':
+          case '$': {
+            endRun(result, &run, &atomStart);
+            ++p;
+          } break;
+          case '?':
+          case '*': {
+            dropAtom(&run, &atomStart);
+            endRun(result, &run, &atomStart);
+            ++p;
+          } break;
+          case '+': {
+            endRun(result, &run, &atomStart);
+            ++p;
+          } break;
+          case '{': {
+            // A '{' that does not start a quantifier '{n}', '{n,}', or
+            // '{n,m}' is a literal.
+
+            const char *q = p + 1;
+            int         min = 0;
+            bool        isQuantifier = isDigit(*q);
+
+            for (; isDigit(*q); ++q) {
+                min = min < 1000 ? min * 10 + (*q - '0') : min;
+            }
+            if (isQuantifier && ',' == *q) {
+                for (++q; isDigit(*q); ++q) {
+                }
+            }
+            isQuantifier = isQuantifier && '}' == *q;
+
+            if (isQuantifier) {
+                if (0 == min) {
+                    dropAtom(&run, &atomStart);
+                }
+                endRun(result, &run, &atomStart);
+                p = q + 1;
+            }
+            else {
+                atomStart = run.size();
+                run.push_back('{');
+                ++p;
+            }
+          } break;
+          case '\\': {
+            const char escaped = p[1];
+
+            if (0 == escaped
+             || 0 != (static_cast<unsigned char>(escaped) & 0x80)) {
+                result->clear();
+                return;                                               // RETURN
+            }
+
+            p += 2;
+
+            if (!isAlnum(escaped)) {
+                // An escaped punctuation character is a literal.
+
+                atomStart = run.size();
+                run.push_back(escaped);
+                break;                                                 // BREAK
+            }
+
+            // Any other escape sequence ends the run; skip its arguments.
+
+            endRun(result, &run, &atomStart);
+
+            if ('{' == *p || '<' == *p || '\'' == *p) {
+                if ('x' == escaped || 'o' == escaped || 'p' == escaped
+                 || 'P' == escaped || 'g' == escaped || 'k' == escaped
+                 || 'N' == escaped) {
+                    const char close = '{' == *p ? '}'
+                                                 : '<' == *p ? '>' : '\'';
+                    const char *end  = bsl::strchr(p + 1, close);
+
+                    if (0 == end) {
+                        result->clear();
+                        return;                                       // RETURN
+                    }
+                    p = end + 1;
+                }
+            }
+            else if ('x' == escaped) {
+                for (int i = 0; i < 2 && isHexDigit(*p); ++i) {
+                    ++p;
+                }
+            }
+            else if ('p' == escaped || 'P' == escaped || 'c' == escaped) {
+                if (*p) {
+                    ++p;
+                }
+            }
+            else if ('g' == escaped) {
+                if ('-' == *p || '+' == *p) {
+                    ++p;
+                }
+                while (isDigit(*p)) {
+                    ++p;
+                }
+            }
+            else if (isDigit(escaped)) {
+                while (isDigit(*p)) {
+                    ++p;
+                }
+            }
+          } break;
+          default: {
+            const unsigned char c = static_cast<unsigned char>(*p);
+
+            if (c < 0x80) {
+                atomStart = run.size();
+                run.push_back(toLower(*p));
+                ++p;
+                break;                                                 // BREAK
+            }
+
+            // A non-ASCII character, which, in UTF-8 mode, spans a leading
+            // byte and its continuation bytes.
+
+            const char *end = p + 1;
+            if (isUtf8) {
+                while (0x80 == (static_cast<unsigned char>(*end) & 0xC0)) {
+                    ++end;
+                }
+            }
+
+            if (isCaseless) {
+                endRun(result, &run, &atomStart);
+            }
+            else {
+                atomStart = run.size();
+                run.append(p, end);
+            }
+            p = end;
+          }
+        }
+
+        if (0 == p) {
+            // Unterminated group or class.
+
+            result->clear();
+            return;                                                   // RETURN
+        }
+    }
+
+    endRun(result, &run, &atomStart);
+}
+
+// CREATORS
+RegExSet::RegExSet(bslma::Allocator *basicAllocator)
+: d_regExes(basicAllocator)
+, d_literals(basicAllocator)
+, d_unfiltered(basicAllocator)
+, d_nextPattern(basicAllocator)
+, d_numClasses(1)
+, d_transitions(basicAllocator)
+, d_failures(basicAllocator)
+, d_firstPatterns(basicAllocator)
+, d_outputs(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::memset(d_byteClasses, 0, sizeof d_byteClasses);
+}
+
+RegExSet::~RegExSet()
+{
+    clear();
+}
+
+// MANIPULATORS
+int RegExSet::add(bsl::string *errorMessage,
+                  size_t      *errorOffset,
+                  const char  *pattern,
+                  int          flags,
+                  size_t       jitStackSize)
+{
+    BSLS_ASSERT(pattern);
+
+    RegEx *regEx = new (*d_allocator_p) RegEx(d_allocator_p);
+
+    bslma::RawDeleterProctor<RegEx, bslma::Allocator> proctor(regEx,
+                                                              d_allocator_p);
+
+    int rc = regEx->prepare(errorMessage,
+                            errorOffset,
+                            pattern,
+                            flags,
+                            jitStackSize);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    bsl::string literal(d_allocator_p);
+    extractLiteral(&literal, pattern, flags);
+
+    const int index = numPatterns();
+
+    d_regExes.reserve(index + 1);
+    d_unfiltered.reserve(d_unfiltered.size() + 1);
+    d_literals.push_back(literal);
+
+    BSLS_TRY {
+        buildAutomaton();
+    }
+    BSLS_CATCH(...) {
+        d_literals.pop_back();
+        BSLS_RETHROW;
+    }
+
+    d_regExes.push_back(regEx);
+    proctor.release();
+
+    if (literal.empty()) {
+        d_unfiltered.push_back(index);
+    }
+
+    return 0;
+}
+
+void RegExSet::clear()
+{
+    for (bsl::size_t i = 0; i < d_regExes.size(); ++i) {
+        d_allocator_p->deleteObject(d_regExes[i]);
+    }
+
+    d_regExes.clear();
+    d_literals.clear();
+    d_unfiltered.clear();
+    d_nextPattern.clear();
+    d_transitions.clear();
+    d_failures.clear();
+    d_firstPatterns.clear();
+    d_outputs.clear();
+
+    bsl::memset(d_byteClasses, 0, sizeof d_byteClasses);
+    d_numClasses = 1;
+}
+
+// ACCESSORS
+int RegExSet::match(bsl::vector<int> *result,
+                    const char       *subject,
+                    size_t            subjectLength) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(subject || 0 == subjectLength);
+
+    const int numPatterns = this->numPatterns();
+
+    // First pass: mark the candidate patterns, using 'result' as a table of
+    // flags indexed by pattern.
+
+    result->assign(numPatterns, 0);
+
+    for (bsl::size_t i = 0; i < d_unfiltered.size(); ++i) {
+        (*result)[d_unfiltered[i]] = 1;
+    }
+
+    if (static_cast<int>(d_unfiltered.size()) < numPatterns) {
+        const unsigned char *p   = reinterpret_cast<const unsigned char *>(
+                                                                      subject);
+        const unsigned char *end = p + subjectLength;
+
+        const int *transitions   = &d_transitions[0];
+        const int *outputs       = &d_outputs[0];
+        const int *failures      = &d_failures[0];
+        int       *candidates    = &(*result)[0];
+        int        state         = 0;
+
+        for (; p != end; ++p) {
+            state = transitions[state * d_numClasses + d_byteClasses[*p]];
+
+            for (int node = outputs[state];
+                 0 <= node;
+                 node = outputs[failures[node]]) {
+                for (int i = d_firstPatterns[node];
+                     0 <= i;
+                     i = d_nextPattern[i]) {
+                    candidates[i] = 1;
+                }
+            }
+        }
+    }
+
+    // Second pass: match the candidates, compacting 'result' in place into
+    // the list of the matching patterns.
+
+    int rc         = 0;
+    int numMatches = 0;
+
+    for (int i = 0; i < numPatterns; ++i) {
+        if (0 == (*result)[i]) {
+            continue;                                               // CONTINUE
+        }
+
+        const int matchRc = d_regExes[i]->match(subject, subjectLength);
+
+        if (0 == matchRc) {
+            (*result)[numMatches++] = i;
+        }
+        else if (1 == matchRc) {
+            rc = 1;
+        }
+    }
+
+    result->resize(numMatches);
+
+    return rc;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,353 @@
+// bdlpcre_regexset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLPCRE_REGEXSET
+#define INCLUDED_BDLPCRE_REGEXSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a mechanism for matching a subject against many patterns.
+//
+//@CLASSES:
+//  bdlpcre::RegExSet: mechanism matching a subject against a set of patterns
+//
+//@SEE_ALSO: bdlpcre_regex
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlpcre::RegExSet',
+// holding a set of regular expressions, and reporting which of them match a
+// given subject string.  Patterns are added to the set, each with its own
+// prepare-time flags (see 'bdlpcre::RegEx'), using the 'add' method, and are
+// identified by their 0-based index in the order in which they were added.
+// The 'match' method loads a vector with the (ascending) indices of the
+// patterns that match a subject.
+//
+// The results of 'match' are those that would be obtained by matching the
+// subject against each pattern, one after the other, using a separate
+// 'bdlpcre::RegEx' object per pattern.  However, the cost of 'match' does not
+// grow linearly with the number of patterns in the set, since most patterns
+// are never run against a subject (see {Literal Prefiltering}).
+//
+///Literal Prefiltering
+///--------------------
+// When a pattern is added to the set, 'add' extracts from it a *required*
+// *literal*: a string of characters that any subject matching the pattern
+// must contain (e.g., " error: " for the pattern "^\S+ error: (\d+)").  The
+// longest such string that can be determined by a simple, conservative
+// analysis of the pattern is used, and the 'prefilterLiteral' accessor
+// returns it.  The required literals of all the patterns of the set are
+// compiled into a single Aho-Corasick automaton.
+//
+// 'match' then proceeds in two passes:
+//: 1 The subject is scanned once by the automaton, which visits each byte of
+//:   the subject exactly once, whatever the number of patterns.  A pattern
+//:   whose required literal is found in the subject is a *candidate*.
+//:
+//: 2 Each candidate pattern is matched against the subject by PCRE2 (see
+//:   'bdlpcre::RegEx'), to confirm (or refute) the match.
+//
+// Patterns for which no required literal can be determined (e.g., patterns
+// having a top-level alternation, such as "cat|dog", or consisting only of
+// character classes, such as "\d+") are candidates for every subject, so sets
+// of such patterns do not benefit from this component.  A pattern whose
+// required literal is short (e.g., a single character) is a candidate for many
+// subjects.  Note that the prefilter is case-insensitive (ASCII only), so that
+// it applies equally to patterns prepared with 'RegEx::k_FLAG_CASELESS'.
+//
+///Thread Safety
+///-------------
+// 'bdlpcre::RegExSet' is *const* *thread-safe*: the 'const' methods (in
+// particular 'match') of a single object may be called concurrently from
+// different threads, but the manipulators ('add' and 'clear') must not be
+// called concurrently with any other method of the same object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Routing Messages
+///- - - - - - - - - - - - - -
+// Suppose that a message router has a set of rules, each of which forwards the
+// messages matching a regular expression to a destination.  We use a
+// 'bdlpcre::RegExSet' to find the rules applying to a message.
+//
+// First, we create the set and add the patterns of the rules, in order:
+//..
+//  bdlpcre::RegExSet rules;
+//
+//  const char *const PATTERNS[] = {
+//      "^ORDER [A-Z]+ (\\d+) shares",     // 0: order desk
+//      "\\bcancel(led)?\\b",              // 1: cancellations
+//      "account=(\\d{8})",                // 2: account service
+//      "\\d{3}[-.]\\d{2}[-.]\\d{4}",      // 3: compliance (SSN-like data)
+//  };
+//  const int NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS;
+//
+//  for (int i = 0; i < NUM_PATTERNS; ++i) {
+//      bsl::string errorMessage;
+//      size_t      errorOffset;
+//
+//      int rc = rules.add(&errorMessage,
+//                         &errorOffset,
+//                         PATTERNS[i],
+//                         bdlpcre::RegEx::k_FLAG_CASELESS);
+//      assert(0 == rc);
+//  }
+//  assert(NUM_PATTERNS == rules.numPatterns());
+//..
+// Next, we observe the required literal extracted from each pattern.  Note
+// that none can be determined for the last pattern, which is therefore run
+// against every message:
+//..
+//  assert(" shares"   == rules.prefilterLiteral(0));
+//  assert("cancel"    == rules.prefilterLiteral(1));
+//  assert("account="  == rules.prefilterLiteral(2));
+//  assert(""          == rules.prefilterLiteral(3));
+//..
+// Now, we match a message against all the rules at once:
+//..
+//  const char MESSAGE[] = "ORDER IBM 100 shares account=12345678";
+//
+//  bsl::vector<int> matches;
+//
+//  int rc = rules.match(&matches, MESSAGE, sizeof(MESSAGE) - 1);
+//  assert(0 == rc);
+//..
+// Finally, we verify that the message is routed to the order desk and to the
+// account service:
+//..
+//  assert(2 == matches.size());
+//  assert(0 == matches[0]);
+//  assert(2 == matches[1]);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLPCRE_REGEX
+#include <bdlpcre_regex.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bdlpcre {
+
+                             // ==============
+                             // class RegExSet
+                             // ==============
+
+class RegExSet {
+    // This class provides a mechanism for matching a subject string against a
+    // set of regular expressions, and reporting which of them match.  Each
+    // pattern is held by a 'RegEx' object, and a shared Aho-Corasick
+    // automaton built from literals required by the patterns selects the
+    // patterns that need to be run against a given subject.
+
+    // PRIVATE DATA
+    bsl::vector<RegEx *>     d_regExes;         // one object per pattern,
+                                                // owned
+
+    bsl::vector<bsl::string> d_literals;        // required literal (in ASCII
+                                                // lower case) of each
+                                                // pattern, or "" if none
+
+    bsl::vector<int>         d_unfiltered;      // indices of the patterns
+                                                // without required literal
+
+    bsl::vector<int>         d_nextPattern;     // index of the next pattern
+                                                // ending at the same node as
+                                                // each pattern, or -1
+
+    int                      d_byteClasses[256];
+                                                // automaton input class of
+                                                // each byte value
+
+    int                      d_numClasses;      // number of input classes
+
+    bsl::vector<int>         d_transitions;     // next node for each (node,
+                                                // class), row-major
+
+    bsl::vector<int>         d_failures;        // failure node of each node
+
+    bsl::vector<int>         d_firstPatterns;   // index of the first pattern
+                                                // whose literal ends at each
+                                                // node, or -1
+
+    bsl::vector<int>         d_outputs;         // nearest node on the failure
+                                                // chain of each node
+                                                // (inclusive) at which a
+                                                // literal ends, or -1
+
+    bslma::Allocator        *d_allocator_p;     // memory allocator (held, not
+                                                // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RegExSet(const RegExSet&);
+    RegExSet& operator=(const RegExSet&);
+
+    // PRIVATE MANIPULATORS
+    void buildAutomaton();
+        // Rebuild the Aho-Corasick automaton of this object from
+        // 'd_literals'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RegExSet, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static void extractLiteral(bsl::string *result,
+                               const char  *pattern,
+                               int          flags);
+        // Load the specified 'result' with a string (in ASCII lower case)
+        // that is contained, ignoring ASCII case, in any subject matching the
+        // specified 'pattern' prepared with the specified 'flags', or with
+        // the empty string if no such string can be determined.  The
+        // behavior is undefined unless 'pattern' is a valid regular
+        // expression and 'flags' is a valid value for 'RegEx::prepare'.
+
+    // CREATORS
+    explicit RegExSet(bslma::Allocator *basicAllocator = 0);
+        // Create an empty regular-expression set.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~RegExSet();
+        // Destroy this regular-expression set.
+
+    // MANIPULATORS
+    int add(bsl::string *errorMessage,
+            size_t      *errorOffset,
+            const char  *pattern,
+            int          flags = 0,
+            size_t       jitStackSize = 0);
+        // Add to this set the specified 'pattern' prepared with the
+        // optionally specified 'flags' and 'jitStackSize' (see
+        // 'RegEx::prepare'), identified by the index 'numPatterns()' prior to
+        // this call.  On success, return 0 with no effect on the specified
+        // 'errorMessage' and 'errorOffset'.  Otherwise, (1) leave this set
+        // unchanged, (2) load 'errorMessage' (if non-null) with a string
+        // describing the error detected, (3) load 'errorOffset' (if non-null)
+        // with the offset in 'pattern' at which the error was detected, and
+        // (4) return a non-zero value.  The behavior is undefined unless
+        // 'flags' is a valid value for 'RegEx::prepare'.  Note that the cost
+        // of this method is linear in the total length of the required
+        // literals of the patterns of this set.
+
+    void clear();
+        // Remove all the patterns from this set.
+
+    // ACCESSORS
+    int match(bsl::vector<int> *result,
+              const char       *subject,
+              size_t            subjectLength) const;
+        // Load the specified 'result' with the indices, in ascending order,
+        // of the patterns of this set that match the specified 'subject'
+        // having the specified 'subjectLength'.  Return 0 on success, and 1
+        // if the depth limit was exceeded while matching one or more
+        // patterns, which are then considered not to match.  The behavior is
+        // undefined if a pattern of this set was added with
+        // 'RegEx::k_FLAG_UTF8', but 'subject' is not valid UTF-8.  Note that
+        // 'subject' need not be null-terminated and may contain embedded null
+        // characters.  Also note that 'subject' may be null if
+        // '0 == subjectLength' (denoting the empty string).
+
+    int numPatterns() const;
+        // Return the number of patterns in this set.
+
+    const bsl::string& prefilterLiteral(int index) const;
+        // Return a reference to the non-modifiable required literal (in ASCII
+        // lower case) of the pattern having the specified 'index' in this
+        // set, or to the empty string if the pattern is not prefiltered (see
+        // {Literal Prefiltering}).  The behavior is undefined unless
+        // '0 <= index < numPatterns()'.
+
+    const RegEx& regEx(int index) const;
+        // Return a reference to the non-modifiable regular-expression object
+        // holding the pattern having the specified 'index' in this set.  The
+        // behavior is undefined unless '0 <= index < numPatterns()'.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                             // --------------
+                             // class RegExSet
+                             // --------------
+
+// ACCESSORS
+inline
+int RegExSet::numPatterns() const
+{
+    return static_cast<int>(d_regExes.size());
+}
+
+inline
+const bsl::string& RegExSet::prefilterLiteral(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numPatterns());
+
+    return d_literals[index];
+}
+
+inline
+const RegEx& RegExSet::regEx(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numPatterns());
+
+    return *d_regExes[index];
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
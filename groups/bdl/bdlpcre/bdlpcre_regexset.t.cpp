@@ -0,0 +1,922 @@
+// bdlpcre_regexset.t.cpp                                             -*-C++-*-
+#include <bdlpcre_regexset.h>
+
+#include <bdlpcre_regex.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a mechanism holding a set of regular
+// expressions, and reporting which of them match a subject.  Its observable
+// behavior must be exactly that of matching the subject against each pattern
+// with a separate 'bdlpcre::RegEx' object; the prefiltering of the patterns
+// by their required literals is an optimization that must never exclude a
+// matching pattern.
+//
+// After breathing the component, we test the primary manipulators and basic
+// accessors.  We then test the extraction of required literals from a wide
+// range of patterns, verifying in particular that each extracted literal is
+// actually required by the pattern.  Then we test 'match' by comparing its
+// results, for many subjects, with those of individual 'bdlpcre::RegEx'
+// objects.  Finally, we test the usage example.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void extractLiteral(bsl::string *, const char *, int);
+//
+// CREATORS
+// [ 2] explicit RegExSet(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~RegExSet();
+//
+// MANIPULATORS
+// [ 2] int add(bsl::string *, size_t *, const char *, int, size_t);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 4] int match(bsl::vector<int> *, const char *, size_t) const;
+// [ 2] int numPatterns() const;
+// [ 2] const bsl::string& prefilterLiteral(int index) const;
+// [ 2] const RegEx& regEx(int index) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: PREFILTERED SET VS INDIVIDUAL PATTERNS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlpcre::RegExSet Obj;
+typedef bdlpcre::RegEx    RegEx;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool containsIgnoringCase(const char *subject, const bsl::string& literal)
+    // Return 'true' if the specified 'subject' contains the specified
+    // 'literal' ignoring ASCII case, and 'false' otherwise.
+{
+    const bsl::size_t length = bsl::strlen(subject);
+
+    for (bsl::size_t i = 0; i + literal.size() <= length; ++i) {
+        bsl::size_t j = 0;
+        for (; j < literal.size(); ++j) {
+            char c = subject[i + j];
+            if ('A' <= c && c <= 'Z') {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+            if (c != literal[j]) {
+                break;
+            }
+        }
+        if (literal.size() == j) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                test = argc > 1 ? atoi(argv[1]) : 0;
+    int             verbose = argc > 2;
+    int         veryVerbose = argc > 3;
+    int     veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Routing Messages
+///- - - - - - - - - - - - - -
+// Suppose that a message router has a set of rules, each of which forwards the
+// messages matching a regular expression to a destination.  We use a
+// 'bdlpcre::RegExSet' to find the rules applying to a message.
+//
+// First, we create the set and add the patterns of the rules, in order:
+//..
+    bdlpcre::RegExSet rules;
+
+    const char *const PATTERNS[] = {
+        "^ORDER [A-Z]+ (\\d+) shares",     // 0: order desk
+        "\\bcancel(led)?\\b",              // 1: cancellations
+        "account=(\\d{8})",                // 2: account service
+        "\\d{3}[-.]\\d{2}[-.]\\d{4}",      // 3: compliance (SSN-like data)
+    };
+    const int NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS;
+
+    for (int i = 0; i < NUM_PATTERNS; ++i) {
+        bsl::string errorMessage;
+        size_t      errorOffset;
+
+        int rc = rules.add(&errorMessage,
+                           &errorOffset,
+                           PATTERNS[i],
+                           bdlpcre::RegEx::k_FLAG_CASELESS);
+        ASSERT(0 == rc);
+    }
+    ASSERT(NUM_PATTERNS == rules.numPatterns());
+//..
+// Next, we observe the required literal extracted from each pattern.  Note
+// that none can be determined for the last pattern, which is therefore run
+// against every message:
+//..
+    ASSERT(" shares"   == rules.prefilterLiteral(0));
+    ASSERT("cancel"    == rules.prefilterLiteral(1));
+    ASSERT("account="  == rules.prefilterLiteral(2));
+    ASSERT(""          == rules.prefilterLiteral(3));
+//..
+// Now, we match a message against all the rules at once:
+//..
+    const char MESSAGE[] = "ORDER IBM 100 shares account=12345678";
+
+    bsl::vector<int> matches;
+
+    int rc = rules.match(&matches, MESSAGE, sizeof(MESSAGE) - 1);
+    ASSERT(0 == rc);
+//..
+// Finally, we verify that the message is routed to the order desk and to the
+// account service:
+//..
+    ASSERT(2 == matches.size());
+    ASSERT(0 == matches[0]);
+    ASSERT(2 == matches[1]);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'match'
+        //
+        // Concerns:
+        //: 1 'match' reports exactly the patterns that match the subject, as
+        //:   reported by separate 'RegEx' objects, in ascending order.
+        //:
+        //: 2 Patterns with and without required literals, patterns sharing a
+        //:   literal, patterns whose literal is a suffix or prefix of another
+        //:   literal, and caseless patterns are all handled correctly.
+        //:
+        //: 3 A literal that occurs at the start, the end, or several times in
+        //:   the subject, or overlaps another literal, is found.
+        //:
+        //: 4 Subjects may be empty (and null), and may contain embedded null
+        //:   characters and non-ASCII bytes.
+        //:
+        //: 5 The previous contents of 'result' are discarded.
+        //:
+        //: 6 An empty set matches nothing.
+        //
+        // Plan:
+        //: 1 Verify that an empty set matches no subject.  (C-6)
+        //:
+        //: 2 Add a table of patterns, covering the constructs of C-2, to a
+        //:   set and to separate 'RegEx' objects.  Then, for each subject of
+        //:   a table of subjects covering C-3..4, and for each of its
+        //:   substrings, compare the result of 'match' (supplied a non-empty
+        //:   'result') with the patterns matched by the 'RegEx' objects.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   int match(bsl::vector<int> *, const char *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'match'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting an empty set." << endl;
+        {
+            Obj mX(&ta); const Obj& X = mX;
+
+            bsl::vector<int> result(3, 7);
+
+            ASSERT(0 == X.match(&result, "abc", 3));
+            ASSERT(result.empty());
+
+            result.push_back(1);
+            ASSERT(0 == X.match(&result, 0, 0));
+            ASSERT(result.empty());
+        }
+
+        static const struct {
+            int         d_lineNum;   // source line number
+            const char *d_pattern;   // pattern string
+            int         d_flags;     // flags supplied to 'add'
+        } PATTERNS[] = {
+            //line  pattern                          flags
+            //----  -------                          -----
+            { L_,   "error",                         0                     },
+            { L_,   "error: (\\d+)",                 0                     },
+            { L_,   "ERROR",                         RegEx::k_FLAG_CASELESS},
+            { L_,   "(?i)warn(ing)?",                0                     },
+            { L_,   "^GET /api/v\\d+/",              0                     },
+            { L_,   "timeout after \\d+ ?ms",        0                     },
+            { L_,   "user=(\\w+)",                   0                     },
+            { L_,   "cat|dog",                       0                     },
+            { L_,   "\\d{3}-\\d{4}",                 0                     },
+            { L_,   "colou?r",                       0                     },
+            { L_,   "ab+c",                          0                     },
+            { L_,   "[xyz]{3}",                      0                     },
+            { L_,   "price: \\$\\d+(\\.\\d\\d)?",    0                     },
+            { L_,   "END$",                          0                     },
+            { L_,   "(?:foo|bar)baz",                0                     },
+            { L_,   "a.c",                           0                     },
+            { L_,   "a.c",                        RegEx::k_FLAG_DOTMATCHESALL},
+            { L_,   "^line2",                        RegEx::k_FLAG_MULTILINE},
+            { L_,   "he",                            0                     },
+            { L_,   "she",                           0                     },
+            { L_,   "hers",                          0                     },
+            { L_,   "his",                           0                     },
+            { L_,   "x{0,2}yy",                      0                     },
+            { L_,   "a\\x00b",                       0                     },
+            { L_,   "\\xe9t\\xe9",                   0                     },
+            { L_,   "caf\xe9",                       0                     },
+            { L_,   "",                              0                     },
+            { L_,   "a{bc",                          0                     },
+            { L_,   "\\bword\\b",                    0                     },
+        };
+        const int NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS;
+
+        static const struct {
+            int         d_lineNum;   // source line number
+            const char *d_subject;   // subject
+            size_t      d_length;    // length of subject
+        } SUBJECTS[] = {
+#define S(X) X, sizeof(X) - 1
+            //line  subject
+            //----  -------
+            { L_,   S("")                                                 },
+            { L_,   S("error")                                            },
+            { L_,   S("Error: 42 after timeout after 15 ms")              },
+            { L_,   S("GET /api/v2/orders user=bob")                      },
+            { L_,   S("a cat and a DOG")                                  },
+            { L_,   S("call 555-1234 about the colour and the color")     },
+            { L_,   S("abbbbc xyzzy price: $12.50 THE END")               },
+            { L_,   S("foobaz barbaz fobaz")                              },
+            { L_,   S("a\nc line1\nline2")                                },
+            { L_,   S("ushers and his xxyy")                              },
+            { L_,   S("a\0b and \xe9t\xe9 at the caf\xe9")                },
+            { L_,   S("a{bc sword word")                                  },
+            { L_,   S("WARNING: warn warnings")                           },
+#undef S
+        };
+        const int NUM_SUBJECTS = sizeof SUBJECTS / sizeof *SUBJECTS;
+
+        Obj mX(&ta); const Obj& X = mX;
+
+        bsl::vector<RegEx *> regExes;
+
+        for (int i = 0; i < NUM_PATTERNS; ++i) {
+            const int   LINE    = PATTERNS[i].d_lineNum;
+            const char *PATTERN = PATTERNS[i].d_pattern;
+            const int   FLAGS   = PATTERNS[i].d_flags;
+
+            bsl::string errorMsg;
+            size_t      errorOffset;
+
+            ASSERTV(LINE, 0 == mX.add(&errorMsg,
+                                      &errorOffset,
+                                      PATTERN,
+                                      FLAGS));
+
+            regExes.push_back(new RegEx(&ta));
+            ASSERTV(LINE, 0 == regExes.back()->prepare(&errorMsg,
+                                                       &errorOffset,
+                                                       PATTERN,
+                                                       FLAGS));
+
+            if (veryVerbose) {
+                P_(LINE) P_(PATTERN) P(X.prefilterLiteral(i))
+            }
+        }
+
+        ASSERT(NUM_PATTERNS == X.numPatterns());
+
+        for (int ti = 0; ti < NUM_SUBJECTS; ++ti) {
+            const int    LINE    = SUBJECTS[ti].d_lineNum;
+            const char  *SUBJECT = SUBJECTS[ti].d_subject;
+            const size_t LENGTH  = SUBJECTS[ti].d_length;
+
+            // Match every substring of the subject.
+
+            for (size_t begin = 0; begin <= LENGTH; ++begin) {
+                for (size_t end = begin; end <= LENGTH; ++end) {
+                    const char *subject = LENGTH ? SUBJECT + begin : 0;
+                    const size_t length = end - begin;
+
+                    bsl::vector<int> expected;
+                    for (int i = 0; i < NUM_PATTERNS; ++i) {
+                        if (0 == regExes[i]->match(subject, length)) {
+                            expected.push_back(i);
+                        }
+                    }
+
+                    bsl::vector<int> result(2, -1);
+
+                    ASSERTV(LINE, begin, end,
+                            0 == X.match(&result, subject, length));
+                    ASSERTV(LINE, begin, end, expected.size(), result.size(),
+                            expected == result);
+                }
+            }
+        }
+
+        for (int i = 0; i < NUM_PATTERNS; ++i) {
+            delete regExes[i];
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'extractLiteral'
+        //
+        // Concerns:
+        //: 1 The extracted literal is the longest run of literal characters at
+        //:   the top level of the pattern, in ASCII lower case.
+        //:
+        //: 2 Characters made optional by a quantifier are excluded, and
+        //:   characters repeated by a quantifier end the run.
+        //:
+        //: 3 Groups, character classes, escape sequences (including their
+        //:   arguments), anchors, and the dot end the run, while escaped
+        //:   punctuation characters are literals.
+        //:
+        //: 4 No literal is extracted from patterns with a top-level
+        //:   alternation, or with constructs that change how the pattern is
+        //:   parsed.
+        //:
+        //: 5 Non-ASCII characters are kept or excluded as a whole, and are
+        //:   excluded from patterns that may match caselessly.
+        //:
+        //: 6 Every extracted literal is contained in every subject matching
+        //:   the pattern.
+        //
+        // Plan:
+        //: 1 Using a table-driven technique, verify the literal extracted
+        //:   from patterns covering C-1..5.
+        //:
+        //: 2 For each pattern that can be prepared, verify that the extracted
+        //:   literal is contained (ignoring ASCII case) in a subject matching
+        //:   the pattern, given by the table.  (C-6)
+        //
+        // Testing:
+        //   void extractLiteral(bsl::string *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'extractLiteral'" << endl
+                          << "========================" << endl;
+
+        const int CL = RegEx::k_FLAG_CASELESS;
+        const int U8 = RegEx::k_FLAG_UTF8;
+
+        static const struct {
+            int         d_lineNum;   // source line number
+            const char *d_pattern;   // pattern string
+            int         d_flags;     // flags
+            const char *d_expected;  // expected literal
+            const char *d_subject;   // a matching subject, or 0
+        } DATA[] = {
+          //line pattern              flags  expected     subject
+          //---- -------              -----  --------     -------
+          { L_,  "",                  0,     "",          ""               },
+          { L_,  "abc",               0,     "abc",       "xabcx"          },
+          { L_,  "ABC",               0,     "abc",       "ABC"            },
+          { L_,  "AbC",               CL,    "abc",       "aBc"            },
+          { L_,  "a|b",               0,     "",          "b"              },
+          { L_,  "abc|def",           0,     "",          "def"            },
+          { L_,  "(a|b)cd",           0,     "cd",        "bcd"            },
+          { L_,  "ab?cd",             0,     "cd",        "acd"            },
+          { L_,  "abc*de",            0,     "ab",        "abde"           },
+          { L_,  "abc+de",            0,     "abc",       "abccde"         },
+          { L_,  "ab{0,3}cde",        0,     "cde",       "acde"           },
+          { L_,  "ab{0}cde",          0,     "cde",       "acde"           },
+          { L_,  "abc{2}d",           0,     "abc",       "abccd"          },
+          { L_,  "abc{2,}d",          0,     "abc",       "abcccd"         },
+          { L_,  "a{bc",              0,     "a{bc",      "a{bc"           },
+          { L_,  "a{,2}bc",           0,     "a{,2}bc",   "a{,2}bc"        },
+          { L_,  "ab*?cd",            0,     "cd",        "acd"            },
+          { L_,  "ab+?cd",            0,     "ab",        "abcd"           },
+          { L_,  "ab?+cd",            0,     "cd",        "acd"            },
+          { L_,  "x\\.y",             0,     "x.y",       "x.y"            },
+          { L_,  "x\\\\y",            0,     "x\\y",      "x\\y"           },
+          { L_,  "\\(ab\\)",          0,     "(ab)",      "(ab)"           },
+          { L_,  "\\d+ apples",       0,     " apples",   "3 apples"       },
+          { L_,  "[abc]+xyz",         0,     "xyz",       "bxyz"           },
+          { L_,  "[]ab]xyz",          0,     "xyz",       "]xyz"           },
+          { L_,  "[^]ab]xyz",         0,     "xyz",       "cxyz"           },
+          { L_,  "[[:alpha:]]]x",     0,     "]x",        "q]x"            },
+          { L_,  "[a\\]]bcd",         0,     "bcd",       "]bcd"           },
+          { L_,  "\\p{Lu}hello",      0,     "hello",     0                },
+          { L_,  "\\pLhello",         0,     "hello",     0                },
+          { L_,  "\\x41bc",           0,     "bc",        "Abc"            },
+          { L_,  "\\x{41}bc",         0,     "bc",        "Abc"            },
+          { L_,  "\\101bc",           0,     "bc",        "Abc"            },
+          { L_,  "(a)\\1bc",          0,     "bc",        "aabc"           },
+          { L_,  "(?<n>a)\\k<n>bc",   0,     "bc",        "aabc"           },
+          { L_,  "(a)\\g{1}bc",       0,     "bc",        "aabc"           },
+          { L_,  "(a)\\g1bc",         0,     "bc",        "aabc"           },
+          { L_,  "\\cAbc",            0,     "bc",        "\x01" "bc"      },
+          { L_,  "\\Qabc\\E",         0,     "",          "abc"            },
+          { L_,  "(?x)a b c",         0,     "",          "abc"            },
+          { L_,  "(*UTF)abc",         0,     "",          0                },
+          { L_,  "(?i)abc",           0,     "abc",       "ABC"            },
+          { L_,  "a.b.cdef",          0,     "cdef",      "axbycdef"       },
+          { L_,  "^start",            0,     "start",     "start"          },
+          { L_,  "end$",              0,     "end",       "the end"        },
+          { L_,  "\\bword\\b",        0,     "word",      "a word"         },
+          { L_,  "[a-z]+",            0,     "",          "x"              },
+          { L_,  "foo(?=bar)",        0,     "foo",       "foobar"         },
+          { L_,  "(?<=pre)fix",       0,     "fix",       "prefix"         },
+          { L_,  "(foo(bar)?)+baz",   0,     "baz",       "foobaz"         },
+          { L_,  "(a|b)",             0,     "",          "a"              },
+          { L_,  "(?#note)abc",       0,     "abc",       "abc"            },
+          { L_,  "caf\xc3\xa9",       U8,    "caf\xc3\xa9", 0              },
+          { L_,  "caf\xc3\xa9?",      U8,    "caf",       0                },
+          { L_,  "caf\xc3\xa9",       U8|CL, "caf",       0                },
+          { L_,  "(?i)caf\xc3\xa9",   U8,    "caf",       0                },
+          { L_,  "caf\xe9",           0,     "caf\xe9",   "caf\xe9"        },
+          { L_,  "caf\xe9?",          0,     "caf",       "caf"            },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_lineNum;
+            const char *PATTERN  = DATA[ti].d_pattern;
+            const int   FLAGS    = DATA[ti].d_flags;
+            const char *EXPECTED = DATA[ti].d_expected;
+            const char *SUBJECT  = DATA[ti].d_subject;
+
+            if (veryVerbose) { P_(LINE) P_(PATTERN) P(EXPECTED) }
+
+            bsl::string result("garbage", &ta);
+
+            Obj::extractLiteral(&result, PATTERN, FLAGS);
+
+            ASSERTV(LINE, PATTERN, EXPECTED, result, EXPECTED == result);
+
+            if (SUBJECT) {
+                RegEx regEx(&ta);
+
+                ASSERTV(LINE, 0 == regEx.prepare(0, 0, PATTERN, FLAGS));
+                ASSERTV(LINE, 0 == regEx.match(SUBJECT,
+                                               bsl::strlen(SUBJECT)));
+                ASSERTV(LINE, containsIgnoringCase(SUBJECT, result));
+            }
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed set is empty.
+        //:
+        //: 2 'add' appends a pattern, prepared with the supplied flags, that
+        //:   is identified by the next index.
+        //:
+        //: 3 'add' fails for an invalid pattern, reporting the error, and
+        //:   leaves the set unchanged.
+        //:
+        //: 4 'clear' removes all the patterns, after which patterns can be
+        //:   added again.
+        //:
+        //: 5 All memory is supplied by the allocator supplied at
+        //:   construction, and is released by 'clear' and the destructor.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a set with a test allocator, and verify that it is empty.
+        //:   (C-1)
+        //:
+        //: 2 Add patterns, and after each verify 'numPatterns', 'regEx', and
+        //:   'prefilterLiteral'.  (C-2)
+        //:
+        //: 3 Add an invalid pattern, and verify the error and the state of
+        //:   the set.  (C-3)
+        //:
+        //: 4 Clear the set, verify that it is empty and that memory was
+        //:   released, then add a pattern again.  Verify that no memory is in
+        //:   use after the set is destroyed.  (C-4..5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid indices.  (C-6)
+        //
+        // Testing:
+        //   explicit RegExSet(bslma::Allocator *basicAllocator = 0);
+        //   ~RegExSet();
+        //   int add(bsl::string *, size_t *, const char *, int, size_t);
+        //   void clear();
+        //   int numPatterns() const;
+        //   const bsl::string& prefilterLiteral(int index) const;
+        //   const RegEx& regEx(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << endl
+                 << "TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                 << "================================================" << endl;
+        }
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&ta); const Obj& X = mX;
+
+            ASSERT(0 == X.numPatterns());
+
+            bsl::string errorMsg(&sa);
+            size_t      errorOffset = 99;
+
+            ASSERT(0 == mX.add(&errorMsg, &errorOffset, "Hello, world"));
+            ASSERT(1 == X.numPatterns());
+            ASSERT("Hello, world" == X.regEx(0).pattern());
+            ASSERT(0              == X.regEx(0).flags());
+            ASSERT("hello, world" == X.prefilterLiteral(0));
+            ASSERT(errorMsg.empty());
+            ASSERT(99 == errorOffset);
+
+            ASSERT(0 == mX.add(&errorMsg,
+                               &errorOffset,
+                               "\\d+",
+                               RegEx::k_FLAG_CASELESS));
+            ASSERT(2 == X.numPatterns());
+            ASSERT("\\d+" == X.regEx(1).pattern());
+            ASSERT(RegEx::k_FLAG_CASELESS == X.regEx(1).flags());
+            ASSERT(""     == X.prefilterLiteral(1));
+
+            ASSERT(0 == mX.add(0,
+                               0,
+                               "x(y)z",
+                               RegEx::k_FLAG_JIT,
+                               64 * 1024));
+            ASSERT(3 == X.numPatterns());
+            ASSERT(RegEx::k_FLAG_JIT == X.regEx(2).flags());
+            ASSERT("x"               == X.prefilterLiteral(2));
+
+            if (verbose) cout << "\nTesting an invalid pattern." << endl;
+
+            ASSERT(0 != mX.add(&errorMsg, &errorOffset, "ab(cd"));
+            ASSERT(!errorMsg.empty());
+            ASSERTV(errorOffset, 5 == errorOffset);
+            ASSERT(3 == X.numPatterns());
+
+            bsl::vector<int> result(&sa);
+            ASSERT(0 == X.match(&result, "Hello, world 42", 15));
+            ASSERT(2 == result.size());
+            ASSERT(0 == result[0]);
+            ASSERT(1 == result[1]);
+
+            if (verbose) cout << "\nTesting 'clear'." << endl;
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            mX.clear();
+
+            ASSERT(0 == X.numPatterns());
+            ASSERT(0 == X.match(&result, "Hello, world 42", 15));
+            ASSERT(result.empty());
+
+            // The 'RegEx' objects are destroyed, but the capacity of the
+            // internal vectors is retained.
+
+            ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS > ta.numBlocksInUse());
+
+            ASSERT(0 == mX.add(&errorMsg, &errorOffset, "again"));
+            ASSERT(1 == X.numPatterns());
+            ASSERT("again" == X.prefilterLiteral(0));
+
+            if (verbose) cout << "\nNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_SAFE_PASS(X.regEx(0));
+                ASSERT_SAFE_FAIL(X.regEx(-1));
+                ASSERT_SAFE_FAIL(X.regEx(1));
+                ASSERT_SAFE_PASS(X.prefilterLiteral(0));
+                ASSERT_SAFE_FAIL(X.prefilterLiteral(-1));
+                ASSERT_SAFE_FAIL(X.prefilterLiteral(1));
+            }
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add a few patterns to a set, and match a few subjects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX; const Obj& X = mX;
+
+        ASSERT(0 == mX.add(0, 0, "quick brown"));
+        ASSERT(0 == mX.add(0, 0, "lazy (dog|cat)"));
+        ASSERT(0 == mX.add(0, 0, "[0-9]+"));
+        ASSERT(3 == X.numPatterns());
+
+        bsl::vector<int> result;
+
+        const char S1[] = "the quick brown fox jumps over the lazy dog";
+        ASSERT(0 == X.match(&result, S1, sizeof(S1) - 1));
+        ASSERT(2 == result.size());
+        ASSERT(0 == result[0]);
+        ASSERT(1 == result[1]);
+
+        const char S2[] = "42 lazy cats";
+        ASSERT(0 == X.match(&result, S2, sizeof(S2) - 1));
+        ASSERT(2 == result.size());
+        ASSERT(1 == result[0]);
+        ASSERT(2 == result[1]);
+
+        const char S3[] = "nothing to see";
+        ASSERT(0 == X.match(&result, S3, sizeof(S3) - 1));
+        ASSERT(result.empty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PREFILTERED SET VS INDIVIDUAL PATTERNS
+        //
+        // Concerns:
+        //: 1 Matching a subject against a large set of patterns costs much
+        //:   less than matching it against each pattern in turn, and does not
+        //:   grow linearly with the number of patterns.
+        //
+        // Plan:
+        //: 1 Generate sets of 10, 100, and 300 routing-rule-like patterns,
+        //:   each requiring a distinct keyword.  Match a set of typical
+        //:   messages, a (configurable) number of times, against both a
+        //:   'RegExSet' and individual 'RegEx' objects, verify that the
+        //:   results agree, and report the throughput of both.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: PREFILTERED SET VS INDIVIDUAL PATTERNS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: PREFILTERED SET VS INDIVIDUAL PATTERNS" << endl
+             << "===================================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 10000;
+
+        static const char *const MESSAGES[] = {
+            "type=ORDER id=123456 sym=IBM side=BUY qty=100 px=145.20 "
+            "route=rule17 account=00012345",
+            "type=CANCEL id=123457 sym=MSFT reason=user route=rule242",
+            "type=HEARTBEAT seq=99182 source=feed-a",
+            "type=FILL id=123456 sym=IBM qty=100 px=145.21 venue=XNYS "
+            "route=rule99",
+        };
+        const int NUM_MESSAGES = sizeof MESSAGES / sizeof *MESSAGES;
+
+        static const int SET_SIZES[] = { 10, 100, 300 };
+        const int NUM_SET_SIZES = sizeof SET_SIZES / sizeof *SET_SIZES;
+
+        for (int si = 0; si < NUM_SET_SIZES; ++si) {
+            const int NUM_RULES = SET_SIZES[si];
+
+            Obj                  set;
+            bsl::vector<RegEx *> regExes;
+
+            for (int i = 0; i < NUM_RULES; ++i) {
+                bsl::ostringstream pattern;
+                pattern << "route=rule" << i << "\\b.*|"
+                        << "\\bsym=[A-Z]+ .*route=rule" << i << "\\b";
+                bsl::ostringstream keyword;
+                keyword << "route=rule" << i << "\\b(?:.*qty=(\\d+))?";
+
+                const bsl::string& PATTERN = 0 == i % 50 ? pattern.str()
+                                                         : keyword.str();
+
+                ASSERTV(i, 0 == set.add(0, 0, PATTERN.c_str()));
+
+                regExes.push_back(new RegEx());
+                ASSERTV(i, 0 == regExes.back()->prepare(0,
+                                                        0,
+                                                        PATTERN.c_str()));
+            }
+
+            bsl::size_t lengths[NUM_MESSAGES];
+            for (int j = 0; j < NUM_MESSAGES; ++j) {
+                lengths[j] = bsl::strlen(MESSAGES[j]);
+            }
+
+            bsl::vector<int> result;
+            bsl::vector<int> expected;
+            int              numSetMatches        = 0;
+            int              numIndividualMatches = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            for (int n = 0; n < NUM_ITERATIONS; ++n) {
+                for (int j = 0; j < NUM_MESSAGES; ++j) {
+                    set.match(&result, MESSAGES[j], lengths[j]);
+                    numSetMatches += static_cast<int>(result.size());
+                }
+            }
+
+            timer.stop();
+            const double setTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+
+            for (int n = 0; n < NUM_ITERATIONS; ++n) {
+                for (int j = 0; j < NUM_MESSAGES; ++j) {
+                    expected.clear();
+                    for (int i = 0; i < NUM_RULES; ++i) {
+                        if (0 == regExes[i]->match(MESSAGES[j], lengths[j])) {
+                            expected.push_back(i);
+                        }
+                    }
+                    numIndividualMatches +=
+                                           static_cast<int>(expected.size());
+                }
+            }
+
+            timer.stop();
+            const double individualTime = timer.elapsedTime();
+
+            ASSERTV(NUM_RULES, numSetMatches, numIndividualMatches,
+                    numSetMatches == numIndividualMatches);
+
+            const double numMessages = static_cast<double>(NUM_ITERATIONS)
+                                                               * NUM_MESSAGES;
+
+            cout << "Patterns: " << NUM_RULES << endl
+                 << "\tindividual: " << individualTime << "s ("
+                 << (individualTime > 0 ? numMessages / individualTime : 0)
+                 << " messages/s)" << endl
+                 << "\tset:        " << setTime << "s ("
+                 << (setTime > 0 ? numMessages / setTime : 0)
+                 << " messages/s)" << endl;
+
+            for (int i = 0; i < NUM_RULES; ++i) {
+                delete regExes[i];
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
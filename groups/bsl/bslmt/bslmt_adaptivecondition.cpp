@@ -0,0 +1,120 @@
+// bslmt_adaptivecondition.cpp                                        -*-C++-*-
+#include <bslmt_adaptivecondition.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_adaptivecondition_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>   // for testing only
+#include <bslmt_threadutil.h>  // for testing only
+
+///Implementation Note
+///===================
+// On Linux, 'd_sequence' is the futex word on which waiting threads block.  A
+// waiting thread loads the sequence number while it still holds the mutex,
+// and then blocks only if the sequence number is unchanged.  Since 'signal'
+// and 'broadcast' increment the sequence number before waking threads, a
+// signal issued after the waiting thread released the mutex either changes
+// the sequence number before the thread blocks (so that it does not block),
+// or wakes it.
+//
+// 'd_numWaiters' allows 'signal' and 'broadcast' to skip the system call when
+// no thread is waiting.  The increment of 'd_numWaiters' by a waiting thread
+// and the increment of 'd_sequence' by a signaling thread are sequentially
+// consistent, so that a signaling thread that observes no waiters is
+// guaranteed to have incremented the sequence number before any waiting
+// thread that it failed to observe loaded it.
+//
+// 'broadcast' wakes all waiting threads, which then contend for the mutex.
+// 'bslmt::Condition' on Linux (via 'pthread_cond_broadcast') avoids this
+// "thundering herd" by requeueing the threads on the mutex; this is not done
+// here, since the adaptive mutex is meant for short critical sections, in
+// which the contending threads mostly acquire the mutex by spinning.
+
+namespace BloombergLP {
+namespace bslmt {
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+
+                          // -----------------------
+                          // class AdaptiveCondition
+                          // -----------------------
+
+// MANIPULATORS
+void AdaptiveCondition::broadcast()
+{
+    bsls::AtomicOperations::addInt(&d_sequence, 1);
+
+    if (bsls::AtomicOperations::getInt(&d_numWaiters)) {
+        FutexUtil::wakeAll(&d_sequence);
+    }
+}
+
+void AdaptiveCondition::signal()
+{
+    bsls::AtomicOperations::addInt(&d_sequence, 1);
+
+    if (bsls::AtomicOperations::getInt(&d_numWaiters)) {
+        FutexUtil::wake(&d_sequence, 1);
+    }
+}
+
+int AdaptiveCondition::timedWait(AdaptiveMutex             *mutex,
+                                 const bsls::TimeInterval&  absTime)
+{
+    BSLS_ASSERT(mutex);
+
+    const int sequence = bsls::AtomicOperations::getIntRelaxed(&d_sequence);
+    bsls::AtomicOperations::addInt(&d_numWaiters, 1);
+
+    mutex->unlock();
+
+    const int rc = FutexUtil::timedWait(&d_sequence,
+                                        sequence,
+                                        absTime,
+                                        d_clockType);
+
+    bsls::AtomicOperations::addInt(&d_numWaiters, -1);
+
+    mutex->lock();
+
+    return rc;
+}
+
+int AdaptiveCondition::wait(AdaptiveMutex *mutex)
+{
+    BSLS_ASSERT(mutex);
+
+    const int sequence = bsls::AtomicOperations::getIntRelaxed(&d_sequence);
+    bsls::AtomicOperations::addInt(&d_numWaiters, 1);
+
+    mutex->unlock();
+
+    const int rc = FutexUtil::wait(&d_sequence, sequence);
+
+    bsls::AtomicOperations::addInt(&d_numWaiters, -1);
+
+    mutex->lock();
+
+    return rc;
+}
+
+#endif  // BSLMT_PLATFORM_LINUX_FUTEX
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,318 @@
+// bslmt_adaptivecondition.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLMT_ADAPTIVECONDITION
+#define INCLUDED_BSLMT_ADAPTIVECONDITION
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a condition variable for use with 'bslmt::AdaptiveMutex'.
+//
+//@CLASSES:
+//  bslmt::AdaptiveCondition: condition variable working with 'AdaptiveMutex'
+//
+//@SEE_ALSO: bslmt_adaptivemutex, bslmt_condition, bslmt_futexutil
+//
+//@DESCRIPTION: This component provides a condition variable,
+// 'bslmt::AdaptiveCondition', having the same interface as 'bslmt::Condition'
+// except that it works with a 'bslmt::AdaptiveMutex' rather than a
+// 'bslmt::Mutex'.
+//
+// On Linux, an 'AdaptiveCondition' is a futex word (see 'bslmt_futexutil')
+// holding a sequence number, which 'signal' and 'broadcast' increment, and a
+// count of waiting threads.  A waiting thread records the sequence number
+// before unlocking the mutex, and blocks only if the sequence number has not
+// changed since; this ensures that no signal issued after the waiting thread
+// unlocked the mutex is lost.  'signal' and 'broadcast' enter the kernel only
+// if threads are waiting.  On platforms without a native futex facility,
+// 'AdaptiveCondition' is a thin wrapper around 'bslmt::Condition'.
+//
+// Note that, as for 'bslmt::Condition', spurious wake-ups are possible, and a
+// waiting thread must re-examine the predicate it is waiting for after each
+// return from 'wait' or 'timedWait'.
+//
+///Supported Clock-Types
+///---------------------
+// The component 'bsls::SystemClockType' supplies the enumeration indicating
+// the system clock on which timeouts supplied to other methods should be
+// based.  If the clock type indicated at construction is
+// 'bsls::SystemClockType::e_REALTIME', the timeout should be expressed as an
+// absolute offset since 00:00:00 UTC, January 1, 1970 (which matches the epoch
+// used in 'bsls::SystemTime::now(bsls::SystemClockType::e_REALTIME)'.  If the
+// clock type indicated at construction is
+// 'bsls::SystemClockType::e_MONOTONIC', the timeout should be expressed as an
+// absolute offset since the epoch of this clock (which matches the epoch used
+// in 'bsls::SystemTime::now(bsls::SystemClockType::e_MONOTONIC)'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Bounded Hand-Off Slot
+/// - - - - - - - - - - - - - - - - -
+// In this example we implement a slot through which a producer thread hands
+// single integers to a consumer thread.  The critical sections are very short,
+// which makes the adaptive primitives a good fit.
+//
+// First, we define the slot type:
+//..
+//  class HandOffSlot {
+//      // DATA
+//      bslmt::AdaptiveMutex     d_mutex;
+//      bslmt::AdaptiveCondition d_changed;
+//      bool                     d_full;
+//      int                      d_value;
+//
+//    public:
+//      // CREATORS
+//      HandOffSlot()
+//      : d_full(false)
+//      , d_value(0)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      void put(int value)
+//      {
+//          bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&d_mutex);
+//          while (d_full) {
+//              d_changed.wait(&d_mutex);
+//          }
+//          d_value = value;
+//          d_full  = true;
+//          d_changed.broadcast();
+//      }
+//
+//      int take()
+//      {
+//          bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&d_mutex);
+//          while (!d_full) {
+//              d_changed.wait(&d_mutex);
+//          }
+//          d_full = false;
+//          d_changed.broadcast();
+//          return d_value;
+//      }
+//  };
+//..
+// Then, we start a consumer thread that takes 100 values from the slot and
+// sums them:
+//..
+//  HandOffSlot slot;
+//  int         sum = 0;
+//
+//  bslmt::ThreadUtil::Handle handle;
+//  bslmt::ThreadUtil::create(&handle, consumer, 0);  // sums 100 'take's
+//..
+// Finally, we put the values 1 to 100 into the slot, join the consumer, and
+// verify the sum:
+//..
+//  for (int i = 1; i <= 100; ++i) {
+//      slot.put(i);
+//  }
+//  bslmt::ThreadUtil::join(handle);
+//  assert(5050 == sum);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_ADAPTIVEMUTEX
+#include <bslmt_adaptivemutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_FUTEXUTIL
+#include <bslmt_futexutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_SYSTEMCLOCKTYPE
+#include <bsls_systemclocktype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmt {
+
+                          // =======================
+                          // class AdaptiveCondition
+                          // =======================
+
+class AdaptiveCondition {
+    // This class implements an inter-thread signaling primitive for use with
+    // 'AdaptiveMutex', which enters the kernel only to block, and to wake
+    // threads that are blocked.
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Int d_sequence;
+                                        // futex word incremented by each
+                                        // 'signal' and 'broadcast'
+
+    bsls::AtomicOperations::AtomicTypes::Int d_numWaiters;
+                                        // number of threads in 'wait' or
+                                        // 'timedWait'
+
+    bsls::SystemClockType::Enum              d_clockType;
+                                        // clock against which 'timedWait'
+                                        // timeouts are interpreted
+#else
+    // DATA
+    Condition d_condition;              // underlying condition variable
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveCondition(const AdaptiveCondition&);
+    AdaptiveCondition& operator=(const AdaptiveCondition&);
+
+  public:
+    // CREATORS
+    explicit
+    AdaptiveCondition(
+    bsls::SystemClockType::Enum clockType = bsls::SystemClockType::e_REALTIME);
+        // Create a condition variable object.  Optionally specify a
+        // 'clockType' indicating the type of the system clock against which
+        // the 'bsls::TimeInterval' timeouts passed to the 'timedWait' method
+        // are to be interpreted.  If 'clockType' is not specified then the
+        // realtime system clock is used.
+
+    ~AdaptiveCondition();
+        // Destroy this condition variable object.  The behavior is undefined
+        // if any thread is waiting on this condition.
+
+    // MANIPULATORS
+    void broadcast();
+        // Signal this condition variable object by waking up *all* threads
+        // that are currently waiting on this condition.  If there are no
+        // threads waiting on this condition, this method has no effect.
+
+    void signal();
+        // Signal this condition variable object by waking up a single thread
+        // that is currently waiting on this condition.  If there are no
+        // threads waiting on this condition, this method has no effect.
+
+    int timedWait(AdaptiveMutex *mutex, const bsls::TimeInterval& absTime);
+        // Atomically unlock the specified 'mutex' and suspend execution of the
+        // current thread until this condition object is "signaled" (i.e., one
+        // of the 'signal' or 'broadcast' methods is invoked on this object) or
+        // until the specified 'absTime' timeout, then re-acquire a lock on the
+        // 'mutex'.  'absTime' is an absolute time represented as an interval
+        // from some epoch, which is determined by the clock indicated at
+        // construction (see {Supported Clock-Types} in the component
+        // documentation).  Return 0 on success, -1 on timeout, and a non-zero
+        // value different from -1 if an error occurs.  The behavior is
+        // undefined unless 'mutex' is locked by the calling thread prior to
+        // calling this method.  Note that 'mutex' remains locked by the
+        // calling thread upon returning from this function.  Also note that
+        // spurious wakeups are possible, i.e., this method may succeed (return
+        // 0) and return control to the thread without the condition object
+        // being signaled.
+
+    int wait(AdaptiveMutex *mutex);
+        // Atomically unlock the specified 'mutex' and suspend execution of the
+        // current thread until this condition object is "signaled" (i.e.,
+        // either 'signal' or 'broadcast' is invoked on this object in another
+        // thread), then re-acquire a lock on the 'mutex'.  Return 0 on
+        // success, and a non-zero value otherwise.  Spurious wakeups are
+        // possible; i.e., this method may succeed (return 0), and return
+        // control to the thread without the condition object being signaled.
+        // The behavior is undefined unless 'mutex' is locked by the calling
+        // thread prior to calling this method.  Note that 'mutex' remains
+        // locked by the calling thread upon returning from this function.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class AdaptiveCondition
+                          // -----------------------
+
+// CREATORS
+inline
+AdaptiveCondition::AdaptiveCondition(bsls::SystemClockType::Enum clockType)
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+: d_clockType(clockType)
+{
+    bsls::AtomicOperations::initInt(&d_sequence, 0);
+    bsls::AtomicOperations::initInt(&d_numWaiters, 0);
+}
+#else
+: d_condition(clockType)
+{
+}
+#endif
+
+inline
+AdaptiveCondition::~AdaptiveCondition()
+{
+}
+
+#ifndef BSLMT_PLATFORM_LINUX_FUTEX
+
+// MANIPULATORS
+inline
+void AdaptiveCondition::broadcast()
+{
+    d_condition.broadcast();
+}
+
+inline
+void AdaptiveCondition::signal()
+{
+    d_condition.signal();
+}
+
+inline
+int AdaptiveCondition::timedWait(AdaptiveMutex             *mutex,
+                                 const bsls::TimeInterval&  absTime)
+{
+    return d_condition.timedWait(&mutex->d_mutex, absTime);
+}
+
+inline
+int AdaptiveCondition::wait(AdaptiveMutex *mutex)
+{
+    return d_condition.wait(&mutex->d_mutex);
+}
+
+#endif  // !BSLMT_PLATFORM_LINUX_FUTEX
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,480 @@
+// bslmt_adaptivecondition.t.cpp                                      -*-C++-*-
+#include <bslmt_adaptivecondition.h>
+
+#include <bslmt_adaptivemutex.h>
+#include <bslmt_lockguard.h>      // for testing only
+#include <bslmt_threadutil.h>     // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// A 'bslmt::AdaptiveCondition' is tested by verifying that 'timedWait' times
+// out against both supported clocks, that 'signal' and 'broadcast' without
+// waiters have no effect, and that 'signal' and 'broadcast' release threads
+// waiting on the condition, with the associated mutex re-acquired on return.
+// Waiting threads count themselves in a shared variable guarded by the mutex,
+// so that the signaling thread knows when they have entered 'wait'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] AdaptiveCondition(bsls::SystemClockType::Enum clockType = e_REALTIME);
+// [ 1] ~AdaptiveCondition();
+//
+// MANIPULATORS
+// [ 3] void broadcast();
+// [ 1] void signal();
+// [ 2] int timedWait(AdaptiveMutex *mutex, const bsls::TimeInterval& time);
+// [ 1] int wait(AdaptiveMutex *mutex);
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::AdaptiveCondition Obj;
+
+static bool verbose;
+static bool veryVerbose;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct WaitArgs {
+    // This 'struct' holds the state shared by threads executing
+    // 'waitForGo'.  All members other than the mutex and condition are
+    // guarded by 'd_mutex'.
+
+    bslmt::AdaptiveMutex d_mutex;         // mutex guarding this object
+    Obj                  d_condition;     // signaled when 'd_numGo' changes
+    Obj                  d_waiting;       // signaled when 'd_numWaiting'
+                                          // changes
+    int                  d_numGo;         // number of threads permitted to
+                                          // proceed
+    int                  d_numWaiting;    // number of threads waiting
+    int                  d_numDone;       // number of threads done
+    bool                 d_ownedOnReturn; // 'false' if a thread observed an
+                                          // unlocked mutex after 'wait'
+
+    WaitArgs()
+    : d_numGo(0)
+    , d_numWaiting(0)
+    , d_numDone(0)
+    , d_ownedOnReturn(true)
+    {
+    }
+};
+
+extern "C" void *waitForGo(void *arg)
+    // Wait on the condition of the 'WaitArgs' object addressed by the
+    // specified 'arg' until it permits this thread to proceed, consume the
+    // permission, and increment its number of threads done.
+{
+    WaitArgs *args = static_cast<WaitArgs *>(arg);
+
+    bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&args->d_mutex);
+
+    ++args->d_numWaiting;
+    args->d_waiting.signal();
+
+    while (0 == args->d_numGo) {
+        args->d_condition.wait(&args->d_mutex);
+
+        if (0 == args->d_mutex.tryLock()) {
+            args->d_ownedOnReturn = false;
+            args->d_mutex.unlock();
+        }
+    }
+    --args->d_numGo;
+    --args->d_numWaiting;
+    ++args->d_numDone;
+    return 0;
+}
+
+void waitForWaiters(WaitArgs *args, int numWaiting)
+    // Block until the specified 'numWaiting' threads are waiting on the
+    // condition of the specified 'args'.
+{
+    bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&args->d_mutex);
+    while (args->d_numWaiting < numWaiting) {
+        args->d_waiting.wait(&args->d_mutex);
+    }
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace BSLMT_USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Bounded Hand-Off Slot
+/// - - - - - - - - - - - - - - - - -
+// In this example we implement a slot through which a producer thread hands
+// single integers to a consumer thread.  The critical sections are very short,
+// which makes the adaptive primitives a good fit.
+//
+// First, we define the slot type:
+//..
+    class HandOffSlot {
+        // DATA
+        bslmt::AdaptiveMutex     d_mutex;
+        bslmt::AdaptiveCondition d_changed;
+        bool                     d_full;
+        int                      d_value;
+
+      public:
+        // CREATORS
+        HandOffSlot()
+        : d_full(false)
+        , d_value(0)
+        {
+        }
+
+        // MANIPULATORS
+        void put(int value)
+        {
+            bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&d_mutex);
+            while (d_full) {
+                d_changed.wait(&d_mutex);
+            }
+            d_value = value;
+            d_full  = true;
+            d_changed.broadcast();
+        }
+
+        int take()
+        {
+            bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&d_mutex);
+            while (!d_full) {
+                d_changed.wait(&d_mutex);
+            }
+            d_full = false;
+            d_changed.broadcast();
+            return d_value;
+        }
+    };
+//..
+
+    HandOffSlot slot;
+    int         sum = 0;
+
+    extern "C" void *consumer(void *)
+        // Take 100 values from 'slot' and add them to 'sum'.
+    {
+        for (int i = 0; i < 100; ++i) {
+            sum += slot.take();
+        }
+        return 0;
+    }
+
+}  // close namespace BSLMT_USAGE_EXAMPLE_1
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace BSLMT_USAGE_EXAMPLE_1;
+
+// Then, we start a consumer thread that takes 100 values from the slot and
+// sums them:
+//..
+    bslmt::ThreadUtil::Handle handle;
+    bslmt::ThreadUtil::create(&handle, consumer, 0);  // sums 100 'take's
+//..
+// Finally, we put the values 1 to 100 into the slot, join the consumer, and
+// verify the sum:
+//..
+    for (int i = 1; i <= 100; ++i) {
+        slot.put(i);
+    }
+    bslmt::ThreadUtil::join(handle);
+    ASSERT(5050 == sum);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'broadcast'
+        //
+        // Concerns:
+        //: 1 'broadcast' releases all threads waiting on the condition.
+        //:
+        //: 2 Each released thread holds the mutex on return from 'wait'.
+        //
+        // Plan:
+        //: 1 Start several threads waiting on the condition.  Once all are
+        //:   waiting, permit all of them to proceed and 'broadcast', and
+        //:   verify that all threads complete, having owned the mutex on
+        //:   return from 'wait'.  (C-1..2)
+        //
+        // Testing:
+        //   void broadcast();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'broadcast'" << endl
+                          << "===================" << endl;
+
+        enum { k_NUM_THREADS = 5 };
+
+        WaitArgs args;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  &waitForGo,
+                                                  &args));
+        }
+
+        waitForWaiters(&args, k_NUM_THREADS);
+
+        {
+            bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&args.d_mutex);
+            args.d_numGo = k_NUM_THREADS;
+            args.d_condition.broadcast();
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        ASSERTV(args.d_numDone, k_NUM_THREADS == args.d_numDone);
+        ASSERT(args.d_ownedOnReturn);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'timedWait'
+        //
+        // Concerns:
+        //: 1 'timedWait' returns -1 once the timeout expires, interpreting
+        //:   the timeout against the clock supplied at construction, and not
+        //:   before.
+        //:
+        //: 2 The mutex is held on return from 'timedWait'.
+        //:
+        //: 3 'timedWait' returns -1 for a timeout in the past.
+        //
+        // Plan:
+        //: 1 For each clock type, wait on a condition that is never signaled
+        //:   with a timeout 50 milliseconds in the future, re-waiting on
+        //:   spurious wake-ups, and verify the result, the elapsed time, and
+        //:   that the mutex is held.  (C-1..2)
+        //:
+        //: 2 Wait with a timeout of zero.  (C-3)
+        //
+        // Testing:
+        //   AdaptiveCondition(bsls::SystemClockType::Enum clockType);
+        //   int timedWait(AdaptiveMutex *mutex, const bsls::TimeInterval&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'timedWait'" << endl
+                          << "===================" << endl;
+
+        const bsls::SystemClockType::Enum CLOCKS[] = {
+            bsls::SystemClockType::e_REALTIME,
+            bsls::SystemClockType::e_MONOTONIC
+        };
+
+        for (int i = 0; i < 2; ++i) {
+            const bsls::SystemClockType::Enum CLOCK = CLOCKS[i];
+
+            if (veryVerbose) { P(CLOCK) }
+
+            bslmt::AdaptiveMutex mutex;
+            Obj                  mX(CLOCK);
+
+            mutex.lock();
+
+            const bsls::TimeInterval timeout =
+                                          bsls::SystemTime::now(CLOCK) + 0.05;
+
+            int rc;
+            do {
+                rc = mX.timedWait(&mutex, timeout);
+            } while (0 == rc);
+
+            ASSERTV(CLOCK, rc, -1 == rc);
+            ASSERTV(CLOCK, timeout <= bsls::SystemTime::now(CLOCK));
+            ASSERTV(CLOCK, 0 != mutex.tryLock());
+
+            ASSERTV(CLOCK, -1 == mX.timedWait(&mutex,
+                                              bsls::TimeInterval(0, 0)));
+            ASSERTV(CLOCK, 0 != mutex.tryLock());
+
+            mutex.unlock();
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 'signal' and 'broadcast' on a condition without waiters have no
+        //:   effect.
+        //:
+        //: 2 'signal' releases a thread waiting on the condition, which holds
+        //:   the mutex on return from 'wait'.
+        //
+        // Plan:
+        //: 1 Signal and broadcast a newly-created condition.  (C-1)
+        //:
+        //: 2 Start a thread waiting on the condition.  Once it is waiting,
+        //:   permit it to proceed and 'signal', and verify that it completes.
+        //:   (C-2)
+        //
+        // Testing:
+        //   ~AdaptiveCondition();
+        //   void signal();
+        //   int wait(AdaptiveMutex *mutex);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            Obj mX;
+
+            mX.signal();
+            mX.broadcast();
+        }
+
+        WaitArgs args;
+
+        bslmt::ThreadUtil::Handle handle;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle, &waitForGo, &args));
+
+        waitForWaiters(&args, 1);
+
+        {
+            bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&args.d_mutex);
+            args.d_numGo = 1;
+            args.d_condition.signal();
+        }
+
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        ASSERT(1 == args.d_numDone);
+        ASSERT(args.d_ownedOnReturn);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
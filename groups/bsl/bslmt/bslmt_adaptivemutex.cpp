@@ -0,0 +1,133 @@
+// bslmt_adaptivemutex.cpp                                            -*-C++-*-
+#include <bslmt_adaptivemutex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_adaptivemutex_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>   // for testing only
+#include <bslmt_threadutil.h>  // for testing only
+
+#include <bsls_platform.h>
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+#include <unistd.h>            // sysconf
+#endif
+
+///Implementation Note
+///===================
+// The Linux implementation follows the three-state futex mutex described in
+// "Futexes Are Tricky" (U. Drepper, 2011).  The futex word is 'e_UNLOCKED',
+// 'e_LOCKED' (no thread is parked), or 'e_PARKED' (threads may be parked).
+// A thread that has to park first swaps 'e_PARKED' into the word, so that the
+// owner's 'unlock', which swaps 'e_UNLOCKED' in, observes 'e_PARKED' and wakes
+// one parked thread.  A thread acquiring the mutex after parking keeps the
+// word 'e_PARKED' (it cannot know whether other threads are still parked),
+// which may cost one superfluous wake-up, but never loses one.
+//
+// Before parking, 'lockSlow' spins, bounded by about twice a per-mutex moving
+// average of the number of iterations after which spinning succeeded, in the
+// manner of glibc's 'PTHREAD_MUTEX_ADAPTIVE_NP' mutex type.  The average is
+// updated with relaxed atomic operations: it is a heuristic, and lost updates
+// are harmless.
+
+namespace BloombergLP {
+namespace bslmt {
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+
+namespace {
+
+inline
+void spinPause()
+    // Hint to the processor that the calling thread is spinning.
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    __asm__ __volatile__("pause" ::: "memory");
+#endif
+}
+
+bool isMultiprocessor()
+    // Return 'true' if the host has more than one online processor, and
+    // 'false' otherwise.
+{
+    static bsls::AtomicOperations::AtomicTypes::Int s_numProcessors = { -1 };
+
+    int numProcessors = bsls::AtomicOperations::getIntRelaxed(
+                                                            &s_numProcessors);
+    if (0 > numProcessors) {
+        numProcessors = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+        bsls::AtomicOperations::setIntRelaxed(&s_numProcessors,
+                                              numProcessors);
+    }
+    return 1 < numProcessors;
+}
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class AdaptiveMutex
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void AdaptiveMutex::lockSlow()
+{
+    if (0 < d_maxNumSpins && isMultiprocessor()) {
+        const int estimate = bsls::AtomicOperations::getIntRelaxed(
+                                                              &d_spinEstimate);
+
+        int limit = 2 * estimate + 10;
+        if (limit > d_maxNumSpins) {
+            limit = d_maxNumSpins;
+        }
+
+        for (int i = 0; i < limit; ++i) {
+            spinPause();
+
+            if (e_UNLOCKED == bsls::AtomicOperations::getIntRelaxed(&d_state)
+             && e_UNLOCKED == bsls::AtomicOperations::testAndSwapIntAcqRel(
+                                                                   &d_state,
+                                                                   e_UNLOCKED,
+                                                                   e_LOCKED)) {
+                bsls::AtomicOperations::setIntRelaxed(
+                                               &d_spinEstimate,
+                                               estimate + (i - estimate) / 8);
+                return;                                               // RETURN
+            }
+        }
+
+        bsls::AtomicOperations::setIntRelaxed(
+                                           &d_spinEstimate,
+                                           estimate + (limit - estimate) / 8);
+    }
+
+    while (e_UNLOCKED != bsls::AtomicOperations::swapIntAcqRel(&d_state,
+                                                               e_PARKED)) {
+        FutexUtil::wait(&d_state, e_PARKED);
+    }
+}
+
+void AdaptiveMutex::unlockSlow()
+{
+    FutexUtil::wake(&d_state, 1);
+}
+
+#endif  // BSLMT_PLATFORM_LINUX_FUTEX
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,343 @@
+// bslmt_adaptivemutex.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLMT_ADAPTIVEMUTEX
+#define INCLUDED_BSLMT_ADAPTIVEMUTEX
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mutex that spins for a bounded time before blocking.
+//
+//@CLASSES:
+//  bslmt::AdaptiveMutex: mutex spinning adaptively before parking in a futex
+//
+//@SEE_ALSO: bslmt_adaptivecondition, bslmt_mutex, bslmt_qlock, bslmt_futexutil
+//
+//@DESCRIPTION: This component provides a mutually exclusive lock,
+// 'bslmt::AdaptiveMutex', having the same interface as 'bslmt::Mutex', and
+// optimized for guarding *short* critical sections under contention.
+//
+// On Linux, an 'AdaptiveMutex' is a single futex word (see 'bslmt_futexutil')
+// manipulated with atomic operations, so that locking and unlocking an
+// uncontended mutex never enters the kernel.  A thread failing to acquire a
+// contended mutex first spins, re-trying to acquire it, for a bounded number
+// of iterations, on the expectation that the owner will soon release it; only
+// if the mutex is still locked after spinning does the thread block in the
+// kernel ("park").  An unlocking thread enters the kernel only if threads may
+// be parked on the mutex.
+//
+// The spin bound adapts to the observed behavior of the mutex: each mutex
+// tracks a moving average of the number of iterations after which spinning
+// threads acquired it, and spins for at most about twice that average (and
+// never more than the 'maxNumSpins' supplied at construction).  A mutex whose
+// owners hold it long therefore quickly stops wasting processor time on
+// spinning, while a mutex guarding a few instructions is almost always
+// acquired without blocking.  Spinning is disabled altogether on hosts having
+// a single processor, where it cannot succeed.
+//
+// On platforms without a native futex facility, 'AdaptiveMutex' is a thin
+// wrapper around 'bslmt::Mutex'.
+//
+// The choice between 'bslmt::Mutex' and 'bslmt::AdaptiveMutex' is made per
+// object, by choosing the type of the mutex.  A 'bslmt::AdaptiveMutex' is
+// used with 'bslmt::LockGuard' (and the other guards of 'bslmt') in exactly
+// the same way as a 'bslmt::Mutex', and with 'bslmt::AdaptiveCondition' where
+// a condition variable is required.  The following table summarizes the
+// trade-offs (see also 'bslmt_qlock'):
+//..
+//                                    | AdaptiveMutex | Mutex | SpinLock
+//  ----------------------------------+---------------+-------+---------
+//  Memory footprint                  | small         | large | small
+//  System calls when uncontended     | none          | none  | none
+//  System calls under contention     | rare          | yes   | none
+//  Suitable for long critical regions| yes           | yes   | no
+//  Fair                              | no            | no    | no
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Guarding a Shared Counter
+/// - - - - - - - - - - - - - - - - - -
+// In this example, several threads increment counters held in a shared map.
+// Each increment is a short critical section, which makes an
+// 'bslmt::AdaptiveMutex' a good fit.
+//
+// First, we define the shared state, and a function executed by each thread:
+//..
+//  struct SharedCounters {
+//      bslmt::AdaptiveMutex d_mutex;
+//      bsl::map<int, int>   d_counters;
+//  };
+//
+//  extern "C" void *incrementCounters(void *arg)
+//  {
+//      SharedCounters *shared = static_cast<SharedCounters *>(arg);
+//
+//      for (int i = 0; i < 1000; ++i) {
+//          bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&shared->d_mutex);
+//          ++shared->d_counters[i % 10];
+//      }
+//      return 0;
+//  }
+//..
+// Then, we run four threads incrementing the counters:
+//..
+//  SharedCounters shared;
+//
+//  bslmt::ThreadUtil::Handle handles[4];
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::create(&handles[i], &incrementCounters, &shared);
+//  }
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+// Finally, we observe that no increment was lost:
+//..
+//  for (int i = 0; i < 10; ++i) {
+//      assert(400 == shared.d_counters[i]);
+//  }
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_FUTEXUTIL
+#include <bslmt_futexutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmt {
+
+class AdaptiveCondition;
+
+                            // ===================
+                            // class AdaptiveMutex
+                            // ===================
+
+class AdaptiveMutex {
+    // This class implements a non-recursive mutex that spins for a bounded,
+    // adaptively-tuned number of iterations before blocking, and that enters
+    // the kernel only under contention on platforms supporting futexes.
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    // PRIVATE TYPES
+    enum {
+        e_UNLOCKED = 0,  // not locked
+        e_LOCKED   = 1,  // locked; no thread is parked
+        e_PARKED   = 2   // locked; threads may be parked
+    };
+
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Int d_state;
+                                        // futex word holding the state of
+                                        // this mutex ('e_UNLOCKED',
+                                        // 'e_LOCKED', or 'e_PARKED')
+
+    bsls::AtomicOperations::AtomicTypes::Int d_spinEstimate;
+                                        // moving average of the number of
+                                        // iterations a spinning thread needed
+                                        // to acquire this mutex
+
+    int                                      d_maxNumSpins;
+                                        // upper bound on the number of spin
+                                        // iterations
+#else
+    // DATA
+    Mutex d_mutex;                      // underlying mutex
+
+    int   d_maxNumSpins;                // ignored upper bound on the number
+                                        // of spin iterations
+#endif
+
+    // FRIENDS
+    friend class AdaptiveCondition;
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveMutex(const AdaptiveMutex&);
+    AdaptiveMutex& operator=(const AdaptiveMutex&);
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    // PRIVATE MANIPULATORS
+    void lockSlow();
+        // Acquire the lock on this mutex, which the calling thread failed to
+        // acquire without waiting, spinning and then blocking as necessary.
+
+    void unlockSlow();
+        // Wake a thread parked on this mutex, which has just been unlocked.
+#endif
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_DEFAULT_MAX_NUM_SPINS = 100  // default spin bound
+    };
+
+    // CREATORS
+    explicit
+    AdaptiveMutex(int maxNumSpins = k_DEFAULT_MAX_NUM_SPINS);
+        // Create a mutex object in the unlocked state.  Optionally specify
+        // 'maxNumSpins', the maximum number of times a thread attempting to
+        // lock this mutex while it is locked re-tries before blocking; if
+        // 'maxNumSpins' is not specified, 'k_DEFAULT_MAX_NUM_SPINS' is used.
+        // A 'maxNumSpins' of 0 disables spinning.  The behavior is undefined
+        // unless '0 <= maxNumSpins'.
+
+    ~AdaptiveMutex();
+        // Destroy this mutex object.  The behavior is undefined if the mutex
+        // is in a locked state.
+
+    // MANIPULATORS
+    void lock();
+        // Acquire a lock on this mutex object.  If this object is currently
+        // locked, spin for a bounded time and then suspend execution of the
+        // current thread until a lock can be acquired.  Note that the behavior
+        // is undefined if the calling thread already owns the lock on this
+        // mutex, and will likely result in a deadlock.
+
+    int tryLock();
+        // Attempt to acquire a lock on this mutex object.  Return 0 on
+        // success, and a non-zero value if this object is already locked, or
+        // if an error occurs.  This method does not block.
+
+    void unlock();
+        // Release a lock on this mutex that was previously acquired through a
+        // call to 'lock', or a successful call to 'tryLock', enabling another
+        // thread to acquire a lock on this mutex.  The behavior is undefined
+        // unless the calling thread currently owns the lock on this mutex.
+
+    // ACCESSORS
+    int maxNumSpins() const;
+        // Return the maximum number of times a thread attempting to lock this
+        // mutex while it is locked re-tries before blocking, as supplied at
+        // construction.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class AdaptiveMutex
+                            // -------------------
+
+// CREATORS
+inline
+AdaptiveMutex::AdaptiveMutex(int maxNumSpins)
+: d_maxNumSpins(maxNumSpins)
+{
+    BSLS_ASSERT_SAFE(0 <= maxNumSpins);
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    bsls::AtomicOperations::initInt(&d_state, e_UNLOCKED);
+    bsls::AtomicOperations::initInt(&d_spinEstimate, 0);
+#endif
+}
+
+inline
+AdaptiveMutex::~AdaptiveMutex()
+{
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    BSLS_ASSERT_SAFE(e_UNLOCKED ==
+                           bsls::AtomicOperations::getIntRelaxed(&d_state));
+#endif
+}
+
+// MANIPULATORS
+inline
+void AdaptiveMutex::lock()
+{
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(e_UNLOCKED !=
+            bsls::AtomicOperations::testAndSwapIntAcqRel(&d_state,
+                                                         e_UNLOCKED,
+                                                         e_LOCKED))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        lockSlow();
+    }
+#else
+    d_mutex.lock();
+#endif
+}
+
+inline
+int AdaptiveMutex::tryLock()
+{
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    return e_UNLOCKED != bsls::AtomicOperations::testAndSwapIntAcqRel(
+                                                                   &d_state,
+                                                                   e_UNLOCKED,
+                                                                   e_LOCKED);
+#else
+    return d_mutex.tryLock();
+#endif
+}
+
+inline
+void AdaptiveMutex::unlock()
+{
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(e_PARKED ==
+            bsls::AtomicOperations::swapIntAcqRel(&d_state, e_UNLOCKED))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        unlockSlow();
+    }
+#else
+    d_mutex.unlock();
+#endif
+}
+
+// ACCESSORS
+inline
+int AdaptiveMutex::maxNumSpins() const
+{
+    return d_maxNumSpins;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,525 @@
+// bslmt_adaptivemutex.t.cpp                                          -*-C++-*-
+#include <bslmt_adaptivemutex.h>
+
+#include <bslmt_lockguard.h>      // for testing only
+#include <bslmt_mutex.h>          // for testing only
+#include <bslmt_threadutil.h>     // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>              // for usage example
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// A 'bslmt::AdaptiveMutex' is tested first in a single thread, to verify the
+// state transitions performed by 'lock', 'tryLock', and 'unlock', and then
+// under contention from several threads, each incrementing a shared counter
+// under the lock, for spin bounds disabling spinning, the default bound, and
+// a large bound.  A lost increment indicates a failure of mutual exclusion.
+//
+// A negative test case compares the throughput of 'bslmt::AdaptiveMutex' and
+// 'bslmt::Mutex' guarding a short critical section.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] AdaptiveMutex(int maxNumSpins = k_DEFAULT_MAX_NUM_SPINS);
+// [ 1] ~AdaptiveMutex();
+//
+// MANIPULATORS
+// [ 1] void lock();
+// [ 1] int tryLock();
+// [ 1] void unlock();
+//
+// ACCESSORS
+// [ 1] int maxNumSpins() const;
+// ----------------------------------------------------------------------------
+// [ 2] CONCURRENCY TEST
+// [ 3] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::AdaptiveMutex Obj;
+
+static bool verbose;
+static bool veryVerbose;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class MUTEX>
+struct CounterArgs {
+    // This 'struct' holds the state shared by threads executing
+    // 'incrementCounter'.
+
+    MUTEX d_mutex;           // mutex guarding 'd_counter'
+    int   d_counter;         // shared counter
+    int   d_numIterations;   // number of increments per thread
+
+    explicit
+    CounterArgs(int numIterations)
+        // Create a 'CounterArgs' object, having a zero counter, for threads
+        // each incrementing the counter the specified 'numIterations' times.
+    : d_counter(0)
+    , d_numIterations(numIterations)
+    {
+    }
+
+    CounterArgs(int maxNumSpins, int numIterations)
+        // Create a 'CounterArgs' object, having a zero counter and a mutex
+        // constructed with the specified 'maxNumSpins', for threads each
+        // incrementing the counter the specified 'numIterations' times.
+    : d_mutex(maxNumSpins)
+    , d_counter(0)
+    , d_numIterations(numIterations)
+    {
+    }
+};
+
+template <class MUTEX>
+void *incrementCounter(void *arg)
+    // Increment the counter of the 'CounterArgs<MUTEX>' object addressed by
+    // the specified 'arg' the number of times indicated by that object, each
+    // time under the lock of its mutex.
+{
+    CounterArgs<MUTEX> *args = static_cast<CounterArgs<MUTEX> *>(arg);
+
+    for (int i = 0; i < args->d_numIterations; ++i) {
+        bslmt::LockGuard<MUTEX> guard(&args->d_mutex);
+
+        // Make the critical section long enough to observe a torn increment.
+
+        const int value = args->d_counter;
+        bslmt::ThreadUtil::yield();
+        args->d_counter = value + 1;
+    }
+    return 0;
+}
+
+extern "C" void *incrementAdaptive(void *arg)
+    // Invoke 'incrementCounter<bslmt::AdaptiveMutex>' with the specified
+    // 'arg'.
+{
+    return incrementCounter<bslmt::AdaptiveMutex>(arg);
+}
+
+template <class MUTEX>
+void *incrementCounterFast(void *arg)
+    // Increment the counter of the 'CounterArgs<MUTEX>' object addressed by
+    // the specified 'arg' the number of times indicated by that object, each
+    // time under the lock of its mutex, using the shortest possible critical
+    // section.
+{
+    CounterArgs<MUTEX> *args = static_cast<CounterArgs<MUTEX> *>(arg);
+
+    for (int i = 0; i < args->d_numIterations; ++i) {
+        args->d_mutex.lock();
+        ++args->d_counter;
+        args->d_mutex.unlock();
+    }
+    return 0;
+}
+
+extern "C" void *incrementAdaptiveFast(void *arg)
+    // Invoke 'incrementCounterFast<bslmt::AdaptiveMutex>' with the specified
+    // 'arg'.
+{
+    return incrementCounterFast<bslmt::AdaptiveMutex>(arg);
+}
+
+extern "C" void *incrementMutexFast(void *arg)
+    // Invoke 'incrementCounterFast<bslmt::Mutex>' with the specified 'arg'.
+{
+    return incrementCounterFast<bslmt::Mutex>(arg);
+}
+
+template <class MUTEX>
+double timeIncrements(CounterArgs<MUTEX> *args,
+                      void             *(*function)(void *),
+                      int                 numThreads)
+    // Run the specified 'function' with the specified 'args' in the specified
+    // 'numThreads' threads, and return the elapsed wall time in seconds.
+{
+    enum { k_MAX_NUM_THREADS = 64 };
+    BSLS_ASSERT(numThreads <= k_MAX_NUM_THREADS);
+
+    bslmt::ThreadUtil::Handle handles[k_MAX_NUM_THREADS];
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], function, args);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace BSLMT_USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Guarding a Shared Counter
+/// - - - - - - - - - - - - - - - - - -
+// In this example, several threads increment counters held in a shared map.
+// Each increment is a short critical section, which makes an
+// 'bslmt::AdaptiveMutex' a good fit.
+//
+// First, we define the shared state, and a function executed by each thread:
+//..
+    struct SharedCounters {
+        bslmt::AdaptiveMutex d_mutex;
+        bsl::map<int, int>   d_counters;
+    };
+
+    extern "C" void *incrementCounters(void *arg)
+    {
+        SharedCounters *shared = static_cast<SharedCounters *>(arg);
+
+        for (int i = 0; i < 1000; ++i) {
+            bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&shared->d_mutex);
+            ++shared->d_counters[i % 10];
+        }
+        return 0;
+    }
+//..
+
+}  // close namespace BSLMT_USAGE_EXAMPLE_1
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace BSLMT_USAGE_EXAMPLE_1;
+
+// Then, we run four threads incrementing the counters:
+//..
+    SharedCounters shared;
+
+    bslmt::ThreadUtil::Handle handles[4];
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], &incrementCounters, &shared);
+    }
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+//..
+// Finally, we observe that no increment was lost:
+//..
+    for (int i = 0; i < 10; ++i) {
+        ASSERT(400 == shared.d_counters[i]);
+    }
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 At most one thread holds the lock at any time, whether spinning
+        //:   is disabled, bounded by the default, or bounded by a large
+        //:   value.
+        //:
+        //: 2 Threads parked on the mutex are eventually woken (no lost
+        //:   wake-ups).
+        //
+        // Plan:
+        //: 1 For each of a set of spin bounds, run several threads, each
+        //:   incrementing a shared counter a number of times in a critical
+        //:   section that yields the processor between reading and writing
+        //:   the counter.  Verify that no increment is lost and that all
+        //:   threads terminate.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_THREADS = 6, k_NUM_ITERATIONS = 2000 };
+
+        const int SPINS[] = { 0, 1, Obj::k_DEFAULT_MAX_NUM_SPINS, 100000 };
+        const int NUM_SPINS = static_cast<int>(sizeof SPINS / sizeof *SPINS);
+
+        for (int ti = 0; ti < NUM_SPINS; ++ti) {
+            const int MAX_NUM_SPINS = SPINS[ti];
+
+            if (veryVerbose) { P(MAX_NUM_SPINS) }
+
+            CounterArgs<Obj> args(MAX_NUM_SPINS, k_NUM_ITERATIONS);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(MAX_NUM_SPINS, i,
+                        0 == bslmt::ThreadUtil::create(&handles[i],
+                                                       &incrementAdaptive,
+                                                       &args));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            ASSERTV(MAX_NUM_SPINS, args.d_counter,
+                    k_NUM_THREADS * k_NUM_ITERATIONS == args.d_counter);
+
+            ASSERTV(MAX_NUM_SPINS, 0 == args.d_mutex.tryLock());
+            args.d_mutex.unlock();
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 A default-constructed mutex has the default spin bound, and a
+        //:   mutex constructed with a spin bound reports it.
+        //:
+        //: 2 'tryLock' succeeds on an unlocked mutex, and fails on a locked
+        //:   one.
+        //:
+        //: 3 'lock' acquires an unlocked mutex, and 'unlock' releases it.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Exercise the methods in a single thread, verifying the results
+        //:   of 'tryLock' after each transition.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a negative spin bound.  (C-4)
+        //
+        // Testing:
+        //   AdaptiveMutex(int maxNumSpins = k_DEFAULT_MAX_NUM_SPINS);
+        //   ~AdaptiveMutex();
+        //   void lock();
+        //   int tryLock();
+        //   void unlock();
+        //   int maxNumSpins() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_MAX_NUM_SPINS == X.maxNumSpins());
+
+            ASSERT(0 == mX.tryLock());
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+
+            mX.lock();
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+
+            ASSERT(0 == mX.tryLock());
+            mX.unlock();
+        }
+
+        {
+            Obj mX(0);  const Obj& X = mX;
+
+            ASSERT(0 == X.maxNumSpins());
+
+            mX.lock();
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(Obj( 0));
+            ASSERT_SAFE_FAIL(Obj(-1));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Under contention on a short critical section, an
+        //:   'AdaptiveMutex' is not slower than a 'bslmt::Mutex'.
+        //
+        // Plan:
+        //: 1 Time a number of threads incrementing a shared counter under an
+        //:   'AdaptiveMutex', with spinning disabled and with the default
+        //:   spin bound, and under a 'bslmt::Mutex', and report the timings.
+        //:   The number of threads (default 4) and the number of increments
+        //:   per thread (default 1000000) may be given on the command line.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int numThreads    = argc > 2 ? atoi(argv[2]) : 4;
+        const int numIterations = argc > 3 ? atoi(argv[3]) : 1000000;
+
+        CounterArgs<Obj>          noSpin(0, numIterations);
+        CounterArgs<Obj>          spin(Obj::k_DEFAULT_MAX_NUM_SPINS,
+                                       numIterations);
+        CounterArgs<bslmt::Mutex> mutex(numIterations);
+
+        const double noSpinTime = timeIncrements(&noSpin,
+                                                 &incrementAdaptiveFast,
+                                                 numThreads);
+        const double spinTime   = timeIncrements(&spin,
+                                                 &incrementAdaptiveFast,
+                                                 numThreads);
+        const double mutexTime  = timeIncrements(&mutex,
+                                                 &incrementMutexFast,
+                                                 numThreads);
+
+        ASSERT(numThreads * numIterations == noSpin.d_counter);
+        ASSERT(numThreads * numIterations == spin.d_counter);
+        ASSERT(numThreads * numIterations == mutex.d_counter);
+
+        cout << "threads: " << numThreads
+             << ", increments per thread: " << numIterations << endl
+             << "  AdaptiveMutex (no spin): " << noSpinTime << "s" << endl
+             << "  AdaptiveMutex (spin):    " << spinTime   << "s" << endl
+             << "  Mutex:                   " << mutexTime  << "s" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,146 @@
+// bslmt_futexutil.cpp                                                -*-C++-*-
+#include <bslmt_futexutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_futexutil_cpp,"$Id$ $CSID$")
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+
+#include <bsls_assert.h>
+
+#include <bsl_c_limits.h>
+
+#include <errno.h>
+#include <linux/futex.h>     // FUTEX_WAIT_BITSET
+#include <sys/syscall.h>     // SYS_futex
+#include <time.h>
+#include <unistd.h>          // syscall
+
+namespace BloombergLP {
+namespace bslmt {
+
+namespace {
+
+inline
+int *address(FutexUtil::FutexWord *word)
+    // Return the address of the integer held by the specified futex 'word'.
+{
+    return const_cast<int *>(&word->d_value);
+}
+
+inline
+long futex(int *uaddr, int op, int val, const timespec *timeout, int val3)
+    // Invoke the 'futex' system call with the specified 'uaddr', 'op', 'val',
+    // 'timeout', and 'val3' arguments, and return its result.
+{
+    return syscall(SYS_futex, uaddr, op, val, timeout, 0, val3);
+}
+
+inline
+int waitResult(long rc)
+    // Return the 'FutexUtil' wait status corresponding to the specified 'rc'
+    // result of a 'FUTEX_WAIT' or 'FUTEX_WAIT_BITSET' operation.
+{
+    if (0 == rc) {
+        return 0;                                                     // RETURN
+    }
+
+    // 'EAGAIN' indicates that the futex word did not hold the expected value,
+    // and 'EINTR' that the wait was interrupted by a signal; both are
+    // reported as (spurious) wake-ups.
+
+    const int error = errno;
+    if (EAGAIN == error || EINTR == error) {
+        return 0;                                                     // RETURN
+    }
+    return ETIMEDOUT == error ? -1 : error ? error : 1;
+}
+
+}  // close unnamed namespace
+
+                              // ----------------
+                              // struct FutexUtil
+                              // ----------------
+
+// CLASS METHODS
+int FutexUtil::timedWait(FutexWord                   *word,
+                         int                          expectedValue,
+                         const bsls::TimeInterval&    absTime,
+                         bsls::SystemClockType::Enum  clockType)
+{
+    BSLS_ASSERT(word);
+
+    // 'FUTEX_WAIT_BITSET' interprets its timeout as an absolute time, against
+    // the monotonic clock unless 'FUTEX_CLOCK_REALTIME' is specified.
+
+    timespec timeout;
+    if (absTime.seconds() < 0) {
+        timeout.tv_sec  = 0;
+        timeout.tv_nsec = 0;
+    }
+    else {
+        timeout.tv_sec  = static_cast<time_t>(absTime.seconds());
+        timeout.tv_nsec = absTime.nanoseconds();
+    }
+
+    int op = FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG;
+    if (bsls::SystemClockType::e_REALTIME == clockType) {
+        op |= FUTEX_CLOCK_REALTIME;
+    }
+
+    return waitResult(futex(address(word),
+                            op,
+                            expectedValue,
+                            &timeout,
+                            FUTEX_BITSET_MATCH_ANY));
+}
+
+int FutexUtil::wait(FutexWord *word, int expectedValue)
+{
+    BSLS_ASSERT(word);
+
+    return waitResult(futex(address(word),
+                            FUTEX_WAIT | FUTEX_PRIVATE_FLAG,
+                            expectedValue,
+                            0,
+                            0));
+}
+
+int FutexUtil::wake(FutexWord *word, int numThreads)
+{
+    BSLS_ASSERT(word);
+    BSLS_ASSERT(0 < numThreads);
+
+    long rc = futex(address(word),
+                    FUTEX_WAKE | FUTEX_PRIVATE_FLAG,
+                    numThreads,
+                    0,
+                    0);
+    return rc < 0 ? 0 : static_cast<int>(rc);
+}
+
+int FutexUtil::wakeAll(FutexWord *word)
+{
+    return wake(word, INT_MAX);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLMT_PLATFORM_LINUX_FUTEX
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,196 @@
+// bslmt_futexutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLMT_FUTEXUTIL
+#define INCLUDED_BSLMT_FUTEXUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to block and wake threads on a futex word.
+//
+//@CLASSES:
+//  bslmt::FutexUtil: namespace for futex wait and wake operations
+//
+//@SEE_ALSO: bslmt_adaptivemutex, bslmt_adaptivecondition, bslmt_platform
+//
+//@DESCRIPTION: This component provides a 'struct', 'bslmt::FutexUtil', that
+// serves as a namespace for a thin, portable-in-spirit layer over the Linux
+// 'futex' system call.  A futex ("fast user-space mutex") is a 32-bit integer
+// (the "futex word") in user memory on which threads can block until another
+// thread wakes them.  The kernel is entered only to block and to wake; all
+// other state transitions are performed with atomic operations in user space.
+// This makes the futex the building block of choice for synchronization
+// primitives whose uncontended operations must not make system calls.
+//
+// The 'wait' and 'timedWait' methods block the calling thread *only* *if* the
+// futex word holds an expected value at the time the kernel examines it.  The
+// check and the blocking are atomic with respect to 'wake', so a wake-up
+// issued after a thread changed the futex word cannot be lost.  As with
+// condition variables, spurious wake-ups are possible, and callers must
+// re-examine their state after returning from a wait.
+//
+// This component is available only if the 'BSLMT_PLATFORM_LINUX_FUTEX' macro
+// is defined (see 'bslmt_platform').  Clients should generally use the
+// primitives built on it, 'bslmt::AdaptiveMutex' and
+// 'bslmt::AdaptiveCondition', which are available on all platforms.
+//
+///Supported Clock-Types
+///---------------------
+// The 'timedWait' method takes an absolute timeout, expressed as an interval
+// from the epoch of the clock indicated by a 'bsls::SystemClockType::Enum'
+// value, which matches the epoch used by 'bsls::SystemTime::now' for that
+// clock type.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A One-Shot Event
+///- - - - - - - - - - - - - -
+// In this example we implement a one-shot event on which any number of
+// threads can wait until a single thread sets it.  The futex word is 0 until
+// the event is set, and 1 afterwards.
+//
+// First, we define the event type:
+//..
+//  class OneShotEvent {
+//      // DATA
+//      bsls::AtomicOperations::AtomicTypes::Int d_state;  // 0 or 1
+//
+//    public:
+//      // CREATORS
+//      OneShotEvent()
+//      {
+//          bsls::AtomicOperations::initInt(&d_state, 0);
+//      }
+//
+//      // MANIPULATORS
+//      void set()
+//      {
+//          bsls::AtomicOperations::setIntRelease(&d_state, 1);
+//          bslmt::FutexUtil::wakeAll(&d_state);
+//      }
+//
+//      void wait()
+//      {
+//          while (0 == bsls::AtomicOperations::getIntAcquire(&d_state)) {
+//              bslmt::FutexUtil::wait(&d_state, 0);
+//          }
+//      }
+//  };
+//..
+// Notice that 'wait' re-examines the state in a loop, which accounts for
+// spurious wake-ups, and that 'wait' does not block if 'set' has already
+// changed the futex word.
+//
+// Then, we create an event and a thread waiting for it:
+//..
+//  OneShotEvent event;
+//
+//  bslmt::ThreadUtil::Handle handle;
+//  bslmt::ThreadUtil::create(&handle, &waitForEvent, &event);
+//..
+// Finally, we set the event, which releases the waiting thread, and join it:
+//..
+//  event.set();
+//  bslmt::ThreadUtil::join(handle);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+
+// Platform-specific implementation starts here.
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_SYSTEMCLOCKTYPE
+#include <bsls_systemclocktype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmt {
+
+                              // ================
+                              // struct FutexUtil
+                              // ================
+
+struct FutexUtil {
+    // This 'struct' provides a namespace for utility functions that block and
+    // wake threads on a futex word.  The futex word is an
+    // 'bsls::AtomicOperations::AtomicTypes::Int', so that it can be
+    // manipulated with the atomic operations of 'bsls_atomicoperations'.
+
+    // PUBLIC TYPES
+    typedef bsls::AtomicOperations::AtomicTypes::Int FutexWord;
+
+    // CLASS METHODS
+    static int timedWait(FutexWord                   *word,
+                         int                          expectedValue,
+                         const bsls::TimeInterval&    absTime,
+                         bsls::SystemClockType::Enum  clockType =
+                                           bsls::SystemClockType::e_REALTIME);
+        // Block the calling thread until it is woken by 'wake' or 'wakeAll'
+        // on the specified futex 'word', or until the specified 'absTime'
+        // timeout, unless 'word' does not hold the specified 'expectedValue'
+        // at the time of the call.  Optionally specify a 'clockType'
+        // indicating the clock against which 'absTime' is interpreted; if
+        // 'clockType' is not specified, the realtime system clock is used.
+        // Return 0 if the thread was woken, did not block, or was interrupted
+        // by a signal, -1 if the timeout expired, and a different non-zero
+        // value if an error occurred.  Note that spurious wake-ups are
+        // possible.
+
+    static int wait(FutexWord *word, int expectedValue);
+        // Block the calling thread until it is woken by 'wake' or 'wakeAll'
+        // on the specified futex 'word', unless 'word' does not hold the
+        // specified 'expectedValue' at the time of the call.  Return 0 if the
+        // thread was woken, did not block, or was interrupted by a signal, and
+        // a non-zero value if an error occurred.  Note that spurious wake-ups
+        // are possible.
+
+    static int wake(FutexWord *word, int numThreads);
+        // Wake up to the specified 'numThreads' threads blocked on the
+        // specified futex 'word'.  Return the number of threads woken.  The
+        // behavior is undefined unless '0 < numThreads'.
+
+    static int wakeAll(FutexWord *word);
+        // Wake all threads blocked on the specified futex 'word'.  Return the
+        // number of threads woken.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLMT_PLATFORM_LINUX_FUTEX
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
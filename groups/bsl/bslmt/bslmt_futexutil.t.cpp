@@ -0,0 +1,466 @@
+// bslmt_futexutil.t.cpp                                              -*-C++-*-
+#include <bslmt_futexutil.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>     // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bsls_atomicoperations.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thin layer over the Linux 'futex' system call.
+// We first verify that the waiting methods do not block when the futex word
+// does not hold the expected value, and that 'timedWait' times out against
+// both supported clocks.  We then verify, using a helper thread, that 'wake'
+// and 'wakeAll' release threads blocked on a futex word, and that the number
+// of threads woken is reported.
+//
+// On platforms where 'BSLMT_PLATFORM_LINUX_FUTEX' is not defined, the
+// component is empty, and every test case trivially succeeds.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int timedWait(FutexWord *, int, const TimeInterval&, Enum);
+// [ 1] int wait(FutexWord *word, int expectedValue);
+// [ 3] int wake(FutexWord *word, int numThreads);
+// [ 3] int wakeAll(FutexWord *word);
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+
+typedef bslmt::FutexUtil            Obj;
+typedef Obj::FutexWord              Word;
+typedef bsls::AtomicOperations     AtomicOps;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct WaitArgs {
+    // This 'struct' holds the arguments of, and the state shared with, a
+    // thread executing 'waitUntilNonZero'.
+
+    Word                         d_word;      // futex word waited upon
+    AtomicOps::AtomicTypes::Int  d_numReady;  // number of threads about to
+                                              // wait
+    AtomicOps::AtomicTypes::Int  d_numDone;   // number of threads done
+};
+
+extern "C" void *waitUntilNonZero(void *arg)
+    // Wait on the futex word of the 'WaitArgs' object addressed by the
+    // specified 'arg' until it is non-zero, and then increment its number of
+    // threads done.
+{
+    WaitArgs *args = static_cast<WaitArgs *>(arg);
+
+    AtomicOps::addInt(&args->d_numReady, 1);
+    while (0 == AtomicOps::getIntAcquire(&args->d_word)) {
+        Obj::wait(&args->d_word, 0);
+    }
+    AtomicOps::addInt(&args->d_numDone, 1);
+    return 0;
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace BSLMT_USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A One-Shot Event
+///- - - - - - - - - - - - - -
+// In this example we implement a one-shot event on which any number of
+// threads can wait until a single thread sets it.  The futex word is 0 until
+// the event is set, and 1 afterwards.
+//
+// First, we define the event type:
+//..
+    class OneShotEvent {
+        // DATA
+        bsls::AtomicOperations::AtomicTypes::Int d_state;  // 0 or 1
+
+      public:
+        // CREATORS
+        OneShotEvent()
+        {
+            bsls::AtomicOperations::initInt(&d_state, 0);
+        }
+
+        // MANIPULATORS
+        void set()
+        {
+            bsls::AtomicOperations::setIntRelease(&d_state, 1);
+            bslmt::FutexUtil::wakeAll(&d_state);
+        }
+
+        void wait()
+        {
+            while (0 == bsls::AtomicOperations::getIntAcquire(&d_state)) {
+                bslmt::FutexUtil::wait(&d_state, 0);
+            }
+        }
+    };
+//..
+// Notice that 'wait' re-examines the state in a loop, which accounts for
+// spurious wake-ups, and that 'wait' does not block if 'set' has already
+// changed the futex word.
+
+    extern "C" void *waitForEvent(void *arg)
+        // Wait for the 'OneShotEvent' addressed by the specified 'arg'.
+    {
+        static_cast<OneShotEvent *>(arg)->wait();
+        return 0;
+    }
+
+}  // close namespace BSLMT_USAGE_EXAMPLE_1
+
+#endif  // BSLMT_PLATFORM_LINUX_FUTEX
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+#ifdef BSLMT_PLATFORM_LINUX_FUTEX
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace BSLMT_USAGE_EXAMPLE_1;
+
+// Then, we create an event and a thread waiting for it:
+//..
+    OneShotEvent event;
+
+    bslmt::ThreadUtil::Handle handle;
+    bslmt::ThreadUtil::create(&handle, &waitForEvent, &event);
+//..
+// Finally, we set the event, which releases the waiting thread, and join it:
+//..
+    event.set();
+    bslmt::ThreadUtil::join(handle);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'wake' AND 'wakeAll'
+        //
+        // Concerns:
+        //: 1 'wake' releases at most the requested number of threads blocked
+        //:   on the futex word, and returns the number of threads released.
+        //:
+        //: 2 'wakeAll' releases all the threads blocked on the futex word.
+        //:
+        //: 3 Waking a futex word on which no thread is blocked returns 0.
+        //
+        // Plan:
+        //: 1 Wake a futex word on which no thread waits.  (C-3)
+        //:
+        //: 2 Start a number of threads waiting on a futex word until it is
+        //:   non-zero.  Once all threads are (or are about to be) blocked,
+        //:   set the word and wake one thread, then wake all threads, and
+        //:   verify that all threads complete.  (C-1..2)
+        //
+        // Testing:
+        //   int wake(FutexWord *word, int numThreads);
+        //   int wakeAll(FutexWord *word);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'wake' AND 'wakeAll'" << endl
+                          << "============================" << endl;
+
+        {
+            Word word;
+            AtomicOps::initInt(&word, 0);
+
+            ASSERT(0 == Obj::wake(&word, 1));
+            ASSERT(0 == Obj::wakeAll(&word));
+        }
+
+        enum { k_NUM_THREADS = 4 };
+
+        WaitArgs args;
+        AtomicOps::initInt(&args.d_word,     0);
+        AtomicOps::initInt(&args.d_numReady, 0);
+        AtomicOps::initInt(&args.d_numDone,  0);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  &waitUntilNonZero,
+                                                  &args));
+        }
+
+        while (k_NUM_THREADS > AtomicOps::getInt(&args.d_numReady)) {
+            bslmt::ThreadUtil::yield();
+        }
+        bslmt::ThreadUtil::microSleep(10000);
+
+        ASSERT(0 == AtomicOps::getInt(&args.d_numDone));
+
+        AtomicOps::setIntRelease(&args.d_word, 1);
+
+        const int numWoken = Obj::wake(&args.d_word, 1);
+        ASSERTV(numWoken, 0 <= numWoken && numWoken <= 1);
+
+        const int numWokenAll = Obj::wakeAll(&args.d_word);
+        ASSERTV(numWokenAll,
+                0 <= numWokenAll && numWokenAll <= k_NUM_THREADS - numWoken);
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+        ASSERT(k_NUM_THREADS == AtomicOps::getInt(&args.d_numDone));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'timedWait'
+        //
+        // Concerns:
+        //: 1 'timedWait' returns 0 without blocking if the futex word does not
+        //:   hold the expected value.
+        //:
+        //: 2 'timedWait' returns -1 once the timeout expires, for both the
+        //:   realtime and the monotonic clock, and does not return before the
+        //:   timeout.
+        //:
+        //: 3 'timedWait' returns -1 immediately for a timeout in the past.
+        //
+        // Plan:
+        //: 1 Call 'timedWait' with an expected value different from the value
+        //:   of the futex word.  (C-1)
+        //:
+        //: 2 For each clock type, wait with a timeout 50 milliseconds in the
+        //:   future and verify the result and the elapsed time.  (C-2)
+        //:
+        //: 3 Wait with a timeout in the past.  (C-3)
+        //
+        // Testing:
+        //   int timedWait(FutexWord *, int, const TimeInterval&, Enum);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'timedWait'" << endl
+                          << "===================" << endl;
+
+        Word word;
+        AtomicOps::initInt(&word, 7);
+
+        {
+            const bsls::TimeInterval timeout =
+                                   bsls::SystemTime::nowRealtimeClock() + 10.0;
+            ASSERT(0 == Obj::timedWait(&word, 8, timeout));
+        }
+
+        const bsls::SystemClockType::Enum CLOCKS[] = {
+            bsls::SystemClockType::e_REALTIME,
+            bsls::SystemClockType::e_MONOTONIC
+        };
+
+        for (int i = 0; i < 2; ++i) {
+            const bsls::SystemClockType::Enum CLOCK = CLOCKS[i];
+
+            if (veryVerbose) { P(CLOCK) }
+
+            const bsls::TimeInterval start   = bsls::SystemTime::now(CLOCK);
+            const bsls::TimeInterval timeout = start + 0.05;
+
+            int rc;
+            do {
+                rc = Obj::timedWait(&word, 7, timeout, CLOCK);
+            } while (0 == rc);
+
+            ASSERTV(CLOCK, rc, -1 == rc);
+            ASSERTV(CLOCK, timeout <= bsls::SystemTime::now(CLOCK));
+
+            ASSERTV(CLOCK, -1 == Obj::timedWait(&word,
+                                                7,
+                                                bsls::TimeInterval(0, 0),
+                                                CLOCK));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 'wait' returns 0 without blocking if the futex word does not
+        //:   hold the expected value.
+        //:
+        //: 2 A thread blocked in 'wait' is released by 'wake'.
+        //
+        // Plan:
+        //: 1 Call 'wait' with an expected value different from the value of
+        //:   the futex word.  (C-1)
+        //:
+        //: 2 Start a thread waiting until the futex word is non-zero, set the
+        //:   word, wake the thread, and join it.  (C-2)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   int wait(FutexWord *word, int expectedValue);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            Word word;
+            AtomicOps::initInt(&word, 1);
+
+            ASSERT(0 == Obj::wait(&word, 0));
+            ASSERT(0 == Obj::wait(&word, 2));
+        }
+
+        WaitArgs args;
+        AtomicOps::initInt(&args.d_word,     0);
+        AtomicOps::initInt(&args.d_numReady, 0);
+        AtomicOps::initInt(&args.d_numDone,  0);
+
+        bslmt::ThreadUtil::Handle handle;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                              &waitUntilNonZero,
+                                              &args));
+
+        while (0 == AtomicOps::getInt(&args.d_numReady)) {
+            bslmt::ThreadUtil::yield();
+        }
+
+        AtomicOps::setIntRelease(&args.d_word, 1);
+        Obj::wake(&args.d_word, 1);
+
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+        ASSERT(1 == AtomicOps::getInt(&args.d_numDone));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+#else
+    if (test < 0 || test > 4) {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+    }
+#endif  // BSLMT_PLATFORM_LINUX_FUTEX
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -34,10 +34,16 @@ BSLS_IDENT("$Id: $")
 // semaphore implementation.  Differences among POSIX implementations lead to
 // different semaphore policies for the same 'ThreadPolicy'.
 //
-// Finally, this component defines a 'TimedSemaphorePolicy' trait used for
+// This component also defines a 'TimedSemaphorePolicy' trait used for
 // selecting a timed-semaphore implementation.  POSIX platforms that do not
 // have a native timed-wait for semaphores require a custom (pthread-based)
 // implementation.
+//
+// Finally, this component defines a 'FutexPolicy' trait indicating whether the
+// platform provides a native "fast user-space mutex" (futex) facility (see
+// 'bslmt_futexutil'), on which the adaptive synchronization primitives (see
+// 'bslmt_adaptivemutex') are built.  On platforms without such a facility,
+// those primitives are implemented in terms of 'bslmt::Mutex'.
 
 #ifndef INCLUDED_BSLSCM_VERSION
 #include <bslscm_version.h>
@@ -152,6 +158,22 @@ struct Platform {
 
     typedef Win32TimedSemaphore TimedSemaphorePolicy;
 
+    #endif
+
+                       // 'FutexPolicy' trait
+
+    struct LinuxFutex {};
+    struct NoFutex {};
+
+    #if defined(BSLS_PLATFORM_OS_LINUX)
+
+    typedef LinuxFutex FutexPolicy;
+    #define BSLMT_PLATFORM_LINUX_FUTEX 1
+
+    #else  // no native futex; adaptive primitives are built on 'Mutex'
+
+    typedef NoFutex FutexPolicy;
+
     #endif
 
     enum {
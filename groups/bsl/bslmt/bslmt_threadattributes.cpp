@@ -24,13 +24,16 @@ BSLS_IDENT_RCSID(bslmt_threadattributes_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 
 // CREATORS
-bslmt::ThreadAttributes::ThreadAttributes()
+bslmt::ThreadAttributes::ThreadAttributes(bslma::Allocator *basicAllocator)
 : d_detachedState(e_CREATE_JOINABLE)
 , d_guardSize(e_UNSET_GUARD_SIZE)
 , d_inheritScheduleFlag(true)
 , d_schedulingPolicy(e_SCHED_DEFAULT)
 , d_schedulingPriority(e_UNSET_PRIORITY)
 , d_stackSize(e_UNSET_STACK_SIZE)
+, d_cpuAffinity(basicAllocator)
+, d_numaNode(e_UNSET_NUMA_NODE)
+, d_threadName(basicAllocator)
 {
 }
 
@@ -43,7 +46,10 @@ bool bslmt::operator==(const ThreadAttributes& lhs,
            lhs.inheritSchedule()    == rhs.inheritSchedule()    &&
            lhs.schedulingPolicy()   == rhs.schedulingPolicy()   &&
            lhs.schedulingPriority() == rhs.schedulingPriority() &&
-           lhs.stackSize()          == rhs.stackSize();
+           lhs.stackSize()          == rhs.stackSize()          &&
+           lhs.cpuAffinity()        == rhs.cpuAffinity()        &&
+           lhs.numaNode()           == rhs.numaNode()           &&
+           lhs.threadName()         == rhs.threadName();
 }
 
 bool bslmt::operator!=(const ThreadAttributes& lhs,
@@ -54,7 +60,10 @@ bool bslmt::operator!=(const ThreadAttributes& lhs,
            lhs.inheritSchedule()    != rhs.inheritSchedule()    ||
            lhs.schedulingPolicy()   != rhs.schedulingPolicy()   ||
            lhs.schedulingPriority() != rhs.schedulingPriority() ||
-           lhs.stackSize()          != rhs.stackSize();
+           lhs.stackSize()          != rhs.stackSize()          ||
+           lhs.cpuAffinity()        != rhs.cpuAffinity()        ||
+           lhs.numaNode()           != rhs.numaNode()           ||
+           lhs.threadName()         != rhs.threadName();
 }
 
 }  // close enterprise namespace
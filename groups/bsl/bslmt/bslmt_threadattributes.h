@@ -37,11 +37,16 @@ BSLS_IDENT("$Id: $")
 //  inheritSchedule     bool                   'true'
 //  schedulingPolicy    enum SchedulingPolicy  e_SCHED_DEFAULT
 //  schedulingPriority  int                    e_UNSET_PRIORITY
+//  cpuAffinity         bsl::vector<int>       empty
+//  numaNode            int                    e_UNSET_NUMA_NODE
+//  threadName          bsl::string            ""
 //
 //  Name          Constraint
 //  ---------     ---------------------------------------------------
 //  stackSize     'e_UNSET_STACK_SIZE == stackSize || 0 <= stackSize'
 //  guardSize     'e_UNSET_GUARD_SIZE == guardSize || 0 <= guardSize'
+//  cpuAffinity   '0 <= cpuAffinity[i]' for every element 'i'
+//  numaNode      'e_UNSET_NUMA_NODE == numaNode || 0 <= numaNode'
 //..
 //
 ///'detachedState' Attribute
@@ -120,6 +125,39 @@ BSLS_IDENT("$Id: $")
 // 'false'.  See 'bslmt_threadutil' for information about support for this
 // attribute.
 //
+///'cpuAffinity' Attribute
+///- - - - - - - - - - - -
+// The 'cpuAffinity' attribute is the set of (zero-based) logical processor
+// indices on which a created thread is allowed to run.  An empty
+// 'cpuAffinity' (the default) indicates that the thread may run on any
+// processor available to the task (typically the affinity of the creating
+// thread is inherited).  Duplicate indices are permitted and have no effect.
+// If none of the specified processors exists on the host, thread creation
+// fails.  See 'bslmt_threadutil' for information about support for this
+// attribute.
+//
+///'numaNode' Attribute
+/// - - - - - - - - - -
+// The 'numaNode' attribute indicates the NUMA node on which a created thread
+// should run and from which it should preferentially allocate memory.  If
+// 'numaNode' is 'e_UNSET_NUMA_NODE' (the default), no NUMA placement is
+// performed.  Otherwise, the thread is restricted to the processors of the
+// specified node (intersected with 'cpuAffinity', if that is not empty), and
+// the node is made the preferred node for the memory pages first touched by
+// the thread.  Thread creation fails if the node does not exist, or if the
+// intersection with 'cpuAffinity' is empty.  See 'bslmt_threadutil' for
+// information about support for this attribute.
+//
+///'threadName' Attribute
+/// - - - - - - - - - - -
+// The 'threadName' attribute is the name, visible to debuggers and to tools
+// such as 'top' and 'ps', that the operating system should associate with a
+// created thread.  An empty 'threadName' (the default) leaves the
+// platform-supplied name (typically the name of the process) unchanged.  Note
+// that some platforms truncate thread names (e.g., Linux supports at most 15
+// characters), and that some platforms ignore this attribute entirely.  See
+// 'bslmt_threadutil' for information about support for this attribute.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -186,6 +224,16 @@ BSLS_IDENT("$Id: $")
 //      attributes.setDetachedState(
 //                             bslmt::ThreadAttributes::e_CREATE_DETACHED);
 //..
+// Next, we give the thread a name, so that it can be identified in a
+// debugger, and restrict it to run on the first two processors of the host:
+//..
+//      attributes.setThreadName("calculator");
+//
+//      bsl::vector<int> cpus;
+//      cpus.push_back(0);
+//      cpus.push_back(1);
+//      attributes.setCpuAffinity(cpus);
+//..
 // Now, we create a thread, using the attributes configured above:
 //..
 //      int handle;
@@ -252,10 +300,22 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ASSERT
 #include <bslmf_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -264,6 +324,14 @@ BSLS_IDENT("$Id: $")
 #include <bsl_c_limits.h>
 #endif
 
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 namespace bslmt {
 
@@ -312,14 +380,16 @@ class ThreadAttributes {
 
     enum {
         // The following constants indicate that the 'stackSize', 'guardSize',
-        // and 'schedulingPriority' attributes, respectively, are unspecified
-        // and the thread creation routine is use platform-specific defaults.
-        // These attributes are initialized to these values when a thread
-        // attributes object is default constructed.
+        // 'schedulingPriority', and 'numaNode' attributes, respectively, are
+        // unspecified and the thread creation routine is to use
+        // platform-specific defaults.  These attributes are initialized to
+        // these values when a thread attributes object is default
+        // constructed.
 
         e_UNSET_STACK_SIZE = -1,
         e_UNSET_GUARD_SIZE = -1,
         e_UNSET_PRIORITY   = INT_MIN,
+        e_UNSET_NUMA_NODE  = -1,
 
         e_SCHED_MIN        = e_SCHED_OTHER,
         e_SCHED_MAX        = e_SCHED_DEFAULT
@@ -346,9 +416,22 @@ class ThreadAttributes {
 
     int              d_stackSize;           // size of the thread's stack
 
+    bsl::vector<int> d_cpuAffinity;         // processors on which the thread
+                                            // may run (empty if unrestricted)
+
+    int              d_numaNode;            // NUMA node on which the thread
+                                            // is placed
+
+    bsl::string      d_threadName;          // name of the thread (empty if
+                                            // unnamed)
+
   public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ThreadAttributes,
+                                   bslma::UsesBslmaAllocator);
+
     // CREATORS
-    ThreadAttributes();
+    explicit ThreadAttributes(bslma::Allocator *basicAllocator = 0);
         // Create a 'ThreadAttributes' object having the (default) attribute
         // values:
         //: o 'detachedState()      == e_CREATE_JOINABLE'
@@ -357,10 +440,19 @@ class ThreadAttributes {
         //: o 'schedulingPolicy()   == e_SCHED_DEFAULT'
         //: o 'schedulingPriority() == e_UNSET_PRIORITY'
         //: o 'stackSize()          == e_UNSET_STACK_SIZE'
-
-    ThreadAttributes(const ThreadAttributes& original);
+        //: o 'cpuAffinity()        == bsl::vector<int>()'
+        //: o 'numaNode()           == e_UNSET_NUMA_NODE'
+        //: o 'threadName()         == ""'
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ThreadAttributes(const ThreadAttributes&  original,
+                     bslma::Allocator        *basicAllocator = 0);
         // Create a 'ThreadAttributes' object having the same value as the
-        // specified 'original' object.
+        // specified 'original' object.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
 
     // MANIPULATORS
     ThreadAttributes& operator=(const ThreadAttributes& rhs);
@@ -417,6 +509,27 @@ class ThreadAttributes {
         // 'bslmt_configuration'.  The behavior is undefined unless
         // 'e_UNSET_STACK_SIZE == stackSize' or '0 <= stackSize'.
 
+    void setCpuAffinity(const bsl::vector<int>& value);
+        // Set the 'cpuAffinity' attribute of this object to the specified
+        // 'value'.  An empty 'value' indicates that a thread may run on any
+        // processor available to the task.  The behavior is undefined unless
+        // each element of 'value' is non-negative.  See 'bslmt_threadutil'
+        // for information about support for this attribute.
+
+    void setNumaNode(int value);
+        // Set the 'numaNode' attribute of this object to the specified
+        // 'value'.  'e_UNSET_NUMA_NODE == value' indicates that no NUMA
+        // placement is to be performed.  The behavior is undefined unless
+        // 'e_UNSET_NUMA_NODE == value' or '0 <= value'.  See
+        // 'bslmt_threadutil' for information about support for this
+        // attribute.
+
+    void setThreadName(const bslstl::StringRef& value);
+        // Set the 'threadName' attribute of this object to the specified
+        // 'value'.  An empty 'value' indicates that the platform-supplied
+        // thread name is to be used.  See 'bslmt_threadutil' for information
+        // about support for this attribute.
+
     // ACCESSORS
     DetachedState detachedState() const;
         // Return the value of the 'detachedState' attribute of this object.  A
@@ -461,6 +574,27 @@ class ThreadAttributes {
         // Return the value of the 'stackSize' attribute of this object.  If
         // 'stackSize' is 'e_UNSET_STACK_SIZE', thread creation should use the
         // default stack size value provided by 'bslmt_configuration'.
+
+    const bsl::vector<int>& cpuAffinity() const;
+        // Return a reference providing non-modifiable access to the
+        // 'cpuAffinity' attribute of this object.  An empty 'cpuAffinity'
+        // indicates that a thread may run on any processor available to the
+        // task.
+
+    int numaNode() const;
+        // Return the value of the 'numaNode' attribute of this object.  The
+        // value 'e_UNSET_NUMA_NODE' indicates that no NUMA placement is to be
+        // performed.
+
+    const bsl::string& threadName() const;
+        // Return a reference providing non-modifiable access to the
+        // 'threadName' attribute of this object.  An empty 'threadName'
+        // indicates that the platform-supplied thread name is to be used.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
 };
 
 // FREE OPERATORS
@@ -469,14 +603,16 @@ bool operator==(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // value, and 'false' otherwise.  Two 'ThreadAttributes' objects have the
     // same value if the corresponding values of their 'detachedState',
     // 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are the same.
+    // 'schedulingPriority', 'stackSize', 'cpuAffinity', 'numaNode', and
+    // 'threadName' attributes are the same.
 
 bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
-    // same value, and 'false' otherwise.  Two 'baltzo::LocalTimeDescriptor'
-    // objects do not have the same value if the corresponding values of their
+    // same value, and 'false' otherwise.  Two 'ThreadAttributes' objects do
+    // not have the same value if the corresponding values of any of their
     // 'detachedState', 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are not the same.
+    // 'schedulingPriority', 'stackSize', 'cpuAffinity', 'numaNode', or
+    // 'threadName' attributes are not the same.
 
 }  // close package namespace
 
@@ -490,13 +626,18 @@ bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
 
 // CREATORS
 inline
-bslmt::ThreadAttributes::ThreadAttributes(const ThreadAttributes& original)
+bslmt::ThreadAttributes::ThreadAttributes(
+                                      const ThreadAttributes&  original,
+                                      bslma::Allocator        *basicAllocator)
 : d_detachedState(original.d_detachedState)
 , d_guardSize(original.d_guardSize)
 , d_inheritScheduleFlag(original.d_inheritScheduleFlag)
 , d_schedulingPolicy(original.d_schedulingPolicy)
 , d_schedulingPriority(original.d_schedulingPriority)
 , d_stackSize(original.d_stackSize)
+, d_cpuAffinity(original.d_cpuAffinity, basicAllocator)
+, d_numaNode(original.d_numaNode)
+, d_threadName(original.d_threadName, basicAllocator)
 {
 }
 
@@ -511,6 +652,9 @@ bslmt::ThreadAttributes& bslmt::ThreadAttributes::operator=(
     d_schedulingPolicy    = rhs.d_schedulingPolicy;
     d_schedulingPriority  = rhs.d_schedulingPriority;
     d_stackSize           = rhs.d_stackSize;
+    d_cpuAffinity         = rhs.d_cpuAffinity;
+    d_numaNode            = rhs.d_numaNode;
+    d_threadName          = rhs.d_threadName;
 
     return *this;
 }
@@ -567,6 +711,32 @@ void bslmt::ThreadAttributes::setStackSize(int value)
     d_stackSize = value;
 }
 
+inline
+void bslmt::ThreadAttributes::setCpuAffinity(const bsl::vector<int>& value)
+{
+    for (bsl::vector<int>::size_type i = 0; i < value.size(); ++i) {
+        BSLS_ASSERT_SAFE(0 <= value[i]);
+    }
+
+    d_cpuAffinity = value;
+}
+
+inline
+void bslmt::ThreadAttributes::setNumaNode(int value)
+{
+    BSLMF_ASSERT(-1 == e_UNSET_NUMA_NODE);
+
+    BSLS_ASSERT_SAFE(-1 <= value);
+
+    d_numaNode = value;
+}
+
+inline
+void bslmt::ThreadAttributes::setThreadName(const bslstl::StringRef& value)
+{
+    d_threadName.assign(value.begin(), value.end());
+}
+
 // ACCESSORS
 inline
 bslmt::ThreadAttributes::DetachedState
@@ -606,6 +776,32 @@ int bslmt::ThreadAttributes::stackSize() const
     return d_stackSize;
 }
 
+inline
+const bsl::vector<int>& bslmt::ThreadAttributes::cpuAffinity() const
+{
+    return d_cpuAffinity;
+}
+
+inline
+int bslmt::ThreadAttributes::numaNode() const
+{
+    return d_numaNode;
+}
+
+inline
+const bsl::string& bslmt::ThreadAttributes::threadName() const
+{
+    return d_threadName;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *bslmt::ThreadAttributes::allocator() const
+{
+    return d_threadName.get_allocator().mechanism();
+}
+
 }  // close enterprise namespace
 
 #endif
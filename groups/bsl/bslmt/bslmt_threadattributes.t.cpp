@@ -13,9 +13,15 @@
 
 #include <bslim_testutil.h>
 
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
 #include <bsl_cstdlib.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLMT_PLATFORM_POSIX_THREADS
 #include <pthread.h>
@@ -134,6 +140,16 @@ void aSsErT(bool condition, const char *message, int line)
         attributes.setDetachedState(
                                bslmt::ThreadAttributes::e_CREATE_DETACHED);
 //..
+// Next, we give the thread a name, so that it can be identified in a
+// debugger, and restrict it to run on the first two processors of the host:
+//..
+        attributes.setThreadName("calculator");
+
+        bsl::vector<int> cpus;
+        cpus.push_back(0);
+        cpus.push_back(1);
+        attributes.setCpuAffinity(cpus);
+//..
 // Now, we create a thread, using the attributes configured above:
 //..
         int handle;
@@ -225,7 +241,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE TEST
         //
@@ -274,6 +290,127 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'cpuAffinity', 'numaNode', AND 'threadName'
+        //
+        // Concerns:
+        //: 1 The default values of the 'cpuAffinity', 'numaNode', and
+        //:   'threadName' attributes are an empty vector, 'e_UNSET_NUMA_NODE',
+        //:   and an empty string, respectively.
+        //:
+        //: 2 Each manipulator sets its attribute, and affects no other
+        //:   attribute.
+        //:
+        //: 3 The copy constructor, the assignment operator, and the equality
+        //:   operators take each of the three attributes into account.
+        //:
+        //: 4 Memory is supplied by the allocator supplied at construction,
+        //:   and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Default construct an object with a test allocator and verify
+        //:   the values of the attributes.  (C-1)
+        //:
+        //: 2 Set each attribute in turn, verifying the values of all three
+        //:   attributes, and the (in)equality with a default constructed
+        //:   object, after each step.  (C-2..3)
+        //:
+        //: 3 Copy construct and assign the resulting object, and verify that
+        //:   the copies are equal to it.  (C-3)
+        //:
+        //: 4 Verify that all memory is allocated from the test allocators
+        //:   supplied at construction.  (C-4)
+        //
+        // Testing:
+        //   ThreadAttributes(bslma::Allocator *basicAllocator);
+        //   ThreadAttributes(const ThreadAttributes&, bslma::Allocator *);
+        //   void setCpuAffinity(const bsl::vector<int>& value);
+        //   void setNumaNode(int value);
+        //   void setThreadName(const bslstl::StringRef& value);
+        //   const bsl::vector<int>& cpuAffinity() const;
+        //   int numaNode() const;
+        //   const bsl::string& threadName() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'cpuAffinity', 'numaNode', AND "
+                             "'threadName'\n"
+                             "======================================="
+                             "============\n";
+
+        bslma::TestAllocator da("default", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator ca("copy",    veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        const Obj D;
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(&oa == X.allocator());
+        ASSERT(X.cpuAffinity().empty());
+        ASSERT(Obj::e_UNSET_NUMA_NODE == X.numaNode());
+        ASSERT(X.threadName().empty());
+        ASSERT(D == X);
+
+        bsl::vector<int> cpus(&sa);
+        cpus.push_back(3);
+        cpus.push_back(0);
+        cpus.push_back(7);
+
+        mX.setCpuAffinity(cpus);
+        ASSERT(cpus == X.cpuAffinity());
+        ASSERT(Obj::e_UNSET_NUMA_NODE == X.numaNode());
+        ASSERT(X.threadName().empty());
+        ASSERT(D != X);
+
+        mX.setNumaNode(1);
+        ASSERT(cpus == X.cpuAffinity());
+        ASSERT(1 == X.numaNode());
+        ASSERT(X.threadName().empty());
+        ASSERT(D != X);
+
+        // Use a name long enough to require allocation.
+
+        const char *NAME = "a rather long thread name, not stored inline";
+
+        mX.setThreadName(NAME);
+        ASSERT(cpus == X.cpuAffinity());
+        ASSERT(1 == X.numaNode());
+        ASSERT(NAME == X.threadName());
+        ASSERT(D != X);
+
+        Obj mY(X, &ca);  const Obj& Y = mY;
+        ASSERT(&ca == Y.allocator());
+        ASSERT(X == Y);
+        ASSERT(!(X != Y));
+
+        Obj mZ(&ca);  const Obj& Z = mZ;
+        ASSERT(X != Z);
+        mZ = X;
+        ASSERT(X == Z);
+        ASSERT(&ca == Z.allocator());
+
+        // Each attribute participates in the equality comparison.
+
+        mY.setCpuAffinity(bsl::vector<int>());
+        ASSERT(X != Y);
+        mY = X;
+        mY.setNumaNode(Obj::e_UNSET_NUMA_NODE);
+        ASSERT(X != Y);
+        mY = X;
+        mY.setThreadName("");
+        ASSERT(X != Y);
+        mY = X;
+        ASSERT(X == Y);
+
+        ASSERT(0 <  oa.numBlocksInUse());
+        ASSERT(0 <  ca.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 2: {
         // ------------------------------------------------------------------
         // Testing Primary Manipulators / Accessors
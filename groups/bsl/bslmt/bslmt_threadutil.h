@@ -112,6 +112,36 @@ BSLS_IDENT("$Id: $")
 //               'inheritSchedule' are ignored for all clients.
 //..
 //
+///Processor Affinity, NUMA Placement, and Thread Names
+///----------------------------------------------------
+// A thread attributes object supplied to the 'create' method may also specify
+// the set of processors on which the created thread may run ('cpuAffinity'),
+// the NUMA node on which the thread should run and from which it should
+// preferentially allocate memory ('numaNode'), and the name by which the
+// operating system identifies the thread ('threadName').  The affinity and
+// NUMA placement are established before the thread runs any client code, and
+// thread creation fails if they cannot be satisfied.  The support for these
+// attributes varies among platforms:
+//..
+// Platform      Restrictions
+// ------------  --------------------------------------------------------------
+// Linux         All three attributes are supported.  'threadName' is
+//               truncated to 15 characters.  The processors of a NUMA node
+//               are read from '/sys/devices/system/node', and thread
+//               creation fails if that information is not available.
+//
+// Darwin        'threadName' is supported (truncated to 63 characters);
+//               'cpuAffinity' and 'numaNode' are ignored.
+//
+// Windows       'cpuAffinity' is supported for the processors, of the
+//               processor group of the creating thread, having an index less
+//               than 64; 'numaNode' restricts the thread to the processors of
+//               the node, but does not affect memory allocation.
+//               'threadName' is ignored.
+//
+// Other         All three attributes are ignored.
+//..
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -36,6 +36,7 @@
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 #include <errno.h>
 
@@ -46,6 +47,10 @@
 #   include <sys/utsname.h>
 # endif
 
+# ifdef BSLS_PLATFORM_OS_LINUX
+#   include <sched.h>
+# endif
+
 #endif
 
 #ifndef BSLS_PLATFORM_OS_WINDOWS
@@ -1288,6 +1293,53 @@ void createKeyTestDestructor5(void *data)
 
 }  // extern "C"
 
+                     // ===================================
+                     // Test Case 16: Affinity, NUMA & Name
+                     // ===================================
+
+namespace BSLMT_THREADUTIL_AFFINITY_TEST16 {
+
+struct ThreadInfo {
+    // This 'struct' holds the attributes of a thread, as observed by the
+    // thread itself.
+
+    char              d_name[64];  // name of the thread, or empty
+    bsl::vector<int>  d_cpus;      // processors on which the thread may run
+    bool              d_ran;       // 'true' once the thread has run
+};
+
+}  // close namespace BSLMT_THREADUTIL_AFFINITY_TEST16
+
+extern "C"
+void *affinityTestFunction(void *arg)
+    // Load the name and the processor affinity of the calling thread into the
+    // 'ThreadInfo' object addressed by the specified 'arg', where supported.
+{
+    namespace TC = BSLMT_THREADUTIL_AFFINITY_TEST16;
+
+    TC::ThreadInfo *info = static_cast<TC::ThreadInfo *>(arg);
+
+    info->d_name[0] = 0;
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+    pthread_getname_np(pthread_self(), info->d_name, sizeof info->d_name);
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (0 == pthread_getaffinity_np(pthread_self(), sizeof set, &set)) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                info->d_cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+
+    info->d_ran = true;
+    return 0;
+}
+
 inline
 long mymax(long a, long b)
 {
@@ -1426,6 +1478,119 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING CPU AFFINITY, NUMA NODE, AND THREAD NAME
+        //
+        // Concerns:
+        //: 1 A thread created with a 'threadName' attribute has that name
+        //:   (truncated to the platform limit) on platforms supporting thread
+        //:   names.
+        //:
+        //: 2 A thread created with a 'cpuAffinity' attribute runs only on the
+        //:   specified processors on platforms supporting affinity.
+        //:
+        //: 3 A thread created with a 'numaNode' attribute runs only on the
+        //:   processors of that node, and creation fails for a node that does
+        //:   not exist.
+        //:
+        //: 4 The client's thread function is invoked with the client's
+        //:   argument in every case.
+        //
+        // Plan:
+        //: 1 Create threads with each of the attributes set, having the
+        //:   thread function report the name and affinity it observes, and
+        //:   verify them.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: 'cpuAffinity', 'numaNode', and 'threadName' are applied
+        // --------------------------------------------------------------------
+
+        if (verbose) cout <<
+                         "TESTING CPU AFFINITY, NUMA NODE, AND THREAD NAME\n"
+                         "================================================\n";
+
+        namespace TC = BSLMT_THREADUTIL_AFFINITY_TEST16;
+
+        Obj::Handle handle;
+        int         rc;
+
+        if (verbose) cout << "\tThread name.\n";
+        {
+            Attr attr;
+            attr.setThreadName("bslmt.threadutil.test");
+
+            TC::ThreadInfo info;
+            info.d_ran = false;
+
+            rc = Obj::create(&handle, attr, affinityTestFunction, &info);
+            ASSERT(0 == rc);
+            ASSERT(0 == Obj::join(handle));
+            ASSERT(info.d_ran);
+
+            if (veryVerbose) { P(info.d_name) }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(0 == bsl::strcmp("bslmt.threaduti", info.d_name));
+#elif defined(BSLS_PLATFORM_OS_DARWIN)
+            ASSERT(0 == bsl::strcmp("bslmt.threadutil.test", info.d_name));
+#endif
+        }
+
+        if (verbose) cout << "\tCPU affinity.\n";
+        {
+            Attr attr;
+            bsl::vector<int> cpus;
+            cpus.push_back(0);
+            attr.setCpuAffinity(cpus);
+
+            TC::ThreadInfo info;
+            info.d_ran = false;
+
+            rc = Obj::create(&handle, attr, affinityTestFunction, &info);
+            ASSERT(0 == rc);
+            ASSERT(0 == Obj::join(handle));
+            ASSERT(info.d_ran);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERTV(info.d_cpus.size(), cpus == info.d_cpus);
+#endif
+        }
+
+        if (verbose) cout << "\tNUMA node.\n";
+        {
+            Attr attr;
+            attr.setNumaNode(0);
+
+            TC::ThreadInfo info;
+            info.d_ran = false;
+
+            // Node 0 exists on every NUMA-enabled Linux kernel, but 'sysfs'
+            // may not describe it (e.g., in a container), in which case
+            // creation fails.  Other platforms ignore the attribute.
+
+            rc = Obj::create(&handle, attr, affinityTestFunction, &info);
+            if (0 == rc) {
+                ASSERT(0 == Obj::join(handle));
+                ASSERT(info.d_ran);
+#if defined(BSLS_PLATFORM_OS_LINUX)
+                ASSERT(!info.d_cpus.empty());
+#endif
+            }
+            else if (verbose) {
+                cout << "\t\tNUMA information unavailable.\n";
+            }
+#if !defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(0 == rc);
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            attr.setNumaNode(100000);
+            rc = Obj::create(&handle, attr, affinityTestFunction, &info);
+            ASSERT(0 != rc);
+#endif
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // CREATE ALLOCATION TEST
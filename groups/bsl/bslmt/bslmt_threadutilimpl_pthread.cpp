@@ -25,6 +25,8 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #include <bsls_atomicoperations.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
@@ -39,6 +41,11 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 # include <unistd.h>       // sysconf
 # include <mach/mach.h>    // clock_sleep
 # include <mach/clock.h>   // clock_sleep
+#elif defined(BSLS_PLATFORM_OS_LINUX)
+# include <sched.h>        // CPU_ALLOC
+# include <stdio.h>        // fopen
+# include <sys/syscall.h>  // SYS_set_mempolicy
+# include <unistd.h>       // sysconf, syscall
 #elif defined(BSLS_PLATFORM_OS_SOLARIS)
 # include <sys/utsname.h>
 #endif
@@ -47,6 +54,205 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+enum { k_MAX_THREAD_NAME_LENGTH = 15 };  // 'pthread_setname_np' limit
+#elif defined(BSLS_PLATFORM_OS_DARWIN)
+enum { k_MAX_THREAD_NAME_LENGTH = 63 };  // 'MAXTHREADNAMESIZE - 1'
+#else
+enum { k_MAX_THREAD_NAME_LENGTH = 0 };   // thread names are not supported
+#endif
+
+struct ThreadStartInfo {
+    // This 'struct' holds the information needed by 'threadStart' to apply
+    // the attributes of a thread that must be applied by the thread itself,
+    // before invoking the client's thread function.  An object of this type
+    // is allocated with 'malloc' by the creating thread, and freed by the
+    // created thread.
+
+    bslmt_ThreadFunction  d_function;   // client's thread function
+
+    void                 *d_userData;   // argument of 'd_function'
+
+    int                   d_numaNode;   // NUMA node whose memory is
+                                        // preferred, or 'e_UNSET_NUMA_NODE'
+
+    char                  d_name[k_MAX_THREAD_NAME_LENGTH + 1];
+                                        // (truncated) name of the thread, or
+                                        // empty
+};
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+int loadNumaNodeCpus(cpu_set_t *result,
+                     bsl::size_t setSize,
+                     int         numCpus,
+                     int         node)
+    // Add to the specified 'result' cpu set, having the specified 'setSize'
+    // (in bytes) and able to represent the specified 'numCpus' processors, the
+    // processors of the specified NUMA 'node', as reported by the 'cpulist'
+    // file of the node in 'sysfs'.  Return 0 on success, and a non-zero value
+    // if that file cannot be read or parsed.  Note that processors having an
+    // index not less than 'numCpus' are ignored.
+{
+    char path[64];
+    snprintf(path, sizeof path, "/sys/devices/system/node/node%d/cpulist",
+             node);
+
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return -1;                                                    // RETURN
+    }
+
+    // The file holds a comma-separated list of processor indices and
+    // inclusive ranges of processor indices, e.g., "0-3,8,10-11".
+
+    int rc = 0;
+    int first;
+    while (1 == fscanf(file, "%d", &first)) {
+        int last = first;
+        int c    = getc(file);
+        if ('-' == c) {
+            if (1 != fscanf(file, "%d", &last)) {
+                rc = -1;
+                break;
+            }
+            c = getc(file);
+        }
+        for (int cpu = first; cpu <= last && cpu < numCpus; ++cpu) {
+            CPU_SET_S(cpu, setSize, result);
+        }
+        if (',' != c) {
+            break;
+        }
+    }
+
+    fclose(file);
+    return rc;
+}
+
+int setPthreadAffinity(pthread_attr_t                 *destination,
+                       const bslmt::ThreadAttributes&  src)
+    // Configure the specified pthreads attribute 'destination' to restrict
+    // the thread to the processors specified by the 'cpuAffinity' and
+    // 'numaNode' attributes of the specified 'src'.  Return 0 on success, and
+    // a non-zero value otherwise.  The behavior is undefined unless at least
+    // one of these attributes is set.
+{
+    typedef bslmt::ThreadAttributes Attr;
+
+    const bsl::vector<int>& cpus = src.cpuAffinity();
+
+    int numCpus = static_cast<int>(sysconf(_SC_NPROCESSORS_CONF));
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        if (cpus[i] >= numCpus) {
+            numCpus = cpus[i] + 1;
+        }
+    }
+
+    cpu_set_t   *set     = CPU_ALLOC(numCpus);
+    bsl::size_t  setSize = CPU_ALLOC_SIZE(numCpus);
+    if (!set) {
+        return -1;                                                    // RETURN
+    }
+    CPU_ZERO_S(setSize, set);
+
+    int rc = 0;
+
+    if (Attr::e_UNSET_NUMA_NODE != src.numaNode()) {
+        rc = loadNumaNodeCpus(set, setSize, numCpus, src.numaNode());
+
+        if (0 == rc && !cpus.empty()) {
+            cpu_set_t *mask = CPU_ALLOC(numCpus);
+            if (mask) {
+                CPU_ZERO_S(setSize, mask);
+                for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+                    CPU_SET_S(cpus[i], setSize, mask);
+                }
+                CPU_AND_S(setSize, set, set, mask);
+                CPU_FREE(mask);
+            }
+            else {
+                rc = -1;
+            }
+        }
+    }
+    else {
+        for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+            CPU_SET_S(cpus[i], setSize, set);
+        }
+    }
+
+    if (0 == rc) {
+        rc = 0 == CPU_COUNT_S(setSize, set)
+             ? -1
+             : pthread_attr_setaffinity_np(destination, setSize, set);
+    }
+
+    CPU_FREE(set);
+    return rc;
+}
+
+void setNumaMemoryPolicy(int node)
+    // Make the specified NUMA 'node' the preferred node for the memory
+    // allocated by the calling thread.  Note that this is a hint: failure is
+    // silently ignored, and memory is allocated from other nodes when 'node'
+    // is exhausted.
+{
+    enum {
+        k_MPOL_PREFERRED = 1,                     // from '<linux/mempolicy.h>'
+        k_MAX_NODES      = 1024,
+        k_BITS_PER_LONG  = sizeof(unsigned long) * CHAR_BIT
+    };
+
+    if (node >= k_MAX_NODES) {
+        return;                                                       // RETURN
+    }
+
+    unsigned long mask[k_MAX_NODES / k_BITS_PER_LONG] = { 0 };
+    mask[node / k_BITS_PER_LONG] = 1UL << (node % k_BITS_PER_LONG);
+
+    syscall(SYS_set_mempolicy,
+            static_cast<int>(k_MPOL_PREFERRED),
+            mask,
+            static_cast<unsigned long>(k_MAX_NODES + 1));
+}
+
+#endif  // defined(BSLS_PLATFORM_OS_LINUX)
+
+extern "C"
+void *threadStart(void *arg)
+    // Apply the attributes described by the specified 'arg', which is a
+    // 'ThreadStartInfo' object, to the calling thread, free 'arg', and invoke
+    // the client's thread function, returning its result.
+{
+    ThreadStartInfo *info = static_cast<ThreadStartInfo *>(arg);
+
+    if (info->d_name[0]) {
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        pthread_setname_np(pthread_self(), info->d_name);
+#elif defined(BSLS_PLATFORM_OS_DARWIN)
+        pthread_setname_np(info->d_name);
+#endif
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (bslmt::ThreadAttributes::e_UNSET_NUMA_NODE != info->d_numaNode) {
+        setNumaMemoryPolicy(info->d_numaNode);
+    }
+#endif
+
+    bslmt_ThreadFunction  function = info->d_function;
+    void                 *userData = info->d_userData;
+
+    bsl::free(info);
+
+    return function(userData);
+}
+
+}  // close unnamed namespace
+
 static inline
 int localPthreadsPolicy(int policy)
     // Return the native pthreads scheduling policy corresponding to the
@@ -164,6 +370,13 @@ static int initPthreadAttribute(pthread_attr_t                 *destination,
         rc |= pthread_attr_setstacksize(destination, stackSize);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (!src.cpuAffinity().empty()
+     || Attr::e_UNSET_NUMA_NODE != src.numaNode()) {
+        rc |= setPthreadAffinity(destination, src);
+    }
+#endif
+
     return rc;
 }
 
@@ -221,10 +434,48 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::create(
         return -1;                                                    // RETURN
     }
 
-    rc = pthread_create(threadHandle,
-                        &pthreadAttr,
-                        function,
-                        userData);
+    // The thread name and the NUMA memory policy can be applied only by the
+    // created thread itself, so if either is specified, the thread starts in
+    // 'threadStart', which applies them before invoking 'function'.
+
+    const bool needsStartInfo =
+        (0 < k_MAX_THREAD_NAME_LENGTH && !attributes.threadName().empty())
+#if defined(BSLS_PLATFORM_OS_LINUX)
+     || ThreadAttributes::e_UNSET_NUMA_NODE != attributes.numaNode()
+#endif
+        ;
+
+    if (needsStartInfo) {
+        ThreadStartInfo *info = static_cast<ThreadStartInfo *>(
+                                         bsl::malloc(sizeof(ThreadStartInfo)));
+        if (!info) {
+            pthread_attr_destroy(&pthreadAttr);
+            return -1;                                                // RETURN
+        }
+
+        info->d_function = function;
+        info->d_userData = userData;
+        info->d_numaNode = attributes.numaNode();
+
+        bsl::size_t nameLength = bsl::min<bsl::size_t>(
+                                                attributes.threadName().size(),
+                                                k_MAX_THREAD_NAME_LENGTH);
+        bsl::memcpy(info->d_name,
+                    attributes.threadName().data(),
+                    nameLength);
+        info->d_name[nameLength] = 0;
+
+        rc = pthread_create(threadHandle, &pthreadAttr, &threadStart, info);
+        if (rc) {
+            bsl::free(info);
+        }
+    }
+    else {
+        rc = pthread_create(threadHandle,
+                            &pthreadAttr,
+                            function,
+                            userData);
+    }
 
     // If 'attr' destruction fails, don't want to return a bad status if thread
     // creation succeeded and thread potentially needs to be joined.
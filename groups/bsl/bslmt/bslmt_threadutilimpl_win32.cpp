@@ -326,6 +326,48 @@ static unsigned _stdcall ThreadEntry(void *arg)
     return (unsigned)(bsls::Types::IntPtr)ret;
 }
 
+int loadAffinityMask(DWORD_PTR                      *result,
+                     const bslmt::ThreadAttributes&  attributes)
+    // Load into the specified 'result' the processor affinity mask described
+    // by the 'cpuAffinity' and 'numaNode' attributes of the specified
+    // 'attributes', or 0 if neither attribute is set.  Return 0 on success,
+    // and a non-zero value if the attributes describe no processor that can
+    // be represented in a mask.  Note that processors having an index of 64
+    // or more (or 32 or more on 32-bit platforms) are ignored.
+{
+    enum { k_MAX_CPUS = sizeof(DWORD_PTR) * 8 };
+
+    const bsl::vector<int>& cpus = attributes.cpuAffinity();
+    const int               node = attributes.numaNode();
+
+    if (cpus.empty() && bslmt::ThreadAttributes::e_UNSET_NUMA_NODE == node) {
+        *result = 0;
+        return 0;                                                     // RETURN
+    }
+
+    DWORD_PTR mask = 0;
+    if (cpus.empty()) {
+        mask = ~static_cast<DWORD_PTR>(0);
+    }
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        if (cpus[i] < k_MAX_CPUS) {
+            mask |= static_cast<DWORD_PTR>(1) << cpus[i];
+        }
+    }
+
+    if (bslmt::ThreadAttributes::e_UNSET_NUMA_NODE != node) {
+        ULONGLONG nodeMask;
+        if (node > 0xFF
+         || !GetNumaNodeProcessorMask(static_cast<UCHAR>(node), &nodeMask)) {
+            return 1;                                                 // RETURN
+        }
+        mask &= static_cast<DWORD_PTR>(nodeMask);
+    }
+
+    *result = mask;
+    return 0 == mask;
+}
+
 }  // close unnamed namespace
 
                // --------------------------------------------
@@ -352,6 +394,11 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
         return 1;                                                     // RETURN
     }
 
+    DWORD_PTR affinityMask;
+    if (loadAffinityMask(&affinityMask, attribute)) {
+        return 1;                                                     // RETURN
+    }
+
     ThreadStartupInfo *startInfo = allocStartupInfo();
 
     int stackSize = attribute.stackSize();
@@ -376,12 +423,19 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
                                              stackSize,
                                              ThreadEntry,
                                              startInfo,
-                                             STACK_SIZE_PARAM_IS_A_RESERVATION,
+                                             STACK_SIZE_PARAM_IS_A_RESERVATION
+                                             | CREATE_SUSPENDED,
                                              (unsigned int *)&handle->d_id);
     if ((HANDLE)-1 == handle->d_handle) {
         freeStartupInfo(startInfo);
         return 1;                                                     // RETURN
     }
+    if (affinityMask) {
+        // The thread is suspended, so the affinity is established before it
+        // runs any client code.
+
+        SetThreadAffinityMask(handle->d_handle, affinityMask);
+    }
     if (ThreadAttributes::e_CREATE_DETACHED ==
                                                    attribute.detachedState()) {
         HANDLE tmpHandle = handle->d_handle;
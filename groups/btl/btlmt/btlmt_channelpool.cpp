@@ -16,11 +16,15 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <btlmt_channelstatus.h>
 
 #include <btls_iovecutil.h>
+#include <btlso_defaulteventmanager_iouring.h>
+#include <btlso_ioutil.h>
+#include <btlso_localaddress.h>
 #include <btlso_resolveutil.h>
 #include <btlso_socketimputil.h>
 #include <btlso_lingeroptions.h>
 #include <btlso_socketoptions.h>
 #include <btlso_socketoptutil.h>
+#include <btlso_timemetrics.h>
 
 #include <bdlma_concurrentpool.h>
 #include <btlb_blob.h>
@@ -48,6 +52,8 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
@@ -55,8 +61,11 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
 #endif
 
 #ifdef min
@@ -73,6 +82,11 @@ typedef btlso::StreamSocketFactory<btlso::IPv4Address> StreamSocketFactory;
 typedef btlso::StreamSocketFactoryAutoDeallocateGuard<btlso::IPv4Address>
                                                        AutoCloseSocket;
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+typedef btlso::DefaultEventManager<btlso::Platform::IOURING>
+                                                       IoUringManager;
+#endif
+
 using namespace bdlf::PlaceHolders;
 
 enum {
@@ -102,6 +116,7 @@ enum {
 // channel) are:
 //..
 //  btlmt::Channel::readTimeoutCb              // via registerTimer
+//  btlmt::Channel::zeroCopyTimerCb            // via registerTimer
 //  btlmt::Channel::registerWriteCb            // via execute
 //  btlmt::Channel::disableRead                // via execute
 //  btlmt::Channel::initiateReadSequence       // via execute
@@ -128,6 +143,145 @@ enum {
 // the last scheduled callback has run.  As before, we make the callbacks take
 // the shared pointer *by* *value*.
 
+// ============================================================================
+//                     LOCAL (UNIX-DOMAIN) SOCKET FUNCTIONS
+// ============================================================================
+
+// Local sockets are driven through the same 'btlso::IPv4Address'-based
+// sockets as TCP sockets once they are open, bound, or connected, since
+// reading, writing, and event registration are independent of the address
+// family.  Only the operations naming an endpoint are performed here, through
+// 'btlso::SocketImpUtil' instantiated for 'btlso::LocalAddress'.
+
+namespace {
+
+StreamSocket *allocateLocalSocket(
+                   btlso::InetStreamSocketFactory<btlso::IPv4Address> *factory)
+    // Return the address of a stream socket allocated by the specified
+    // 'factory' for a newly opened local stream socket, or 0 if no local
+    // socket can be opened on this platform.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    btlso::SocketHandle::Handle handle;
+
+    typedef btlso::SocketImpUtil Util;
+
+    if (0 != Util::open<btlso::LocalAddress>(&handle, Util::k_SOCKET_STREAM)) {
+        return 0;                                                     // RETURN
+    }
+
+    return factory->allocate(handle);
+#else
+    (void)factory;
+    return 0;
+#endif
+}
+
+int bindLocalSocket(StreamSocket               *socket,
+                    const btlso::LocalAddress&  address,
+                    bool                        removeStaleFlag)
+    // Bind the specified local 'socket' to the specified 'address'.  If the
+    // specified 'removeStaleFlag' is 'true', first remove any socket file
+    // left at the path of 'address' by a server that is no longer running.
+    // Return 0 on success, and a non-zero value otherwise.  Note that a
+    // socket file is removed only if a connection to it is refused, so that
+    // binding to the path of a running server fails.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    typedef btlso::SocketImpUtil Util;
+
+    struct stat                 info;
+    btlso::SocketHandle::Handle probe;
+
+    if (removeStaleFlag
+     && 0 == ::stat(address.path(), &info)
+     && S_ISSOCK(info.st_mode)
+     && 0 == Util::open<btlso::LocalAddress>(&probe, Util::k_SOCKET_STREAM)) {
+        // Probe without blocking: a running server whose backlog is full
+        // makes the connection fail with 'EAGAIN' rather than wait.
+
+        int errorCode = 0;
+        btlso::IoUtil::setBlockingMode(probe, btlso::IoUtil::e_NONBLOCKING);
+        const int rc = Util::connect(probe, address, &errorCode);
+        Util::close(probe);
+
+        if (0 != rc && ECONNREFUSED == errorCode) {
+            ::unlink(address.path());
+        }
+    }
+
+    return Util::bind(socket->handle(), address);
+#else
+    (void)socket;
+    (void)address;
+    (void)removeStaleFlag;
+    return -1;
+#endif
+}
+
+int connectLocalSocket(StreamSocket               *socket,
+                       const btlso::LocalAddress&  address)
+    // Connect the specified non-blocking local 'socket' to the specified
+    // 'address'.  Return 0 on success, and a negative value otherwise.  Note
+    // that, unlike a TCP connection, a local connection is never left in
+    // progress: 'e_ERROR_WOULDBLOCK' indicates that the backlog of the server
+    // is full, and is reported as 'e_ERROR_NORESOURCES' so that the attempt
+    // is retried instead of waited upon.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    int rc = btlso::SocketImpUtil::connect(socket->handle(), address);
+
+    return btlso::SocketHandle::e_ERROR_WOULDBLOCK == rc
+           ? static_cast<int>(btlso::SocketHandle::e_ERROR_NORESOURCES)
+           : rc;
+#else
+    (void)socket;
+    (void)address;
+    return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;
+#endif
+}
+
+bool isLocalSocket(const btlso::SocketHandle::Handle& handle)
+    // Return 'true' if the specified 'handle' refers to a local (Unix-domain)
+    // socket, and 'false' otherwise.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    sockaddr_storage address;
+    socklen_t        length = sizeof address;
+
+    return 0 == ::getsockname(handle,
+                              reinterpret_cast<sockaddr *>(&address),
+                              &length)
+        && AF_UNIX == address.ss_family;
+#else
+    (void)handle;
+    return false;
+#endif
+}
+
+void removeLocalSocketFile(const btlso::LocalAddress& address)
+    // Remove the socket file at the path of the specified 'address'.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    ::unlink(address.path());
+#else
+    (void)address;
+#endif
+}
+
+bool isZeroCopyCompleted(
+                      const bsl::pair<unsigned int, btlb::BlobBuffer>& buffer,
+                      unsigned int                                     first,
+                      unsigned int                                     last)
+    // Return 'true' if the sequence number of the zero-copy write of the
+    // specified 'buffer' is in the (possibly wrapping) range specified by
+    // 'first' and 'last', and 'false' otherwise.
+{
+    return buffer.first - first <= last - first;
+}
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                     LOCAL CLASS DEFINITIONS
 // ============================================================================
@@ -147,6 +301,21 @@ enum {
     k_WAIT_FOR_RESOURCES = 1,            // 1s
     k_MAX_EXP_BACKOFF    = 64,           // 64s
 
+    // Channel rebalancing parameters: at most 'k_MAX_MIGRATIONS' channels are
+    // migrated per round, and only if the difference between the loads of the
+    // most and least loaded event managers is at least 'k_MIN_IMBALANCE' and
+    // a quarter of the load of the most loaded one.
+
+    k_MAX_MIGRATIONS     = 16,           // channels
+    k_MIN_IMBALANCE      = 4096,         // bytes
+
+    // Zero-copy parameters: completions of zero-copy writes are polled every
+    // 'k_ZERO_COPY_POLL_INTERVAL' while writes are idle, and for at most
+    // 'k_ZERO_COPY_DRAIN_POLLS' intervals by the destructor of a channel.
+
+    k_ZERO_COPY_POLL_INTERVAL = 10,      // ms
+    k_ZERO_COPY_DRAIN_POLLS   = 100,     // polls
+
     // Error codes
 
     e_SET_NONBLOCKING_FAILED = -7, // matches what 'listen' returns
@@ -164,6 +333,12 @@ enum ChannelDownMask {
     e_CLOSED_BOTH_MASK    = e_CLOSED_SEND_MASK | e_CLOSED_RECEIVE_MASK
 };
 
+const bsls::Types::Uint64 k_MIGRATED_RING_REQUEST =
+                                          ~static_cast<bsls::Types::Uint64>(0);
+    // Id recorded by 'Channel::detach' for a ring request that is still
+    // pending in the ring of the event manager the channel was migrated from,
+    // where it has been canceled.
+
                     // ===================
                     // local class Channel
                     // ===================
@@ -195,6 +370,12 @@ class Channel {
     // Synchronization between these two modes is done using the outgoing flag,
     // while synchronizing between any outgoing element (outgoing blob,
     // message, or flag) is done using the outgoing mutex.
+    //
+    // If the channel pool uses 'io_uring' event managers, reading and writing
+    // in the dispatcher thread are instead done by requests submitted to the
+    // ring of the event manager ('submitRingRead' and 'submitRingWrite'),
+    // whose completions invoke 'ringReadCb' and 'ringWriteCb', respectively.
+    // At most one read and one write request are pending at any time.
 
     // PRIVATE TYPES
     typedef ChannelPool::ChannelStateChangeCallback ChannelStateChangeCallback;
@@ -287,10 +468,42 @@ class Channel {
     // Channel managers section
     ChannelPool                     *d_channelPool_p;    // (held)
 
-    TcpTimerEventManager            *d_eventManager_p;   // (held)
+    bsls::AtomicPointer<TcpTimerEventManager>
+                                     d_eventManager_p;   // (held) changed
+                                                         // only by 'detach'
 
     void                            *d_readTimeoutTimerId;
 
+    // Ring I/O section (accessed only in the dispatcher thread)
+
+    btlso::EventManager             *d_ioRing_p;         // (held) 'io_uring'
+                                                         // event manager
+                                                         // underlying
+                                                         // 'd_eventManager_p'
+                                                         // through which this
+                                                         // channel reads and
+                                                         // writes, or 0 if it
+                                                         // uses socket events;
+                                                         // changed only by
+                                                         // 'detach'
+
+    bsls::Types::Uint64              d_ringReadId;       // id of the pending
+                                                         // ring read, or 0
+
+    bsls::Types::Uint64              d_ringWriteId;      // id of the pending
+                                                         // ring write, or 0
+
+    // Channel rebalancing section (guarded by the 'd_rebalanceLock' of the
+    // channel pool)
+
+    bool                             d_pinnedFlag;       // excluded from
+                                                         // rebalancing
+
+    bsls::Types::Int64               d_numBytesAtRebalance;
+                                                         // bytes read and
+                                                         // written as of the
+                                                         // last rebalancing
+
     // Channel statistics section
     bsls::TimeInterval               d_creationTime;     // time this object
                                                          // was created
@@ -333,6 +546,14 @@ class Channel {
     btlb::Blob                       d_blobReadData;     // blob for read data
 
     btlso::IPv4Address               d_peerAddress;      // peer address
+                                                         // (TCP channels)
+
+    btlso::LocalAddress              d_peerLocalAddress; // peer address
+                                                         // (local channels)
+
+    bool                             d_isLocalFlag;      // 'true' if the
+                                                         // socket is a local
+                                                         // (Unix-domain) one
 
     // Memory allocation section (pointers held, not owned)
 
@@ -367,6 +588,35 @@ class Channel {
                                                          // in
                                                          // d_writeActiveData)
 
+    bsls::AtomicInt                  d_zeroCopyThreshold;// minimum number of
+                                                         // bytes written with
+                                                         // zero copy, or 0 if
+                                                         // disabled
+
+    bool                             d_zeroCopyEnabledFlag;
+                                                         // zero copy enabled
+                                                         // on the socket,
+                                                         // guarded by
+                                                         // 'd_writeMutex'
+
+    unsigned int                     d_zeroCopyNextId;   // sequence number of
+                                                         // the next zero-copy
+                                                         // write
+
+    bsl::deque<bsl::pair<unsigned int, btlb::BlobBuffer> >
+                                     d_zeroCopyBuffers;  // buffers of pending
+                                                         // zero-copy writes,
+                                                         // with the sequence
+                                                         // number of the
+                                                         // write; accessed
+                                                         // only in the
+                                                         // dispatcher thread
+
+    void                            *d_zeroCopyTimerId;  // timer releasing
+                                                         // 'd_zeroCopyBuffers'
+                                                         // while writes are
+                                                         // idle, or 0
+
     bdlma::ConcurrentPoolAllocator  *d_sharedPtrRepAllocator_p;
 
     bslma::Allocator                *d_allocator_p;      // for memory
@@ -391,15 +641,45 @@ class Channel {
         // invoking the user callback if required, and adjusting the internal
         // data buffer as needed.
 
+    int populateOVecs(int *numBytes);
+        // Populate the output vector of buffers passed to 'writev' with the
+        // data of the outgoing message not written yet, load into the
+        // specified 'numBytes' the total size of that data, and return the
+        // number of buffers populated.  The behavior is undefined unless the
+        // outgoing message is not empty.
+
+    int processWrittenData(int numBytes, bool zeroCopy);
+        // Process the write of the specified 'numBytes' from the output
+        // vector of buffers, holding on to the buffers written if the
+        // specified 'zeroCopy' is 'true', advancing in or refilling the
+        // outgoing message, and delivering the low-water mark alert as
+        // needed.  Return a non-zero value if more data remains to be written,
+        // and 0 otherwise.
+
     // PRIVATE METHODS
+    void attach(ChannelHandle self, bool writeFlag);
+        // Register the socket events and the read timeout of this channel
+        // with the event manager this channel was migrated to by 'detach',
+        // including a write event if the specified 'writeFlag' is 'true', and
+        // unless already registered or the corresponding half of this channel
+        // is down.  If not executed in the dispatcher thread of the event
+        // manager associated with this channel, forward this call to that
+        // dispatcher thread.
+
     void cancelAll();
         // Remove all the pending timers from the event manager.
 
+    void cancelRingIo(bool readFlag, bool writeFlag);
+        // Cancel the pending ring read if the specified 'readFlag' is 'true',
+        // and the pending ring write if the specified 'writeFlag' is 'true'.
+        // The completion callbacks of canceled requests are still invoked.
+        // The behavior is undefined unless this channel performs its I/O
+        // through the ring of an 'io_uring' event manager.
+
     void deregisterSocketRead(ChannelHandle self);
-        // Deregister this channel for receiving socket read events.  Must be
-        // called only when a read event is registered for the socket
-        // underlying this channel in the event manager associated with this
-        // channel.
+        // Deregister this channel for receiving socket read events, or cancel
+        // its pending ring read if this channel performs its I/O through a
+        // ring.
 
     void deregisterSocketWrite(ChannelHandle self);
         // Deregister this channel for receiving socket write events.  Must be
@@ -407,6 +687,20 @@ class Channel {
         // underlying this channel in the event manager associated with this
         // channel.
 
+    void detach(ChannelHandle         self,
+                TcpTimerEventManager *eventManager,
+                btlso::EventManager  *ioRing);
+        // Migrate this channel to the specified 'eventManager', built on the
+        // specified 'ioRing' event manager if this channel performs its I/O
+        // through a ring: deregister its socket events and read timeout from
+        // its current event manager, cancel its pending ring requests,
+        // associate it with 'eventManager', and execute 'attach' in the
+        // dispatcher thread of 'eventManager'.  This method has no effect if
+        // this channel is down or already associated with 'eventManager'.
+        // If not executed in the dispatcher thread of the event manager
+        // associated with this channel, forward this call to that dispatcher
+        // thread.
+
     void invokeChannelDown(ChannelHandle              self,
                            ChannelPool::ChannelEvents type);
         // Invoke user-installed channel state callback with the specified
@@ -414,6 +708,15 @@ class Channel {
         // 'e_CHANNEL_DOWN_RECEIVE', or 'e_CHANNEL_DOWN_SEND') in the calling
         // thread.
 
+    void invokeChannelStateCb(ChannelHandle               self,
+                              ChannelPool::ChannelEvents  type,
+                              void                       *userData);
+        // Invoke user-installed channel state callback with the specified
+        // 'type' and 'userData' in the dispatcher thread of the event manager
+        // associated with this channel, forwarding this call to that thread if
+        // it is not the calling thread (i.e., if this channel was migrated
+        // after this call was enqueued).
+
     void invokeChannelUp(ChannelHandle self);
         // Invoke user-installed channel state callback with 'e_CHANNEL_UP' in
         // the calling thread.  Note that this function should always be
@@ -465,6 +768,22 @@ class Channel {
         // return non-zero, if there is more data enqueued in the outgoing
         // blob.  Otherwise, return 0.
 
+    void releaseZeroCopyBuffers();
+        // Release the buffers of the zero-copy writes whose completion is
+        // reported by the socket underlying this channel.  Note that this
+        // function should always be executed in the dispatcher thread of the
+        // event manager associated with this channel, or by the destructor.
+
+    void registerZeroCopyTimer(const ChannelHandle& self);
+        // Register 'zeroCopyTimerCb' to be called by the manager in its
+        // dispatcher thread after 'k_ZERO_COPY_POLL_INTERVAL', if zero-copy
+        // writes are pending and the timer is not already registered.  Note
+        // that the timer holds the specified 'self', so that the socket stays
+        // open, and the buffers of the writes alive, until the kernel reports
+        // their completion, even after this channel goes down.  Also note
+        // that this function should always be executed in the dispatcher
+        // thread of the event manager associated with this channel.
+
     void registerReadTimeoutCallback(bsls::TimeInterval   timeout,
                                      const ChannelHandle& self);
         // Register 'readTimeoutCb' to be called by the manager in its
@@ -475,9 +794,38 @@ class Channel {
     void registerWriteCb(ChannelHandle self);
         // Register 'writeCb' to be called by the manager in its dispatcher
         // thread whenever space becomes available in the socket's write
-        // buffers.  Note that this function can be invoked from any thread and
-        // also that the specified 'self' is guaranteed to live throughout the
-        // lifetime of this function call.
+        // buffers, or submit a ring write if this channel performs its I/O
+        // through a ring.  Note that this function can be invoked from any
+        // thread and also that the specified 'self' is guaranteed to live
+        // throughout the lifetime of this function call.
+
+    void ringReadCb(ChannelHandle self, int totalBufferSize, int result);
+        // Process the completion with the specified 'result' (the number of
+        // bytes read, or a negated 'errno' value) of the ring read for which
+        // 'totalBufferSize' bytes were provided, and submit the next ring
+        // read unless reading is disabled or this channel is down for
+        // receiving.  If not executed in the dispatcher thread of the event
+        // manager associated with this channel, forward this call to that
+        // dispatcher thread.
+
+    void ringWriteCb(ChannelHandle self, int result);
+        // Process the completion with the specified 'result' (the number of
+        // bytes written, or a negated 'errno' value) of the ring write, and
+        // submit the next ring write if more data remains to be written.  If
+        // not executed in the dispatcher thread of the event manager
+        // associated with this channel, forward this call to that dispatcher
+        // thread.
+
+    void submitRingRead(ChannelHandle self);
+        // Submit a ring read into the internal data buffer of this channel.
+        // The behavior is undefined unless this channel performs its I/O
+        // through a ring and no ring read is pending.
+
+    void submitRingWrite(ChannelHandle self);
+        // Submit a ring write of the data of the outgoing message not written
+        // yet.  The behavior is undefined unless this channel performs its
+        // I/O through a ring, no ring write is pending, and the outgoing
+        // message is not empty.
 
     void writeCb(ChannelHandle self);
         // Write the first message(s) enqueued for this channel to the
@@ -493,6 +841,20 @@ class Channel {
         // the dispatcher thread of the event manager associated with this
         // channel.
 
+    void zeroCopyTimerCb(ChannelHandle self);
+        // Release the buffers of the completed zero-copy writes of this
+        // channel, and register this callback again if some are still
+        // pending.  Note that, unlike the other callbacks, this callback keeps
+        // running after this channel goes down, and that this function should
+        // always be executed in the dispatcher thread of the event manager
+        // associated with this channel.
+
+    // PRIVATE ACCESSORS
+    bool isInDispatcherThread() const;
+        // Return 'true' if the calling thread is the dispatcher thread of the
+        // event manager currently associated with this channel, and 'false'
+        // otherwise.
+
     // FRIENDS
     friend class ChannelPool;
 
@@ -514,12 +876,16 @@ class Channel {
             btlb::BlobBufferFactory         *writeBlobBufferPool,
             btlb::BlobBufferFactory         *readBlobBufferPool,
             TcpTimerEventManager            *eventManager,
+            btlso::EventManager             *ioRing,
             ChannelPool                     *channelPool,
             bdlma::ConcurrentPoolAllocator  *sharedPtrAllocator,
             bslma::Allocator                *basicAllocator = 0);
         // Create a channel belonging to the specified 'channelPool' and
         // managed by the specified 'eventManager' with the specified
-        // 'sourceId', 'channelId', and 'configuration'.  Assume ownership of
+        // 'sourceId', 'channelId', and 'configuration'.  If the specified
+        // 'ioRing' is not 0, perform the I/O of this channel through the ring
+        // of that 'io_uring' event manager, on which 'eventManager' must be
+        // built, instead of on socket events.  Assume ownership of
         // the specified 'socket' to use as the underlying socket.  Load this
         // channel's channel callback with the specified 'channelCb' and
         // 'blobBasedReadCb' to decide which data callback to use.  Use the
@@ -547,6 +913,14 @@ class Channel {
     void setUserData(void *userData);
         // Set the opaque user data associated to this channel.
 
+    int setZeroCopyThreshold(int numBytes);
+        // Write data with zero copy (see {Zero-Copy Writes} in the
+        // component-level documentation) whenever at least the specified
+        // 'numBytes' are written to the socket at once, or disable zero copy
+        // if 'numBytes' is 0.  Return 0 on success, and a non-zero value if
+        // zero copy is not supported by the socket underlying this channel
+        // or by the ring through which this channel performs its I/O.
+
     template <class MessageType>
     int writeMessage(const MessageType&   msg,
                      int                  enqueueWatermark,
@@ -569,33 +943,44 @@ class Channel {
         // that it has been enqueued successfully.  Also note that 'self' is
         // guaranteed to be valid during the entirety of this call.
 
-    int setWriteQueueHighWatermark(int numBytes);
+    int setWriteQueueHighWatermark(int numBytes, const ChannelHandle& self);
         // Set the write queue high-water mark for this channel to the
         // specified 'numBytes'; return 0 on success, and a non-zero value if
-        // 'numBytes' is less than the low-water mark for the write queue.  The
-        // behavior is undefined unless '0 <= numBytes'.
+        // 'numBytes' is less than the low-water mark for the write queue.  Use
+        // the specified 'self' handle to this channel to deliver any
+        // resulting alert.  The behavior is undefined unless '0 <= numBytes'.
 
-    void setWriteQueueHighWatermarkRaw(int numBytes);
+    void setWriteQueueHighWatermarkRaw(int                  numBytes,
+                                       const ChannelHandle& self);
         // Set the write queue high-water mark for this channel to the
-        // specified 'numBytes'.  The behavior is undefined unless exclusive
-        // write access has been obtained on this channel prior to the call.
+        // specified 'numBytes', using the specified 'self' handle to this
+        // channel to deliver any resulting alert.  The behavior is undefined
+        // unless exclusive write access has been obtained on this channel
+        // prior to the call.
 
-    int setWriteQueueLowWatermark(int numBytes);
+    int setWriteQueueLowWatermark(int numBytes, const ChannelHandle& self);
         // Set the write queue low-water mark for this channel to the specified
         // 'numBytes'; return 0 on success, and a non-zero value if 'numBytes'
-        // is greater than the high-water mark for the write queue.  The
-        // behavior is undefined unless '0 <= numBytes'.
+        // is greater than the high-water mark for the write queue.  Use the
+        // specified 'self' handle to this channel to deliver any resulting
+        // alert.  The behavior is undefined unless '0 <= numBytes'.
 
-    void setWriteQueueLowWatermarkRaw(int numBytes);
+    void setWriteQueueLowWatermarkRaw(int                  numBytes,
+                                      const ChannelHandle& self);
         // Set the write queue low-water mark for this channel to the specified
-        // 'numBytes'.  The behavior is undefined unless exclusive write access
-        // has been obtained on this channel prior to the call.
-
-    void setWriteQueueWatermarks(int lowWatermark, int highWatermark);
+        // 'numBytes', using the specified 'self' handle to this channel to
+        // deliver any resulting alert.  The behavior is undefined unless
+        // exclusive write access has been obtained on this channel prior to
+        // the call.
+
+    void setWriteQueueWatermarks(int                  lowWatermark,
+                                 int                  highWatermark,
+                                 const ChannelHandle& self);
         // Set the write queue low-water and high-water marks for this channel
-        // to the specified 'lowWatermark' and 'highWatermark', respectively.
-        // The behavior is undefined unless '0 <= lowWatermark' and
-        // 'lowWatermark <= highWatermark'.
+        // to the specified 'lowWatermark' and 'highWatermark', respectively,
+        // using the specified 'self' handle to this channel to deliver any
+        // resulting alerts.  The behavior is undefined unless
+        // '0 <= lowWatermark' and 'lowWatermark <= highWatermark'.
 
     void resetRecordedMaxWriteQueueSize();
         // Reset the recorded max write queue size for this channel to the
@@ -617,8 +1002,20 @@ class Channel {
     TcpTimerEventManager *eventManager() const;
         // Return a pointer to this channel's event manager.
 
+    bool isLocal() const;
+        // Return 'true' if this channel is over a local (Unix-domain) socket,
+        // and 'false' otherwise.
+
     const btlso::IPv4Address& peerAddress() const;
         // Return the address of the peer that this channel is connected to.
+        // Note that the default address is returned if this channel is over
+        // a local socket.
+
+    const btlso::LocalAddress& peerLocalAddress() const;
+        // Return the path of the peer that this channel is connected to if
+        // this channel is over a local socket, and the empty path otherwise.
+        // Note that the path of the connecting end of a local channel is
+        // typically empty.
 
     bool isChannelDown(ChannelDownMask mask) const;
         // Return 'true' is this channel is down for the specified 'mask'
@@ -661,20 +1058,42 @@ class Channel {
 inline
 void Channel::deregisterSocketRead(ChannelHandle)
 {
-    d_eventManager_p->deregisterSocketEvent(this->socket()->handle(),
-                                            btlso::EventType::e_READ);
+    if (d_ioRing_p) {
+        cancelRingIo(true, false);
+        return;                                                       // RETURN
+    }
+
+    // Note that the read event may not be registered if this channel was
+    // migrated to its current event manager while reading was disabled.
+
+    TcpTimerEventManager *manager = d_eventManager_p;
+
+    if (manager->isRegistered(socket()->handle(), btlso::EventType::e_READ)) {
+        manager->deregisterSocketEvent(socket()->handle(),
+                                       btlso::EventType::e_READ);
+    }
 }
 
 inline
 void Channel::deregisterSocketWrite(ChannelHandle)
 {
-    if (d_eventManager_p->isRegistered(socket()->handle(),
-                                       btlso::EventType::e_WRITE)) {
-        d_eventManager_p->deregisterSocketEvent(socket()->handle(),
-                                                btlso::EventType::e_WRITE);
+    TcpTimerEventManager *manager = d_eventManager_p;
+
+    if (manager->isRegistered(socket()->handle(), btlso::EventType::e_WRITE)) {
+        manager->deregisterSocketEvent(socket()->handle(),
+                                       btlso::EventType::e_WRITE);
     }
 }
 
+// PRIVATE ACCESSORS
+inline
+bool Channel::isInDispatcherThread() const
+{
+    return bslmt::ThreadUtil::isEqual(
+                                   bslmt::ThreadUtil::self(),
+                                   d_eventManager_p->dispatcherThreadHandle());
+}
+
 // MANIPULATORS
 inline
 void Channel::setUserData(void *userData)
@@ -713,12 +1132,24 @@ bool Channel::isChannelDown(ChannelDownMask mask) const
     return mask == (d_channelDownFlag.loadRelaxed() & mask);
 }
 
+inline
+bool Channel::isLocal() const
+{
+    return d_isLocalFlag;
+}
+
 inline
 const btlso::IPv4Address& Channel::peerAddress() const
 {
     return d_peerAddress;
 }
 
+inline
+const btlso::LocalAddress& Channel::peerLocalAddress() const
+{
+    return d_peerLocalAddress;
+}
+
 inline
 bsls::Types::Int64 Channel::numBytesRead() const
 {
@@ -799,6 +1230,14 @@ class Connector {
 
     btlso::IPv4Address             d_serverAddress;    // server to connect to
 
+    bdlb::NullableValue<btlso::LocalAddress>
+                                   d_localServerAddress;
+                                                       // local (Unix-domain)
+                                                       // server to connect to
+                                                       // instead of
+                                                       // 'd_serverAddress', if
+                                                       // set
+
     bsls::TimeInterval             d_creationTime;     // time at which
                                                        // connection was
                                                        // initiated
@@ -912,6 +1351,7 @@ Connector::Connector(const Connector&  original,
 , d_manager_p (original.d_manager_p)
 , d_serverName(original.d_serverName, basicAllocator)
 , d_serverAddress(original.d_serverAddress)
+, d_localServerAddress(original.d_localServerAddress)
 , d_creationTime(original.d_creationTime)
 , d_period(original.d_period)
 , d_start(original.d_start)
@@ -939,6 +1379,12 @@ class ServerState {
     // DATA MEMBERS
     btlso::IPv4Address          d_endpoint;           // server address
 
+    btlso::LocalAddress         d_localEndpoint;      // path of the socket
+                                                      // file of a local
+                                                      // (Unix-domain) server,
+                                                      // removed upon
+                                                      // destruction, or empty
+
     StreamSocket               *d_socket_p;           // accepting socket
                                                       // (owned)
 
@@ -1003,6 +1449,10 @@ ServerState::~ServerState()
         d_factory_p->deallocate(d_socket_p);
         d_socket_p = 0;  // for debugging now, shouldn't slow anything down
     }
+
+    if (!d_localEndpoint.isEmpty()) {
+        removeLocalSocketFile(d_localEndpoint);
+    }
 }
 
 // ============================================================================
@@ -1100,6 +1550,58 @@ int Channel::populateIVecs()
     return totalBufferSize;
 }
 
+int Channel::populateOVecs(int *numBytes)
+{
+    BSLS_ASSERT(numBytes);
+    BSLS_ASSERT(0 < d_writeActiveData->length());
+
+    // The portion of the current outgoing message not yet written is indicated
+    // by the current buffer index and the offset in the current buffer of the
+    // first byte not written.
+
+    const int numBuffers    = d_writeActiveData->numDataBuffers();
+    const int currentBuffer = d_writeActiveDataCurrentBuffer;
+    const int currentOffset = d_writeActiveDataCurrentOffset;
+
+    BSLS_ASSERT(0 <= currentBuffer);
+    BSLS_ASSERT(currentBuffer < numBuffers);
+
+    bsls::PerformanceHint::prefetchForReading(
+              d_writeActiveData->buffer(currentBuffer).data() + currentOffset);
+
+    const int bufSize = currentBuffer < numBuffers - 1
+                        ? d_writeActiveData->buffer(currentBuffer).size()
+                        : d_writeActiveData->lastDataBufferLength();
+
+    BSLS_ASSERT(0 <= currentOffset);
+    BSLS_ASSERT(currentOffset < bufSize);
+
+    int numVecs    = 1;
+    int numMaxVecs = bsl::min(numBuffers - currentBuffer,
+                              static_cast<int>(k_MAX_IOVEC_SIZE));
+
+    d_ovecs[0].setBuffer(
+               d_writeActiveData->buffer(currentBuffer).data() + currentOffset,
+               bufSize - currentOffset);
+
+    *numBytes = bufSize - currentOffset;
+
+    for (int i = currentBuffer + 1; numVecs < numMaxVecs; ++i, ++numVecs) {
+        const btlb::BlobBuffer&  blobBuffer = d_writeActiveData->buffer(i);
+        char                    *buf = blobBuffer.data();
+
+        bsls::PerformanceHint::prefetchForReading(buf);
+
+        const int length = i < numBuffers - 1
+                           ? blobBuffer.size()
+                           : d_writeActiveData->lastDataBufferLength();
+
+        d_ovecs[numVecs].setBuffer(buf, length);
+        *numBytes += length;
+    }
+    return numVecs;
+}
+
 void Channel::processReadData(int numBytes)
 {
     BSLS_ASSERT(0 <= numBytes);
@@ -1122,6 +1624,100 @@ void Channel::processReadData(int numBytes)
         d_minBytesBeforeNextCb = minAdditional;
     }
 }
+
+int Channel::processWrittenData(int numBytes, bool zeroCopy)
+{
+    BSLS_ASSERT(0 < numBytes);
+
+    { // Lock, just for updating the stats.
+        bslmt::LockGuard<bslmt::Mutex> oGuard(&d_writeMutex);
+
+        d_numBytesWritten.addRelaxed(numBytes);
+        d_writeActiveQueueSize.addRelaxed(-numBytes);
+
+        if (d_highWatermarkHitFlag
+         && (currentWriteQueueSize() <= d_writeQueueLowWater)) {
+
+            d_highWatermarkHitFlag = false;
+
+            oGuard.release()->unlock();
+
+            d_channelStateCb(d_channelId,
+                             d_sourceId,
+                             ChannelPool::e_WRITE_QUEUE_LOWWATER,
+                             d_userData);
+        }
+    } // End of the lock guard.
+
+    // Advance the buffer count for the outgoing message.  Note that there are
+    // no locks required here.  Status gets subtracted by the number of bytes
+    // written in the iovec write buffers, and should be 0, except if the last
+    // buffer is not completely written.
+
+    const int numBuffers    = d_writeActiveData->numDataBuffers();
+    int       currentBuffer = d_writeActiveDataCurrentBuffer;
+    int       currentOffset = d_writeActiveDataCurrentOffset;
+    int       bufSize       = currentBuffer < numBuffers - 1
+                              ? d_writeActiveData->buffer(currentBuffer).size()
+                              : d_writeActiveData->lastDataBufferLength();
+
+    const int firstBuffer = currentBuffer;
+
+    while (0 < numBytes && bufSize <= numBytes + currentOffset) {
+        numBytes -= bufSize - currentOffset;
+        ++currentBuffer;
+        currentOffset = 0;
+        bufSize = currentBuffer < numBuffers - 1
+                  ? d_writeActiveData->buffer(currentBuffer).size()
+                  : d_writeActiveData->lastDataBufferLength();
+    }
+    currentOffset += numBytes;
+    BSLS_ASSERT(currentBuffer <= numBuffers);
+
+    if (zeroCopy) {
+        // The kernel references the buffers written until it reports the
+        // completion of this write: hold on to them until then, so that they
+        // are not reused by their factory.
+
+        const int endBuffer = 0 < currentOffset
+                              ? currentBuffer + 1
+                              : currentBuffer;
+
+        for (int i = firstBuffer; i < endBuffer; ++i) {
+            d_zeroCopyBuffers.push_back(bsl::make_pair(
+                                                d_zeroCopyNextId,
+                                                d_writeActiveData->buffer(i)));
+        }
+        ++d_zeroCopyNextId;
+    }
+
+    // Update the outgoing message with the new current buffer and offset
+    // information.
+
+    if (currentBuffer < numBuffers) {
+        // The current buffer and offset of the outgoing message may have
+        // changed.  This must be recorded.
+
+        d_writeActiveDataCurrentBuffer = currentBuffer;
+        d_writeActiveDataCurrentOffset = currentOffset;
+        return 1;                                                     // RETURN
+    }
+
+    BSLS_ASSERT(0 == currentOffset);
+
+    // There is no more data to write from 'd_writeActiveData'.  Empty the
+    // outgoing message since all the data there has been written.
+
+    d_writeActiveData->removeAll();
+    d_writeActiveDataCurrentBuffer = 0;
+    d_writeActiveDataCurrentOffset = 0;
+
+    // We must try again with the next messages in the queue, so now we need to
+    // lock to gain access to the d_writeEnqueuedData.  This is done in
+    // 'refillOutgoingMsg'.
+
+    return !isChannelDown(e_CLOSED_SEND_MASK) && refillOutgoingMsg();
+}
 }  // close package namespace
 
 // ============================================================================
@@ -1139,27 +1735,213 @@ namespace btlmt {
                     // -------------------
 
 // PRIVATE MANIPULATORS
+void Channel::attach(ChannelHandle self, bool writeFlag)
+{
+    BSLS_ASSERT(this == self.get());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated again before this functor was executed.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(&Channel::attach,
+                                                       this,
+                                                       self,
+                                                       writeFlag));
+        return;                                                       // RETURN
+    }
+
+    TcpTimerEventManager *manager = d_eventManager_p;
+
+    registerZeroCopyTimer(self);
+
+    if (d_ioRing_p) {
+        // Ring requests canceled by 'detach' resubmit themselves to the ring
+        // of 'manager' on completion (see 'ringReadCb' and 'ringWriteCb'), so
+        // that only the read needs to be started here.
+
+        if (d_enableReadFlag && !isChannelDown(e_CLOSED_RECEIVE_MASK)) {
+            if (!d_ringReadId) {
+                submitRingRead(self);
+            }
+
+            if (d_useReadTimeout && !d_readTimeoutTimerId) {
+                registerReadTimeoutCallback(
+                               bdlt::CurrentTime::now() + d_readTimeout, self);
+            }
+        }
+        return;                                                       // RETURN
+    }
+
+    // Note that some of the socket events may already have been registered
+    // with 'manager' by functors that were enqueued after the migration (but
+    // executed before this call), hence the checks below.
+
+    if (d_enableReadFlag
+     && !isChannelDown(e_CLOSED_RECEIVE_MASK)
+     && !manager->isRegistered(socket()->handle(),
+                               btlso::EventType::e_READ)) {
+        bsl::function<void()> readFunctor(bdlf::BindUtil::bind(
+                                                              &Channel::readCb,
+                                                               this,
+                                                               self));
+
+        if (0 != manager->registerSocketEvent(socket()->handle(),
+                                              btlso::EventType::e_READ,
+                                              readFunctor)) {
+            notifyChannelDown(self, btlso::Flag::e_SHUTDOWN_RECEIVE);
+            return;                                                   // RETURN
+        }
+
+        if (d_useReadTimeout && !d_readTimeoutTimerId) {
+            registerReadTimeoutCallback(
+                               bdlt::CurrentTime::now() + d_readTimeout, self);
+        }
+    }
+
+    if (writeFlag
+     && !isChannelDown(e_CLOSED_SEND_MASK)
+     && !manager->isRegistered(socket()->handle(),
+                               btlso::EventType::e_WRITE)) {
+        bsl::function<void()> writeFunctor(bdlf::BindUtil::bind(
+                                                             &Channel::writeCb,
+                                                              this,
+                                                              self));
+
+        if (0 != manager->registerSocketEvent(socket()->handle(),
+                                              btlso::EventType::e_WRITE,
+                                              writeFunctor)) {
+            notifyChannelDown(self, btlso::Flag::e_SHUTDOWN_SEND);
+        }
+    }
+}
+
+void Channel::cancelRingIo(bool readFlag, bool writeFlag)
+{
+    BSLS_ASSERT(d_ioRing_p);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    IoUringManager *ring = static_cast<IoUringManager *>(d_ioRing_p);
+
+    if (readFlag && d_ringReadId && k_MIGRATED_RING_REQUEST != d_ringReadId) {
+        ring->cancelIo(d_ringReadId);
+    }
+
+    if (writeFlag
+     && d_ringWriteId
+     && k_MIGRATED_RING_REQUEST != d_ringWriteId) {
+        ring->cancelIo(d_ringWriteId);
+    }
+#else
+    (void)readFlag;
+    (void)writeFlag;
+#endif
+}
+
+void Channel::detach(ChannelHandle         self,
+                     TcpTimerEventManager *eventManager,
+                     btlso::EventManager  *ioRing)
+{
+    BSLS_ASSERT(this == self.get());
+    BSLS_ASSERT(eventManager);
+    BSLS_ASSERT(!d_ioRing_p == !ioRing);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated before this functor was executed.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(&Channel::detach,
+                                                       this,
+                                                       self,
+                                                       eventManager,
+                                                       ioRing));
+        return;                                                       // RETURN
+    }
+
+    TcpTimerEventManager *manager = d_eventManager_p;
+
+    if (manager == eventManager || isChannelDown(e_CLOSED_BOTH_MASK)) {
+        return;                                                       // RETURN
+    }
+
+    // Since this method executes in the dispatcher thread of 'manager', no
+    // callback of this channel is running concurrently, and once the socket
+    // events are deregistered none will be invoked by 'manager' anymore.
+    // Functors that are still enqueued in 'manager' will forward themselves
+    // to 'eventManager' (see 'isInDispatcherThread').
+
+    const bool writeFlag = manager->isRegistered(socket()->handle(),
+                                                 btlso::EventType::e_WRITE);
+
+    manager->deregisterSocket(socket()->handle());
+
+    if (d_readTimeoutTimerId) {
+        manager->deregisterTimer(d_readTimeoutTimerId);
+        d_readTimeoutTimerId = 0;
+    }
+
+    if (d_zeroCopyTimerId) {
+        manager->deregisterTimer(d_zeroCopyTimerId);
+        d_zeroCopyTimerId = 0;
+    }
+
+    if (d_ioRing_p) {
+        // The completions of the canceled requests are delivered by
+        // 'manager', and forwarded to 'eventManager'.  Their ids are
+        // meaningless in 'ioRing', hence the marker preventing another
+        // cancellation there while still showing the requests as pending.
+
+        cancelRingIo(true, true);
+
+        if (d_ringReadId) {
+            d_ringReadId = k_MIGRATED_RING_REQUEST;
+        }
+        if (d_ringWriteId) {
+            d_ringWriteId = k_MIGRATED_RING_REQUEST;
+        }
+        d_ioRing_p = ioRing;
+    }
+
+    d_eventManager_p = eventManager;
+
+    eventManager->execute(bdlf::BindUtil::bind(&Channel::attach,
+                                               this,
+                                               self,
+                                               writeFlag));
+}
+
 void Channel::invokeChannelDown(ChannelHandle              self,
                                 ChannelPool::ChannelEvents type)
 {
-    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
-                                  bslmt::ThreadUtil::self(),
-                                  d_eventManager_p->dispatcherThreadHandle()));
     BSLS_ASSERT(this == self.get());
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated after this functor was enqueued.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(
+                                                   &Channel::invokeChannelDown,
+                                                    this,
+                                                    self,
+                                                    type));
+        return;                                                       // RETURN
+    }
+
     // We are guaranteed that 'self' is valid, and holding this 'self'
     // channel will delay the destruction of this channel until at least the
     // callback completes.
 
     if (ChannelPool::e_CHANNEL_DOWN_READ == type) {
-        if (d_eventManager_p->isRegistered(socket()->handle(),
-                                           btlso::EventType::e_READ)) {
-            d_eventManager_p->deregisterSocketEvent(socket()->handle(),
-                                                    btlso::EventType::e_READ);
-        }
+        deregisterSocketRead(self);
     }
     else if (ChannelPool::e_CHANNEL_DOWN == type) {
         d_eventManager_p->deregisterSocket(socket()->handle());
+
+        if (d_ioRing_p) {
+            cancelRingIo(true, true);
+        }
     }
 
     // Do not deregister the read time out if not closing the read part.
@@ -1171,15 +1953,51 @@ void Channel::invokeChannelDown(ChannelHandle              self,
         }
     }
 
+    // Keep releasing the buffers of the zero-copy writes, if any, once
+    // 'writeCb' is no longer invoked.
+
+    if (ChannelPool::e_CHANNEL_DOWN_READ != type) {
+        registerZeroCopyTimer(self);
+    }
+
     d_channelStateCb(d_channelId, d_sourceId, type, d_userData);
     d_channelUpFlag = 0;
 }
 
-void Channel::invokeChannelUp(ChannelHandle)
+void Channel::invokeChannelStateCb(ChannelHandle               self,
+                                   ChannelPool::ChannelEvents  type,
+                                   void                       *userData)
 {
-    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
-                                  bslmt::ThreadUtil::self(),
-                                  d_eventManager_p->dispatcherThreadHandle()));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated after this functor was enqueued.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(
+                                                &Channel::invokeChannelStateCb,
+                                                 this,
+                                                 self,
+                                                 type,
+                                                 userData));
+        return;                                                       // RETURN
+    }
+
+    d_channelStateCb(d_channelId, d_sourceId, type, userData);
+}
+
+void Channel::invokeChannelUp(ChannelHandle self)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated after this functor was enqueued.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(
+                                                     &Channel::invokeChannelUp,
+                                                      this,
+                                                      self));
+        return;                                                       // RETURN
+    }
 
     d_channelStateCb(d_channelId,
                      d_sourceId,
@@ -1346,6 +2164,14 @@ void Channel::readCb(ChannelHandle self)
         return;                                                       // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_zeroCopyBuffers.empty())) {
+        // Completion notifications are reported as errors on the socket,
+        // i.e., they trigger the read event until they are consumed.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        releaseZeroCopyBuffers();
+    }
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_enableReadFlag)) {
         // This readCb was still pending while we were executing 'disableRead'
         // and didn't get properly deregistered.  We abort now to avoid
@@ -1457,7 +2283,11 @@ void Channel::readCb(ChannelHandle self)
             return;                                                   // RETURN
         }
 
-        if (readRet != totalBufferSize) {
+        if (readRet != totalBufferSize
+         && !d_eventManager_p->isEdgeTriggered()) {
+            // In edge-triggered mode, 'readCb' is not invoked again until
+            // more data arrives, so keep reading until the read would block.
+
             break;
         }
     }
@@ -1490,6 +2320,17 @@ void Channel::readTimeoutCb(ChannelHandle self)
 
     d_readTimeoutTimerId = 0;
 
+    if (d_ioRing_p) {
+        // The pending ring read completes on its own when the peer
+        // disconnects, so just wait for the next timeout.
+
+        if (d_enableReadFlag && !isChannelDown(e_CLOSED_RECEIVE_MASK)) {
+            registerReadTimeoutCallback(
+                               bdlt::CurrentTime::now() + d_readTimeout, self);
+        }
+        return;                                                       // RETURN
+    }
+
     readCb(self);
 }
 
@@ -1522,6 +2363,28 @@ int Channel::refillOutgoingMsg()
     return 1;
 }
 
+void Channel::releaseZeroCopyBuffers()
+{
+    unsigned int first, last;
+    while (0 == btlso::SocketImpUtil::readZeroCopyCompletion(
+                                                         &first,
+                                                         &last,
+                                                         socket()->handle())) {
+        // Writes usually complete in order, but a retransmission may delay
+        // the completion of a write past that of the following ones.
+
+        d_zeroCopyBuffers.erase(
+                         bsl::remove_if(d_zeroCopyBuffers.begin(),
+                                        d_zeroCopyBuffers.end(),
+                                        bdlf::BindUtil::bind(
+                                                         &isZeroCopyCompleted,
+                                                         _1,
+                                                         first,
+                                                         last)),
+                         d_zeroCopyBuffers.end());
+    }
+}
+
 void Channel::registerReadTimeoutCallback(bsls::TimeInterval   timeout,
                                           const ChannelHandle& self)
 {
@@ -1539,27 +2402,181 @@ void Channel::registerReadTimeoutCallback(bsls::TimeInterval   timeout,
                                                            readTimeoutFunctor);
 }
 
+void Channel::registerZeroCopyTimer(const ChannelHandle& self)
+{
+    if (d_zeroCopyBuffers.empty() || d_zeroCopyTimerId) {
+        return;                                                       // RETURN
+    }
+
+    bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+    timeout.addMilliseconds(k_ZERO_COPY_POLL_INTERVAL);
+
+    bsl::function<void()> zeroCopyFunctor(bdlf::BindUtil::bind(
+                                                     &Channel::zeroCopyTimerCb,
+                                                      this,
+                                                      self));
+
+    d_zeroCopyTimerId = d_eventManager_p->registerTimer(timeout,
+                                                        zeroCopyFunctor);
+}
+
 void Channel::registerWriteCb(ChannelHandle self)
 {
     // This callback is executed whenever data is available in
     // 'd_writeActiveData'.
 
-    if (0 != protectAndCheckCallback(self, e_CLOSED_SEND_MASK)) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated after this functor was enqueued.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(
+                                                     &Channel::registerWriteCb,
+                                                      this,
+                                                      self));
+        return;                                                       // RETURN
+    }
+
+    if (0 != protectAndCheckCallback(self, e_CLOSED_SEND_MASK)) {
+        return;                                                       // RETURN
+    }
+
+    if (d_ioRing_p) {
+        if (!d_ringWriteId) {
+            submitRingWrite(self);
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::function<void()> writeFunctor(bdlf::BindUtil::bind(&Channel::writeCb,
+                                                             this,
+                                                             self));
+
+    int rCode = d_eventManager_p->registerSocketEvent(
+                                                     this->socket()->handle(),
+                                                     btlso::EventType::e_WRITE,
+                                                     writeFunctor);
+
+    if (0 != rCode) {
+        if (isChannelDown(e_CLOSED_SEND_MASK)) {
+
+            d_channelStateCb(d_channelId,
+                             d_sourceId,
+                             ChannelPool::e_MESSAGE_DISCARDED,
+                             d_userData);
+        }
+        else {
+            notifyChannelDown(self, btlso::Flag::e_SHUTDOWN_SEND);
+        }
+    }
+
+    // We simply wait until the socket calls us back.
+}
+
+void Channel::ringReadCb(ChannelHandle self, int totalBufferSize, int result)
+{
+    BSLS_ASSERT(this == self.get());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated while this read was pending.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(&Channel::ringReadCb,
+                                                       this,
+                                                       self,
+                                                       totalBufferSize,
+                                                       result));
+        return;                                                       // RETURN
+    }
+
+    d_ringReadId = 0;
+
+    if (0 != protectAndCheckCallback(self, e_CLOSED_RECEIVE_MASK)) {
+        return;                                                       // RETURN
+    }
+
+    if (0 < result) {
+        BSLS_ASSERT(result <= totalBufferSize);
+
+        d_numBytesRead.addRelaxed(result);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_enableReadFlag)) {
+            processReadData(result);
+        }
+        else {
+            // Reading was disabled while this read was pending: keep the data
+            // for the first callback after reading is enabled again.
+
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            d_blobReadData.setLength(d_blobReadData.length() + result);
+        }
+        allocateNextReadBuffers(result, totalBufferSize);
+
+        if (d_useReadTimeout && d_enableReadFlag) {
+            const bsls::TimeInterval timeout = bdlt::CurrentTime::now()
+                                             + d_readTimeout;
+
+            if (!d_readTimeoutTimerId) {
+                registerReadTimeoutCallback(timeout, self);
+            }
+            else {
+                const int rc = d_eventManager_p->rescheduleTimer(
+                                                          d_readTimeoutTimerId,
+                                                          timeout);
+                BSLS_ASSERT(!rc);
+            }
+        }
+    }
+    else if (-ECANCELED != result && -EAGAIN != result) {
+        // Note that a 0 'result' reports that the peer shut down the
+        // connection.
+
+        notifyChannelDown(self, btlso::Flag::e_SHUTDOWN_RECEIVE);
+        return;                                                       // RETURN
+    }
+
+    // Note that the user callback may have disabled reading, or disabled and
+    // enabled it again (submitting a new read).
+
+    if (d_enableReadFlag
+     && !d_ringReadId
+     && !isChannelDown(e_CLOSED_RECEIVE_MASK)) {
+        submitRingRead(self);
+    }
+}
+
+void Channel::ringWriteCb(ChannelHandle self, int result)
+{
+    BSLS_ASSERT(this == self.get());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated while this write was pending.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(&Channel::ringWriteCb,
+                                                       this,
+                                                       self,
+                                                       result));
+        return;                                                       // RETURN
+    }
+
+    d_ringWriteId = 0;
+
+    if (0 != protectAndCheckCallback(self)) {
         return;                                                       // RETURN
     }
 
-    bsl::function<void()> writeFunctor(bdlf::BindUtil::bind(&Channel::writeCb,
-                                                             this,
-                                                             self));
-
-    int rCode = d_eventManager_p->registerSocketEvent(
-                                                     this->socket()->handle(),
-                                                     btlso::EventType::e_WRITE,
-                                                     writeFunctor);
+    if (0 < result) {
+        if (!processWrittenData(result, false)) {
+            // There isn't any pending data, our work here is done.
 
-    if (0 != rCode) {
+            return;                                                   // RETURN
+        }
+    }
+    else if (-ECANCELED != result && -EAGAIN != result) {
         if (isChannelDown(e_CLOSED_SEND_MASK)) {
-
             d_channelStateCb(d_channelId,
                              d_sourceId,
                              ChannelPool::e_MESSAGE_DISCARDED,
@@ -1568,9 +2585,73 @@ void Channel::registerWriteCb(ChannelHandle self)
         else {
             notifyChannelDown(self, btlso::Flag::e_SHUTDOWN_SEND);
         }
+        return;                                                       // RETURN
     }
 
-    // We simply wait until the socket calls us back.
+    // Note that, since this channel is not down, a canceled write was
+    // canceled by 'detach', and is resubmitted to the ring of the event
+    // manager this channel was migrated to.
+
+    submitRingWrite(self);
+}
+
+void Channel::submitRingRead(ChannelHandle self)
+{
+    BSLS_ASSERT(d_ioRing_p);
+    BSLS_ASSERT(!d_ringReadId);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_numUsedIVecs)) {
+        // Create incoming message.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        initDataBufferForReads();
+        d_numUsedIVecs = 1;
+    }
+
+    const int totalBufferSize = populateIVecs();
+
+    // Note that ring reads bypass the 'StreamSocket' and are made directly on
+    // its handle.
+
+    d_ringReadId = static_cast<IoUringManager *>(d_ioRing_p)->submitReadv(
+                                    socket()->handle(),
+                                    d_ivecs,
+                                    d_numUsedIVecs,
+                                    bdlf::BindUtil::bind(&Channel::ringReadCb,
+                                                         this,
+                                                         self,
+                                                         totalBufferSize,
+                                                         _1));
+#else
+    (void)self;
+#endif
+}
+
+void Channel::submitRingWrite(ChannelHandle self)
+{
+    BSLS_ASSERT(d_ioRing_p);
+    BSLS_ASSERT(!d_ringWriteId);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    int       numBytes;
+    const int numVecs = populateOVecs(&numBytes);
+
+    // Note that ring writes bypass the 'StreamSocket' and are made directly on
+    // its handle.
+
+    d_ringWriteId = static_cast<IoUringManager *>(d_ioRing_p)->submitWritev(
+                                 socket()->handle(),
+                                 reinterpret_cast<const btls::Ovec *>(d_ovecs),
+                                 numVecs,
+                                 bdlf::BindUtil::bind(&Channel::ringWriteCb,
+                                                      this,
+                                                      self,
+                                                      _1));
+#else
+    (void)self;
+#endif
 }
 
 void Channel::writeCb(ChannelHandle self)
@@ -1582,6 +2663,11 @@ void Channel::writeCb(ChannelHandle self)
         return;                                                       // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_zeroCopyBuffers.empty())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        releaseZeroCopyBuffers();
+    }
+
     // This method is always executed in the dispatcher thread of the event
     // manager, and thus there is no race with 'writeMessage', as long as the
     // outgoing flag is set (since 'writeMessage' will append to the outgoing
@@ -1591,56 +2677,33 @@ void Channel::writeCb(ChannelHandle self)
 
     // BSLS_ASSERT(d_isWriteActive); // not atomic anymore
 
-    // The portion of the current outgoing message not yet written is indicated
-    // by the first user data field (current buffer index) and second user data
-    // field (offset in current buffer of first byte not written).
-
-    BSLS_ASSERT(0 < d_writeActiveData->length());
-
-    int numBuffers = d_writeActiveData->numDataBuffers();
-    BSLS_ASSERT(0 < numBuffers);
-
-    int currentBuffer = d_writeActiveDataCurrentBuffer;
-    int currentOffset = d_writeActiveDataCurrentOffset;
-
-    bsls::PerformanceHint::prefetchForReading(
-              d_writeActiveData->buffer(currentBuffer).data() + currentOffset);
-
-    BSLS_ASSERT(0 <= currentBuffer);
-    BSLS_ASSERT(currentBuffer < numBuffers);
-
-    int bufSize = currentBuffer < numBuffers - 1
-                  ? d_writeActiveData->buffer(currentBuffer).size()
-                  : d_writeActiveData->lastDataBufferLength();
-
-    BSLS_ASSERT(0 <= currentOffset);
-    BSLS_ASSERT(currentOffset < bufSize);
-
     while (1) {
         // Write data into the socket, using 'writev' for efficiency.
 
-        int numVecs = 1;
-        int numMaxVecs = bsl::min(numBuffers - currentBuffer,
-                                  static_cast<int>(k_MAX_IOVEC_SIZE));
+        int       numBytes;
+        const int numVecs = populateOVecs(&numBytes);
 
-        d_ovecs[0].setBuffer(
-               d_writeActiveData->buffer(currentBuffer).data() + currentOffset,
-               bufSize - currentOffset);
+        const int zeroCopyThreshold = d_zeroCopyThreshold.loadRelaxed();
+        bool      zeroCopy          = false;
 
-        for (int i = currentBuffer + 1; numVecs < numMaxVecs; ++i, ++numVecs) {
-            const btlb::BlobBuffer&  blobBuffer = d_writeActiveData->buffer(i);
-            char                    *buf = blobBuffer.data();
+        int writeRet;
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                           0 < zeroCopyThreshold
+                                        && zeroCopyThreshold <= numBytes)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
-            bsls::PerformanceHint::prefetchForReading(buf);
+            // Note that zero-copy writes bypass the 'StreamSocket' and are
+            // made directly on its handle.
 
-            d_ovecs[numVecs].setBuffer(
-                                  buf,
-                                  i < numBuffers - 1
-                                  ? blobBuffer.size()
-                                  : d_writeActiveData->lastDataBufferLength());
+            writeRet = btlso::SocketImpUtil::writevZeroCopy(
+                                 &zeroCopy,
+                                 socket()->handle(),
+                                 reinterpret_cast<const btls::Ovec *>(d_ovecs),
+                                 numVecs);
+        }
+        else {
+            writeRet = socket()->writev(d_ovecs, numVecs);
         }
-
-        int writeRet = socket()->writev(d_ovecs, numVecs);
 
         if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == writeRet) {
             // In theory, this is the only writing thread so if 'writeCb' we
@@ -1670,89 +2733,34 @@ void Channel::writeCb(ChannelHandle self)
             return;                                                   // RETURN
         }
 
-        // Otherwise proceed with reporting.
-
-        { // Lock, just for updating the stats.
-            bslmt::LockGuard<bslmt::Mutex> oGuard(&d_writeMutex);
-
-            d_numBytesWritten.addRelaxed(writeRet);
-            d_writeActiveQueueSize.addRelaxed(-writeRet);
-
-            if (d_highWatermarkHitFlag
-             && (currentWriteQueueSize() <= d_writeQueueLowWater)) {
-
-                d_highWatermarkHitFlag = false;
-
-                oGuard.release()->unlock();
-
-                d_channelStateCb(d_channelId,
-                                 d_sourceId,
-                                 ChannelPool::e_WRITE_QUEUE_LOWWATER,
-                                 d_userData);
-            }
-        } // End of the lock guard.
-
-        // Advance the buffer count for the outgoing message.  Note that there
-        // are no locks required here.  Status gets subtracted by the number of
-        // bytes written in the iovec write buffers, and should be 0, except if
-        // the last buffer is not completely written.
-
-        while (0 < writeRet && bufSize <= writeRet + currentOffset) {
-            writeRet -= bufSize - currentOffset;
-            ++currentBuffer;
-            currentOffset = 0;
-            bufSize = currentBuffer < numBuffers - 1
-                      ? d_writeActiveData->buffer(currentBuffer).size()
-                      : d_writeActiveData->lastDataBufferLength();
-        }
-        currentOffset += writeRet;
-        BSLS_ASSERT(currentBuffer <= numBuffers);
-
-        // Update the outgoing message with the new current buffer and offset
-        // information.
+        // Otherwise proceed with reporting, and continue with the rest of the
+        // outgoing message or with the next messages in the queue.
 
-        if (currentBuffer < numBuffers) {
-            // The current buffer and offset of the outgoing message may
-            // have changed.  This must be recorded.
+        if (!processWrittenData(writeRet, zeroCopy)) {
+            // There isn't any pending data, our work here is done, but the
+            // completions of the zero-copy writes must still be collected.
 
-            d_writeActiveDataCurrentBuffer = currentBuffer;
-            d_writeActiveDataCurrentOffset = currentOffset;
+            deregisterSocketWrite(self);
+            registerZeroCopyTimer(self);
+            return;                                                   // RETURN
         }
-        else {
-            BSLS_ASSERT(0 == currentOffset);
-
-            // There is no more data to write from 'd_writeActiveData'.  Empty
-            // the outgoing message since all the data there has been written.
-
-            d_writeActiveData->removeAll();
-            d_writeActiveDataCurrentBuffer = 0;
-            d_writeActiveDataCurrentOffset = 0;
-
-            // We must try again with the next messages in the queue, so now we
-            // need to lock to gain access to the d_writeEnqueuedData.  This is
-            // done in 'refillOutgoingMsg'.
+    }
 
-            if (isChannelDown(e_CLOSED_SEND_MASK) || !refillOutgoingMsg()) {
-                // There isn't any pending data, our work here is done.
+    BSLS_ASSERT(0 && "Unreachable by design");
+}
 
-                deregisterSocketWrite(self);
-                return;                                               // RETURN
-            }
+void Channel::zeroCopyTimerCb(ChannelHandle self)
+{
+    // Do not 'protectAndCheckCallback': the timer holds 'self' so that the
+    // socket stays open until the kernel is done with the buffers, even after
+    // this channel goes down.
 
-            // Start next write at the beginning of the new blob.  Maintain the
-            // invariant that 'bufSize' corresponds to the data length of the
-            // current buffer.
+    BSLS_ASSERT(isInDispatcherThread());
 
-            numBuffers    = d_writeActiveData->numDataBuffers();
-            currentBuffer = 0;
-            currentOffset = 0;
-            bufSize       = 1 < numBuffers
-                            ? d_writeActiveData->buffer(0).size()
-                            : d_writeActiveData->lastDataBufferLength();
-        }
-    }
+    d_zeroCopyTimerId = 0;
 
-    BSLS_ASSERT(0 && "Unreachable by design");
+    releaseZeroCopyBuffers();
+    registerZeroCopyTimer(self);
 }
 
 // CREATORS
@@ -1767,6 +2775,7 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
                  btlb::BlobBufferFactory         *writeBlobBufferPool,
                  btlb::BlobBufferFactory         *readBlobBufferPool,
                  TcpTimerEventManager            *eventManager,
+                 btlso::EventManager             *ioRing,
                  ChannelPool                     *channelPool,
                  bdlma::ConcurrentPoolAllocator  *sharedPtrAllocator,
                  bslma::Allocator                *basicAllocator)
@@ -1792,6 +2801,11 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
 , d_channelPool_p(channelPool)
 , d_eventManager_p(eventManager)
 , d_readTimeoutTimerId(0)
+, d_ioRing_p(ioRing)
+, d_ringReadId(0)
+, d_ringWriteId(0)
+, d_pinnedFlag(false)
+, d_numBytesAtRebalance(0)
 , d_creationTime(bdlt::CurrentTime::now())
 , d_numBytesRead(0)
 , d_numBytesWritten(0)
@@ -1799,18 +2813,33 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
 , d_recordedMaxWriteQueueSize(0)
 , d_readBlobFactory_p(readBlobBufferPool)
 , d_blobReadData(d_readBlobFactory_p, basicAllocator)
+, d_isLocalFlag(isLocalSocket(d_socket->handle()))
 , d_writeBlobFactory_p(writeBlobBufferPool)
 , d_writeActiveDataCurrentBuffer(0)
 , d_writeActiveDataCurrentOffset(0)
 , d_isWriteActive(false)
 , d_writeActiveQueueSize(0)
+, d_zeroCopyThreshold(0)
+, d_zeroCopyEnabledFlag(false)
+, d_zeroCopyNextId(0)
+, d_zeroCopyBuffers(basicAllocator)
+, d_zeroCopyTimerId(0)
 , d_sharedPtrRepAllocator_p(sharedPtrAllocator)
 , d_allocator_p(basicAllocator)
 {
     BSLS_ASSERT(d_socket);
 
     d_socket->setBlockingMode(btlso::Flag::e_NONBLOCKING_MODE);
-    d_socket->peerAddress(&d_peerAddress);
+
+    if (d_isLocalFlag) {
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+        btlso::SocketImpUtil::getPeerAddress(&d_peerLocalAddress,
+                                             d_socket->handle());
+#endif
+    }
+    else {
+        d_socket->peerAddress(&d_peerAddress);
+    }
 
 #ifdef BSLS_PLATFORM_OS_UNIX
     // Set close-on-exec flag: this only makes sense in Unix, there is no
@@ -1847,16 +2876,40 @@ Channel::~Channel()
     // pertaining to this deallocated socket.
 
     BSLS_ASSERT(d_recordedMaxWriteQueueSize >= 0);
+
+    // The timer releasing the buffers of the zero-copy writes is dropped when
+    // the channel pool is stopped, but the kernel may still be reading from
+    // these buffers: wait (for a bounded time) for the completion of the
+    // writes before closing the socket and releasing the buffers.
+
+    for (int i = 0;
+         !d_zeroCopyBuffers.empty() && i < k_ZERO_COPY_DRAIN_POLLS;
+         ++i) {
+        releaseZeroCopyBuffers();
+
+        if (!d_zeroCopyBuffers.empty()) {
+            bslmt::ThreadUtil::microSleep(k_ZERO_COPY_POLL_INTERVAL * 1000);
+        }
+    }
 }
 
 // MANIPULATORS
 void Channel::disableRead(ChannelHandle self, bool enqueueStateChangeCb)
 {
-    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
-                                  bslmt::ThreadUtil::self(),
-                                  d_eventManager_p->dispatcherThreadHandle()));
     BSLS_ASSERT(this == self.get());
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated after this functor was enqueued.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(&Channel::disableRead,
+                                                       this,
+                                                       self,
+                                                       enqueueStateChangeCb));
+        return;                                                       // RETURN
+    }
+
     deregisterSocketRead(self);
 
     if (d_readTimeoutTimerId) {
@@ -1866,10 +2919,10 @@ void Channel::disableRead(ChannelHandle self, bool enqueueStateChangeCb)
     d_enableReadFlag = false;
 
     if (enqueueStateChangeCb) {
-        bsl::function<void()> stateCbFunctor(
-                        bdlf::BindUtil::bind(d_channelStateCb,
-                                             d_channelId,
-                                             d_sourceId,
+        bsl::function<void()> stateCbFunctor(bdlf::BindUtil::bind(
+                                            &Channel::invokeChannelStateCb,
+                                             this,
+                                             self,
                                              ChannelPool::e_AUTO_READ_DISABLED,
                                              d_userData));
 
@@ -1885,6 +2938,18 @@ void Channel::disableRead(ChannelHandle self, bool enqueueStateChangeCb)
 
 int Channel::initiateReadSequence(ChannelHandle self)
 {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isInDispatcherThread())) {
+        // This channel was migrated after this functor was enqueued.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_eventManager_p->execute(bdlf::BindUtil::bind(
+                                                &Channel::initiateReadSequence,
+                                                 this,
+                                                 self));
+        return 0;                                                     // RETURN
+    }
+
     if (0 != protectAndCheckCallback(self) || d_enableReadFlag) {
         // There is no point doing this twice, if 'd_enableReadFlag' is already
         // set.
@@ -1894,13 +2959,26 @@ int Channel::initiateReadSequence(ChannelHandle self)
     BSLS_ASSERT(d_channelUpFlag);
     BSLS_ASSERT(d_socket);
 
-    bsl::function<void()> readFunctor = bdlf::BindUtil::bind(&Channel::readCb,
-                                                              this,
-                                                              self);
+    int rCode = 0;
+    if (d_ioRing_p) {
+        // A ring read canceled by a previous 'disableRead' may still be
+        // pending, in which case it resubmits itself on completion.
+
+        if (!d_ringReadId) {
+            submitRingRead(self);
+        }
+    }
+    else {
+        bsl::function<void()> readFunctor = bdlf::BindUtil::bind(
+                                                              &Channel::readCb,
+                                                               this,
+                                                               self);
 
-    int rCode = d_eventManager_p->registerSocketEvent(this->socket()->handle(),
+        rCode = d_eventManager_p->registerSocketEvent(
+                                                      this->socket()->handle(),
                                                       btlso::EventType::e_READ,
                                                       readFunctor);
+    }
 
     if (0 == rCode) {
         d_enableReadFlag = true;
@@ -1964,9 +3042,12 @@ int Channel::writeMessage(const MessageType&   msg,
         if(!d_highWatermarkHitFlag) {
             d_highWatermarkHitFlag = true;
 
-            bsl::function<void()> functor(
-                bdlf::BindUtil::bind(d_channelStateCb, d_channelId, d_sourceId,
-                            ChannelPool::e_WRITE_QUEUE_HIGHWATER, d_userData));
+            bsl::function<void()> functor(bdlf::BindUtil::bind(
+                                         &Channel::invokeChannelStateCb,
+                                          this,
+                                          self,
+                                          ChannelPool::e_WRITE_QUEUE_HIGHWATER,
+                                          d_userData));
 
             d_eventManager_p->execute(functor);
 
@@ -2014,9 +3095,19 @@ int Channel::writeMessage(const MessageType&   msg,
 
         oGuard.release()->unlock();
 
-        // Let's first attempt to write the blob directly using iovec.
+        // Let's first attempt to write the blob directly using iovec, unless
+        // it is to be written with zero copy, which is done in 'writeCb' only
+        // (since the buffers of pending zero-copy writes are accessed only in
+        // the dispatcher thread).
+
+        const int zeroCopyThreshold = d_zeroCopyThreshold.loadRelaxed();
 
-        int writeRet = MessageUtil::write(this->socket(), d_ovecs, msg);
+        int writeRet = BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                           0 < zeroCopyThreshold
+                                        && zeroCopyThreshold <= dataLength)
+                       ? static_cast<int>(
+                                      btlso::SocketHandle::e_ERROR_WOULDBLOCK)
+                       : MessageUtil::write(this->socket(), d_ovecs, msg);
 
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 < writeRet)) {
             // 'd_numBytesWritten' is modified only in the 'writeCb' or
@@ -2106,16 +3197,18 @@ int Channel::writeMessage(const MessageType&   msg,
     return ChannelStatus::e_SUCCESS;
 }
 
-int Channel::setWriteQueueHighWatermark(int numBytes)
+int Channel::setWriteQueueHighWatermark(int                  numBytes,
+                                        const ChannelHandle& self)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_writeMutex);
 
-    setWriteQueueHighWatermarkRaw(numBytes);
+    setWriteQueueHighWatermarkRaw(numBytes, self);
 
     return 0;
 }
 
-void Channel::setWriteQueueHighWatermarkRaw(int numBytes)
+void Channel::setWriteQueueHighWatermarkRaw(int                  numBytes,
+                                            const ChannelHandle& self)
 {
     // Generate a 'HIGHWATER' alert if the new queue size limit is smaller than
     // the existing queue size and a 'HIGHWATER' alert has not already been
@@ -2127,8 +3220,11 @@ void Channel::setWriteQueueHighWatermarkRaw(int numBytes)
     if (!d_highWatermarkHitFlag && writeQueueSize >= numBytes) {
         d_highWatermarkHitFlag = true;
         bsl::function<void()> functor(bdlf::BindUtil::bind(
-            &d_channelStateCb, d_channelId, d_sourceId,
-                            ChannelPool::e_WRITE_QUEUE_HIGHWATER, d_userData));
+                                         &Channel::invokeChannelStateCb,
+                                          this,
+                                          self,
+                                          ChannelPool::e_WRITE_QUEUE_HIGHWATER,
+                                          d_userData));
 
         d_eventManager_p->execute(functor);
     }
@@ -2139,16 +3235,18 @@ void Channel::setWriteQueueHighWatermarkRaw(int numBytes)
     // also been issued.
 }
 
-int Channel::setWriteQueueLowWatermark(int numBytes)
+int Channel::setWriteQueueLowWatermark(int                  numBytes,
+                                       const ChannelHandle& self)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_writeMutex);
 
-    setWriteQueueLowWatermarkRaw(numBytes);
+    setWriteQueueLowWatermarkRaw(numBytes, self);
 
     return 0;
 }
 
-void Channel::setWriteQueueLowWatermarkRaw(int numBytes)
+void Channel::setWriteQueueLowWatermarkRaw(int                  numBytes,
+                                           const ChannelHandle& self)
 {
     d_writeQueueLowWater = numBytes;
 
@@ -2157,19 +3255,47 @@ void Channel::setWriteQueueLowWatermarkRaw(int numBytes)
 
         d_highWatermarkHitFlag = false;
         bsl::function<void()> functor(bdlf::BindUtil::bind(
-             &d_channelStateCb, d_channelId, d_sourceId,
-                             ChannelPool::e_WRITE_QUEUE_LOWWATER, d_userData));
+                                          &Channel::invokeChannelStateCb,
+                                           this,
+                                           self,
+                                           ChannelPool::e_WRITE_QUEUE_LOWWATER,
+                                           d_userData));
 
         d_eventManager_p->execute(functor);
     }
 }
 
-void Channel::setWriteQueueWatermarks(int lowWatermark, int highWatermark)
+void Channel::setWriteQueueWatermarks(int                  lowWatermark,
+                                      int                  highWatermark,
+                                      const ChannelHandle& self)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_writeMutex);
 
-    setWriteQueueHighWatermarkRaw(highWatermark);
-    setWriteQueueLowWatermarkRaw(lowWatermark);
+    setWriteQueueHighWatermarkRaw(highWatermark, self);
+    setWriteQueueLowWatermarkRaw(lowWatermark, self);
+}
+
+int Channel::setZeroCopyThreshold(int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+
+    if (0 < numBytes && d_ioRing_p) {
+        // Ring writes do not report zero-copy completions.
+
+        return -1;                                                    // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> oGuard(&d_writeMutex);
+
+    if (0 < numBytes && !d_zeroCopyEnabledFlag) {
+        if (0 != btlso::SocketImpUtil::enableZeroCopy(socket()->handle())) {
+            return -1;                                                // RETURN
+        }
+        d_zeroCopyEnabledFlag = true;
+    }
+
+    d_zeroCopyThreshold.storeRelaxed(numBytes);
+    return 0;
 }
 
 void Channel::resetRecordedMaxWriteQueueSize()
@@ -2203,15 +3329,22 @@ TcpTimerEventManager *ChannelPool::allocateEventManager()
     // If metrics are being collected, use those metrics to determine the
     // event manager with the lowest work-load.
 
-    if (d_collectTimeMetrics) {
+    if (!d_collectTimeMetrics && !d_rawManagers.empty()) {
+        // Channels perform their I/O through the rings of the event managers
+        // without registering socket events, so use them in turn.
+
+        result = static_cast<unsigned int>(d_nextRawManager.add(1))
+                                                                 % numManagers;
+    }
+    else if (d_collectTimeMetrics) {
         int minMetrics =
-                    d_managers[result]->timeMetrics()->percentage(e_CPU_BOUND);
+                        managerTimeMetrics(result)->percentage(e_CPU_BOUND);
 
         minMetrics += d_managers[result]->numEvents();
 
         for (int i = 1; i < numManagers; ++i) {
             int currentMetrics =
-                         d_managers[i]->timeMetrics()->percentage(e_CPU_BOUND);
+                             managerTimeMetrics(i)->percentage(e_CPU_BOUND);
 
             currentMetrics += d_managers[i]->numEvents();
 
@@ -2249,6 +3382,8 @@ void ChannelPool::init()
     bsls::AtomicOperations::initInt(&d_capacity, 0);
 
     d_metricsFunctor = bdlf::BindUtil::bind(&ChannelPool::metricsCb, this);
+    d_rebalanceFunctor = bdlf::BindUtil::bind(&ChannelPool::rebalanceCb,
+                                              this);
 
     int maxThread = d_config.maxThreads();
     BSLS_ASSERT(0 < maxThread);
@@ -2259,14 +3394,56 @@ void ChannelPool::init()
     // in).  The reason for this is that dynamic manager allocation does not
     // work very well.
 
+    typedef TcpTimerEventManager Manager;
+
+    const Manager::TriggerMode triggerMode = d_config.edgeTriggeredEvents()
+                                             ? Manager::e_EDGE_TRIGGERED
+                                             : Manager::e_LEVEL_TRIGGERED;
+
+    // If requested and supported, build the managers on 'io_uring' event
+    // managers, which are owned by this channel pool (together with their
+    // time metrics, since those of a 'TcpTimerEventManager' built on a raw
+    // event manager are not updated).
+
+    bool useIoUring = false;
+#ifdef BSLS_PLATFORM_OS_LINUX
+    useIoUring = d_config.ioUringEvents() && IoUringManager::isSupported();
+#endif
+
     for (int i = 0; i < maxThread; ++i) {
-        TcpTimerEventManager *manager =
-                new (*d_allocator_p) TcpTimerEventManager(d_collectTimeMetrics,
+        TcpTimerEventManager *manager = 0;
+
+        if (useIoUring) {
+#ifdef BSLS_PLATFORM_OS_LINUX
+            btlso::TimeMetrics *metrics = 0;
+            if (d_collectTimeMetrics) {
+                metrics = new (*d_allocator_p) btlso::TimeMetrics(
+                                      btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+                                      btlso::TimeMetrics::e_IO_BOUND,
+                                      d_allocator_p);
+                d_rawMetrics.push_back(metrics);
+            }
+
+            btlso::EventManager *rawManager =
+                      new (*d_allocator_p) IoUringManager(metrics,
+                                                          d_allocator_p);
+            d_rawManagers.push_back(rawManager);
+
+            manager = new (*d_allocator_p) TcpTimerEventManager(rawManager,
+                                                                d_allocator_p);
+#endif
+        }
+        else {
+            manager = new (*d_allocator_p) TcpTimerEventManager(
+                                                          triggerMode,
+                                                          d_collectTimeMetrics,
+                                                          false,
                                                           d_allocator_p);
+        }
 
         if (d_startFlag) {
-            bslmt::ThreadAttributes attr;
-            attr.setStackSize(d_config.threadStackSize());
+            bslmt::ThreadAttributes attr(d_allocator_p);
+            loadManagerAttributes(&attr, i);
             manager->enable(attr);
         }
         else {
@@ -2280,6 +3457,16 @@ void ChannelPool::init()
         d_metricsFunctor();
     }
 
+    // Schedule the periodic rebalancing of channels, if there is more than
+    // one event manager to balance.
+
+    if (0 < d_config.rebalanceInterval() && 1 < maxThread) {
+        d_rebalanceTimerId.makeValue(
+            d_managers[0]->registerTimer(
+                       bdlt::CurrentTime::now() + d_config.rebalanceInterval(),
+                       d_rebalanceFunctor));
+    }
+
     // One constructor initializes these factories, so only load
     // new objects into them if they are uninitialized.
 
@@ -2302,7 +3489,9 @@ void ChannelPool::init()
 
                                   // *** Server part ***
 
-void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
+bool ChannelPool::acceptConnection(
+                                  int                                 serverId,
+                                  const bsl::shared_ptr<ServerState>& server)
 {
     // Always executed in the event manager's dispatcher thread.
     BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
@@ -2310,7 +3499,7 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
                                server->d_manager_p->dispatcherThreadHandle()));
 
     if (server->d_isClosedFlag) {
-        return;                                                       // RETURN
+        return false;                                                 // RETURN
     }
 
     StreamSocket *connection;
@@ -2325,7 +3514,7 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
 
             if (server->d_isClosedFlag) {
                 d_poolStateCb(e_ERROR_ACCEPTING, serverId, e_ALERT);
-                return;                                               // RETURN
+                return false;                                         // RETURN
             }
 
             server->d_manager_p->deregisterSocketEvent(
@@ -2363,7 +3552,7 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
 
             server->d_exponentialBackoff = 0;
         }
-        return;                                                       // RETURN
+        return false;                                                 // RETURN
     }
     BSLS_ASSERT(connection);
 
@@ -2385,7 +3574,7 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
         // Too many channels, move on
 
         d_poolStateCb(e_CHANNEL_LIMIT, serverId, e_CRITICAL);
-        return;                                                       // RETURN
+        return true;                                                  // RETURN
     }
 
     TcpTimerEventManager *manager = allocateEventManager();
@@ -2410,6 +3599,7 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
                                                d_writeBlobFactory.ptr(),
                                                d_readBlobFactory.ptr(),
                                                manager,
+                                               ioRing(manager),
                                                this,
                                                &d_sharedPtrRepAllocator,
                                                d_allocator_p);
@@ -2460,6 +3650,19 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
     if (d_config.maxConnections() == numChannels) {
         d_poolStateCb(e_CHANNEL_LIMIT, 0, e_ALERT);
     }
+    return true;
+}
+
+void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
+{
+    // In edge-triggered mode the listening socket is reported only when it
+    // *becomes* ready, so accept connections until the operation would block
+    // (or fails).
+
+    const bool drainFlag = server->d_manager_p->isEdgeTriggered();
+
+    while (acceptConnection(serverId, server) && drainFlag) {
+    }
 }
 
 void ChannelPool::acceptRetryCb(int                          serverId,
@@ -2519,16 +3722,19 @@ void ChannelPool::acceptTimeoutCb(int                          serverId,
     d_poolStateCb(e_ACCEPT_TIMEOUT, serverId, e_ALERT);
 }
 
-int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
-                        int                         backlog,
-                        int                         serverId,
-                        int                         reuseAddress,
-                        bool                        readEnabledFlag,
-                        KeepHalfOpenMode            mode,
-                        bool                        isTimedFlag,
-                        const bsls::TimeInterval&   timeout,
-                        const btlso::SocketOptions *socketOptions)
+int ChannelPool::listenImp(const btlso::IPv4Address   *endpoint,
+                           const btlso::LocalAddress  *localEndpoint,
+                           int                         backlog,
+                           int                         serverId,
+                           int                         reuseAddress,
+                           bool                        readEnabledFlag,
+                           KeepHalfOpenMode            mode,
+                           bool                        isTimedFlag,
+                           const bsls::TimeInterval&   timeout,
+                           const btlso::SocketOptions *socketOptions)
 {
+    BSLS_ASSERT(!endpoint != !localEndpoint);
+
     enum {
         e_AMBIGUOUS_REUSE_ADDRESS     = -11,
         e_SET_SOCKET_OPTION_FAILED    = -10,
@@ -2567,6 +3773,7 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
 
     // The following members are initialized further below:
     //   - d_endpoint
+    //   - d_localEndpoint
     //   - d_manager_p
 
     ss->d_timeoutTimerId     = 0;
@@ -2585,7 +3792,9 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
     // particular, it will deallocate the socket, which is why it must be set
     // to 0 above in case we exit before 'ss->d_socket_p = serverSocket'.)
 
-    StreamSocket *serverSocket = d_factory.allocate();
+    StreamSocket *serverSocket = localEndpoint
+                               ? allocateLocalSocket(&d_factory)
+                               : d_factory.allocate();
     if (!serverSocket) {
         return e_ALLOCATE_FAILED;                                     // RETURN
     }
@@ -2610,16 +3819,28 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
         }
     }
 
-    if (0 != serverSocket->bind(endpoint)) {
-        return e_BIND_FAILED;                                         // RETURN
-    }
+    if (localEndpoint) {
+        // A local server owns its socket file: a stale one is replaced if
+        // 'reuseAddress' is set, and the file is removed with the server.
+
+        if (0 != bindLocalSocket(serverSocket, *localEndpoint, reuseAddress)) {
+            return e_BIND_FAILED;                                     // RETURN
+        }
 
-    if (0 != serverSocket->localAddress(&serverAddress)) {
-        return e_LOCAL_ADDRESS_FAILED;                                // RETURN
+        ss->d_localEndpoint = *localEndpoint;
     }
+    else {
+        if (0 != serverSocket->bind(*endpoint)) {
+            return e_BIND_FAILED;                                     // RETURN
+        }
+
+        if (0 != serverSocket->localAddress(&serverAddress)) {
+            return e_LOCAL_ADDRESS_FAILED;                            // RETURN
+        }
 
-    BSLS_ASSERT(serverAddress.portNumber());
-    ss->d_endpoint = serverAddress;
+        BSLS_ASSERT(serverAddress.portNumber());
+        ss->d_endpoint = serverAddress;
+    }
 
     if (0 != serverSocket->listen(backlog)) {
         return e_LISTEN_FAILED;                                       // RETURN
@@ -2831,7 +4052,9 @@ void ChannelPool::connectInitiateCb(ConnectorMap::iterator idx)
     }
 
     if (continueFlag && !cs.d_socket) {
-        StreamSocket *connectionSocket = d_factory.allocate();
+        StreamSocket *connectionSocket = cs.d_localServerAddress.isNull()
+                                       ? d_factory.allocate()
+                                       : allocateLocalSocket(&d_factory);
 
         if (connectionSocket) {
             if (0 == connectionSocket->setBlockingMode(
@@ -2891,7 +4114,10 @@ void ChannelPool::connectInitiateCb(ConnectorMap::iterator idx)
             }
         }
 
-        int retCode = socket->connect(cs.d_serverAddress);
+        int retCode = cs.d_localServerAddress.isNull()
+                      ? socket->connect(cs.d_serverAddress)
+                      : connectLocalSocket(socket,
+                                           cs.d_localServerAddress.value());
 
         if (0 == retCode && 0 == socket->connectionStatus()) {
             // Since we are already in the event manager dispatcher's thread...
@@ -3060,6 +4286,7 @@ void ChannelPool::importCb(StreamSocket                    *socket_p,
                                                d_writeBlobFactory.ptr(),
                                                d_readBlobFactory.ptr(),
                                                manager,
+                                               ioRing(manager),
                                                this,
                                                &d_sharedPtrRepAllocator,
                                                d_allocator_p);
@@ -3115,16 +4342,35 @@ void ChannelPool::timerCb(int clockId)
         // 'clockId'.
 
         ts.d_absoluteTime += ts.d_period;
-        tGuard.release()->unlock();
 
         bsl::function<void()> functor(bdlf::BindUtil::bind(
                                                          &ChannelPool::timerCb,
                                                           this,
                                                           clockId));
 
-        ts.d_eventManagerId = ts.d_eventManager_p->registerTimer(
+        ChannelHandle channelHandle;
+        if (ts.d_channelBoundFlag
+         && 0 == findChannelHandle(&channelHandle, ts.d_channelId)
+         && channelHandle->eventManager() != ts.d_eventManager_p) {
+            // The channel this clock is bound to was migrated to another event
+            // manager: move the clock along with it.  Note that the timer is
+            // registered while holding 'd_timersLock', so that
+            // 'deregisterClock' never pairs the new event manager with the
+            // timer of the previous one.
+
+            ts.d_eventManager_p = channelHandle->eventManager();
+            ts.d_eventManagerId = ts.d_eventManager_p->registerTimer(
+                                                             ts.d_absoluteTime,
+                                                             functor);
+            tGuard.release()->unlock();
+        }
+        else {
+            tGuard.release()->unlock();
+
+            ts.d_eventManagerId = ts.d_eventManager_p->registerTimer(
                                                              ts.d_absoluteTime,
                                                              functor);
+        }
     }
     else {
         // This is a one-time timer, we can deregister the 'clockId'.
@@ -3144,25 +4390,120 @@ void ChannelPool::metricsCb()
     BSLS_ASSERT(static_cast<int>(d_managers.size()) <= d_config.maxThreads());
     int numManagers = d_managers.size();
 
-    BSLS_ASSERT(0 < numManagers);
-    BSLS_ASSERT(0 < d_config.maxThreads());
+    BSLS_ASSERT(0 < numManagers);
+    BSLS_ASSERT(0 < d_config.maxThreads());
+
+    for (int i = 0; i < numManagers; ++i) {
+        s += managerTimeMetrics(i)->percentage(e_CPU_BOUND);
+        managerTimeMetrics(i)->resetAll();
+    }
+
+    double d = static_cast<double>(s) / d_config.maxThreads();
+
+    BSLS_ASSERT(0 <= d);
+    BSLS_ASSERT(100 >= d);
+
+    bsls::AtomicOperations::setInt(&d_capacity, (int)d);
+
+    d_metricsTimerId.makeValue(
+        d_managers[0]->registerTimer(
+                         bdlt::CurrentTime::now() + d_config.metricsInterval(),
+                         d_metricsFunctor));
+}
+
+                                  // *** Channel rebalancing ***
+
+int ChannelPool::migrateChannel(const ChannelHandle& channel,
+                                int                  managerIndex)
+{
+    BSLS_ASSERT(channel);
+    BSLS_ASSERT(0 <= managerIndex);
+    BSLS_ASSERT(managerIndex < static_cast<int>(d_managers.size()));
+
+    TcpTimerEventManager *manager = d_managers[managerIndex];
+    TcpTimerEventManager *current = channel->eventManager();
+
+    if (manager == current) {
+        return 1;                                                     // RETURN
+    }
+
+    // The channel is detached in the dispatcher thread of its current event
+    // manager, which then enqueues the attachment to 'manager'.  Note that, if
+    // a previous migration is still pending, 'Channel::detach' forwards itself
+    // to the event manager the channel was migrated to.
+
+    btlso::EventManager *ring = d_rawManagers.empty()
+                                ? 0
+                                : d_rawManagers[managerIndex];
+
+    bsl::function<void()> detachCommand(bdlf::BindUtil::bind(
+                                                              &Channel::detach,
+                                                               channel.get(),
+                                                               channel,
+                                                               manager,
+                                                               ring));
+    current->execute(detachCommand);
+    return 0;
+}
+
+void ChannelPool::rebalanceCb()
+{
+    rebalance();
+
+    d_rebalanceTimerId.makeValue(
+        d_managers[0]->registerTimer(
+                       bdlt::CurrentTime::now() + d_config.rebalanceInterval(),
+                       d_rebalanceFunctor));
+}
+
+// PRIVATE ACCESSORS
+btlso::EventManager *ChannelPool::ioRing(
+                                    const TcpTimerEventManager *manager) const
+{
+    const int numRawManagers = static_cast<int>(d_rawManagers.size());
+
+    for (int i = 0; i < numRawManagers; ++i) {
+        if (manager == d_managers[i]) {
+            return d_rawManagers[i];                                  // RETURN
+        }
+    }
+    return 0;
+}
+
+btlso::TimeMetrics *ChannelPool::managerTimeMetrics(int index) const
+{
+    BSLS_ASSERT(d_collectTimeMetrics);
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < static_cast<int>(d_managers.size()));
+
+    return d_rawMetrics.empty() ? d_managers[index]->timeMetrics()
+                                : d_rawMetrics[index];
+}
 
-    for (int i = 0; i < numManagers; ++i) {
-        s += d_managers[i]->timeMetrics()->percentage(e_CPU_BOUND);
-        d_managers[i]->timeMetrics()->resetAll();
-    }
+void ChannelPool::loadManagerAttributes(bslmt::ThreadAttributes *result,
+                                        int                      index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
 
-    double d = static_cast<double>(s) / d_config.maxThreads();
+    *result = d_threadAttributes;
+    result->setStackSize(d_config.threadStackSize());
+    result->setDetachedState(bslmt::ThreadAttributes::e_CREATE_JOINABLE);
 
-    BSLS_ASSERT(0 <= d);
-    BSLS_ASSERT(100 >= d);
+    if (!d_threadAttributes.threadName().empty()) {
+        char suffix[16];
+        bsl::sprintf(suffix, "-%d", index);
 
-    bsls::AtomicOperations::setInt(&d_capacity, (int)d);
+        bsl::string name(d_threadAttributes.threadName(), d_allocator_p);
+        name.append(suffix);
+        result->setThreadName(name);
+    }
 
-    d_metricsTimerId.makeValue(
-        d_managers[0]->registerTimer(
-                         bdlt::CurrentTime::now() + d_config.metricsInterval(),
-                         d_metricsFunctor));
+    const bsl::vector<int>& cpus = d_threadAttributes.cpuAffinity();
+    if (1 < cpus.size()) {
+        bsl::vector<int> cpu(1, cpus[index % cpus.size()], d_allocator_p);
+        result->setCpuAffinity(cpu);
+    }
 }
 
 // CREATORS
@@ -3173,6 +4514,9 @@ ChannelPool::ChannelPool(ChannelStateChangeCallback       channelStateCb,
                          bslma::Allocator                *basicAllocator)
 : d_channels(basicAllocator)
 , d_managers(basicAllocator)
+, d_rawManagers(basicAllocator)
+, d_rawMetrics(basicAllocator)
+, d_nextRawManager(0)
 , d_managersStateChangeLock()
 , d_connectors(bsl::less<int>(), basicAllocator)
 , d_connectorsLock()
@@ -3182,6 +4526,7 @@ ChannelPool::ChannelPool(ChannelStateChangeCallback       channelStateCb,
 , d_timersLock()
 , d_timers(basicAllocator)
 , d_config(parameters)
+, d_threadAttributes(basicAllocator)
 , d_startFlag(0)
 , d_collectTimeMetrics(parameters.collectTimeMetrics())
 , d_channelStateCb(channelStateCb)
@@ -3208,6 +4553,9 @@ ChannelPool::ChannelPool(btlb::BlobBufferFactory         *blobBufferFactory,
                          bslma::Allocator                *basicAllocator)
 : d_channels(basicAllocator)
 , d_managers(basicAllocator)
+, d_rawManagers(basicAllocator)
+, d_rawMetrics(basicAllocator)
+, d_nextRawManager(0)
 , d_connectors(bsl::less<int>(), basicAllocator)
 , d_acceptors(basicAllocator)
 , d_sharedPtrRepAllocator(basicAllocator)
@@ -3216,6 +4564,7 @@ ChannelPool::ChannelPool(btlb::BlobBufferFactory         *blobBufferFactory,
 , d_timersLock()
 , d_timers(basicAllocator)
 , d_config(parameters)
+, d_threadAttributes(basicAllocator)
 , d_startFlag(0)
 , d_collectTimeMetrics(parameters.collectTimeMetrics())
 , d_channelStateCb(channelStateCb)
@@ -3240,6 +4589,9 @@ ChannelPool::~ChannelPool()
     if (!d_metricsTimerId.isNull()) {
         d_managers[0]->deregisterTimer(d_metricsTimerId.value());
     }
+    if (!d_rebalanceTimerId.isNull()) {
+        d_managers[0]->deregisterTimer(d_rebalanceTimerId.value());
+    }
 
     // Deallocate channels.
 
@@ -3259,6 +4611,18 @@ ChannelPool::~ChannelPool()
     for (int i = 0; i < numEventManagers; ++i) {
         d_allocator_p->deleteObjectRaw(d_managers[i]);
     }
+
+    // Deallocate the raw event managers (and their time metrics) underlying
+    // the event managers, if any, now that no dispatcher thread uses them.
+
+    int numRawManagers = d_rawManagers.size();
+    for (int i = 0; i < numRawManagers; ++i) {
+        d_allocator_p->deleteObjectRaw(d_rawManagers[i]);
+    }
+    int numRawMetrics = d_rawMetrics.size();
+    for (int i = 0; i < numRawMetrics; ++i) {
+        d_allocator_p->deleteObjectRaw(d_rawMetrics[i]);
+    }
 }
 
                        // *** Server related section ***
@@ -3303,6 +4667,16 @@ int ChannelPool::close(int serverId)
 
     ss->d_manager_p->deregisterSocket(ss->d_socket_p->handle());
 
+    // The server state may outlive this call (e.g., if its socket callback is
+    // still referenced by the event manager), so remove the socket file of a
+    // local server now, and make sure the server state will not remove a file
+    // that a subsequent 'listen' on the same path creates.
+
+    if (!ss->d_localEndpoint.isEmpty()) {
+        removeLocalSocketFile(ss->d_localEndpoint);
+        ss->d_localEndpoint = btlso::LocalAddress();
+    }
+
     d_acceptors.erase(idx);
 
     return e_SUCCESS;
@@ -3320,15 +4694,16 @@ int ChannelPool::listen(int                         port,
     btlso::IPv4Address endpoint;
     endpoint.setPortNumber(port);
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        e_CLOSE_BOTH,
-                        e_IS_NOT_TIMED,
-                        bsls::TimeInterval(),
-                        socketOptions);
+    return listenImp(&endpoint,
+                     0,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     e_CLOSE_BOTH,
+                     e_IS_NOT_TIMED,
+                     bsls::TimeInterval(),
+                     socketOptions);
 }
 
 int ChannelPool::listen(int                         port,
@@ -3344,15 +4719,16 @@ int ChannelPool::listen(int                         port,
     btlso::IPv4Address endpoint;
     endpoint.setPortNumber(port);
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        e_CLOSE_BOTH,
-                        e_IS_TIMED,
-                        timeout,
-                        socketOptions);
+    return listenImp(&endpoint,
+                     0,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     e_CLOSE_BOTH,
+                     e_IS_TIMED,
+                     timeout,
+                     socketOptions);
 }
 
 int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
@@ -3364,15 +4740,16 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
 {
     enum { e_IS_NOT_TIMED = 0 };
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        e_CLOSE_BOTH,
-                        e_IS_NOT_TIMED,
-                        bsls::TimeInterval(),
-                        socketOptions);
+    return listenImp(&endpoint,
+                     0,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     e_CLOSE_BOTH,
+                     e_IS_NOT_TIMED,
+                     bsls::TimeInterval(),
+                     socketOptions);
 }
 
 int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
@@ -3386,15 +4763,65 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
 {
     enum { e_IS_TIMED = 1 };
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        mode,
-                        e_IS_TIMED,
-                        timeout,
-                        socketOptions);
+    return listenImp(&endpoint,
+                     0,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     mode,
+                     e_IS_TIMED,
+                     timeout,
+                     socketOptions);
+}
+
+int ChannelPool::listen(const btlso::LocalAddress&  endpoint,
+                        int                         backlog,
+                        int                         serverId,
+                        int                         reuseAddress,
+                        bool                        readEnabledFlag,
+                        KeepHalfOpenMode            mode,
+                        const btlso::SocketOptions *socketOptions)
+{
+    BSLS_ASSERT(!endpoint.isEmpty());
+
+    enum { e_IS_NOT_TIMED = 0 };
+
+    return listenImp(0,
+                     &endpoint,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     mode,
+                     e_IS_NOT_TIMED,
+                     bsls::TimeInterval(),
+                     socketOptions);
+}
+
+int ChannelPool::listen(const btlso::LocalAddress&  endpoint,
+                        int                         backlog,
+                        int                         serverId,
+                        const bsls::TimeInterval&   timeout,
+                        int                         reuseAddress,
+                        bool                        readEnabledFlag,
+                        KeepHalfOpenMode            mode,
+                        const btlso::SocketOptions *socketOptions)
+{
+    BSLS_ASSERT(!endpoint.isEmpty());
+
+    enum { e_IS_TIMED = 1 };
+
+    return listenImp(0,
+                     &endpoint,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     mode,
+                     e_IS_TIMED,
+                     timeout,
+                     socketOptions);
 }
 
                          // *** Client-related section
@@ -3461,6 +4888,26 @@ int ChannelPool::connect(
                       0);
 }
 
+int ChannelPool::connect(const btlso::LocalAddress&  serverAddress,
+                         int                         numAttempts,
+                         const bsls::TimeInterval&   interval,
+                         int                         sourceId,
+                         bool                        readEnabledFlag,
+                         KeepHalfOpenMode            mode,
+                         const btlso::SocketOptions *socketOptions)
+{
+    BSLS_ASSERT(0 < numAttempts);
+    BSLS_ASSERT(bsls::TimeInterval(0) < interval || 1 == numAttempts);
+
+    return connectImp(serverAddress,
+                      numAttempts,
+                      interval,
+                      sourceId,
+                      readEnabledFlag,
+                      mode,
+                      socketOptions);
+}
+
 int ChannelPool::connectImp(
                     const char                 *serverName,
                     int                         portNumber,
@@ -3605,6 +5052,58 @@ int ChannelPool::connectImp(
 
     manager->execute(connectFunctor);
 
+    return ChannelStatus::e_SUCCESS;
+}
+
+int ChannelPool::connectImp(
+                    const btlso::LocalAddress&  server,
+                    int                         numAttempts,
+                    const bsls::TimeInterval&   interval,
+                    int                         clientId,
+                    bool                        readEnabledFlag,
+                    KeepHalfOpenMode            mode,
+                    const btlso::SocketOptions *socketOptions)
+{
+    if (!d_startFlag) {
+        return e_NOT_RUNNING;                                         // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> cGuard(&d_connectorsLock);
+
+    ConnectorMap::iterator idx = d_connectors.find(clientId);
+    if (idx != d_connectors.end()) {
+        return e_DUPLICATE_ID;                                        // RETURN
+    }
+
+    TcpTimerEventManager *manager = allocateEventManager();
+    BSLS_ASSERT(manager);
+
+    // The connecting socket is opened by 'connectInitiateCb' in the local
+    // (Unix-domain) address family.
+
+    Connector connector(bsl::shared_ptr<StreamSocket>(),
+                        manager,
+                        numAttempts,
+                        interval,
+                        readEnabledFlag,
+                        mode,
+                        socketOptions);
+    connector.d_localServerAddress = server;
+
+    bsl::pair<ConnectorMap::iterator,bool> idx_status =
+                      d_connectors.insert(bsl::make_pair(clientId, connector));
+    idx = idx_status.first;
+    BSLS_ASSERT(idx_status.second);
+
+    cGuard.release()->unlock();
+
+    bsl::function<void()> connectFunctor(bdlf::BindUtil::bind(
+                                               &ChannelPool::connectInitiateCb,
+                                               this,
+                                               idx));
+
+    manager->execute(connectFunctor);
+
     return ChannelStatus::e_SUCCESS;
 }
 
@@ -3752,8 +5251,8 @@ int ChannelPool::stopAndRemoveAllChannels()
     for (int i = 0; i < numManagers; ++i) {
         if (d_managers[i]->disable()) {
            while(--i >= 0) {
-               bslmt::ThreadAttributes attr;
-               attr.setStackSize(d_config.threadStackSize());
+               bslmt::ThreadAttributes attr(d_allocator_p);
+               loadManagerAttributes(&attr, i);
 
                int rc = d_managers[i]->enable(attr);
                BSLS_ASSERT(0 == rc);
@@ -3804,7 +5303,8 @@ int ChannelPool::setWriteQueueHighWatermark(int channelId, int numBytes)
     }
     BSLS_ASSERT(channelHandle);
 
-    return channelHandle->setWriteQueueHighWatermark(numBytes);
+    return channelHandle->setWriteQueueHighWatermark(numBytes,
+                                                     channelHandle);
 }
 
 int ChannelPool::setWriteQueueLowWatermark(int channelId, int numBytes)
@@ -3817,7 +5317,7 @@ int ChannelPool::setWriteQueueLowWatermark(int channelId, int numBytes)
     }
     BSLS_ASSERT(channelHandle);
 
-    return channelHandle->setWriteQueueLowWatermark(numBytes);
+    return channelHandle->setWriteQueueLowWatermark(numBytes, channelHandle);
 }
 
 int ChannelPool::setWriteQueueWatermarks(int channelId,
@@ -3833,11 +5333,26 @@ int ChannelPool::setWriteQueueWatermarks(int channelId,
     }
     BSLS_ASSERT(channelHandle);
 
-    channelHandle->setWriteQueueWatermarks(lowWatermark, highWatermark);
+    channelHandle->setWriteQueueWatermarks(lowWatermark,
+                                           highWatermark,
+                                           channelHandle);
 
     return 0;
 }
 
+int ChannelPool::setZeroCopyThreshold(int channelId, int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+
+    ChannelHandle channelHandle;
+    if (0 != findChannelHandle(&channelHandle, channelId)) {
+        return -1;                                                    // RETURN
+    }
+    BSLS_ASSERT(channelHandle);
+
+    return 0 == channelHandle->setZeroCopyThreshold(numBytes) ? 0 : -2;
+}
+
 int ChannelPool::resetRecordedMaxWriteQueueSize(int channelId)
 {
     ChannelHandle channelHandle;
@@ -3851,6 +5366,160 @@ int ChannelPool::resetRecordedMaxWriteQueueSize(int channelId)
     return 0;
 }
 
+int ChannelPool::pinChannel(int channelId, int managerIndex)
+{
+    enum {
+        e_NOT_FOUND     = -1,
+        e_INVALID_INDEX = -2
+    };
+
+    if (managerIndex < 0
+     || managerIndex >= static_cast<int>(d_managers.size())) {
+        return e_INVALID_INDEX;                                       // RETURN
+    }
+
+    ChannelHandle channelHandle;
+    if (0 != findChannelHandle(&channelHandle, channelId)) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+    BSLS_ASSERT(channelHandle);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceLock);
+
+    channelHandle->d_pinnedFlag = true;
+    migrateChannel(channelHandle, managerIndex);
+
+    return 0;
+}
+
+int ChannelPool::unpinChannel(int channelId)
+{
+    ChannelHandle channelHandle;
+    if (0 != findChannelHandle(&channelHandle, channelId)) {
+        return -1;                                                    // RETURN
+    }
+    BSLS_ASSERT(channelHandle);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceLock);
+
+    channelHandle->d_pinnedFlag = false;
+
+    return 0;
+}
+
+int ChannelPool::rebalance()
+{
+    typedef bsl::pair<bsls::Types::Int64, ChannelHandle> ChannelLoad;
+        // load of a channel since the previous rebalancing, and the channel
+
+    const int numManagers = static_cast<int>(d_managers.size());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceLock);
+
+    // Compute the load of each event manager as the number of bytes read and
+    // written by its channels since the previous rebalancing, and collect the
+    // channels that may be migrated.  Note that all channels must be visited
+    // (even if there is a single event manager) to reset their loads.
+
+    bsl::vector<bsls::Types::Int64> loads(numManagers, 0, d_allocator_p);
+    bsl::vector<bsl::vector<ChannelLoad> > candidates(numManagers,
+                                                      d_allocator_p);
+
+    for (bdlcc::ObjectCatalogIter<ChannelHandle> iter(d_channels);
+         iter;
+         ++iter) {
+        const ChannelHandle& channelHandle = iter().second;
+        if (!channelHandle) {
+            continue;
+        }
+
+        Channel *channel = channelHandle.get();
+
+        const bsls::Types::Int64 numBytes = channel->numBytesRead()
+                                          + channel->numBytesWritten();
+        const bsls::Types::Int64 load = numBytes
+                                      - channel->d_numBytesAtRebalance;
+        channel->d_numBytesAtRebalance = numBytes;
+
+        TcpTimerEventManager *manager = channel->eventManager();
+        int                   index   = 0;
+        while (index < numManagers && d_managers[index] != manager) {
+            ++index;
+        }
+        BSLS_ASSERT(index < numManagers);
+
+        loads[index] += load;
+
+        if (!channel->d_pinnedFlag
+         && channel->d_channelUpFlag
+         && !channel->isChannelDown(e_CLOSED_RECEIVE_MASK)
+         && !channel->isChannelDown(e_CLOSED_SEND_MASK)
+         && 0 < load) {
+            candidates[index].push_back(ChannelLoad(load, channelHandle));
+        }
+    }
+
+    // Repeatedly move, from the most loaded to the least loaded event
+    // manager, the channel whose load is closest to half of the difference
+    // between their loads, which reduces that difference the most.
+
+    int numMigrated = 0;
+    while (numMigrated < k_MAX_MIGRATIONS) {
+        int maxIndex = 0;
+        int minIndex = 0;
+        for (int i = 1; i < numManagers; ++i) {
+            if (loads[i] > loads[maxIndex]) {
+                maxIndex = i;
+            }
+            if (loads[i] < loads[minIndex]) {
+                minIndex = i;
+            }
+        }
+
+        const bsls::Types::Int64 imbalance = loads[maxIndex]
+                                           - loads[minIndex];
+
+        if (imbalance < k_MIN_IMBALANCE || imbalance < loads[maxIndex] / 4) {
+            break;
+        }
+
+        bsl::vector<ChannelLoad>& channels = candidates[maxIndex];
+
+        int                bestIndex = -1;
+        bsls::Types::Int64 bestGain  = 0;
+        for (int i = 0; i < static_cast<int>(channels.size()); ++i) {
+            // Moving a channel of load 'r' changes the difference between
+            // the two event managers to '|imbalance - 2 * r|'.
+
+            const bsls::Types::Int64 load = channels[i].first;
+            const bsls::Types::Int64 gain = bsl::min(load, imbalance - load);
+
+            if (gain > bestGain) {
+                bestGain  = gain;
+                bestIndex = i;
+            }
+        }
+
+        if (0 > bestIndex) {
+            break;
+        }
+
+        const bsls::Types::Int64 load = channels[bestIndex].first;
+
+        if (0 == migrateChannel(channels[bestIndex].second, minIndex)) {
+            ++numMigrated;
+        }
+
+        loads[maxIndex] -= load;
+        loads[minIndex] += load;
+
+        channels[bestIndex] = channels.back();
+        channels.pop_back();
+    }
+
+    return numMigrated;
+}
+
                          // *** Thread management ***
 
 int ChannelPool::start()
@@ -3859,8 +5528,8 @@ int ChannelPool::start()
 
     int numManagers = d_managers.size();
     for (int i = 0; i < numManagers; ++i) {
-        bslmt::ThreadAttributes attr;
-        attr.setStackSize(d_config.threadStackSize());
+        bslmt::ThreadAttributes attr(d_allocator_p);
+        loadManagerAttributes(&attr, i);
         int ret = d_managers[i]->enable(attr);
         if (0 != ret) {
            while(--i >= 0) {
@@ -3882,8 +5551,8 @@ int ChannelPool::stop()
     for (int i = 0; i < numManagers; ++i) {
         if (d_managers[i]->disable()) {
            while(--i >= 0) {
-               bslmt::ThreadAttributes attr;
-               attr.setStackSize(d_config.threadStackSize());
+               bslmt::ThreadAttributes attr(d_allocator_p);
+               loadManagerAttributes(&attr, i);
                int rc = d_managers[i]->enable(attr);
                BSLS_ASSERT(0 == rc);
            }
@@ -3894,6 +5563,14 @@ int ChannelPool::stop()
     return 0;
 }
 
+void ChannelPool::setThreadAttributes(
+                                    const bslmt::ThreadAttributes& attributes)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_managersStateChangeLock);
+
+    d_threadAttributes = attributes;
+}
+
                          // *** Outgoing messages ***
 
 void ChannelPool::setChannelContext(int channelId, void *context)
@@ -3987,10 +5664,12 @@ int ChannelPool::registerClock(const bsl::function<void()>& command,
     BSLS_ASSERT(manager);
 
     TimerState ts;
-    ts.d_absoluteTime   = startTime;
-    ts.d_period         = period;
-    ts.d_eventManager_p = manager;
-    ts.d_callback       = command;
+    ts.d_absoluteTime     = startTime;
+    ts.d_period           = period;
+    ts.d_eventManager_p   = manager;
+    ts.d_callback         = command;
+    ts.d_channelBoundFlag = false;
+    ts.d_channelId        = 0;
 
     bsl::function<void()> functor(bdlf::BindUtil::bind(&ChannelPool::timerCb,
                                                         this,
@@ -4029,10 +5708,12 @@ int ChannelPool::registerClock(const bsl::function<void()>& command,
 
     TcpTimerEventManager *manager = channelHandle->eventManager();
     TimerState            ts;
-    ts.d_absoluteTime   = startTime;
-    ts.d_period         = period;
-    ts.d_eventManager_p = manager;
-    ts.d_callback       = command;
+    ts.d_absoluteTime     = startTime;
+    ts.d_period           = period;
+    ts.d_eventManager_p   = manager;
+    ts.d_callback         = command;
+    ts.d_channelBoundFlag = true;
+    ts.d_channelId        = channelId;
 
     bsl::function<void()> functor(bdlf::BindUtil::bind(&ChannelPool::timerCb,
                                                         this,
@@ -4279,6 +5960,29 @@ void *ChannelPool::channelContext(int channelId) const
     return 0;
 }
 
+int ChannelPool::eventManagerIndex(int *result, int channelId) const
+{
+    BSLS_ASSERT(result);
+
+    ChannelHandle channelHandle;
+    if (0 != findChannelHandle(&channelHandle, channelId)) {
+        return -1;                                                    // RETURN
+    }
+
+    const TcpTimerEventManager *manager = channelHandle->eventManager();
+    const int numManagers = static_cast<int>(d_managers.size());
+
+    for (int i = 0; i < numManagers; ++i) {
+        if (d_managers[i] == manager) {
+            *result = i;
+            return 0;                                                 // RETURN
+        }
+    }
+
+    BSLS_ASSERT(0 && "Channel is not associated with an event manager");
+    return -1;
+}
+
 bsl::shared_ptr<const btlso::StreamSocket<btlso::IPv4Address> >
 ChannelPool::streamSocket(int channelId) const
 {
@@ -4431,6 +6135,23 @@ ChannelPool::getServerAddress(btlso::IPv4Address *result,
     return 0;
 }
 
+int
+ChannelPool::getServerAddress(btlso::LocalAddress *result,
+                              int                  serverId) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::LockGuard<bslmt::Mutex> aGuard(&d_acceptorsLock);
+
+    ServerStateMap::const_iterator idx = d_acceptors.find(serverId);
+    if (idx == d_acceptors.end()) {
+        return -1;                                                    // RETURN
+    }
+
+    *result = idx->second->d_localEndpoint;
+    return 0;
+}
+
 int
 ChannelPool::getLocalAddress(btlso::IPv4Address *result,
                              int                 channelId) const
@@ -4438,13 +6159,35 @@ ChannelPool::getLocalAddress(btlso::IPv4Address *result,
     BSLS_ASSERT(result);
 
     ChannelHandle channelHandle;
-    if (0 != findChannelHandle(&channelHandle, channelId)) {
+    if (0 != findChannelHandle(&channelHandle, channelId)
+     || channelHandle->isLocal()) {
         return -1;                                                    // RETURN
     }
 
     return channelHandle->socket()->localAddress(result);
 }
 
+int
+ChannelPool::getLocalAddress(btlso::LocalAddress *result,
+                             int                  channelId) const
+{
+    BSLS_ASSERT(result);
+
+    ChannelHandle channelHandle;
+    if (0 != findChannelHandle(&channelHandle, channelId)
+     || !channelHandle->isLocal()) {
+        return -1;                                                    // RETURN
+    }
+
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    return btlso::SocketImpUtil::getLocalAddress(
+                                            result,
+                                            channelHandle->socket()->handle());
+#else
+    return -1;
+#endif
+}
+
 int
 ChannelPool::getPeerAddress(btlso::IPv4Address *result,
                             int                 channelId) const
@@ -4452,13 +6195,29 @@ ChannelPool::getPeerAddress(btlso::IPv4Address *result,
     BSLS_ASSERT(result);
 
     ChannelHandle channelHandle;
-    if (0 == findChannelHandle(&channelHandle, channelId)) {
+    if (0 == findChannelHandle(&channelHandle, channelId)
+     && !channelHandle->isLocal()) {
         *result = channelHandle->peerAddress();
         return 0;                                                     // RETURN
     }
     return 1;
 }
 
+int
+ChannelPool::getPeerAddress(btlso::LocalAddress *result,
+                            int                  channelId) const
+{
+    BSLS_ASSERT(result);
+
+    ChannelHandle channelHandle;
+    if (0 == findChannelHandle(&channelHandle, channelId)
+     && channelHandle->isLocal()) {
+        *result = channelHandle->peerLocalAddress();
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
 int ChannelPool::numBytesRead(bsls::Types::Int64 *result,
                               int                 channelId) const
 {
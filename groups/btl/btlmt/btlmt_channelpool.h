@@ -72,6 +72,26 @@ BSLS_IDENT("$Id: $")
 // to only two outcomes -- success or failure.  In particular, it can't be
 // canceled.
 //
+///Local (Unix-Domain) Connections
+///-------------------------------
+// On platforms providing BSD sockets, a channel pool can also listen on, and
+// connect to, local ('AF_UNIX') stream sockets named by a filesystem path, by
+// passing a 'btlso::LocalAddress' instead of a 'btlso::IPv4Address' to
+// 'listen' or 'connect'.  Local connections avoid the TCP/IP stack entirely,
+// which benefits co-located processes; once established, channels over local
+// sockets behave exactly as TCP channels do.  A local server creates its
+// socket file when it starts listening, replacing a stale socket file left by
+// a server that is no longer running (i.e., to which connections are refused)
+// if 'reuseAddress' is set, and removes the file when it is closed.  Listening
+// on the path of a running server fails, whether 'reuseAddress' is set or
+// not.  A connection attempt to a local server whose backlog is full fails
+// immediately (instead of remaining in progress), and is retried at the next
+// interval.  Since local endpoints have no IP address, the 'getLocalAddress'
+// and 'getPeerAddress' overloads taking a 'btlso::IPv4Address' fail for local
+// channels: the paths of the end-points of a local channel, and of a local
+// server, are reported by the overloads of 'getLocalAddress',
+// 'getPeerAddress', and 'getServerAddress' taking a 'btlso::LocalAddress'.
+//
 ///Half-Open Connections
 ///---------------------
 // It is already possible to import a half-duplex connection into a channel
@@ -172,6 +192,115 @@ BSLS_IDENT("$Id: $")
 //            T
 //..
 //
+///Socket Event Managers
+///---------------------
+// By default, each event manager of a channel pool monitors its sockets with
+// the default mechanism of the platform (e.g., 'epoll' on Linux).  If the
+// 'ioUringEvents' attribute of the configuration is 'true' and the kernel
+// supports 'io_uring' (see 'btlso_defaulteventmanager_iouring'), the event
+// managers use 'io_uring' instead, and channels do not wait for socket events
+// at all: each channel keeps a read request, and a write request whenever it
+// has data to send, submitted to the ring of its event manager, which reads
+// into (or writes from) the channel buffers and reports the completion.  Such
+// requests are queued without a system call and submitted in the same system
+// call that waits for completions, so that a busy event manager performs its
+// I/O with a single system call per iteration.  Otherwise, the default
+// mechanism is used (edge-triggered if the 'edgeTriggeredEvents' attribute is
+// 'true').  Note that 'io_uring' event managers take precedence over
+// 'edgeTriggeredEvents'.
+//
+// Ring reads and writes are made on the handle of the socket underlying a
+// channel, bypassing its 'btlso::StreamSocket' (as zero-copy writes do, see
+// {Zero-Copy Writes}), and thus 'ioUringEvents' must not be set for a channel
+// pool importing sockets that transform the data they read or write.  Also
+// note that zero-copy writes are not available for channels using ring
+// writes.  Writes made directly in the thread calling 'write' (when the write
+// queue of a channel is empty) are unchanged.
+//
+///Channel Rebalancing
+///-------------------
+// A channel is associated with one of the event managers of the channel pool
+// when it is created (see {Metrics and Capacity}), and all of its callbacks
+// are invoked in the dispatcher thread of that event manager.  Since the load
+// of a channel can change over its lifetime, this association may become
+// unbalanced, e.g., when a few busy channels end up sharing the same event
+// manager.  A channel pool can therefore *migrate* channels between its event
+// managers:
+//
+//: o If the 'rebalanceInterval' attribute of the configuration is positive,
+//:   the channel pool periodically measures the number of bytes read and
+//:   written by each channel during the last interval, and moves the busiest
+//:   channels that fit from the most loaded event manager to the least loaded
+//:   one, as long as doing so reduces the imbalance significantly.  The
+//:   'rebalance' manipulator performs a single such round on demand.
+//:
+//: o The 'pinChannel' manipulator moves a channel to a specific event manager
+//:   and excludes it from rebalancing until 'unpinChannel' is called, e.g., to
+//:   isolate a latency-sensitive channel or to group related channels in a
+//:   single thread.
+//
+// A migration is performed asynchronously: the channel is detached from its
+// current event manager in the dispatcher thread of that manager, and then
+// attached to the new event manager in its dispatcher thread.  The callbacks
+// of a channel are never invoked concurrently, and their relative order is
+// preserved, but the thread invoking them changes after a migration.  Note
+// that a periodic clock registered for a channel (see 'registerClock') follows
+// the channel to its new event manager.
+//
+///Zero-Copy Writes
+///----------------
+// A message written to a channel is not copied by the channel pool (the
+// buffers of a 'btlb::Blob' are shared with the write queue of the channel),
+// but it is still copied by the kernel into its own socket buffers.  For
+// large messages (e.g., snapshots of hundreds of kilobytes or more), this copy
+// may be avoided on platforms supporting zero-copy transmission (see
+// {'btlso_socketimputil'|Zero-Copy Writes}) by calling 'setZeroCopyThreshold'
+// for a channel: thereafter, whenever at least the specified number of bytes
+// are written to the socket at once, the kernel sends them directly from the
+// blob buffers, and the channel holds a reference to these buffers until the
+// kernel reports that it no longer uses them.  Smaller writes keep using the
+// regular path, for which copying is cheaper than the bookkeeping.
+//
+// The following restrictions apply to zero-copy writes:
+//
+//: o The blob buffers of a message must not be modified after the message is
+//:   written, until they are released by the channel (and returned to their
+//:   factory).
+//:
+//: o Zero-copy writes are made on the handle of the socket underlying the
+//:   channel, bypassing its 'btlso::StreamSocket', and thus must not be
+//:   enabled for an imported socket that transforms the data it writes.
+//:
+//: o The kernel reports completions as error events on the socket, which are
+//:   processed when reading from or writing to the channel, and polled
+//:   periodically otherwise: the buffers of a message may thus be released
+//:   a few milliseconds after the write completes.  A channel that goes down
+//:   keeps its socket open until its pending zero-copy writes complete, and
+//:   stopping the channel pool waits (for a bounded time) for them.
+//
+///Worker Thread Attributes
+///------------------------
+// By default, the worker threads of a channel pool (i.e., the dispatcher
+// threads of its event managers) are created with the default
+// 'bslmt::ThreadAttributes', except for their stack size, which is taken from
+// the 'threadStackSize' attribute of the configuration.  The
+// 'setThreadAttributes' manipulator specifies other attributes, e.g., the
+// scheduling priority, the processor affinity, the NUMA node, or the name of
+// the worker threads, which take effect the next time the pool is started.
+// The attributes are adapted for each worker thread as follows:
+//
+//: o The 'stackSize' is always taken from the configuration, and the threads
+//:   are always created joinable.
+//:
+//: o If a 'threadName' is specified, the index of the worker thread is
+//:   appended to it, so that the worker threads can be told apart in a
+//:   debugger.
+//:
+//: o If the 'cpuAffinity' specifies more than one processor, each worker
+//:   thread is pinned to a single one of these processors, chosen in
+//:   round-robin order by the index of the worker thread; otherwise, every
+//:   worker thread has the specified 'cpuAffinity'.
+//
 ///Thread Safety
 ///-------------
 // The channel pool is *thread-enabled* meaning that any operation on the same
@@ -574,6 +703,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_inetstreamsocketfactory.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#include <btlso_localaddress.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_SOCKETHANDLE
 #include <btlso_sockethandle.h>
 #endif
@@ -598,6 +731,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_mutex.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_THREADATTRIBUTES
+#include <bslmt_threadattributes.h>
+#endif
+
 #ifndef INCLUDED_bslmt_THREADUTIL
 #include <bslmt_threadutil.h>
 #endif
@@ -660,8 +797,10 @@ namespace BloombergLP {
 
 namespace btlso {
 
+class EventManager;
 class IPv4Address;
 class SocketOptions;
+class TimeMetrics;
 
 }
 
@@ -700,6 +839,14 @@ struct TimerState {
 
     bsl::function<void()>       d_callback;       // callback function to
                                                   // invoke
+
+    bool                        d_channelBoundFlag;
+                                                  // 'true' if the clock is
+                                                  // bound to a channel
+
+    int                         d_channelId;      // channel the clock is bound
+                                                  // to (if any), whose event
+                                                  // manager the clock follows
 };
 
                        //==================
@@ -911,6 +1058,23 @@ class ChannelPool {
 
     bsl::vector<TcpTimerEventManager *> d_managers;
 
+    bsl::vector<btlso::EventManager *>  d_rawManagers;
+                                                    // 'io_uring' socket event
+                                                    // managers underlying
+                                                    // 'd_managers', if used
+                                                    // (owned)
+
+    bsl::vector<btlso::TimeMetrics *>   d_rawMetrics;
+                                                    // time metrics of
+                                                    // 'd_rawManagers', if
+                                                    // collected (owned)
+
+    bsls::AtomicInt                     d_nextRawManager;
+                                                    // index of the next event
+                                                    // manager allocated in
+                                                    // turn, if using
+                                                    // 'd_rawManagers'
+
     mutable bslmt::Mutex                d_managersStateChangeLock;
                                                     // mutex to synchronize
                                                     // changing the state of
@@ -940,6 +1104,11 @@ class ChannelPool {
 
     ChannelPoolConfiguration            d_config;
 
+    bslmt::ThreadAttributes             d_threadAttributes;
+                                               // attributes of the worker
+                                               // threads (guarded by
+                                               // 'd_managersStateChangeLock')
+
     bsls::AtomicOperations::AtomicTypes::Int
                                         d_capacity;
 
@@ -955,6 +1124,19 @@ class ChannelPool {
 
     bsl::function<void()>               d_metricsFunctor;
 
+                                        // *** Channel rebalancing ***
+
+    bslmt::Mutex                        d_rebalanceLock;
+                                               // serializes rebalancing and
+                                               // pinning of channels
+
+    bdlb::NullableValue<void *>         d_rebalanceTimerId;
+                                               // periodic rebalancing timer
+                                               // (registered with the first
+                                               // event manager)
+
+    bsl::function<void()>               d_rebalanceFunctor;
+
     ChannelStateChangeCallback          d_channelStateCb;
 
     PoolStateChangeCallback             d_poolStateCb;
@@ -1014,7 +1196,10 @@ class ChannelPool {
         // From the set of current event managers, find the most idle one
         // (i.e., having the minimal percent CPU busy) and return its address.
         // Return the address of event manager on success, and 0 otherwise, in
-        // which case 'status' will be loaded with a non-zero value.
+        // which case 'status' will be loaded with a non-zero value.  Note
+        // that, since channels register no socket events with 'io_uring'
+        // event managers, those are allocated in turn unless time metrics are
+        // collected.
         //
         // LOCKING: This function doesn't lock any synchronization primitives.
 
@@ -1022,13 +1207,24 @@ class ChannelPool {
         // Initialize this channel pool.
 
                                   // *** Server part ***
+    bool acceptConnection(int serverId, const ServerHandle& server);
+        // Accept a pending connection on the listening socket of the server
+        // having the specified 'serverId' and state 'server', and add a newly
+        // allocated channel for it to the set of channels managed by this
+        // channel pool (or drop the connection if the channel limit is
+        // reached).  Return 'true' if a connection was accepted, and 'false'
+        // if the server is closed or no connection could be accepted (e.g.,
+        // the operation would block).
+
     void acceptCb(int serverId, ServerHandle server);
         // Add a newly allocated channel to the set of channels managed by this
         // channel pool and invoke the channel pool callback.  Note that this
         // method is executed whenever a connection is accepted on the
         // listening socket corresponding to the server whose ID is
         // 'it->first'.  All other information (e.g., listening socket and
-        // event manager) is held in the server state 'it->second'.
+        // event manager) is held in the server state 'it->second'.  If the
+        // event manager is edge-triggered, accept connections until the
+        // operation would block.
 
     void acceptRetryCb(int serverId, ServerHandle server);
         // Re-register listening socket for the server whose ID is 'serverId'
@@ -1047,32 +1243,36 @@ class ChannelPool {
         // server state since the last server connection or last timeout
         // callback.
 
-    int listen(const btlso::IPv4Address&   endpoint,
-               int                         backlog,
-               int                         serverId,
-               int                         reuseAddress,
-               bool                        readEnabledFlag,
-               KeepHalfOpenMode            mode,
-               bool                        isTimedFlag,
-               const bsls::TimeInterval&   timeout = bsls::TimeInterval(),
-               const btlso::SocketOptions *socketOptions = 0);
+    int listenImp(const btlso::IPv4Address   *endpoint,
+                  const btlso::LocalAddress  *localEndpoint,
+                  int                         backlog,
+                  int                         serverId,
+                  int                         reuseAddress,
+                  bool                        readEnabledFlag,
+                  KeepHalfOpenMode            mode,
+                  bool                        isTimedFlag,
+                  const bsls::TimeInterval&   timeout = bsls::TimeInterval(),
+                  const btlso::SocketOptions *socketOptions = 0);
         // Establish a listening socket having the specified 'backlog' maximum
-        // number of pending connections on the specified 'endpoint' and the
-        // specified 'reuseAddress' used in setting 'e_REUSEADDRESS' socket
-        // option, and associate this newly established socket with the
-        // specified 'serverId'.  If the specified 'readEnabledFlag' is
-        // non-zero, any channel created by 'acceptCb' will be enabled for read
-        // upon creation, and otherwise it will not.  If the specified
-        // 'isTimedFlag' is non-zero, register a timer which will execute
-        // 'acceptTimeoutCb' in the dispatcher thread of the event manager for
-        // this server, if no connection attempt is received for the optionally
-        // specified 'timeout' period since the last connection or the last
-        // timeout.  Optionally specify 'socketOptions' that will be used to
-        // specify what options should be set on the listening socket.  Return
-        // 0 on success, a positive value if there is a listening socket
-        // associated with 'serverId' (i.e., 'serverId' is not unique) and a
-        // negative value if an error occurred.  The behavior is undefined
-        // unless '0 < backlog'.
+        // number of pending connections on the specified TCP 'endpoint' or on
+        // the specified local (Unix-domain) 'localEndpoint', whichever is not
+        // 0, and the specified 'reuseAddress' used in setting
+        // 'e_REUSEADDRESS' socket option (and, for a local endpoint, to
+        // replace a stale socket file), and associate this newly established
+        // socket with the specified 'serverId'.  If the specified
+        // 'readEnabledFlag' is non-zero, any channel created by 'acceptCb'
+        // will be enabled for read upon creation, and otherwise it will not.
+        // If the specified 'isTimedFlag' is non-zero, register a timer which
+        // will execute 'acceptTimeoutCb' in the dispatcher thread of the event
+        // manager for this server, if no connection attempt is received for
+        // the optionally specified 'timeout' period since the last connection
+        // or the last timeout.  Optionally specify 'socketOptions' that will
+        // be used to specify what options should be set on the listening
+        // socket.  Return 0 on success, a positive value if there is a
+        // listening socket associated with 'serverId' (i.e., 'serverId' is not
+        // unique) and a negative value if an error occurred.  The behavior is
+        // undefined unless '0 < backlog' and exactly one of 'endpoint' and
+        // 'localEndpoint' is not 0.
 
                                   // *** Client part ***
 
@@ -1202,6 +1402,20 @@ class ChannelPool {
         // '0 < numAttempts', '0 < interval || 1 == numAttempts', and
         // '0 == socketOptions || (0 == socket && 0 == localAddress)'
 
+    int connectImp(const btlso::LocalAddress&  serverAddress,
+                   int                         numAttempts,
+                   const bsls::TimeInterval&   interval,
+                   int                         sourceId,
+                   bool                        readEnabledFlag,
+                   KeepHalfOpenMode            mode,
+                   const btlso::SocketOptions *socketOptions);
+        // Asynchronously issue up to the specified 'numAttempts' connection
+        // requests to a local (Unix-domain) server at the specified
+        // 'serverAddress', as described for the 'connectImp' overload taking
+        // a 'btlso::IPv4Address', except that the connecting socket is always
+        // opened by this pool (with the specified 'socketOptions', if not 0)
+        // and is not bound to a source address.
+
                                   // *** Channel management part ***
     void importCb(btlso::StreamSocket<btlso::IPv4Address> *socket,
                   const bslma::ManagedPtrDeleter&          deleter,
@@ -1233,7 +1447,40 @@ class ChannelPool {
     void metricsCb();
         // Update metrics for each event manager.
 
+                                  // *** Channel rebalancing ***
+    int migrateChannel(const ChannelHandle& channel, int managerIndex);
+        // Initiate the migration of the specified 'channel' to the event
+        // manager having the specified 'managerIndex'.  Return 0 if a
+        // migration was initiated, and a non-zero value if 'channel' is
+        // already associated with that event manager.  The behavior is
+        // undefined unless 'd_rebalanceLock' is locked by the calling thread
+        // and '0 <= managerIndex < d_managers.size()'.
+
+    void rebalanceCb();
+        // Rebalance the channels of this channel pool and re-register this
+        // callback to be invoked after the configured rebalance interval.
+
     // PRIVATE ACCESSORS
+    btlso::EventManager *ioRing(const TcpTimerEventManager *manager) const;
+        // Return the address of the 'io_uring' event manager on which the
+        // specified 'manager' is built, or 0 if this channel pool does not
+        // use 'io_uring' event managers.  The behavior is undefined unless
+        // 'manager' is one of the event managers of this channel pool.
+
+    btlso::TimeMetrics *managerTimeMetrics(int index) const;
+        // Return the address of the time metrics of the event manager having
+        // the specified 'index'.  The behavior is undefined unless time
+        // metrics are collected and '0 <= index < d_managers.size()'.
+
+    void loadManagerAttributes(bslmt::ThreadAttributes *result,
+                               int                      index) const;
+        // Load into the specified 'result' the attributes of the dispatcher
+        // thread of the event manager having the specified 'index', as
+        // described in the {Worker Thread Attributes} section in the
+        // component-level documentation.  The behavior is undefined unless
+        // 'd_managersStateChangeLock' is locked by the calling thread, or
+        // this method is called during construction.
+
     int findChannelHandle(ChannelHandle *handle, int channelId) const;
         // Load into 'handle' a shared-pointer to the channel associated with
         // the specified 'channelId'.  Return 0 on success, or a non-zero value
@@ -1355,6 +1602,42 @@ class ChannelPool {
         // provided in the configuration at construction.  The behavior is
         // undefined unless '0 < backlog'.
 
+    int listen(const btlso::LocalAddress&  endpoint,
+               int                         backlog,
+               int                         serverId,
+               int                         reuseAddress = 1,
+               bool                        readEnabledFlag = true,
+               KeepHalfOpenMode            mode = e_CLOSE_BOTH,
+               const btlso::SocketOptions *socketOptions = 0);
+    int listen(const btlso::LocalAddress&  endpoint,
+               int                         backlog,
+               int                         serverId,
+               const bsls::TimeInterval&   timeout,
+               int                         reuseAddress = 1,
+               bool                        readEnabledFlag = true,
+               KeepHalfOpenMode            mode = e_CLOSE_BOTH,
+               const btlso::SocketOptions *socketOptions = 0);
+        // Establish a listening local (Unix-domain) socket having the
+        // specified 'backlog' maximum number of pending connections on the
+        // filesystem path of the specified 'endpoint', and associate this
+        // newly established socket with the specified 'serverId'.  Optionally
+        // specify a 'timeout' *duration* for accepting a connection, as for
+        // TCP servers.  Optionally specify a 'reuseAddress' value; if
+        // 'reuseAddress' is non-zero or not specified, a socket file left at
+        // the path of 'endpoint' by a server that is no longer running (i.e.,
+        // to which connections are refused) is replaced, and otherwise
+        // 'listen' fails if the path exists.
+        // Optionally specify via a 'readEnabledFlag' whether automatic reading
+        // should be enabled on accepted channels immediately after creation,
+        // a half-close 'mode', and 'socketOptions' to set on the listening
+        // socket, with the same defaults as for TCP servers.  Return 0 on
+        // success, a positive value if there is a listening socket associated
+        // with 'serverId', and a negative value if an error occurred
+        // (including if local sockets are not supported on this platform).
+        // The socket file is removed when the server is closed.  The behavior
+        // is undefined unless '0 < backlog' and 'endpoint' is not empty.  See
+        // {Local (Unix-Domain) Connections}.
+
                                   // *** Client part ***
 
     int connect(const char                 *hostname,
@@ -1484,6 +1767,32 @@ class ChannelPool {
         // can be used in several calls to 'connect' or 'import' as long as two
         // calls to connect with the same 'sourceId' do not overlap.
 
+    int connect(const btlso::LocalAddress&  serverAddress,
+                int                         numAttempts,
+                const bsls::TimeInterval&   interval,
+                int                         sourceId,
+                bool                        readEnabledFlag = true,
+                KeepHalfOpenMode            mode = e_CLOSE_BOTH,
+                const btlso::SocketOptions *socketOptions = 0);
+        // Asynchronously issue up to the specified 'numAttempts' connection
+        // requests to the local (Unix-domain) server listening on the path of
+        // the specified 'serverAddress', with at least the specified
+        // (relative) time 'interval' after each attempt, and invoke the
+        // channel state and pool state callbacks with the specified
+        // 'sourceId', exactly as for the 'connect' overload taking a
+        // 'btlso::IPv4Address'.  Optionally specify via a 'readEnabledFlag'
+        // whether automatic reading should be enabled on the channel, a
+        // half-close 'mode', and 'socketOptions' to set on the connecting
+        // socket, with the same defaults as for TCP connections.  Return 0 on
+        // successful initiation, a positive value if there is an active
+        // connection attempt with the same 'sourceId', or a negative value if
+        // an error occurred, with the value of -1 indicating that the channel
+        // pool is not running.  The behavior is undefined unless
+        // '0 < numAttempts', and either '0 < interval' or '1 == numAttempts'
+        // or both.  Note that, if local sockets are not supported on this
+        // platform, each attempt fails with 'e_ERROR_CONNECTING'.  See
+        // {Local (Unix-Domain) Connections}.
+
                                   // *** Channel management ***
 
     int disableRead(int channelId);
@@ -1635,6 +1944,18 @@ class ChannelPool {
         // configured (for all channels) by the 'ChannelPoolConfiguration'
         // supplied at construction.
 
+    int setZeroCopyThreshold(int channelId, int numBytes);
+        // Write the data of the channel having the specified 'channelId'
+        // without copying it whenever at least the specified 'numBytes' bytes
+        // are written at once, as described in the {Zero-Copy Writes} section
+        // in the component-level documentation, or disable zero-copy writes
+        // for that channel if 'numBytes' is 0.  Return 0 on success, and a
+        // non-zero value if 'channelId' does not exist or if zero copy is not
+        // supported for the socket of the channel (e.g., for a local
+        // connection, on platforms other than Linux, or if this channel pool
+        // uses 'io_uring' event managers).  The behavior is undefined unless
+        // '0 <= numBytes'.
+
     int resetRecordedMaxWriteQueueSize(int channelId);
         // Reset the recorded max write queue size for the specified
         // 'channelId' to the current write queue size.  Return 0 on success,
@@ -1642,6 +1963,34 @@ class ChannelPool {
         // function resets the recorded max write queue size and does not
         // change the write queue high-water mark for 'channelId'.
 
+    int pinChannel(int channelId, int managerIndex);
+        // Associate the channel having the specified 'channelId' with the
+        // event manager having the specified 'managerIndex', migrating the
+        // channel if it is currently associated with another event manager,
+        // and exclude it from rebalancing until 'unpinChannel' is called (see
+        // {Channel Rebalancing}).  Return 0 on success, and a non-zero value
+        // if 'channelId' does not exist or 'managerIndex' is not in the range
+        // '[0 .. numThreads() - 1]'.  Note that the migration completes
+        // asynchronously, after this method returns.
+
+    int unpinChannel(int channelId);
+        // Make the channel having the specified 'channelId' subject to
+        // rebalancing again, after a call to 'pinChannel'.  Return 0 on
+        // success, and a non-zero value if 'channelId' does not exist.  Note
+        // that this method does not migrate the channel.
+
+    int rebalance();
+        // Migrate channels from the most loaded event manager of this channel
+        // pool to the least loaded one, where the load of a channel is the
+        // number of bytes it read and wrote since the previous call to this
+        // method (or the creation of the channel), as described in the
+        // {Channel Rebalancing} section in the component-level documentation.
+        // Return the number of channels whose migration was initiated.  Note
+        // that this method is invoked periodically if the configured
+        // 'rebalanceInterval' is positive, and that channels pinned by
+        // 'pinChannel', as well as channels that are not fully up, are never
+        // migrated.
+
                                   // *** Thread management ***
 
     int start();
@@ -1660,6 +2009,13 @@ class ChannelPool {
         // function has no effect on the state of any channel managed by this
         // pool.
 
+    void setThreadAttributes(const bslmt::ThreadAttributes& attributes);
+        // Set the attributes of the worker threads of this pool to the
+        // specified 'attributes', as adapted in the {Worker Thread
+        // Attributes} section in the component-level documentation.  The new
+        // attributes take effect the next time the worker threads are
+        // created, i.e., by the next call to 'start'.
+
                                   // *** Incoming messages ***
 
     btlb::BlobBufferFactory *incomingBlobBufferFactory();
@@ -1716,7 +2072,9 @@ class ChannelPool {
         // already registered.  Note that if 'channelId' is provided and does
         // not correspond to an active channel, a non-zero value not equal to 1
         // is returned, even if a clock with the specified 'clockId' is already
-        // registered.
+        // registered.  Also note that, if the channel having 'channelId' is
+        // migrated to another event manager (see {Channel Rebalancing}), a
+        // periodic clock follows it starting with its next occurrence.
 
     void deregisterClock(int clockId);
         // Deregister the clock having the specified 'clockId'.
@@ -1807,6 +2165,15 @@ class ChannelPool {
         // 'channelId', and '(void *)0' if no such channel exists or the user
         // context for this channel was explicitly set to '(void *)0'.
 
+    int eventManagerIndex(int *result, int channelId) const;
+        // Load into the specified 'result' the index of the event manager
+        // (i.e., of the thread) the channel having the specified 'channelId'
+        // is currently associated with.  Return 0 on success, and a non-zero
+        // value with no effect on 'result' if 'channelId' does not exist.
+        // Note that the index changes once a migration of the channel (see
+        // {Channel Rebalancing}) takes effect, which may be shortly after the
+        // migration is requested.
+
     int getChannelStatistics(bsls::Types::Int64 *numRead,
                              bsls::Types::Int64 *numRequestedToBeWritten,
                              bsls::Types::Int64 *numWritten,
@@ -1869,18 +2236,45 @@ class ChannelPool {
         // with the server with the specified 'serverId' that is managed by
         // this channel pool if the server is established.  Return 0 on
         // success, and a non-zero value with no effect on 'result' otherwise.
+        // Note that the default address is reported for local (Unix-domain)
+        // servers.
+
+    int getServerAddress(btlso::LocalAddress *result, int serverId) const;
+        // Load into the specified 'result' the path of the local
+        // (Unix-domain) server with the specified 'serverId' that is managed
+        // by this channel pool if the server is established.  Return 0 on
+        // success, and a non-zero value with no effect on 'result' otherwise.
+        // Note that an empty path is reported for TCP servers.
 
     int getLocalAddress(btlso::IPv4Address *result, int channelId) const;
         // Load into the specified 'result' the complete IP address associated
         // with the local (i.e., this process) end-point of the communication
         // channel having the specified 'channelId'.  Return 0 on success, and
-        // a non-zero value with no effect on 'result' otherwise.
+        // a non-zero value with no effect on 'result' otherwise (including if
+        // the channel is over a local (Unix-domain) socket).
+
+    int getLocalAddress(btlso::LocalAddress *result, int channelId) const;
+        // Load into the specified 'result' the path of the local (i.e., this
+        // process) end-point of the local (Unix-domain) channel having the
+        // specified 'channelId'.  Return 0 on success, and a non-zero value
+        // with no effect on 'result' otherwise (including if the channel is
+        // not over a local socket).  Note that the path of the connecting end
+        // of a local channel is typically empty.
 
     int getPeerAddress(btlso::IPv4Address *result, int channelId) const;
         // Load into the specified 'result' the complete IP address associated
         // with the remote (i.e., peer process) end-point of the communication
         // channel having the specified 'channelId'.  Return 0 on success, and
-        // a non-zero value with no effect on 'result' otherwise.
+        // a non-zero value with no effect on 'result' otherwise (including if
+        // the channel is over a local (Unix-domain) socket).
+
+    int getPeerAddress(btlso::LocalAddress *result, int channelId) const;
+        // Load into the specified 'result' the path of the remote (i.e., peer
+        // process) end-point of the local (Unix-domain) channel having the
+        // specified 'channelId'.  Return 0 on success, and a non-zero value
+        // with no effect on 'result' otherwise (including if the channel is
+        // not over a local socket).  Note that the path of the connecting end
+        // of a local channel is typically empty.
 
     int numBytesRead(bsls::Types::Int64 *result, int channelId) const;
         // Load, into the specified 'result', the number of bytes read by the
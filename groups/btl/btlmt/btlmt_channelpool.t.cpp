@@ -14,9 +14,11 @@
 #include <btlmt_asyncchannel.h>
 
 #include <btls_iovecutil.h>
+#include <btlso_defaulteventmanager_iouring.h>
 #include <btlso_flag.h>
 #include <btlso_inetstreamsocketfactory.h>
 #include <btlso_ipv4address.h>
+#include <btlso_localaddress.h>
 #include <btlso_resolveutil.h>
 #include <btlso_streamsocket.h>
 #include <btlso_socketoptions.h>
@@ -33,6 +35,7 @@
 #include <bslmt_lockguard.h>
 #include <bslmt_condition.h>
 #include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
 #include <bdlmt_fixedthreadpool.h>
@@ -75,6 +78,8 @@
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <bsl_c_signal.h>
 #include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 using namespace bsl;  // automatically added by script
@@ -113,6 +118,11 @@ using namespace bdlf::PlaceHolders;
 // [ 4]  int btlmt::ChannelPool::connect(...);
 // [ 5]  int btlmt::ChannelPool::listen(int port, ...);
 // [ 4]  int btlmt::ChannelPool::listen(const IPv4Address&  address, ...);
+// [37]  int btlmt::ChannelPool::listen(const LocalAddress& address, ...);
+// [37]  int btlmt::ChannelPool::connect(const LocalAddress& address, ...);
+// [37]  int getServerAddress(btlso::LocalAddress *, int) const;
+// [37]  int getLocalAddress(btlso::LocalAddress *, int) const;
+// [37]  int getPeerAddress(btlso::LocalAddress *, int) const;
 // [ 5]  int btlmt::ChannelPool::close(int serverID);
 // [ 6]  int btlmt::ChannelPool::import(...);
 // [ 8]  int btlmt::ChannelPool::shutdown();
@@ -125,6 +135,11 @@ using namespace bdlf::PlaceHolders;
 // [25]  int btlmt::ChannelPool::setWriteQueueHighWatermark(int, int);
 // [25]  int btlmt::ChannelPool::setWriteQueueLowWatermark(int, int);
 // [25]  int btlmt::ChannelPool::setWriteQueueWatermarks(int, int, int);
+// [39]  int btlmt::ChannelPool::pinChannel(int channelId, int index);
+// [39]  int btlmt::ChannelPool::unpinChannel(int channelId);
+// [39]  int btlmt::ChannelPool::rebalance();
+// [39]  int btlmt::ChannelPool::eventManagerIndex(int *, int) const;
+// [40]  int btlmt::ChannelPool::setZeroCopyThreshold(int, int);
 // [  ]  void *btlmt::ChannelPool::channelContext(int channelId);
 // [  ]  void btlmt::ChannelPool::setChannelContext(int channelId, ...);
 // [  ]  int btlmt::ChannelPool::outboundBufferFactory();
@@ -166,7 +181,12 @@ using namespace bdlf::PlaceHolders;
 // [28] TESTING: 'busyMetrics' and time metrics collection.
 // [28] CONCERN: Event Manager Allocation
 // [30] Implementing a QueueProcessor
-// [37] USAGE EXAMPLE
+// [37] CONCERN: Local (Unix-domain) connections
+// [38] CONCERN: Edge-triggered events
+// [39] CONCERN: Channel migration and rebalancing
+// [40] CONCERN: Zero-copy writes
+// [41] CONCERN: 'io_uring' events
+// [42] USAGE EXAMPLE
 //=============================================================================
 //                       STANDARD BDE ASSERT TEST MACROS
 //-----------------------------------------------------------------------------
@@ -961,6 +981,524 @@ int ReadServer::portNumber() const
 
 }  // close namespace TEST_CASE_CTOR_TAKING_FACTORY
 
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_LOCAL_CONNECTIONS
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_LOCAL_CONNECTIONS {
+
+enum {
+    k_SERVER_ID = 1001,
+    k_CLIENT_ID = 2002
+};
+
+struct State {
+    // This 'struct' holds the state shared by the callbacks of this test
+    // case.
+
+    btlmt::ChannelPool *d_pool_p;
+    bslmt::Mutex        d_mutex;
+    bslmt::Semaphore    d_upSemaphore;
+    bslmt::Semaphore    d_echoSemaphore;
+    bslmt::Semaphore    d_errorSemaphore;
+    int                 d_serverChannelId;
+    int                 d_clientChannelId;
+    bsl::string         d_echoed;
+
+    State()
+    : d_pool_p(0)
+    , d_serverChannelId(-1)
+    , d_clientChannelId(-1)
+    {
+    }
+};
+
+void poolStateCb(int state, int source, int severity, State *testState)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Pool state callback called with"
+                  << " State: " << state
+                  << " Source: "  << source
+                  << " Severity: " << severity << bsl::endl;
+    }
+    if (btlmt::ChannelPool::e_ERROR_CONNECTING == state) {
+        testState->d_errorSemaphore.post();
+    }
+}
+
+void channelStateCb(int    channelId,
+                    int    sourceId,
+                    int    state,
+                    void  *,
+                    State *testState)
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP != state) {
+        return;                                                       // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+        if (k_SERVER_ID == sourceId) {
+            testState->d_serverChannelId = channelId;
+        }
+        else {
+            ASSERT(k_CLIENT_ID == sourceId);
+            testState->d_clientChannelId = channelId;
+        }
+    }
+    testState->d_upSemaphore.post();
+}
+
+void blobBasedReadCb(int        *needed,
+                     btlb::Blob *msg,
+                     int         channelId,
+                     void       *,
+                     State      *testState)
+{
+    // Echo the data received by the server back to the client, and collect
+    // the data received by the client.
+
+    *needed = 1;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+    if (channelId == testState->d_serverChannelId) {
+        ASSERT(0 == testState->d_pool_p->write(channelId, *msg));
+    }
+    else {
+        for (int i = 0; i < msg->numDataBuffers(); ++i) {
+            const int length = i < msg->numDataBuffers() - 1
+                               ? msg->buffer(i).size()
+                               : msg->lastDataBufferLength();
+            testState->d_echoed.append(msg->buffer(i).data(), length);
+        }
+        testState->d_echoSemaphore.post();
+    }
+    msg->removeAll();
+}
+
+bool fileExists(const char *path)
+    // Return 'true' if a file exists at the specified 'path', and 'false'
+    // otherwise.
+{
+    struct stat info;
+    return 0 == ::stat(path, &info);
+}
+
+}  // close namespace TEST_CASE_LOCAL_CONNECTIONS
+
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_EDGE_TRIGGERED
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_EDGE_TRIGGERED {
+
+enum {
+    k_SERVER_ID   = 1001,
+    k_CLIENT_ID   = 2002,  // first client id, one per client
+    k_NUM_CLIENTS = 4
+};
+
+struct State {
+    // This 'struct' holds the state shared by the callbacks of this test
+    // case.
+
+    btlmt::ChannelPool           *d_pool_p;
+    bslmt::Mutex                  d_mutex;
+    bslmt::Semaphore              d_upSemaphore;
+    bslmt::Semaphore              d_echoSemaphore;
+    bsl::vector<int>              d_clientChannelIds;
+    bsl::map<int, bsl::string>    d_echoed;  // indexed by client channel id
+
+    explicit State(bslma::Allocator *basicAllocator)
+    : d_pool_p(0)
+    , d_clientChannelIds(basicAllocator)
+    , d_echoed(basicAllocator)
+    {
+    }
+};
+
+void channelStateCb(int    channelId,
+                    int    sourceId,
+                    int    state,
+                    void  *,
+                    State *testState)
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP != state) {
+        return;                                                       // RETURN
+    }
+
+    if (k_CLIENT_ID <= sourceId) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+        testState->d_clientChannelIds.push_back(channelId);
+        testState->d_echoed[channelId];
+    }
+    testState->d_upSemaphore.post();
+}
+
+void poolStateCb(int state, int source, int severity)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Pool state callback called with"
+                  << " State: " << state
+                  << " Source: "  << source
+                  << " Severity: " << severity << bsl::endl;
+    }
+}
+
+void blobBasedReadCb(int        *needed,
+                     btlb::Blob *msg,
+                     int         channelId,
+                     void       *,
+                     State      *testState)
+{
+    // Echo the data received on server channels back to the client, and
+    // collect the data received on client channels.
+
+    *needed = 1;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+    bsl::map<int, bsl::string>::iterator it =
+                                          testState->d_echoed.find(channelId);
+    if (testState->d_echoed.end() == it) {
+        ASSERT(0 == testState->d_pool_p->write(channelId, *msg));
+    }
+    else {
+        for (int i = 0; i < msg->numDataBuffers(); ++i) {
+            const int length = i < msg->numDataBuffers() - 1
+                               ? msg->buffer(i).size()
+                               : msg->lastDataBufferLength();
+            it->second.append(msg->buffer(i).data(), length);
+        }
+        testState->d_echoSemaphore.post();
+    }
+    msg->removeAll();
+}
+
+}  // close namespace TEST_CASE_EDGE_TRIGGERED
+
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_CHANNEL_MIGRATION
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_CHANNEL_MIGRATION {
+
+enum {
+    k_SERVER_ID   = 1001,
+    k_CLIENT_ID   = 2002,  // first client id, one per client
+    k_NUM_CLIENTS = 4,
+    k_NUM_THREADS = 3
+};
+
+struct State {
+    // This 'struct' holds the state shared by the callbacks of this test
+    // case.
+
+    btlmt::ChannelPool                        *d_pool_p;
+    bslmt::Mutex                               d_mutex;
+    bslmt::Semaphore                           d_upSemaphore;
+    bslmt::Semaphore                           d_echoSemaphore;
+    bslmt::Semaphore                           d_clockSemaphore;
+    bsl::vector<int>                           d_clientChannelIds;
+    bsl::vector<int>                           d_serverChannelIds;
+    bsl::map<int, bsl::string>                 d_echoed;
+                                                   // indexed by client
+                                                   // channel id
+
+    bsl::map<int, bslmt::ThreadUtil::Handle>   d_readThreads;
+                                                   // thread of the last data
+                                                   // callback, indexed by
+                                                   // channel id
+
+    bsl::map<int, int>                         d_numActiveCallbacks;
+                                                   // indexed by channel id
+
+    bool                                       d_concurrentCallbacks;
+
+    bslmt::ThreadUtil::Handle                  d_clockThread;
+
+    explicit State(bslma::Allocator *basicAllocator)
+    : d_pool_p(0)
+    , d_clientChannelIds(basicAllocator)
+    , d_serverChannelIds(basicAllocator)
+    , d_echoed(basicAllocator)
+    , d_readThreads(basicAllocator)
+    , d_numActiveCallbacks(basicAllocator)
+    , d_concurrentCallbacks(false)
+    , d_clockThread(bslmt::ThreadUtil::invalidHandle())
+    {
+    }
+};
+
+void channelStateCb(int    channelId,
+                    int    sourceId,
+                    int    state,
+                    void  *,
+                    State *testState)
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP != state) {
+        return;                                                       // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+        if (k_CLIENT_ID <= sourceId) {
+            testState->d_clientChannelIds.push_back(channelId);
+            testState->d_echoed[channelId];
+        }
+        else {
+            testState->d_serverChannelIds.push_back(channelId);
+        }
+    }
+    testState->d_upSemaphore.post();
+}
+
+void poolStateCb(int state, int source, int severity)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Pool state callback called with"
+                  << " State: " << state
+                  << " Source: "  << source
+                  << " Severity: " << severity << bsl::endl;
+    }
+}
+
+void blobBasedReadCb(int        *needed,
+                     btlb::Blob *msg,
+                     int         channelId,
+                     void       *,
+                     State      *testState)
+{
+    // Echo the data received on server channels back to the client, and
+    // collect the data received on client channels.  Record the calling
+    // thread, and whether another data callback for the same channel is
+    // running concurrently.
+
+    *needed = 1;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+        if (0 != testState->d_numActiveCallbacks[channelId]++) {
+            testState->d_concurrentCallbacks = true;
+        }
+        testState->d_readThreads[channelId] = bslmt::ThreadUtil::self();
+    }
+
+    // Give a concurrent callback for the same channel a chance to overlap.
+
+    bslmt::ThreadUtil::yield();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+    --testState->d_numActiveCallbacks[channelId];
+
+    bsl::map<int, bsl::string>::iterator it =
+                                          testState->d_echoed.find(channelId);
+    if (testState->d_echoed.end() == it) {
+        ASSERT(0 == testState->d_pool_p->write(channelId, *msg));
+    }
+    else {
+        for (int i = 0; i < msg->numDataBuffers(); ++i) {
+            const int length = i < msg->numDataBuffers() - 1
+                               ? msg->buffer(i).size()
+                               : msg->lastDataBufferLength();
+            it->second.append(msg->buffer(i).data(), length);
+        }
+        testState->d_echoSemaphore.post();
+    }
+    msg->removeAll();
+}
+
+void clockCb(State *testState)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+        testState->d_clockThread = bslmt::ThreadUtil::self();
+    }
+    testState->d_clockSemaphore.post();
+}
+
+bslmt::ThreadUtil::Handle dispatcherThread(const btlmt::ChannelPool& pool,
+                                           int                       channelId)
+    // Return the handle of the dispatcher thread of the event manager
+    // associated with the channel having the specified 'channelId' in the
+    // specified 'pool', or an invalid handle if there is no such channel.
+{
+    bsl::vector<btlmt::ChannelPool::HandleInfo> handleInfo;
+    pool.getHandleStatistics(&handleInfo);
+
+    for (int i = 0; i < static_cast<int>(handleInfo.size()); ++i) {
+        if (channelId == handleInfo[i].d_channelId) {
+            return handleInfo[i].d_threadHandle;                      // RETURN
+        }
+    }
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+void waitForIndex(const btlmt::ChannelPool& pool, int channelId, int index)
+    // Wait until the channel having the specified 'channelId' in the
+    // specified 'pool' is associated with the event manager having the
+    // specified 'index', or until a timeout expires.
+{
+    for (int i = 0; i < 1000; ++i) {
+        int current = -1;
+        ASSERT(0 == pool.eventManagerIndex(&current, channelId));
+        if (index == current) {
+            return;                                                   // RETURN
+        }
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+    LOOP2_ASSERT(channelId, index, !"Channel was not migrated");
+}
+
+void echoAll(State *testState, const bsl::string& message, int round)
+    // Write the specified 'message' on each client channel of the specified
+    // 'testState', and wait until it is echoed back to every client, for the
+    // specified 'round' (numbered from 1) of calls to this function.
+{
+    btlb::PooledBlobBufferFactory factory(4096);
+
+    const int length = static_cast<int>(message.length());
+
+    for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+        btlb::Blob blob(&factory);
+        btlb::BlobUtil::append(&blob, message.data(), length);
+
+        const int rc = testState->d_pool_p->write(
+                                         testState->d_clientChannelIds[i],
+                                         blob);
+        LOOP2_ASSERT(i, rc, 0 == rc);
+    }
+
+    bool done = false;
+    while (!done) {
+        testState->d_echoSemaphore.wait();
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+        done = true;
+        for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+            const bsl::string& echoed =
+                       testState->d_echoed[testState->d_clientChannelIds[i]];
+            if (round * length > static_cast<int>(echoed.length())) {
+                done = false;
+            }
+        }
+    }
+}
+
+}  // close namespace TEST_CASE_CHANNEL_MIGRATION
+
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_ZERO_COPY
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_ZERO_COPY {
+
+enum {
+    k_SERVER_ID   = 1001,
+    k_CLIENT_ID   = 2002,  // first client id, one per client
+    k_NUM_CLIENTS = 2
+};
+
+struct State {
+    // This 'struct' holds the state shared by the callbacks of this test
+    // case.
+
+    btlmt::ChannelPool           *d_pool_p;
+    bslmt::Mutex                  d_mutex;
+    bslmt::Semaphore              d_upSemaphore;
+    bslmt::Semaphore              d_echoSemaphore;
+    bsl::vector<int>              d_clientChannelIds;
+    bsl::vector<int>              d_serverChannelIds;
+    bsl::map<int, bsl::string>    d_echoed;  // indexed by client channel id
+    bool                          d_echoFlag;  // echo on server channels
+
+    explicit State(bslma::Allocator *basicAllocator)
+    : d_pool_p(0)
+    , d_clientChannelIds(basicAllocator)
+    , d_serverChannelIds(basicAllocator)
+    , d_echoed(basicAllocator)
+    , d_echoFlag(true)
+    {
+    }
+};
+
+void channelStateCb(int    channelId,
+                    int    sourceId,
+                    int    state,
+                    void  *,
+                    State *testState)
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP != state) {
+        return;                                                       // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+        if (k_CLIENT_ID <= sourceId) {
+            testState->d_clientChannelIds.push_back(channelId);
+            testState->d_echoed[channelId];
+        }
+        else {
+            testState->d_serverChannelIds.push_back(channelId);
+        }
+    }
+    testState->d_upSemaphore.post();
+}
+
+void poolStateCb(int state, int source, int severity)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Pool state callback called with"
+                  << " State: " << state
+                  << " Source: "  << source
+                  << " Severity: " << severity << bsl::endl;
+    }
+}
+
+void blobBasedReadCb(int        *needed,
+                     btlb::Blob *msg,
+                     int         channelId,
+                     void       *,
+                     State      *testState)
+{
+    // Echo the data received on server channels back to the client (unless
+    // echoing is disabled), and collect the data received on client channels.
+
+    *needed = 1;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&testState->d_mutex);
+
+    bsl::map<int, bsl::string>::iterator it =
+                                          testState->d_echoed.find(channelId);
+    if (testState->d_echoed.end() == it) {
+        if (testState->d_echoFlag) {
+            ASSERT(0 == testState->d_pool_p->write(channelId, *msg));
+        }
+    }
+    else {
+        for (int i = 0; i < msg->numDataBuffers(); ++i) {
+            const int length = i < msg->numDataBuffers() - 1
+                               ? msg->buffer(i).size()
+                               : msg->lastDataBufferLength();
+            it->second.append(msg->buffer(i).data(), length);
+        }
+        testState->d_echoSemaphore.post();
+    }
+    msg->removeAll();
+}
+
+}  // close namespace TEST_CASE_ZERO_COPY
+
 //-----------------------------------------------------------------------------
 //                                  TEST_CASE_TESTING_PEER_ADDRESS
 //-----------------------------------------------------------------------------
@@ -1026,6 +1564,12 @@ void blobBasedReadCb(int            *needed,
     d_pool_p->getPeerAddress(&peer, channelId);
     LOOP2_ASSERT(d_peerAddress, peer, d_peerAddress == peer);
 
+    // The paths of the end-points are reported for local channels only.
+
+    btlso::LocalAddress path;
+    ASSERT(0 != d_pool_p->getPeerAddress(&path, channelId));
+    ASSERT(0 != d_pool_p->getLocalAddress(&path, channelId));
+
     msg->removeAll();
 }
 
@@ -7738,9 +8282,24 @@ class TestDriver {
 
   public:
     // TEST CASES
-    static void testCase37();
+    static void testCase42();
         // Test usage example.
 
+    static void testCase41();
+        // Test that data is delivered reliably by 'io_uring' event managers.
+
+    static void testCase40();
+        // Test zero-copy writes.
+
+    static void testCase39();
+        // Test migrating channels between event managers.
+
+    static void testCase38();
+        // Test that data is delivered reliably in edge-triggered mode.
+
+    static void testCase37();
+        // Test listening on, and connecting to, local (Unix-domain) sockets.
+
     static void testCase36();
         // Test the new constructor form that takes a BlobBufferFactory.
 
@@ -7867,6 +8426,1132 @@ class TestDriver {
                                // --------------
 
 void TestDriver::testCase37()
+{
+        // --------------------------------------------------------------------
+        // TESTING LOCAL (UNIX-DOMAIN) CONNECTIONS
+        //
+        // Concerns:
+        //: 1 A pool can listen on a local socket path and connect to it, and
+        //:   data flows over the resulting channels.
+        //:
+        //: 2 'getServerAddress' reports the path of a local server, and
+        //:   'getLocalAddress' and 'getPeerAddress' report the paths of the
+        //:   end-points of local channels, and fail when passed an IP
+        //:   address for local channels, or a path for TCP channels.
+        //:
+        //: 3 The socket file is removed when the server is closed, and a
+        //:   stale socket file is replaced only if 'reuseAddress' is set.
+        //:   The socket file of a running server is never replaced.
+        //:
+        //: 4 Connecting to a path where no server listens fails with
+        //:   'e_ERROR_CONNECTING'.
+        //
+        // Plan:
+        //: 1 Listen on a path in the working directory, connect to it from
+        //:   the same pool, write a message on the client channel, and wait
+        //:   for the server channel to echo it back.  (C-1..2)
+        //:
+        //: 2 Listen with 'reuseAddress' on the path of the running server,
+        //:   and verify that it fails and that the server still accepts
+        //:   connections.  Close the server and verify the socket file is
+        //:   gone.  Leave a stale socket file by binding a raw local socket,
+        //:   and listen on its path with and without 'reuseAddress'.  (C-3)
+        //:
+        //: 3 Connect to the (unused) path once and wait for the pool state
+        //:   callback.  (C-4)
+        //
+        // Testing:
+        //   int listen(const LocalAddress& endpoint, ...);
+        //   int connect(const LocalAddress& serverAddress, ...);
+        //   int getServerAddress(btlso::LocalAddress *, int) const;
+        //   int getLocalAddress(btlso::LocalAddress *, int) const;
+        //   int getPeerAddress(btlso::LocalAddress *, int) const;
+        //   CONCERN: Local (Unix-domain) connections
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING LOCAL (UNIX-DOMAIN) CONNECTIONS"
+                 << "\n=======================================" << endl;
+
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+        using namespace TEST_CASE_LOCAL_CONNECTIONS;
+
+        char path[btlso::LocalAddress::k_MAX_PATH_LENGTH + 1];
+        snprintf(path,
+                 sizeof path,
+                 "btlmt_channelpool.%d.sock",
+                 static_cast<int>(getpid()));
+        ::unlink(path);
+
+        const btlso::LocalAddress ENDPOINT(path);
+
+        State state;
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(2);
+
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                        bdlf::BindUtil::bind(&channelStateCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+        btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                        bdlf::BindUtil::bind(&blobBasedReadCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+        btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                        bdlf::BindUtil::bind(&poolStateCb,
+                                                             _1, _2, _3,
+                                                             &state));
+
+        bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+        {
+            btlmt::ChannelPool pool(channelCb, dataCb, poolCb, config, &ta);
+            state.d_pool_p = &pool;
+
+            ASSERT(0 == pool.start());
+
+            if (verbose) cout << "\tEcho over a local connection." << endl;
+
+            int rc = pool.listen(ENDPOINT, 5, k_SERVER_ID);
+            LOOP_ASSERT(rc, 0 == rc);
+            ASSERT(fileExists(path));
+
+            btlso::LocalAddress server;
+            ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+            LOOP_ASSERT(server, ENDPOINT == server);
+
+            rc = pool.connect(ENDPOINT,
+                              1,
+                              bsls::TimeInterval(1.0),
+                              k_CLIENT_ID);
+            LOOP_ASSERT(rc, 0 == rc);
+
+            state.d_upSemaphore.wait();
+            state.d_upSemaphore.wait();
+
+            ASSERT(-1 != state.d_serverChannelId);
+            ASSERT(-1 != state.d_clientChannelId);
+
+            const btlso::IPv4Address IP("1.2.3.4", 5);
+
+            btlso::IPv4Address ip(IP);
+            ASSERT(0 != pool.getPeerAddress(&ip, state.d_clientChannelId));
+            ASSERT(0 != pool.getLocalAddress(&ip, state.d_serverChannelId));
+            LOOP_ASSERT(ip, IP == ip);
+
+            btlso::LocalAddress local("x");
+            ASSERT(0 == pool.getPeerAddress(&local,
+                                            state.d_clientChannelId));
+            LOOP_ASSERT(local, ENDPOINT == local);
+
+            ASSERT(0 == pool.getLocalAddress(&local,
+                                             state.d_serverChannelId));
+            LOOP_ASSERT(local, ENDPOINT == local);
+
+            local.setPath("x");
+            ASSERT(0 == pool.getPeerAddress(&local,
+                                            state.d_serverChannelId));
+            LOOP_ASSERT(local, btlso::LocalAddress() == local);
+
+            const char MESSAGE[] = "hello over a local socket";
+            const int  LENGTH    = sizeof MESSAGE - 1;
+
+            btlb::PooledBlobBufferFactory factory(8);
+            btlb::Blob                    blob(&factory);
+            btlb::BlobUtil::append(&blob, MESSAGE, LENGTH);
+
+            ASSERT(0 == pool.write(state.d_clientChannelId, blob));
+
+            while (true) {
+                state.d_echoSemaphore.wait();
+
+                bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+                if (LENGTH <= static_cast<int>(state.d_echoed.length())) {
+                    break;
+                }
+            }
+            LOOP_ASSERT(state.d_echoed, MESSAGE == state.d_echoed);
+
+            if (verbose) cout << "\tSocket file lifetime." << endl;
+
+            rc = pool.listen(ENDPOINT, 5, k_SERVER_ID + 1, 1);
+            LOOP_ASSERT(rc, 0 > rc);
+            ASSERT(fileExists(path));
+
+            btlso::SocketHandle::Handle client;
+            typedef btlso::SocketImpUtil Util;
+            ASSERT(0 == Util::open<btlso::LocalAddress>(
+                                                   &client,
+                                                   Util::k_SOCKET_STREAM));
+            ASSERT(0 == Util::connect(client, ENDPOINT));
+            state.d_upSemaphore.wait();
+            ASSERT(0 == Util::close(client));
+
+            ASSERT(0 == pool.close(k_SERVER_ID));
+            ASSERT(!fileExists(path));
+
+            btlso::SocketHandle::Handle stale;
+            ASSERT(0 == Util::open<btlso::LocalAddress>(
+                                                   &stale,
+                                                   Util::k_SOCKET_STREAM));
+            ASSERT(0 == btlso::SocketImpUtil::bind(stale, ENDPOINT));
+            ASSERT(0 == btlso::SocketImpUtil::close(stale));
+            ASSERT(fileExists(path));
+
+            rc = pool.listen(ENDPOINT, 5, k_SERVER_ID, 0);
+            LOOP_ASSERT(rc, 0 > rc);
+
+            rc = pool.listen(ENDPOINT, 5, k_SERVER_ID, 1);
+            LOOP_ASSERT(rc, 0 == rc);
+
+            ASSERT(0 == pool.close(k_SERVER_ID));
+            ASSERT(!fileExists(path));
+
+            if (verbose) cout << "\tConnecting to a missing server." << endl;
+
+            rc = pool.connect(ENDPOINT,
+                              1,
+                              bsls::TimeInterval(1.0),
+                              k_CLIENT_ID);
+            LOOP_ASSERT(rc, 0 == rc);
+            state.d_errorSemaphore.wait();
+
+            ASSERT(0 == pool.stop());
+        }
+        LOOP_ASSERT(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+#else
+        if (verbose) cout << "Local sockets are not supported." << endl;
+#endif
+}
+
+void TestDriver::testCase38()
+{
+        // --------------------------------------------------------------------
+        // TESTING EDGE-TRIGGERED EVENTS
+        //
+        // Concerns:
+        //: 1 With 'edgeTriggeredEvents' set, a pool accepts every connection
+        //:   pending on a listening socket, even if they arrive together.
+        //:
+        //: 2 Messages larger than a single read buffer or socket buffer are
+        //:   delivered completely and in order in both directions, i.e., no
+        //:   data is left unread in a socket after a read callback.
+        //
+        // Plan:
+        //: 1 Create a pool with 'edgeTriggeredEvents' set, listen on the
+        //:   loopback interface, and connect several clients at once.  Wait
+        //:   for the server and client channels to come up.  (C-1)
+        //:
+        //: 2 Write a large message on each client channel, echo it back from
+        //:   the server channels, and verify each client receives exactly
+        //:   the data it sent.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Edge-triggered events
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING EDGE-TRIGGERED EVENTS"
+                 << "\n=============================" << endl;
+
+        using namespace TEST_CASE_EDGE_TRIGGERED;
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(2);
+        config.setEdgeTriggeredEvents(true);
+
+        bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+        {
+            State state(&ta);
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                        bdlf::BindUtil::bind(&channelStateCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+            btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                        bdlf::BindUtil::bind(&blobBasedReadCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+            btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                                                &poolStateCb);
+
+            btlmt::ChannelPool pool(channelCb, dataCb, poolCb, config, &ta);
+            state.d_pool_p = &pool;
+
+            ASSERT(0 == pool.start());
+
+            const btlso::IPv4Address ENDPOINT("127.0.0.1", 0);
+
+            int rc = pool.listen(ENDPOINT, k_NUM_CLIENTS, k_SERVER_ID);
+            LOOP_ASSERT(rc, 0 == rc);
+
+            btlso::IPv4Address server;
+            ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+
+            if (verbose) cout << "\tAccepting several connections." << endl;
+
+            for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                rc = pool.connect(server,
+                                  1,
+                                  bsls::TimeInterval(1.0),
+                                  k_CLIENT_ID + i);
+                LOOP2_ASSERT(i, rc, 0 == rc);
+            }
+
+            for (int i = 0; i < 2 * k_NUM_CLIENTS; ++i) {
+                state.d_upSemaphore.wait();
+            }
+            LOOP_ASSERT(state.d_clientChannelIds.size(),
+                        k_NUM_CLIENTS == state.d_clientChannelIds.size());
+
+            if (verbose) cout << "\tEchoing large messages." << endl;
+
+            const int k_LENGTH = 100 * 1000;
+
+            bsl::string message(&ta);
+            message.reserve(k_LENGTH);
+            for (int i = 0; i < k_LENGTH; ++i) {
+                message.push_back(static_cast<char>('a' + i % 26));
+            }
+
+            btlb::PooledBlobBufferFactory factory(4096, &ta);
+
+            for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                btlb::Blob blob(&factory, &ta);
+                btlb::BlobUtil::append(&blob, message.data(), k_LENGTH);
+
+                rc = pool.write(state.d_clientChannelIds[i], blob);
+                LOOP2_ASSERT(i, rc, 0 == rc);
+            }
+
+            bool done = false;
+            while (!done) {
+                state.d_echoSemaphore.wait();
+
+                bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+
+                done = true;
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    const bsl::string& echoed =
+                                 state.d_echoed[state.d_clientChannelIds[i]];
+                    if (k_LENGTH > static_cast<int>(echoed.length())) {
+                        done = false;
+                    }
+                }
+            }
+
+            for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                const bsl::string& echoed =
+                                 state.d_echoed[state.d_clientChannelIds[i]];
+                LOOP2_ASSERT(i, echoed.length(), message == echoed);
+            }
+
+            ASSERT(0 == pool.stop());
+        }
+        LOOP_ASSERT(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+}
+
+void TestDriver::testCase39()
+{
+        // --------------------------------------------------------------------
+        // TESTING CHANNEL MIGRATION
+        //
+        // Concerns:
+        //: 1 'eventManagerIndex' reports the index of the event manager of a
+        //:   channel, and fails for an unknown channel.
+        //:
+        //: 2 'pinChannel' migrates a channel to the specified event manager,
+        //:   after which the callbacks of the channel are invoked in the
+        //:   thread of that event manager, and fails for an unknown channel
+        //:   or an invalid index.
+        //:
+        //: 3 'rebalance' migrates channels away from a loaded event manager,
+        //:   does not migrate pinned channels, and does nothing when there
+        //:   was no traffic since its previous call.
+        //:
+        //: 4 No data is lost, reordered, or delivered concurrently to two
+        //:   threads when a channel is migrated while data is in flight.
+        //:
+        //: 5 A periodic clock associated with a channel follows the channel
+        //:   to its new event manager.
+        //
+        // Plan:
+        //: 1 Create a pool with three threads, connect several clients to an
+        //:   echo server, and check 'eventManagerIndex' for each channel and
+        //:   for an unknown channel.  (C-1)
+        //:
+        //: 2 Pin every channel to the first event manager, and wait until
+        //:   'eventManagerIndex' reflects the migration.  Call 'pinChannel'
+        //:   with an invalid index and an unknown channel.  (C-2)
+        //:
+        //: 3 Echo a large message on every channel, unpin all but one
+        //:   channel and call 'rebalance'.  Verify that channels were
+        //:   migrated, that the pinned channel was not, and that a second
+        //:   call to 'rebalance' migrates nothing.  (C-3)
+        //:
+        //: 4 Echo a message again and verify its integrity, and that the data
+        //:   callback of each server channel was last invoked in the thread
+        //:   of its event manager.  Then repeatedly pin a client channel to
+        //:   each event manager in turn while writing on it, and verify the
+        //:   data echoed back.  (C-2, 4)
+        //:
+        //: 5 Register a periodic clock associated with a server channel, pin
+        //:   the channel to each event manager in turn, and verify that the
+        //:   clock is eventually invoked in the thread of that manager.  (C-5)
+        //
+        // Testing:
+        //   int btlmt::ChannelPool::pinChannel(int channelId, int index);
+        //   int btlmt::ChannelPool::unpinChannel(int channelId);
+        //   int btlmt::ChannelPool::rebalance();
+        //   int btlmt::ChannelPool::eventManagerIndex(int *, int) const;
+        //   CONCERN: Channel migration and rebalancing
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING CHANNEL MIGRATION"
+                 << "\n=========================" << endl;
+
+        using namespace TEST_CASE_CHANNEL_MIGRATION;
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(k_NUM_THREADS);
+
+        bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+        {
+            State state(&ta);
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                        bdlf::BindUtil::bind(&channelStateCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+            btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                        bdlf::BindUtil::bind(&blobBasedReadCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+            btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                                                &poolStateCb);
+
+            btlmt::ChannelPool pool(channelCb, dataCb, poolCb, config, &ta);
+            state.d_pool_p = &pool;
+
+            ASSERT(0 == pool.start());
+
+            const btlso::IPv4Address ENDPOINT("127.0.0.1", 0);
+
+            int rc = pool.listen(ENDPOINT, k_NUM_CLIENTS, k_SERVER_ID);
+            LOOP_ASSERT(rc, 0 == rc);
+
+            btlso::IPv4Address server;
+            ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+
+            for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                rc = pool.connect(server,
+                                  1,
+                                  bsls::TimeInterval(1.0),
+                                  k_CLIENT_ID + i);
+                LOOP2_ASSERT(i, rc, 0 == rc);
+            }
+
+            for (int i = 0; i < 2 * k_NUM_CLIENTS; ++i) {
+                state.d_upSemaphore.wait();
+            }
+            ASSERT(k_NUM_CLIENTS == state.d_clientChannelIds.size());
+            ASSERT(k_NUM_CLIENTS == state.d_serverChannelIds.size());
+
+            bsl::vector<int> channelIds(state.d_clientChannelIds, &ta);
+            channelIds.insert(channelIds.end(),
+                              state.d_serverChannelIds.begin(),
+                              state.d_serverChannelIds.end());
+
+            const int NUM_CHANNELS = static_cast<int>(channelIds.size());
+
+            if (verbose) cout << "\tTesting 'eventManagerIndex'." << endl;
+            {
+                for (int i = 0; i < NUM_CHANNELS; ++i) {
+                    int index = -1;
+                    rc = pool.eventManagerIndex(&index, channelIds[i]);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+                    LOOP2_ASSERT(i, index, 0 <= index);
+                    LOOP2_ASSERT(i, index, k_NUM_THREADS > index);
+                }
+
+                int index = -1;
+                ASSERT(0 != pool.eventManagerIndex(&index, -1));
+                ASSERT(-1 == index);
+            }
+
+            if (verbose) cout << "\tTesting 'pinChannel'." << endl;
+            {
+                ASSERT(0 != pool.pinChannel(channelIds[0], -1));
+                ASSERT(0 != pool.pinChannel(channelIds[0], k_NUM_THREADS));
+                ASSERT(0 != pool.pinChannel(-1, 0));
+                ASSERT(0 != pool.unpinChannel(-1));
+
+                for (int i = 0; i < NUM_CHANNELS; ++i) {
+                    rc = pool.pinChannel(channelIds[i], 0);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+                }
+                for (int i = 0; i < NUM_CHANNELS; ++i) {
+                    waitForIndex(pool, channelIds[i], 0);
+                }
+            }
+
+            const int k_LENGTH = 100 * 1000;
+
+            bsl::string message(&ta);
+            message.reserve(k_LENGTH);
+            for (int i = 0; i < k_LENGTH; ++i) {
+                message.push_back(static_cast<char>('a' + i % 26));
+            }
+
+            if (verbose) cout << "\tTesting 'rebalance'." << endl;
+            {
+                echoAll(&state, message, 1);
+
+                // Keep the first server channel pinned.
+
+                const int PINNED = state.d_serverChannelIds[0];
+
+                for (int i = 0; i < NUM_CHANNELS; ++i) {
+                    if (PINNED != channelIds[i]) {
+                        ASSERT(0 == pool.unpinChannel(channelIds[i]));
+                    }
+                }
+
+                rc = pool.rebalance();
+                LOOP_ASSERT(rc, 0 < rc);
+                LOOP_ASSERT(rc, NUM_CHANNELS > rc);
+
+                // Wait for the migrations to take effect.
+
+                int numMigrated = 0;
+                for (int j = 0; j < 1000 && numMigrated < rc; ++j) {
+                    numMigrated = 0;
+                    for (int i = 0; i < NUM_CHANNELS; ++i) {
+                        int index = -1;
+                        ASSERT(0 == pool.eventManagerIndex(&index,
+                                                           channelIds[i]));
+                        if (0 != index) {
+                            ++numMigrated;
+                        }
+                    }
+                    bslmt::ThreadUtil::microSleep(1000);
+                }
+                LOOP2_ASSERT(rc, numMigrated, rc == numMigrated);
+
+                int index = -1;
+                ASSERT(0 == pool.eventManagerIndex(&index, PINNED));
+                LOOP_ASSERT(index, 0 == index);
+
+                rc = pool.rebalance();
+                LOOP_ASSERT(rc, 0 == rc);
+            }
+
+            if (verbose) cout << "\tEchoing after migration." << endl;
+            {
+                echoAll(&state, message, 2);
+
+                bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    const bsl::string& echoed =
+                                 state.d_echoed[state.d_clientChannelIds[i]];
+                    LOOP2_ASSERT(i, echoed.length(),
+                                 message + message == echoed);
+
+                    const int serverId = state.d_serverChannelIds[i];
+                    LOOP_ASSERT(i, bslmt::ThreadUtil::isEqual(
+                                            state.d_readThreads[serverId],
+                                            dispatcherThread(pool, serverId)));
+                }
+            }
+
+            if (verbose) cout << "\tMigrating while writing." << endl;
+            {
+                const int CLIENT = state.d_clientChannelIds[0];
+
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+                    state.d_echoed[CLIENT].clear();
+                }
+
+                const int k_NUM_CHUNKS = 30;
+                const int k_CHUNK_LENGTH = 10 * 1000;
+
+                bsl::string expected(&ta);
+
+                btlb::PooledBlobBufferFactory factory(4096, &ta);
+
+                for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+                    rc = pool.pinChannel(CLIENT, i % k_NUM_THREADS);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+
+                    bsl::string chunk(k_CHUNK_LENGTH,
+                                      static_cast<char>('A' + i % 26),
+                                      &ta);
+                    expected.append(chunk);
+
+                    btlb::Blob blob(&factory, &ta);
+                    btlb::BlobUtil::append(&blob,
+                                           chunk.data(),
+                                           k_CHUNK_LENGTH);
+
+                    rc = pool.write(CLIENT, blob);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+                }
+
+                bool done = false;
+                while (!done) {
+                    state.d_echoSemaphore.wait();
+
+                    bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+
+                    done = expected.length()
+                                       <= state.d_echoed[CLIENT].length();
+                }
+
+                bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+                LOOP_ASSERT(state.d_echoed[CLIENT].length(),
+                            expected == state.d_echoed[CLIENT]);
+                ASSERT(!state.d_concurrentCallbacks);
+            }
+
+            if (verbose) cout << "\tMigrating a channel-bound clock." << endl;
+            {
+                const int SERVER = state.d_serverChannelIds[1];
+                const int k_CLOCK_ID = 1;
+
+                rc = pool.registerClock(
+                                 bdlf::BindUtil::bind(&clockCb, &state),
+                                 bdlt::CurrentTime::now(),
+                                 bsls::TimeInterval(0.01),
+                                 k_CLOCK_ID,
+                                 SERVER);
+                LOOP_ASSERT(rc, 0 == rc);
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == pool.pinChannel(SERVER, i));
+                    waitForIndex(pool, SERVER, i);
+
+                    // The occurrence already scheduled when the channel
+                    // migrated may still run in the previous thread.
+
+                    while (0 == state.d_clockSemaphore.tryWait()) {
+                    }
+                    for (int j = 0; j < 3; ++j) {
+                        state.d_clockSemaphore.wait();
+                    }
+
+                    bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+                    LOOP_ASSERT(i, bslmt::ThreadUtil::isEqual(
+                                              state.d_clockThread,
+                                              dispatcherThread(pool, SERVER)));
+                }
+
+                pool.deregisterClock(k_CLOCK_ID);
+            }
+
+            ASSERT(0 == pool.stop());
+        }
+        LOOP_ASSERT(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+}
+
+void TestDriver::testCase40()
+{
+        // --------------------------------------------------------------------
+        // TESTING ZERO-COPY WRITES
+        //
+        // Concerns:
+        //: 1 'setZeroCopyThreshold' fails for an unknown channel, and, where
+        //:   zero copy is supported, succeeds for a TCP channel.
+        //:
+        //: 2 Messages written with zero copy are delivered completely and in
+        //:   order, including when interleaved with smaller messages written
+        //:   with the regular path.
+        //:
+        //: 3 The blob buffers of a message written with zero copy are
+        //:   released once the kernel reports the completion of the write.
+        //:
+        //: 4 Zero copy can be disabled again.
+        //:
+        //: 5 The blob buffers of a message written with zero copy are
+        //:   released while neither reading nor writing is active on the
+        //:   channel.
+        //:
+        //: 6 The blob buffers of a message written with zero copy are
+        //:   released once the write completes, also when the channel is shut
+        //:   down right after the write, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Connect several clients to an echo server, and set a zero-copy
+        //:   threshold on every channel.  (C-1)
+        //:
+        //: 2 On each client, write a small message, a large message whose
+        //:   first buffer is observed through a weak pointer, and another
+        //:   small message.  Verify the data echoed back, then wait until the
+        //:   observed buffer is released.  (C-2..3)
+        //:
+        //: 3 Reset the threshold to 0 and repeat.  (C-4)
+        //:
+        //: 4 Stop echoing on the server, set the threshold again, and disable
+        //:   reading on the clients.  Write a large message on each client,
+        //:   and wait until its observed buffer is released.  Then enable
+        //:   reading again.  (C-5)
+        //:
+        //: 5 Write a large message on each client and immediately shut the
+        //:   client channel down.  Wait until the observed buffer is released,
+        //:   then stop the pool and verify that no memory is in use.  (C-6)
+        //
+        // Testing:
+        //   int btlmt::ChannelPool::setZeroCopyThreshold(int, int);
+        //   CONCERN: Zero-copy writes
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING ZERO-COPY WRITES"
+                 << "\n========================" << endl;
+
+        using namespace TEST_CASE_ZERO_COPY;
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(2);
+
+        bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+        {
+            State state(&ta);
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                        bdlf::BindUtil::bind(&channelStateCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+            btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                        bdlf::BindUtil::bind(&blobBasedReadCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+            btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                                                &poolStateCb);
+
+            btlmt::ChannelPool pool(channelCb, dataCb, poolCb, config, &ta);
+            state.d_pool_p = &pool;
+
+            ASSERT(0 == pool.start());
+
+            const btlso::IPv4Address ENDPOINT("127.0.0.1", 0);
+
+            int rc = pool.listen(ENDPOINT, k_NUM_CLIENTS, k_SERVER_ID);
+            LOOP_ASSERT(rc, 0 == rc);
+
+            btlso::IPv4Address server;
+            ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+
+            for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                rc = pool.connect(server,
+                                  1,
+                                  bsls::TimeInterval(1.0),
+                                  k_CLIENT_ID + i);
+                LOOP2_ASSERT(i, rc, 0 == rc);
+            }
+
+            for (int i = 0; i < 2 * k_NUM_CLIENTS; ++i) {
+                state.d_upSemaphore.wait();
+            }
+            ASSERT(k_NUM_CLIENTS == state.d_clientChannelIds.size());
+            ASSERT(k_NUM_CLIENTS == state.d_serverChannelIds.size());
+
+            const int k_THRESHOLD = 64 * 1024;
+
+            ASSERT(0 != pool.setZeroCopyThreshold(-1, k_THRESHOLD));
+
+            bool zeroCopy = true;
+            for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                rc = pool.setZeroCopyThreshold(state.d_clientChannelIds[i],
+                                               k_THRESHOLD);
+                zeroCopy = zeroCopy && 0 == rc;
+
+                rc = pool.setZeroCopyThreshold(state.d_serverChannelIds[i],
+                                               k_THRESHOLD);
+                zeroCopy = zeroCopy && 0 == rc;
+            }
+            if (verbose) { P(zeroCopy) }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(zeroCopy);
+#endif
+
+            const int k_SMALL_LENGTH = 100;
+            const int k_LARGE_LENGTH = 1024 * 1024;
+
+            bsl::string small(&ta);
+            for (int i = 0; i < k_SMALL_LENGTH; ++i) {
+                small.push_back(static_cast<char>('A' + i % 26));
+            }
+
+            bsl::string large(&ta);
+            large.reserve(k_LARGE_LENGTH);
+            for (int i = 0; i < k_LARGE_LENGTH; ++i) {
+                large.push_back(static_cast<char>('a' + i % 26));
+            }
+
+            const bsl::string MESSAGE = small + large + small;
+            const int         LENGTH  = static_cast<int>(MESSAGE.length());
+
+            btlb::PooledBlobBufferFactory factory(4096, &ta);
+
+            for (int round = 1; round <= 2; ++round) {
+                if (verbose) { P(round) }
+
+                if (2 == round) {
+                    for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                        ASSERT(0 == pool.setZeroCopyThreshold(
+                                                  state.d_clientChannelIds[i],
+                                                  0));
+                        ASSERT(0 == pool.setZeroCopyThreshold(
+                                                  state.d_serverChannelIds[i],
+                                                  0));
+                    }
+                }
+
+                bsl::vector<bsl::weak_ptr<char> > observed(&ta);
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    const int channelId = state.d_clientChannelIds[i];
+
+                    btlb::Blob blob(&factory, &ta);
+
+                    btlb::BlobUtil::append(&blob,
+                                           small.data(),
+                                           k_SMALL_LENGTH);
+                    rc = pool.write(channelId, blob);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+
+                    blob.removeAll();
+                    btlb::BlobUtil::append(&blob,
+                                           large.data(),
+                                           k_LARGE_LENGTH);
+                    observed.push_back(blob.buffer(0).buffer());
+                    rc = pool.write(channelId, blob);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+
+                    blob.removeAll();
+                    btlb::BlobUtil::append(&blob,
+                                           small.data(),
+                                           k_SMALL_LENGTH);
+                    rc = pool.write(channelId, blob);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+                }
+
+                bool done = false;
+                while (!done) {
+                    state.d_echoSemaphore.wait();
+
+                    bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+
+                    done = true;
+                    for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                        const bsl::string& echoed =
+                                 state.d_echoed[state.d_clientChannelIds[i]];
+                        if (LENGTH > static_cast<int>(echoed.length())) {
+                            done = false;
+                        }
+                    }
+                }
+
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+
+                    for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                        bsl::string& echoed =
+                                 state.d_echoed[state.d_clientChannelIds[i]];
+                        LOOP2_ASSERT(i, echoed.length(), MESSAGE == echoed);
+                        echoed.clear();
+                    }
+                }
+
+                // The buffers of a zero-copy write are released once the
+                // completion is processed, i.e., possibly after the data was
+                // echoed back.
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    for (int j = 0; j < 5000 && !observed[i].expired(); ++j) {
+                        bslmt::ThreadUtil::microSleep(1000);
+                    }
+                    LOOP2_ASSERT(round, i, observed[i].expired());
+                }
+            }
+
+            if (verbose) cout << "\tReleasing with idle reads and writes."
+                              << endl;
+            {
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+                    state.d_echoFlag = false;
+                }
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    const int channelId = state.d_clientChannelIds[i];
+
+                    rc = pool.setZeroCopyThreshold(channelId, k_THRESHOLD);
+                    LOOP2_ASSERT(i, rc, 0 == rc || !zeroCopy);
+
+                    ASSERT(0 == pool.disableRead(channelId));
+                }
+
+                bsl::vector<bsl::weak_ptr<char> > observed(&ta);
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    btlb::Blob blob(&factory, &ta);
+
+                    btlb::BlobUtil::append(&blob,
+                                           large.data(),
+                                           k_LARGE_LENGTH);
+                    observed.push_back(blob.buffer(0).buffer());
+                    rc = pool.write(state.d_clientChannelIds[i], blob);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+                }
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    for (int j = 0; j < 5000 && !observed[i].expired(); ++j) {
+                        bslmt::ThreadUtil::microSleep(1000);
+                    }
+                    LOOP_ASSERT(i, observed[i].expired());
+
+                    ASSERT(0 == pool.enableRead(state.d_clientChannelIds[i]));
+                }
+            }
+
+            if (verbose) cout << "\tReleasing after shutdown." << endl;
+            {
+                bsl::vector<bsl::weak_ptr<char> > observed(&ta);
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    const int channelId = state.d_clientChannelIds[i];
+
+                    btlb::Blob blob(&factory, &ta);
+
+                    btlb::BlobUtil::append(&blob,
+                                           large.data(),
+                                           k_LARGE_LENGTH);
+                    observed.push_back(blob.buffer(0).buffer());
+                    rc = pool.write(channelId, blob);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+
+                    ASSERT(0 == pool.shutdown(channelId));
+                }
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    for (int j = 0; j < 5000 && !observed[i].expired(); ++j) {
+                        bslmt::ThreadUtil::microSleep(1000);
+                    }
+                    LOOP_ASSERT(i, observed[i].expired());
+                }
+            }
+
+            ASSERT(0 == pool.stop());
+        }
+        LOOP_ASSERT(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+}
+
+void TestDriver::testCase41()
+{
+        // --------------------------------------------------------------------
+        // TESTING 'io_uring' EVENTS
+        //
+        // Concerns:
+        //: 1 With 'ioUringEvents' set, a pool accepts connections, and
+        //:   delivers messages larger than a single read buffer or socket
+        //:   buffer completely and in order in both directions.
+        //:
+        //: 2 'edgeTriggeredEvents' does not affect a pool using 'io_uring'
+        //:   event managers.
+        //:
+        //: 3 The time metrics of the event managers are collected, so that
+        //:   'busyMetrics' reports a valid percentage.
+        //:
+        //: 4 If 'io_uring' is not available, the pool falls back to its
+        //:   default event managers.
+        //:
+        //: 5 No memory is leaked, i.e., the 'io_uring' event managers and
+        //:   their time metrics are destroyed with the pool.
+        //:
+        //: 6 With 'io_uring' event managers, channels read and write through
+        //:   the rings, without registering socket events, and zero-copy
+        //:   writes cannot be enabled.
+        //:
+        //: 7 Channels migrated while ring reads and writes are pending
+        //:   resume them with their new event managers, without losing or
+        //:   reordering data.
+        //
+        // Plan:
+        //: 1 For each of 'edgeTriggeredEvents' 'false' and 'true', create a
+        //:   pool with 'ioUringEvents' set, listen on the loopback interface,
+        //:   connect several clients, write a large message on each client
+        //:   channel, echo it back from the server channels, and verify each
+        //:   client receives exactly the data it sent.  (C-1..2, 4)
+        //:
+        //: 2 Verify that 'busyMetrics' is in the range '[0 .. 100]'.  (C-3)
+        //:
+        //: 3 Verify that the test allocator has no memory in use after the
+        //:   pool is destroyed.  (C-5)
+        //:
+        //: 4 If 'io_uring' is supported, verify that once all the channels
+        //:   are up, the event managers have no more events registered than
+        //:   the read timeouts of the channels, the listening socket, and the
+        //:   metrics timer, and that 'setZeroCopyThreshold' fails.  (C-6)
+        //:
+        //: 5 Right after writing the messages, pin each client channel to
+        //:   each event manager in turn, so that channels are migrated (some
+        //:   twice) while their transfers are in progress.  (C-7)
+        //
+        // Testing:
+        //   CONCERN: 'io_uring' events
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING 'io_uring' EVENTS"
+                 << "\n=========================" << endl;
+
+        using namespace TEST_CASE_EDGE_TRIGGERED;
+
+        bool isSupported = false;
+#ifdef BSLS_PLATFORM_OS_LINUX
+        isSupported = btlso::DefaultEventManager<btlso::Platform::IOURING>::
+                                                                 isSupported();
+#endif
+
+        if (verbose) {
+            cout << "\t'io_uring' is " << (isSupported ? "" : "NOT ")
+                 << "supported." << endl;
+        }
+
+        const int k_LENGTH = 100 * 1000;
+
+        for (int edgeTriggered = 0; edgeTriggered < 2; ++edgeTriggered) {
+            if (verbose) {
+                cout << "\tWith 'edgeTriggeredEvents' " << edgeTriggered
+                     << "." << endl;
+            }
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(2);
+            config.setCollectTimeMetrics(true);
+            config.setIoUringEvents(true);
+            config.setEdgeTriggeredEvents(edgeTriggered);
+
+            bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+            {
+                State state(&ta);
+
+                btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                        bdlf::BindUtil::bind(&channelStateCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+                btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                        bdlf::BindUtil::bind(&blobBasedReadCb,
+                                                             _1, _2, _3, _4,
+                                                             &state));
+                btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                                                &poolStateCb);
+
+                btlmt::ChannelPool pool(channelCb,
+                                        dataCb,
+                                        poolCb,
+                                        config,
+                                        &ta);
+                state.d_pool_p = &pool;
+
+                ASSERT(0 == pool.start());
+
+                const btlso::IPv4Address ENDPOINT("127.0.0.1", 0);
+
+                int rc = pool.listen(ENDPOINT, k_NUM_CLIENTS, k_SERVER_ID);
+                LOOP_ASSERT(rc, 0 == rc);
+
+                btlso::IPv4Address server;
+                ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    rc = pool.connect(server,
+                                      1,
+                                      bsls::TimeInterval(1.0),
+                                      k_CLIENT_ID + i);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+                }
+
+                for (int i = 0; i < 2 * k_NUM_CLIENTS; ++i) {
+                    state.d_upSemaphore.wait();
+                }
+                LOOP_ASSERT(state.d_clientChannelIds.size(),
+                            k_NUM_CLIENTS == state.d_clientChannelIds.size());
+
+                if (isSupported) {
+                    // Each channel registers only its read timeout, and the
+                    // pool its listening socket and its metrics timer.
+
+                    int numEvents = 0;
+                    for (int i = 0; i < pool.numThreads(); ++i) {
+                        numEvents += pool.numEvents(i);
+                    }
+                    LOOP_ASSERT(numEvents, 2 * k_NUM_CLIENTS + 2 >= numEvents);
+
+                    const int channelId = state.d_clientChannelIds[0];
+                    ASSERT(0 != pool.setZeroCopyThreshold(channelId, 1));
+                }
+
+                bsl::string message(&ta);
+                message.reserve(k_LENGTH);
+                for (int i = 0; i < k_LENGTH; ++i) {
+                    message.push_back(static_cast<char>('a' + i % 26));
+                }
+
+                btlb::PooledBlobBufferFactory factory(4096, &ta);
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    btlb::Blob blob(&factory, &ta);
+                    btlb::BlobUtil::append(&blob, message.data(), k_LENGTH);
+
+                    rc = pool.write(state.d_clientChannelIds[i], blob);
+                    LOOP2_ASSERT(i, rc, 0 == rc);
+                }
+
+                for (int j = 0; j < pool.numThreads(); ++j) {
+                    for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                        rc = pool.pinChannel(state.d_clientChannelIds[i], j);
+                        LOOP3_ASSERT(i, j, rc, 0 == rc);
+                    }
+                }
+
+                bool done = false;
+                while (!done) {
+                    state.d_echoSemaphore.wait();
+
+                    bslmt::LockGuard<bslmt::Mutex> guard(&state.d_mutex);
+
+                    done = true;
+                    for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                        const bsl::string& echoed =
+                                  state.d_echoed[state.d_clientChannelIds[i]];
+                        if (k_LENGTH > static_cast<int>(echoed.length())) {
+                            done = false;
+                        }
+                    }
+                }
+
+                for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                    const bsl::string& echoed =
+                                  state.d_echoed[state.d_clientChannelIds[i]];
+                    LOOP2_ASSERT(i, echoed.length(), message == echoed);
+                }
+
+                const int busy = pool.busyMetrics();
+                LOOP_ASSERT(busy, 0 <= busy && busy <= 100);
+
+                ASSERT(0 == pool.stop());
+            }
+            LOOP_ASSERT(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+        }
+}
+
+void TestDriver::testCase42()
 {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -15232,6 +16917,11 @@ int main(int argc, char **argv)
 
     switch (test) { case 0:  // Zero is always the leading case.
 #define CASE(NUMBER) case NUMBER: TestDriver::testCase##NUMBER(); break
+      CASE(42);
+      CASE(41);
+      CASE(40);
+      CASE(39);
+      CASE(38);
       CASE(37);
       CASE(36);
       CASE(35);
@@ -128,6 +128,27 @@ const bdlat_AttributeInfo
         sizeof("CollectTimeMetrics") - 1,      // name length
         "",// annotation
         bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_EDGE_TRIGGERED_EVENTS,
+        "EdgeTriggeredEvents",                 // name
+        sizeof("EdgeTriggeredEvents") - 1,     // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_REBALANCE_INTERVAL,
+        "RebalanceInterval",                   // name
+        sizeof("RebalanceInterval") - 1,       // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_IO_URING_EVENTS,
+        "IoUringEvents",                       // name
+        sizeof("IoUringEvents") - 1,           // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
     }
 };
 
@@ -170,6 +191,24 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
                                                                       // RETURN
         }
       } break;
+      case 13: {
+        if (bsl::toupper(name[0])=='I'
+         && bsl::toupper(name[1])=='O'
+         && bsl::toupper(name[2])=='U'
+         && bsl::toupper(name[3])=='R'
+         && bsl::toupper(name[4])=='I'
+         && bsl::toupper(name[5])=='N'
+         && bsl::toupper(name[6])=='G'
+         && bsl::toupper(name[7])=='E'
+         && bsl::toupper(name[8])=='V'
+         && bsl::toupper(name[9])=='E'
+         && bsl::toupper(name[10])=='N'
+         && bsl::toupper(name[11])=='T'
+         && bsl::toupper(name[12])=='S') {
+            return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_IO_URING_EVENTS];
+                                                                      // RETURN
+        }
+      } break;
       case 14: {
         if (bsl::toupper(name[0])=='M'
          && bsl::toupper(name[1])=='A'
@@ -455,6 +494,28 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
                                                                       // RETURN
             }
           } break;
+          case 'R': {
+            if (bsl::toupper(name[1])=='E'
+             && bsl::toupper(name[2])=='B'
+             && bsl::toupper(name[3])=='A'
+             && bsl::toupper(name[4])=='L'
+             && bsl::toupper(name[5])=='A'
+             && bsl::toupper(name[6])=='N'
+             && bsl::toupper(name[7])=='C'
+             && bsl::toupper(name[8])=='E'
+             && bsl::toupper(name[9])=='I'
+             && bsl::toupper(name[10])=='N'
+             && bsl::toupper(name[11])=='T'
+             && bsl::toupper(name[12])=='E'
+             && bsl::toupper(name[13])=='R'
+             && bsl::toupper(name[14])=='V'
+             && bsl::toupper(name[15])=='A'
+             && bsl::toupper(name[16])=='L') {
+                return
+                 &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REBALANCE_INTERVAL];
+                                                                      // RETURN
+            }
+          } break;
         }
       } break;
       case 18: {
@@ -481,6 +542,31 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
                                                                       // RETURN
         }
       } break;
+      case 19: {
+        if (bsl::toupper(name[0])=='E'
+         && bsl::toupper(name[1])=='D'
+         && bsl::toupper(name[2])=='G'
+         && bsl::toupper(name[3])=='E'
+         && bsl::toupper(name[4])=='T'
+         && bsl::toupper(name[5])=='R'
+         && bsl::toupper(name[6])=='I'
+         && bsl::toupper(name[7])=='G'
+         && bsl::toupper(name[8])=='G'
+         && bsl::toupper(name[9])=='E'
+         && bsl::toupper(name[10])=='R'
+         && bsl::toupper(name[11])=='E'
+         && bsl::toupper(name[12])=='D'
+         && bsl::toupper(name[13])=='E'
+         && bsl::toupper(name[14])=='V'
+         && bsl::toupper(name[15])=='E'
+         && bsl::toupper(name[16])=='N'
+         && bsl::toupper(name[17])=='T'
+         && bsl::toupper(name[18])=='S') {
+            return &ATTRIBUTE_INFO_ARRAY[
+                                      e_ATTRIBUTE_INDEX_EDGE_TRIGGERED_EVENTS];
+                                                                      // RETURN
+        }
+      } break;
     }
     return 0;
 }
@@ -543,6 +629,18 @@ ChannelPoolConfiguration::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS];
                                                                       // RETURN
       }
+      case e_ATTRIBUTE_ID_EDGE_TRIGGERED_EVENTS: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EDGE_TRIGGERED_EVENTS];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_REBALANCE_INTERVAL: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REBALANCE_INTERVAL];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_IO_URING_EVENTS: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_IO_URING_EVENTS];
+                                                                      // RETURN
+      }
 
       default:
         return 0;                                                     // RETURN
@@ -565,6 +663,9 @@ ChannelPoolConfiguration::ChannelPoolConfiguration()
 , d_maxMessageSizeIn(1024)
 , d_threadStackSize(k_DEFAULT_THREAD_STACK_SIZE)
 , d_collectTimeMetrics(true)
+, d_edgeTriggeredEvents(false)
+, d_rebalanceInterval(0)
+, d_ioUringEvents(false)
 {
 }
 
@@ -584,6 +685,9 @@ ChannelPoolConfiguration::ChannelPoolConfiguration(
 , d_maxMessageSizeIn(original.d_maxMessageSizeIn)
 , d_threadStackSize(original.d_threadStackSize)
 , d_collectTimeMetrics(original.d_collectTimeMetrics)
+, d_edgeTriggeredEvents(original.d_edgeTriggeredEvents)
+, d_rebalanceInterval(original.d_rebalanceInterval)
+, d_ioUringEvents(original.d_ioUringEvents)
 {
 }
 
@@ -595,6 +699,7 @@ ChannelPoolConfiguration::~ChannelPoolConfiguration()
     BSLS_ASSERT(0 <= d_writeQueueHighWater);
     BSLS_ASSERT(0 <= d_readTimeout);
     BSLS_ASSERT(0 <= d_metricsInterval);
+    BSLS_ASSERT(0 <= d_rebalanceInterval);
     BSLS_ASSERT(0 <= d_minMessageSizeOut
              && d_minMessageSizeOut <= d_typMessageSizeOut
              && d_typMessageSizeOut <= d_maxMessageSizeOut);
@@ -623,6 +728,9 @@ ChannelPoolConfiguration::operator=(const ChannelPoolConfiguration& rhs)
         d_maxMessageSizeIn   = rhs.d_maxMessageSizeIn;
         d_threadStackSize    = rhs.d_threadStackSize;
         d_collectTimeMetrics = rhs.d_collectTimeMetrics;
+        d_edgeTriggeredEvents = rhs.d_edgeTriggeredEvents;
+        d_rebalanceInterval  = rhs.d_rebalanceInterval;
+        d_ioUringEvents      = rhs.d_ioUringEvents;
     }
     return *this;
 }
@@ -646,7 +754,10 @@ bool btlmt::operator==(const ChannelPoolConfiguration& lhs,
         && lhs.d_typMessageSizeIn   == rhs.d_typMessageSizeIn
         && lhs.d_maxMessageSizeIn   == rhs.d_maxMessageSizeIn
         && lhs.d_threadStackSize    == rhs.d_threadStackSize
-        && lhs.d_collectTimeMetrics == rhs.d_collectTimeMetrics;
+        && lhs.d_collectTimeMetrics == rhs.d_collectTimeMetrics
+        && lhs.d_edgeTriggeredEvents == rhs.d_edgeTriggeredEvents
+        && lhs.d_rebalanceInterval  == rhs.d_rebalanceInterval
+        && lhs.d_ioUringEvents      == rhs.d_ioUringEvents;
 }
 
 bsl::ostream& btlmt::operator<<(bsl::ostream&                   output,
@@ -669,6 +780,12 @@ bsl::ostream& btlmt::operator<<(bsl::ostream&                   output,
            << "\tmaxIncomingMessageSize : " << config.d_maxMessageSizeIn <<"\n"
            << "\tthreadStackSize        : " << config.d_threadStackSize  <<"\n"
            << "\tcollectTimeMetrics     : " << config.d_collectTimeMetrics
+                                                                       <<"\n"
+           << "\tedgeTriggeredEvents    : " << config.d_edgeTriggeredEvents
+                                                                       <<"\n"
+           << "\trebalanceInterval      : " << config.d_rebalanceInterval
+                                                                       <<"\n"
+           << "\tioUringEvents          : " << config.d_ioUringEvents
            << "\n]\n";
 
     return output;
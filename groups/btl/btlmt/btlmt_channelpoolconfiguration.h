@@ -85,6 +85,39 @@ BSLS_IDENT("$Id: $")
 //                               processing data, and if this value
 //                               is 'false', those metrics will not
 //                               be collected.
+//
+//   bool    edgeTriggeredEvents indicates whether the configured         false
+//                               channel pool will monitor its
+//                               sockets with edge-triggered event
+//                               managers, where supported (i.e.,
+//                               'epoll' on Linux).  If this value is
+//                               'true', a socket is reported only
+//                               when it becomes ready, and the
+//                               channel pool drains each socket
+//                               (until the operation would block)
+//                               whenever it is reported.
+//
+//   double  rebalanceInterval   interval at which the configured             0
+//                               channel pool migrates channels
+//                               between its event managers to
+//                               balance their I/O load; if this
+//                               value is 0, channels are never
+//                               migrated automatically.
+//
+//   bool    ioUringEvents       indicates whether the configured         false
+//                               channel pool will monitor its
+//                               sockets with 'io_uring' event
+//                               managers, where supported (i.e.,
+//                               on Linux kernels providing
+//                               'io_uring').  If this value is
+//                               'true' but 'io_uring' is not
+//                               available, the channel pool falls
+//                               back to its default event managers
+//                               (e.g., 'epoll' on Linux).  Note that
+//                               channels then read and write
+//                               through the rings of the event
+//                               managers, and that
+//                               'edgeTriggeredEvents' is ignored.
 //..
 // The constraints are as follows:
 //..
@@ -101,6 +134,8 @@ BSLS_IDENT("$Id: $")
 //   +--------------------+---------------------------------------------+
 //   | metricsInterval    | 0 <= metricsInterval                        |
 //   +--------------------+---------------------------------------------+
+//   | rebalanceInterval  | 0 <= rebalanceInterval                      |
+//   +--------------------+---------------------------------------------+
 //   | minMessageSizeOut  | 0 <= minMessageSizeOut <= typMessageSizeOut |
 //   | typMessageSizeOut  |   <= maxMessageSizeOut                      |
 //   | maxMessageSizeOut  |                                             |
@@ -199,6 +234,9 @@ BSLS_IDENT("$Id: $")
 //         maxIncomingMessageSize : 3
 //         threadStackSize        : 1024
 //         collectTimeMetrics     : 1
+//         edgeTriggeredEvents    : 0
+//         rebalanceInterval      : 0
+//         ioUringEvents          : 0
 // ]
 //..
 
@@ -300,6 +338,17 @@ class ChannelPoolConfiguration {
 
     bool                  d_collectTimeMetrics;
 
+    bool                  d_edgeTriggeredEvents;
+                                               // use edge-triggered event
+                                               // managers if supported
+
+    double                d_rebalanceInterval; // interval for migrating
+                                               // channels between event
+                                               // managers (0 if disabled)
+
+    bool                  d_ioUringEvents;     // use 'io_uring' event
+                                               // managers if supported
+
     friend bsl::ostream& operator<<(bsl::ostream&,
                                     const ChannelPoolConfiguration&);
 
@@ -309,7 +358,7 @@ class ChannelPoolConfiguration {
   public:
     // TYPES
     enum {
-        k_NUM_ATTRIBUTES = 14 // the number of attributes in this class
+        k_NUM_ATTRIBUTES = 17 // the number of attributes in this class
 
 
     };
@@ -354,9 +403,18 @@ class ChannelPoolConfiguration {
         e_ATTRIBUTE_INDEX_THREAD_STACK_SIZE    = 12,
             // index for 'ThreadStackSize' attribute
 
-        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS = 13
+        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS = 13,
             // index for 'CollectTimeMetrics' attribute
 
+        e_ATTRIBUTE_INDEX_EDGE_TRIGGERED_EVENTS = 14,
+            // index for 'EdgeTriggeredEvents' attribute
+
+        e_ATTRIBUTE_INDEX_REBALANCE_INTERVAL   = 15,
+            // index for 'RebalanceInterval' attribute
+
+        e_ATTRIBUTE_INDEX_IO_URING_EVENTS      = 16
+            // index for 'IoUringEvents' attribute
+
 
     };
 
@@ -400,9 +458,18 @@ class ChannelPoolConfiguration {
         e_ATTRIBUTE_ID_THREAD_STACK_SIZE       = 13,
             // id for 'ThreadStackSize' attribute
 
-        e_ATTRIBUTE_ID_COLLECT_TIME_METRICS    = 14
+        e_ATTRIBUTE_ID_COLLECT_TIME_METRICS    = 14,
             // id for 'CollectTimeMetrics' attribute
 
+        e_ATTRIBUTE_ID_EDGE_TRIGGERED_EVENTS   = 15,
+            // id for 'EdgeTriggeredEvents' attribute
+
+        e_ATTRIBUTE_ID_REBALANCE_INTERVAL      = 16,
+            // id for 'RebalanceInterval' attribute
+
+        e_ATTRIBUTE_ID_IO_URING_EVENTS         = 17
+            // id for 'IoUringEvents' attribute
+
 
     };
 
@@ -506,6 +573,34 @@ class ChannelPoolConfiguration {
         // estimate of work-load when it attempts to distribute work amongst
         // its managed threads.
 
+    int setEdgeTriggeredEvents(bool edgeTriggeredEventsFlag);
+        // Set to the specified 'edgeTriggeredEventsFlag' whether the
+        // configured channel pool will monitor its sockets with
+        // edge-triggered event managers, where the platform supports them.
+        // Return 0.  Note that edge-triggered event managers report a socket
+        // only when it becomes ready, reducing the number of wakeups and
+        // event-registration system calls when there are many busy
+        // connections, and that the channel pool then reads, writes, and
+        // accepts on each reported socket until the operation would block.
+
+    int setRebalanceInterval(double rebalanceInterval);
+        // Set the rebalance interval attribute of this object to the specified
+        // 'rebalanceInterval' value if '0 <= rebalanceInterval'.  Return 0 on
+        // success, and a non-zero value (with no effect on the state of this
+        // object) otherwise.  A value of 0 disables the periodic migration of
+        // channels between the event managers of the configured channel pool.
+
+    int setIoUringEvents(bool ioUringEventsFlag);
+        // Set to the specified 'ioUringEventsFlag' whether the configured
+        // channel pool will monitor its sockets with 'io_uring' event
+        // managers, where the kernel supports them.  Return 0.  Note that
+        // the channels of such a channel pool submit their reads and writes
+        // to the ring of their 'io_uring' event manager, without a system
+        // call, and that the channel pool falls back to its default event
+        // managers if 'io_uring' is not available.  Also note that
+        // 'edgeTriggeredEvents' is ignored if 'io_uring' event managers are
+        // used.
+
     template<class MANIPULATOR>
     int manipulateAttributes(MANIPULATOR& manipulator);
         // Invoke the specified 'manipulator' sequentially on the address of
@@ -568,9 +663,24 @@ class ChannelPoolConfiguration {
         // pool cannot use that estimate of work-load when it attempts to
         // distribute work amongst its managed threads.
 
+    bool edgeTriggeredEvents() const;
+        // Return 'true' if the configured channel pool will monitor its
+        // sockets with edge-triggered event managers where supported, and
+        // 'false' otherwise.
+
     const double& metricsInterval() const;
         // Return the metrics interval attribute of this object.
 
+    const double& rebalanceInterval() const;
+        // Return the rebalance interval attribute of this object.  A value of
+        // 0 indicates that channels are not periodically migrated between the
+        // event managers of the configured channel pool.
+
+    bool ioUringEvents() const;
+        // Return 'true' if the configured channel pool will monitor its
+        // sockets with 'io_uring' event managers where supported, and 'false'
+        // otherwise.
+
     const double& readTimeout() const;
         // Return the read timeout attribute of this object.  A value of 0
         // indicates the read timeout should be disabled.
@@ -745,6 +855,31 @@ int ChannelPoolConfiguration::setCollectTimeMetrics(
     return 0;
 }
 
+inline
+int ChannelPoolConfiguration::setEdgeTriggeredEvents(
+                                                  bool edgeTriggeredEventsFlag)
+{
+    d_edgeTriggeredEvents = edgeTriggeredEventsFlag;
+    return 0;
+}
+
+inline
+int ChannelPoolConfiguration::setRebalanceInterval(double rebalanceInterval)
+{
+    if (0 <= rebalanceInterval) {
+        d_rebalanceInterval = rebalanceInterval;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
+inline
+int ChannelPoolConfiguration::setIoUringEvents(bool ioUringEventsFlag)
+{
+    d_ioUringEvents = ioUringEventsFlag;
+    return 0;
+}
+
 template <class MANIPULATOR>
 int ChannelPoolConfiguration::manipulateAttributes(MANIPULATOR& manipulator)
 {
@@ -845,6 +980,27 @@ int ChannelPoolConfiguration::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;                                                   // RETURN
     }
 
+    ret = manipulator(
+                &d_edgeTriggeredEvents,
+                ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EDGE_TRIGGERED_EVENTS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                   &d_rebalanceInterval,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REBALANCE_INTERVAL]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                     &d_ioUringEvents,
+                     ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_IO_URING_EVENTS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -939,6 +1095,24 @@ int ChannelPoolConfiguration::manipulateAttribute(MANIPULATOR& manipulator,
                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_EDGE_TRIGGERED_EVENTS: {
+        return manipulator(
+                &d_edgeTriggeredEvents,
+                ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EDGE_TRIGGERED_EVENTS]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_REBALANCE_INTERVAL: {
+        return manipulator(
+                   &d_rebalanceInterval,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REBALANCE_INTERVAL]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_IO_URING_EVENTS: {
+        return manipulator(
+                     &d_ioUringEvents,
+                     ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_IO_URING_EVENTS]);
+                                                                      // RETURN
+      } break;
 
       default:
         return k_NOT_FOUND;                                           // RETURN
@@ -1049,6 +1223,23 @@ bool ChannelPoolConfiguration::collectTimeMetrics() const {
     return d_collectTimeMetrics;
 }
 
+inline
+bool ChannelPoolConfiguration::edgeTriggeredEvents() const {
+    return d_edgeTriggeredEvents;
+}
+
+inline
+const double& ChannelPoolConfiguration::rebalanceInterval() const
+{
+    return d_rebalanceInterval;
+}
+
+inline
+bool ChannelPoolConfiguration::ioUringEvents() const
+{
+    return d_ioUringEvents;
+}
+
 template <class ACCESSOR>
 int ChannelPoolConfiguration::accessAttributes(ACCESSOR& accessor) const
 {
@@ -1147,6 +1338,25 @@ int ChannelPoolConfiguration::accessAttributes(ACCESSOR& accessor) const
         return ret;                                                   // RETURN
     }
 
+    ret = accessor(
+                d_edgeTriggeredEvents,
+                ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EDGE_TRIGGERED_EVENTS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(d_rebalanceInterval,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REBALANCE_INTERVAL]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(d_ioUringEvents,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_IO_URING_EVENTS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -1239,6 +1449,24 @@ ChannelPoolConfiguration::accessAttribute(ACCESSOR& accessor, int id) const
                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_EDGE_TRIGGERED_EVENTS: {
+        return accessor(
+                d_edgeTriggeredEvents,
+                ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EDGE_TRIGGERED_EVENTS]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_REBALANCE_INTERVAL: {
+        return accessor(
+                   d_rebalanceInterval,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REBALANCE_INTERVAL]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_IO_URING_EVENTS: {
+        return accessor(
+                     d_ioUringEvents,
+                     ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_IO_URING_EVENTS]);
+                                                                      // RETURN
+      } break;
 
       default:
         return k_NOT_FOUND;                                           // RETURN
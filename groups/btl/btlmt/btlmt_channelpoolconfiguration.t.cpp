@@ -41,6 +41,8 @@ using namespace bsl;  // automatically added by script
 // [ 2] int setMaxThreads(int maxThreads);
 // [ 2] int setMetricsInterval(double metricsInterval);
 // [ 2] int setReadTimeout(double readTimeout);
+// [ 2] int setRebalanceInterval(double rebalanceInterval);
+// [ 2] int setIoUringEvents(bool ioUringEventsFlag);
 // [ 1] int minIncomingMessageSize() const;
 // [ 1] int typicalIncomingMessageSize() const;
 // [ 1] int maxIncomingMessageSize() const;
@@ -51,6 +53,8 @@ using namespace bsl;  // automatically added by script
 // [ 1] int maxThreads() const;
 // [ 1] double metricsInterval() const;
 // [ 1] double readTimeout() const;
+// [ 1] double rebalanceInterval() const;
+// [ 1] bool ioUringEvents() const;
 //
 // [ 1] bool operator==(const btlmt::ChannelPoolConfiguration& lhs, ...
 // [ 1] bool operator!=(const btlmt::ChannelPoolConfiguration& lhs, ...
@@ -142,6 +146,11 @@ const int THREADSTACKSIZE[NUM_VALUES]  = { 1048576, 512, 600, 700, 800, 900,
                                                                          999 };
 const bool COLLECTMETRICS[NUM_VALUES] =
                                      { true, false, true, false, true, false };
+const bool EDGETRIGGERED[NUM_VALUES] =
+                                     { false, true, true, false, false, true };
+const TI  REBALANCEINTERVAL[NUM_VALUES]= { 0.0, T10, T21, T30, T41, T50, T61 };
+const bool IOURING[NUM_VALUES] =
+                                     { false, true, false, true, true, false };
 
 //=============================================================================
 //                             HELPER CLASSES
@@ -348,6 +357,9 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 3" NL
                 "\tthreadStackSize        : 1024" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\tedgeTriggeredEvents    : 0" NL
+                "\trebalanceInterval      : 0" NL
+                "\tioUringEvents          : 0" NL
                 "]" NL
                 ;
             ASSERT(os.str().c_str() == s);
@@ -380,7 +392,7 @@ int main(int argc, char *argv[])
                           << "\n==========================" << endl;
 
         enum {
-            NUM_ATTRIBUTES = 14
+            NUM_ATTRIBUTES = 17
         };
 
         ASSERT(NUM_ATTRIBUTES == Obj::k_NUM_ATTRIBUTES);
@@ -390,7 +402,8 @@ int main(int argc, char *argv[])
         "MinMessageSizeOut", "TypMessageSizeOut", "MaxMessageSizeOut",
         "MinMessageSizeIn", "TypMessageSizeIn", "MaxMessageSizeIn",
         "WriteQueueLowWater", "WriteQueueHighWater", "ThreadStackSize",
-        "CollectTimeMetrics"
+        "CollectTimeMetrics", "EdgeTriggeredEvents", "RebalanceInterval",
+        "IoUringEvents"
         };
 
         const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
@@ -564,13 +577,38 @@ int main(int argc, char *argv[])
                                                                     visitor,
                                                                     j + 1));
                   } break;
+                  case 14: {
+                    ASSERT(0 == mA.setEdgeTriggeredEvents(EDGETRIGGERED[i]));
+                    AssignValue<bool> visitor(EDGETRIGGERED[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 15: {
+                    ASSERT(0 ==
+                           mA.setRebalanceInterval(REBALANCEINTERVAL[i]));
+                    AssignValue<double> visitor(REBALANCEINTERVAL[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 16: {
+                    ASSERT(0 == mA.setIoUringEvents(IOURING[i]));
+                    AssignValue<bool> visitor(IOURING[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
 
                   default:
                     ASSERT(0);
                 }
                 LOOP2_ASSERT(i, j, mA == mB);
 
-                if (j == 2 || j == 3) {
+                if (j == 2 || j == 3 || j == 15) {
                     double value;
                     GetValue<double> gvisitor(&value);
                     ASSERT(0 ==
@@ -582,7 +620,7 @@ int main(int argc, char *argv[])
                                                                   avisitor,
                                                                   j + 1));
                 }
-                else if (j == 13) {
+                else if (j == 13 || j == 14 || j == 16) {
                     bool value;
                     GetValue<bool> gvisitor(&value);
                     ASSERT(0 ==
@@ -659,6 +697,15 @@ int main(int argc, char *argv[])
             ASSERT(0 == mX1.setMetricsInterval(0.1));
             ASSERT(0.1 == X1.metricsInterval());
         }
+        if (verbose) cout << "\t Check rebalanceInterval contraint. " << endl;
+        {
+            ASSERT(0 != mX1.setRebalanceInterval(-1.1));
+            ASSERT(REBALANCEINTERVAL[0] == X1.rebalanceInterval());
+            ASSERT(0 == mX1.setRebalanceInterval(0.1));
+            ASSERT(0.1 == X1.rebalanceInterval());
+            ASSERT(0 == mX1.setRebalanceInterval(0.0));
+            ASSERT(0.0 == X1.rebalanceInterval());
+        }
         if (verbose) cout << "\t Check messageSizeIn contraint. " << endl;
         {
             ASSERT(0 != mX1.setIncomingMessageSizes(-1,  1,  1));
@@ -1136,6 +1183,138 @@ int main(int argc, char *argv[])
 
         // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+        if (verbose) cout << "\t Change attribute 8." << endl;
+
+        ASSERT(0 == mX1.setEdgeTriggeredEvents(EDGETRIGGERED[1]));
+        ASSERT( MINMESSAGESIZEIN[0] == X1.minIncomingMessageSize());
+        ASSERT( TYPMESSAGESIZEIN[0] == X1.typicalIncomingMessageSize());
+        ASSERT( MAXMESSAGESIZEIN[0] == X1.maxIncomingMessageSize());
+        ASSERT(MINMESSAGESIZEOUT[0] == X1.minOutgoingMessageSize());
+        ASSERT(TYPMESSAGESIZEOUT[0] == X1.typicalOutgoingMessageSize());
+        ASSERT(MAXMESSAGESIZEOUT[0] == X1.maxOutgoingMessageSize());
+        ASSERT(   MAXCONNECTIONS[0] == X1.maxConnections());
+        ASSERT(    MAXNUMTHREADS[0] == X1.maxThreads());
+        ASSERT(  METRICSINTERVAL[0] == X1.metricsInterval());
+        ASSERT(      READTIMEOUT[0] == X1.readTimeout());
+        ASSERT(  THREADSTACKSIZE[0] == X1.threadStackSize());
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(    EDGETRIGGERED[1] == X1.edgeTriggeredEvents());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setEdgeTriggeredEvents(EDGETRIGGERED[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 9." << endl;
+
+        ASSERT(0 == mX1.setRebalanceInterval(REBALANCEINTERVAL[1]));
+        ASSERT( MINMESSAGESIZEIN[0] == X1.minIncomingMessageSize());
+        ASSERT( TYPMESSAGESIZEIN[0] == X1.typicalIncomingMessageSize());
+        ASSERT( MAXMESSAGESIZEIN[0] == X1.maxIncomingMessageSize());
+        ASSERT(MINMESSAGESIZEOUT[0] == X1.minOutgoingMessageSize());
+        ASSERT(TYPMESSAGESIZEOUT[0] == X1.typicalOutgoingMessageSize());
+        ASSERT(MAXMESSAGESIZEOUT[0] == X1.maxOutgoingMessageSize());
+        ASSERT(   MAXCONNECTIONS[0] == X1.maxConnections());
+        ASSERT(    MAXNUMTHREADS[0] == X1.maxThreads());
+        ASSERT(  METRICSINTERVAL[0] == X1.metricsInterval());
+        ASSERT(      READTIMEOUT[0] == X1.readTimeout());
+        ASSERT(  THREADSTACKSIZE[0] == X1.threadStackSize());
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(    EDGETRIGGERED[0] == X1.edgeTriggeredEvents());
+        ASSERT(REBALANCEINTERVAL[1] == X1.rebalanceInterval());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setRebalanceInterval(REBALANCEINTERVAL[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 10." << endl;
+
+        ASSERT(0 == mX1.setIoUringEvents(IOURING[1]));
+        ASSERT( MINMESSAGESIZEIN[0] == X1.minIncomingMessageSize());
+        ASSERT( TYPMESSAGESIZEIN[0] == X1.typicalIncomingMessageSize());
+        ASSERT( MAXMESSAGESIZEIN[0] == X1.maxIncomingMessageSize());
+        ASSERT(MINMESSAGESIZEOUT[0] == X1.minOutgoingMessageSize());
+        ASSERT(TYPMESSAGESIZEOUT[0] == X1.typicalOutgoingMessageSize());
+        ASSERT(MAXMESSAGESIZEOUT[0] == X1.maxOutgoingMessageSize());
+        ASSERT(   MAXCONNECTIONS[0] == X1.maxConnections());
+        ASSERT(    MAXNUMTHREADS[0] == X1.maxThreads());
+        ASSERT(  METRICSINTERVAL[0] == X1.metricsInterval());
+        ASSERT(      READTIMEOUT[0] == X1.readTimeout());
+        ASSERT(  THREADSTACKSIZE[0] == X1.threadStackSize());
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(    EDGETRIGGERED[0] == X1.edgeTriggeredEvents());
+        ASSERT(REBALANCEINTERVAL[0] == X1.rebalanceInterval());
+        ASSERT(          IOURING[1] == X1.ioUringEvents());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setIoUringEvents(IOURING[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
         if (verbose) cout << "Testing output operator (<<)." << endl;
 
         ASSERT(0 == mY1.setIncomingMessageSizes(MINMESSAGESIZEIN[1],
@@ -1172,6 +1351,9 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 1024" NL
                 "\tthreadStackSize        : 1048576" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\tedgeTriggeredEvents    : 0" NL
+                "\trebalanceInterval      : 0" NL
+                "\tioUringEvents          : 0" NL
                 "]" NL
                 ;
             ASSERT(buf == s);
@@ -1196,6 +1378,9 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 17" NL
                 "\tthreadStackSize        : 512" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\tedgeTriggeredEvents    : 0" NL
+                "\trebalanceInterval      : 0" NL
+                "\tioUringEvents          : 0" NL
                 "]" NL
                 ;
             ASSERT(buf == s);
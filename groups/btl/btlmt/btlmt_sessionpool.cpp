@@ -943,6 +943,43 @@ int SessionPool::connect(
     return 0;
 }
 
+int SessionPool::connect(
+                       int                                      *handleBuffer,
+                       const SessionPool::SessionStateCallback&  cb,
+                       const btlso::LocalAddress&                endpoint,
+                       int                                       numAttempts,
+                       const bsls::TimeInterval&                 interval,
+                       SessionFactory                           *factory,
+                       void                                     *userData,
+                       const btlso::SocketOptions               *socketOptions)
+{
+    BSLS_ASSERT(d_channelPool_p);
+
+    if (0 == d_channelPool_p->numThreads()) {
+        // Going down.
+
+        return -1;                                                    // RETURN
+    }
+
+    int handleId = makeConnectHandle(cb, numAttempts, userData, factory);
+    *handleBuffer = handleId;
+
+    int ret = d_channelPool_p->connect(endpoint,
+                                       numAttempts,
+                                       interval,
+                                       handleId,
+                                       false,
+                                       ChannelPool::e_CLOSE_BOTH,
+                                       socketOptions);
+    if (ret) {
+        HandlePtr handle;
+        d_handles.remove(handleId, &handle);
+        handle->d_handleId = 0; // Do not call back anybody
+        return ret;                                                   // RETURN
+    }
+    return 0;
+}
+
 int SessionPool::import(
    int                                                         *handleBuffer,
    const SessionPool::SessionStateCallback&                     cb,
@@ -1079,6 +1116,46 @@ int SessionPool::listen(
     return 0;
 }
 
+int SessionPool::listen(
+                       int                                      *handleBuffer,
+                       const SessionPool::SessionStateCallback&  cb,
+                       const btlso::LocalAddress&                endpoint,
+                       int                                       backlog,
+                       int                                       reuseAddress,
+                       SessionFactory                           *factory,
+                       void                                     *userData,
+                       const btlso::SocketOptions               *socketOptions)
+{
+    BSLS_ASSERT(d_channelPool_p);
+
+    HandlePtr handle(new (*d_allocator_p) SessionPool_Handle(),
+                     bdlf::MemFnUtil::memFn(&SessionPool::handleDeleter, this),
+                     d_allocator_p);
+
+    handle->d_type             = SessionPool_Handle::e_LISTENER;
+    handle->d_sessionStateCB   = cb;
+    handle->d_session_p        = 0;
+    handle->d_channel_p        = 0;
+    handle->d_userData_p       = userData;
+    handle->d_sessionFactory_p = factory;
+    handle->d_handleId         = d_handles.add(handle);
+    *handleBuffer              = handle->d_handleId;
+
+    int ret = d_channelPool_p->listen(endpoint,
+                                      backlog,
+                                      handle->d_handleId,
+                                      reuseAddress,
+                                      false,
+                                      ChannelPool::e_CLOSE_BOTH,
+                                      socketOptions);
+
+    if (ret) {
+        d_handles.remove(handle->d_handleId);
+        return ret;                                                   // RETURN
+    }
+    return 0;
+}
+
 int SessionPool::setWriteQueueWatermarks(int handleId,
                                          int lowWatermark,
                                          int highWatermark)
@@ -485,6 +485,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_ipv4address.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#include <btlso_localaddress.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_STREAMSOCKET
 #include <btlso_streamsocket.h>
 #endif
@@ -875,6 +879,23 @@ class SessionPool {
         // optionally specified 'userData'.  The behavior is undefined unless
         // '0 < backlog'.
 
+    int listen(int                                      *handleBuffer,
+               const SessionPool::SessionStateCallback&  callback,
+               const btlso::LocalAddress&                endpoint,
+               int                                       backlog,
+               int                                       reuseAddress,
+               SessionFactory                           *factory,
+               void                                     *userData = 0,
+               const btlso::SocketOptions               *socketOptions = 0);
+        // Asynchronously listen for connection requests on the local
+        // (Unix-domain) socket bound to the filesystem path of the specified
+        // 'endpoint', exactly as for the 'listen' overloads taking a
+        // 'btlso::IPv4Address', except that a non-zero 'reuseAddress' allows a
+        // stale socket file left at that path to be replaced (see
+        // 'btlmt::ChannelPool').  The socket file is removed when the listener
+        // is closed.  The behavior is undefined unless '0 < backlog' and
+        // 'endpoint' is not empty.
+
                                   // *** client-related section ***
     int closeHandle(int handle);
         // Close the listener or the connection represented by the specified
@@ -966,6 +987,21 @@ class SessionPool {
         // undefined unless '0 < numAttempts', and '0 < interval' or
         // '1 == numAttempts'.
 
+    int connect(int                                      *handleBuffer,
+                const SessionPool::SessionStateCallback&  callback,
+                const btlso::LocalAddress&                endpoint,
+                int                                       numAttempts,
+                const bsls::TimeInterval&                 interval,
+                SessionFactory                           *factory,
+                void                                     *userData = 0,
+                const btlso::SocketOptions               *socketOptions = 0);
+        // Asynchronously attempt to connect to the local (Unix-domain) server
+        // listening on the filesystem path of the specified 'endpoint',
+        // exactly as for the 'connect' overloads taking a
+        // 'btlso::IPv4Address'.  The behavior is undefined unless
+        // '0 < numAttempts', '0 < interval' or '1 == numAttempts', and
+        // 'endpoint' is not empty.
+
     int import(int                                            *handleBuffer,
                const SessionPool::SessionStateCallback&        callback,
                btlso::StreamSocket<btlso::IPv4Address>        *streamSocket,
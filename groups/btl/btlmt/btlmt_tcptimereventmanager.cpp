@@ -768,8 +768,33 @@ int TcpTimerEventManager_ControlChannel::open()
     return 0;
 }
 
-int TcpTimerEventManager_ControlChannel::serverRead()
+int TcpTimerEventManager_ControlChannel::serverRead(bool drainFlag)
 {
+    if (drainFlag) {
+        // Consume every pending byte *before* collecting the pending
+        // requests, so that a request posted after the swap writes a byte
+        // that is reported as a new edge.
+
+        char buffer[64];
+
+        while (true) {
+            const int numBytes = btlso::SocketImpUtil::read(buffer,
+                                                            serverFd(),
+                                                            sizeof buffer);
+            if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == numBytes) {
+                break;
+            }
+            if (numBytes <= 0) {
+                return -1;                                            // RETURN
+            }
+
+            ++d_numServerReads;
+            d_numServerBytesRead += numBytes;
+        }
+
+        return d_numPendingRequests.swap(0);                          // RETURN
+    }
+
     int  rc = d_numPendingRequests.swap(0);
     char byte;
 
@@ -789,15 +814,26 @@ int TcpTimerEventManager_ControlChannel::serverRead()
                          // --------------------------
 
 // PRIVATE METHODS
-void TcpTimerEventManager::initialize()
+void TcpTimerEventManager::initialize(TriggerMode triggerMode)
 {
     BSLS_ASSERT(d_allocator_p);
 
     btlso::TimeMetrics *metrics = d_collectMetrics ? &d_metrics : 0;
 
+    d_isEdgeTriggered = false;
+
     // Initialize the (managed) event manager.
 #ifdef BSLS_PLATFORM_OS_LINUX
-    if (btlso::DefaultEventManager<>::isSupported()) {
+    typedef btlso::DefaultEventManager<btlso::Platform::EPOLL> EpollManager;
+
+    if (e_EDGE_TRIGGERED == triggerMode && EpollManager::isSupported()) {
+        d_manager_p = new (*d_allocator_p) EpollManager(
+                                                EpollManager::e_EDGE_TRIGGERED,
+                                                metrics,
+                                                d_allocator_p);
+        d_isEdgeTriggered = true;
+    }
+    else if (btlso::DefaultEventManager<>::isSupported()) {
         d_manager_p = new (*d_allocator_p)
                                    btlso::DefaultEventManager<>(metrics,
                                                                 d_allocator_p);
@@ -808,6 +844,8 @@ void TcpTimerEventManager::initialize()
                                                                 d_allocator_p);
     }
 #else
+    (void)triggerMode;
+
     d_manager_p = new (*d_allocator_p)
                                    btlso::DefaultEventManager<>(metrics,
                                                                 d_allocator_p);
@@ -866,7 +904,7 @@ void TcpTimerEventManager::controlCb()
     // At least one request is pending on the queue.  Process as many
     // as there are.
 {
-    int numRequests = d_controlChannel_p->serverRead();
+    int numRequests = d_controlChannel_p->serverRead(d_isEdgeTriggered);
 
     if (numRequests < 0) {
         const int rc = reinitializeControlChannel();
@@ -1118,7 +1156,7 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    initialize(e_LEVEL_TRIGGERED);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
@@ -1138,10 +1176,32 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    initialize(e_LEVEL_TRIGGERED);
+}
+
+TcpTimerEventManager::TcpTimerEventManager(
+                                        bool               collectTimeMetrics,
+                                        bool               poolTimerMemory,
+                                        bslma::Allocator  *threadSafeAllocator)
+: d_requestPool(sizeof(TcpTimerEventManager_Request), threadSafeAllocator)
+, d_requestQueue(threadSafeAllocator)
+, d_dispatcher(bslmt::ThreadUtil::invalidHandle())
+, d_state(e_DISABLED)
+, d_terminateThread(0)
+, d_timerQueue(poolTimerMemory, threadSafeAllocator)
+, d_metrics(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+            btlso::TimeMetrics::e_IO_BOUND,
+            threadSafeAllocator)
+, d_collectMetrics(collectTimeMetrics)
+, d_numTotalSocketEvents(0)
+, d_numControlChannelReinitializations(0)
+, d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
+{
+    initialize(e_LEVEL_TRIGGERED);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
+                                        TriggerMode        triggerMode,
                                         bool               collectTimeMetrics,
                                         bool               poolTimerMemory,
                                         bslma::Allocator  *threadSafeAllocator)
@@ -1159,7 +1219,7 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    initialize(triggerMode);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
@@ -1176,6 +1236,7 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_metrics(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
             btlso::TimeMetrics::e_IO_BOUND,
             threadSafeAllocator)
+, d_isEdgeTriggered(false)
 , d_collectMetrics(false)
 , d_numTotalSocketEvents(0)
 , d_numControlChannelReinitializations(0)
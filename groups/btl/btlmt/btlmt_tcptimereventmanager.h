@@ -107,6 +107,13 @@ BSLS_IDENT("$Id: $")
 //  +========================================================================+
 //..
 //
+// On Linux, an event manager can be constructed to report socket events in
+// edge-triggered mode (see 'e_EDGE_TRIGGERED'), in which case a socket that
+// stays ready does not cause the dispatcher thread to wake up again until its
+// readiness changes.  This reduces the number of wake-ups under sustained
+// load, provided that every callback drains its socket (i.e., reads, accepts,
+// or writes until the operation would block) each time it is invoked.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -345,10 +352,15 @@ class TcpTimerEventManager_ControlChannel {
         // 'serverFd' and 'clientFd' managed by this object.  Return 0 on
         // success and a non-zero value otherwise.
 
-    int serverRead();
-        // Read as many bytes as possible from the server buffer without
-        // blocking.  Return the number of bytes read on success, and a
-        // negative value otherwise.
+    int serverRead(bool drainFlag = false);
+        // Read the control byte from the server handle and return the number
+        // of requests posted since the previous call, or a negative value if
+        // the server handle was closed or an error occurred.  Optionally
+        // specify a 'drainFlag' indicating whether every byte pending on the
+        // server handle is consumed (until the read would block) *before*
+        // the number of pending requests is collected, as required when the
+        // server handle is monitored in edge-triggered mode.  If 'drainFlag'
+        // is unspecified or 'false', a single byte is read.
 
     // ACCESSORS
     btlso::SocketHandle::Handle clientFd();
@@ -371,6 +383,19 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     // from dedicated threads, created internally for this purpose by this
     // component.
 
+  public:
+    // TYPES
+    enum TriggerMode {
+        // Enumerate the modes in which an event manager can report socket
+        // events.
+
+        e_LEVEL_TRIGGERED = 0,  // report an event for as long as the socket
+                                // remains ready
+        e_EDGE_TRIGGERED  = 1   // report an event when the socket *becomes*
+                                // ready (only where supported)
+    };
+
+  private:
     // PRIVATE TYPES
     enum State {
         e_ENABLED  = 0,  // dispatching thread is running
@@ -443,6 +468,10 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
 
     mutable btlso::TimeMetrics     d_metrics;         // cached metrics
 
+    bool                           d_isEdgeTriggered; // whether socket events
+                                                      // are reported
+                                                      // edge-triggered
+
     const bool                     d_collectMetrics;  // whether to update
                                                       // 'd_metrics'
 
@@ -469,8 +498,10 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     TcpTimerEventManager& operator=(const TcpTimerEventManager&);
 
     // PRIVATE MANIPULATORS
-    void initialize();
-        // Initialize this event manager.
+    void initialize(TriggerMode triggerMode);
+        // Initialize this event manager to report socket events in the
+        // specified 'triggerMode', if supported on this platform, and in
+        // level-triggered mode otherwise.
 
     void dispatchThreadEntryPoint();
         // Entry point for the dispatch thread.
@@ -512,6 +543,28 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
         // the dispatcher thread is NOT started by this method (i.e., it must
         // be started explicitly).
 
+    TcpTimerEventManager(TriggerMode       triggerMode,
+                         bool              collectTimeMetrics,
+                         bool              poolTimerMemory,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create an event manager that reports socket events in the specified
+        // 'triggerMode', and that collects timing metrics and pools the
+        // memory used for internal timers according to the specified
+        // 'collectTimeMetrics' and 'poolTimerMemory' flags, as for the
+        // constructor above.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'basicAllocator' refers to a *thread* *safe* allocator.  If
+        // 'e_EDGE_TRIGGERED == triggerMode' but edge-triggered notification
+        // is not supported on this platform (currently it is supported only
+        // by the 'epoll' mechanism on Linux), socket events are reported in
+        // level-triggered mode; 'isEdgeTriggered' reports the mode in effect.
+        // Note that, in edge-triggered mode, a callback is invoked only once
+        // per change in the readiness of its socket, and therefore must read
+        // (or accept) until the operation would block, or write until the
+        // operation would block or there is no more data to write (see
+        // 'btlso_defaulteventmanager_epoll').
+
     TcpTimerEventManager(btlso::EventManager *rawEventManager,
                          bslma::Allocator    *basicAllocator = 0);
         // Create an event manager with timer support that uses the specified
@@ -522,9 +575,13 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
         // undefined, otherwise.  The value of the event manager's
         // 'timeMetrics()' object will be unspecified, clients interested in
         // those metrics must use the 'btlso::TimeMetrics' object provided to
-        // 'rawEventManager' on its construction.  Note that the dispatcher
-        // thread is NOT started by this method (and, therefore, must be
-        // started explicitly).
+        // 'rawEventManager' on its construction.  The behavior is undefined
+        // unless 'rawEventManager' reports socket events in level-triggered
+        // mode.  Note that the dispatcher thread is NOT started by this
+        // method (and, therefore, must be started explicitly).  Also note
+        // that this constructor allows using a mechanism other than the
+        // platform default, such as
+        // 'btlso::DefaultEventManager<btlso::Platform::IOURING>' on Linux.
 
     virtual ~TcpTimerEventManager();
         // Terminate the dispatcher thread, if it is running, and destroy this
@@ -673,6 +730,11 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     int isEnabled() const;
         // Return 1 if the dispatch thread is created/running and 0 otherwise.
 
+    bool isEdgeTriggered() const;
+        // Return 'true' if socket events are reported in edge-triggered mode
+        // (i.e., a callback is invoked only when its socket *becomes* ready),
+        // and 'false' otherwise.
+
     bool hasTimeMetrics() const;
         // Return 'true' if the object returned by 'timeMetrics()' contains a
         // valid value, and 'false' otherwise.  This value will be 'false' if
@@ -750,6 +812,12 @@ bslmt::ThreadUtil::Handle TcpTimerEventManager::dispatcherThreadHandle() const
     return d_dispatcher;
 }
 
+inline
+bool TcpTimerEventManager::isEdgeTriggered() const
+{
+    return d_isEdgeTriggered;
+}
+
 inline
 bool TcpTimerEventManager::hasTimeMetrics() const
 {
@@ -12,10 +12,12 @@
 #include <btlso_socketimputil.h>
 #include <btlso_eventmanagertester.h>
 #include <btlso_inetstreamsocketfactory.h>
+#include <btlso_ioutil.h>
 #include <btlso_ipv4address.h>
 #include <btlso_streamsocket.h>
 
 #include <btlso_defaulteventmanager.h>
+#include <btlso_defaulteventmanager_iouring.h>
 
 #include <bslma_testallocator.h>
 #include <bdlmt_threadpool.h>
@@ -62,7 +64,8 @@ using namespace BloombergLP;
 // [12] TcpTimerEventManager(bslma::Allocator *basicAllocator = 0);
 // [12] TcpTimerEventManager(collectTimeMetrics, *basicAllocator = 0);
 // [12] TcpTimerEventManager(collectTimeMetrics, poolTimer, *ba = 0);
-// [  ] TcpTimerEventManager(rawEventManager, *basicAllocator = 0);
+// [16] TcpTimerEventManager(triggerMode, collect, poolTimer, *ba = 0);
+// [17] TcpTimerEventManager(rawEventManager, *basicAllocator = 0);
 // [12] ~TcpTimerEventManager();
 //
 // MANIPULATORS
@@ -91,13 +94,14 @@ using namespace BloombergLP;
 // [  ] btlso::TimeMetrics *timeMetrics() const;
 // [  ] bslmt::ThreadUtil::Handle dispatcherThreadHandle() const;
 // [11] int isEnabled() const;
+// [16] bool isEdgeTriggered() const;
 // [12] bool hasTimeMetrics() const;
 //
 // BUG FIXES
 // [15] TEST closure of control channel sockets
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
 //=============================================================================
 
 //=============================================================================
@@ -200,6 +204,54 @@ void testIsEnabled(btlmt::TcpTimerEventManager *manager,
 
 }  // close namespace TEST_CASE_ENABLE_TEST
 
+//=============================================================================
+//                      TEST: Edge-triggered mode
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_EDGE_TRIGGERED {
+
+struct ReadState {
+    // This 'struct' holds the state of a socket drained by 'drainCb'.
+
+    btlso::SocketHandle::Handle d_handle;
+    bsls::AtomicInt             d_numCalls;
+    bsls::AtomicInt             d_numBytes;
+};
+
+void drainCb(ReadState *state)
+    // Read from the socket of the specified 'state' until the read would
+    // block, and update the counters of 'state'.
+{
+    ++state->d_numCalls;
+
+    char buffer[16];
+    int  numBytes;
+    while (0 < (numBytes = btlso::SocketImpUtil::read(buffer,
+                                                      state->d_handle,
+                                                      sizeof buffer))) {
+        state->d_numBytes += numBytes;
+    }
+}
+
+void incrementCb(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+bool waitFor(const bsls::AtomicInt& value, int expected)
+    // Wait (for at most 5 seconds) until the specified 'value' is equal to
+    // the specified 'expected' value.  Return 'true' if it is, and 'false'
+    // otherwise.
+{
+    for (int i = 0; i < 5000 && expected != value; ++i) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+    return expected == value;
+}
+
+}  // close namespace TEST_CASE_EDGE_TRIGGERED
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -829,7 +881,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 16: {
+      case 18: {
         // ----------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -880,6 +932,222 @@ int main(int argc, char *argv[])
         }
       } break;
 
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING A RAW 'io_uring' EVENT MANAGER
+        //
+        // Concerns:
+        //: 1 An object created with an 'io_uring' event manager (where
+        //:   supported) processes requests posted from other threads, socket
+        //:   events, and timers.
+        //
+        // Plan:
+        //: 1 If 'io_uring' is supported, create an object using an 'io_uring'
+        //:   raw event manager, execute many functors, register a timer, and
+        //:   register a read callback on one end of a socket pair, and verify
+        //:   that every functor and callback is invoked.  (C-1)
+        //
+        // Testing:
+        //   TcpTimerEventManager(rawEventManager, *basicAllocator = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING A RAW 'io_uring' EVENT MANAGER" << endl
+                          << "======================================" << endl;
+
+        using namespace TEST_CASE_EDGE_TRIGGERED;
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+        typedef btlso::DefaultEventManager<btlso::Platform::IOURING> IoUring;
+
+        if (!IoUring::isSupported()) {
+            if (verbose) cout << "\t'io_uring' is not supported." << endl;
+            break;
+        }
+
+        IoUring rawManager(0, &testAllocator);
+        {
+            Obj mX(&rawManager, &testAllocator);
+            ASSERT(false == mX.isEdgeTriggered());
+            ASSERT(0 == mX.enable());
+
+            if (verbose) cout << "\tExecuting functors." << endl;
+            {
+                const int       NUM_FUNCTORS = 1000;
+                bsls::AtomicInt counter(0);
+
+                for (int i = 0; i < NUM_FUNCTORS; ++i) {
+                    mX.execute(bdlf::BindUtil::bind(&incrementCb, &counter));
+                }
+                LOOP_ASSERT(counter, waitFor(counter, NUM_FUNCTORS));
+            }
+
+            if (verbose) cout << "\tRegistering a timer." << endl;
+            {
+                bsls::AtomicInt counter(0);
+
+                bsls::TimeInterval expiry = bdlt::CurrentTime::now();
+                expiry.addMilliseconds(10);
+                ASSERT(0 != mX.registerTimer(
+                              expiry,
+                              bdlf::BindUtil::bind(&incrementCb, &counter)));
+                LOOP_ASSERT(counter, waitFor(counter, 1));
+            }
+
+            if (verbose) cout << "\tReading from a socket." << endl;
+            {
+                btlso::SocketHandle::Handle handles[2];
+                ASSERT(0 ==
+                       btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                      handles,
+                                      btlso::SocketImpUtil::k_SOCKET_STREAM));
+                ASSERT(0 == btlso::IoUtil::setBlockingMode(
+                                                handles[1],
+                                                btlso::IoUtil::e_NONBLOCKING));
+
+                ReadState state;
+                state.d_handle = handles[1];
+
+                ASSERT(0 == mX.registerSocketEvent(
+                                    handles[1],
+                                    btlso::EventType::e_READ,
+                                    bdlf::BindUtil::bind(&drainCb, &state)));
+
+                enum { k_LENGTH = 40 };
+                char buffer[k_LENGTH];
+                memset(buffer, 'x', k_LENGTH);
+
+                for (int i = 1; i <= 3; ++i) {
+                    ASSERT(k_LENGTH == btlso::SocketImpUtil::write(handles[0],
+                                                                   buffer,
+                                                                   k_LENGTH));
+                    LOOP2_ASSERT(i,
+                                 state.d_numBytes,
+                                 waitFor(state.d_numBytes, i * k_LENGTH));
+                }
+
+                mX.deregisterSocket(handles[1]);
+                btlso::SocketImpUtil::close(handles[0]);
+                btlso::SocketImpUtil::close(handles[1]);
+            }
+            ASSERT(0 == mX.disable());
+        }
+        ASSERT(0 == rawManager.numEvents());
+#endif
+      } break;
+
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING EDGE-TRIGGERED MODE
+        //
+        // Concerns:
+        //: 1 'isEdgeTriggered' is 'true' only for an object created with
+        //:   'e_EDGE_TRIGGERED' on a platform supporting it.
+        //:
+        //: 2 In edge-triggered mode, requests posted from other threads are
+        //:   all processed, i.e., the control channel is drained.
+        //:
+        //: 3 A socket callback that drains its socket is invoked again when
+        //:   more data arrives.
+        //
+        // Plan:
+        //: 1 Create objects with every constructor and verify
+        //:   'isEdgeTriggered'.  (C-1)
+        //:
+        //: 2 Execute many functors on an enabled edge-triggered object, and
+        //:   verify that all are invoked.  (C-2)
+        //:
+        //: 3 Register a draining read callback on one end of a socket pair,
+        //:   write to the other end twice, and verify that all the data is
+        //:   read.  (C-3)
+        //
+        // Testing:
+        //   TcpTimerEventManager(triggerMode, collect, poolTimer, *ba = 0);
+        //   bool isEdgeTriggered() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING EDGE-TRIGGERED MODE" << endl
+                          << "===========================" << endl;
+
+        using namespace TEST_CASE_EDGE_TRIGGERED;
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+        const bool EXP = btlso::DefaultEventManager<
+                                      btlso::Platform::EPOLL>::isSupported();
+#else
+        const bool EXP = false;
+#endif
+
+        if (verbose) cout << "\tTesting 'isEdgeTriggered'." << endl;
+        {
+            Obj mA(&testAllocator);
+            Obj mB(true, &testAllocator);
+            Obj mC(true, true, &testAllocator);
+            Obj mD(Obj::e_LEVEL_TRIGGERED, true, false, &testAllocator);
+            Obj mE(Obj::e_EDGE_TRIGGERED, true, false, &testAllocator);
+
+            ASSERT(false == mA.isEdgeTriggered());
+            ASSERT(false == mB.isEdgeTriggered());
+            ASSERT(false == mC.isEdgeTriggered());
+            ASSERT(false == mD.isEdgeTriggered());
+            LOOP_ASSERT(EXP, EXP == mE.isEdgeTriggered());
+        }
+
+        Obj mX(Obj::e_EDGE_TRIGGERED, false, false, &testAllocator);
+        ASSERT(0 == mX.enable());
+
+        if (verbose) cout << "\tExecuting functors." << endl;
+        {
+            const int       NUM_FUNCTORS = 1000;
+            bsls::AtomicInt counter(0);
+
+            for (int i = 0; i < NUM_FUNCTORS; ++i) {
+                mX.execute(bdlf::BindUtil::bind(&incrementCb, &counter));
+            }
+            LOOP_ASSERT(counter, waitFor(counter, NUM_FUNCTORS));
+        }
+
+        if (verbose) cout << "\tDraining a socket." << endl;
+        {
+            btlso::SocketHandle::Handle handles[2];
+            ASSERT(0 == btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                      handles,
+                                      btlso::SocketImpUtil::k_SOCKET_STREAM));
+            ASSERT(0 == btlso::IoUtil::setBlockingMode(
+                                         handles[1],
+                                         btlso::IoUtil::e_NONBLOCKING));
+
+            ReadState state;
+            state.d_handle = handles[1];
+
+            ASSERT(0 == mX.registerSocketEvent(
+                                handles[1],
+                                btlso::EventType::e_READ,
+                                bdlf::BindUtil::bind(&drainCb, &state)));
+
+            enum { k_LENGTH = 40 };
+            char buffer[k_LENGTH];
+            memset(buffer, 'x', k_LENGTH);
+
+            ASSERT(k_LENGTH ==
+                   btlso::SocketImpUtil::write(handles[0], buffer, k_LENGTH));
+            LOOP_ASSERT(state.d_numBytes,
+                        waitFor(state.d_numBytes, k_LENGTH));
+
+            ASSERT(k_LENGTH ==
+                   btlso::SocketImpUtil::write(handles[0], buffer, k_LENGTH));
+            LOOP_ASSERT(state.d_numBytes,
+                        waitFor(state.d_numBytes, 2 * k_LENGTH));
+            LOOP_ASSERT(state.d_numCalls, 2 <= state.d_numCalls);
+
+            mX.deregisterSocket(handles[1]);
+            btlso::SocketImpUtil::close(handles[0]);
+            btlso::SocketImpUtil::close(handles[1]);
+        }
+        ASSERT(0 == mX.disable());
+      } break;
+
       case 15: {
         // -----------------------------------------------------------------
         // TEST closure of control channel sockets
@@ -42,6 +42,8 @@ BSLS_IDENT("$Id: $")
 //  +------------------------------------------------------------------------+
 //  | <btlso::Platform::EPOLL>   |         epoll         |       Linux*      |
 //  +------------------------------------------------------------------------+
+//  | <btlso::Platform::IOURING> |        io_uring       |       Linux       |
+//  +------------------------------------------------------------------------+
 //  | <btlso::Platform::POLL>    |          poll         | Solaris, AIX*,    |
 //  |                            |                       | Linux             |
 //  +========================================================================+
@@ -91,6 +93,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_defaulteventmanager_epoll.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#include <btlso_defaulteventmanager_iouring.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_POLL
 #include <btlso_defaulteventmanager_poll.h>
 #endif
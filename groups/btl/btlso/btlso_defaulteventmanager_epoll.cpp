@@ -306,6 +306,28 @@ EventManagerName::DefaultEventManager(btlso::TimeMetrics *timeMetric,
 , d_events(128, bsl::hash<int>(), bsl::equal_to<int>(), basicAllocator)
 , d_entriesBeingRemoved(basicAllocator)
 , d_numEvents(0)
+, d_triggerFlags(0)
+{
+    d_epollFd = epoll_create(128);
+    if (-1 == d_epollFd) {
+        bsl::perror("epoll_create returned ");
+        BSLS_ASSERT_OPT("epoll_create() failed" && 0);
+    }
+}
+
+EventManagerName::DefaultEventManager(TriggerMode         triggerMode,
+                                      btlso::TimeMetrics *timeMetric,
+                                      bslma::Allocator   *basicAllocator)
+: d_epollFd(-1)
+, d_signaled(basicAllocator)
+, d_isInvokingCb(false)
+, d_timeMetric_p(timeMetric)
+, d_events(128, bsl::hash<int>(), bsl::equal_to<int>(), basicAllocator)
+, d_entriesBeingRemoved(basicAllocator)
+, d_numEvents(0)
+, d_triggerFlags(e_EDGE_TRIGGERED == triggerMode
+                 ? static_cast<int>(EPOLLET)
+                 : 0)
 {
     d_epollFd = epoll_create(128);
     if (-1 == d_epollFd) {
@@ -432,7 +454,7 @@ void EventManagerName::deregisterSocketEvent(
     regEvents->d_mask = newMask;
 
     struct epoll_event epollEvent = { 0, { 0 } };
-    epollEvent.events = newMask;
+    epollEvent.events = newMask | d_triggerFlags;
     epollEvent.data.ptr = (void *) &*it;
 
     int ret = epoll_ctl(d_epollFd, EPOLL_CTL_MOD, handle, &epollEvent);
@@ -573,7 +595,7 @@ int EventManagerName::registerSocketEvent(
               && btlso::EventType::e_WRITE == regEvents->d_writeEventType));
 
     struct epoll_event epollEvent = { 0, { 0 } };
-    epollEvent.events = newMask;
+    epollEvent.events = newMask | d_triggerFlags;
     epollEvent.data.ptr = (void *) &*it;
 
     int epollCmd = EPOLL_CTL_MOD;
@@ -37,6 +37,31 @@ BSLS_IDENT("$Id: $")
 // that appropriate method (i.e., 'dispatch') is called.  Once deregistered,
 // the callback will no longer be invoked.
 //
+///Edge-Triggered Mode
+///-------------------
+// By default, socket events are level-triggered: a callback is invoked by
+// every call to 'dispatch' for as long as the socket remains ready (e.g., has
+// unread data).  An event manager created with the 'e_EDGE_TRIGGERED' trigger
+// mode instead registers its sockets with 'EPOLLET', so that a callback is
+// invoked only when the corresponding socket *becomes* ready, i.e., when new
+// data arrives (for read and accept events) or when space becomes available
+// in the send buffer (for write and connect events).  A busy socket is then
+// not reported again by each 'dispatch', and the kernel does not have to
+// re-scan it, which reduces the number of wakeups when many connections are
+// registered.  Note that when a socket has both a read and a write event
+// registered, a transition for either event reports every event for which the
+// socket is ready at that time (e.g., new data arriving on a writable socket
+// invokes both callbacks).
+//
+// In edge-triggered mode, the callbacks must honor a *drain* contract: a read
+// (or accept) callback must keep reading (or accepting) until the operation
+// would block, and a write callback must keep writing until the operation
+// would block or it has nothing left to write (and deregisters its event).
+// Otherwise, the data (or connections) left in the socket may not be reported
+// until more arrive.  Note that (re-)registering an event for a socket always
+// reports that socket if it is currently ready, so that a callback that stops
+// reading early may deregister and later re-register its event to resume.
+//
 ///Availability
 ///------------
 // The 'epoll' systems calls (and consequently this specialized component) is
@@ -331,6 +356,16 @@ class TimeMetrics;
 template <>
 class DefaultEventManager<Platform::EPOLL> : public EventManager
 {
+  public:
+    // TYPES
+    enum TriggerMode {
+        e_LEVEL_TRIGGERED,  // invoke a callback at each 'dispatch' for as long
+                            // as its socket is ready (the default)
+
+        e_EDGE_TRIGGERED    // invoke a callback only when its socket becomes
+                            // ready (see "Edge-Triggered Mode")
+    };
+
   private:
     struct HandleEvents {
         bool                   d_isValid;
@@ -374,6 +409,10 @@ class DefaultEventManager<Platform::EPOLL> : public EventManager
     int                                d_numEvents;
                                                  // number of registered events
 
+    int                                d_triggerFlags;
+                                                 // 'EPOLLET' in edge-triggered
+                                                 // mode, and 0 otherwise
+
     // PRIVATE MANIPULATORS
     int dispatchCallbacks(const bsl::vector<struct ::epoll_event>& signaled,
                           int                                      numReady);
@@ -404,7 +443,21 @@ class DefaultEventManager<Platform::EPOLL> : public EventManager
         // operations.  If 'timeMetric' is not specified or is 0, these metrics
         // are not reported.  Optionally specify a 'basicAllocator' used to
         // supply memory.  If 'basicAllocator' is 0, the currently installed
-        // default allocator is used.
+        // default allocator is used.  Socket events are level-triggered.
+
+    explicit
+    DefaultEventManager(TriggerMode       triggerMode,
+                        TimeMetrics      *timeMetric     = 0,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create a 'epoll'-based event manager that reports socket events as
+        // indicated by the specified 'triggerMode'.  Optionally specify a
+        // 'timeMetric' to report time spent in CPU-bound and IO-bound
+        // operations.  If 'timeMetric' is not specified or is 0, these metrics
+        // are not reported.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  Note that callbacks registered with an
+        // edge-triggered event manager must drain their socket as described
+        // in "Edge-Triggered Mode" in the component-level documentation.
 
     ~DefaultEventManager();
         // Destroy this object.  Note that the registered callbacks are NOT
@@ -496,6 +549,9 @@ class DefaultEventManager<Platform::EPOLL> : public EventManager
     int numSocketEvents(const SocketHandle::Handle& handle) const;
         // Return the number of socket events currently registered with this
         // event manager for the specified 'handle'.
+
+    TriggerMode triggerMode() const;
+        // Return the mode in which this event manager reports socket events.
 };
 
 //-----------------------------------------------------------------------------
@@ -513,6 +569,13 @@ bool DefaultEventManager<Platform::EPOLL>::hasLimitedSocketCapacity() const
     return false;
 }
 
+inline
+DefaultEventManager<Platform::EPOLL>::TriggerMode
+DefaultEventManager<Platform::EPOLL>::triggerMode() const
+{
+    return d_triggerFlags ? e_EDGE_TRIGGERED : e_LEVEL_TRIGGERED;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
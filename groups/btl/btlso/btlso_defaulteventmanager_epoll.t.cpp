@@ -59,6 +59,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // CREATORS
 // [ 2] btlso::DefaultEventManager
+// [14] btlso::DefaultEventManager(TriggerMode, TimeMetrics *, Allocator *)
 // [ 2] ~btlso::DefaultEventManager
 //
 // MANIPULATORS
@@ -74,8 +75,10 @@ using namespace bsl;  // automatically added by script
 // [ 3] numSocketEvents
 // [ 3] numEvents
 // [ 3] isRegistered
+// [14] triggerMode
 //-----------------------------------------------------------------------------
-// [14] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
+// [14] EDGE-TRIGGERED MODE
 // [13] Testing TRAITS
 // [10] SYSTEM INTERFACES ASSUMPTIONS
 // [ 1] Breathing test
@@ -299,7 +302,7 @@ int main(int argc, char *argv[])
                                   btlso::TimeMetrics::e_CPU_BOUND);
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // -----------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -405,6 +408,125 @@ int main(int argc, char *argv[])
         ASSERT(0 == mX.isRegistered(socket[1], btlso::EventType::e_WRITE));
       } break;
 
+      case 14: {
+        // -----------------------------------------------------------------
+        // TESTING EDGE-TRIGGERED MODE
+        //
+        // Concerns:
+        //: 1 An event manager is level-triggered unless created with
+        //:   'e_EDGE_TRIGGERED'.
+        //:
+        //: 2 In edge-triggered mode, a callback is invoked only when its
+        //:   socket becomes ready, and (re-)registering an event reports a
+        //:   socket that is already ready.
+        //:
+        //: 3 In edge-triggered mode, modifying or removing one event of a
+        //:   socket does not affect the other.
+        //
+        // Plan:
+        //: 1 Verify 'triggerMode' for objects created by each constructor.
+        //:   (C-1)
+        //:
+        //: 2 Run the standard edge-triggered test of
+        //:   'btlso::EventManagerTester'.  (C-2)
+        //:
+        //: 3 Run the standard 'dispatch', 'registerSocketEvent' and
+        //:   'deregisterSocketEvent' tests whose scripts do not depend on
+        //:   level-triggered re-reporting, and a custom set of scripts, on
+        //:   an edge-triggered object.  (C-3)
+        //
+        // Testing:
+        //   DefaultEventManager(TriggerMode, TimeMetrics *, Allocator *);
+        //   TriggerMode triggerMode() const;
+        //   EDGE-TRIGGERED MODE
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING EDGE-TRIGGERED MODE" << endl
+                                  << "===========================" << endl;
+
+        if (verbose) cout << "\tTrigger modes." << endl;
+        {
+            Obj mA(&timeMetric, &testAllocator);
+            ASSERT(Obj::e_LEVEL_TRIGGERED == mA.triggerMode());
+
+            Obj mB(Obj::e_LEVEL_TRIGGERED, &timeMetric, &testAllocator);
+            ASSERT(Obj::e_LEVEL_TRIGGERED == mB.triggerMode());
+
+            Obj mC(Obj::e_EDGE_TRIGGERED, &timeMetric, &testAllocator);
+            ASSERT(Obj::e_EDGE_TRIGGERED == mC.triggerMode());
+
+            Obj mD(Obj::e_EDGE_TRIGGERED);
+            ASSERT(Obj::e_EDGE_TRIGGERED == mD.triggerMode());
+        }
+
+        if (verbose) cout << "\tStandard edge-triggered test." << endl;
+        {
+            Obj mX(Obj::e_EDGE_TRIGGERED, &timeMetric, &testAllocator);
+            int notFailed =
+                        !btlso::EventManagerTester::testDispatchEdgeTriggered(
+                                                                  &mX,
+                                                                  controlFlag);
+            ASSERT("BLACK-BOX (standard) TEST FAILED" && notFailed);
+        }
+
+        if (verbose) cout << "\tStandard registration tests." << endl;
+        {
+            typedef btlso::EventManagerTester Tester;
+
+            Obj mX(Obj::e_EDGE_TRIGGERED, &timeMetric, &testAllocator);
+            ASSERT(0 == Tester::testRegisterSocketEvent(&mX, controlFlag));
+            ASSERT(0 == Tester::testDeregisterSocketEvent(&mX, controlFlag));
+            ASSERT(0 == Tester::testDeregisterSocket(&mX, controlFlag));
+            ASSERT(0 == Tester::testDeregisterAll(&mX, controlFlag));
+        }
+
+        if (verbose) cout << "\tCustom edge-triggered test." << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+                {L_, 0, "Dn0,0"                                              },
+                {L_, 0, "+0w2; Dn,1; Dn100,0"                                },
+                {L_, 0, "+0w40; +0r3; Dn0,1; W0,30; Dn0,2; Dn100,0"          },
+                {L_, 0, "+0r3; W0,30; Dn,1; Dn100,0; -0r; +0r27; Dn,1;"
+                        "Dn100,0"                                            },
+                {L_, 0, "+0r3; +0w40; Dn,1; W0,3; -0w; Dn,1; Dn100,0"        },
+                {L_, 0, "+0r3; +1r3; +2r3; +3r3; W0,6; W2,6; Dn,2; Dn100,0;"
+                        "W1,3; W3,3; Dn,2; W0,3; W2,3; Dn,2; Dn100,0"        },
+                {L_, 0, "+0r3,{-0r; +0r3}; W0,6; Dn,1; Dn,1; Dn100,0"        },
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(Obj::e_EDGE_TRIGGERED, &timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                btlso::EventManagerTestPair socketPairs[4];
+
+                const int NUM_PAIR = sizeof socketPairs /sizeof socketPairs[0];
+
+                for (int j = 0; j < NUM_PAIR; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+        }
+      } break;
       case 13: {
         // -----------------------------------------------------------------
         // TESTING 'hasLimitedSocketCapacity'
@@ -0,0 +1,1202 @@
+// btlso_defaulteventmanager_iouring.cpp                              -*-C++-*-
+#include <btlso_defaulteventmanager_iouring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlso_defaulteventmanager_iouring_cpp,"$Id$ $CSID$")
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+#include <btlso_flag.h>
+#include <btlso_timemetrics.h>
+
+#include <bdlt_currenttime.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_c_errno.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+// The kernel interface is declared by '<linux/io_uring.h>', which is missing
+// from older kernel headers; in that case 'isSupported' returns 'false'.
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#define BTLSO_DEFAULTEVENTMANAGER_IOURING_HAS_HEADER 1
+#include <linux/io_uring.h>
+#endif
+#endif
+
+namespace BloombergLP {
+
+namespace btlso {
+
+namespace {
+
+enum {
+    k_RING_ENTRIES = 256  // capacity of the submission ring
+};
+
+int sleep(int                       *resultErrno,
+          const bsls::TimeInterval&  timeout,
+          int                        flags,
+          btlso::TimeMetrics        *metrics)
+{
+    bsls::TimeInterval now(bdlt::CurrentTime::now());
+
+    while (timeout > now) {
+        bsls::TimeInterval currTimeout(timeout - now);
+        struct timespec    ts;
+
+        ts.tv_sec  = static_cast<time_t>(currTimeout.seconds());
+        ts.tv_nsec = static_cast<long>(currTimeout.nanoseconds());
+
+        // Sleep till it's time.
+
+        int savedErrno;
+        int rc;
+        if (metrics) {
+            metrics->switchTo(btlso::TimeMetrics::e_IO_BOUND);
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+            metrics->switchTo(btlso::TimeMetrics::e_CPU_BOUND);
+        }
+        else {
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+        }
+
+        errno = 0;
+        *resultErrno = savedErrno;
+        if (0 > rc) {
+            BSLS_ASSERT(savedErrno == EINTR);
+
+            if (flags & btlso::Flag::k_ASYNC_INTERRUPT) {
+                // We're allowing async interrupts.
+
+                return -1;                                            // RETURN
+            }
+        }
+        now = bdlt::CurrentTime::now();
+    }
+    return 0;
+}
+
+int translateEventToMask(btlso::EventType::Type event)
+{
+    switch (event) {
+      case btlso::EventType::e_ACCEPT:                          // FALL THROUGH
+      case btlso::EventType::e_READ: {
+        return POLLIN;                                                // RETURN
+      } break;
+      case btlso::EventType::e_CONNECT:                         // FALL THROUGH
+      case btlso::EventType::e_WRITE: {
+        return POLLOUT;                                               // RETURN
+      } break;
+      default: {
+        BSLS_ASSERT("Invalid event (must be unreachable)" && 0);
+
+        return -1;                                                    // RETURN
+      } break;
+    }
+}
+
+const bsls::Types::Uint64 k_IO_REQUEST_BIT =
+                                     static_cast<bsls::Types::Uint64>(1) << 63;
+    // Set in the user data of the I/O requests, which is otherwise their id.
+    // Note that the user data of a poll request has this bit clear, since
+    // socket handles are not negative.
+
+inline
+bsls::Types::Uint64 makeUserData(int handle, unsigned int id)
+    // Return the user data identifying the poll request having the specified
+    // 'id' for the specified 'handle'.  Note that 0 identifies poll and I/O
+    // request removals (i.e., cancellations), whose completions are ignored.
+{
+    return static_cast<bsls::Types::Uint64>(static_cast<unsigned int>(handle))
+                                                                   << 32 | id;
+}
+
+inline
+unsigned int *ringField(void *ring, unsigned int offset)
+    // Return the address of the field at the specified 'offset' in the
+    // specified mapped 'ring'.
+{
+    return reinterpret_cast<unsigned int *>(static_cast<char *>(ring)
+                                                                    + offset);
+}
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_HAS_HEADER
+
+inline
+int ioUringSetup(unsigned int entries, struct io_uring_params *params)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+inline
+int ioUringEnter(int           ringFd,
+                 unsigned int  toSubmit,
+                 unsigned int  minComplete,
+                 unsigned int  flags,
+                 const void   *arg,
+                 bsl::size_t   argSize)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter,
+                                    ringFd,
+                                    toSubmit,
+                                    minComplete,
+                                    flags,
+                                    arg,
+                                    argSize));
+}
+
+const unsigned int k_REQUIRED_FEATURES = IORING_FEAT_SINGLE_MMAP
+                                       | IORING_FEAT_NODROP
+                                       | IORING_FEAT_FAST_POLL
+                                       | IORING_FEAT_EXT_ARG;
+    // Note that, with 'IORING_FEAT_FAST_POLL', an I/O request on a socket that
+    // is not ready waits for the socket to become ready, instead of failing
+    // with 'EAGAIN' or blocking a kernel worker thread.
+
+#endif
+
+}  // close unnamed namespace
+
+           // --------------------------------------------
+           // class DefaultEventManager<Platform::IOURING>
+           // --------------------------------------------
+
+typedef btlso::DefaultEventManager<btlso::Platform::IOURING> EventManagerName;
+    // Alias for brevity.
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_HAS_HEADER
+
+// PRIVATE MANIPULATORS
+void EventManagerName::arm(EventMap::value_type *entry)
+{
+    HandleEvents& events = entry->second;
+
+    if (events.d_armedMask == events.d_mask) {
+        return;                                                       // RETURN
+    }
+    disarm(entry);
+    if (0 == events.d_mask) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == ++d_nextId) {
+        ++d_nextId;  // 0 identifies removal requests
+    }
+    events.d_armedMask = events.d_mask;
+    events.d_armedId   = d_nextId;
+
+    queueRequest(IORING_OP_POLL_ADD,
+                 entry->first,
+                 events.d_mask,
+                 makeUserData(entry->first, d_nextId));
+}
+
+void EventManagerName::disarm(EventMap::value_type *entry)
+{
+    HandleEvents& events = entry->second;
+
+    if (0 == events.d_armedMask) {
+        return;                                                       // RETURN
+    }
+    queueRequest(IORING_OP_POLL_REMOVE,
+                 -1,
+                 0,
+                 makeUserData(entry->first, events.d_armedId));
+    events.d_armedMask = 0;
+}
+
+void EventManagerName::discardIo()
+{
+    // Cancel the requests whose completion is not collected yet, and destroy
+    // the callbacks of the others, except the one being invoked (which is
+    // destroyed by 'dispatchCallbacks' when it returns).
+
+    int numIncomplete = 0;
+
+    IoRequestMap::iterator it = d_ioRequests.begin();
+    while (d_ioRequests.end() != it) {
+        if (!it->second.d_isCompleted) {
+            struct io_uring_sqe *sqe =
+                              static_cast<struct io_uring_sqe *>(nextEntry());
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd     = -1;
+            sqe->addr   = k_IO_REQUEST_BIT | it->first;
+            ++numIncomplete;
+            ++it;
+        }
+        else if (d_invokingIoId != it->first) {
+            it = d_ioRequests.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    // The kernel may access the buffers of a request until it posts its
+    // completion, so wait for every completion.  Note that the completions
+    // of poll requests are dropped: this method is called only when every
+    // socket is deregistered.
+
+    while (numIncomplete) {
+        const int rc = submit(1, 0);
+        BSLS_ASSERT(0 == rc || EINTR == rc);
+        (void)rc;
+
+        unsigned int       head = *d_ring.d_cqHead_p;
+        const unsigned int tail = __atomic_load_n(d_ring.d_cqTail_p,
+                                                  __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            const struct io_uring_cqe *cqe =
+                  static_cast<const struct io_uring_cqe *>(d_ring.d_cqes_p)
+                                                   + (head & d_ring.d_cqMask);
+            const bsls::Types::Uint64  userData = cqe->user_data;
+
+            // Consume the completion before destroying the callback, which
+            // may hold the last reference to an object calling back into
+            // this event manager on destruction.
+
+            ++head;
+            __atomic_store_n(d_ring.d_cqHead_p, head, __ATOMIC_RELEASE);
+
+            if (userData & k_IO_REQUEST_BIT) {
+                d_ioRequests.erase(userData & ~k_IO_REQUEST_BIT);
+                --numIncomplete;
+            }
+        }
+    }
+}
+
+void *EventManagerName::nextEntry()
+{
+    const unsigned int head = __atomic_load_n(d_ring.d_sqHead_p,
+                                              __ATOMIC_ACQUIRE);
+    if (d_sqTail - head == d_ring.d_sqEntries) {
+        const int rc = submit(0, 0);
+        BSLS_ASSERT_OPT(0 == rc);
+        (void)rc;
+    }
+
+    const unsigned int  index = d_sqTail & d_ring.d_sqMask;
+    struct io_uring_sqe *sqe  =
+                         static_cast<struct io_uring_sqe *>(d_ring.d_sqes_p)
+                                                                      + index;
+
+    bsl::memset(sqe, 0, sizeof *sqe);
+    d_ring.d_sqArray_p[index] = index;
+    ++d_sqTail;
+
+    return sqe;
+}
+
+bsls::Types::Uint64 EventManagerName::queueIo(int                opcode,
+                                              int                handle,
+                                              const void        *buffers,
+                                              int                numBuffers,
+                                              const IoCallback&  callback)
+{
+    BSLS_ASSERT(0 < numBuffers);
+
+    const bsls::Types::Uint64 id = ++d_nextIoId;
+
+    IoRequest& request = d_ioRequests[id];
+    request.d_callback    = callback;
+    request.d_isCompleted = false;
+
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(nextEntry());
+    sqe->opcode    = static_cast<unsigned char>(opcode);
+    sqe->fd        = handle;
+    sqe->addr      = reinterpret_cast<bsls::Types::Uint64>(buffers);
+    sqe->len       = static_cast<unsigned int>(numBuffers);
+    sqe->user_data = k_IO_REQUEST_BIT | id;
+
+    return id;
+}
+
+void EventManagerName::queueRequest(int                 opcode,
+                                    int                 handle,
+                                    int                 mask,
+                                    bsls::Types::Uint64 userData)
+{
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(nextEntry());
+
+    sqe->opcode = static_cast<unsigned char>(opcode);
+    sqe->fd     = handle;
+    if (IORING_OP_POLL_REMOVE == opcode) {
+        sqe->addr      = userData;
+        sqe->user_data = 0;
+    }
+    else {
+        sqe->poll32_events = static_cast<unsigned int>(mask);
+        sqe->user_data     = userData;
+    }
+}
+
+int EventManagerName::submit(int                       minComplete,
+                             const bsls::TimeInterval *timeout)
+{
+    // Publish the queued entries before entering the kernel.
+
+    __atomic_store_n(d_ring.d_sqTail_p, d_sqTail, __ATOMIC_RELEASE);
+
+    struct __kernel_timespec      ts;
+    struct io_uring_getevents_arg arg;
+    unsigned int                  flags = 0;
+
+    if (minComplete) {
+        flags |= IORING_ENTER_GETEVENTS;
+    }
+    if (timeout) {
+        ts.tv_sec  = timeout->seconds();
+        ts.tv_nsec = timeout->nanoseconds();
+
+        bsl::memset(&arg, 0, sizeof arg);
+        arg.ts = reinterpret_cast<bsls::Types::Uint64>(&ts);
+        flags |= IORING_ENTER_EXT_ARG;
+    }
+
+    while (true) {
+        const unsigned int toSubmit =
+             d_sqTail - __atomic_load_n(d_ring.d_sqHead_p, __ATOMIC_ACQUIRE);
+
+        const int rc = ioUringEnter(d_ringFd,
+                                    toSubmit,
+                                    minComplete,
+                                    flags,
+                                    timeout ? &arg : 0,
+                                    timeout ? sizeof arg : 0);
+        if (0 <= rc) {
+            if (static_cast<unsigned int>(rc) < toSubmit && !minComplete) {
+                // The kernel may consume fewer entries than submitted if it
+                // is short of memory; try again.
+
+                continue;
+            }
+            return 0;                                                 // RETURN
+        }
+        if (EINTR == errno && !minComplete) {
+            continue;
+        }
+        return errno;                                                 // RETURN
+    }
+}
+
+int EventManagerName::reapCompletions()
+{
+    d_signaled.clear();
+    d_ioCompletions.clear();
+
+    unsigned int       head = *d_ring.d_cqHead_p;
+    const unsigned int tail = __atomic_load_n(d_ring.d_cqTail_p,
+                                              __ATOMIC_ACQUIRE);
+
+    for (; head != tail; ++head) {
+        const struct io_uring_cqe *cqe =
+                  static_cast<const struct io_uring_cqe *>(d_ring.d_cqes_p)
+                                                   + (head & d_ring.d_cqMask);
+
+        if (0 == cqe->user_data) {
+            continue;  // completion of a removal request
+        }
+
+        if (cqe->user_data & k_IO_REQUEST_BIT) {
+            const IoCompletion completion = {
+                                         cqe->user_data & ~k_IO_REQUEST_BIT,
+                                         cqe->res };
+
+            IoRequestMap::iterator it = d_ioRequests.find(completion.d_id);
+            BSLS_ASSERT(d_ioRequests.end() != it);
+
+            it->second.d_isCompleted = true;
+            d_ioCompletions.push_back(completion);
+            continue;
+        }
+
+        const int          handle = static_cast<int>(cqe->user_data >> 32);
+        const unsigned int id     = static_cast<unsigned int>(cqe->user_data);
+
+        EventMap::iterator it = d_events.find(handle);
+        if (d_events.end() == it
+         || !it->second.d_isValid
+         || 0 == it->second.d_armedMask
+         || id != it->second.d_armedId) {
+            continue;  // stale request (since replaced or removed)
+        }
+
+        // The request is one-shot, so it is no longer pending.
+
+        it->second.d_armedMask = 0;
+
+        int revents = cqe->res;
+        if (0 > revents) {
+            if (-EBADF == revents) {
+                // The socket was closed without being deregistered; drop it
+                // silently (as 'epoll' does) by not re-arming it.
+
+                continue;
+            }
+            revents = POLLERR;
+        }
+
+        Signaled signaled = { &*it, revents };
+        d_signaled.push_back(signaled);
+    }
+
+    __atomic_store_n(d_ring.d_cqHead_p, head, __ATOMIC_RELEASE);
+
+    return static_cast<int>(d_signaled.size() + d_ioCompletions.size());
+}
+
+int EventManagerName::dispatchCallbacks()
+{
+    int numCallbacks = 0;
+
+    // Letting people know that we're executing user-callbacks.
+
+    d_isInvokingCb = !d_signaled.empty() || !d_ioCompletions.empty();
+
+    const int numSignaled = static_cast<int>(d_signaled.size());
+    for (int i = 0; i < numSignaled; ++i) {
+        const int     revents = d_signaled[i].d_revents;
+        HandleEvents *events  = &d_signaled[i].d_entry_p->second;
+
+        // If false, this means that a callback executed during this
+        // 'dispatchCallbacks' run removed this handle.
+
+        if (!events->d_isValid) {
+            continue;
+        }
+
+        // Read/Accept.
+
+        if (revents & (POLLIN | POLLERR | POLLHUP)
+         && events->d_readCallback) {
+            events->d_readCallback.operator()();
+            ++numCallbacks;
+
+            // Need to recheck the valid bit, the previous callback could have
+            // un-registered it.
+
+            if (!events->d_isValid) {
+                continue;
+            }
+        }
+
+        // Write/Connect.
+
+        if (revents & (POLLOUT | POLLERR | POLLHUP)
+         && events->d_writeCallback) {
+            events->d_writeCallback.operator()();
+            ++numCallbacks;
+        }
+    }
+
+    // Invoke the callbacks of the completed I/O requests.  The callback of a
+    // request is invoked in place, and destroyed when it returns.
+
+    const int numIoCompletions = static_cast<int>(d_ioCompletions.size());
+    for (int i = 0; i < numIoCompletions; ++i) {
+        const bsls::Types::Uint64 id = d_ioCompletions[i].d_id;
+
+        IoRequestMap::iterator it = d_ioRequests.find(id);
+        if (d_ioRequests.end() == it) {
+            // The request was discarded by a callback (see 'deregisterAll').
+
+            continue;
+        }
+
+        d_invokingIoId = id;
+        it->second.d_callback(d_ioCompletions[i].d_result);
+        d_invokingIoId = 0;
+
+        // Note that 'it' may have been invalidated by the callback.
+
+        d_ioRequests.erase(id);
+        ++numCallbacks;
+    }
+    d_ioCompletions.clear();
+
+    d_isInvokingCb = false;
+
+    // Re-arm the one-shot poll requests of the sockets still registered; the
+    // requests are submitted by the next 'io_uring_enter'.
+
+    for (int i = 0; i < numSignaled; ++i) {
+        EventMap::value_type *entry = d_signaled[i].d_entry_p;
+        if (entry->second.d_isValid) {
+            arm(entry);
+        }
+    }
+    d_signaled.clear();
+
+    // Remove from the map any entry deregistered during a callback.  Not
+    // removing them in the loop above keeps the pointers in 'd_signaled'
+    // valid.
+
+    bsl::vector<EventMap::iterator>::const_iterator it;
+    for (it = d_entriesBeingRemoved.begin();
+         d_entriesBeingRemoved.end() != it;
+         ++it) {
+        if ((*it)->second.d_isValid) {
+            // Item was first removed, then registered again.  We do not have
+            // anything to do.
+
+            continue;
+        }
+        d_events.erase(*it);
+    }
+    d_entriesBeingRemoved.clear();
+    return numCallbacks;
+}
+
+int EventManagerName::dispatchImp(int                       flags,
+                                  const bsls::TimeInterval *timeout)
+{
+    bsls::TimeInterval now;
+    if (timeout) {
+        now = bdlt::CurrentTime::now();
+    }
+    int numCallbacks = 0;                    // number of callbacks dispatched
+    const bool allowAsyncInterrupts =
+                               (0 != (btlso::Flag::k_ASYNC_INTERRUPT & flags));
+
+    do {
+        int numReady = 0;            // number of completed requests
+        int savedErrno = 0;          // error returned by 'submit'
+        while (1) {
+            bsls::TimeInterval  remaining;
+            bsls::TimeInterval *waitTimeout = 0;
+            int                 minComplete = 1;
+
+            if (timeout) {
+                if (*timeout <= now) {
+                    // Do not wait for completions.
+
+                    minComplete = 0;
+                }
+                else {
+                    remaining   = *timeout - now;
+                    waitTimeout = &remaining;
+                }
+            }
+
+            if (d_timeMetric_p) {
+                d_timeMetric_p->switchTo(btlso::TimeMetrics::e_IO_BOUND);
+            }
+
+            savedErrno = submit(minComplete, waitTimeout);
+
+            if (d_timeMetric_p) {
+                d_timeMetric_p->switchTo(btlso::TimeMetrics::e_CPU_BOUND);
+            }
+            BSLS_ASSERT(0 == savedErrno
+                     || EINTR == savedErrno
+                     || ETIME == savedErrno
+                     || EBUSY == savedErrno
+                     || EAGAIN == savedErrno);
+
+            numReady = reapCompletions();
+            errno = 0;
+
+            if (numReady > 0
+             || (EINTR == savedErrno && allowAsyncInterrupts)) {
+                // Either a socket is ready or we've been interrupted and the
+                // user wants to know.
+
+                break;
+            }
+            if (timeout) {
+                now = bdlt::CurrentTime::now();
+                if (now >= *timeout) {
+                    // We reached the timeout.
+
+                    break;
+                }
+            }
+        }
+
+        if (0 == numReady) {
+            return EINTR == savedErrno && allowAsyncInterrupts
+                   ? -1
+                   : 0;                                               // RETURN
+        }
+        numCallbacks += dispatchCallbacks();
+        if (timeout) {
+            now = bdlt::CurrentTime::now();
+        }
+    } while (0 == numCallbacks && (0 == timeout || now < *timeout));
+
+    return numCallbacks;
+}
+
+// PUBLIC CLASS METHODS
+bool EventManagerName::isSupported()
+{
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    const int fd = ioUringSetup(4, &params);
+    if (-1 == fd) {
+        return false;                                                 // RETURN
+    }
+    close(fd);
+    return k_REQUIRED_FEATURES == (params.features & k_REQUIRED_FEATURES);
+}
+
+// CREATORS
+EventManagerName::DefaultEventManager(btlso::TimeMetrics *timeMetric,
+                                      bslma::Allocator   *basicAllocator)
+: d_ringFd(-1)
+, d_sqTail(0)
+, d_nextId(0)
+, d_signaled(basicAllocator)
+, d_nextIoId(0)
+, d_ioRequests(basicAllocator)
+, d_ioCompletions(basicAllocator)
+, d_invokingIoId(0)
+, d_isInvokingCb(false)
+, d_timeMetric_p(timeMetric)
+, d_events(128, bsl::hash<int>(), bsl::equal_to<int>(), basicAllocator)
+, d_entriesBeingRemoved(basicAllocator)
+, d_numEvents(0)
+{
+    bsl::memset(&d_ring, 0, sizeof d_ring);
+
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+    params.flags = IORING_SETUP_CLAMP;
+
+    d_ringFd = ioUringSetup(k_RING_ENTRIES, &params);
+    if (-1 == d_ringFd) {
+        bsl::perror("io_uring_setup returned ");
+        BSLS_ASSERT_OPT("io_uring_setup() failed" && 0);
+    }
+    BSLS_ASSERT_OPT(k_REQUIRED_FEATURES ==
+                                    (params.features & k_REQUIRED_FEATURES));
+
+    // With 'IORING_FEAT_SINGLE_MMAP', both rings share a single mapping.
+
+    d_ring.d_sqRingSize = params.sq_off.array
+                        + params.sq_entries * sizeof(unsigned int);
+    d_ring.d_cqRingSize = params.cq_off.cqes
+                        + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (d_ring.d_cqRingSize > d_ring.d_sqRingSize) {
+        d_ring.d_sqRingSize = d_ring.d_cqRingSize;
+    }
+    d_ring.d_cqRingSize = 0;
+
+    d_ring.d_sqRing_p = mmap(0,
+                             d_ring.d_sqRingSize,
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE,
+                             d_ringFd,
+                             IORING_OFF_SQ_RING);
+    BSLS_ASSERT_OPT(MAP_FAILED != d_ring.d_sqRing_p);
+    d_ring.d_cqRing_p = d_ring.d_sqRing_p;
+
+    d_ring.d_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    d_ring.d_sqes_p   = mmap(0,
+                             d_ring.d_sqesSize,
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE,
+                             d_ringFd,
+                             IORING_OFF_SQES);
+    BSLS_ASSERT_OPT(MAP_FAILED != d_ring.d_sqes_p);
+
+    d_ring.d_sqHead_p   = ringField(d_ring.d_sqRing_p, params.sq_off.head);
+    d_ring.d_sqTail_p   = ringField(d_ring.d_sqRing_p, params.sq_off.tail);
+    d_ring.d_sqArray_p  = ringField(d_ring.d_sqRing_p, params.sq_off.array);
+    d_ring.d_sqMask     = *ringField(d_ring.d_sqRing_p,
+                                     params.sq_off.ring_mask);
+    d_ring.d_sqEntries  = *ringField(d_ring.d_sqRing_p,
+                                     params.sq_off.ring_entries);
+    d_ring.d_cqHead_p   = ringField(d_ring.d_cqRing_p, params.cq_off.head);
+    d_ring.d_cqTail_p   = ringField(d_ring.d_cqRing_p, params.cq_off.tail);
+    d_ring.d_cqes_p     = ringField(d_ring.d_cqRing_p, params.cq_off.cqes);
+    d_ring.d_cqMask     = *ringField(d_ring.d_cqRing_p,
+                                     params.cq_off.ring_mask);
+
+    d_sqTail = *d_ring.d_sqTail_p;
+}
+
+EventManagerName::~DefaultEventManager()
+{
+    // Closing the ring cancels the pending poll requests, but the buffers of
+    // the pending I/O requests must outlive them.
+
+    discardIo();
+
+    munmap(d_ring.d_sqes_p, d_ring.d_sqesSize);
+    munmap(d_ring.d_sqRing_p, d_ring.d_sqRingSize);
+
+    int rc = close(d_ringFd);
+    BSLS_ASSERT(0 == rc);
+    (void)rc;
+}
+
+// MANIPULATORS
+void EventManagerName::deregisterAll()
+{
+    d_numEvents = 0;
+    d_entriesBeingRemoved.reserve(d_events.size());
+
+    bool isArmed = false;
+    for (EventMap::iterator it = d_events.begin();
+         d_events.end() != it;
+         ++it) {
+
+        if (!it->second.d_isValid) {
+            continue;
+        }
+        isArmed = isArmed || it->second.d_armedMask;
+        disarm(&*it);
+
+        it->second.d_isValid = false;
+        it->second.d_mask = 0;
+        it->second.d_writeCallback = btlso::EventManager::Callback();
+        it->second.d_readCallback = btlso::EventManager::Callback();
+        d_entriesBeingRemoved.push_back(it);
+    }
+
+    // If we're in a user-specified callback, we'll clean up in
+    // 'dispatchCallbacks'.  That keeps every pointer in 'd_signaled' valid.
+
+    if (!d_isInvokingCb) {
+        d_events.clear();
+        d_signaled.clear();
+        d_entriesBeingRemoved.clear();
+    }
+
+    // A pending poll request holds a reference to its socket, so submit the
+    // removals now: the sockets may be closed as soon as we return.  Note
+    // that 'discardIo' submits them as well.
+
+    if (!d_ioRequests.empty()) {
+        discardIo();
+    }
+    else if (isArmed) {
+        submit(0, 0);
+    }
+}
+
+void EventManagerName::deregisterSocketEvent(
+                                     const btlso::SocketHandle::Handle& handle,
+                                     btlso::EventType::Type             event)
+{
+    EventMap::iterator it = d_events.find(handle);
+
+    if (d_events.end() == it || !it->second.d_isValid) {
+        // Should really be an assert.
+
+        return;                                                       // RETURN
+    }
+    HandleEvents *regEvents = &it->second;
+
+    // Reset callbacks.
+
+    if (btlso::EventType::e_READ == event
+     || btlso::EventType::e_ACCEPT == event) {
+
+        if (!(regEvents->d_readCallback
+         && event == regEvents->d_readEventType)) {
+            return ;                                                  // RETURN
+        }
+        regEvents->d_readCallback = btlso::EventManager::Callback();
+    }
+    else {
+        if (!(regEvents->d_writeCallback
+         && event == regEvents->d_writeEventType)) {
+            return;                                                   // RETURN
+        }
+        regEvents->d_writeCallback = btlso::EventManager::Callback();
+    }
+    --d_numEvents;
+
+    const int pollEvent = translateEventToMask(event);
+    BSLS_ASSERT(regEvents->d_mask & pollEvent);
+
+    // Clear the corresponding event bit to get the new event mask.
+
+    regEvents->d_mask ^= pollEvent;
+    if (0 == regEvents->d_mask) {
+        // There is no more event to monitor for this handle.
+
+        const bool isArmed = regEvents->d_armedMask;
+        disarm(&*it);
+
+        if (d_isInvokingCb) {
+            // This method has been invoked in a user-callback from
+            // 'dispatchCallbacks'.  We can't remove the entry from 'd_events',
+            // otherwise it would invalidate the pointers in 'd_signaled'.
+            // We'll just add it to 'd_entriesBeingRemoved' and
+            // 'dispatchCallbacks' will clean it up when it is done.
+
+            it->second.d_isValid = false;
+            d_entriesBeingRemoved.push_back(it);
+        }
+        else {
+            d_events.erase(it);
+        }
+
+        // See 'deregisterAll'.
+
+        if (isArmed) {
+            submit(0, 0);
+        }
+        return;                                                       // RETURN
+    }
+
+    // We're still interested in another event for this handle; replace the
+    // pending request if there is one, and otherwise the socket will be
+    // re-armed with the new mask after its callbacks are invoked.
+
+    if (regEvents->d_armedMask) {
+        arm(&*it);
+    }
+}
+
+int EventManagerName::deregisterSocket(
+                                     const btlso::SocketHandle::Handle& handle)
+{
+    EventMap::iterator it = d_events.find(handle);
+    if (d_events.end() == it || !it->second.d_isValid) {
+        return 0;                                                     // RETURN
+    }
+
+    int numEvents = it->second.d_readCallback ? 1 : 0;
+    numEvents += it->second.d_writeCallback ? 1 : 0;
+    BSLS_ASSERT(numEvents);
+
+    const bool isArmed = it->second.d_armedMask;
+    disarm(&*it);
+
+    if (d_isInvokingCb) {
+        // See 'deregisterSocketEvent'.
+
+        it->second.d_isValid = false;
+        it->second.d_mask = 0;
+        it->second.d_writeCallback = btlso::EventManager::Callback();
+        it->second.d_readCallback = btlso::EventManager::Callback();
+        d_entriesBeingRemoved.push_back(it);
+    }
+    else {
+        d_events.erase(it);
+    }
+    d_numEvents -= numEvents;
+
+    // See 'deregisterAll'.
+
+    if (isArmed) {
+        submit(0, 0);
+    }
+
+    return numEvents;
+}
+
+int EventManagerName::dispatch(const bsls::TimeInterval& timeout,
+                               int                       flags)
+{
+    if (0 == numEvents() && d_ioRequests.empty()) {
+        int dummy;
+        return sleep(&dummy, timeout, flags, d_timeMetric_p);         // RETURN
+    }
+    return dispatchImp(flags, &timeout);
+}
+
+int EventManagerName::dispatch(int flags)
+{
+    if (0 == numEvents() && d_ioRequests.empty()) {
+        return 0;                                                     // RETURN
+    }
+    return dispatchImp(flags, 0);
+}
+
+void EventManagerName::cancelIo(bsls::Types::Uint64 requestId)
+{
+    IoRequestMap::const_iterator it = d_ioRequests.find(requestId);
+    if (d_ioRequests.end() == it || it->second.d_isCompleted) {
+        return;                                                       // RETURN
+    }
+
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(nextEntry());
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd     = -1;
+    sqe->addr   = k_IO_REQUEST_BIT | requestId;
+
+    // As for poll requests (see 'deregisterAll'), submit the cancellation now
+    // so that the socket may be closed once the callback is invoked.
+
+    submit(0, 0);
+}
+
+bsls::Types::Uint64 EventManagerName::submitReadv(
+                                const btlso::SocketHandle::Handle&  handle,
+                                const btls::Iovec                  *buffers,
+                                int                                 numBuffers,
+                                const IoCallback&                   callback)
+{
+    return queueIo(IORING_OP_READV, handle, buffers, numBuffers, callback);
+}
+
+bsls::Types::Uint64 EventManagerName::submitWritev(
+                                const btlso::SocketHandle::Handle&  handle,
+                                const btls::Ovec                   *buffers,
+                                int                                 numBuffers,
+                                const IoCallback&                   callback)
+{
+    return queueIo(IORING_OP_WRITEV, handle, buffers, numBuffers, callback);
+}
+
+int EventManagerName::registerSocketEvent(
+                                 const btlso::SocketHandle::Handle&   handle,
+                                 const btlso::EventType::Type         event,
+                                 const btlso::EventManager::Callback& callback)
+{
+    EventMap::iterator it = d_events.find(handle);
+
+    if (d_events.end() == it) {
+        bsl::pair<EventMap::iterator, bool> ret = d_events.insert(
+                                       bsl::make_pair(handle, HandleEvents()));
+        BSLS_ASSERT(ret.second);
+        it = ret.first;
+
+        // Set initial state.
+
+        it->second.d_mask      = 0;
+        it->second.d_armedMask = 0;
+        it->second.d_armedId   = 0;
+        it->second.d_isValid   = true;
+    }
+
+    // Register the callback and event type.
+
+    HandleEvents *regEvents = &it->second;
+
+    if (btlso::EventType::e_READ == event
+     || btlso::EventType::e_ACCEPT == event) {
+
+        BSLS_ASSERT(!it->second.d_isValid
+                 || !regEvents->d_readCallback
+                 || event == regEvents->d_readEventType);
+
+        regEvents->d_readCallback  = callback;
+        regEvents->d_readEventType = event;
+    }
+    else {
+        BSLS_ASSERT(!it->second.d_isValid
+                 || !regEvents->d_writeCallback
+                 || event == regEvents->d_writeEventType);
+
+        regEvents->d_writeCallback  = callback;
+        regEvents->d_writeEventType = event;
+    }
+
+    const int newMask = regEvents->d_mask | translateEventToMask(event);
+    if (!it->second.d_isValid) {
+        // We are being called from an user-specified callback in
+        // 'dispatchCallbacks'.  This handle was deregistered during a
+        // previous callback and is being registered again.  We have to
+        // revalidate it, and remove it from 'd_entriesBeingRemoved'.
+
+        BSLS_ASSERT(d_isInvokingCb);
+        BSLS_ASSERT(0 == regEvents->d_mask);
+
+        regEvents->d_isValid = true;
+
+        bsl::vector<EventMap::iterator>::iterator v_it;
+        for (v_it  = d_entriesBeingRemoved.begin();
+             v_it != d_entriesBeingRemoved.end()  ; ++v_it) {
+
+            if (*v_it == it) {
+                d_entriesBeingRemoved.erase(v_it);
+                break;
+            }
+        }
+    }
+    else if (newMask == regEvents->d_mask) {
+        // We just updated the callback.
+
+        return 0;                                                     // RETURN
+    }
+    ++d_numEvents;
+
+    // Assert that if two events are registered at the same, they can
+    // only READ and WRITE.
+
+    BSLS_ASSERT(0 == (newMask & (newMask - 1)) // only 1 bit set
+             || (btlso::EventType::e_READ == regEvents->d_readEventType
+              && btlso::EventType::e_WRITE == regEvents->d_writeEventType));
+
+    regEvents->d_mask = newMask;
+    arm(&*it);
+
+    return 0;
+}
+
+#else  // BTLSO_DEFAULTEVENTMANAGER_IOURING_HAS_HEADER
+
+// PUBLIC CLASS METHODS
+bool EventManagerName::isSupported()
+{
+    return false;
+}
+
+// CREATORS
+EventManagerName::DefaultEventManager(btlso::TimeMetrics *timeMetric,
+                                      bslma::Allocator   *basicAllocator)
+: d_ringFd(-1)
+, d_sqTail(0)
+, d_nextId(0)
+, d_signaled(basicAllocator)
+, d_nextIoId(0)
+, d_ioRequests(basicAllocator)
+, d_ioCompletions(basicAllocator)
+, d_invokingIoId(0)
+, d_isInvokingCb(false)
+, d_timeMetric_p(timeMetric)
+, d_events(128, bsl::hash<int>(), bsl::equal_to<int>(), basicAllocator)
+, d_entriesBeingRemoved(basicAllocator)
+, d_numEvents(0)
+{
+    BSLS_ASSERT_OPT("io_uring is not supported" && 0);
+}
+
+EventManagerName::~DefaultEventManager()
+{
+}
+
+// MANIPULATORS
+void EventManagerName::deregisterAll()
+{
+}
+
+void EventManagerName::deregisterSocketEvent(
+                                            const btlso::SocketHandle::Handle&,
+                                            btlso::EventType::Type)
+{
+}
+
+int EventManagerName::deregisterSocket(const btlso::SocketHandle::Handle&)
+{
+    return 0;
+}
+
+int EventManagerName::dispatch(const bsls::TimeInterval&, int)
+{
+    return -2;
+}
+
+int EventManagerName::dispatch(int)
+{
+    return -2;
+}
+
+void EventManagerName::cancelIo(bsls::Types::Uint64)
+{
+}
+
+bsls::Types::Uint64 EventManagerName::submitReadv(
+                                            const btlso::SocketHandle::Handle&,
+                                            const btls::Iovec *,
+                                            int,
+                                            const IoCallback&)
+{
+    return 0;
+}
+
+bsls::Types::Uint64 EventManagerName::submitWritev(
+                                            const btlso::SocketHandle::Handle&,
+                                            const btls::Ovec *,
+                                            int,
+                                            const IoCallback&)
+{
+    return 0;
+}
+
+int EventManagerName::registerSocketEvent(
+                                         const btlso::SocketHandle::Handle&,
+                                         const btlso::EventType::Type,
+                                         const btlso::EventManager::Callback&)
+{
+    return -1;
+}
+
+#endif  // BTLSO_DEFAULTEVENTMANAGER_IOURING_HAS_HEADER
+
+// ACCESSORS
+int EventManagerName::numSocketEvents(
+                               const btlso::SocketHandle::Handle& handle) const
+{
+    EventMap::const_iterator it = d_events.find(handle);
+    if (d_events.end() == it || !it->second.d_isValid) {
+        return 0;                                                     // RETURN
+    }
+    const int numEvents = it->second.d_readCallback ? 1 : 0;
+    return numEvents + (it->second.d_writeCallback ? 1 : 0);
+}
+
+int EventManagerName::numEvents() const
+{
+    return d_numEvents;
+}
+
+int EventManagerName::isRegistered(
+                                const btlso::SocketHandle::Handle& handle,
+                                const btlso::EventType::Type       event) const
+{
+    EventMap::const_iterator it = d_events.find(handle);
+
+    if (d_events.end() == it || !it->second.d_isValid) {
+        return 0;                                                     // RETURN
+    }
+
+    const HandleEvents& regEvents = it->second;
+
+    if (regEvents.d_readCallback
+     && event == regEvents.d_readEventType) {
+        return 1;                                                     // RETURN
+    }
+
+    if (regEvents.d_writeCallback
+     && event == regEvents.d_writeEventType) {
+        return 1;                                                     // RETURN
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,651 @@
+// btlso_defaulteventmanager_iouring.h                                -*-C++-*-
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#define INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide socket multiplexer implementation using Linux 'io_uring'.
+//
+//@CLASSES:
+//  btlso::DefaultEventManager<btlso::Platform::IOURING>: io_uring multiplexer
+//
+//@SEE_ALSO: btlso_eventmanager btlso_defaulteventmanager_epoll
+//
+//@DESCRIPTION: This component provides an implementation of an event manager,
+// 'btlso::DefaultEventManager<btlso::Platform::IOURING>', that uses a Linux
+// 'io_uring' submission/completion ring to monitor for socket events and
+// adheres to the 'btlso::EventManager' protocol.  As with the other event
+// managers, socket events are level-triggered: the callback registered for an
+// event is invoked by each call to 'dispatch' for as long as the socket
+// remains ready.
+//
+// Each registered socket has one one-shot poll request pending in the ring.
+// Registering socket events only queues poll requests in the submission ring,
+// without any system call; the queued requests are submitted, and the ready
+// sockets collected, by a single 'io_uring_enter' call in 'dispatch', which
+// also re-arms the requests of the sockets reported by the previous call.
+// Compared to 'epoll', this saves the 'epoll_ctl' call that each registration
+// requires, which matters to clients (such as 'btlmt::ChannelPool') that
+// register write events frequently.
+//
+// Note that a poll request pending in the ring holds a reference to its
+// socket: a socket must be deregistered before it is closed (or else its
+// connection is not released until the event manager is destroyed).  Hence,
+// deregistering the last event of a socket having a pending poll request
+// submits the removal of that request immediately.
+//
+///Completion-Based I/O
+///--------------------
+// In addition to the 'btlso::EventManager' protocol, this event manager can
+// read from and write to a socket through the ring: 'submitReadv' and
+// 'submitWritev' queue an 'IORING_OP_READV' or 'IORING_OP_WRITEV' request,
+// which (like poll requests) is submitted by the next call to 'dispatch'.  The
+// kernel performs the transfer as soon as the socket is ready, and the
+// callback supplied with the request is invoked by the 'dispatch' call that
+// collects its completion, with the number of bytes transferred (or the
+// negated 'errno' value of the failure).  Hence, a client that keeps a read
+// request pending on each of its sockets, rather than registering a read
+// event and calling 'readv' when it is reported, transfers data with no
+// system call other than the 'io_uring_enter' made by 'dispatch', which
+// submits and collects the requests of all the sockets at once.
+//
+// The buffers of an I/O request are owned by the client, and must remain
+// valid until its callback is invoked.  A pending request can be canceled by
+// 'cancelIo', in which case its callback is still invoked by 'dispatch'
+// (with '-ECANCELED', unless the request completed in the meantime).  Note
+// that 'deregisterAll', as well as the destructor, cancels the pending I/O
+// requests and waits for the kernel to release their buffers, then destroys
+// their callbacks *without* invoking them.
+//
+///Availability
+///------------
+// 'io_uring' is available on Linux 5.11 and later (this component requires
+// the 'IORING_FEAT_EXT_ARG' and 'IORING_FEAT_NODROP' features), and may be
+// disabled by the system administrator.  Clients should check 'isSupported'
+// before creating an event manager of this type, and otherwise fall back to
+// 'btlso::DefaultEventManager<btlso::Platform::EPOLL>'.  Direct use of this
+// library component on *any* platform may result in non-portable software.
+//
+///Thread Safety
+///-------------
+// Accessing an instance of the event manager provided by this component from
+// different threads may result in undefined behavior.  Accessing distinct
+// instances from different threads is safe.  The event manager is not
+// *async-safe*, meaning that one or more functions cannot be invoked safely
+// from a signal handler.
+//
+///Performance
+///-----------
+// Given that S is the number of socket events registered, this component
+// provides the following complexity guarantees:
+//..
+//  +=======================================================================+
+//  |        FUNCTION          | EXPECTED COMPLEXITY | WORST CASE COMPLEXITY|
+//  +-----------------------------------------------------------------------+
+//  | dispatch                 |        O(S)         |       O(S^2)         |
+//  +-----------------------------------------------------------------------+
+//  | registerSocketEvent      |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocketEvent    |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocket         |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterAll            |        O(S)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | numSocketEvents          |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | numEvents                |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | isRegistered             |        O(1)         |        O(S)          |
+//  +=======================================================================+
+//..
+//
+///Metrics
+///-------
+// The event manager provided by this component can use external (i.e.,
+// user-installed) time metrics (see 'btlso_timemetrics' component) to record
+// times spend in IO-bound and CPU-bound operations using the category IDs
+// defined in 'btlso::TimeMetrics'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Choosing the 'io_uring' Event Manager
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// An 'io_uring' event manager is used like any other event manager, but is
+// not available on every kernel.  First, we create the event manager if it is
+// supported, and fall back to 'epoll' otherwise:
+//..
+//  typedef btlso::DefaultEventManager<btlso::Platform::IOURING> IoUring;
+//  typedef btlso::DefaultEventManager<btlso::Platform::EPOLL>   Epoll;
+//
+//  bslma::Allocator    *allocator = bslma::Default::allocator();
+//  btlso::EventManager *manager;
+//  if (IoUring::isSupported()) {
+//      manager = new (*allocator) IoUring(0, allocator);
+//  }
+//  else {
+//      manager = new (*allocator) Epoll(0, allocator);
+//  }
+//..
+// Then, we create a (locally-connected) socket pair, and register a callback
+// for the read event of one of its ends:
+//..
+//  btlso::SocketHandle::Handle socket[2];
+//
+//  int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+//                                      socket,
+//                                      btlso::SocketImpUtil::k_SOCKET_STREAM);
+//  assert(0 == rc);
+//
+//  int numInvocations = 0;
+//  rc = manager->registerSocketEvent(
+//                            socket[1],
+//                            btlso::EventType::e_READ,
+//                            bdlf::BindUtil::bind(&countCb, &numInvocations));
+//  assert(0 == rc);
+//..
+// Next, we write to the other end, and dispatch the read event:
+//..
+//  rc = btlso::SocketImpUtil::write(socket[0], "x", 1);
+//  assert(1 == rc);
+//
+//  rc = manager->dispatch(bdlt::CurrentTime::now() + 5, 0);
+//  assert(1 == rc);
+//  assert(1 == numInvocations);
+//..
+// Finally, we deregister the socket *before* closing it, and destroy the
+// event manager:
+//..
+//  manager->deregisterSocket(socket[1]);
+//  btlso::SocketImpUtil::close(socket[0]);
+//  btlso::SocketImpUtil::close(socket[1]);
+//
+//  allocator->deleteObject(manager);
+//..
+// where 'countCb' simply increments the counter it is bound to:
+//..
+//  void countCb(int *numInvocations)
+//  {
+//      ++*numInvocations;
+//  }
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGERIMPL
+#include <btlso_defaulteventmanagerimpl.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTMANAGER
+#include <btlso_eventmanager.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTTYPE
+#include <btlso_eventtype.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_PLATFORM
+#include <btlso_platform.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_SOCKETHANDLE
+#include <btlso_sockethandle.h>
+#endif
+
+#ifndef INCLUDED_BTLS_IOVEC
+#include <btls_iovec.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UNORDERED_MAP
+#include <bsl_unordered_map.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+namespace BloombergLP {
+
+namespace bslma { class Allocator; }
+
+namespace bsls { class TimeInterval; }
+
+namespace btlso {
+
+class TimeMetrics;
+
+           // ============================================
+           // class DefaultEventManager<Platform::IOURING>
+           // ============================================
+
+template <>
+class DefaultEventManager<Platform::IOURING> : public EventManager
+{
+    // This class implements the 'btlso::EventManager' protocol on a Linux
+    // 'io_uring', using one one-shot poll request per registered socket, and
+    // provides completion-based reads and writes through the same ring.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::function<void(int)> IoCallback;
+        // Callback invoked with the result of an I/O request: the number of
+        // bytes transferred on success, and the negated 'errno' value of the
+        // failure otherwise.
+
+  private:
+    // PRIVATE TYPES
+    struct HandleEvents {
+        bool                   d_isValid;
+        EventManager::Callback d_readCallback;
+        EventManager::Callback d_writeCallback;
+        EventType::Type        d_readEventType;
+        EventType::Type        d_writeEventType;
+        int                    d_mask;       // 'poll' events registered
+        int                    d_armedMask;  // 'poll' events of the request
+                                             // pending in the ring, or 0
+        unsigned int           d_armedId;    // id of the pending request
+
+        BSLMF_NESTED_TRAIT_DECLARATION(HandleEvents, bslmf::IsBitwiseMoveable);
+    };
+
+    typedef bsl::unordered_map<int, HandleEvents> EventMap;
+
+    struct Signaled {
+        // A completed poll request.
+
+        EventMap::value_type *d_entry_p;  // socket whose request completed
+        int                   d_revents;  // 'poll' events reported
+
+        BSLMF_NESTED_TRAIT_DECLARATION(Signaled, bslmf::IsBitwiseMoveable);
+    };
+
+    struct IoRequest {
+        // A pending read or write request.
+
+        IoCallback d_callback;     // invoked with the result of the
+                                   // request
+
+        bool       d_isCompleted;  // 'true' once the completion of the
+                                   // request is collected
+    };
+
+    typedef bsl::unordered_map<bsls::Types::Uint64, IoRequest> IoRequestMap;
+
+    struct IoCompletion {
+        // A completed read or write request.
+
+        bsls::Types::Uint64 d_id;      // id of the request
+        int                 d_result;  // result of the request
+
+        BSLMF_NESTED_TRAIT_DECLARATION(IoCompletion,
+                                       bslmf::IsBitwiseMoveable);
+    };
+
+    struct Ring {
+        // The memory shared with the kernel, as mapped by 'io_uring_setup'.
+
+        void         *d_sqRing_p;      // mapped submission ring
+        bsl::size_t   d_sqRingSize;    // size of 'd_sqRing_p'
+        void         *d_cqRing_p;      // mapped completion ring (may be the
+                                       // same mapping as 'd_sqRing_p')
+        bsl::size_t   d_cqRingSize;    // size of 'd_cqRing_p'
+        void         *d_sqes_p;        // mapped submission queue entries
+        bsl::size_t   d_sqesSize;      // size of 'd_sqes_p'
+        unsigned int *d_sqHead_p;      // consumed by the kernel
+        unsigned int *d_sqTail_p;      // published by this object
+        unsigned int *d_sqArray_p;     // indices of the submitted entries
+        unsigned int  d_sqMask;        // submission ring index mask
+        unsigned int  d_sqEntries;     // submission ring capacity
+        unsigned int *d_cqHead_p;      // consumed by this object
+        unsigned int *d_cqTail_p;      // produced by the kernel
+        void         *d_cqes_p;        // completion queue entries
+        unsigned int  d_cqMask;        // completion ring index mask
+    };
+
+    // DATA
+    int                                d_ringFd;  // 'io_uring' fd
+
+    Ring                               d_ring;    // shared ring memory
+
+    unsigned int                       d_sqTail;  // local submission tail
+
+    unsigned int                       d_nextId;  // id of the next poll
+                                                  // request
+
+    bsl::vector<Signaled>              d_signaled;
+                                                  // completed poll requests
+                                                  // collected by 'dispatch'
+
+    bsls::Types::Uint64                d_nextIoId;
+                                                  // id of the next I/O
+                                                  // request
+
+    IoRequestMap                       d_ioRequests;
+                                                  // pending I/O requests
+
+    bsl::vector<IoCompletion>          d_ioCompletions;
+                                                  // completed I/O requests
+                                                  // collected by 'dispatch'
+
+    bsls::Types::Uint64                d_invokingIoId;
+                                                  // id of the I/O request
+                                                  // whose callback is being
+                                                  // invoked, or 0
+
+    bool                               d_isInvokingCb;
+                                                  // is the manager invoking
+                                                  // callbacks
+
+    TimeMetrics                       *d_timeMetric_p;
+                                                  // metrics to use for
+                                                  // reporting percent-busy
+                                                  // statistics
+
+    EventMap                           d_events;  // map of socket handles to
+                                                  // associated events
+
+    bsl::vector<EventMap::iterator>    d_entriesBeingRemoved;
+                                                  // if we're in a user cb, we
+                                                  // will not update the map
+                                                  // right away but keep the
+                                                  // list what needs to be
+                                                  // removed here
+
+    int                                d_numEvents;
+                                                  // number of registered
+                                                  // events
+
+    // PRIVATE MANIPULATORS
+    void arm(EventMap::value_type *entry);
+        // Queue a poll request for the events registered for the specified
+        // socket 'entry', replacing its pending request if it is for
+        // different events.  Do nothing if the pending request is for the
+        // registered events.
+
+    void disarm(EventMap::value_type *entry);
+        // Queue the removal of the pending poll request of the specified
+        // socket 'entry', if any.
+
+    void discardIo();
+        // Cancel the pending I/O requests, wait for their completion, and
+        // destroy their callbacks without invoking them.
+
+    void *nextEntry();
+        // Return the address of the next (zero-initialized) entry of the
+        // submission ring, which is queued by this call, submitting the
+        // queued requests first if the ring is full.
+
+    bsls::Types::Uint64 queueIo(int                opcode,
+                                int                handle,
+                                const void        *buffers,
+                                int                numBuffers,
+                                const IoCallback&  callback);
+        // Queue in the submission ring an I/O request having the specified
+        // 'opcode' for the specified 'handle' and 'numBuffers' 'buffers', to
+        // be completed by invoking the specified 'callback', and return the
+        // id of the request.
+
+    void queueRequest(int                 opcode,
+                      int                 handle,
+                      int                 mask,
+                      bsls::Types::Uint64 userData);
+        // Queue in the submission ring a request having the specified
+        // 'opcode' for the specified 'handle', 'poll' event 'mask', and
+        // 'userData', submitting the queued requests first if the ring is
+        // full.  Note that for a poll removal request, 'userData' identifies
+        // the request to remove.
+
+    int submit(int minComplete, const bsls::TimeInterval *timeout);
+        // Submit the queued requests, and wait until the specified
+        // 'minComplete' requests have completed or the optionally specified
+        // relative 'timeout' expires.  Return 0 on success, and the native
+        // error code otherwise.
+
+    int reapCompletions();
+        // Collect into 'd_signaled' the completed poll requests that are
+        // still current, and into 'd_ioCompletions' the completed I/O
+        // requests, and return their total number.
+
+    int dispatchCallbacks();
+        // Invoke the callbacks of the sockets in 'd_signaled' and of the I/O
+        // requests in 'd_ioCompletions', re-arm the poll requests of the
+        // sockets, and return the number of callbacks that were invoked.
+
+    int dispatchImp(int flags, const bsls::TimeInterval *timeout = 0);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.
+
+  private:
+    // NOT IMPLEMENTED
+    DefaultEventManager(const DefaultEventManager&);
+    DefaultEventManager& operator=(const DefaultEventManager&);
+
+  public:
+    // PUBLIC CLASS METHODS
+    static bool isSupported();
+        // Return true if the current kernel supports this event manager.
+
+    // CREATORS
+    explicit
+    DefaultEventManager(TimeMetrics      *timeMetric     = 0,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an 'io_uring'-based event manager.  Optionally specify a
+        // 'timeMetric' to report time spent in CPU-bound and IO-bound
+        // operations.  If 'timeMetric' is not specified or is 0, these metrics
+        // are not reported.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'isSupported()' returns 'true'.
+
+    ~DefaultEventManager();
+        // Destroy this object.  Note that the registered callbacks are NOT
+        // invoked, and that the pending I/O requests are canceled, and their
+        // callbacks destroyed without being invoked once the kernel has
+        // released their buffers.
+
+    // MANIPULATORS
+    int dispatch(const bsls::TimeInterval& timeout, int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked), (2) the specified absolute
+        // 'timeout' is reached, or (3) provided that the specified 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT', an underlying system call
+        // is interrupted by a signal.  Return the number of dispatched
+        // callbacks on success, 0 if 'timeout' is reached, and a negative
+        // value otherwise; -1 is reserved to indicate that an underlying
+        // system call was interrupted.  When such an interruption occurs this
+        // method will return (-1) if 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT', and otherwise will automatically
+        // restart (i.e., reissue the identical system call).  Note that all
+        // callbacks are invoked in the same thread that invokes 'dispatch',
+        // and the order of invocation, relative to the order of registration,
+        // is unspecified.
+
+    int dispatch(int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked) or (2) provided that the
+        // specified 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT', an
+        // underlying system call is interrupted by a signal.  Return the
+        // number of dispatched callbacks on success, and a negative value
+        // otherwise; -1 is reserved to indicate that an underlying system call
+        // was interrupted.  Note that all callbacks are invoked in the same
+        // thread that invokes 'dispatch', and the order of invocation,
+        // relative to the order of registration, is unspecified.
+
+    int registerSocketEvent(const SocketHandle::Handle&   handle,
+                            const EventType::Type         event,
+                            const EventManager::Callback& callback);
+        // Register with this event manager the specified 'callback' to be
+        // invoked when the specified 'event' occurs on the specified socket
+        // 'handle'.  Each socket event registration stays in effect until it
+        // is subsequently deregistered; the callback is invoked each time the
+        // corresponding event is detected.  'EventType::e_READ' and
+        // 'EventType::e_WRITE' are the only events that can be registered
+        // simultaneously for a socket.  If a registration attempt is made for
+        // an event that is already registered, the callback associated with
+        // this event will be overwritten with the new one.  Simultaneous
+        // registration of incompatible events for the same socket 'handle'
+        // will result in undefined behavior.  Return 0.  Note that the poll
+        // request for 'handle' is submitted by the next call to 'dispatch',
+        // so an invalid 'handle' is not detected by this method (its events
+        // are never reported).
+
+    void deregisterSocketEvent(const SocketHandle::Handle& handle,
+                               EventType::Type             event);
+        // Deregister from this event manager the callback associated with the
+        // specified 'event' on the specified 'handle' so that said callback
+        // will not be invoked should 'event' occur.
+
+    int deregisterSocket(const SocketHandle::Handle& handle);
+        // Deregister from this event manager all events associated with the
+        // specified socket 'handle'.  Return the number of deregistered
+        // callbacks.
+
+    void deregisterAll();
+        // Deregister from this event manager all events on every socket
+        // handle.  Also cancel the pending I/O requests, wait for the kernel
+        // to release their buffers, and destroy their callbacks without
+        // invoking them.
+
+    bsls::Types::Uint64 submitReadv(const SocketHandle::Handle&  handle,
+                                    const btls::Iovec           *buffers,
+                                    int                          numBuffers,
+                                    const IoCallback&            callback);
+        // Queue a request to read from the specified 'handle' into the
+        // specified 'numBuffers' 'buffers', and return a (non-zero)
+        // identifier of the request.  The request is submitted by the next
+        // call to 'dispatch', and the specified 'callback' is invoked (by
+        // 'dispatch') with the number of bytes read, which is 0 if the peer
+        // shut down the connection, or with the negated 'errno' value of the
+        // failure.  The behavior is undefined unless
+        // '0 < numBuffers <= IOV_MAX', and 'buffers' and the memory they
+        // describe remain valid until 'callback' is invoked or this event
+        // manager discards the request (see 'deregisterAll').
+
+    bsls::Types::Uint64 submitWritev(const SocketHandle::Handle&  handle,
+                                     const btls::Ovec            *buffers,
+                                     int                          numBuffers,
+                                     const IoCallback&            callback);
+        // Queue a request to write to the specified 'handle' from the
+        // specified 'numBuffers' 'buffers', and return a (non-zero)
+        // identifier of the request.  The request is submitted by the next
+        // call to 'dispatch', and the specified 'callback' is invoked (by
+        // 'dispatch') with the number of bytes written, which may be less
+        // than the size of 'buffers', or with the negated 'errno' value of
+        // the failure.  The behavior is undefined unless
+        // '0 < numBuffers <= IOV_MAX', and 'buffers' and the memory they
+        // describe remain valid until 'callback' is invoked or this event
+        // manager discards the request (see 'deregisterAll').
+
+    void cancelIo(bsls::Types::Uint64 requestId);
+        // Cancel the pending I/O request having the specified 'requestId'.
+        // The callback of the request is still invoked by 'dispatch', with
+        // '-ECANCELED' unless the request completes before the cancellation
+        // takes effect.  This method has no effect if the callback of the
+        // request was already invoked.  Note that the cancellation is
+        // submitted immediately, so that the request no longer references
+        // its socket once its callback is invoked.
+
+    // ACCESSORS
+    bool hasLimitedSocketCapacity() const;
+        // Return 'true' if this event manager has a limited socket capacity,
+        // and 'false' otherwise.
+
+    int isRegistered(const SocketHandle::Handle& handle,
+                     const EventType::Type       event) const;
+        // Return 1 if the specified 'event' is registered with this event
+        // manager for the specified socket 'handle' and 0 otherwise.
+
+    int numEvents() const;
+        // Return the total number of all socket events currently registered
+        // with this event manager.
+
+    int numSocketEvents(const SocketHandle::Handle& handle) const;
+        // Return the number of socket events currently registered with this
+        // event manager for the specified 'handle'.
+
+    int numPendingIo() const;
+        // Return the number of I/O requests whose callback has not been
+        // invoked yet.
+};
+
+//-----------------------------------------------------------------------------
+//                      INLINE FUNCTION DEFINITIONS
+//-----------------------------------------------------------------------------
+
+           // --------------------------------------------
+           // class DefaultEventManager<Platform::IOURING>
+           // --------------------------------------------
+
+// ACCESSORS
+inline
+bool DefaultEventManager<Platform::IOURING>::hasLimitedSocketCapacity() const
+{
+    return false;
+}
+
+inline
+int DefaultEventManager<Platform::IOURING>::numPendingIo() const
+{
+    return static_cast<int>(d_ioRequests.size());
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif // BSLS_PLATFORM_OS_LINUX
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
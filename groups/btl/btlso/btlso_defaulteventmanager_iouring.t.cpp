@@ -0,0 +1,1597 @@
+// btlso_defaulteventmanager_iouring.t.cpp                            -*-C++-*-
+#include <btlso_defaulteventmanager_iouring.h>
+
+#include <btlso_defaulteventmanager_epoll.h>
+#include <btlso_eventmanagertester.h>
+#include <btlso_flag.h>
+#include <btlso_platform.h>
+#include <btlso_socketimputil.h>
+#include <btlso_timemetrics.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdlt_currenttime.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_c_stdio.h>
+#include <bsl_c_stdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    #define BTESO_EVENTMANAGER_ENABLETEST
+    typedef btlso::DefaultEventManager<btlso::Platform::IOURING> Obj;
+#endif
+
+#ifdef BTESO_EVENTMANAGER_ENABLETEST
+
+#include <bsl_c_errno.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              OVERVIEW
+// Test the corresponding event manager component by using
+// 'btlso::EventManagerTester' to exercise the "standard" test which applies to
+// any event manager's test.  Since the difference exists in implementation
+// between different event manager components, the "customized" test is also
+// given for this event manager.  The "customized" test is implemented by
+// utilizing the same script grammar and the same script interpreting defined
+// in 'btlso::EventManagerTester' function but a new set of data to test this
+// specific event manager component.
+//
+// Since 'io_uring' may not be available on the host running this test driver,
+// every test case is skipped (and reported as passing) if 'isSupported'
+// returns 'false'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] static bool isSupported();
+//
+// CREATORS
+// [ 2] btlso::DefaultEventManager
+// [ 2] ~btlso::DefaultEventManager
+//
+// MANIPULATORS
+// [ 4] registerSocketEvent
+// [ 5] deregisterSocketEvent
+// [ 6] deregisterSocket
+// [ 9] deregisterSocket
+// [ 7] deregisterAll
+// [12] deregisterAll
+// [ 8] dispatch
+// [12] dispatch
+// [12] Uint64 submitReadv(handle, buffers, numBuffers, callback);
+// [12] Uint64 submitWritev(handle, buffers, numBuffers, callback);
+// [12] void cancelIo(bsls::Types::Uint64 requestId);
+//
+// ACCESSORS
+// [11] hasLimitedSocketCapacity
+// [ 3] numSocketEvents
+// [ 3] numEvents
+// [ 3] isRegistered
+// [12] int numPendingIo() const;
+//-----------------------------------------------------------------------------
+// [13] USAGE EXAMPLE
+// [10] BATCHED AND STALE POLL REQUESTS
+// [ 1] Breathing test
+// [-1] 'dispatch' PERFORMANCE DATA
+// [-2] 'registerSocketEvent' PERFORMANCE DATA
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+#define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+//=============================================================================
+//                  SEMI-STANDARD TEST OUTPUT MACROS
+//-----------------------------------------------------------------------------
+#define P(X) cout << #X " = " << (X) << endl; // Print identifier and value.
+#define Q(X) cout << "<| " #X " |>" << endl;  // Quote identifier literally.
+#define P_(X) cout << #X " = " << (X) << ", "<< flush; // P(X) without '\n'
+#define L_ __LINE__                           // current Line number
+
+//=============================================================================
+//                  STANDARD BDE LOOP-ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT(I,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\n"; aSsErT(1, #X, __LINE__); }}
+
+#define LOOP2_ASSERT(I,J,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " \
+              << J << "\n"; aSsErT(1, #X, __LINE__); } }
+
+#define LOOP3_ASSERT(I,J,K,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " << J << "\t" \
+              << #K << ": " << K << "\n"; aSsErT(1, #X, __LINE__); } }
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef btlso::EventManagerTester EventManagerTester;
+
+enum {
+    BUF_LEN = 8192
+};
+
+enum {
+    k_HIGHEST_CASE = 13  // cases above are reported as not found
+};
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+void assertCb()
+{
+    BSLS_ASSERT_OPT(0);
+}
+
+static void emptyCb()
+{
+}
+
+void countCb(int *numInvocations)
+{
+    ++*numInvocations;
+}
+
+void recordIoCb(bsl::vector<int>            *results,
+                const bsl::shared_ptr<int>&  ,
+                int                          result)
+    // Append the specified 'result' of an I/O request to the specified
+    // 'results'.  Note that the unnamed argument is a token whose use count
+    // tells whether this callback (bound to it) is destroyed.
+{
+    results->push_back(result);
+}
+
+static void multiRegisterDeregisterCb(Obj *mX)
+{
+    btlso::SocketHandle::Handle socket[2];
+    int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+    ASSERT(0 == rc);
+
+    bsl::function<void()> emptyCallBack(&emptyCb);
+
+    // Register and deregister the socket handle six times.  All registrations
+    // are done by invoking 'registerSocketEvent'.  The deregistrations are
+    // done by invoking 'deregisterSocketEvent' twice, 'deregisterSocket'
+    // twice, and 'deregisterAll' twice.
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocketEvent(socket[0], btlso::EventType::e_READ);
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocket(socket[0]);
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterAll();
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocketEvent(socket[0], btlso::EventType::e_READ);
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterSocket(socket[0]);
+
+    ASSERT(0 == mX->registerSocketEvent(socket[0],
+                                        btlso::EventType::e_READ,
+                                        emptyCallBack));
+    mX->deregisterAll();
+
+    btlso::SocketImpUtil::close(socket[0]);
+    btlso::SocketImpUtil::close(socket[1]);
+}
+
+#endif // BTESO_EVENTMANAGER_ENABLETEST
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+#ifdef BTESO_EVENTMANAGER_ENABLETEST
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    int controlFlag = 0;
+    if (veryVeryVerbose) {
+        controlFlag |= btlso::EventManagerTester::k_VERY_VERY_VERBOSE;
+    }
+    if (veryVerbose) {
+        controlFlag |= btlso::EventManagerTester::k_VERY_VERBOSE;
+    }
+    if (verbose) {
+        controlFlag |= btlso::EventManagerTester::k_VERBOSE;
+    }
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    if (test <= k_HIGHEST_CASE && !Obj::isSupported()) {
+        cout << "'io_uring' is not supported: skipping test case." << endl;
+        return 0;                                                     // RETURN
+    }
+
+    btlso::SocketImpUtil::startup();
+    bslma::TestAllocator testAllocator(veryVeryVerbose);
+    testAllocator.setNoAbort(1);
+    btlso::TimeMetrics timeMetric(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+                                  btlso::TimeMetrics::e_CPU_BOUND);
+
+    switch (test) { case 0:
+      case 13: {
+        // -----------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove
+        //   leading comment characters, and replace 'assert' with
+        //   'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Choosing the 'io_uring' Event Manager
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// An 'io_uring' event manager is used like any other event manager, but is
+// not available on every kernel.  First, we create the event manager if it is
+// supported, and fall back to 'epoll' otherwise:
+//..
+        typedef btlso::DefaultEventManager<btlso::Platform::IOURING> IoUring;
+        typedef btlso::DefaultEventManager<btlso::Platform::EPOLL>   Epoll;
+
+        bslma::Allocator    *allocator = bslma::Default::allocator();
+        btlso::EventManager *manager;
+        if (IoUring::isSupported()) {
+            manager = new (*allocator) IoUring(0, allocator);
+        }
+        else {
+            manager = new (*allocator) Epoll(0, allocator);
+        }
+//..
+// Then, we create a (locally-connected) socket pair, and register a callback
+// for the read event of one of its ends:
+//..
+        btlso::SocketHandle::Handle socket[2];
+
+        int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+        ASSERT(0 == rc);
+
+        int numInvocations = 0;
+        rc = manager->registerSocketEvent(
+                              socket[1],
+                              btlso::EventType::e_READ,
+                              bdlf::BindUtil::bind(&countCb, &numInvocations));
+        ASSERT(0 == rc);
+//..
+// Next, we write to the other end, and dispatch the read event:
+//..
+        rc = btlso::SocketImpUtil::write(socket[0], "x", 1);
+        ASSERT(1 == rc);
+
+        rc = manager->dispatch(bdlt::CurrentTime::now() + 5, 0);
+        ASSERT(1 == rc);
+        ASSERT(1 == numInvocations);
+//..
+// Finally, we deregister the socket *before* closing it, and destroy the
+// event manager:
+//..
+        manager->deregisterSocket(socket[1]);
+        btlso::SocketImpUtil::close(socket[0]);
+        btlso::SocketImpUtil::close(socket[1]);
+
+        allocator->deleteObject(manager);
+//..
+      } break;
+      case 12: {
+        // -----------------------------------------------------------------
+        // TESTING COMPLETION-BASED I/O
+        //
+        // Concerns:
+        //: 1 A read request completes when data arrives (and not before),
+        //:   with the number of bytes scattered into its buffers, and a
+        //:   write request completes with the number of bytes written.
+        //:
+        //: 2 'dispatch' waits for the completion of I/O requests, even if no
+        //:   socket event is registered, and counts their callbacks.
+        //:
+        //: 3 A read request completes with 0 once the peer shuts down the
+        //:   connection.
+        //:
+        //: 4 A canceled request completes with '-ECANCELED', and canceling a
+        //:   completed request has no effect.
+        //:
+        //: 5 'deregisterAll' and the destructor discard the pending requests:
+        //:   their callbacks are destroyed without being invoked.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 On a socket pair, submit a request to read into two buffers,
+        //:   and verify that 'dispatch' times out without invoking its
+        //:   callback.  Then submit a request to write, from two buffers, to
+        //:   the other end, and verify that one 'dispatch' reports both
+        //:   completions, and that the data is read as written.  (C-1..2)
+        //:
+        //: 2 Submit a read request, shut down the other end for writing, and
+        //:   verify that the request completes with 0.  (C-3)
+        //:
+        //: 3 Submit a read request, cancel it, and verify that it completes
+        //:   with '-ECANCELED'; cancel it again and verify that nothing
+        //:   happens.  (C-4)
+        //:
+        //: 4 Submit read requests bound to a token, call 'deregisterAll' or
+        //:   destroy the event manager, and verify that the token is
+        //:   released while the callback was not invoked.  (C-5)
+        //:
+        //: 5 Use a test allocator for the event managers.  (C-6)
+        //
+        // Testing:
+        //   Uint64 submitReadv(handle, buffers, numBuffers, callback);
+        //   Uint64 submitWritev(handle, buffers, numBuffers, callback);
+        //   void cancelIo(bsls::Types::Uint64 requestId);
+        //   void deregisterAll();
+        //   int dispatch(const bsls::TimeInterval& timeout, int flags);
+        //   int numPendingIo() const;
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COMPLETION-BASED I/O" << endl
+                          << "============================" << endl;
+
+        using bdlf::PlaceHolders::_1;
+
+        const bsls::TimeInterval TIMEOUT(0, 100 * 1000 * 1000);  // 100ms
+
+        bsl::shared_ptr<int> token;
+        token.createInplace(&testAllocator, 0);
+
+        const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                               testAllocator.numAllocations();
+        const bsls::Types::Int64 NUM_BYTES = testAllocator.numBytesInUse();
+
+        if (verbose) cout << "\tReading and writing." << endl;
+        {
+            Obj mX(0, &testAllocator);  const Obj& X = mX;
+
+            btlso::SocketHandle::Handle socket[2];
+            int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+
+            char        readBuffer[2][4];
+            btls::Iovec ivecs[2];
+            ivecs[0].setBuffer(readBuffer[0], sizeof readBuffer[0]);
+            ivecs[1].setBuffer(readBuffer[1], sizeof readBuffer[1]);
+
+            bsl::vector<int> readResults;
+            const bsls::Types::Uint64 readId = mX.submitReadv(
+                                       socket[1],
+                                       ivecs,
+                                       2,
+                                       bdlf::BindUtil::bind(&recordIoCb,
+                                                            &readResults,
+                                                            token,
+                                                            _1));
+            ASSERT(0 != readId);
+            ASSERT(1 == X.numPendingIo());
+            ASSERT(0 == X.numEvents());
+
+            rc = mX.dispatch(bdlt::CurrentTime::now() + TIMEOUT, 0);
+            LOOP_ASSERT(rc, 0 == rc);
+            ASSERT(readResults.empty());
+            ASSERT(1 == X.numPendingIo());
+
+            const char  *DATA = "abcdefg";
+            btls::Ovec   ovecs[2];
+            ovecs[0].setBuffer(DATA, 2);
+            ovecs[1].setBuffer(DATA + 2, 5);
+
+            bsl::vector<int> writeResults;
+            const bsls::Types::Uint64 writeId = mX.submitWritev(
+                                       socket[0],
+                                       ovecs,
+                                       2,
+                                       bdlf::BindUtil::bind(&recordIoCb,
+                                                            &writeResults,
+                                                            token,
+                                                            _1));
+            ASSERT(0 != writeId);
+            ASSERT(readId != writeId);
+            ASSERT(2 == X.numPendingIo());
+
+            // The read may complete in a later call than the write.
+
+            int numCallbacks = 0;
+            for (int i = 0; i < 10 && 2 > numCallbacks; ++i) {
+                rc = mX.dispatch(bdlt::CurrentTime::now() + TIMEOUT, 0);
+                ASSERT(0 <= rc);
+                numCallbacks += rc;
+            }
+            LOOP_ASSERT(numCallbacks, 2 == numCallbacks);
+            ASSERT(0 == X.numPendingIo());
+
+            ASSERT(1 == writeResults.size());
+            ASSERT(1 == readResults.size());
+            LOOP_ASSERT(writeResults[0], 7 == writeResults[0]);
+            LOOP_ASSERT(readResults[0],  7 == readResults[0]);
+            ASSERT(0 == bsl::memcmp(readBuffer[0], "abcd", 4));
+            ASSERT(0 == bsl::memcmp(readBuffer[1], "efg", 3));
+
+            if (verbose) cout << "\tShutting down the peer." << endl;
+
+            readResults.clear();
+            mX.submitReadv(socket[1],
+                           ivecs,
+                           2,
+                           bdlf::BindUtil::bind(&recordIoCb,
+                                                &readResults,
+                                                token,
+                                                _1));
+
+            rc = ::shutdown(socket[0], SHUT_WR);
+            ASSERT(0 == rc);
+
+            rc = mX.dispatch(bdlt::CurrentTime::now() + TIMEOUT, 0);
+            LOOP_ASSERT(rc, 1 == rc);
+            ASSERT(1 == readResults.size());
+            LOOP_ASSERT(readResults[0], 0 == readResults[0]);
+
+            if (verbose) cout << "\tCanceling." << endl;
+
+            readResults.clear();
+            const bsls::Types::Uint64 cancelId = mX.submitReadv(
+                                       socket[0],
+                                       ivecs,
+                                       2,
+                                       bdlf::BindUtil::bind(&recordIoCb,
+                                                            &readResults,
+                                                            token,
+                                                            _1));
+
+            // Submit the request before canceling it.
+
+            rc = mX.dispatch(bdlt::CurrentTime::now(), 0);
+            LOOP_ASSERT(rc, 0 == rc);
+
+            mX.cancelIo(cancelId);
+            ASSERT(1 == X.numPendingIo());
+
+            rc = mX.dispatch(bdlt::CurrentTime::now() + TIMEOUT, 0);
+            LOOP_ASSERT(rc, 1 == rc);
+            ASSERT(1 == readResults.size());
+            LOOP_ASSERT(readResults[0], -ECANCELED == readResults[0]);
+            ASSERT(0 == X.numPendingIo());
+
+            mX.cancelIo(cancelId);
+            mX.cancelIo(readId);
+            rc = mX.dispatch(bdlt::CurrentTime::now() + TIMEOUT, 0);
+            LOOP_ASSERT(rc, 0 == rc);
+            ASSERT(1 == readResults.size());
+
+            btlso::SocketImpUtil::close(socket[0]);
+            btlso::SocketImpUtil::close(socket[1]);
+        }
+        ASSERT(1 == token.use_count());
+
+        if (verbose) cout << "\tDiscarding pending requests." << endl;
+        {
+            btlso::SocketHandle::Handle socket[2];
+            int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+
+            char             buffer[4];
+            btls::Iovec      ivec;
+            bsl::vector<int> results;
+
+            ivec.setBuffer(buffer, sizeof buffer);
+
+            Obj mX(0, &testAllocator);  const Obj& X = mX;
+
+            // Discard a request that was submitted, and one that was not.
+
+            mX.submitReadv(socket[0],
+                           &ivec,
+                           1,
+                           bdlf::BindUtil::bind(&recordIoCb,
+                                                &results,
+                                                token,
+                                                _1));
+            rc = mX.dispatch(bdlt::CurrentTime::now(), 0);
+            LOOP_ASSERT(rc, 0 == rc);
+
+            mX.submitReadv(socket[1],
+                           &ivec,
+                           1,
+                           bdlf::BindUtil::bind(&recordIoCb,
+                                                &results,
+                                                token,
+                                                _1));
+            ASSERT(3 == token.use_count());
+            ASSERT(2 == X.numPendingIo());
+
+            mX.deregisterAll();
+            ASSERT(1 == token.use_count());
+            ASSERT(0 == X.numPendingIo());
+            ASSERT(results.empty());
+
+            // Discard a request on destruction.
+
+            {
+                Obj mY(0, &testAllocator);
+
+                mY.submitReadv(socket[0],
+                               &ivec,
+                               1,
+                               bdlf::BindUtil::bind(&recordIoCb,
+                                                    &results,
+                                                    token,
+                                                    _1));
+                rc = mY.dispatch(bdlt::CurrentTime::now(), 0);
+                LOOP_ASSERT(rc, 0 == rc);
+                ASSERT(2 == token.use_count());
+            }
+            ASSERT(1 == token.use_count());
+            ASSERT(results.empty());
+
+            // The socket was not read from.
+
+            rc = btlso::SocketImpUtil::write(socket[1], "x", 1);
+            ASSERT(1 == rc);
+            rc = btlso::SocketImpUtil::read(buffer, socket[0], 1);
+            ASSERT(1 == rc);
+
+            btlso::SocketImpUtil::close(socket[0]);
+            btlso::SocketImpUtil::close(socket[1]);
+        }
+        ASSERT(NUM_ALLOCATIONS < testAllocator.numAllocations());
+        ASSERT(NUM_BYTES == testAllocator.numBytesInUse());
+      } break;
+      case 11: {
+        // -----------------------------------------------------------------
+        // TESTING 'hasLimitedSocketCapacity'
+        //
+        // Concern:
+        //: 1 'hasLimitiedSocketCapacity' returns 'false'.
+        //
+        // Plan:
+        //: 1 Assert that 'hasLimitedSocketCapacity' returns 'false'.
+        //
+        // Testing:
+        //   bool hasLimitedSocketCapacity() const;
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'hasLimitedSocketCapacity" << endl
+                          << "=================================" << endl;
+
+        if (verbose) cout << "Testing 'hasLimitedSocketCapacity'" << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            bool hlsc = X.hasLimitedSocketCapacity();
+            LOOP_ASSERT(hlsc, false == hlsc);
+        }
+      } break;
+      case 10: {
+        // -----------------------------------------------------------------
+        // TESTING BATCHED AND STALE POLL REQUESTS
+        //
+        // Concerns:
+        //: 1 More registrations than the submission ring holds can be made
+        //:   between two calls to 'dispatch'.
+        //:
+        //: 2 Closing a socket right after deregistering it releases the
+        //:   connection, although no 'dispatch' took place in between.
+        //:
+        //: 3 The completion of the poll request of a deregistered socket is
+        //:   not reported to a socket later registered with the same
+        //:   descriptor.
+        //:
+        //: 4 A socket closed without being deregistered is not reported.
+        //
+        // Plan:
+        //: 1 Register the write event of more sockets than the ring holds,
+        //:   and verify that one 'dispatch' invokes every callback.  (C-1)
+        //:
+        //: 2 Register a socket, dispatch (so that its poll request is
+        //:   submitted), deregister and close it, and verify that its peer
+        //:   reads end-of-file without blocking.  (C-2)
+        //:
+        //: 3 Register a readable socket with a callback that asserts,
+        //:   deregister and close it, register a new socket (reusing the
+        //:   descriptor) that is not readable, and verify that 'dispatch'
+        //:   times out without invoking a callback.  (C-3)
+        //:
+        //: 4 Register a socket with a callback that asserts, dispatch, close
+        //:   it, and verify that 'dispatch' times out.  (C-4)
+        //
+        // Testing:
+        //   BATCHED AND STALE POLL REQUESTS
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCHED AND STALE POLL REQUESTS" << endl
+                          << "=======================================" << endl;
+
+        if (verbose) cout << "\tFilling the submission ring." << endl;
+        {
+            enum { k_NUM_PAIRS = 300 };
+
+            Obj mX(&timeMetric, &testAllocator);
+
+            bsl::vector<btlso::SocketHandle::Handle> sockets;
+            int numInvocations = 0;
+            for (int i = 0; i < k_NUM_PAIRS; ++i) {
+                btlso::SocketHandle::Handle socket[2];
+                int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+                LOOP_ASSERT(i, 0 == rc);
+                sockets.push_back(socket[0]);
+                sockets.push_back(socket[1]);
+
+                rc = mX.registerSocketEvent(
+                              socket[0],
+                              btlso::EventType::e_WRITE,
+                              bdlf::BindUtil::bind(&countCb, &numInvocations));
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            ASSERT(k_NUM_PAIRS == mX.numEvents());
+
+            int rc = mX.dispatch(bdlt::CurrentTime::now() + 5, 0);
+            LOOP_ASSERT(rc, k_NUM_PAIRS == rc);
+            LOOP_ASSERT(numInvocations, k_NUM_PAIRS == numInvocations);
+
+            mX.deregisterAll();
+            for (bsl::size_t i = 0; i < sockets.size(); ++i) {
+                btlso::SocketImpUtil::close(sockets[i]);
+            }
+        }
+
+        if (verbose) cout << "\tClosing after deregistering." << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            btlso::SocketHandle::Handle socket[2];
+            int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+
+            bsl::function<void()> cb(&assertCb);
+            ASSERT(0 == mX.registerSocketEvent(socket[0],
+                                               btlso::EventType::e_READ,
+                                               cb));
+            bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(10);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+
+            ASSERT(1 == mX.deregisterSocket(socket[0]));
+            btlso::SocketImpUtil::close(socket[0]);
+
+            char buffer;
+            ASSERT(0 == ::recv(socket[1], &buffer, 1, MSG_DONTWAIT));
+
+            btlso::SocketImpUtil::close(socket[1]);
+        }
+
+        if (verbose) cout << "\tReusing a descriptor." << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            btlso::SocketHandle::Handle socket[2];
+            int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+
+            bsl::function<void()> cb(&assertCb);
+            ASSERT(0 == mX.registerSocketEvent(socket[0],
+                                               btlso::EventType::e_READ,
+                                               cb));
+            bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(10);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+
+            ASSERT(1 == btlso::SocketImpUtil::write(socket[1], "x", 1));
+
+            ASSERT(1 == mX.deregisterSocket(socket[0]));
+            btlso::SocketImpUtil::close(socket[0]);
+            btlso::SocketImpUtil::close(socket[1]);
+
+            btlso::SocketHandle::Handle other[2];
+            rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        other,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+            if (veryVerbose) { P_(socket[0]); P(other[0]); }
+
+            int                   numInvocations = 0;
+            bsl::function<void()> countCallback(
+                              bdlf::BindUtil::bind(&countCb, &numInvocations));
+            for (int i = 0; i < 2; ++i) {
+                ASSERT(0 == mX.registerSocketEvent(other[i],
+                                                   btlso::EventType::e_READ,
+                                                   countCallback));
+            }
+            timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(100);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+            ASSERT(0 == numInvocations);
+
+            mX.deregisterAll();
+            btlso::SocketImpUtil::close(other[0]);
+            btlso::SocketImpUtil::close(other[1]);
+        }
+
+        if (verbose) cout << "\tClosing without deregistering." << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            btlso::SocketHandle::Handle socket[2];
+            int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                        socket,
+                                        btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+
+            bsl::function<void()> cb(&assertCb);
+            ASSERT(0 == mX.registerSocketEvent(socket[0],
+                                               btlso::EventType::e_READ,
+                                               cb));
+            bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(10);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+
+            btlso::SocketImpUtil::close(socket[0]);
+
+            timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(100);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+
+            btlso::SocketImpUtil::close(socket[1]);
+        }
+      } break;
+      case 9: {
+        // -----------------------------------------------------------------
+        // MULTIPLE REGISTERING AND DEREGISTERING IN CALLBACK
+        //
+        // Concerns:
+        //   Registering and deregistering functions can be called in pairs
+        //   multiple times in a callback function without problem.
+        //
+        // Methodology:
+        //   We register a socket handle to a event manager with a special
+        //   callback function that does extra multiple registering and
+        //   deregistering to the same event manager by invoking the methods
+        //   inteded for testing.  Verify there is no printed error or crash
+        //   ater the callback is executed.  Then, verify the deregistration
+        //   from a callback of the same or another socket, using custom
+        //   scripts exercised by 'btlso::EventManagerTester'.
+        //
+        // Testing:
+        //   'registerSocketEvent'   in a callback function
+        //   'deregisterSocketEvent' in a callback function
+        //   'deregisterSocket'      in a callback function
+        //   'deregisterAll'         in a callback function
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "MULTIPLE REGISTERING AND DEREGISTERING IN CALLBACK" << endl
+               << "==================================================" << endl;
+
+        {
+            enum { NUM_BYTES = 16 };
+
+            Obj mX;
+
+            btlso::SocketHandle::Handle socket[2];
+
+            int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                                socket, btlso::SocketImpUtil::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+
+            btlso::EventManager::Callback multiRegisterDeregisterCallback(
+                        bdlf::BindUtil::bind(&multiRegisterDeregisterCb, &mX));
+
+            ASSERT(0 == mX.registerSocketEvent(
+                                             socket[0],
+                                             btlso::EventType::e_READ,
+                                             multiRegisterDeregisterCallback));
+            ASSERT(0 == mX.registerSocketEvent(
+                                             socket[0],
+                                             btlso::EventType::e_WRITE,
+                                             multiRegisterDeregisterCallback));
+            ASSERT(0 == mX.registerSocketEvent(
+                                             socket[1],
+                                             btlso::EventType::e_READ,
+                                             multiRegisterDeregisterCallback));
+            ASSERT(0 == mX.registerSocketEvent(
+                                             socket[1],
+                                             btlso::EventType::e_WRITE,
+                                             multiRegisterDeregisterCallback));
+
+            char wBuffer[NUM_BYTES];
+            memset(wBuffer,'4', NUM_BYTES);
+            rc = btlso::SocketImpUtil::write(socket[0],
+                                             &wBuffer,
+                                             NUM_BYTES,
+                                             0);
+            ASSERT(0 < rc);
+
+            ASSERT(1 == mX.dispatch(bsls::TimeInterval(1.0), 0));
+
+            btlso::SocketImpUtil::close(socket[0]);
+            btlso::SocketImpUtil::close(socket[1]);
+        }
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+//-------------->
+{ L_, 0,  "+0r64,{-0}; W0,64; T1; Dn,1; T0"                              },
+{ L_, 0,  "+0r64,{-0}; +1r64; W0,64;  W1,64; T2; Dn,2; T1; E1r; E0"      },
+{ L_, 0,  "+0r64; +1r64,{-1}; +2r64; W0,64;  W1,64; W2,64; T3; Dn,3; T2"
+          "E0r; E1; E2r"                                                 },
+{ L_, 0,  "+0r64,{-1; +1r64}; +1r64; W0,64; W1,64; T2; Dn,2; T2"         },
+{ L_, 0,  "+0r64,{-1}; +1r64,{-0}; W0,64;  W1,64; T2; Dn,1; T1"          },
+{ L_, 0,  "+0r64, {-1}; +1r; W0,64; T2; Dn,1; T1; E0r; E1"               },
+{ L_, 0,  "+0r3,{-0r; +0r3}; W0,6; Dn,1; Dn,1; Dn100,0"                  },
+//-------------->
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                enum { NUM_PAIRS = 4 };
+                btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+                for (int j = 0; j < NUM_PAIRS; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+            }
+        }
+      } break;
+
+      case 8: {
+        // -----------------------------------------------------------------
+        // TESTING 'dispatch' FUNCTION:
+        //   The goal is to ensure that 'dispatch' invokes the callback
+        //   method for the write socket handle and event, for all possible
+        //   events.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the dispatch() in
+        //   this event manager.
+        // Customized test:
+        //   Create an object of the event manager under test and a list
+        //   of test scripts based on the script grammar defined in
+        //   'btlso::EventManagerTester', call the script interpreting function
+        //   gg() of 'btlso::EventManagerTester' to execute the test data.
+        // Exhausting test:
+        //   Test the "timeout" from the dispatch() with the loop-driven
+        //   implementation where timeout value are generated during each
+        //   iteration and invoke the dispatch() with it.
+        // Testing:
+        //   int dispatch();
+        //   int dispatch(const bsls::TimeInterval&, ...);
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'dispatch' METHOD." << endl
+                                  << "==========================" << endl;
+
+        if (verbose)
+            cout << "\tStandard test for 'dispatch'" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            int notFailed = !btlso::EventManagerTester::testDispatch(
+                                                                  &mX,
+                                                                  controlFlag);
+            ASSERT("BLACK-BOX (standard) TEST FAILED" && notFailed);
+        }
+
+        if (verbose)
+            cout << "\tCustom test for 'dispatch'" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+                {L_, 0, "Dn0,0"                                              },
+                {L_, 0, "Dn100,0"                                            },
+                {L_, 0, "+0w2; Dn,1"                                         },
+                {L_, 0, "+0w40; +0r3; Dn0,1; W0,30;  Dn0,2"                  },
+                {L_, 0, "+0w40; +0r3; Dn100,1; W0,30; Dn120,2"               },
+                {L_, 0, "+0w20; +0r12; Dn,1; W0,30; +1w6; +2w8; Dn,4"        },
+                {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12; W3,30;"
+                        "Dn,4; W0,30; +1r6; W1,30; +2r8; W2,30; +3r10; Dn,8" },
+                {L_, 0, "+2r3; Dn100,0; +2w40; Dn50,1;  W2,30; Dn55,2"       },
+                {L_, 0, "+0w20; +0r12; Dn0,1; W0,30; +1w6; +2w8; Dn100,4"    },
+                {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12; Dn100,4;"
+                        "W0,60; W1,70; +1r6; W2,60; W3,60; +2r8; +3r10;"
+                        "Dn120,8"                                            },
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                btlso::EventManagerTestPair socketPairs[4];
+
+                const int NUM_PAIR = sizeof socketPairs /sizeof socketPairs[0];
+
+                for (int j = 0; j < NUM_PAIR; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+        }
+        if (verbose)
+            cout << "\tVerifying behavior on timeout (no sockets)." << endl;
+        {
+            const int NUM_ATTEMPTS = 50;
+            for (int i = 0; i < NUM_ATTEMPTS; ++i) {
+                Obj mX(&timeMetric, &testAllocator);
+                bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+
+                deadline.addMilliseconds(i % 10);
+                deadline.addNanoseconds(i % 1000);
+
+                LOOP_ASSERT(i, 0 == mX.dispatch(
+                                              deadline,
+                                              btlso::Flag::k_ASYNC_INTERRUPT));
+
+                bsls::TimeInterval now = bdlt::CurrentTime::now();
+                LOOP_ASSERT(i, deadline <= now);
+
+                if (veryVeryVerbose) {
+                    P_(deadline); P(now);
+                }
+            }
+        }
+        if (verbose)
+            cout << "\tVerifying behavior on timeout (at least one socket)."
+                 << endl;
+        {
+            btlso::EventManagerTestPair socketPair;
+            bsl::function<void()>  nullFunctor;
+
+            const int NUM_ATTEMPTS = 50;
+            for (int i = 0; i < NUM_ATTEMPTS; ++i) {
+                Obj mX(&timeMetric, &testAllocator);
+                mX.registerSocketEvent(socketPair.observedFd(),
+                                       btlso::EventType::e_READ,
+                                       nullFunctor);
+
+                bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+
+                deadline.addMilliseconds(i % 10);
+                deadline.addNanoseconds(i % 1000);
+
+                LOOP_ASSERT(i, 0 ==
+                        mX.dispatch(deadline, btlso::Flag::k_ASYNC_INTERRUPT));
+
+                bsls::TimeInterval now = bdlt::CurrentTime::now();
+                LOOP3_ASSERT(deadline, now, i, deadline <= now);
+
+                if (veryVeryVerbose) {
+                    P_(deadline); P(now);
+                }
+            }
+        }
+      } break;
+      case 7: {
+        // -----------------------------------------------------------------
+        // TESTING 'deregisterAll' FUNCTION:
+        //   It must be verified that the application of 'deregisterAll'
+        //   from any state returns the event manager.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the deregisterAll() in
+        //   this event manager.
+        // Customized test:
+        //   No customized test since no difference in implementation
+        //   between all event managers.
+        // Testing:
+        //   void deregisterAll();
+        // -----------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'deregisterAll'" << endl
+                                  << "=======================" << endl;
+        if (verbose)
+            cout << "Standard test for 'deregisterAll'" << endl
+                 << "=================================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            int fails = EventManagerTester::testDeregisterAll(&mX,
+                                                              controlFlag);
+            ASSERT(0 == fails);
+        }
+
+      } break;
+
+      case 6: {
+        // -----------------------------------------------------------------
+        // TESTING 'deregisterSocket' FUNCTION:
+        //   All possible transitions from other state to 0 must be
+        //   exhaustively tested.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the deregisterSocket()
+        //   in this event manager.
+        // Customized test:
+        //   Create a socket, register and then unregister more than the system
+        //   limit for open files and then try to dispatch.  This will make
+        //   sure that the submission ring is flushed when it is full and
+        //   that no stale poll request is reported.
+        // Testing:
+        //   int deregisterSocket();
+        // -----------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'deregisterSocket'" << endl
+                                  << "==========================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            int fails = EventManagerTester::testDeregisterSocket(&mX,
+                                                                 controlFlag);
+            ASSERT(0 == fails);
+        }
+        {
+            enum { NUM_DEREGISTERS = 70000 };
+            Obj mX;
+
+            bsl::function<void()> cb(&assertCb);
+
+            for (int i = 0; i < NUM_DEREGISTERS; ++i) {
+                int fd = socket(PF_INET, SOCK_STREAM, 0);
+                BSLS_ASSERT_OPT(fd != -1);
+                mX.registerSocketEvent(fd, btlso::EventType::e_READ, cb);
+                mX.deregisterSocket(fd);
+                close(fd);
+            }
+            btlso::EventManagerTestPair socketPair;
+            mX.registerSocketEvent(socketPair.controlFd(),
+                                   btlso::EventType::e_READ, cb);
+            bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(200);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+        }
+      } break;
+      case 5: {
+        // -----------------------------------------------------------------
+        // TESTING 'deregisterSocketEvent' FUNCTION:
+        //   All possible deregistration transitions must be exhaustively
+        //   tested.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding test function of 'btlso::EventManagerTester', where
+        //   multiple socket pairs are created to test the
+        //   deregisterSocketEvent() in this event manager.
+        // Customized test:
+        //   Create a socket, register and then unregister more than the system
+        //   limit for open files and then try to dispatch.  This will make
+        //   sure that the submission ring is flushed when it is full and
+        //   that no stale poll request is reported.
+        // Testing:
+        //   void deregisterSocketEvent();
+        // -----------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'deregisterSocketEvent'" << endl
+                                  << "===============================" << endl;
+        if (verbose)
+            cout << "Standard test for 'deregisterSocketEvent'" << endl
+                 << "=========================================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+
+            int fails = EventManagerTester::testDeregisterSocketEvent(
+                                                                  &mX,
+                                                                  controlFlag);
+            ASSERT(0 == fails);
+        }
+
+        if (verbose)
+            cout << "Customized test for 'deregisterSocketEvent'" << endl
+                 << "===========================================" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+               {L_, 0, "+0w; -0w; T0"          },
+               {L_, 0, "+0w; +0r; -0w; E0r; T1"},
+               {L_, 0, "+0w; +1r; -0w; E1r; T1"},
+               {L_, 0, "+0w; +1r; -1r; E0w; T1"},
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                btlso::EventManagerTestPair socketPairs[4];
+
+                const int NUM_PAIR = sizeof socketPairs /sizeof socketPairs[0];
+
+                for (int j = 0; j < NUM_PAIR; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+        }
+        {
+            enum { NUM_DEREGISTERS = 70000 };
+            Obj mX;
+
+            bsl::function<void()> cb(&assertCb);
+
+            for (int i = 0; i < NUM_DEREGISTERS; ++i) {
+                int fd = socket(PF_INET, SOCK_STREAM, 0);
+                BSLS_ASSERT_OPT(fd != -1);
+                mX.registerSocketEvent(fd, btlso::EventType::e_READ, cb);
+                mX.deregisterSocketEvent(fd, btlso::EventType::e_READ);
+                close(fd);
+            }
+            btlso::EventManagerTestPair socketPair;
+            mX.registerSocketEvent(socketPair.observedFd(),
+                                   btlso::EventType::e_READ, cb);
+            bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+            timeout.addMilliseconds(200);
+            ASSERT(0 == mX.dispatch(timeout, 0));
+        }
+      } break;
+      case 4: {
+        // -----------------------------------------------------------------
+        // TESTING 'registerSocketEvent' FUNCTION:
+        //   The main concern about this function is to ensure full coverage
+        //   of the every legal event combination that can be registered for
+        //   one and two sockets.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding function of 'btlso::EventManagerTester', where a
+        //   number of socket pairs are created to test the
+        //   registerSocketEvent() in this event manager.
+        // Customized test:
+        //   Create an object of the event manager under test and a list
+        //   of test scripts based on the script grammar defined in
+        //   'btlso::EventManagerTester', call the script interpreting function
+        //   gg() of 'btlso::EventManagerTester' to execute the test data.
+        // Testing:
+        //   void registerSocketEvent();
+        // -----------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING 'registerSocketEvent'" << endl
+                                  << "=============================" << endl;
+        if (verbose)
+            cout << "Standard test for 'registerSocketEvent'" << endl
+                 << "=======================================" << endl;
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            int fails = EventManagerTester::testRegisterSocketEvent(
+                                                                  &mX,
+                                                                  controlFlag);
+            ASSERT(0 == fails);
+
+            if (verbose) {
+                P(timeMetric.percentage(btlso::TimeMetrics::e_CPU_BOUND));
+            }
+            ASSERT(100 == timeMetric.percentage(
+                                             btlso::TimeMetrics::e_CPU_BOUND));
+        }
+
+        if (verbose)
+            cout << "Customized test for 'registerSocketEvent'" << endl
+                 << "=========================================" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+               {L_, 0, "+0w; E0w; T1"                      },
+               {L_, 0, "+0r; E0r; T1"                      },
+               {L_, 0, "+0w; +0w; E0w; T1"                 },
+               {L_, 0, "+0r; +0r; E0r; T1"                 },
+               {L_, 0, "+0w; +0w; +0r; +0r; E0rw; T2"      },
+               {L_, 0, "+0w; +1r; E0w; E1r; T2"            },
+               {L_, 0, "+0w; +1r; +1w; +0r; E0rw; E1rw; T4"},
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX(&timeMetric, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                btlso::EventManagerTestPair socketPairs[4];
+
+                const int NUM_PAIR =
+                               sizeof socketPairs / sizeof socketPairs[0];
+
+                for (int j = 0; j < NUM_PAIR; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+                int fails = btlso::EventManagerTester::gg(&mX,
+                                                          socketPairs,
+                                                          SCRIPTS[i].d_script,
+                                                          controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+            if (verbose) {
+                P(timeMetric.percentage(btlso::TimeMetrics::e_CPU_BOUND));
+            }
+            ASSERT(100 == timeMetric.percentage(
+                                             btlso::TimeMetrics::e_CPU_BOUND));
+        }
+
+      } break;
+      case 3: {
+        // -----------------------------------------------------------------
+        // TESTING ACCESSORS:
+        //   The main concern about this function is to ensure full coverage
+        //   of the every legal event combination that can be registered for
+        //   one and two sockets.
+        //
+        // Plan:
+        // Standard test:
+        //   Create an object of the event manager under test, call the
+        //   corresponding function of 'btlso::EventManagerTester', where a
+        //   number of socket pairs are created to test the accessors in
+        //   this event manager.
+        // Customized test:
+        //   No customized test since no difference in implementation
+        //   between all event managers.
+        // Testing:
+        //   int isRegistered();
+        //   int numEvents() const;
+        //   int numSocketEvents();
+        // -----------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING ACCESSORS" << endl
+                                  << "=================" << endl;
+
+        if (verbose) cout << "\tOn a non-metered object" << endl;
+        {
+
+            Obj mX((btlso::TimeMetrics*)0, &testAllocator);
+
+            int fails = EventManagerTester::testAccessors(&mX, controlFlag);
+            ASSERT(0 == fails);
+        }
+        if (verbose) cout << "\tOn a metered object" << endl;
+        {
+
+            Obj mX(&timeMetric, &testAllocator);
+            int fails = EventManagerTester::testAccessors(&mX, controlFlag);
+            ASSERT(0 == fails);
+            if (verbose) {
+                P(timeMetric.percentage(btlso::TimeMetrics::e_CPU_BOUND));
+            }
+            ASSERT(100 == timeMetric.percentage(
+                                             btlso::TimeMetrics::e_CPU_BOUND));
+        }
+      } break;
+      case 2: {
+        // -----------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS:
+        //
+        // Plan:
+        // Standard test:
+        //   Create objects of the event manager under test and a list
+        //   of test scripts based on the script grammar defined in
+        //   'btlso::EventManagerTester', call the script interpreting function
+        //   gg() of 'btlso::EventManagerTester' to execute the test data.
+        // Testing:
+        //   btlso::DefaultEventManager();
+        //   ~btlso::DefaultEventManager();
+        // -----------------------------------------------------------------
+        if (verbose) cout << endl << "TESTING PRIMARY MANIPULATORS" << endl
+                                  << "============================" << endl;
+        {
+            Obj mX[2];
+            const int NUM_OBJ = sizeof mX / sizeof mX[0];
+            for (int k = 0; k < NUM_OBJ; k++) {
+                 struct {
+                     int         d_line;
+                     int         d_fails;  // failures in this script
+                     const char *d_script;
+                } SCRIPTS[] =
+                {
+         //------------------>
+         { L_, 0, "+0r; E0r; T1; -0r; E0; T0"                               },
+         { L_, 0, "+0w; E0w; T1; -0w; E0; T0"                               },
+         { L_, 0, "+0w; +0w; E0w; T1; -0w; E0; T0"                          },
+         { L_, 0, "+0r; +0r; E0r; T1; -0r; E0; T0"                          },
+         { L_, 0, "+0r; +0w; E0rw; T2; -0r; -0w; E0; T0"                    },
+         { L_, 0, "+0r; +1r; E0r; E1r; T2; -0r; -1r; E0; E1; T0"            },
+         { L_, 0, "+0r; +1r; +1w; E0r; E1wr; T3; -0r; -1r; -1w; E0; E1; T0" },
+         { L_, 0, "+0r; +1r; +1w; +0w E0rw; E1wr; T4"                       },
+         //------------------>
+                };
+                const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+                for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                    const int LINE =  SCRIPTS[i].d_line;
+                    enum { NUM_PAIRS = 4 };
+
+                    btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+                    for (int j = 0; j < NUM_PAIRS; j++) {
+                        socketPairs[i].setObservedBufferOptions(BUF_LEN, 1);
+                        socketPairs[i].setControlBufferOptions(BUF_LEN, 1);
+                    }
+
+                    int fails = EventManagerTester::gg(&mX[k],
+                                                       socketPairs,
+                                                       SCRIPTS[i].d_script,
+                                                       controlFlag);
+
+                    LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                    if (veryVerbose) {
+                        P_(LINE);   P(fails);
+                    }
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // -----------------------------------------------------------------
+        // BREATHING TEST
+        //   Ensure the basic liveness of an event manager instance.
+        //
+        // Testing:
+        //   Create an object of this event manager under test.  Perform
+        //   some basic operations on it.
+        // -----------------------------------------------------------------
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+        {
+            struct {
+                int         d_line;
+                int         d_fails;  // number of failures in this script
+                const char *d_script;
+            } SCRIPTS[] =
+            {
+               {L_, 0, "Dn0,0"                                            },
+               {L_, 0, "Dn100,0"                                          },
+               {L_, 0, "+0w2; Dn,1"                                       },
+               {L_, 0, "+0w40; +0r3; Dn0,1; W0,40; Dn0,2"                 },
+               {L_, 0, "+0w40; +0r3; Dn100,1; W0,40; Dn120,2"             },
+               {L_, 0, "+0w20; +0r12; Dn,1; W0,30; +1w6; +2w8; Dn,4"      },
+               {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12;"
+                        "Dn,4; W0,40; +1r6; W1,40; W2,40; W3,40; +2r8;"
+                        "+3r10; Dn,8"                                     },
+               {L_, 0, "+2r3; Dn100,0; +2w40; Dn50,1; W2,40; Dn55,2"      },
+               {L_, 0, "+0w20; +0r12; Dn0,1; +1w6; +2w8; W0,40; Dn100,4"  },
+               {L_, 0, "+0w40; +1r6; +1w41; +2w42; +3w43; +0r12;"
+                       "Dn100,4; W0,40; W1,40; W2,40; W3,40; +1r6; +2r8;"
+                       "+3r10; Dn120,8"                                   },
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+            for (int i = 0; i < NUM_SCRIPTS; ++i) {
+
+                Obj mX((btlso::TimeMetrics*)0, &testAllocator);
+                const int LINE =  SCRIPTS[i].d_line;
+
+                enum { NUM_PAIRS  = 4 };
+                btlso::EventManagerTestPair socketPairs[NUM_PAIRS];
+
+                for (int j = 0; j < NUM_PAIRS; j++) {
+                    socketPairs[j].setObservedBufferOptions(BUF_LEN, 1);
+                    socketPairs[j].setControlBufferOptions(BUF_LEN, 1);
+                }
+
+                int fails = EventManagerTester::gg(&mX,
+                                                   socketPairs,
+                                                   SCRIPTS[i].d_script,
+                                                   controlFlag);
+
+                LOOP_ASSERT(LINE, SCRIPTS[i].d_fails == fails);
+
+                if (veryVerbose) {
+                    P_(LINE);   P(fails);
+                }
+            }
+        }
+      } break;
+
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TESTING 'dispatch':
+        //   Get the performance data.
+        //
+        // Plan:
+        //   Set up a collection of socketPairs and register one end of all the
+        //   pairs with the event manager.  Write 1 byte to
+        //   'fracBusy * numSocketPairs' of the connections, and measure the
+        //   average time taken to dispatch a read event for a given number of
+        //   registered read event.  If 'timeOut > 0' register a timeout
+        //   interval with the 'dispatch' call.  If 'R|N' is 'R', actually read
+        //   the bytes in the dispatch, if it's 'N', just call a null function
+        //   within the dispatch.
+        //
+        // Testing:
+        //   'dispatch' capacity
+        //
+        // See the compilation of results for all event managers & platforms
+        // at the beginning of 'btlso_eventmanagertester.t.cpp'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TESTING 'dispatch'\n"
+                             "==============================\n";
+
+        {
+            Obj mX(&timeMetric, &testAllocator);
+            btlso::EventManagerTester::testDispatchPerformance(&mX,
+                                                               "io_uring",
+                                                               controlFlag);
+        }
+      } break;
+
+      case -2: {
+        // -----------------------------------------------------------------
+        // TESTING PERFORMANCE 'registerSocketEvent' METHOD:
+        //   Get performance data.
+        //
+        // Plan:
+        //   Open multiple sockets and register a read event for each
+        //   socket, calculate the average time taken to register a read
+        //   event for a given number of registered read event.
+        //
+        // Testing:
+        //   Obj::registerSocketEvent
+        //
+        // See the compilation of results for all event managers & platforms
+        // at the beginning of 'btlso_eventmanagertester.t.cpp'.
+        // -----------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TESTING 'registerSocketEvent'\n"
+                             "=========================================\n";
+
+        Obj mX(&timeMetric, &testAllocator);
+        btlso::EventManagerTester::testRegisterPerformance(&mX, controlFlag);
+      } break;
+
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    btlso::SocketImpUtil::cleanup();
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+#else
+    return -1;
+#endif // BTESO_EVENTMANAGERIMP_ENABLETEST
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
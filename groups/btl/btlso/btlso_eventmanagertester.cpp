@@ -1470,6 +1470,76 @@ EventManagerTester::testDispatch(EventManager *mX, int flags)
     return numFailures;
 }
 
+
+int
+EventManagerTester::testDispatchEdgeTriggered(EventManager *mX, int flags)
+{
+    int numFailures = 0;
+
+    if (flags & EventManagerTester::k_VERBOSE) {
+        bsl::puts("Testing 'testDispatchEdgeTriggered' method\n"
+                  "==========================================");
+    }
+
+    struct {
+        int         d_line;
+        const char *d_script;
+    } SCRIPTS[] =
+    { // The reason to put "-a;" at the beginning of each script is that we
+      // only use ONE eventmanager for all script here.
+
+        // A callback that leaves data unread is not invoked again until more
+        // data arrives.
+      {L_, "-a; +0r24; W0,64; Dn,1; Dn100,0; W0,8; Dn,1; Dn100,0; -0; T0"  },
+
+        // Draining the socket in the callback leaves nothing to report.
+      {L_, "-a; +0r64; W0,64; Dn,1; Dn100,0; -0; T0"                      },
+
+        // Re-registering a read event reports the data left in the socket.
+      {L_, "-a; +0r24; W0,64; Dn,1; Dn100,0; -0r; +0r40; Dn,1; Dn100,0;"
+                                                              " -0; T0"   },
+
+        // A writable socket is reported once, and again when re-registered.
+      {L_, "-a; +0w64; Dn,1; Dn100,0; -0w; +0w64; Dn,1; -0; T0"           },
+
+        // Adding a write event reports a socket that is already writable,
+        // without losing its read registration.
+      {L_, "-a; +0r24; W0,24; Dn,1; +0w64; Dn,1; -0w; W0,24; Dn,1; -a; T0"},
+
+        // Each socket is reported independently of the others.
+      {L_, "-a; +0r24; +1r24; W0,64; W1,64; Dn,2; Dn100,0; W1,8;"
+                                                  " Dn,1; Dn100,0; -a; T0"},
+    };
+    const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+
+    for (int i = 0; i < NUM_SCRIPTS; ++i) {
+        enum { k_NUM_PAIRS = 2 };
+        SocketPair socketPairs[k_NUM_PAIRS];
+
+        for (int j = 0; j < k_NUM_PAIRS; ++j) {
+            socketPairs[j].setObservedBufferOptions(k_BUF_LEN, 1);
+            socketPairs[j].setControlBufferOptions(k_BUF_LEN, 1);
+        }
+
+        const int ret = gg(mX, socketPairs, SCRIPTS[i].d_script, flags);
+
+        if (e_SUCCESS != ret) {
+            if (flags & EventManagerTester::k_ABORT) {
+                BSLS_ASSERT(0);
+            }
+            else {
+                ++numFailures;
+                const int LINE = SCRIPTS[i].d_line;
+                if (flags & EventManagerTester::k_VERY_VERBOSE) {
+                    bsl::printf("Line: %d\n", LINE);
+                    bsl::fflush(stdout);
+                }
+            }
+        }
+    }
+    return numFailures;
+}
+
 int
 EventManagerTester::testDispatchPerformance(EventManager *mX,
                                             const char   *pollingMechName,
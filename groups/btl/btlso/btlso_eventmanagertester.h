@@ -49,6 +49,7 @@ BSLS_IDENT("$Id: $")
 //        testDeregisterSocket
 //        testDeregisterSocketEvent
 //        testDispatch
+//        testDispatchEdgeTriggered
 //        testRegisterSocketEvent
 //
 //        Programmable Test Methods
@@ -613,6 +614,19 @@ struct EventManagerTester {
         // the 'ABORT' bit is set in 'flags', a detected failure will force the
         // test to abort.
 
+    static int testDispatchEdgeTriggered(EventManager *eventManager,
+                                         int           flags);
+        // Exercise a pre-defined ("canned") test of the 'dispatch' methods of
+        // the specified edge-triggered 'eventManager' using the specified
+        // 'flags' to control execution, verifying that a callback is invoked
+        // only when its socket becomes ready (e.g., not again for data left
+        // unread by a previous callback), and that registering an event for a
+        // socket that is already ready reports it.  Return the number of
+        // failures detected.  The behavior is undefined unless 'eventManager'
+        // reports socket events in edge-triggered mode (see, e.g.,
+        // 'btlso_defaulteventmanager_epoll').  Note that if the 'ABORT' bit is
+        // set in 'flags', a detected failure will force the test to abort.
+
     static int testRegisterSocketEvent(EventManager *eventManager,
                                        int           flags);
         // Exercise a pre-defined ("canned") test of the 'registerSocketEvent'
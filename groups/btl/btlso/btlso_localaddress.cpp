@@ -0,0 +1,57 @@
+// btlso_localaddress.cpp                                             -*-C++-*-
+#include <btlso_localaddress.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlso_localaddress_cpp, "$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace btlso {
+
+                            // ------------------
+                            // class LocalAddress
+                            // ------------------
+
+// ACCESSORS
+bsl::ostream& LocalAddress::print(bsl::ostream& stream,
+                                  int           level,
+                                  int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("path", d_path);
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bsl::ostream& btlso::operator<<(bsl::ostream&       stream,
+                                const LocalAddress& object)
+{
+    stream << object.path();
+    return stream;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,308 @@
+// btlso_localaddress.h                                               -*-C++-*-
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#define INCLUDED_BTLSO_LOCALADDRESS
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a filesystem-path address of a local (Unix-domain) socket.
+//
+//@CLASSES:
+//  btlso::LocalAddress: path naming an 'AF_UNIX' stream socket endpoint
+//
+//@SEE_ALSO: btlso_ipv4address, btlso_socketimputil,
+//           btlso_inetstreamsocketfactory
+//
+//@DESCRIPTION: This component provides a value-semantic attribute class,
+// 'btlso::LocalAddress', that names the endpoint of a local (a.k.a.
+// Unix-domain, or 'AF_UNIX') socket by a filesystem path.  A 'LocalAddress'
+// plays the same role for local sockets that 'btlso::IPv4Address' plays for
+// TCP sockets: it may be used as the 'ADDRESS' template parameter of the
+// 'btlso::SocketImpUtil' functions, of 'btlso::InetStreamSocket', and of
+// 'btlso::InetStreamSocketFactory', so that, for example,
+// 'btlso::InetStreamSocketFactory<btlso::LocalAddress>' allocates 'AF_UNIX'
+// stream sockets.  Local sockets are only supported on platforms providing
+// BSD sockets (i.e., not on Windows).
+//
+// The path is stored inline (no memory is allocated), and its length is
+// limited to 'k_MAX_PATH_LENGTH' characters, which is the longest path that
+// fits in the 'sun_path' field of a 'sockaddr_un' on all supported platforms
+// (including the null terminator).  Relative paths are resolved against the
+// working directory of the process at the time the address is used.  Linux
+// "abstract" socket names (starting with a null character) are not supported.
+// A default-constructed 'LocalAddress' has an empty path, which is also the
+// value reported for the unnamed end of a connected local socket.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Naming a Local Server
+/// - - - - - - - - - - - - - - - -
+// First, we create a 'btlso::LocalAddress' naming the socket on which a
+// server will listen:
+//..
+//  btlso::LocalAddress address("/tmp/myserver.sock");
+//  assert(0 == bsl::strcmp("/tmp/myserver.sock", address.path()));
+//..
+// Then, we verify that a path that is too long for a 'sockaddr_un' is
+// rejected by 'setPathIfValid', leaving the address unchanged:
+//..
+//  bsl::string tooLong(btlso::LocalAddress::k_MAX_PATH_LENGTH + 1, 'x');
+//  assert(0 != address.setPathIfValid(tooLong));
+//  assert(0 == bsl::strcmp("/tmp/myserver.sock", address.path()));
+//..
+// Finally, we write the address to 'stdout':
+//..
+//  bsl::cout << address << bsl::endl;
+//..
+// which produces:
+//..
+//  /tmp/myserver.sock
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace btlso {
+
+                            // ==================
+                            // class LocalAddress
+                            // ==================
+
+class LocalAddress {
+    // This value-semantic class names the endpoint of a local ('AF_UNIX')
+    // socket by a filesystem path of at most 'k_MAX_PATH_LENGTH' characters.
+    // The path is stored inline, and is always null-terminated.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_PATH_LENGTH = 103  // longest path (excluding the terminating
+                                 // null character) that fits in 'sun_path'
+                                 // on all supported platforms
+    };
+
+  private:
+    // DATA
+    char d_path[k_MAX_PATH_LENGTH + 1];  // null-terminated path
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LocalAddress, bsl::is_trivially_copyable);
+
+    // CLASS METHODS
+    static bool isValid(const bslstl::StringRef& path);
+        // Return 'true' if the specified 'path' is a valid value for a
+        // 'LocalAddress' object, and 'false' otherwise.  'path' is valid if
+        // its length does not exceed 'k_MAX_PATH_LENGTH' and it contains no
+        // null character.
+
+    // CREATORS
+    LocalAddress();
+        // Create a local address having an empty path.
+
+    explicit LocalAddress(const bslstl::StringRef& path);
+        // Create a local address having the specified 'path'.  The behavior
+        // is undefined unless 'isValid(path)' is 'true'.
+
+    //! LocalAddress(const LocalAddress& original) = default;
+        // Create a local address having the value of the specified 'original'
+        // object.
+
+    //! ~LocalAddress() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! LocalAddress& operator=(const LocalAddress& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void setPath(const bslstl::StringRef& path);
+        // Set the path of this object to the specified 'path'.  The behavior
+        // is undefined unless 'isValid(path)' is 'true'.
+
+    int setPathIfValid(const bslstl::StringRef& path);
+        // Set the path of this object to the specified 'path' and return 0 if
+        // 'isValid(path)' is 'true'.  Otherwise leave the value of this object
+        // unchanged and return a non-zero value.
+
+    // ACCESSORS
+    bool isEmpty() const;
+        // Return 'true' if the path of this object is empty, and 'false'
+        // otherwise.
+
+    int length() const;
+        // Return the number of characters in the path of this object, not
+        // including the terminating null character.
+
+    const char *path() const;
+        // Return the address of the null-terminated path of this object.  The
+        // returned pointer remains valid until this object is modified or
+        // destroyed.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value of this object to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested objects.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested objects.  If 'level' is negative, suppress
+        // indentation of the first line.  If 'spacesPerLevel' is negative,
+        // format the entire output on one line, suppressing all but the
+        // initial indentation (as governed by 'level').  If 'stream' is not
+        // valid on entry, this operation has no effect.  Note that the format
+        // is not fully specified, and can change without notice.
+};
+
+// FREE OPERATORS
+bool operator==(const LocalAddress& lhs, const LocalAddress& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'LocalAddress' objects have the same
+    // value if their paths are the same.
+
+bool operator!=(const LocalAddress& lhs, const LocalAddress& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'LocalAddress' objects do not
+    // have the same value if their paths differ.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const LocalAddress& object);
+    // Write the path of the specified 'object' to the specified output
+    // 'stream', and return a reference providing modifiable access to
+    // 'stream'.  If 'stream' is not valid on entry, this operation has no
+    // effect.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class LocalAddress
+                            // ------------------
+
+// CLASS METHODS
+inline
+bool LocalAddress::isValid(const bslstl::StringRef& path)
+{
+    return path.length() <= k_MAX_PATH_LENGTH
+        && 0 == bsl::memchr(path.data(), '\0', path.length());
+}
+
+// CREATORS
+inline
+LocalAddress::LocalAddress()
+{
+    d_path[0] = '\0';
+}
+
+inline
+LocalAddress::LocalAddress(const bslstl::StringRef& path)
+{
+    setPath(path);  // assert preconditions and set attributes
+}
+
+// MANIPULATORS
+inline
+void LocalAddress::setPath(const bslstl::StringRef& path)
+{
+    BSLS_ASSERT_SAFE(isValid(path));
+
+    bsl::memcpy(d_path, path.data(), path.length());
+    d_path[path.length()] = '\0';
+}
+
+inline
+int LocalAddress::setPathIfValid(const bslstl::StringRef& path)
+{
+    if (!isValid(path)) {
+        return -1;                                                    // RETURN
+    }
+
+    setPath(path);
+    return 0;
+}
+
+// ACCESSORS
+inline
+bool LocalAddress::isEmpty() const
+{
+    return '\0' == d_path[0];
+}
+
+inline
+int LocalAddress::length() const
+{
+    return static_cast<int>(bsl::strlen(d_path));
+}
+
+inline
+const char *LocalAddress::path() const
+{
+    return d_path;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool btlso::operator==(const LocalAddress& lhs, const LocalAddress& rhs)
+{
+    return 0 == bsl::strcmp(lhs.path(), rhs.path());
+}
+
+inline
+bool btlso::operator!=(const LocalAddress& lhs, const LocalAddress& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
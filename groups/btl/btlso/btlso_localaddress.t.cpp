@@ -0,0 +1,423 @@
+// btlso_localaddress.t.cpp                                           -*-C++-*-
+#include <btlso_localaddress.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is a value-semantic attribute class holding a
+// bounded, inline filesystem path.  We verify the constructors and the
+// primary manipulator against the basic accessors, then the validation of
+// paths, and finally the equality and output operators.  The use of this type
+// with actual sockets is tested in 'btlso_socketimputil'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] bool isValid(const bslstl::StringRef& path);
+//
+// CREATORS
+// [ 2] LocalAddress();
+// [ 2] LocalAddress(const bslstl::StringRef& path);
+// [ 2] LocalAddress(const LocalAddress& original);
+//
+// MANIPULATORS
+// [ 2] LocalAddress& operator=(const LocalAddress& rhs);
+// [ 2] void setPath(const bslstl::StringRef& path);
+// [ 3] int setPathIfValid(const bslstl::StringRef& path);
+//
+// ACCESSORS
+// [ 2] bool isEmpty() const;
+// [ 2] int length() const;
+// [ 2] const char *path() const;
+// [ 4] ostream& print(ostream& stream, level, spacesPerLevel) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(lhs, rhs);
+// [ 4] bool operator!=(lhs, rhs);
+// [ 4] bsl::ostream& operator<<(stream, object);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef btlso::LocalAddress Obj;
+
+const int k_MAX = Obj::k_MAX_PATH_LENGTH;
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file
+        //:   compiles, links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Naming a Local Server
+/// - - - - - - - - - - - - - - - -
+// First, we create a 'btlso::LocalAddress' naming the socket on which a
+// server will listen:
+//..
+    btlso::LocalAddress address("/tmp/myserver.sock");
+    ASSERT(0 == bsl::strcmp("/tmp/myserver.sock", address.path()));
+//..
+// Then, we verify that a path that is too long for a 'sockaddr_un' is
+// rejected by 'setPathIfValid', leaving the address unchanged:
+//..
+    bsl::string tooLong(btlso::LocalAddress::k_MAX_PATH_LENGTH + 1, 'x');
+    ASSERT(0 != address.setPathIfValid(tooLong));
+    ASSERT(0 == bsl::strcmp("/tmp/myserver.sock", address.path()));
+//..
+// Finally, we write the address to 'stdout':
+//..
+    if (veryVerbose) {
+        bsl::cout << address << bsl::endl;
+    }
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EQUALITY AND OUTPUT OPERATORS
+        //
+        // Concerns:
+        //: 1 Two objects compare equal if and only if their paths are the
+        //:   same, including paths that share a prefix.
+        //:
+        //: 2 'operator<<' writes exactly the path, and 'print' writes the
+        //:   path as a named attribute.
+        //
+        // Plan:
+        //: 1 Compare every pair from a table of paths, including the empty
+        //:   path and paths differing only in length.  (C-1)
+        //:
+        //: 2 Stream objects into 'ostringstream's and compare the results.
+        //:   (C-2)
+        //
+        // Testing:
+        //   bool operator==(lhs, rhs);
+        //   bool operator!=(lhs, rhs);
+        //   bsl::ostream& operator<<(stream, object);
+        //   ostream& print(ostream& stream, level, spacesPerLevel) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EQUALITY AND OUTPUT OPERATORS" << endl
+                          << "=============================" << endl;
+
+        const char *DATA[] = { "", "a", "ab", "/tmp/a", "/tmp/a.sock",
+                               "/tmp/b.sock" };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const Obj X(DATA[i]);
+
+            for (int j = 0; j < NUM_DATA; ++j) {
+                const Obj Y(DATA[j]);
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+            }
+
+            bsl::ostringstream out;
+            out << X;
+            ASSERTV(i, out.str(), DATA[i] == out.str());
+        }
+
+        bsl::ostringstream out;
+        Obj("/tmp/x").print(out, 0, -1);
+        ASSERTV(out.str(), bsl::string::npos != out.str().find("path"));
+        ASSERTV(out.str(), bsl::string::npos != out.str().find("/tmp/x"));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PATH VALIDATION
+        //
+        // Concerns:
+        //: 1 Paths of up to 'k_MAX_PATH_LENGTH' characters are valid, and
+        //:   longer paths are not.
+        //:
+        //: 2 Paths containing a null character are not valid.
+        //:
+        //: 3 'setPathIfValid' sets valid paths and returns 0, and leaves the
+        //:   object unchanged and returns a non-zero value otherwise.
+        //:
+        //: 4 'setPath' asserts on invalid paths.
+        //
+        // Plan:
+        //: 1 Try paths of lengths around 'k_MAX_PATH_LENGTH'.  (C-1,3)
+        //:
+        //: 2 Try a path with an embedded null character.  (C-2,3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid paths.  (C-4)
+        //
+        // Testing:
+        //   bool isValid(const bslstl::StringRef& path);
+        //   int setPathIfValid(const bslstl::StringRef& path);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PATH VALIDATION" << endl
+                          << "===============" << endl;
+
+        for (int len = k_MAX - 2; len <= k_MAX + 2; ++len) {
+            const bsl::string path(len, 'p');
+            const bool        EXP = len <= k_MAX;
+
+            ASSERTV(len, EXP == Obj::isValid(path));
+
+            Obj mX("orig");  const Obj& X = mX;
+
+            ASSERTV(len, EXP == (0 == mX.setPathIfValid(path)));
+            ASSERTV(len, EXP ? path == X.path() : !strcmp("orig", X.path()));
+        }
+
+        const bsl::string embedded("ab\0cd", 5);
+        ASSERT(!Obj::isValid(embedded));
+
+        Obj mX("orig");  const Obj& X = mX;
+        ASSERT(0 != mX.setPathIfValid(embedded));
+        ASSERT(0 == bsl::strcmp("orig", X.path()));
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            const bsl::string tooLong(k_MAX + 1, 'p');
+
+            ASSERT_SAFE_PASS(mX.setPath(bsl::string(k_MAX, 'p')));
+            ASSERT_SAFE_FAIL(mX.setPath(tooLong));
+            ASSERT_SAFE_FAIL(mX.setPath(embedded));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, PRIMARY MANIPULATOR, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object has an empty path.
+        //:
+        //: 2 The value constructor and 'setPath' store the supplied path,
+        //:   which 'path' returns null-terminated and 'length' measures.
+        //:
+        //: 3 Copies are independent of the original.
+        //
+        // Plan:
+        //: 1 Construct and set objects with paths from a table, including a
+        //:   path of exactly 'k_MAX_PATH_LENGTH' characters, and check the
+        //:   accessors.  (C-1..2)
+        //:
+        //: 2 Copy-construct and assign, then modify the original.  (C-3)
+        //
+        // Testing:
+        //   LocalAddress();
+        //   LocalAddress(const bslstl::StringRef& path);
+        //   LocalAddress(const LocalAddress& original);
+        //   LocalAddress& operator=(const LocalAddress& rhs);
+        //   void setPath(const bslstl::StringRef& path);
+        //   bool isEmpty() const;
+        //   int length() const;
+        //   const char *path() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "CREATORS, PRIMARY MANIPULATOR, AND BASIC ACCESSORS"
+                      << endl
+                      << "=================================================="
+                      << endl;
+
+        const Obj D;
+        ASSERT(D.isEmpty());
+        ASSERT(0 == D.length());
+        ASSERT(0 == bsl::strcmp("", D.path()));
+
+        const bsl::string longest(k_MAX, 'z');
+        const char *DATA[] = { "", "x", "rel/path", "/tmp/test.sock",
+                               longest.c_str() };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const char *PATH = DATA[i];
+            const int   LEN  = static_cast<int>(bsl::strlen(PATH));
+
+            if (veryVerbose) { T_ P_(i) P(PATH) }
+
+            const Obj X(PATH);
+            ASSERTV(i, 0 == bsl::strcmp(PATH, X.path()));
+            ASSERTV(i, LEN == X.length());
+            ASSERTV(i, (0 == LEN) == X.isEmpty());
+
+            Obj mY("other");  const Obj& Y = mY;
+            mY.setPath(PATH);
+            ASSERTV(i, 0 == bsl::strcmp(PATH, Y.path()));
+            ASSERTV(i, LEN == Y.length());
+        }
+
+        Obj mX("/tmp/a");  const Obj& X = mX;
+        const Obj Y(X);
+        Obj       mZ;  const Obj& Z = mZ;
+        mZ = X;
+        mX.setPath("/tmp/b");
+        ASSERT(0 == bsl::strcmp("/tmp/a", Y.path()));
+        ASSERT(0 == bsl::strcmp("/tmp/a", Z.path()));
+        ASSERT(0 == bsl::strcmp("/tmp/b", X.path()));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create, set, copy, and compare a few objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.isEmpty());
+
+        mX.setPath("/tmp/breathing.sock");
+        ASSERT(!X.isEmpty());
+        ASSERT(0 == bsl::strcmp("/tmp/breathing.sock", X.path()));
+
+        const Obj Y(X);
+        ASSERT(X == Y);
+
+        mX.setPath("/tmp/other.sock");
+        ASSERT(X != Y);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
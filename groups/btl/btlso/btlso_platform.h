@@ -111,6 +111,7 @@ struct Platform {
 
         #ifdef BSLS_PLATFORM_OS_LINUX
             struct EPOLL {};
+            struct IOURING {};    // 'io_uring' syscalls may be available
             typedef EPOLL   DEFAULT_POLLING_MECHANISM;
         #endif
 
@@ -18,6 +18,7 @@ BSLS_IDENT_RCSID(btlso_socketimputil_cpp,"$Id$ $CSID$")
 #include <bsls_platform.h>
 
 #include <bsl_c_stdio.h>
+#include <bsl_cstring.h>
 
 #if defined(BTLSO_PLATFORM_WIN_SOCKETS)
 
@@ -100,6 +101,17 @@ int SocketImpUtil::startup(int *errorCode)
 #include <unistd.h>
 #include <bsl_c_errno.h>
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <linux/errqueue.h>
+
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) \
+ && defined(SO_EE_ORIGIN_ZEROCOPY)
+// Zero-copy transmission is available since Linux 4.14.
+
+#define BTLSO_SOCKETIMPUTIL_ZEROCOPY 1
+#endif
+#endif
+
 // manifest constants for shutdown()
 #define SD_RECEIVE      0x00
 #define SD_SEND         0x01
@@ -789,6 +801,137 @@ int btlso::SocketImpUtil::writev(const btlso::SocketHandle::Handle&  socket,
     return errorNumber ? SocketImpUtil_Util::mapErrorCode(errorNumber) : rc;
 }
 
+int btlso::SocketImpUtil::writevZeroCopy(
+                                 bool                               *zeroCopy,
+                                 const btlso::SocketHandle::Handle&  socket,
+                                 const btls::Ovec                   *ovec,
+                                 int                                 size,
+                                 int                                *errorCode)
+{
+    BSLS_ASSERT(zeroCopy);
+    BSLS_ASSERT(ovec);
+    BSLS_ASSERT(size > 0);
+
+#if defined(BTLSO_SOCKETIMPUTIL_ZEROCOPY)
+    struct msghdr msg;
+
+    memset(&msg, 0, sizeof msg);
+    msg.msg_iov    = reinterpret_cast< ::iovec *>(const_cast<btls::Ovec *>(
+                                                                        ovec));
+    msg.msg_iovlen = size;
+
+    int rc = static_cast<int>(::sendmsg(socket, &msg, MSG_ZEROCOPY));
+
+    if (rc >= 0) {
+        *zeroCopy = 0 < rc;
+        return rc;                                                    // RETURN
+    }
+
+    // The kernel refuses to pin more pages than the socket's option memory
+    // allows ('ENOBUFS'); fall back to copying the data in that case.
+
+    int errorNumber = SocketImpUtil_Util::getErrorCode();
+    if (ENOBUFS != errorNumber) {
+        if (errorCode) {
+            *errorCode = errorNumber;
+        }
+        *zeroCopy = false;
+        return SocketImpUtil_Util::mapErrorCode(errorNumber);         // RETURN
+    }
+#endif
+
+    *zeroCopy = false;
+    return writev(socket, ovec, size, errorCode);
+}
+
+int btlso::SocketImpUtil::enableZeroCopy(
+                                 const btlso::SocketHandle::Handle&  socket,
+                                 int                                *errorCode)
+{
+#if defined(BTLSO_SOCKETIMPUTIL_ZEROCOPY)
+    const int value = 1;
+
+    int rc = ::setsockopt(socket,
+                          SOL_SOCKET,
+                          SO_ZEROCOPY,
+                          &value,
+                          sizeof value);
+
+    int errorNumber = rc >= 0 ? 0 : SocketImpUtil_Util::getErrorCode();
+    if (errorNumber && errorCode) {
+        *errorCode = errorNumber;
+    }
+    return errorNumber ? SocketImpUtil_Util::mapErrorCode(errorNumber) : 0;
+#else
+    (void)socket;
+    (void)errorCode;
+
+    return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;
+#endif
+}
+
+int btlso::SocketImpUtil::readZeroCopyCompletion(
+                                 unsigned int                       *first,
+                                 unsigned int                       *last,
+                                 const btlso::SocketHandle::Handle&  socket,
+                                 int                                *errorCode)
+{
+    BSLS_ASSERT(first);
+    BSLS_ASSERT(last);
+
+#if defined(BTLSO_SOCKETIMPUTIL_ZEROCOPY)
+    // Notifications are queued on the error queue of the socket, one
+    // 'sock_extended_err' control message per 'recvmsg', and never carry
+    // data.
+
+    char          control[CMSG_SPACE(sizeof(sock_extended_err))];
+    struct msghdr msg;
+
+    memset(&msg, 0, sizeof msg);
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof control;
+
+    while (1) {
+        int rc = static_cast<int>(::recvmsg(socket,
+                                            &msg,
+                                            MSG_ERRQUEUE | MSG_DONTWAIT));
+        if (rc < 0) {
+            int errorNumber = SocketImpUtil_Util::getErrorCode();
+            if (errorCode) {
+                *errorCode = errorNumber;
+            }
+            return SocketImpUtil_Util::mapErrorCode(errorNumber);     // RETURN
+        }
+
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+             0 != cmsg;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            const sock_extended_err *error =
+                reinterpret_cast<const sock_extended_err *>(CMSG_DATA(cmsg));
+
+            if (SO_EE_ORIGIN_ZEROCOPY == error->ee_origin
+             && 0 == error->ee_errno) {
+                *first = error->ee_info;
+                *last  = error->ee_data;
+                return 0;                                             // RETURN
+            }
+        }
+
+        // Skip any other kind of queued error, which is also reported by the
+        // next regular operation on 'socket'.
+
+        msg.msg_controllen = sizeof control;
+    }
+#else
+    (void)first;
+    (void)last;
+    (void)socket;
+    (void)errorCode;
+
+    return btlso::SocketHandle::e_ERROR_WOULDBLOCK;
+#endif
+}
+
 int btlso::SocketImpUtil::shutDown(
                                  const btlso::SocketHandle::Handle&  socket,
                                  btlso::SocketImpUtil::ShutDownType  how,
@@ -1069,6 +1212,38 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
     return 0;
 }
 
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+template <>
+int btlso::SocketImpUtil_Imp<btlso::LocalAddress>::socketPair(
+                                       btlso::SocketHandle::Handle *newSockets,
+                                       btlso::SocketImpUtil::Type   type,
+                                       int                          protocol,
+                                       int                         *errorCode)
+{
+    BSLS_ASSERT(newSockets);
+
+    // Validate the parameters
+    if (type != btlso::SocketImpUtil::k_SOCKET_STREAM
+     && type != btlso::SocketImpUtil::k_SOCKET_DATAGRAM) {
+        return -1;                                                    // RETURN
+    }
+
+    // Unlike the loopback emulation above, a pair of connected local sockets
+    // is created atomically by the system.
+
+    int rc = ::socketpair(SocketImpUtil_Address<LocalAddress>::SocketDomain,
+                          static_cast<int>(type),
+                          protocol,
+                          newSockets);
+
+    int errorNumber = rc >= 0 ? 0 : SocketImpUtil_Util::getErrorCode();
+    if (errorNumber && errorCode) {
+        *errorCode = errorNumber;
+    }
+    return errorNumber ? SocketImpUtil_Util::mapErrorCode(errorNumber) : 0;
+}
+#endif
+
 }  // close package namespace
 }  // close enterprise namespace
 
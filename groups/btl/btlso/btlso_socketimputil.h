@@ -128,6 +128,20 @@ BSLS_IDENT("$Id: $")
 // particular address type, all further functions on this socket taking the
 // 'ADDRESS' parameter must use the same address type.
 //
+// On platforms providing BSD sockets, 'btlso::LocalAddress' may also be used
+// as the 'ADDRESS' type, selecting the local (a.k.a. Unix-domain) 'AF_UNIX'
+// socket domain, in which endpoints are named by filesystem paths.  'bind'
+// creates the named socket file, which is not removed when the socket is
+// closed: callers are responsible for unlinking it.  A non-blocking 'connect'
+// to a local socket whose backlog is full fails with
+// 'btlso::SocketHandle::e_ERROR_WOULDBLOCK' on some platforms (e.g., Linux);
+// unlike for TCP, the connection is *not* in progress in that case, and the
+// attempt should be retried.  The unnamed end of a connected local socket
+// reports an empty path as its address.  When a local socket is accessed
+// through functions instantiated for a different address type (e.g.,
+// 'btlso::IPv4Address'), reported addresses have the default value of that
+// type.
+//
 ///Errors
 ///------
 // On success, all functions return a non-negative integer value.  On errors,
@@ -176,6 +190,26 @@ BSLS_IDENT("$Id: $")
 // The 'startup' function may be invoked any number of times.  However, the
 // 'cleanup' function must invoked the same number of times.
 //
+///Zero-Copy Writes
+///----------------
+// On platforms that support it (Linux 4.14 and later), 'writevZeroCopy'
+// transmits data on a TCP socket without copying it into kernel buffers: the
+// kernel references the pages of the caller's buffers until the data has been
+// sent, and then queues a completion notification on the error queue of the
+// socket.  Zero copy must first be enabled on the socket with
+// 'enableZeroCopy', which fails on platforms (and socket types, e.g., local
+// sockets) that do not support it.
+//
+// Each call to 'writevZeroCopy' that writes data with zero copy is assigned
+// the next sequence number of the socket, starting at 0 and wrapping around
+// after 2^32 calls.  'readZeroCopyCompletion' reports the (inclusive) range of
+// sequence numbers of calls whose data the kernel no longer references, after
+// which the corresponding buffers may be modified or reused.  Note that
+// pending notifications make the socket report an error event (e.g.,
+// 'POLLERR') to 'poll' and similar facilities until they are read, and that
+// zero copy only pays off for large writes, as pinning pages and processing
+// the notifications has a cost of its own.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -373,6 +407,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_ipv4address.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#include <btlso_localaddress.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_SOCKETHANDLE
 #include <btlso_sockethandle.h>
 #endif
@@ -414,6 +452,11 @@ BSLS_IDENT("$Id: $")
     #define INCLUDED_NETINET_IN
     #endif
 
+    #ifndef INCLUDED_SYS_UN
+    #include <sys/un.h>
+    #define INCLUDED_SYS_UN
+    #endif
+
     #ifndef INCLUDED_BSL_C_STRING
     #include <bsl_c_string.h> // memset
     #endif
@@ -582,6 +625,15 @@ struct SocketImpUtil {
         // operation, the specified 'address' is used.  For receive operations,
         // only data from the specified 'address' is received.
 
+    static int enableZeroCopy(const SocketHandle::Handle&  socket,
+                              int                         *errorCode = 0);
+        // Enable zero-copy writes (see {Zero-Copy Writes}) on the specified
+        // stream 'socket'.  Load the optionally specified 'errorCode' with the
+        // platform-specific error number on error.  Return 0 on success, and
+        // a negative value otherwise representing an error classification, in
+        // particular if zero copy is not supported by this platform or by the
+        // type of 'socket'.
+
     template <class ADDRESS>
     static int getLocalAddress(ADDRESS                     *localAddress,
                                const SocketHandle::Handle&  socket);
@@ -713,6 +765,21 @@ struct SocketImpUtil {
         // this call blocks until (a) data is read, (b) an EOF indication
         // occurs, or (c) an error occurs.
 
+    static int readZeroCopyCompletion(
+                                 unsigned int                *first,
+                                 unsigned int                *last,
+                                 const SocketHandle::Handle&  socket,
+                                 int                         *errorCode = 0);
+        // Dequeue the next notification of completed zero-copy writes (see
+        // {Zero-Copy Writes}) of the specified 'socket', and load into the
+        // specified 'first' and 'last' the inclusive range of sequence numbers
+        // of the completed writes.  Load the optionally specified 'errorCode'
+        // with the platform-specific error number on error.  Return 0 on
+        // success, 'SocketHandle::e_ERROR_WOULDBLOCK' if no notification is
+        // pending, and a negative value otherwise representing an error
+        // classification.  Note that this call never blocks, and that
+        // 'first <= last' may not hold when the range wraps around.
+
     template <class ADDRESS>
     static int socketPair(SocketHandle::Handle *newSockets,
                           SocketImpUtil::Type   type);
@@ -823,6 +890,28 @@ struct SocketImpUtil {
         // memory locations.  Note that if 'socket' is in blocking mode, this
         // call blocks until either data is written or an error occurs.
 
+    static int writevZeroCopy(bool                        *zeroCopy,
+                              const SocketHandle::Handle&  socket,
+                              const btls::Ovec            *ovec,
+                              int                          numBuffs,
+                              int                         *errorCode = 0);
+        // Send to the specified 'socket' from the buffers specified by 'ovec'
+        // where 'numBuffs' is the number of buffers, without copying the data
+        // if possible (see {Zero-Copy Writes}).  Load into the specified
+        // 'zeroCopy' 'true' if data was written with zero copy, in which case
+        // this write is assigned the next sequence number of 'socket' and the
+        // buffers must not be modified until 'readZeroCopyCompletion' reports
+        // its completion, and 'false' if the data was copied (or not
+        // written), in which case the buffers may be reused immediately.
+        // Load the optionally specified 'errorCode' with the platform-specific
+        // error number on error.  Return the non-negative number of bytes
+        // written on success, and a negative value otherwise representing an
+        // error classification.  The behavior is undefined unless
+        // 'enableZeroCopy' succeeded for 'socket', '0 < numBuffs', and 'ovec'
+        // refers to buffers at valid memory locations.  Note that the data is
+        // copied when the kernel cannot pin more pages for 'socket', and on
+        // platforms not supporting zero copy.
+
     static int shutDown(const SocketHandle::Handle&  socket,
                         SocketImpUtil::ShutDownType  value,
                         int                         *errorCode = 0);
@@ -953,6 +1042,14 @@ struct SocketImpUtil_Address<class IPv4Address> {
     // ACCESSORS
     void fromSocketAddress(IPv4Address *addr) const
     {
+        if (SocketDomain != d_address.sin_family) {
+            // The socket is not an IPv4 socket (e.g., it is a local socket
+            // accessed through an 'IPv4Address'-based interface).
+
+            *addr = IPv4Address();
+            return;                                                   // RETURN
+        }
+
         // No need to change network/host byte order.
 
         if (d_address.sin_addr.s_addr == INADDR_ANY) {
@@ -968,6 +1065,67 @@ struct SocketImpUtil_Address<class IPv4Address> {
     }
 };
 
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+
+template <>
+struct SocketImpUtil_Address<LocalAddress> {
+    // Encapsulate the 'sockaddr_un' structure and provide a mapping to the
+    // equivalent 'LocalAddress'.
+
+    BSLMF_ASSERT(LocalAddress::k_MAX_PATH_LENGTH
+                                         < sizeof(((sockaddr_un *)0)->sun_path));
+
+    sockaddr_un d_address;
+
+    enum {
+        SocketDomain = AF_UNIX
+    };
+
+    // CREATORS
+    SocketImpUtil_Address()
+    {
+        // Functions reporting the address of an unnamed socket do not fill
+        // in 'sun_path', which must therefore be cleared.
+
+        memset(&d_address, 0, sizeof d_address);
+        d_address.sun_family = SocketDomain;
+    }
+
+    SocketImpUtil_Address(const LocalAddress& addr)
+    {
+        memset(&d_address, 0, sizeof d_address);
+        d_address.sun_family = SocketDomain;
+        memcpy(d_address.sun_path, addr.path(), addr.length());
+    }
+
+    // ACCESSORS
+    void fromSocketAddress(LocalAddress *addr) const
+    {
+        if (SocketDomain != d_address.sun_family) {
+            *addr = LocalAddress();
+            return;                                                   // RETURN
+        }
+
+        // 'sun_path' need not be null-terminated when it is full; a path that
+        // does not fit in a 'LocalAddress' is reported as empty.
+
+        const char *end = static_cast<const char *>(
+                                            memchr(d_address.sun_path,
+                                                   '\0',
+                                                   sizeof d_address.sun_path));
+        const int   len = end
+                        ? static_cast<int>(end - d_address.sun_path)
+                        : static_cast<int>(sizeof d_address.sun_path);
+
+        if (0 != addr->setPathIfValid(
+                         bslstl::StringRef(d_address.sun_path, len))) {
+            *addr = LocalAddress();
+        }
+    }
+};
+
+#endif
+
                           // ========================
                           // struct SocketImpUtil_Imp
                           // ========================
@@ -1051,6 +1209,15 @@ int SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
                                       int                          protocol,
                                       int                         *errorCode);
 
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+template <>
+int SocketImpUtil_Imp<btlso::LocalAddress>::socketPair(
+                                      btlso::SocketHandle::Handle *newSockets,
+                                      btlso::SocketImpUtil::Type   type,
+                                      int                          protocol,
+                                      int                         *errorCode);
+#endif
+
 // ============================================================================
 //                      INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -11,6 +11,9 @@
 #include <btlso_socketimputil.h>
 
 #include <btlso_ipv4address.h>
+#include <btlso_localaddress.h>
+
+#include <btls_iovec.h>
 
 #include <bslmt_threadutil.h>
 #include <bslmt_barrier.h>
@@ -19,16 +22,19 @@
 
 #include <bsls_platform.h>
 
+#include <bsl_cstdio.h>              // snprintf()
 #include <bsl_cstdlib.h>             // atoi()
 #include <bsl_cstring.h>             // memset()
 #include <bsl_iostream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #if !defined(BSLS_PLATFORM_CMP_MSVC)
 // for getsockname
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <unistd.h>                  // getpid(), unlink()
 #endif
 
 using namespace BloombergLP;
@@ -223,7 +229,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE TEST
         //
@@ -334,6 +340,255 @@ int main(int argc, char *argv[])
 
      ASSERT(0 == bslmt::ThreadUtil::join(stid));
      ASSERT(0 == bslmt::ThreadUtil::join(ctid));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ZERO-COPY WRITES
+        //
+        // Concerns:
+        //: 1 Where supported, 'enableZeroCopy' succeeds for a TCP socket and
+        //:   fails for a local socket.
+        //:
+        //: 2 'writevZeroCopy' writes the data of all its buffers, and reports
+        //:   whether the write was done with zero copy.
+        //:
+        //: 3 'readZeroCopyCompletion' reports 'e_ERROR_WOULDBLOCK' when no
+        //:   notification is pending, and eventually reports the completion
+        //:   of each zero-copy write, numbered from 0.
+        //:
+        //: 4 Where zero copy is not supported, 'enableZeroCopy' fails and
+        //:   'writevZeroCopy' copies the data.
+        //
+        // Plan:
+        //: 1 Create a TCP socket pair and a local socket pair, and enable zero
+        //:   copy on each.  (C-1, 4)
+        //:
+        //: 2 Write two large messages with 'writevZeroCopy' on the TCP socket
+        //:   and read them from its peer.  Then read notifications until the
+        //:   completion of the second write is reported.  (C-2..4)
+        //
+        // Testing:
+        //   static int enableZeroCopy(socket, errorCode);
+        //   static int readZeroCopyCompletion(first, last, socket, errorCode);
+        //   static int writevZeroCopy(zeroCopy, socket, ovec, numBuffs, err);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ZERO-COPY WRITES" << endl
+                                  << "================" << endl;
+
+        int      rc;
+        SockType s[2];
+
+        rc = T::socketPair<A>(s, T::k_SOCKET_STREAM);
+        ASSERT(0 == rc);
+
+        const bool ZERO_COPY = 0 == T::enableZeroCopy(s[0]);
+        if (verbose) P(ZERO_COPY);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        ASSERT(ZERO_COPY);
+#endif
+
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+        {
+            SockType l[2];
+
+            rc = T::socketPair<btlso::LocalAddress>(l, T::k_SOCKET_STREAM);
+            ASSERT(0 == rc);
+            ASSERT(0 != T::enableZeroCopy(l[0]));
+
+            T::close(l[0]);
+            T::close(l[1]);
+        }
+#endif
+
+        unsigned int first = 17, last = 17;
+
+        rc = T::readZeroCopyCompletion(&first, &last, s[0]);
+        ASSERT(btlso::SocketHandle::e_ERROR_WOULDBLOCK == rc);
+        ASSERT(17 == first);
+        ASSERT(17 == last);
+
+        enum { k_SIZE = 32 * 1024, k_NUM_WRITES = 2 };
+
+        bsl::vector<char> data(2 * k_SIZE);
+        for (int i = 0; i < 2 * k_SIZE; ++i) {
+            data[i] = static_cast<char>(i % 251);
+        }
+
+        btls::Ovec ovec[2];
+        ovec[0].setBuffer(&data[0], k_SIZE);
+        ovec[1].setBuffer(&data[k_SIZE], k_SIZE);
+
+        bsl::vector<char> buffer(2 * k_SIZE);
+
+        int numZeroCopyWrites = 0;
+        for (int i = 0; i < k_NUM_WRITES; ++i) {
+            bool zeroCopy = !ZERO_COPY;
+
+            rc = T::writevZeroCopy(&zeroCopy, s[0], ovec, 2);
+            ASSERT(2 * k_SIZE == rc);
+            if (!ZERO_COPY) {
+                ASSERT(!zeroCopy);
+            }
+            if (zeroCopy) {
+                ++numZeroCopyWrites;
+            }
+
+            int numRead = 0;
+            while (numRead < 2 * k_SIZE) {
+                rc = T::read(&buffer[numRead], s[1], 2 * k_SIZE - numRead);
+                ASSERT(0 < rc);
+                if (0 >= rc) {
+                    break;
+                }
+                numRead += rc;
+            }
+            ASSERT(data == buffer);
+        }
+        if (veryVerbose) P(numZeroCopyWrites);
+
+        if (0 < numZeroCopyWrites) {
+            // Notifications may coalesce the completions of several writes.
+
+            unsigned int expected = 0;
+            for (int i = 0;
+                 i < 1000 && static_cast<int>(expected) < numZeroCopyWrites;
+                 ++i) {
+                rc = T::readZeroCopyCompletion(&first, &last, s[0]);
+                if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == rc) {
+                    bslmt::ThreadUtil::microSleep(1000);
+                    continue;
+                }
+                ASSERT(0 == rc);
+                ASSERT(expected == first);
+                ASSERT(first <= last);
+                expected = last + 1;
+            }
+            ASSERT(numZeroCopyWrites == static_cast<int>(expected));
+
+            rc = T::readZeroCopyCompletion(&first, &last, s[0]);
+            ASSERT(btlso::SocketHandle::e_ERROR_WOULDBLOCK == rc);
+        }
+
+        T::close(s[0]);
+        T::close(s[1]);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LOCAL (UNIX-DOMAIN) SOCKETS
+        //
+        // Concerns:
+        //: 1 Sockets opened for 'btlso::LocalAddress' are 'AF_UNIX' sockets
+        //:   that can be bound to, listened on, accepted from, and connected
+        //:   to by path.
+        //:
+        //: 2 The local address of a bound socket is its path, and the
+        //:   address of the unnamed (connecting) end is empty.
+        //:
+        //: 3 Reporting the address of a local socket through the
+        //:   'btlso::IPv4Address' interface yields the default address.
+        //:
+        //: 4 'socketPair' creates connected local sockets.
+        //
+        // Plan:
+        //: 1 Bind a listening socket to a path in the working directory,
+        //:   connect to it, accept the connection, and exchange data.  Check
+        //:   the addresses reported on both ends.  (C-1..3)
+        //:
+        //: 2 Create stream and datagram socket pairs and exchange data.
+        //:   (C-4)
+        //
+        // Testing:
+        //   CONCERN: 'btlso::LocalAddress' sockets
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "LOCAL (UNIX-DOMAIN) SOCKETS" << endl
+                                  << "===========================" << endl;
+
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+        typedef btlso::LocalAddress L;
+
+        char path[L::k_MAX_PATH_LENGTH + 1];
+        snprintf(path,
+                 sizeof path,
+                 "btlso_socketimputil.%d.sock",
+                 static_cast<int>(getpid()));
+        unlink(path);
+
+        const L SERVER(path);
+
+        int      rc;
+        SockType listener, client, server;
+
+        rc = T::open<L>(&listener, T::k_SOCKET_STREAM);
+        ASSERT(0 == rc);
+        rc = T::bind<L>(listener, SERVER);
+        ASSERT(0 == rc);
+        rc = T::listen(listener, 1);
+        ASSERT(0 == rc);
+
+        L local;
+        rc = T::getLocalAddress<L>(&local, listener);
+        ASSERT(0 == rc);
+        ASSERT(SERVER == local);
+        if (veryVerbose) P(local);
+
+        rc = T::open<L>(&client, T::k_SOCKET_STREAM);
+        ASSERT(0 == rc);
+        rc = T::connect<L>(client, SERVER);
+        ASSERT(0 == rc);
+
+        L peer("not yet set");
+        rc = T::accept<L>(&server, &peer, listener);
+        ASSERT(0 == rc);
+        ASSERT(peer.isEmpty());
+
+        rc = T::getPeerAddress<L>(&peer, client);
+        ASSERT(0 == rc);
+        ASSERT(SERVER == peer);
+
+        A ipv4("1.2.3.4", 5);
+        rc = T::getPeerAddress<A>(&ipv4, client);
+        ASSERT(0 == rc);
+        ASSERT(A() == ipv4);
+
+        const char DATA[] = "local";
+        char       buffer[sizeof DATA];
+
+        rc = T::write(client, DATA, sizeof DATA);
+        ASSERT(sizeof DATA == rc);
+        rc = T::read(buffer, server, sizeof buffer);
+        ASSERT(sizeof DATA == rc);
+        ASSERT(0 == bsl::memcmp(DATA, buffer, sizeof DATA));
+
+        T::close(client);
+        T::close(server);
+        T::close(listener);
+        ASSERT(0 == unlink(path));
+
+        const enum T::Type TYPES[] = { T::k_SOCKET_STREAM,
+                                       T::k_SOCKET_DATAGRAM };
+
+        for (int i = 0; i < 2; ++i) {
+            SockType s[2];
+
+            rc = T::socketPair<L>(s, TYPES[i]);
+            ASSERT(0 == rc);
+            ASSERT(s[0] != s[1]);
+
+            rc = T::write(s[0], DATA, sizeof DATA);
+            ASSERT(sizeof DATA == rc);
+            rc = T::read(buffer, s[1], sizeof buffer);
+            ASSERT(sizeof DATA == rc);
+            ASSERT(0 == bsl::memcmp(DATA, buffer, sizeof DATA));
+
+            T::close(s[0]);
+            T::close(s[1]);
+        }
+#else
+        if (verbose) cout << "Local sockets are not supported." << endl;
+#endif
       } break;
       case 1: {
         // --------------------------------------------------------------------